@@ -0,0 +1,57 @@
+-- FLuaCoroutineScheduler 부하 테스트
+-- 빈 액터에 Lua 스크립트 컴포넌트로 붙이고 PIE 실행
+-- 10만 개 코루틴을 wait_time / wait_event / wait_predicate 로 나눠 동시에 대기시킨 뒤 모두 끝나는지 확인한다
+
+local NumCoroutines = 100000
+local EventTriggerTime = 2.0
+
+local Finished = 0
+local Elapsed = 0
+local Frames = 0
+local bReleased = false
+
+local function OnFinished()
+    Finished = Finished + 1
+    if Finished == NumCoroutines then
+        print("[CoroutineStress] finished " .. NumCoroutines .. " coroutines, elapsed " .. Elapsed .. "s, frames " .. Frames)
+    end
+end
+
+function BeginPlay()
+    for i = 1, NumCoroutines do
+        local Kind = i % 3
+        if Kind == 0 then
+            StartCoroutine(function()
+                coroutine.yield("wait_time", (i % 100) * 0.01)
+                coroutine.yield("wait_time", 0.5)
+                OnFinished()
+            end)
+        elseif Kind == 1 then
+            StartCoroutine(function()
+                coroutine.yield("wait_event", "CoroutineStress")
+                coroutine.yield()
+                OnFinished()
+            end)
+        else
+            StartCoroutine(function()
+                coroutine.yield("wait_predicate", function() return bReleased end)
+                OnFinished()
+            end)
+        end
+    end
+    print("[CoroutineStress] started " .. NumCoroutines .. " coroutines")
+end
+
+function Tick(dt)
+    Elapsed = Elapsed + dt
+    Frames = Frames + 1
+
+    if not bReleased and Elapsed >= EventTriggerTime then
+        bReleased = true
+        TriggerEvent("CoroutineStress")
+    end
+end
+
+function EndPlay()
+    print("[CoroutineStress] finished " .. Finished .. " / " .. NumCoroutines)
+end
@@ -0,0 +1,100 @@
+-- LuaComponentProxy 프로퍼티 읽기/쓰기 벤치마크
+-- 빈 액터에 Lua 스크립트 컴포넌트로 붙이고 PIE 실행
+-- UTestAutoBindComponent의 float / bool / FVector 프로퍼티와 메서드 호출을 매 프레임 반복하고 초당 접근 횟수를 출력한다
+
+local Iterations = 100000
+local ReportInterval = 1.0
+
+local Comp = nil
+local Elapsed = 0
+local Samples = {}
+
+local function Measure(Name, Body)
+    local T0 = Clock()
+    Body()
+    local Seconds = Clock() - T0
+    local Sample = Samples[Name]
+    if not Sample then
+        Sample = { Seconds = 0, Count = 0 }
+        Samples[Name] = Sample
+    end
+    Sample.Seconds = Sample.Seconds + Seconds
+    Sample.Count = Sample.Count + Iterations
+end
+
+local function Report()
+    for Name, Sample in pairs(Samples) do
+        if Sample.Seconds > 0 then
+            local PerSecond = Sample.Count / Sample.Seconds
+            local NsPerOp = Sample.Seconds * 1.0e9 / Sample.Count
+            print(string.format("[PropertyBench] %-12s %12.0f ops/s  %8.1f ns/op", Name, PerSecond, NsPerOp))
+        end
+        Sample.Seconds = 0
+        Sample.Count = 0
+    end
+end
+
+function BeginPlay()
+    Comp = AddComponent(Obj, "UTestAutoBindComponent")
+    if not Comp then
+        print("[PropertyBench] UTestAutoBindComponent not found")
+        return
+    end
+    print("[PropertyBench] started, " .. Iterations .. " iterations per case per frame")
+end
+
+function Tick(dt)
+    if not Comp then
+        return
+    end
+
+    Measure("ReadFloat", function()
+        local Sum = 0
+        for i = 1, Iterations do
+            Sum = Sum + Comp.Intensity
+        end
+    end)
+
+    Measure("WriteFloat", function()
+        for i = 1, Iterations do
+            Comp.Intensity = i
+        end
+    end)
+
+    Measure("ReadBool", function()
+        local Count = 0
+        for i = 1, Iterations do
+            if Comp.bEnabled then Count = Count + 1 end
+        end
+    end)
+
+    Measure("ReadVector", function()
+        local Sum = 0
+        for i = 1, Iterations do
+            Sum = Sum + Comp.Position.X
+        end
+    end)
+
+    Measure("WriteVector", function()
+        local V = Vector(1, 2, 3)
+        for i = 1, Iterations do
+            Comp.Position = V
+        end
+    end)
+
+    Measure("CallMethod", function()
+        for i = 1, Iterations do
+            Comp:SetIntensity(i)
+        end
+    end)
+
+    Elapsed = Elapsed + dt
+    if Elapsed >= ReportInterval then
+        Elapsed = 0
+        Report()
+    end
+end
+
+function EndPlay()
+    Report()
+end
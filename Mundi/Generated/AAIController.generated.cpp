@@ -39,6 +39,8 @@ BEGIN_PROPERTIES(AAIController)
     ADD_PROPERTY(float, MoveSpeed, "Movement", true)
     ADD_PROPERTY(float, RotationSpeed, "Movement", true)
     ADD_PROPERTY(float, AcceptanceRadius, "Movement", true)
+    ADD_PROPERTY(bool, bUseNavigation, "Navigation", true)
+    ADD_PROPERTY(float, RepathDistance, "Navigation", true)
 END_PROPERTIES()
 
 // ===== Lua Binding =====
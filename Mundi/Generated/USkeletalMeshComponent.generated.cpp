@@ -38,6 +38,7 @@ BEGIN_PROPERTIES(USkeletalMeshComponent)
     ADD_PROPERTY(UAnimSequence*, CurrentAnimation, "", false)
     ADD_PROPERTY(UAnimInstance*, AnimInstance, "", false)
     ADD_PROPERTY(FString, AnimGraphPath, "Animation", true)
+    ADD_PROPERTY(bool, bEnableUpdateRateOptimizations, "Animation", true, "거리/화면 크기에 따라 포즈 평가 주기를 낮추고 군중 포즈를 공유")
 END_PROPERTIES()
 
 // ===== Lua Binding =====
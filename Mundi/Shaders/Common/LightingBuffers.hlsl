@@ -40,6 +40,10 @@ cbuffer TileCullingBuffer : register(b11)
     uint bUseTileCulling;   // 타일 컬링 활성화 여부 (0=비활성화, 1=활성화)
     uint ViewportStartX;    // 뷰포트 시작 X 좌표
     uint ViewportStartY;    // 뷰포트 시작 Y 좌표
+    uint ClusterSliceCount; // 깊이 슬라이스 수 (0=2D 타일)
+    uint LightListStride;   // 타일(클러스터)당 인덱스 버퍼 간격
+    float ClusterDepthScale;// Slice = floor(log2(ViewZ) * Scale + Bias)
+    float ClusterDepthBias;
     uint2 Padding;          // 16바이트 정렬을 위한 패딩
 };
 
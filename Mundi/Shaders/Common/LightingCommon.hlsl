@@ -55,12 +55,26 @@ uint CalculateTileIndex(float4 screenPos, float viewportStartX, float viewportSt
     return tileY * TileCountX + tileX;
 }
 
-// 타일별 라이트 인덱스 데이터의 시작 오프셋 계산
+// 클러스터 인덱스 계산 (ClusterSliceCount == 0이면 타일 인덱스 그대로)
+// 깊이 슬라이스는 뷰 공간 Z의 로그 분할 (FTileLightCuller::GetDepthSlice와 동일)
+uint CalculateClusterIndex(float4 screenPos, float viewDepth)
+{
+    uint tileIndex = CalculateTileIndex(screenPos, ViewportStartX, ViewportStartY);
+    if (ClusterSliceCount == 0)
+    {
+        return tileIndex;
+    }
+
+    int slice = int(floor(log2(max(viewDepth, 1e-4f)) * ClusterDepthScale + ClusterDepthBias));
+    slice = clamp(slice, 0, int(ClusterSliceCount) - 1);
+    return uint(slice) * TileCountX * TileCountY + tileIndex;
+}
+
+// 타일(클러스터)별 라이트 인덱스 데이터의 시작 오프셋 계산
 uint GetTileDataOffset(uint tileIndex)
 {
-    // MaxLightsPerTile = 256 (TileLightCuller.h와 일치)
-    const uint MaxLightsPerTile = 256;
-    return tileIndex * MaxLightsPerTile;
+    // 타일 모드 256, 클러스터 모드 32 (TileLightCuller.h와 일치, 상수 버퍼로 전달)
+    return tileIndex * LightListStride;
 }
 
 //================================================================================================
@@ -879,7 +893,7 @@ float3 CalculateAllLights(
     // Point + Spot with 타일 컬링
     if (bUseTileCulling)
     {
-        uint tileIndex = CalculateTileIndex(screenPos, ViewportStartX, ViewportStartY);
+        uint tileIndex = CalculateClusterIndex(screenPos, viewPos.z);
         uint tileDataOffset = GetTileDataOffset(tileIndex);
         uint lightCount = g_TileLightIndices[tileDataOffset];
 
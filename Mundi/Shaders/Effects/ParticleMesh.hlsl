@@ -225,7 +225,7 @@ PS_OUTPUT mainPS(PS_INPUT Input)
     // Tile Culling 적용
     if (bUseTileCulling)
     {
-        uint tileIndex = CalculateTileIndex(Input.Position, ViewportStartX, ViewportStartY);
+        uint tileIndex = CalculateClusterIndex(Input.Position, ViewPos.z);
         uint tileDataOffset = GetTileDataOffset(tileIndex);
         uint lightCount = g_TileLightIndices[tileDataOffset];
 
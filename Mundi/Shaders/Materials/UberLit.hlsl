@@ -13,6 +13,11 @@
 #define USE_GPU_SKINNING 0
 #endif
 
+// 자동 인스턴싱 변형: 월드 행렬/색상/ObjectID를 ModelBuffer, ColorBuffer 대신 인스턴스 버퍼(슬롯 1)에서 읽는다
+#ifndef USE_INSTANCING
+#define USE_INSTANCING 0
+#endif
+
 // --- Material 구조체 (OBJ 머티리얼 정보) ---
 // 주의: SPECULAR_COLOR 매크로에서 사용하므로 include 전에 정의 필요
 struct FMaterial
@@ -151,6 +156,20 @@ struct VS_INPUT
     uint4 BoneIndices : BLENDINDICES0;
     float4 BoneWeights : BLENDWEIGHT0;
 #endif        
+#if USE_INSTANCING
+    float4 InstanceWorld0 : INSTANCE_WORLD0;
+    float4 InstanceWorld1 : INSTANCE_WORLD1;
+    float4 InstanceWorld2 : INSTANCE_WORLD2;
+    float4 InstanceWorld3 : INSTANCE_WORLD3;
+
+    float4 InstanceInvWorld0 : INSTANCE_INVWORLD0;
+    float4 InstanceInvWorld1 : INSTANCE_INVWORLD1;
+    float4 InstanceInvWorld2 : INSTANCE_INVWORLD2;
+    float4 InstanceInvWorld3 : INSTANCE_INVWORLD3;
+
+    float4 InstanceColor : INSTANCE_COLOR;
+    uint InstanceUUID : INSTANCE_ID;
+#endif
 };
 
 struct PS_INPUT
@@ -161,6 +180,10 @@ struct PS_INPUT
     row_major float3x3 TBN : TBN;
     float4 Color : COLOR;
     float2 TexCoord : TEXCOORD0;
+#if USE_INSTANCING
+    nointerpolation float4 InstanceColor : INSTANCE_COLOR;
+    nointerpolation uint InstanceUUID : INSTANCE_ID;
+#endif
 };
 
 struct PS_OUTPUT
@@ -186,16 +209,26 @@ PS_INPUT mainVS(VS_INPUT Input)
     float3 ModelTangent = Input.Tangent.xyz;
 #endif
 
-    float4 WorldPos = mul(float4(ModelPosition, 1.0f), WorldMatrix);
+#if USE_INSTANCING
+    float4x4 ObjectWorld = float4x4(Input.InstanceWorld0, Input.InstanceWorld1, Input.InstanceWorld2, Input.InstanceWorld3);
+    float4x4 ObjectWorldInverseTranspose = float4x4(Input.InstanceInvWorld0, Input.InstanceInvWorld1, Input.InstanceInvWorld2, Input.InstanceInvWorld3);
+    Out.InstanceColor = Input.InstanceColor;
+    Out.InstanceUUID = Input.InstanceUUID;
+#else
+    float4x4 ObjectWorld = WorldMatrix;
+    float4x4 ObjectWorldInverseTranspose = WorldInverseTranspose;
+#endif
+
+    float4 WorldPos = mul(float4(ModelPosition, 1.0f), ObjectWorld);
     Out.WorldPos = WorldPos.xyz;
 
     float4 ViewPos = mul(WorldPos, ViewMatrix);
     Out.Position = mul(ViewPos, ProjectionMatrix);
 
-    float3 WorldNormal = normalize(mul(ModelNormal, (float3x3)WorldInverseTranspose));
+    float3 WorldNormal = normalize(mul(ModelNormal, (float3x3)ObjectWorldInverseTranspose));
     Out.Normal = WorldNormal;
 
-    float3 Tangent = normalize(mul(ModelTangent, (float3x3)WorldMatrix));
+    float3 Tangent = normalize(mul(ModelTangent, (float3x3)ObjectWorld));
     float3 BiTangent = normalize(cross(WorldNormal, Tangent) * Input.Tangent.w);
     row_major float3x3 TBN;
     TBN._m00_m01_m02 = Tangent;
@@ -282,7 +315,13 @@ PS_INPUT mainVS(VS_INPUT Input)
 PS_OUTPUT mainPS(PS_INPUT Input)
 {
     PS_OUTPUT Output;
+#if USE_INSTANCING
+    Output.UUID = Input.InstanceUUID;
+    float4 ObjectLerpColor = Input.InstanceColor;
+#else
     Output.UUID = UUID;
+    float4 ObjectLerpColor = LerpColor;
+#endif
     
     //CSM 구간 시각화
     float3 Color[2] =
@@ -390,7 +429,7 @@ PS_OUTPUT mainPS(PS_INPUT Input)
     // 비머티리얼 오브젝트의 머티리얼/색상 블렌딩 적용
     if (!bHasMaterial)
     {
-        finalPixel.rgb = lerp(finalPixel.rgb, LerpColor.rgb, LerpColor.a);
+        finalPixel.rgb = lerp(finalPixel.rgb, ObjectLerpColor.rgb, ObjectLerpColor.a);
     }
 
     // 머티리얼 투명도 적용 (0=불투명, 1=투명)
@@ -421,7 +460,7 @@ PS_OUTPUT mainPS(PS_INPUT Input)
     else
     {
         // 텍스처와 머티리얼 모두 없음, LerpColor와 블렌드
-        baseColor.rgb = lerp(baseColor.rgb, LerpColor.rgb, LerpColor.a);
+        baseColor.rgb = lerp(baseColor.rgb, ObjectLerpColor.rgb, ObjectLerpColor.a);
     }
 
     float3 litColor = float3(0.0f, 0.0f, 0.0f);
@@ -443,7 +482,7 @@ PS_OUTPUT mainPS(PS_INPUT Input)
     if (bUseTileCulling)
     {
         // 현재 픽셀이 속한 타일 계산
-        uint tileIndex = CalculateTileIndex(Input.Position, ViewportStartX, ViewportStartY);
+        uint tileIndex = CalculateClusterIndex(Input.Position, ViewPos.z);
         uint tileDataOffset = GetTileDataOffset(tileIndex);
 
         // 타일에 영향을 주는 라이트 개수
@@ -530,7 +569,7 @@ PS_OUTPUT mainPS(PS_INPUT Input)
     else
     {
         // 텍스처와 머티리얼 모두 없음, LerpColor와 블렌드
-        baseColor.rgb = lerp(baseColor.rgb, LerpColor.rgb, LerpColor.a);
+        baseColor.rgb = lerp(baseColor.rgb, ObjectLerpColor.rgb, ObjectLerpColor.a);
     }
 
     float3 litColor = float3(0.0f, 0.0f, 0.0f);
@@ -555,7 +594,7 @@ PS_OUTPUT mainPS(PS_INPUT Input)
     if (bUseTileCulling)
     {
         // 현재 픽셀이 속한 타일 계산
-        uint tileIndex = CalculateTileIndex(Input.Position, ViewportStartX, ViewportStartY);
+        uint tileIndex = CalculateClusterIndex(Input.Position, ViewPos.z);
         uint tileDataOffset = GetTileDataOffset(tileIndex);
 
         // 타일에 영향을 주는 라이트 개수
@@ -633,7 +672,7 @@ PS_OUTPUT mainPS(PS_INPUT Input)
     else
     {
         // LerpColor와 블렌드
-        finalPixel.rgb = lerp(finalPixel.rgb, LerpColor.rgb, LerpColor.a);
+        finalPixel.rgb = lerp(finalPixel.rgb, ObjectLerpColor.rgb, ObjectLerpColor.a);
         finalPixel.rgb *= texColor.rgb;
     }
 
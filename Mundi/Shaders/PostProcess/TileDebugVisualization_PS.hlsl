@@ -13,6 +13,10 @@ cbuffer TileCullingBuffer : register(b11)
     uint bUseTileCulling;   // 타일 컬링 활성화 여부 (0=비활성화, 1=활성화)
     uint ViewportStartX;    // 뷰포트 시작 X 좌표
     uint ViewportStartY;    // 뷰포트 시작 Y 좌표
+    uint ClusterSliceCount; // 깊이 슬라이스 수 (0=2D 타일)
+    uint LightListStride;   // 타일(클러스터)당 인덱스 버퍼 간격
+    float ClusterDepthScale;// Slice = floor(log2(ViewZ) * Scale + Bias)
+    float ClusterDepthBias;
     uint2 Padding;          // 16바이트 정렬을 위한 패딩
 };
 
@@ -41,8 +45,7 @@ uint CalculateTileIndex(float2 screenPos)
 // 타일별 라이트 인덱스 데이터의 시작 오프셋 계산
 uint GetTileDataOffset(uint tileIndex)
 {
-    const uint MaxLightsPerTile = 256;
-    return tileIndex * MaxLightsPerTile;
+    return tileIndex * LightListStride;
 }
 
 // 라이트 개수를 색상으로 변환 (히트맵)
@@ -98,10 +101,14 @@ float4 mainPS(float4 Pos : SV_Position, float2 TexCoord : TEXCOORD0) : SV_Target
 
     // 현재 픽셀이 속한 타일 계산
     uint tileIndex = CalculateTileIndex(Pos.xy);
-    uint tileDataOffset = GetTileDataOffset(tileIndex);
 
-    // 타일의 라이트 개수
-    uint lightCount = g_TileLightIndices[tileDataOffset];
+    // 타일의 라이트 개수 (클러스터 모드는 깊이 슬라이스 중 최대값)
+    uint lightCount = g_TileLightIndices[GetTileDataOffset(tileIndex)];
+    for (uint slice = 1; slice < ClusterSliceCount; slice++)
+    {
+        uint clusterIndex = slice * TileCountX * TileCountY + tileIndex;
+        lightCount = max(lightCount, g_TileLightIndices[GetTileDataOffset(clusterIndex)]);
+    }
 
     // 히트맵 색상 계산
     float3 heatmapColor = LightCountToHeatmap(lightCount);
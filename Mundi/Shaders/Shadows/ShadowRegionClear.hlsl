@@ -0,0 +1,27 @@
+// 섀도우 아틀라스의 한 영역만 지우는 셰이더
+// 뷰포트를 지울 영역으로 맞춘 뒤 DeviceContext->Draw(6, 0); 으로 호출합니다.
+// 깊이 1.0을 쓰므로 깊이 쓰기가 켜진 GreaterEqual 상태로 그려야 합니다.
+
+struct VS_OUTPUT
+{
+    float4 Position : SV_POSITION;
+};
+
+VS_OUTPUT mainVS(uint VertexID : SV_VertexID)
+{
+    const float2 Positions[6] =
+    {
+        float2(-1, 1), float2(1, 1), float2(-1, -1),
+        float2(-1, -1), float2(1, 1), float2(1, -1)
+    };
+
+    VS_OUTPUT Out;
+    Out.Position = float4(Positions[VertexID], 1.0f, 1.0f); // z = 1 (가장 먼 깊이)
+    return Out;
+}
+
+// VSM 모멘트 초기값 (전체 클리어 색상 {1, 1, 0, 0}과 동일)
+float2 mainPS(VS_OUTPUT Input) : SV_TARGET
+{
+    return float2(1.0f, 1.0f);
+}
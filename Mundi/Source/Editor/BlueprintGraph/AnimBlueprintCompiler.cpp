@@ -2,6 +2,7 @@
 #include "AnimBlueprintCompiler.h"
 #include "AnimationGraph.h"
 #include "BlueprintEvaluator.h"
+#include "BlueprintBytecode.h"
 #include "EdGraphNode.h"
 #include "K2Node_Animation.h"
 #include "Source/Runtime/Engine/Animation/AnimInstance.h"
@@ -126,22 +127,59 @@ void FAnimBlueprintCompiler::Compile(UAnimationGraph* InGraph, UAnimInstance* In
 
                 float BlendTime = FBlueprintEvaluator::EvaluateInput<float>(TransitionNode->FindPin("Blend Time"), &Context);
 
-                auto Condition = [TransitionNode, InAnimInstance]() -> bool
+                // 전이 조건은 인스턴스마다 반복 평가되므로 바이트코드로 컴파일한다
+                std::function<bool()> Condition;
+                TArray<FName> ConditionInputs;
+                bool bPollCondition = true;
+                auto Program = std::make_shared<FBlueprintProgram>();
+                if (FBlueprintExpressionCompiler::Compile(TransitionNode->FindPin("Can Transition"), EBlueprintRegisterType::Bool, *Program))
                 {
-                    if (!TransitionNode || !InAnimInstance)
+                    // 선언된 입력(Speed, IsGrounded 등)만 읽으면 해당 변수가 바뀔 때만 평가
+                    if (!Program->HasUntrackedInputs())
                     {
-                        return false;
+                        ConditionInputs = Program->GetInputNames();
+                        bPollCondition = false;
                     }
 
-                    FBlueprintContext RuntimeContext(InAnimInstance);
+                    Condition = [Program, InAnimInstance]() -> bool
+                    {
+                        if (!InAnimInstance)
+                        {
+                            return false;
+                        }
+
+                        FBlueprintContext RuntimeContext(InAnimInstance);
+                        return Program->ExecuteBool(&RuntimeContext);
+                    };
+                }
+                else
+                {
+                    // 컴파일 실패 시 기존 방식으로 그래프를 직접 평가
+                    Condition = [TransitionNode, InAnimInstance]() -> bool
+                    {
+                        if (!TransitionNode || !InAnimInstance)
+                        {
+                            return false;
+                        }
 
-                    return FBlueprintEvaluator::EvaluateInput<bool>(
-                        TransitionNode->FindPin("Can Transition"),
-                        &RuntimeContext
-                    );
-                };
+                        FBlueprintContext RuntimeContext(InAnimInstance);
+
+                        return FBlueprintEvaluator::EvaluateInput<bool>(
+                            TransitionNode->FindPin("Can Transition"),
+                            &RuntimeContext
+                        );
+                    };
+                }
 
-                OutStateMachine->AddTransition(FStateTransition(FromName, ToName, Condition, BlendTime));
+                FStateTransition Transition(FromName, ToName, Condition, BlendTime);
+                Transition.Inputs = ConditionInputs;
+                Transition.bPollCondition = bPollCondition;
+                OutStateMachine->AddTransition(Transition);
+
+                if (!ConditionInputs.IsEmpty())
+                {
+                    OutStateMachine->SetSampleMovementInputs(true);
+                }
             }
         }
     }
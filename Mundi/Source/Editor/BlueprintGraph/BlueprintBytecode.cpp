@@ -0,0 +1,418 @@
+﻿#include "pch.h"
+#include "BlueprintBytecode.h"
+#include "EdGraphNode.h"
+#include "EdGraphPin.h"
+#include <cstdlib>
+
+namespace
+{
+    constexpr int32 MaxRegisters = 0xFFFF;
+
+    bool GetPinRegisterType(const UEdGraphPin* Pin, EBlueprintRegisterType& OutType)
+    {
+        const FName& Category = Pin->PinType.PinCategory;
+        if (Category == FEdGraphPinCategory::Float) { OutType = EBlueprintRegisterType::Float; return true; }
+        if (Category == FEdGraphPinCategory::Int) { OutType = EBlueprintRegisterType::Int; return true; }
+        if (Category == FEdGraphPinCategory::Bool) { OutType = EBlueprintRegisterType::Bool; return true; }
+        return false;
+    }
+
+    FBlueprintRegister UnboxValue(const FBlueprintValue& InValue, EBlueprintRegisterType Type)
+    {
+        switch (Type)
+        {
+        case EBlueprintRegisterType::Int:
+            if (const int32* Value = std::get_if<int32>(&InValue.Value)) { return FBlueprintRegister::MakeInt(*Value); }
+            break;
+        case EBlueprintRegisterType::Float:
+            if (const float* Value = std::get_if<float>(&InValue.Value)) { return FBlueprintRegister::MakeFloat(*Value); }
+            break;
+        case EBlueprintRegisterType::Bool:
+            if (const bool* Value = std::get_if<bool>(&InValue.Value)) { return FBlueprintRegister::MakeBool(*Value); }
+            break;
+        }
+        return FBlueprintRegister{};
+    }
+}
+
+// ----------------------------------------------------------------
+//	FBlueprintVMFrame
+// ----------------------------------------------------------------
+
+void* FBlueprintVMFrame::Resolve(FBlueprintContextResolver Resolver)
+{
+    for (int32 i = 0; i < NumResolved; ++i)
+    {
+        if (ResolvedKeys[i] == Resolver)
+        {
+            return ResolvedValues[i];
+        }
+    }
+
+    void* Value = Resolver(Context);
+    if (NumResolved < MaxResolvedEntries)
+    {
+        ResolvedKeys[NumResolved] = Resolver;
+        ResolvedValues[NumResolved] = Value;
+        ++NumResolved;
+    }
+    return Value;
+}
+
+// ----------------------------------------------------------------
+//	FBlueprintProgram (인터프리터)
+// ----------------------------------------------------------------
+
+void FBlueprintProgram::ExecuteInstruction(const FBlueprintInstruction& I, FBlueprintRegister* R,
+    const FBlueprintProgram& Program, FBlueprintVMFrame* Frame)
+{
+    switch (I.Op)
+    {
+    case EBlueprintOpCode::AddFloat:        R[I.Dst].Float = R[I.A].Float + R[I.B].Float; break;
+    case EBlueprintOpCode::SubtractFloat:   R[I.Dst].Float = R[I.A].Float - R[I.B].Float; break;
+    case EBlueprintOpCode::MultiplyFloat:   R[I.Dst].Float = R[I.A].Float * R[I.B].Float; break;
+    case EBlueprintOpCode::DivideFloat:     R[I.Dst].Float = R[I.A].Float / R[I.B].Float; break;
+    case EBlueprintOpCode::GreaterFloat:    R[I.Dst].Bool = R[I.A].Float > R[I.B].Float; break;
+    case EBlueprintOpCode::EqualFloat:      R[I.Dst].Bool = R[I.A].Float == R[I.B].Float; break;
+
+    case EBlueprintOpCode::AddInt:          R[I.Dst].Int = R[I.A].Int + R[I.B].Int; break;
+    case EBlueprintOpCode::SubtractInt:     R[I.Dst].Int = R[I.A].Int - R[I.B].Int; break;
+    case EBlueprintOpCode::MultiplyInt:     R[I.Dst].Int = R[I.A].Int * R[I.B].Int; break;
+    // @note 상수 폴딩(에디터)에서도 실행되므로 0으로 나누면 크래시 대신 0을 반환한다.
+    case EBlueprintOpCode::DivideInt:       R[I.Dst].Int = R[I.B].Int != 0 ? R[I.A].Int / R[I.B].Int : 0; break;
+    case EBlueprintOpCode::GreaterInt:      R[I.Dst].Bool = R[I.A].Int > R[I.B].Int; break;
+    case EBlueprintOpCode::EqualInt:        R[I.Dst].Bool = R[I.A].Int == R[I.B].Int; break;
+
+    case EBlueprintOpCode::And:             R[I.Dst].Bool = R[I.A].Bool && R[I.B].Bool; break;
+    case EBlueprintOpCode::Or:              R[I.Dst].Bool = R[I.A].Bool || R[I.B].Bool; break;
+    case EBlueprintOpCode::Xor:             R[I.Dst].Bool = R[I.A].Bool != R[I.B].Bool; break;
+    case EBlueprintOpCode::Not:             R[I.Dst].Bool = !R[I.A].Bool; break;
+
+    case EBlueprintOpCode::Select:          R[I.Dst] = R[I.A].Bool ? R[I.B] : R[I.C]; break;
+
+    case EBlueprintOpCode::CallNative:
+        R[I.Dst] = Frame ? Program.NativeFunctions[I.A](*Frame, static_cast<int16>(I.B)) : FBlueprintRegister{};
+        break;
+
+    case EBlueprintOpCode::CallNode:
+    {
+        const UEdGraphPin* Pin = Program.ExternalPins[I.A];
+        R[I.Dst] = Frame ? UnboxValue(Pin->OwningNode->EvaluatePin(Pin, Frame->GetContext()), I.ResultType) : FBlueprintRegister{};
+        break;
+    }
+    }
+}
+
+FBlueprintRegister FBlueprintProgram::Execute(FBlueprintContext* Context)
+{
+    if (!bValid)
+    {
+        return FBlueprintRegister{};
+    }
+
+    FBlueprintVMFrame Frame(Context);
+    FBlueprintRegister* RegisterFile = Registers.data();
+    for (const FBlueprintInstruction& Instruction : Instructions)
+    {
+        ExecuteInstruction(Instruction, RegisterFile, *this, &Frame);
+    }
+    return RegisterFile[ResultRegister];
+}
+
+// ----------------------------------------------------------------
+//	FBlueprintExpressionCompiler
+// ----------------------------------------------------------------
+
+bool FBlueprintExpressionCompiler::Compile(const UEdGraphPin* InputPin, EBlueprintRegisterType ResultType, FBlueprintProgram& OutProgram)
+{
+    OutProgram = FBlueprintProgram();
+
+    FBlueprintExpressionCompiler Compiler(OutProgram);
+    const int32 Result = Compiler.CompileInput(InputPin, ResultType);
+    if (Compiler.bFailed || Result == INDEX_NONE)
+    {
+        OutProgram = FBlueprintProgram();
+        return false;
+    }
+
+    OutProgram.ResultRegister = static_cast<uint16>(Result);
+    OutProgram.ResultType = ResultType;
+    OutProgram.bValid = true;
+    return true;
+}
+
+int32 FBlueprintExpressionCompiler::CompileInput(const UEdGraphPin* InputPin, EBlueprintRegisterType Type)
+{
+    if (bFailed)
+    {
+        return INDEX_NONE;
+    }
+
+    if (!InputPin)
+    {
+        // EvaluateInput과 같이 핀이 없으면 기본값
+        return EmitConstant(FBlueprintRegister{}, Type);
+    }
+
+    // @note 표현식용 입력핀은 하나의 Source만을 가져야 한다.
+    if (InputPin->LinkedTo.Num() > 0)
+    {
+        const UEdGraphPin* SourcePin = InputPin->LinkedTo[0];
+        if (SourcePin && SourcePin->OwningNode)
+        {
+            return CompileOutputPin(SourcePin, Type);
+        }
+    }
+
+    // 연결되지 않은 입력 핀의 기본값은 여기서 한 번만 파싱한다
+    FBlueprintRegister Value;
+    if (!ParseDefaultValue(InputPin->DefaultValue, Type, Value))
+    {
+        UE_LOG("[warning] FBlueprintExpressionCompiler: 핀 '%s'의 기본값 '%s'를 파싱하지 못해 0을 사용합니다.",
+            InputPin->PinName.c_str(), InputPin->DefaultValue.c_str());
+    }
+    return EmitConstant(Value, Type);
+}
+
+int32 FBlueprintExpressionCompiler::CompileOutputPin(const UEdGraphPin* OutputPin, EBlueprintRegisterType Type)
+{
+    EBlueprintRegisterType PinType;
+    if (!GetPinRegisterType(OutputPin, PinType) || PinType != Type)
+    {
+        Fail("핀 타입이 스칼라가 아니거나 입력 타입과 다릅니다", OutputPin);
+        return INDEX_NONE;
+    }
+
+    if (const int32* Found = PinRegisters.Find(OutputPin))
+    {
+        return *Found;
+    }
+
+    if (PinsInProgress.Contains(OutputPin))
+    {
+        Fail("순환 연결", OutputPin);
+        return INDEX_NONE;
+    }
+
+    PinsInProgress.Add(OutputPin);
+    int32 Register = OutputPin->OwningNode->CompilePin(OutputPin, *this);
+    PinsInProgress.Remove(OutputPin);
+
+    if (bFailed)
+    {
+        return INDEX_NONE;
+    }
+
+    if (Register == INDEX_NONE)
+    {
+        // CompilePin을 구현하지 않은 노드는 기존 EvaluatePin을 호출한다
+        Register = AllocateRegister(Type);
+        if (Register == INDEX_NONE)
+        {
+            return INDEX_NONE;
+        }
+
+        FBlueprintInstruction Instruction{};
+        Instruction.Op = EBlueprintOpCode::CallNode;
+        Instruction.ResultType = Type;
+        Instruction.Dst = static_cast<uint16>(Register);
+        Instruction.A = static_cast<uint16>(Program.ExternalPins.Num());
+        Program.ExternalPins.Add(OutputPin);
+        Program.Instructions.Add(Instruction);
+        Program.bHasUntrackedInputs = true;
+    }
+    else if (RegisterTypes[Register] != Type)
+    {
+        Fail("CompilePin 결과 타입이 핀 타입과 다릅니다", OutputPin);
+        return INDEX_NONE;
+    }
+
+    PinRegisters.Add(OutputPin, Register);
+    return Register;
+}
+
+int32 FBlueprintExpressionCompiler::EmitConstant(FBlueprintRegister Value, EBlueprintRegisterType Type)
+{
+    if (bFailed)
+    {
+        return INDEX_NONE;
+    }
+
+    // bool은 하위 바이트만 유효하므로 비교 키를 정규화한다
+    const uint32 Bits = Type == EBlueprintRegisterType::Bool ? static_cast<uint32>(Value.Bool) : static_cast<uint32>(Value.Int);
+    const uint64 Key = (static_cast<uint64>(Type) << 32) | Bits;
+    if (const int32* Found = ConstantLookup.Find(Key))
+    {
+        return *Found;
+    }
+
+    const int32 Register = AllocateRegister(Type);
+    if (Register == INDEX_NONE)
+    {
+        return INDEX_NONE;
+    }
+    Program.Registers[Register] = Value;
+    bConstantRegisters[Register] = true;
+    ConstantLookup.Add(Key, Register);
+    return Register;
+}
+
+int32 FBlueprintExpressionCompiler::EmitOp(EBlueprintOpCode Op, EBlueprintRegisterType ResultType, int32 A, int32 B, int32 C)
+{
+    const bool bUnary = Op == EBlueprintOpCode::Not;
+    const bool bTernary = Op == EBlueprintOpCode::Select;
+    if (bFailed || A == INDEX_NONE || (!bUnary && B == INDEX_NONE) || (bTernary && C == INDEX_NONE))
+    {
+        return INDEX_NONE;
+    }
+
+    const TArray<FBlueprintRegister>& Registers = Program.Registers;
+
+    // 조건이 상수인 Select, 한쪽이 상수인 AND/OR는 명령 없이 한쪽 레지스터로 대체
+    if (bTernary)
+    {
+        if (IsConstant(A))
+        {
+            return Registers[A].Bool ? B : C;
+        }
+        if (B == C)
+        {
+            return B;
+        }
+    }
+    else if (Op == EBlueprintOpCode::And || Op == EBlueprintOpCode::Or)
+    {
+        const bool bIdentity = Op == EBlueprintOpCode::And;     // AND: true는 항등원, OR: false는 항등원
+        if (IsConstant(A) && !IsConstant(B))
+        {
+            return Registers[A].Bool == bIdentity ? B : A;
+        }
+        if (IsConstant(B) && !IsConstant(A))
+        {
+            return Registers[B].Bool == bIdentity ? A : B;
+        }
+    }
+
+    // 입력이 모두 상수면 인터프리터로 미리 계산
+    if (IsConstant(A) && (bUnary || IsConstant(B)) && (!bTernary || IsConstant(C)))
+    {
+        FBlueprintRegister Scratch[4];
+        Scratch[0] = Registers[A];
+        Scratch[1] = bUnary ? FBlueprintRegister{} : Registers[B];
+        Scratch[2] = bTernary ? Registers[C] : FBlueprintRegister{};
+
+        FBlueprintInstruction Folded{ Op, ResultType, 3, 0, 1, 2 };
+        FBlueprintProgram::ExecuteInstruction(Folded, Scratch, Program, nullptr);
+        return EmitConstant(Scratch[3], ResultType);
+    }
+
+    const int32 Dst = AllocateRegister(ResultType);
+    if (Dst == INDEX_NONE)
+    {
+        return INDEX_NONE;
+    }
+
+    FBlueprintInstruction Instruction{};
+    Instruction.Op = Op;
+    Instruction.ResultType = ResultType;
+    Instruction.Dst = static_cast<uint16>(Dst);
+    Instruction.A = static_cast<uint16>(A);
+    Instruction.B = static_cast<uint16>(bUnary ? 0 : B);
+    Instruction.C = static_cast<uint16>(bTernary ? C : 0);
+    Program.Instructions.Add(Instruction);
+    return Dst;
+}
+
+int32 FBlueprintExpressionCompiler::EmitNativeCall(FBlueprintNativeFunction Function, int32 Param, EBlueprintRegisterType ResultType, const char* InputName)
+{
+    if (bFailed || !Function)
+    {
+        return INDEX_NONE;
+    }
+    if (Param < INT16_MIN || Param > INT16_MAX)
+    {
+        Fail("네이티브 호출 인자가 16비트 범위를 벗어났습니다", nullptr);
+        return INDEX_NONE;
+    }
+
+    const int32 Dst = AllocateRegister(ResultType);
+    if (Dst == INDEX_NONE)
+    {
+        return INDEX_NONE;
+    }
+
+    int32 FunctionIndex = Program.NativeFunctions.Find(Function);
+    if (FunctionIndex == INDEX_NONE)
+    {
+        FunctionIndex = Program.NativeFunctions.Add(Function);
+    }
+
+    FBlueprintInstruction Instruction{};
+    Instruction.Op = EBlueprintOpCode::CallNative;
+    Instruction.ResultType = ResultType;
+    Instruction.Dst = static_cast<uint16>(Dst);
+    Instruction.A = static_cast<uint16>(FunctionIndex);
+    Instruction.B = static_cast<uint16>(static_cast<int16>(Param));
+    Program.Instructions.Add(Instruction);
+
+    if (InputName)
+    {
+        const FName Input(InputName);
+        if (!Program.InputNames.Contains(Input))
+        {
+            Program.InputNames.Add(Input);
+        }
+    }
+    else
+    {
+        Program.bHasUntrackedInputs = true;
+    }
+    return Dst;
+}
+
+int32 FBlueprintExpressionCompiler::AllocateRegister(EBlueprintRegisterType Type)
+{
+    if (Program.Registers.Num() >= MaxRegisters)
+    {
+        Fail("레지스터 수 초과", nullptr);
+        return INDEX_NONE;
+    }
+    RegisterTypes.Add(Type);
+    bConstantRegisters.Add(false);
+    return Program.Registers.Add(FBlueprintRegister{});
+}
+
+void FBlueprintExpressionCompiler::Fail(const char* Reason, const UEdGraphPin* Pin)
+{
+    if (!bFailed)
+    {
+        UE_LOG("[warning] FBlueprintExpressionCompiler: %s (핀: %s)", Reason, Pin ? Pin->PinName.c_str() : "-");
+    }
+    bFailed = true;
+}
+
+bool FBlueprintExpressionCompiler::ParseDefaultValue(const FString& InString, EBlueprintRegisterType Type, FBlueprintRegister& OutValue)
+{
+    OutValue = FBlueprintRegister{};
+    if (Type == EBlueprintRegisterType::Bool)
+    {
+        OutValue.Bool = InString == "true";
+        return true;
+    }
+    if (InString.empty())
+    {
+        return true;
+    }
+
+    const char* Begin = InString.c_str();
+    char* End = nullptr;
+    if (Type == EBlueprintRegisterType::Int)
+    {
+        OutValue.Int = static_cast<int32>(std::strtol(Begin, &End, 10));
+    }
+    else
+    {
+        OutValue.Float = std::strtof(Begin, &End);
+    }
+    return End != Begin;
+}
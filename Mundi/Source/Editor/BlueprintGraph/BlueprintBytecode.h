@@ -0,0 +1,206 @@
+﻿#pragma once
+
+#include "BlueprintTypes.h"
+
+class UEdGraphPin;
+
+/**
+ * @brief 바이트코드 레지스터 타입 (스칼라 표현식만 컴파일 대상)
+ */
+enum class EBlueprintRegisterType : uint8
+{
+    Int,
+    Float,
+    Bool
+};
+
+/**
+ * @brief 타입 없는 32비트 레지스터, 타입은 컴파일 시점에 확정된다.
+ */
+union FBlueprintRegister
+{
+    int32 Int;
+    float Float;
+    bool Bool;
+
+    FBlueprintRegister() : Int(0) {}
+
+    static FBlueprintRegister MakeInt(int32 InValue) { FBlueprintRegister R; R.Int = InValue; return R; }
+    static FBlueprintRegister MakeFloat(float InValue) { FBlueprintRegister R; R.Float = InValue; return R; }
+    static FBlueprintRegister MakeBool(bool InValue) { FBlueprintRegister R; R.Bool = InValue; return R; }
+};
+
+enum class EBlueprintOpCode : uint8
+{
+    AddFloat,
+    SubtractFloat,
+    MultiplyFloat,
+    DivideFloat,
+    GreaterFloat,
+    EqualFloat,
+
+    AddInt,
+    SubtractInt,
+    MultiplyInt,
+    DivideInt,
+    GreaterInt,
+    EqualInt,
+
+    And,
+    Or,
+    Xor,
+    Not,
+
+    Select,         // Dst = A ? B : C
+    CallNative,     // Dst = NativeFunctions[A](Frame, B)
+    CallNode,       // Dst = ExternalPins[A]->OwningNode->EvaluatePin() (컴파일을 지원하지 않는 노드 폴백)
+};
+
+struct FBlueprintInstruction
+{
+    EBlueprintOpCode Op;
+    EBlueprintRegisterType ResultType;
+    uint16 Dst;
+    uint16 A;
+    uint16 B;
+    uint16 C;
+};
+
+class FBlueprintVMFrame;
+
+/** @brief 컨텍스트에서 객체를 찾는 함수 (실행 한 번 동안 결과를 재사용) */
+using FBlueprintContextResolver = void* (*)(FBlueprintContext* Context);
+
+/** @brief 노드가 CallNative로 내보내는 네이티브 함수, Param은 컴파일 시점 상수 (축, 키 코드 등) */
+using FBlueprintNativeFunction = FBlueprintRegister (*)(FBlueprintVMFrame& Frame, int32 Param);
+
+/**
+ * @brief 프로그램 한 번 실행 동안의 상태
+ */
+class FBlueprintVMFrame
+{
+public:
+    explicit FBlueprintVMFrame(FBlueprintContext* InContext) : Context(InContext) {}
+
+    FBlueprintContext* GetContext() const { return Context; }
+
+    /**
+     * @brief Resolver 결과를 이번 실행 동안 캐시해서 반환한다.
+     * @note 같은 컴포넌트를 읽는 노드가 여러 개여도 계층 탐색은 한 번만 한다.
+     */
+    void* Resolve(FBlueprintContextResolver Resolver);
+
+private:
+    static constexpr int32 MaxResolvedEntries = 4;
+
+    FBlueprintContext* Context;
+    FBlueprintContextResolver ResolvedKeys[MaxResolvedEntries] = {};
+    void* ResolvedValues[MaxResolvedEntries] = {};
+    int32 NumResolved = 0;
+};
+
+/**
+ * @brief 블루프린트 표현식 하나를 컴파일한 결과
+ *
+ * - 명령어는 위상 정렬된 순서로 한 번씩만 실행된다 (공유 하위 표현식은 한 번만 계산)
+ * - 상수(연결되지 않은 입력 핀 기본값, 리터럴, 상수 폴딩 결과)는 컴파일 시점에 레지스터에 채워진다
+ * - 실행 중에는 variant 박싱, 문자열 파싱, 가상 함수 호출이 없다 (CallNode 폴백 제외)
+ */
+class FBlueprintProgram
+{
+public:
+    bool IsValid() const { return bValid; }
+    EBlueprintRegisterType GetResultType() const { return ResultType; }
+
+    /**
+     * @brief 프로그램을 실행하고 결과 레지스터를 반환한다.
+     * @note 레지스터 파일을 프로그램이 소유하므로 같은 프로그램을 여러 스레드에서 동시에 실행하면 안 된다.
+     */
+    FBlueprintRegister Execute(FBlueprintContext* Context);
+
+    bool ExecuteBool(FBlueprintContext* Context) { return Execute(Context).Bool; }
+    float ExecuteFloat(FBlueprintContext* Context) { return Execute(Context).Float; }
+    int32 ExecuteInt(FBlueprintContext* Context) { return Execute(Context).Int; }
+
+    int32 GetNumInstructions() const { return Instructions.Num(); }
+    int32 GetNumRegisters() const { return Registers.Num(); }
+    int32 GetNumFallbackCalls() const { return ExternalPins.Num(); }
+
+    /**
+     * @brief 프로그램이 읽는 외부 입력 이름 (네이티브 호출이 선언한 것만)
+     * @note HasUntrackedInputs가 true면 선언되지 않은 입력(키 입력, 폴백 노드 등)도 읽으므로 매번 실행해야 한다.
+     */
+    const TArray<FName>& GetInputNames() const { return InputNames; }
+    bool HasUntrackedInputs() const { return bHasUntrackedInputs; }
+
+    /** @brief 명령어 하나를 실행한다 (상수 폴딩에서도 같은 구현을 사용). */
+    static void ExecuteInstruction(const FBlueprintInstruction& Instruction, FBlueprintRegister* Registers,
+        const FBlueprintProgram& Program, FBlueprintVMFrame* Frame);
+
+private:
+    friend class FBlueprintExpressionCompiler;
+
+    TArray<FBlueprintInstruction> Instructions;
+    TArray<FBlueprintRegister> Registers;
+    TArray<FBlueprintNativeFunction> NativeFunctions;
+    TArray<const UEdGraphPin*> ExternalPins;
+    TArray<FName> InputNames;
+    bool bHasUntrackedInputs = false;
+    uint16 ResultRegister = 0;
+    EBlueprintRegisterType ResultType = EBlueprintRegisterType::Bool;
+    bool bValid = false;
+};
+
+/**
+ * @brief 노드 그래프의 표현식을 레지스터 기반 바이트코드로 컴파일한다.
+ *
+ * 입력 핀에서 출발해 연결된 노드를 후위 순회하며 UEdGraphNode::CompilePin을 호출한다.
+ * CompilePin을 구현하지 않은 노드는 EvaluatePin을 호출하는 CallNode 명령으로 대체된다.
+ */
+class FBlueprintExpressionCompiler
+{
+public:
+    /**
+     * @brief 입력 핀으로 들어오는 표현식을 컴파일한다.
+     * @return 실패(순환, 타입 불일치, 스칼라가 아닌 핀) 시 false, OutProgram은 유효하지 않다.
+     */
+    static bool Compile(const UEdGraphPin* InputPin, EBlueprintRegisterType ResultType, FBlueprintProgram& OutProgram);
+
+    // --- UEdGraphNode::CompilePin에서 사용하는 인터페이스 ---
+public:
+    /** @brief 입력 핀(연결된 출력 또는 기본값 상수)의 레지스터를 반환한다. */
+    int32 CompileInput(const UEdGraphPin* InputPin, EBlueprintRegisterType Type);
+
+    /** @brief 상수 레지스터 (같은 값은 하나로 합친다) */
+    int32 EmitConstant(FBlueprintRegister Value, EBlueprintRegisterType Type);
+
+    /** @brief 연산 명령을 추가한다. 입력이 모두 상수면 컴파일 시점에 계산해 상수를 반환한다. */
+    int32 EmitOp(EBlueprintOpCode Op, EBlueprintRegisterType ResultType, int32 A, int32 B = INDEX_NONE, int32 C = INDEX_NONE);
+
+    /**
+     * @brief 네이티브 함수 호출 명령을 추가한다 (폴딩하지 않음).
+     * @param InputName 함수가 읽는 값의 입력 변수 이름 (상태머신 전이 재평가 트리거), 없으면 매번 평가 대상
+     */
+    int32 EmitNativeCall(FBlueprintNativeFunction Function, int32 Param, EBlueprintRegisterType ResultType, const char* InputName = nullptr);
+
+    bool IsConstant(int32 Register) const { return Register >= 0 && Register < bConstantRegisters.Num() && bConstantRegisters[Register]; }
+    FBlueprintRegister GetConstant(int32 Register) const { return Program.Registers[Register]; }
+
+private:
+    explicit FBlueprintExpressionCompiler(FBlueprintProgram& InProgram) : Program(InProgram) {}
+
+    int32 CompileOutputPin(const UEdGraphPin* OutputPin, EBlueprintRegisterType Type);
+    int32 AllocateRegister(EBlueprintRegisterType Type);
+    void Fail(const char* Reason, const UEdGraphPin* Pin);
+
+    static bool ParseDefaultValue(const FString& InString, EBlueprintRegisterType Type, FBlueprintRegister& OutValue);
+
+private:
+    FBlueprintProgram& Program;
+    TArray<EBlueprintRegisterType> RegisterTypes;
+    TArray<bool> bConstantRegisters;
+    TMap<uint64, int32> ConstantLookup;                 // (타입, 값 비트) -> 레지스터
+    TMap<const UEdGraphPin*, int32> PinRegisters;       // 이미 컴파일한 출력 핀 (공유 하위 표현식)
+    TSet<const UEdGraphPin*> PinsInProgress;            // 순환 검출
+    bool bFailed = false;
+};
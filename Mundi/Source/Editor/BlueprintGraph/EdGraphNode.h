@@ -3,6 +3,8 @@
 #include "BlueprintTypes.h"
 #include "EdGraphPin.h"
 
+class FBlueprintExpressionCompiler;
+
 UCLASS(DisplayName="UEdGraphNode", Description="블루프린트 노드 베이스")
 class UEdGraphNode : public UObject
 {
@@ -56,6 +58,12 @@ public:
     /** @brief 특정 핀에 대한 값을 평가해서 반환한다(블루프린트 표현식 용). */
     virtual FBlueprintValue EvaluatePin(const UEdGraphPin* OutputPin, FBlueprintContext* Context) { return FBlueprintValue{}; }
 
+    /**
+     * @brief 특정 핀의 표현식을 바이트코드로 컴파일하고 결과 레지스터를 반환한다.
+     * @note INDEX_NONE을 반환하면 컴파일러가 EvaluatePin 호출로 대체한다 (EvaluatePin과 결과가 같아야 한다).
+     */
+    virtual int32 CompilePin(const UEdGraphPin* OutputPin, FBlueprintExpressionCompiler& Compiler) { return INDEX_NONE; }
+
     /** @brief UUID를 PinID로 활용해서 핀을 생성한다. */
     UEdGraphPin* CreatePin(EEdGraphPinDirection Dir, FName PinCategory, const FString& PinName, const FString& DefaultValue = "")
     {
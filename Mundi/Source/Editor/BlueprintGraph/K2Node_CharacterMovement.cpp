@@ -2,9 +2,11 @@
 #include "K2Node_CharacterMovement.h"
 
 #include "BlueprintActionDatabase.h"
+#include "BlueprintBytecode.h"
 #include "CharacterMovementComponent.h"
 #include "SkeletalMeshComponent.h"
 #include "Source/Runtime/Engine/Animation/AnimInstance.h"
+#include "Source/Runtime/Engine/Animation/AnimationStateMachine.h"
 
 // ----------------------------------------------------------------
 //	Internal Helper: 컨텍스트에서 MovementComponent 탐색
@@ -41,6 +43,68 @@ static UCharacterMovementComponent* GetMovementFromContext(FBlueprintContext* Co
     return MoveComp;
 }
 
+// ----------------------------------------------------------------
+//	바이트코드용 네이티브 함수
+//	컴포넌트 탐색 결과는 FBlueprintVMFrame이 프로그램 실행 한 번 동안 캐시한다
+// ----------------------------------------------------------------
+
+static void* ResolveMovement(FBlueprintContext* Context)
+{
+    return GetMovementFromContext(Context);
+}
+
+static void* ResolveOwnerActor(FBlueprintContext* Context)
+{
+    UAnimInstance* AnimInstance = Context ? Cast<UAnimInstance>(Context->SourceObject) : nullptr;
+    USkeletalMeshComponent* MeshComp = AnimInstance ? AnimInstance->GetOwningComponent() : nullptr;
+    return MeshComp ? MeshComp->GetOwner() : nullptr;
+}
+
+static float GetAxis(const FVector& InVector, int32 Axis)
+{
+    return Axis == 0 ? InVector.X : (Axis == 1 ? InVector.Y : InVector.Z);
+}
+
+static FBlueprintRegister NativeIsFalling(FBlueprintVMFrame& Frame, int32 Param)
+{
+    auto* MoveComp = static_cast<UCharacterMovementComponent*>(Frame.Resolve(&ResolveMovement));
+    return FBlueprintRegister::MakeBool(MoveComp ? MoveComp->IsFalling() : false);
+}
+
+static FBlueprintRegister NativeGetVelocity(FBlueprintVMFrame& Frame, int32 Axis)
+{
+    auto* MoveComp = static_cast<UCharacterMovementComponent*>(Frame.Resolve(&ResolveMovement));
+    return FBlueprintRegister::MakeFloat(MoveComp ? GetAxis(MoveComp->GetVelocity(), Axis) : 0.0f);
+}
+
+static FBlueprintRegister NativeGetLocalVelocity(FBlueprintVMFrame& Frame, int32 Axis)
+{
+    auto* MoveComp = static_cast<UCharacterMovementComponent*>(Frame.Resolve(&ResolveMovement));
+    auto* OwnerActor = static_cast<AActor*>(Frame.Resolve(&ResolveOwnerActor));
+    if (!MoveComp || !OwnerActor)
+    {
+        return FBlueprintRegister::MakeFloat(0.0f);
+    }
+
+    // X: 좌우 (Right), Y: 앞뒤 (Forward), Z: 위아래 (Up)
+    const FVector Basis = Axis == 0 ? OwnerActor->GetActorRight() : (Axis == 1 ? OwnerActor->GetActorForward() : OwnerActor->GetActorUp());
+    return FBlueprintRegister::MakeFloat(FVector::Dot(MoveComp->GetVelocity(), Basis));
+}
+
+static FBlueprintRegister NativeGetSpeed(FBlueprintVMFrame& Frame, int32 Param)
+{
+    auto* MoveComp = static_cast<UCharacterMovementComponent*>(Frame.Resolve(&ResolveMovement));
+    return FBlueprintRegister::MakeFloat(MoveComp ? MoveComp->GetVelocity().Size() : 0.0f);
+}
+
+static int32 GetAxisFromPinName(const FString& PinName)
+{
+    if (PinName == "X") { return 0; }
+    if (PinName == "Y") { return 1; }
+    if (PinName == "Z") { return 2; }
+    return INDEX_NONE;
+}
+
 // ----------------------------------------------------------------
 //	[GetIsFalling] 
 // ----------------------------------------------------------------
@@ -73,6 +137,16 @@ FBlueprintValue UK2Node_GetIsFalling::EvaluatePin(const UEdGraphPin* OutputPin,
     return FBlueprintValue{};
 }
 
+int32 UK2Node_GetIsFalling::CompilePin(const UEdGraphPin* OutputPin, FBlueprintExpressionCompiler& Compiler)
+{
+    if (OutputPin->PinName == "Is Falling")
+    {
+        // IsGrounded의 반대이므로 같은 입력 변수로 재평가
+        return Compiler.EmitNativeCall(&NativeIsFalling, 0, EBlueprintRegisterType::Bool, FAnimStateMachineInputs::IsGrounded);
+    }
+    return INDEX_NONE;
+}
+
 void UK2Node_GetIsFalling::GetMenuActions(FBlueprintActionDatabaseRegistrar& ActionRegistrar) const
 {
     UBlueprintNodeSpawner* Spawner = UBlueprintNodeSpawner::Create(GetClass());
@@ -126,6 +200,16 @@ FBlueprintValue UK2Node_GetVelocity::EvaluatePin(const UEdGraphPin* OutputPin, F
     return FBlueprintValue(0.0f);
 }
 
+int32 UK2Node_GetVelocity::CompilePin(const UEdGraphPin* OutputPin, FBlueprintExpressionCompiler& Compiler)
+{
+    const int32 Axis = GetAxisFromPinName(OutputPin->PinName);
+    if (Axis == INDEX_NONE)
+    {
+        return Compiler.EmitConstant(FBlueprintRegister::MakeFloat(0.0f), EBlueprintRegisterType::Float);
+    }
+    return Compiler.EmitNativeCall(&NativeGetVelocity, Axis, EBlueprintRegisterType::Float);
+}
+
 void UK2Node_GetVelocity::GetMenuActions(FBlueprintActionDatabaseRegistrar& ActionRegistrar) const
 {
     UBlueprintNodeSpawner* Spawner = UBlueprintNodeSpawner::Create(GetClass());
@@ -209,6 +293,16 @@ FBlueprintValue UK2Node_GetLocalVelocity::EvaluatePin(const UEdGraphPin* OutputP
     return FBlueprintValue(0.0f);
 }
 
+int32 UK2Node_GetLocalVelocity::CompilePin(const UEdGraphPin* OutputPin, FBlueprintExpressionCompiler& Compiler)
+{
+    const int32 Axis = GetAxisFromPinName(OutputPin->PinName);
+    if (Axis == INDEX_NONE)
+    {
+        return Compiler.EmitConstant(FBlueprintRegister::MakeFloat(0.0f), EBlueprintRegisterType::Float);
+    }
+    return Compiler.EmitNativeCall(&NativeGetLocalVelocity, Axis, EBlueprintRegisterType::Float);
+}
+
 void UK2Node_GetLocalVelocity::GetMenuActions(FBlueprintActionDatabaseRegistrar& ActionRegistrar) const
 {
     UBlueprintNodeSpawner* Spawner = UBlueprintNodeSpawner::Create(GetClass());
@@ -254,6 +348,15 @@ FBlueprintValue UK2Node_GetSpeed::EvaluatePin(const UEdGraphPin* OutputPin, FBlu
     return FBlueprintValue(0.0f);
 }
 
+int32 UK2Node_GetSpeed::CompilePin(const UEdGraphPin* OutputPin, FBlueprintExpressionCompiler& Compiler)
+{
+    if (OutputPin->PinName == "Speed")
+    {
+        return Compiler.EmitNativeCall(&NativeGetSpeed, 0, EBlueprintRegisterType::Float, FAnimStateMachineInputs::Speed);
+    }
+    return Compiler.EmitConstant(FBlueprintRegister::MakeFloat(0.0f), EBlueprintRegisterType::Float);
+}
+
 void UK2Node_GetSpeed::GetMenuActions(FBlueprintActionDatabaseRegistrar& ActionRegistrar) const
 {
     UBlueprintNodeSpawner* Spawner = UBlueprintNodeSpawner::Create(GetClass());
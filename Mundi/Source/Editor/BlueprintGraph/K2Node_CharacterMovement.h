@@ -34,6 +34,7 @@ public:
     virtual bool IsNodePure() const override { return true; }
     virtual void AllocateDefaultPins() override;
     virtual FBlueprintValue EvaluatePin(const UEdGraphPin* OutputPin, FBlueprintContext* Context) override;
+    virtual int32 CompilePin(const UEdGraphPin* OutputPin, FBlueprintExpressionCompiler& Compiler) override;
 
     // --- UK2Node 인터페이스 ---
 public:
@@ -58,6 +59,7 @@ public:
     virtual bool IsNodePure() const override { return true; }
     virtual void AllocateDefaultPins() override;
     virtual FBlueprintValue EvaluatePin(const UEdGraphPin* OutputPin, FBlueprintContext* Context) override;
+    virtual int32 CompilePin(const UEdGraphPin* OutputPin, FBlueprintExpressionCompiler& Compiler) override;
 
     // --- UK2Node 인터페이스 ---
 public:
@@ -82,6 +84,7 @@ public:
     virtual bool IsNodePure() const override { return true; }
     virtual void AllocateDefaultPins() override;
     virtual FBlueprintValue EvaluatePin(const UEdGraphPin* OutputPin, FBlueprintContext* Context) override;
+    virtual int32 CompilePin(const UEdGraphPin* OutputPin, FBlueprintExpressionCompiler& Compiler) override;
 
     // --- UK2Node 인터페이스 ---
 public:
@@ -106,6 +109,7 @@ public:
     virtual bool IsNodePure() const override { return true; }
     virtual void AllocateDefaultPins() override;
     virtual FBlueprintValue EvaluatePin(const UEdGraphPin* OutputPin, FBlueprintContext* Context) override;
+    virtual int32 CompilePin(const UEdGraphPin* OutputPin, FBlueprintExpressionCompiler& Compiler) override;
 
     // --- UK2Node 인터페이스 ---
 public:
@@ -2,6 +2,7 @@
 #include "K2Node_Expression.h"
 #include "BlueprintActionDatabase.h"
 #include "BlueprintEvaluator.h"
+#include "BlueprintBytecode.h"
 
 // ----------------------------------------------------------------
 //  Select 평가 헬퍼 함수 (템플릿)
@@ -24,6 +25,21 @@ FBlueprintValue EvaluateSelectOp(const UEdGraphNode* Node, FBlueprintContext* Co
     return FBlueprintValue(ResultValue);
 }
 
+// @note 바이트코드에서는 분기 없이 두 값을 모두 계산한 뒤 선택한다 (순수 노드라 결과는 같다).
+//       Condition이 상수면 선택되는 쪽만 컴파일한다.
+static int32 CompileSelectOp(const UEdGraphNode* Node, EBlueprintRegisterType Type, FBlueprintExpressionCompiler& Compiler)
+{
+    const int32 Condition = Compiler.CompileInput(Node->FindPin("Condition"), EBlueprintRegisterType::Bool);
+    if (Compiler.IsConstant(Condition))
+    {
+        return Compiler.CompileInput(Node->FindPin(Compiler.GetConstant(Condition).Bool ? "TrueValue" : "FalseValue"), Type);
+    }
+
+    const int32 TrueValue = Compiler.CompileInput(Node->FindPin("TrueValue"), Type);
+    const int32 FalseValue = Compiler.CompileInput(Node->FindPin("FalseValue"), Type);
+    return Compiler.EmitOp(EBlueprintOpCode::Select, Type, Condition, TrueValue, FalseValue);
+}
+
 // ----------------------------------------------------------------
 //	[Int] Select 노드 구현
 // ----------------------------------------------------------------
@@ -62,6 +78,15 @@ FBlueprintValue UK2Node_Select_Int::EvaluatePin(const UEdGraphPin* OutputPin, FB
     return FBlueprintValue{};
 }
 
+int32 UK2Node_Select_Int::CompilePin(const UEdGraphPin* OutputPin, FBlueprintExpressionCompiler& Compiler)
+{
+    if (OutputPin->PinName == "Result")
+    {
+        return CompileSelectOp(this, EBlueprintRegisterType::Int, Compiler);
+    }
+    return INDEX_NONE;
+}
+
 void UK2Node_Select_Int::GetMenuActions(FBlueprintActionDatabaseRegistrar& ActionRegistrar) const
 {
     UBlueprintNodeSpawner* Spawner = UBlueprintNodeSpawner::Create(GetClass());
@@ -102,6 +127,15 @@ FBlueprintValue UK2Node_Select_Float::EvaluatePin(const UEdGraphPin* OutputPin,
     return FBlueprintValue{};
 }
 
+int32 UK2Node_Select_Float::CompilePin(const UEdGraphPin* OutputPin, FBlueprintExpressionCompiler& Compiler)
+{
+    if (OutputPin->PinName == "Result")
+    {
+        return CompileSelectOp(this, EBlueprintRegisterType::Float, Compiler);
+    }
+    return INDEX_NONE;
+}
+
 void UK2Node_Select_Float::GetMenuActions(FBlueprintActionDatabaseRegistrar& ActionRegistrar) const
 {
     UBlueprintNodeSpawner* Spawner = UBlueprintNodeSpawner::Create(GetClass());
@@ -142,6 +176,15 @@ FBlueprintValue UK2Node_Select_Bool::EvaluatePin(const UEdGraphPin* OutputPin, F
     return FBlueprintValue{};
 }
 
+int32 UK2Node_Select_Bool::CompilePin(const UEdGraphPin* OutputPin, FBlueprintExpressionCompiler& Compiler)
+{
+    if (OutputPin->PinName == "Result")
+    {
+        return CompileSelectOp(this, EBlueprintRegisterType::Bool, Compiler);
+    }
+    return INDEX_NONE;
+}
+
 void UK2Node_Select_Bool::GetMenuActions(FBlueprintActionDatabaseRegistrar& ActionRegistrar) const
 {
     UBlueprintNodeSpawner* Spawner = UBlueprintNodeSpawner::Create(GetClass());
@@ -39,6 +39,7 @@ public:
     virtual void AllocateDefaultPins() override;
     virtual void RenderBody() override;
     virtual FBlueprintValue EvaluatePin(const UEdGraphPin* OutputPin, FBlueprintContext* Context) override;
+    virtual int32 CompilePin(const UEdGraphPin* OutputPin, FBlueprintExpressionCompiler& Compiler) override;
 
     // --- UK2Node 인터페이스 ---
 public:
@@ -61,6 +62,7 @@ public:
     virtual void AllocateDefaultPins() override;
     virtual void RenderBody() override;
     virtual FBlueprintValue EvaluatePin(const UEdGraphPin* OutputPin, FBlueprintContext* Context) override;
+    virtual int32 CompilePin(const UEdGraphPin* OutputPin, FBlueprintExpressionCompiler& Compiler) override;
 
     // --- UK2Node 인터페이스 ---
 public:
@@ -83,6 +85,7 @@ public:
     virtual void AllocateDefaultPins() override;
     virtual void RenderBody() override;
     virtual FBlueprintValue EvaluatePin(const UEdGraphPin* OutputPin, FBlueprintContext* Context) override;
+    virtual int32 CompilePin(const UEdGraphPin* OutputPin, FBlueprintExpressionCompiler& Compiler) override;
 
     // --- UK2Node 인터페이스 ---
 public:
@@ -2,6 +2,7 @@
 #include "imgui-node-editor/imgui_node_editor.h"
 #include "K2Node_Literal.h"
 #include "BlueprintActionDatabase.h"
+#include "BlueprintBytecode.h"
 
 namespace ed = ax::NodeEditor;
 
@@ -46,6 +47,15 @@ FBlueprintValue UK2Node_Literal_Int::EvaluatePin(const UEdGraphPin* OutputPin, F
     return FBlueprintValue{};
 }
 
+int32 UK2Node_Literal_Int::CompilePin(const UEdGraphPin* OutputPin, FBlueprintExpressionCompiler& Compiler)
+{
+    if (OutputPin->PinName == "Value")
+    {
+        return Compiler.EmitConstant(FBlueprintRegister::MakeInt(Value), EBlueprintRegisterType::Int);
+    }
+    return INDEX_NONE;
+}
+
 void UK2Node_Literal_Int::GetMenuActions(FBlueprintActionDatabaseRegistrar& ActionRegistrar) const
 {
     UBlueprintNodeSpawner* Spawner = UBlueprintNodeSpawner::Create(GetClass());
@@ -97,6 +107,15 @@ FBlueprintValue UK2Node_Literal_Float::EvaluatePin(const UEdGraphPin* OutputPin,
     return FBlueprintValue{};
 }
 
+int32 UK2Node_Literal_Float::CompilePin(const UEdGraphPin* OutputPin, FBlueprintExpressionCompiler& Compiler)
+{
+    if (OutputPin->PinName == "Value")
+    {
+        return Compiler.EmitConstant(FBlueprintRegister::MakeFloat(Value), EBlueprintRegisterType::Float);
+    }
+    return INDEX_NONE;
+}
+
 void UK2Node_Literal_Float::GetMenuActions(FBlueprintActionDatabaseRegistrar& ActionRegistrar) const
 {
     UBlueprintNodeSpawner* Spawner = UBlueprintNodeSpawner::Create(GetClass());
@@ -148,6 +167,15 @@ FBlueprintValue UK2Node_Literal_Bool::EvaluatePin(const UEdGraphPin* OutputPin,
     return FBlueprintValue{};
 }
 
+int32 UK2Node_Literal_Bool::CompilePin(const UEdGraphPin* OutputPin, FBlueprintExpressionCompiler& Compiler)
+{
+    if (OutputPin->PinName == "Value")
+    {
+        return Compiler.EmitConstant(FBlueprintRegister::MakeBool(Value), EBlueprintRegisterType::Bool);
+    }
+    return INDEX_NONE;
+}
+
 void UK2Node_Literal_Bool::GetMenuActions(FBlueprintActionDatabaseRegistrar& ActionRegistrar) const
 {
     UBlueprintNodeSpawner* Spawner = UBlueprintNodeSpawner::Create(GetClass());
@@ -44,6 +44,7 @@ public:
     virtual void AllocateDefaultPins() override;
     virtual void RenderBody() override;
     virtual FBlueprintValue EvaluatePin(const UEdGraphPin* OutputPin, FBlueprintContext* Context) override;
+    virtual int32 CompilePin(const UEdGraphPin* OutputPin, FBlueprintExpressionCompiler& Compiler) override;
     
     // --- UK2Node 인터페이스 ---
 public:
@@ -73,6 +74,7 @@ public:
     virtual void AllocateDefaultPins() override;
     virtual void RenderBody() override;
     virtual FBlueprintValue EvaluatePin(const UEdGraphPin* OutputPin, FBlueprintContext* Context) override;
+    virtual int32 CompilePin(const UEdGraphPin* OutputPin, FBlueprintExpressionCompiler& Compiler) override;
     
     // --- UK2Node 인터페이스 ---
 public:
@@ -102,6 +104,7 @@ public:
     virtual void AllocateDefaultPins() override;
     virtual void RenderBody() override;
     virtual FBlueprintValue EvaluatePin(const UEdGraphPin* OutputPin, FBlueprintContext* Context) override;
+    virtual int32 CompilePin(const UEdGraphPin* OutputPin, FBlueprintExpressionCompiler& Compiler) override;
     
     // --- UK2Node 인터페이스 ---
 public:
@@ -2,6 +2,7 @@
 #include "K2Node_Math.h"
 #include "BlueprintActionDatabase.h"
 #include "BlueprintEvaluator.h"
+#include "BlueprintBytecode.h"
 
 // ----------------------------------------------------------------
 //  표현식 평가(Expression Evaluation)용 헬퍼함수
@@ -23,6 +24,23 @@ FBlueprintValue EvaluateBinaryOp(const UEdGraphNode* Node, OpFunc Op, FBlueprint
     return FBlueprintValue(Op(A, B)); 
 }
 
+// ----------------------------------------------------------------
+//  바이트코드 컴파일(Expression Compilation)용 헬퍼함수
+// ----------------------------------------------------------------
+
+static int32 CompileUnaryOp(const UEdGraphNode* Node, EBlueprintOpCode Op, EBlueprintRegisterType OperandType, EBlueprintRegisterType ResultType, FBlueprintExpressionCompiler& Compiler)
+{
+    const int32 A = Compiler.CompileInput(Node->FindPin("A"), OperandType);
+    return Compiler.EmitOp(Op, ResultType, A);
+}
+
+static int32 CompileBinaryOp(const UEdGraphNode* Node, EBlueprintOpCode Op, EBlueprintRegisterType OperandType, EBlueprintRegisterType ResultType, FBlueprintExpressionCompiler& Compiler)
+{
+    const int32 A = Compiler.CompileInput(Node->FindPin("A"), OperandType);
+    const int32 B = Compiler.CompileInput(Node->FindPin("B"), OperandType);
+    return Compiler.EmitOp(Op, ResultType, A, B);
+}
+
 // ----------------------------------------------------------------
 //  [Float] 노드
 // ----------------------------------------------------------------
@@ -54,6 +72,15 @@ FBlueprintValue UK2Node_Add_FloatFloat::EvaluatePin(const UEdGraphPin* OutputPin
     return FBlueprintValue{};
 }
 
+int32 UK2Node_Add_FloatFloat::CompilePin(const UEdGraphPin* OutputPin, FBlueprintExpressionCompiler& Compiler)
+{
+    if (OutputPin->PinName == "Result")
+    {
+        return CompileBinaryOp(this, EBlueprintOpCode::AddFloat, EBlueprintRegisterType::Float, EBlueprintRegisterType::Float, Compiler);
+    }
+    return INDEX_NONE;
+}
+
 void UK2Node_Add_FloatFloat::GetMenuActions(FBlueprintActionDatabaseRegistrar& ActionRegistrar) const
 {
     UBlueprintNodeSpawner* Spawner = UBlueprintNodeSpawner::Create(GetClass());
@@ -89,6 +116,15 @@ FBlueprintValue UK2Node_Subtract_FloatFloat::EvaluatePin(const UEdGraphPin* Outp
     return FBlueprintValue{};
 }
 
+int32 UK2Node_Subtract_FloatFloat::CompilePin(const UEdGraphPin* OutputPin, FBlueprintExpressionCompiler& Compiler)
+{
+    if (OutputPin->PinName == "Result")
+    {
+        return CompileBinaryOp(this, EBlueprintOpCode::SubtractFloat, EBlueprintRegisterType::Float, EBlueprintRegisterType::Float, Compiler);
+    }
+    return INDEX_NONE;
+}
+
 void UK2Node_Subtract_FloatFloat::GetMenuActions(FBlueprintActionDatabaseRegistrar& ActionRegistrar) const
 {
     UBlueprintNodeSpawner* Spawner = UBlueprintNodeSpawner::Create(GetClass());
@@ -124,6 +160,15 @@ FBlueprintValue UK2Node_Multiply_FloatFloat::EvaluatePin(const UEdGraphPin* Outp
     return FBlueprintValue{};
 }
 
+int32 UK2Node_Multiply_FloatFloat::CompilePin(const UEdGraphPin* OutputPin, FBlueprintExpressionCompiler& Compiler)
+{
+    if (OutputPin->PinName == "Result")
+    {
+        return CompileBinaryOp(this, EBlueprintOpCode::MultiplyFloat, EBlueprintRegisterType::Float, EBlueprintRegisterType::Float, Compiler);
+    }
+    return INDEX_NONE;
+}
+
 void UK2Node_Multiply_FloatFloat::GetMenuActions(FBlueprintActionDatabaseRegistrar& ActionRegistrar) const
 {
     UBlueprintNodeSpawner* Spawner = UBlueprintNodeSpawner::Create(GetClass());
@@ -160,6 +205,15 @@ FBlueprintValue UK2Node_Divide_FloatFloat::EvaluatePin(const UEdGraphPin* Output
     return FBlueprintValue{};
 }
 
+int32 UK2Node_Divide_FloatFloat::CompilePin(const UEdGraphPin* OutputPin, FBlueprintExpressionCompiler& Compiler)
+{
+    if (OutputPin->PinName == "Result")
+    {
+        return CompileBinaryOp(this, EBlueprintOpCode::DivideFloat, EBlueprintRegisterType::Float, EBlueprintRegisterType::Float, Compiler);
+    }
+    return INDEX_NONE;
+}
+
 void UK2Node_Divide_FloatFloat::GetMenuActions(FBlueprintActionDatabaseRegistrar& ActionRegistrar) const
 {
     UBlueprintNodeSpawner* Spawner = UBlueprintNodeSpawner::Create(GetClass());
@@ -195,6 +249,15 @@ FBlueprintValue UK2Node_Greater_FloatFloat::EvaluatePin(const UEdGraphPin* Outpu
     return FBlueprintValue{};
 }
 
+int32 UK2Node_Greater_FloatFloat::CompilePin(const UEdGraphPin* OutputPin, FBlueprintExpressionCompiler& Compiler)
+{
+    if (OutputPin->PinName == "Result")
+    {
+        return CompileBinaryOp(this, EBlueprintOpCode::GreaterFloat, EBlueprintRegisterType::Float, EBlueprintRegisterType::Bool, Compiler);
+    }
+    return INDEX_NONE;
+}
+
 void UK2Node_Greater_FloatFloat::GetMenuActions(FBlueprintActionDatabaseRegistrar& ActionRegistrar) const
 {
     UBlueprintNodeSpawner* Spawner = UBlueprintNodeSpawner::Create(GetClass());
@@ -230,6 +293,15 @@ FBlueprintValue UK2Node_Equal_FloatFloat::EvaluatePin(const UEdGraphPin* OutputP
     return FBlueprintValue{}; 
 }
 
+int32 UK2Node_Equal_FloatFloat::CompilePin(const UEdGraphPin* OutputPin, FBlueprintExpressionCompiler& Compiler)
+{
+    if (OutputPin->PinName == "Result")
+    {
+        return CompileBinaryOp(this, EBlueprintOpCode::EqualFloat, EBlueprintRegisterType::Float, EBlueprintRegisterType::Bool, Compiler);
+    }
+    return INDEX_NONE;
+}
+
 void UK2Node_Equal_FloatFloat::GetMenuActions(FBlueprintActionDatabaseRegistrar& ActionRegistrar) const
 {
     UBlueprintNodeSpawner* Spawner = UBlueprintNodeSpawner::Create(GetClass());
@@ -269,6 +341,15 @@ FBlueprintValue UK2Node_Add_IntInt::EvaluatePin(const UEdGraphPin* OutputPin, FB
     return FBlueprintValue{}; 
 }
 
+int32 UK2Node_Add_IntInt::CompilePin(const UEdGraphPin* OutputPin, FBlueprintExpressionCompiler& Compiler)
+{
+    if (OutputPin->PinName == "Result")
+    {
+        return CompileBinaryOp(this, EBlueprintOpCode::AddInt, EBlueprintRegisterType::Int, EBlueprintRegisterType::Int, Compiler);
+    }
+    return INDEX_NONE;
+}
+
 void UK2Node_Add_IntInt::GetMenuActions(FBlueprintActionDatabaseRegistrar& ActionRegistrar) const
 {
     UBlueprintNodeSpawner* Spawner = UBlueprintNodeSpawner::Create(GetClass());
@@ -304,6 +385,15 @@ FBlueprintValue UK2Node_Subtract_IntInt::EvaluatePin(const UEdGraphPin* OutputPi
     return FBlueprintValue{}; 
 }
 
+int32 UK2Node_Subtract_IntInt::CompilePin(const UEdGraphPin* OutputPin, FBlueprintExpressionCompiler& Compiler)
+{
+    if (OutputPin->PinName == "Result")
+    {
+        return CompileBinaryOp(this, EBlueprintOpCode::SubtractInt, EBlueprintRegisterType::Int, EBlueprintRegisterType::Int, Compiler);
+    }
+    return INDEX_NONE;
+}
+
 void UK2Node_Subtract_IntInt::GetMenuActions(FBlueprintActionDatabaseRegistrar& ActionRegistrar) const
 {
     UBlueprintNodeSpawner* Spawner = UBlueprintNodeSpawner::Create(GetClass());
@@ -339,6 +429,15 @@ FBlueprintValue UK2Node_Multiply_IntInt::EvaluatePin(const UEdGraphPin* OutputPi
     return FBlueprintValue{}; 
 }
 
+int32 UK2Node_Multiply_IntInt::CompilePin(const UEdGraphPin* OutputPin, FBlueprintExpressionCompiler& Compiler)
+{
+    if (OutputPin->PinName == "Result")
+    {
+        return CompileBinaryOp(this, EBlueprintOpCode::MultiplyInt, EBlueprintRegisterType::Int, EBlueprintRegisterType::Int, Compiler);
+    }
+    return INDEX_NONE;
+}
+
 void UK2Node_Multiply_IntInt::GetMenuActions(FBlueprintActionDatabaseRegistrar& ActionRegistrar) const
 {
     UBlueprintNodeSpawner* Spawner = UBlueprintNodeSpawner::Create(GetClass());
@@ -375,6 +474,15 @@ FBlueprintValue UK2Node_Divide_IntInt::EvaluatePin(const UEdGraphPin* OutputPin,
     return FBlueprintValue{}; 
 }
 
+int32 UK2Node_Divide_IntInt::CompilePin(const UEdGraphPin* OutputPin, FBlueprintExpressionCompiler& Compiler)
+{
+    if (OutputPin->PinName == "Result")
+    {
+        return CompileBinaryOp(this, EBlueprintOpCode::DivideInt, EBlueprintRegisterType::Int, EBlueprintRegisterType::Int, Compiler);
+    }
+    return INDEX_NONE;
+}
+
 void UK2Node_Divide_IntInt::GetMenuActions(FBlueprintActionDatabaseRegistrar& ActionRegistrar) const
 {
     UBlueprintNodeSpawner* Spawner = UBlueprintNodeSpawner::Create(GetClass());
@@ -410,6 +518,15 @@ FBlueprintValue UK2Node_Greater_IntInt::EvaluatePin(const UEdGraphPin* OutputPin
     return FBlueprintValue{}; 
 }
 
+int32 UK2Node_Greater_IntInt::CompilePin(const UEdGraphPin* OutputPin, FBlueprintExpressionCompiler& Compiler)
+{
+    if (OutputPin->PinName == "Result")
+    {
+        return CompileBinaryOp(this, EBlueprintOpCode::GreaterInt, EBlueprintRegisterType::Int, EBlueprintRegisterType::Bool, Compiler);
+    }
+    return INDEX_NONE;
+}
+
 void UK2Node_Greater_IntInt::GetMenuActions(FBlueprintActionDatabaseRegistrar& ActionRegistrar) const
 {
     UBlueprintNodeSpawner* Spawner = UBlueprintNodeSpawner::Create(GetClass());
@@ -445,6 +562,15 @@ FBlueprintValue UK2Node_Equal_IntInt::EvaluatePin(const UEdGraphPin* OutputPin,
     return FBlueprintValue{}; 
 }
 
+int32 UK2Node_Equal_IntInt::CompilePin(const UEdGraphPin* OutputPin, FBlueprintExpressionCompiler& Compiler)
+{
+    if (OutputPin->PinName == "Result")
+    {
+        return CompileBinaryOp(this, EBlueprintOpCode::EqualInt, EBlueprintRegisterType::Int, EBlueprintRegisterType::Bool, Compiler);
+    }
+    return INDEX_NONE;
+}
+
 void UK2Node_Equal_IntInt::GetMenuActions(FBlueprintActionDatabaseRegistrar& ActionRegistrar) const
 {
     UBlueprintNodeSpawner* Spawner = UBlueprintNodeSpawner::Create(GetClass());
@@ -484,6 +610,15 @@ FBlueprintValue UK2Node_And_BoolBool::EvaluatePin(const UEdGraphPin* OutputPin,
     return FBlueprintValue{}; 
 }
 
+int32 UK2Node_And_BoolBool::CompilePin(const UEdGraphPin* OutputPin, FBlueprintExpressionCompiler& Compiler)
+{
+    if (OutputPin->PinName == "Result")
+    {
+        return CompileBinaryOp(this, EBlueprintOpCode::And, EBlueprintRegisterType::Bool, EBlueprintRegisterType::Bool, Compiler);
+    }
+    return INDEX_NONE;
+}
+
 void UK2Node_And_BoolBool::GetMenuActions(FBlueprintActionDatabaseRegistrar& ActionRegistrar) const
 {
     UBlueprintNodeSpawner* Spawner = UBlueprintNodeSpawner::Create(GetClass());
@@ -519,6 +654,15 @@ FBlueprintValue UK2Node_Or_BoolBool::EvaluatePin(const UEdGraphPin* OutputPin, F
     return FBlueprintValue{}; 
 }
 
+int32 UK2Node_Or_BoolBool::CompilePin(const UEdGraphPin* OutputPin, FBlueprintExpressionCompiler& Compiler)
+{
+    if (OutputPin->PinName == "Result")
+    {
+        return CompileBinaryOp(this, EBlueprintOpCode::Or, EBlueprintRegisterType::Bool, EBlueprintRegisterType::Bool, Compiler);
+    }
+    return INDEX_NONE;
+}
+
 void UK2Node_Or_BoolBool::GetMenuActions(FBlueprintActionDatabaseRegistrar& ActionRegistrar) const
 {
     UBlueprintNodeSpawner* Spawner = UBlueprintNodeSpawner::Create(GetClass());
@@ -554,6 +698,15 @@ FBlueprintValue UK2Node_Xor_BoolBool::EvaluatePin(const UEdGraphPin* OutputPin,
     return FBlueprintValue{}; 
 }
 
+int32 UK2Node_Xor_BoolBool::CompilePin(const UEdGraphPin* OutputPin, FBlueprintExpressionCompiler& Compiler)
+{
+    if (OutputPin->PinName == "Result")
+    {
+        return CompileBinaryOp(this, EBlueprintOpCode::Xor, EBlueprintRegisterType::Bool, EBlueprintRegisterType::Bool, Compiler);
+    }
+    return INDEX_NONE;
+}
+
 void UK2Node_Xor_BoolBool::GetMenuActions(FBlueprintActionDatabaseRegistrar& ActionRegistrar) const
 {
     UBlueprintNodeSpawner* Spawner = UBlueprintNodeSpawner::Create(GetClass());
@@ -588,6 +741,15 @@ FBlueprintValue UK2Node_Not_Bool::EvaluatePin(const UEdGraphPin* OutputPin, FBlu
     return FBlueprintValue{}; 
 }
 
+int32 UK2Node_Not_Bool::CompilePin(const UEdGraphPin* OutputPin, FBlueprintExpressionCompiler& Compiler)
+{
+    if (OutputPin->PinName == "Result")
+    {
+        return CompileUnaryOp(this, EBlueprintOpCode::Not, EBlueprintRegisterType::Bool, EBlueprintRegisterType::Bool, Compiler);
+    }
+    return INDEX_NONE;
+}
+
 void UK2Node_Not_Bool::GetMenuActions(FBlueprintActionDatabaseRegistrar& ActionRegistrar) const
 {
     UBlueprintNodeSpawner* Spawner = UBlueprintNodeSpawner::Create(GetClass());
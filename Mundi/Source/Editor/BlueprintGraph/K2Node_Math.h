@@ -41,6 +41,7 @@ public:
     virtual void AllocateDefaultPins() override;
     virtual void RenderBody() override;
     virtual FBlueprintValue EvaluatePin(const UEdGraphPin* OutputPin, FBlueprintContext* Context) override;
+    virtual int32 CompilePin(const UEdGraphPin* OutputPin, FBlueprintExpressionCompiler& Compiler) override;
     
     // --- UK2Node 인터페이스 ---
 public:
@@ -63,6 +64,7 @@ public:
     virtual void AllocateDefaultPins() override;
     virtual void RenderBody() override;
     virtual FBlueprintValue EvaluatePin(const UEdGraphPin* OutputPin, FBlueprintContext* Context) override;
+    virtual int32 CompilePin(const UEdGraphPin* OutputPin, FBlueprintExpressionCompiler& Compiler) override;
 
     // --- UK2Node 인터페이스 ---
 public:
@@ -85,6 +87,7 @@ public:
     virtual void AllocateDefaultPins() override;
     virtual void RenderBody() override;
     virtual FBlueprintValue EvaluatePin(const UEdGraphPin* OutputPin, FBlueprintContext* Context) override;
+    virtual int32 CompilePin(const UEdGraphPin* OutputPin, FBlueprintExpressionCompiler& Compiler) override;
     
     // --- UK2Node 인터페이스 ---
 public:
@@ -107,6 +110,7 @@ public:
     virtual void AllocateDefaultPins() override;
     virtual void RenderBody() override;
     virtual FBlueprintValue EvaluatePin(const UEdGraphPin* OutputPin, FBlueprintContext* Context) override;
+    virtual int32 CompilePin(const UEdGraphPin* OutputPin, FBlueprintExpressionCompiler& Compiler) override;
 
     // --- UK2Node 인터페이스 ---
 public:
@@ -129,6 +133,7 @@ public:
     virtual void AllocateDefaultPins() override;
     virtual void RenderBody() override;
     virtual FBlueprintValue EvaluatePin(const UEdGraphPin* OutputPin, FBlueprintContext* Context) override;
+    virtual int32 CompilePin(const UEdGraphPin* OutputPin, FBlueprintExpressionCompiler& Compiler) override;
 
     // --- UK2Node 인터페이스 ---
 public:
@@ -151,6 +156,7 @@ public:
     virtual void AllocateDefaultPins() override;
     virtual void RenderBody() override;
     virtual FBlueprintValue EvaluatePin(const UEdGraphPin* OutputPin, FBlueprintContext* Context) override;
+    virtual int32 CompilePin(const UEdGraphPin* OutputPin, FBlueprintExpressionCompiler& Compiler) override;
 
     // --- UK2Node 인터페이스 ---
 public:
@@ -177,6 +183,7 @@ public:
     virtual void AllocateDefaultPins() override;
     virtual void RenderBody() override;
     virtual FBlueprintValue EvaluatePin(const UEdGraphPin* OutputPin, FBlueprintContext* Context) override;
+    virtual int32 CompilePin(const UEdGraphPin* OutputPin, FBlueprintExpressionCompiler& Compiler) override;
 
     // --- UK2Node 인터페이스 ---
 public:
@@ -199,6 +206,7 @@ public:
     virtual void AllocateDefaultPins() override;
     virtual void RenderBody() override;
     virtual FBlueprintValue EvaluatePin(const UEdGraphPin* OutputPin, FBlueprintContext* Context) override;
+    virtual int32 CompilePin(const UEdGraphPin* OutputPin, FBlueprintExpressionCompiler& Compiler) override;
 
     // --- UK2Node 인터페이스 ---
 public:
@@ -221,6 +229,7 @@ public:
     virtual void AllocateDefaultPins() override;
     virtual void RenderBody() override;
     virtual FBlueprintValue EvaluatePin(const UEdGraphPin* OutputPin, FBlueprintContext* Context) override;
+    virtual int32 CompilePin(const UEdGraphPin* OutputPin, FBlueprintExpressionCompiler& Compiler) override;
 
     // --- UK2Node 인터페이스 ---
 public:
@@ -243,6 +252,7 @@ public:
     virtual void AllocateDefaultPins() override;
     virtual void RenderBody() override;
     virtual FBlueprintValue EvaluatePin(const UEdGraphPin* OutputPin, FBlueprintContext* Context) override;
+    virtual int32 CompilePin(const UEdGraphPin* OutputPin, FBlueprintExpressionCompiler& Compiler) override;
 
     // --- UK2Node 인터페이스 ---
 public:
@@ -265,6 +275,7 @@ public:
     virtual void AllocateDefaultPins() override;
     virtual void RenderBody() override;
     virtual FBlueprintValue EvaluatePin(const UEdGraphPin* OutputPin, FBlueprintContext* Context) override;
+    virtual int32 CompilePin(const UEdGraphPin* OutputPin, FBlueprintExpressionCompiler& Compiler) override;
 
     // --- UK2Node 인터페이스 ---
 public:
@@ -287,6 +298,7 @@ public:
     virtual void AllocateDefaultPins() override;
     virtual void RenderBody() override;
     virtual FBlueprintValue EvaluatePin(const UEdGraphPin* OutputPin, FBlueprintContext* Context) override;
+    virtual int32 CompilePin(const UEdGraphPin* OutputPin, FBlueprintExpressionCompiler& Compiler) override;
 
     // --- UK2Node 인터페이스 ---
 public:
@@ -313,6 +325,7 @@ public:
     virtual void AllocateDefaultPins() override;
     virtual void RenderBody() override;
     virtual FBlueprintValue EvaluatePin(const UEdGraphPin* OutputPin, FBlueprintContext* Context) override;
+    virtual int32 CompilePin(const UEdGraphPin* OutputPin, FBlueprintExpressionCompiler& Compiler) override;
 
     // --- UK2Node 인터페이스 ---
 public:
@@ -335,6 +348,7 @@ public:
     virtual void AllocateDefaultPins() override;
     virtual void RenderBody() override;
     virtual FBlueprintValue EvaluatePin(const UEdGraphPin* OutputPin, FBlueprintContext* Context) override;
+    virtual int32 CompilePin(const UEdGraphPin* OutputPin, FBlueprintExpressionCompiler& Compiler) override;
 
     // --- UK2Node 인터페이스 ---
 public:
@@ -357,6 +371,7 @@ public:
     virtual void AllocateDefaultPins() override;
     virtual void RenderBody() override;
     virtual FBlueprintValue EvaluatePin(const UEdGraphPin* OutputPin, FBlueprintContext* Context) override;
+    virtual int32 CompilePin(const UEdGraphPin* OutputPin, FBlueprintExpressionCompiler& Compiler) override;
 
     // --- UK2Node 인터페이스 ---
 public:
@@ -379,6 +394,7 @@ public:
     virtual void AllocateDefaultPins() override;
     virtual void RenderBody() override;
     virtual FBlueprintValue EvaluatePin(const UEdGraphPin* OutputPin, FBlueprintContext* Context) override;
+    virtual int32 CompilePin(const UEdGraphPin* OutputPin, FBlueprintExpressionCompiler& Compiler) override;
 
     // --- UK2Node 인터페이스 ---
 public:
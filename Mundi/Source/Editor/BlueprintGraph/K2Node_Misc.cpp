@@ -4,6 +4,7 @@
 #include "K2Node_Misc.h"
 #include "BlueprintActionDatabase.h"
 #include "BlueprintEvaluator.h"
+#include "BlueprintBytecode.h"
 
 // ----------------------------------------------------------------
 //	[Input] 키보드 입력 확인 노드
@@ -51,6 +52,26 @@ static int GetKeyCodeFromStr(const FString& InKeyName)
     return 0; // 알 수 없는 키
 }
 
+// ----------------------------------------------------------------
+//	바이트코드용 네이티브 함수 (키 코드/축은 컴파일 시점에 확정)
+// ----------------------------------------------------------------
+
+static FBlueprintRegister NativeIsKeyPressed(FBlueprintVMFrame& Frame, int32 KeyCode)
+{
+    return FBlueprintRegister::MakeBool(UInputManager::GetInstance().IsKeyPressed(KeyCode));
+}
+
+static FBlueprintRegister NativeIsKeyDown(FBlueprintVMFrame& Frame, int32 KeyCode)
+{
+    return FBlueprintRegister::MakeBool(UInputManager::GetInstance().IsKeyDown(KeyCode));
+}
+
+static FBlueprintRegister NativeGetMouseAxis(FBlueprintVMFrame& Frame, int32 Axis)
+{
+    const FVector2D Position = UInputManager::GetInstance().GetMousePosition();
+    return FBlueprintRegister::MakeFloat(Axis == 0 ? Position.X : Position.Y);
+}
+
 IMPLEMENT_CLASS(UK2Node_IsPressed)
 
 UK2Node_IsPressed::UK2Node_IsPressed()
@@ -101,6 +122,20 @@ FBlueprintValue UK2Node_IsPressed::EvaluatePin(const UEdGraphPin* OutputPin, FBl
     return FBlueprintValue{};
 }
 
+int32 UK2Node_IsPressed::CompilePin(const UEdGraphPin* OutputPin, FBlueprintExpressionCompiler& Compiler)
+{
+    if (OutputPin->PinName == "Result")
+    {
+        const int32 KeyCode = GetKeyCodeFromStr(KeyName);
+        if (KeyCode == 0)
+        {
+            return Compiler.EmitConstant(FBlueprintRegister::MakeBool(false), EBlueprintRegisterType::Bool);
+        }
+        return Compiler.EmitNativeCall(&NativeIsKeyPressed, KeyCode, EBlueprintRegisterType::Bool);
+    }
+    return INDEX_NONE;
+}
+
 void UK2Node_IsPressed::GetMenuActions(FBlueprintActionDatabaseRegistrar& ActionRegistrar) const
 {
     UBlueprintNodeSpawner* Spawner = UBlueprintNodeSpawner::Create(GetClass());
@@ -162,6 +197,20 @@ FBlueprintValue UK2Node_IsKeyDown::EvaluatePin(const UEdGraphPin* OutputPin, FBl
     return FBlueprintValue{};
 }
 
+int32 UK2Node_IsKeyDown::CompilePin(const UEdGraphPin* OutputPin, FBlueprintExpressionCompiler& Compiler)
+{
+    if (OutputPin->PinName == "Result")
+    {
+        const int32 KeyCode = GetKeyCodeFromStr(KeyName);
+        if (KeyCode == 0)
+        {
+            return Compiler.EmitConstant(FBlueprintRegister::MakeBool(false), EBlueprintRegisterType::Bool);
+        }
+        return Compiler.EmitNativeCall(&NativeIsKeyDown, KeyCode, EBlueprintRegisterType::Bool);
+    }
+    return INDEX_NONE;
+}
+
 void UK2Node_IsKeyDown::GetMenuActions(FBlueprintActionDatabaseRegistrar& ActionRegistrar) const
 {
     UBlueprintNodeSpawner* Spawner = UBlueprintNodeSpawner::Create(GetClass());
@@ -209,6 +258,19 @@ FBlueprintValue UK2Node_GetMousePosition::EvaluatePin(const UEdGraphPin* OutputP
     return FBlueprintValue{};
 }
 
+int32 UK2Node_GetMousePosition::CompilePin(const UEdGraphPin* OutputPin, FBlueprintExpressionCompiler& Compiler)
+{
+    if (OutputPin->PinName == "X")
+    {
+        return Compiler.EmitNativeCall(&NativeGetMouseAxis, 0, EBlueprintRegisterType::Float);
+    }
+    else if (OutputPin->PinName == "Y")
+    {
+        return Compiler.EmitNativeCall(&NativeGetMouseAxis, 1, EBlueprintRegisterType::Float);
+    }
+    return INDEX_NONE;
+}
+
 void UK2Node_GetMousePosition::GetMenuActions(FBlueprintActionDatabaseRegistrar& ActionRegistrar) const
 {
     UBlueprintNodeSpawner* Spawner = UBlueprintNodeSpawner::Create(GetClass());
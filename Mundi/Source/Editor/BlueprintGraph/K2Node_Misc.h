@@ -46,6 +46,7 @@ public:
     virtual void AllocateDefaultPins() override;
     virtual void RenderBody() override;
     virtual FBlueprintValue EvaluatePin(const UEdGraphPin* OutputPin, FBlueprintContext* Context) override;
+    virtual int32 CompilePin(const UEdGraphPin* OutputPin, FBlueprintExpressionCompiler& Compiler) override;
     
     // --- UK2Node 인터페이스 ---
 public:
@@ -73,6 +74,7 @@ public:
     virtual void AllocateDefaultPins() override;
     virtual void RenderBody() override;
     virtual FBlueprintValue EvaluatePin(const UEdGraphPin* OutputPin, FBlueprintContext* Context) override;
+    virtual int32 CompilePin(const UEdGraphPin* OutputPin, FBlueprintExpressionCompiler& Compiler) override;
     
     // --- UK2Node 인터페이스 ---
 public:
@@ -99,6 +101,7 @@ public:
     virtual void AllocateDefaultPins() override;
     virtual void RenderBody() override; 
     virtual FBlueprintValue EvaluatePin(const UEdGraphPin* OutputPin, FBlueprintContext* Context) override;
+    virtual int32 CompilePin(const UEdGraphPin* OutputPin, FBlueprintExpressionCompiler& Compiler) override;
 
     // --- UK2Node 인터페이스 ---
 public:
@@ -2,6 +2,7 @@
 #include "BlendSpace1D.h"
 #include "Source/Runtime/Engine/Animation/AnimSequence.h"
 #include "Source/Runtime/Engine/Animation/AnimDateModel.h"
+#include "Source/Runtime/Engine/Animation/AnimationRuntime.h"
 
 IMPLEMENT_CLASS(UBlendSpace1D)
 
@@ -261,7 +262,7 @@ void UBlendSpace1D::EvaluateAnimation(UAnimSequence* Animation, float Time, TArr
 	{
 		if (BoneIndex < BoneTracks.Num())
 		{
-			OutPose[BoneIndex] = DataModel->EvaluateBoneTrackTransform(BoneTracks[BoneIndex].Name, NormalizedTime);
+			OutPose[BoneIndex] = DataModel->EvaluateBoneTrackTransformByIndex(BoneIndex, NormalizedTime);
 		}
 		else
 		{
@@ -270,6 +271,22 @@ void UBlendSpace1D::EvaluateAnimation(UAnimSequence* Animation, float Time, TArr
 	}
 }
 
+void UBlendSpace1D::EvaluateAnimation(UAnimSequence* Animation, float Time, FPoseView& OutPose)
+{
+	if (!OutPose.IsValid())
+	{
+		return;
+	}
+
+	if (!Animation)
+	{
+		OutPose.SetIdentity();
+		return;
+	}
+
+	Animation->GetAnimationPose(OutPose, FAnimExtractContext(Time, true));
+}
+
 void UBlendSpace1D::BlendPoses(const TArray<FTransform>& PoseA,
 	const TArray<FTransform>& PoseB,
 	float Alpha,
@@ -306,6 +323,61 @@ void UBlendSpace1D::EvaluatePose(float Time, float DeltaTime, TArray<FTransform>
 	Update(CurrentParameter, DeltaTime, OutPose);
 }
 
+void UBlendSpace1D::EvaluatePose(float Time, float DeltaTime, FPoseView& OutPose, FAnimPoseStack& PoseStack)
+{
+	if (Samples.Num() == 0)
+	{
+		return;
+	}
+
+	UAnimSequence* AnimationA = Samples[0].Animation;
+	UAnimSequence* AnimationB = nullptr;
+	float Alpha = 0.0f;
+
+	if (Samples.Num() > 1)
+	{
+		FBlendSample1D* SampleA = nullptr;
+		FBlendSample1D* SampleB = nullptr;
+		GetBlendSamplesAndWeight(CurrentParameter, SampleA, SampleB, Alpha);
+		if (!SampleA || !SampleB)
+		{
+			return;
+		}
+		AnimationA = SampleA->Animation;
+		AnimationB = SampleB->Animation;
+	}
+
+	DominantSequence = (Alpha <= 0.5f) ? AnimationA : AnimationB;
+
+	EvaluateAnimation(AnimationA, CurrentPlayTime, OutPose);
+	if (Samples.Num() > 1 && Alpha > 0.0f)
+	{
+		FAnimPoseStackMark Mark(PoseStack);
+		FPoseView PoseB = PoseStack.Push();
+		EvaluateAnimation(AnimationB, CurrentPlayTime, PoseB);
+		FAnimationRuntime::BlendTwoPosesTogether(OutPose, PoseB, Alpha, OutPose);
+	}
+
+	// 재생 시간 갱신 (Update와 같은 규칙: 단일 샘플은 애니메이션이 있을 때만, 두 샘플은 짧은 쪽 길이로 루프)
+	if (Samples.Num() == 1 && !AnimationA)
+	{
+		return;
+	}
+
+	float PlayLength = AnimationA ? AnimationA->GetPlayLength() : 0.0f;
+	if (Samples.Num() > 1)
+	{
+		PlayLength = FMath::Min(PlayLength, AnimationB ? AnimationB->GetPlayLength() : 0.0f);
+	}
+
+	PreviousPlayTime = CurrentPlayTime;
+	CurrentPlayTime += DeltaTime;
+	if (PlayLength > 0.0f)
+	{
+		CurrentPlayTime = fmod(CurrentPlayTime, PlayLength);
+	}
+}
+
 float UBlendSpace1D::GetPlayLength() const
 {
 	if (Samples.Num() == 0)
@@ -53,6 +53,7 @@ public:
 	 * @note BlendSpace는 내부 파라미터(CurrentParameter)를 사용
 	 */
 	virtual void EvaluatePose(float Time, float DeltaTime, TArray<FTransform>& OutPose) override;
+	virtual void EvaluatePose(float Time, float DeltaTime, FPoseView& OutPose, FAnimPoseStack& PoseStack) override;
 
 	/**
 	 * @brief 애니메이션 총 재생 길이 반환 (첫 번째 샘플 기준)
@@ -208,6 +209,7 @@ private:
 		float& OutAlpha);
 
 	void EvaluateAnimation(UAnimSequence* Animation, float Time, TArray<FTransform>& OutPose);
+	void EvaluateAnimation(UAnimSequence* Animation, float Time, FPoseView& OutPose);
 
 	void BlendPoses(const TArray<FTransform>& PoseA,
 		const TArray<FTransform>& PoseB,
@@ -1,7 +1,8 @@
-#include "pch.h"
+﻿#include "pch.h"
 #include "BlendSpace2D.h"
 #include "Source/Runtime/Engine/Animation/AnimSequence.h"
 #include "Source/Runtime/Engine/Animation/AnimDateModel.h"
+#include "Source/Runtime/Engine/Animation/AnimationRuntime.h"
 
 IMPLEMENT_CLASS(UBlendSpace2D)
 
@@ -453,7 +454,7 @@ void UBlendSpace2D::EvaluateAnimation(UAnimSequence* Animation, float Time, TArr
 	{
 		if (BoneIndex < BoneTracks.Num())
 		{
-			OutPose[BoneIndex] = DataModel->EvaluateBoneTrackTransform(BoneTracks[BoneIndex].Name, NormalizedTime);
+			OutPose[BoneIndex] = DataModel->EvaluateBoneTrackTransformByIndex(BoneIndex, NormalizedTime);
 		}
 		else
 		{
@@ -462,6 +463,22 @@ void UBlendSpace2D::EvaluateAnimation(UAnimSequence* Animation, float Time, TArr
 	}
 }
 
+void UBlendSpace2D::EvaluateAnimation(UAnimSequence* Animation, float Time, FPoseView& OutPose)
+{
+	if (!OutPose.IsValid())
+	{
+		return;
+	}
+
+	if (!Animation)
+	{
+		OutPose.SetIdentity();
+		return;
+	}
+
+	Animation->GetAnimationPose(OutPose, FAnimExtractContext(Time, true));
+}
+
 void UBlendSpace2D::BlendPosesBarycentric(
 	const TArray<FTransform>& PoseA,
 	const TArray<FTransform>& PoseB,
@@ -572,24 +589,46 @@ void UBlendSpace2D::Update(float X, float Y, float DeltaTime, TArray<FTransform>
 	CurrentParameter.X = FMath::Clamp(X, MinParameter.X, MaxParameter.X);
 	CurrentParameter.Y = FMath::Clamp(Y, MinParameter.Y, MaxParameter.Y);
 
+	int32 Indices[3];
+	float Weights[3];
+	const int32 NumBlendSamples = GatherBlendSamples(Indices, Weights);
+
+	if (NumBlendSamples == 1)
+	{
+		// Single sample: output directly
+		EvaluateAnimation(Samples[Indices[0]].Animation, CurrentPlayTime, OutPose);
+	}
+	else if (NumBlendSamples == 2)
+	{
+		TArray<FTransform> PoseA, PoseB;
+		EvaluateAnimation(Samples[Indices[0]].Animation, CurrentPlayTime, PoseA);
+		EvaluateAnimation(Samples[Indices[1]].Animation, CurrentPlayTime, PoseB);
+		BlendTwoPoses(PoseA, PoseB, Weights[1], OutPose);
+	}
+	else if (NumBlendSamples == 3)
+	{
+		// Evaluate three poses
+		TArray<FTransform> PoseA, PoseB, PoseC;
+		EvaluateAnimation(Samples[Indices[0]].Animation, CurrentPlayTime, PoseA);
+		EvaluateAnimation(Samples[Indices[1]].Animation, CurrentPlayTime, PoseB);
+		EvaluateAnimation(Samples[Indices[2]].Animation, CurrentPlayTime, PoseC);
+
+		// Blend with barycentric weights
+		BlendPosesBarycentric(PoseA, PoseB, PoseC, Weights[0], Weights[1], Weights[2], OutPose);
+	}
+
+	AdvancePlayTime(Indices, NumBlendSamples, DeltaTime);
+}
+
+int32 UBlendSpace2D::GatherBlendSamples(int32 OutIndices[3], float OutWeights[3])
+{
 	// Handle special cases
 	if (Samples.Num() == 1)
 	{
-		// Single sample: output directly
 		DominantSequence = Samples[0].Animation;
-		EvaluateAnimation(Samples[0].Animation, CurrentPlayTime, OutPose);
-
-		if (Samples[0].Animation)
-		{
-			float PlayLength = Samples[0].Animation->GetPlayLength();
-			PreviousPlayTime = CurrentPlayTime;
-			CurrentPlayTime += DeltaTime;
-			if (PlayLength > 0.0f)
-			{
-				CurrentPlayTime = fmod(CurrentPlayTime, PlayLength);
-			}
-		}
-		return;
+		OutIndices[0] = 0;
+		OutWeights[0] = 1.0f;
+		return 1;
 	}
 
 	if (Samples.Num() == 2)
@@ -611,22 +650,11 @@ void UBlendSpace2D::Update(float X, float Y, float DeltaTime, TArray<FTransform>
 
 		DominantSequence = (Alpha <= 0.5f) ? Samples[0].Animation : Samples[1].Animation;
 
-		TArray<FTransform> PoseA, PoseB;
-		EvaluateAnimation(Samples[0].Animation, CurrentPlayTime, PoseA);
-		EvaluateAnimation(Samples[1].Animation, CurrentPlayTime, PoseB);
-		BlendTwoPoses(PoseA, PoseB, Alpha, OutPose);
-
-		float PlayLengthA = Samples[0].Animation ? Samples[0].Animation->GetPlayLength() : 0.0f;
-		float PlayLengthB = Samples[1].Animation ? Samples[1].Animation->GetPlayLength() : 0.0f;
-		float MinPlayLength = FMath::Min(PlayLengthA, PlayLengthB);
-
-		PreviousPlayTime = CurrentPlayTime;
-		CurrentPlayTime += DeltaTime;
-		if (MinPlayLength > 0.0f)
-		{
-			CurrentPlayTime = fmod(CurrentPlayTime, MinPlayLength);
-		}
-		return;
+		OutIndices[0] = 0;
+		OutIndices[1] = 1;
+		OutWeights[0] = 1.0f - Alpha;
+		OutWeights[1] = Alpha;
+		return 2;
 	}
 
 	// 3+ samples: use Delaunay triangulation (only if no manual triangles exist)
@@ -643,23 +671,15 @@ void UBlendSpace2D::Update(float X, float Y, float DeltaTime, TArray<FTransform>
 	{
 		// Outside all triangles: use closest sample
 		int32 ClosestIdx = FindClosestSample(CurrentParameter);
-		if (ClosestIdx >= 0)
+		if (ClosestIdx < 0)
 		{
-			DominantSequence = Samples[ClosestIdx].Animation;
-			EvaluateAnimation(Samples[ClosestIdx].Animation, CurrentPlayTime, OutPose);
-
-			if (Samples[ClosestIdx].Animation)
-			{
-				float PlayLength = Samples[ClosestIdx].Animation->GetPlayLength();
-				PreviousPlayTime = CurrentPlayTime;
-				CurrentPlayTime += DeltaTime;
-				if (PlayLength > 0.0f)
-				{
-					CurrentPlayTime = fmod(CurrentPlayTime, PlayLength);
-				}
-			}
+			return 0;
 		}
-		return;
+
+		DominantSequence = Samples[ClosestIdx].Animation;
+		OutIndices[0] = ClosestIdx;
+		OutWeights[0] = 1.0f;
+		return 1;
 	}
 
 	// Get barycentric coordinates
@@ -695,20 +715,35 @@ void UBlendSpace2D::Update(float X, float Y, float DeltaTime, TArray<FTransform>
 		DominantSequence = Samples[Tri.Indices[2]].Animation;
 	}
 
-	// Evaluate three poses
-	TArray<FTransform> PoseA, PoseB, PoseC;
-	EvaluateAnimation(Samples[Tri.Indices[0]].Animation, CurrentPlayTime, PoseA);
-	EvaluateAnimation(Samples[Tri.Indices[1]].Animation, CurrentPlayTime, PoseB);
-	EvaluateAnimation(Samples[Tri.Indices[2]].Animation, CurrentPlayTime, PoseC);
+	for (int32 i = 0; i < 3; ++i)
+	{
+		OutIndices[i] = Tri.Indices[i];
+	}
+	OutWeights[0] = U;
+	OutWeights[1] = V;
+	OutWeights[2] = W;
+	return 3;
+}
+
+void UBlendSpace2D::AdvancePlayTime(const int32 Indices[3], int32 NumBlendSamples, float DeltaTime)
+{
+	if (NumBlendSamples == 0)
+	{
+		return;
+	}
 
-	// Blend with barycentric weights
-	BlendPosesBarycentric(PoseA, PoseB, PoseC, U, V, W, OutPose);
+	// 단일 샘플은 애니메이션이 있을 때만 진행, 여러 샘플은 가장 짧은 길이로 루프
+	if (NumBlendSamples == 1 && !Samples[Indices[0]].Animation)
+	{
+		return;
+	}
 
-	// Update play time
-	float PlayLengthA = Samples[Tri.Indices[0]].Animation ? Samples[Tri.Indices[0]].Animation->GetPlayLength() : 0.0f;
-	float PlayLengthB = Samples[Tri.Indices[1]].Animation ? Samples[Tri.Indices[1]].Animation->GetPlayLength() : 0.0f;
-	float PlayLengthC = Samples[Tri.Indices[2]].Animation ? Samples[Tri.Indices[2]].Animation->GetPlayLength() : 0.0f;
-	float MinPlayLength = FMath::Min(FMath::Min(PlayLengthA, PlayLengthB), PlayLengthC);
+	float MinPlayLength = FLT_MAX;
+	for (int32 i = 0; i < NumBlendSamples; ++i)
+	{
+		UAnimSequence* Animation = Samples[Indices[i]].Animation;
+		MinPlayLength = FMath::Min(MinPlayLength, Animation ? Animation->GetPlayLength() : 0.0f);
+	}
 
 	PreviousPlayTime = CurrentPlayTime;
 	CurrentPlayTime += DeltaTime;
@@ -727,6 +762,42 @@ void UBlendSpace2D::EvaluatePose(float Time, float DeltaTime, TArray<FTransform>
 	Update(CurrentParameter.X, CurrentParameter.Y, DeltaTime, OutPose);
 }
 
+void UBlendSpace2D::EvaluatePose(float Time, float DeltaTime, FPoseView& OutPose, FAnimPoseStack& PoseStack)
+{
+	if (Samples.Num() == 0)
+	{
+		return;
+	}
+
+	CurrentParameter.X = FMath::Clamp(CurrentParameter.X, MinParameter.X, MaxParameter.X);
+	CurrentParameter.Y = FMath::Clamp(CurrentParameter.Y, MinParameter.Y, MaxParameter.Y);
+
+	int32 Indices[3];
+	float Weights[3];
+	const int32 NumBlendSamples = GatherBlendSamples(Indices, Weights);
+	if (NumBlendSamples == 0)
+	{
+		return;
+	}
+
+	// 첫 샘플은 출력 뷰에 바로 평가하고, 나머지만 스택에서 빌린다
+	FAnimPoseStackMark Mark(PoseStack);
+	FPoseView Poses[3];
+	Poses[0] = OutPose;
+	for (int32 i = 1; i < NumBlendSamples; ++i)
+	{
+		Poses[i] = PoseStack.Push();
+	}
+
+	for (int32 i = 0; i < NumBlendSamples; ++i)
+	{
+		EvaluateAnimation(Samples[Indices[i]].Animation, CurrentPlayTime, Poses[i]);
+	}
+	FAnimationRuntime::BlendPosesWeighted(Poses, Weights, NumBlendSamples, OutPose);
+
+	AdvancePlayTime(Indices, NumBlendSamples, DeltaTime);
+}
+
 float UBlendSpace2D::GetPlayLength() const
 {
 	if (Samples.Num() == 0)
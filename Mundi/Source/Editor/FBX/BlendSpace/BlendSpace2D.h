@@ -86,6 +86,7 @@ public:
 	// ============================================================
 
 	virtual void EvaluatePose(float Time, float DeltaTime, TArray<FTransform>& OutPose) override;
+	virtual void EvaluatePose(float Time, float DeltaTime, FPoseView& OutPose, FAnimPoseStack& PoseStack) override;
 	virtual float GetPlayLength() const override;
 	virtual int32 GetNumBoneTracks() const override;
 	virtual UAnimSequence* GetDominantSequence() const override { return DominantSequence; }
@@ -182,7 +183,12 @@ private:
 	                          float& OutU, float& OutV, float& OutW) const;
 	int32 FindClosestSample(const FVector2D& Point) const;
 
+	// 현재 파라미터에서 섞을 샘플 인덱스와 가중치를 고르고 DominantSequence 갱신, 샘플 수(0~3) 반환
+	int32 GatherBlendSamples(int32 OutIndices[3], float OutWeights[3]);
+	void AdvancePlayTime(const int32 Indices[3], int32 NumBlendSamples, float DeltaTime);
+
 	void EvaluateAnimation(UAnimSequence* Animation, float Time, TArray<FTransform>& OutPose);
+	void EvaluateAnimation(UAnimSequence* Animation, float Time, FPoseView& OutPose);
 	void BlendPosesBarycentric(const TArray<FTransform>& PoseA,
 	                           const TArray<FTransform>& PoseB,
 	                           const TArray<FTransform>& PoseC,
@@ -6,7 +6,11 @@
 #include "ObjManager.h"
 #include "Quad.h"
 #include "MeshBVH.h"
+#include "Source/Runtime/Core/Misc/WindowsBinReader.h"
+#include "Source/Runtime/Core/Misc/WindowsBinWriter.h"
 #include "Enums.h"
+#include "Material.h"
+#include "SceneView.h"
 
 #include <filesystem>
 #include <cwctype>
@@ -138,8 +142,62 @@ FMeshBVH* UResourceManager::GetOrBuildMeshBVH(const FString& ObjPath, const FSta
     if (!StaticMeshAsset)
         return nullptr;
 
+    const uint32 NumTriangles = StaticMeshAsset->Indices.Num() / 3;
+    const uint32 NumVertices = StaticMeshAsset->Vertices.Num();
+
+    // 메시 캐시 옆의 .bvh.bin을 먼저 시도 (원본보다 새롭고 삼각형/정점 수가 같을 때만 사용)
+    const bool bHasSourceFile = std::filesystem::exists(ObjPath);
+    const FString BVHCachePath = ConvertDataPathToCachePath(ObjPath) + ".bvh.bin";
+
     FMeshBVH* NewBVH = new FMeshBVH();
-    NewBVH->Build(StaticMeshAsset->Vertices, StaticMeshAsset->Indices);
+    bool bLoadedFromCache = false;
+    if (bHasSourceFile && std::filesystem::exists(BVHCachePath))
+    {
+        try
+        {
+            if (std::filesystem::last_write_time(BVHCachePath) >= std::filesystem::last_write_time(ObjPath))
+            {
+                FWindowsBinReader Reader(BVHCachePath);
+                if (Reader.IsOpen())
+                {
+                    Reader << *NewBVH;
+                    Reader.Close();
+                    bLoadedFromCache = !NewBVH->IsEmpty() && NewBVH->GetNumTriangles() == NumTriangles && NewBVH->GetNumVertices() == NumVertices;
+                }
+            }
+        }
+        catch (const std::exception& e)
+        {
+            UE_LOG("Error loading BVH cache: %s. Forcing rebuild.", e.what());
+            bLoadedFromCache = false;
+        }
+    }
+
+    if (!bLoadedFromCache)
+    {
+        NewBVH->Build(StaticMeshAsset->Vertices, StaticMeshAsset->Indices);
+
+        if (bHasSourceFile && !NewBVH->IsEmpty())
+        {
+            try
+            {
+                std::filesystem::path CacheDir = std::filesystem::path(BVHCachePath).parent_path();
+                if (!CacheDir.empty())
+                {
+                    std::filesystem::create_directories(CacheDir);
+                }
+
+                FWindowsBinWriter Writer(BVHCachePath);
+                Writer << *NewBVH;
+                Writer.Close();
+            }
+            catch (const std::exception& e)
+            {
+                UE_LOG("Error saving BVH cache: %s", e.what());
+            }
+        }
+    }
+
     MeshBVHCache.Add(ObjPath, NewBVH);
     return NewBVH;
 }
@@ -678,6 +736,60 @@ void UResourceManager::CheckAndReloadShaders(float DeltaTime)
     }
 }
 
+int32 UResourceManager::PrecompileShaderVariants()
+{
+    const TArray<TArray<FShaderMacro>> ViewMacroSets = FSceneView::GetAllViewShaderMacroSets();
+
+    // 같은 셰이더를 쓰는 머티리얼이 많으므로 셰이더별로 매크로 조합을 모아 중복을 제거한다
+    TMap<UShader*, TArray<TArray<FShaderMacro>>> MacroSetsByShader;
+    TMap<UShader*, TSet<uint64>> SeenKeysByShader;
+
+    auto AddMacroSet = [&](UShader* Shader, TArray<FShaderMacro>&& Macros)
+    {
+        TSet<uint64>& SeenKeys = SeenKeysByShader[Shader];
+        const uint64 Key = UShader::GenerateShaderKey(Macros);
+        if (SeenKeys.Contains(Key))
+        {
+            return;
+        }
+        SeenKeys.Add(Key);
+        MacroSetsByShader[Shader].Add(std::move(Macros));
+    };
+
+    for (UMaterial* Material : GetAll<UMaterial>())
+    {
+        UShader* Shader = Material ? Material->GetShader() : nullptr;
+        if (!Shader)
+        {
+            continue;
+        }
+
+        const TArray<FShaderMacro> MaterialMacros = Material->GetShaderMacros();
+        for (const TArray<FShaderMacro>& ViewMacros : ViewMacroSets)
+        {
+            TArray<FShaderMacro> Macros = ViewMacros;
+            Macros.insert(Macros.end(), MaterialMacros.begin(), MaterialMacros.end());
+
+            if (Shader->SupportsInstancing())
+            {
+                TArray<FShaderMacro> InstancedMacros = Macros;
+                InstancedMacros.Add(FShaderMacro{ "USE_INSTANCING", "1" });
+                AddMacroSet(Shader, std::move(InstancedMacros));
+            }
+            AddMacroSet(Shader, std::move(Macros));
+        }
+    }
+
+    int32 NumSubmitted = 0;
+    for (auto& Pair : MacroSetsByShader)
+    {
+        NumSubmitted += Pair.first->PrecompileVariants(Pair.second);
+    }
+
+    UE_LOG("Shader Precompile: %d variants queued (%d shaders)", NumSubmitted, static_cast<int32>(MacroSetsByShader.Num()));
+    return NumSubmitted;
+}
+
 void UResourceManager::UpdateDynamicVertexBuffer(const FString& Name, TArray<FBillboardVertexInfo_GPU>& vertices)
 {
     UQuad* Mesh = Get<UQuad>(Name);
@@ -72,6 +72,9 @@ public:
 	// --- Shader Hot Reload ---
 	void CheckAndReloadShaders(float DeltaTime);
 
+	// 로드된 머티리얼 x 뷰 모드 매크로 조합을 백그라운드로 컴파일해 디스크 캐시를 채운다, 제출한 Variant 수 반환
+	int32 PrecompileShaderVariants();
+
 	// --- 리소스 생성 및 관리 ---
 	FTextureData* CreateOrGetTextureData(const FWideString& FilePath);
 	void UpdateDynamicVertexBuffer(const FString& name, TArray<FBillboardVertexInfo_GPU>& vertices);
@@ -74,6 +74,12 @@ void USkeletalMesh::ReleaseResources()
         IndexBuffer = nullptr;
     }
 
+    if (SharedGPUSkinnedVertexBuffer)
+    {
+        SharedGPUSkinnedVertexBuffer->Release();
+        SharedGPUSkinnedVertexBuffer = nullptr;
+    }
+
     if (Data)
     {
         delete Data;
@@ -91,13 +97,25 @@ void USkeletalMesh::CreateCPUSkinnedVertexBuffer(ID3D11Buffer** InVertexBuffer)
 
 void USkeletalMesh::CreateGPUSkinnedVertexBuffer(ID3D11Buffer** InVertexBuffer)
 {
-    if (!Data)
+    if (!Data || !InVertexBuffer)
     {
         return;
     }
-    ID3D11Device* Device = GEngine.GetRHIDevice()->GetDevice();
-    HRESULT hr = D3D11RHI::CreateVertexBuffer<FSkinnedVertex>(Device, Data->Vertices, InVertexBuffer);
-    assert(SUCCEEDED(hr));
+
+    if (!SharedGPUSkinnedVertexBuffer)
+    {
+        ID3D11Device* Device = GEngine.GetRHIDevice()->GetDevice();
+        HRESULT hr = D3D11RHI::CreateVertexBuffer<FSkinnedVertex>(Device, Data->Vertices, &SharedGPUSkinnedVertexBuffer);
+        assert(SUCCEEDED(hr));
+        if (!SharedGPUSkinnedVertexBuffer)
+        {
+            return;
+        }
+    }
+
+    // 호출한 컴포넌트 몫의 참조 (컴포넌트 소멸자/메시 교체 시 Release)
+    SharedGPUSkinnedVertexBuffer->AddRef();
+    *InVertexBuffer = SharedGPUSkinnedVertexBuffer;
 }
 
 void USkeletalMesh::UpdateVertexBuffer(const TArray<FNormalVertex>& SkinnedVertices, ID3D11Buffer* InVertexBuffer)
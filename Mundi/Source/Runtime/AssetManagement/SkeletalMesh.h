@@ -32,6 +32,7 @@ public:
     uint64 GetMeshGroupCount() const { return Data ? Data->GroupInfos.size() : 0; }
 
     void CreateCPUSkinnedVertexBuffer(ID3D11Buffer** InVertexBuffer);
+    // GPU 스키닝 입력 정점은 읽기 전용이므로 메시당 하나를 만들어 두고 AddRef해서 공유 (받은 쪽은 Release로 반납)
     void CreateGPUSkinnedVertexBuffer(ID3D11Buffer** InVertexBuffer);
     void UpdateVertexBuffer(const TArray<FNormalVertex>& SkinnedVertices, ID3D11Buffer* InVertexBuffer);
     void CreateStructuredBuffer(ID3D11Buffer** InStructuredBuffer, ID3D11ShaderResourceView** InShaderResourceView, UINT ElementCount);
@@ -52,6 +53,7 @@ private:
     // GPU 리소스
     // ID3D11Buffer* VertexBuffer = nullptr; // W10 CPU Skinning이라 Component가 VB 소유
     ID3D11Buffer* IndexBuffer = nullptr;
+    ID3D11Buffer* SharedGPUSkinnedVertexBuffer = nullptr;   // 컴포넌트들이 참조 카운트로 공유
     uint32 VertexCount = 0;     // 정점 개수
     uint32 IndexCount = 0;     // 버텍스 점의 개수 
     uint32 CPUSkinnedVertexStride = 0;
@@ -0,0 +1,135 @@
+﻿#include "pch.h"
+#include "TaskPool.h"
+#include "CPUProfiler.h"
+
+namespace
+{
+	thread_local bool GIsTaskPoolWorker = false;
+}
+
+FTaskPool& FTaskPool::Get()
+{
+	static FTaskPool Instance;
+	return Instance;
+}
+
+FTaskPool::FTaskPool()
+{
+	// 메인 스레드 몫 하나를 빼고 워커를 만든다
+	const uint32 HardwareThreads = std::thread::hardware_concurrency();
+	const int32 NumWorkers = std::clamp<int32>(static_cast<int32>(HardwareThreads) - 1, 0, 15);
+
+	Workers.reserve(NumWorkers);
+	for (int32 i = 0; i < NumWorkers; ++i)
+	{
+		Workers.emplace_back(&FTaskPool::WorkerLoop, this);
+	}
+}
+
+FTaskPool::~FTaskPool()
+{
+	Shutdown();
+}
+
+void FTaskPool::Shutdown()
+{
+	{
+		std::lock_guard<std::mutex> Lock(Mutex);
+		bStopping = true;
+	}
+	WakeCondition.notify_all();
+
+	for (std::thread& Worker : Workers)
+	{
+		if (Worker.joinable())
+		{
+			Worker.join();
+		}
+	}
+	Workers.clear();
+}
+
+void FTaskPool::ParallelFor(int32 Num, int32 MinBatchSize, const FRangeFunction& Func)
+{
+	if (Num <= 0)
+	{
+		return;
+	}
+
+	const int32 BatchSize = std::max(1, MinBatchSize);
+	if (Workers.empty() || Num <= BatchSize || GIsTaskPoolWorker)
+	{
+		Func(0, Num);
+		return;
+	}
+
+	std::unique_lock<std::mutex> SubmitLock(SubmitMutex, std::try_to_lock);
+	if (!SubmitLock.owns_lock())
+	{
+		Func(0, Num);
+		return;
+	}
+
+	FJob Job;
+	Job.Func = &Func;
+	Job.Num = Num;
+	Job.BatchSize = BatchSize;
+
+	{
+		std::lock_guard<std::mutex> Lock(Mutex);
+		CurrentJob = &Job;
+		++JobSerial;
+	}
+	WakeCondition.notify_all();
+
+	RunBatches(Job);
+
+	// 모든 구간은 이미 분배됐고, 아직 실행 중인 워커만 기다린다 (Job은 스택 객체)
+	std::unique_lock<std::mutex> Lock(Mutex);
+	CurrentJob = nullptr;
+	DoneCondition.wait(Lock, [this]() { return ActiveWorkers == 0; });
+}
+
+void FTaskPool::RunBatches(FJob& Job)
+{
+	while (true)
+	{
+		const int32 Begin = Job.NextIndex.fetch_add(Job.BatchSize);
+		if (Begin >= Job.Num)
+		{
+			break;
+		}
+		(*Job.Func)(Begin, std::min(Begin + Job.BatchSize, Job.Num));
+	}
+}
+
+void FTaskPool::WorkerLoop()
+{
+	GIsTaskPoolWorker = true;
+	FCPUProfiler::SetCurrentThreadName("TaskPool Worker");
+	uint64 SeenSerial = 0;
+
+	while (true)
+	{
+		FJob* Job = nullptr;
+		{
+			std::unique_lock<std::mutex> Lock(Mutex);
+			WakeCondition.wait(Lock, [&]() { return bStopping || (CurrentJob && JobSerial != SeenSerial); });
+			if (bStopping)
+			{
+				return;
+			}
+			SeenSerial = JobSerial;
+			Job = CurrentJob;
+			++ActiveWorkers;
+		}
+
+		RunBatches(*Job);
+
+		{
+			std::lock_guard<std::mutex> Lock(Mutex);
+			--ActiveWorkers;
+		}
+		DoneCondition.notify_all();
+	}
+}
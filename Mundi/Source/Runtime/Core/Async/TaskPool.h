@@ -0,0 +1,57 @@
+﻿#pragma once
+#include <atomic>
+#include <condition_variable>
+#include <functional>
+#include <mutex>
+#include <thread>
+
+/**
+ * 고정 워커 스레드 풀 (ParallelFor 전용)
+ * - 워커는 처음 Get() 시 한 번 만들고 유지한다 (작업마다 스레드를 만들지 않음)
+ * - ParallelFor는 호출 스레드도 함께 일하고, 모든 구간이 끝나야 반환한다
+ * - 워커 안에서 다시 호출하거나 다른 스레드가 이미 사용 중이면 호출 스레드에서 바로 실행한다
+ */
+class FTaskPool
+{
+public:
+	using FRangeFunction = std::function<void(int32 Begin, int32 End)>;
+
+	static FTaskPool& Get();
+
+	// [0, Num)을 MinBatchSize 단위로 나눠 Func(Begin, End)를 병렬 실행
+	void ParallelFor(int32 Num, int32 MinBatchSize, const FRangeFunction& Func);
+
+	int32 GetNumWorkers() const { return static_cast<int32>(Workers.size()); }
+
+	void Shutdown();
+
+private:
+	FTaskPool();
+	~FTaskPool();
+	FTaskPool(const FTaskPool&) = delete;
+	FTaskPool& operator=(const FTaskPool&) = delete;
+
+	struct FJob
+	{
+		const FRangeFunction* Func = nullptr;
+		int32 Num = 0;
+		int32 BatchSize = 1;
+		std::atomic<int32> NextIndex{ 0 };
+	};
+
+	void WorkerLoop();
+	static void RunBatches(FJob& Job);
+
+private:
+	std::vector<std::thread> Workers;
+
+	std::mutex Mutex;
+	std::condition_variable WakeCondition;
+	std::condition_variable DoneCondition;
+	FJob* CurrentJob = nullptr;		// Mutex로 보호
+	uint64 JobSerial = 0;			// 워커가 같은 작업을 두 번 집지 않도록
+	int32 ActiveWorkers = 0;		// CurrentJob을 들고 있는 워커 수
+	bool bStopping = false;
+
+	std::mutex SubmitMutex;			// 동시에 하나의 ParallelFor만 워커를 사용
+};
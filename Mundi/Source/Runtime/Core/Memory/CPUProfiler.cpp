@@ -0,0 +1,469 @@
+﻿#include "pch.h"
+#include "CPUProfiler.h"
+#include <cstring>
+#include <cstdio>
+
+namespace
+{
+	constexpr uint64 EventIndexMask = FCPUProfiler::EventBufferCapacity - 1;
+
+	// 통계 이름 레지스트리 (등록 시에만 잠금, 조회는 EndFrame/UI에서)
+	struct FStatRegistry
+	{
+		std::mutex Mutex;
+		TArray<const char*> Names;
+	};
+
+	FStatRegistry& GetStatRegistry()
+	{
+		static FStatRegistry Registry;
+		return Registry;
+	}
+
+	void WriteJsonEscaped(FILE* File, const char* Text)
+	{
+		for (const char* C = Text; *C; ++C)
+		{
+			if (*C == '"' || *C == '\\')
+			{
+				fputc('\\', File);
+			}
+			fputc(*C, File);
+		}
+	}
+}
+
+FStatDescriptor::FStatDescriptor(const char* InName)
+	: Name(InName)
+{
+	FStatRegistry& Registry = GetStatRegistry();
+	std::lock_guard<std::mutex> Lock(Registry.Mutex);
+	for (int32 i = 0; i < Registry.Names.Num(); ++i)
+	{
+		if (std::strcmp(Registry.Names[i], InName) == 0)
+		{
+			Id = static_cast<uint32>(i);
+			return;
+		}
+	}
+	Id = static_cast<uint32>(Registry.Names.Num());
+	Registry.Names.Add(InName);
+}
+
+// 생산자는 소유 스레드 하나, 소비자는 EndFrame(메인 스레드) 하나
+struct FCPUProfiler::FThreadBuffer
+{
+	int32 ThreadIndex = 0;
+	FString Name;											// BufferMutex
+	std::unique_ptr<FCPUProfileEvent[]> Events;
+	std::atomic<uint64> WriteIndex{ 0 };
+
+	// 이하 소비자 전용
+	uint64 ReadIndex = 0;
+	uint64 DroppedEvents = 0;
+
+	struct FOpenScope
+	{
+		uint32 StatId;
+		uint64 StartCycles;
+		int32 Node;
+	};
+	TArray<FOpenScope> Stack;								// 프레임 경계를 넘어 열려 있는 스코프 유지
+	TArray<FCPUScopeNode> Nodes;							// 이번 프레임 트리
+	TMap<uint64, int32> NodeLookup;							// (Parent, StatId) -> Nodes 인덱스
+};
+
+FCPUProfiler& FCPUProfiler::Get()
+{
+	static FCPUProfiler Instance;
+	return Instance;
+}
+
+FCPUProfiler::~FCPUProfiler() = default;
+
+FCPUProfiler::FThreadBuffer* FCPUProfiler::GetThreadBuffer()
+{
+	thread_local FThreadBuffer* CurrentBuffer = nullptr;
+	if (!CurrentBuffer)
+	{
+		FCPUProfiler& Profiler = Get();
+		auto Buffer = std::make_unique<FThreadBuffer>();
+		Buffer->Events = std::make_unique<FCPUProfileEvent[]>(EventBufferCapacity);
+
+		std::lock_guard<std::mutex> Lock(Profiler.BufferMutex);
+		Buffer->ThreadIndex = Profiler.ThreadBuffers.Num();
+		Buffer->Name = "Thread " + std::to_string(GetCurrentThreadId());
+		CurrentBuffer = Buffer.get();
+		Profiler.ThreadBuffers.Add(std::move(Buffer));
+	}
+	return CurrentBuffer;
+}
+
+void FCPUProfiler::RecordEvent(uint32 StatId, bool bBegin)
+{
+	FThreadBuffer* Buffer = GetThreadBuffer();
+	const uint64 Write = Buffer->WriteIndex.load(std::memory_order_relaxed);
+	FCPUProfileEvent& Event = Buffer->Events[Write & EventIndexMask];
+	Event.Cycles = FPlatformTime::Cycles64();
+	Event.StatId = StatId;
+	Event.bBegin = bBegin ? 1u : 0u;
+	Buffer->WriteIndex.store(Write + 1, std::memory_order_release);
+}
+
+void FCPUProfiler::BeginScope(uint32 StatId)
+{
+	if (Get().IsEnabled())
+	{
+		RecordEvent(StatId, true);
+	}
+}
+
+void FCPUProfiler::EndScope(uint32 StatId)
+{
+	// 측정 도중 꺼져도 End는 남겨 짝이 맞게 한다 (짝 없는 End는 소비자가 무시)
+	RecordEvent(StatId, false);
+}
+
+void FCPUProfiler::SetCurrentThreadName(const char* InName)
+{
+	FThreadBuffer* Buffer = GetThreadBuffer();
+	std::lock_guard<std::mutex> Lock(Get().BufferMutex);
+	Buffer->Name = InName;
+}
+
+const char* FCPUProfiler::GetStatName(uint32 StatId)
+{
+	FStatRegistry& Registry = GetStatRegistry();
+	std::lock_guard<std::mutex> Lock(Registry.Mutex);
+	return StatId < static_cast<uint32>(Registry.Names.Num()) ? Registry.Names[StatId] : "Unknown";
+}
+
+int32 FCPUProfiler::FindStatId(const FString& StatName)
+{
+	FStatRegistry& Registry = GetStatRegistry();
+	std::lock_guard<std::mutex> Lock(Registry.Mutex);
+	for (int32 i = 0; i < Registry.Names.Num(); ++i)
+	{
+		if (StatName == Registry.Names[i])
+		{
+			return i;
+		}
+	}
+	return -1;
+}
+
+uint32 FCPUProfiler::GetNumStats()
+{
+	FStatRegistry& Registry = GetStatRegistry();
+	std::lock_guard<std::mutex> Lock(Registry.Mutex);
+	return static_cast<uint32>(Registry.Names.Num());
+}
+
+FString FCPUProfiler::GetThreadName(int32 ThreadIndex) const
+{
+	std::lock_guard<std::mutex> Lock(BufferMutex);
+	return (ThreadIndex >= 0 && ThreadIndex < ThreadBuffers.Num()) ? ThreadBuffers[ThreadIndex]->Name : FString("Unknown");
+}
+
+uint64 FCPUProfiler::GetNumDroppedEvents() const
+{
+	std::lock_guard<std::mutex> Lock(BufferMutex);
+	uint64 Dropped = 0;
+	for (const std::unique_ptr<FThreadBuffer>& Buffer : ThreadBuffers)
+	{
+		Dropped += Buffer->DroppedEvents;
+	}
+	return Dropped;
+}
+
+const FCPUFrameRecord* FCPUProfiler::GetLastFrame() const
+{
+	if (HistoryCount == 0)
+	{
+		return nullptr;
+	}
+	return &History[(HistoryHead + MaxHistoryFrames - 1) % MaxHistoryFrames];
+}
+
+const FCPUFrameRecord& FCPUProfiler::GetHistoryFrame(int32 IndexFromOldest) const
+{
+	const int32 Oldest = (HistoryHead - HistoryCount + MaxHistoryFrames) % MaxHistoryFrames;
+	return History[(Oldest + IndexFromOldest) % MaxHistoryFrames];
+}
+
+FTimeProfile FCPUProfiler::GetLastFrameProfile(const FString& StatName) const
+{
+	const FCPUFrameRecord* Frame = GetLastFrame();
+	const int32 StatId = FindStatId(StatName);
+	if (!Frame || StatId < 0 || StatId >= Frame->Stats.Num())
+	{
+		return FTimeProfile{ 0.0, 0 };
+	}
+	const FCPUStatFrameTotal& Total = Frame->Stats[StatId];
+	return FTimeProfile{ Total.InclusiveMs, Total.CallCount };
+}
+
+int32 FCPUProfiler::FindOrAddNode(FThreadBuffer& Buffer, int32 Parent, uint32 StatId)
+{
+	const uint64 Key = (static_cast<uint64>(static_cast<uint32>(Parent)) << 32) | StatId;
+	if (const int32* Found = Buffer.NodeLookup.Find(Key))
+	{
+		return *Found;
+	}
+
+	FCPUScopeNode Node;
+	Node.StatId = StatId;
+	Node.Parent = Parent;
+	Node.Depth = Parent >= 0 ? Buffer.Nodes[Parent].Depth + 1 : 0;
+	const int32 Index = Buffer.Nodes.Num();
+	Buffer.Nodes.Add(Node);
+	Buffer.NodeLookup.Add(Key, Index);
+	return Index;
+}
+
+void FCPUProfiler::ConsumeThreadBuffer(FThreadBuffer& Buffer, FCPUFrameRecord& Frame)
+{
+	const uint64 Write = Buffer.WriteIndex.load(std::memory_order_acquire);
+
+	// 생산자가 링을 한 바퀴 넘게 돌았으면 남은 최근 이벤트만 읽는다 (열린 스코프 정보는 잃음)
+	if (Write - Buffer.ReadIndex > EventBufferCapacity)
+	{
+		Buffer.DroppedEvents += Write - EventBufferCapacity - Buffer.ReadIndex;
+		Buffer.ReadIndex = Write - EventBufferCapacity;
+		Buffer.Stack.Empty();
+	}
+
+	// 새 프레임 트리: 아직 열려 있는 스코프 경로를 루트부터 다시 만든다
+	Buffer.Nodes.Empty();
+	Buffer.NodeLookup.Empty();
+	for (int32 i = 0; i < Buffer.Stack.Num(); ++i)
+	{
+		const int32 Parent = i > 0 ? Buffer.Stack[i - 1].Node : -1;
+		Buffer.Stack[i].Node = FindOrAddNode(Buffer, Parent, Buffer.Stack[i].StatId);
+	}
+
+	const bool bCapturing = RemainingCaptureFrames > 0;
+	for (uint64 i = Buffer.ReadIndex; i < Write; ++i)
+	{
+		const FCPUProfileEvent Event = Buffer.Events[i & EventIndexMask];
+		if (Event.bBegin)
+		{
+			const int32 Parent = Buffer.Stack.IsEmpty() ? -1 : Buffer.Stack.back().Node;
+			Buffer.Stack.Add({ Event.StatId, Event.Cycles, FindOrAddNode(Buffer, Parent, Event.StatId) });
+			continue;
+		}
+
+		// 짝이 맞는 Begin을 위에서부터 찾고, 그 위에 남은(짝 잃은) 스코프는 버린다
+		int32 Match = Buffer.Stack.Num() - 1;
+		while (Match >= 0 && Buffer.Stack[Match].StatId != Event.StatId)
+		{
+			--Match;
+		}
+		if (Match < 0)
+		{
+			continue;
+		}
+
+		const FThreadBuffer::FOpenScope Open = Buffer.Stack[Match];
+		Buffer.Stack.resize(Match);
+
+		const double Ms = FPlatformTime::ToMilliseconds(Event.Cycles - Open.StartCycles);
+		FCPUScopeNode& Node = Buffer.Nodes[Open.Node];
+		Node.InclusiveMs += Ms;
+		++Node.CallCount;
+
+		if (Open.StatId >= static_cast<uint32>(Frame.Stats.Num()))
+		{
+			Frame.Stats.resize(Open.StatId + 1);
+		}
+		Frame.Stats[Open.StatId].InclusiveMs += Ms;
+		++Frame.Stats[Open.StatId].CallCount;
+
+		if (bCapturing)
+		{
+			CapturedScopes.Add({ Open.StatId, Buffer.ThreadIndex, Open.StartCycles, Event.Cycles });
+		}
+	}
+	Buffer.ReadIndex = Write;
+}
+
+void FCPUProfiler::SortTreeDepthFirst(const TArray<FCPUScopeNode>& InNodes, TArray<FCPUScopeNode>& OutNodes)
+{
+	TArray<TArray<int32>> Children;
+	Children.resize(InNodes.Num() + 1);		// 마지막 칸 = 루트 목록
+	for (int32 i = 0; i < InNodes.Num(); ++i)
+	{
+		const int32 Parent = InNodes[i].Parent >= 0 ? InNodes[i].Parent : InNodes.Num();
+		Children[Parent].Add(i);
+	}
+	for (TArray<int32>& List : Children)
+	{
+		std::sort(List.begin(), List.end(), [&InNodes](int32 A, int32 B) { return InNodes[A].InclusiveMs > InNodes[B].InclusiveMs; });
+	}
+
+	// 출력 배열 기준으로 Parent를 다시 매긴다
+	OutNodes.Empty();
+	OutNodes.Reserve(InNodes.Num());
+	TArray<TPair<int32, int32>> Pending;	// (원래 인덱스, 출력 부모 인덱스)
+	for (auto It = Children.back().rbegin(); It != Children.back().rend(); ++It)
+	{
+		Pending.Add({ *It, -1 });
+	}
+	while (!Pending.IsEmpty())
+	{
+		const TPair<int32, int32> Item = Pending.back();
+		Pending.pop_back();
+
+		FCPUScopeNode Node = InNodes[Item.first];
+		Node.Parent = Item.second;
+		const int32 OutIndex = OutNodes.Num();
+		OutNodes.Add(Node);
+
+		const TArray<int32>& ChildList = Children[Item.first];
+		for (auto It = ChildList.rbegin(); It != ChildList.rend(); ++It)
+		{
+			Pending.Add({ *It, OutIndex });
+		}
+	}
+}
+
+void FCPUProfiler::EndFrame()
+{
+	const uint64 NowCycles = FPlatformTime::Cycles64();
+
+	if (History.IsEmpty())
+	{
+		History.resize(MaxHistoryFrames);
+	}
+	FCPUFrameRecord& Frame = History[HistoryHead];
+	Frame.FrameNumber = FrameNumber;
+	Frame.FrameMs = LastFrameEndCycles != 0 ? FPlatformTime::ToMilliseconds(NowCycles - LastFrameEndCycles) : 0.0;
+	Frame.Stats.assign(GetNumStats(), FCPUStatFrameTotal{});
+
+	// 버퍼는 프로그램 종료까지 지우지 않으므로 포인터만 복사해 잠금 밖에서 읽는다
+	TArray<FThreadBuffer*> Buffers;
+	{
+		std::lock_guard<std::mutex> Lock(BufferMutex);
+		Buffers.Reserve(ThreadBuffers.Num());
+		for (const std::unique_ptr<FThreadBuffer>& Buffer : ThreadBuffers)
+		{
+			Buffers.Add(Buffer.get());
+		}
+	}
+
+	LastFrameTrees.resize(Buffers.Num());
+	for (int32 i = 0; i < Buffers.Num(); ++i)
+	{
+		ConsumeThreadBuffer(*Buffers[i], Frame);
+		LastFrameTrees[i].ThreadIndex = Buffers[i]->ThreadIndex;
+		SortTreeDepthFirst(Buffers[i]->Nodes, LastFrameTrees[i].Nodes);
+	}
+
+	HistoryHead = (HistoryHead + 1) % MaxHistoryFrames;
+	HistoryCount = std::min(HistoryCount + 1, MaxHistoryFrames);
+	LastFrameEndCycles = NowCycles;
+
+	// 트레이스 캡처: 요청 다음 프레임 경계부터 시작
+	if (RemainingCaptureFrames > 0)
+	{
+		CapturedFrameMarkers.Add({ FrameNumber, NowCycles });
+		if (--RemainingCaptureFrames == 0)
+		{
+			WriteTrace();
+			CapturedScopes.Empty();
+			CapturedFrameMarkers.Empty();
+		}
+	}
+	else if (bCaptureArmed)
+	{
+		bCaptureArmed = false;
+		RemainingCaptureFrames = RequestedCaptureFrames;
+		CaptureStartCycles = NowCycles;
+		CapturedScopes.Empty();
+		CapturedFrameMarkers.Empty();
+	}
+
+	++FrameNumber;
+}
+
+void FCPUProfiler::BeginTraceCapture(int32 NumFrames, const FString& OutputPath)
+{
+	if (IsCapturingTrace())
+	{
+		UE_LOG("[warning] CPU trace capture already in progress");
+		return;
+	}
+	bCaptureArmed = true;
+	RequestedCaptureFrames = std::max(1, NumFrames);
+	CaptureOutputPath = OutputPath;
+}
+
+bool FCPUProfiler::WriteTrace() const
+{
+	std::error_code Error;
+	const std::filesystem::path OutputPath(UTF8ToWide(CaptureOutputPath));
+	if (OutputPath.has_parent_path())
+	{
+		std::filesystem::create_directories(OutputPath.parent_path(), Error);
+	}
+
+	FILE* File = nullptr;
+	if (_wfopen_s(&File, OutputPath.c_str(), L"wb") != 0 || !File)
+	{
+		UE_LOG("[error] CPU trace: failed to open %s", CaptureOutputPath.c_str());
+		return false;
+	}
+
+	// Chrome Trace Event 형식 (chrome://tracing, ui.perfetto.dev 에서 열 수 있음), 시간 단위 us
+	auto ToMicroseconds = [this](uint64 Cycles)
+	{
+		return Cycles >= CaptureStartCycles
+			? FPlatformTime::ToMilliseconds(Cycles - CaptureStartCycles) * 1000.0
+			: -FPlatformTime::ToMilliseconds(CaptureStartCycles - Cycles) * 1000.0;
+	};
+
+	fputs("{\"displayTimeUnit\":\"ms\",\"traceEvents\":[\n", File);
+	bool bFirst = true;
+	auto Separator = [&bFirst, File]()
+	{
+		if (!bFirst)
+		{
+			fputs(",\n", File);
+		}
+		bFirst = false;
+	};
+
+	{
+		std::lock_guard<std::mutex> Lock(BufferMutex);
+		for (const std::unique_ptr<FThreadBuffer>& Buffer : ThreadBuffers)
+		{
+			Separator();
+			fprintf(File, "{\"name\":\"thread_name\",\"ph\":\"M\",\"pid\":1,\"tid\":%d,\"args\":{\"name\":\"", Buffer->ThreadIndex);
+			WriteJsonEscaped(File, Buffer->Name.c_str());
+			fputs("\"}}", File);
+		}
+	}
+
+	for (const FCapturedScope& Scope : CapturedScopes)
+	{
+		Separator();
+		fputs("{\"name\":\"", File);
+		WriteJsonEscaped(File, GetStatName(Scope.StatId));
+		fprintf(File, "\",\"cat\":\"cpu\",\"ph\":\"X\",\"pid\":1,\"tid\":%d,\"ts\":%.3f,\"dur\":%.3f}",
+			Scope.ThreadIndex, ToMicroseconds(Scope.StartCycles),
+			FPlatformTime::ToMilliseconds(Scope.EndCycles - Scope.StartCycles) * 1000.0);
+	}
+
+	for (const TPair<uint64, uint64>& Marker : CapturedFrameMarkers)
+	{
+		Separator();
+		fprintf(File, "{\"name\":\"Frame %llu\",\"ph\":\"i\",\"s\":\"g\",\"pid\":1,\"tid\":0,\"ts\":%.3f}",
+			static_cast<unsigned long long>(Marker.first), ToMicroseconds(Marker.second));
+	}
+
+	fputs("\n]}\n", File);
+	fclose(File);
+
+	UE_LOG("CPU trace: %d frames, %d scopes -> %s", CapturedFrameMarkers.Num(), CapturedScopes.Num(), CaptureOutputPath.c_str());
+	return true;
+}
@@ -0,0 +1,187 @@
+﻿#pragma once
+#include "PlatformTime.h"
+#include <atomic>
+#include <mutex>
+
+/**
+ * @brief 현재 스코프의 CPU 시간을 측정합니다. (Key는 식별자, 위치마다 static 통계 설명자 하나)
+ * 스코프당 할당/문자열 해시 없이 스레드별 링 버퍼에 Begin/End 이벤트만 기록합니다.
+ */
+#define TIME_PROFILE(Key)\
+static const FStatDescriptor Key##StatDesc(#Key);\
+FCPUProfileScope Key##Counter(Key##StatDesc);
+
+#define TIME_PROFILE_END(Key)\
+Key##Counter.Finish();
+
+/**
+ * @brief 통계 설명자. 같은 이름은 같은 Id를 공유합니다 (등록은 처음 한 번만 잠금).
+ */
+struct FStatDescriptor
+{
+	explicit FStatDescriptor(const char* InName);
+
+	const char* Name = nullptr;
+	uint32 Id = 0;
+};
+
+struct FCPUProfileEvent
+{
+	uint64 Cycles = 0;
+	uint32 StatId = 0;
+	uint32 bBegin = 0;
+};
+
+// 한 프레임 동안 끝난 스코프의 합계 (모든 스레드)
+struct FCPUStatFrameTotal
+{
+	double InclusiveMs = 0.0;
+	uint32 CallCount = 0;
+};
+
+// 스코프 트리 노드, 같은 부모 아래 같은 통계는 하나로 합친다
+struct FCPUScopeNode
+{
+	uint32 StatId = 0;
+	int32 Parent = -1;
+	int32 Depth = 0;
+	double InclusiveMs = 0.0;
+	uint32 CallCount = 0;
+};
+
+struct FCPUThreadFrameTree
+{
+	int32 ThreadIndex = 0;
+	TArray<FCPUScopeNode> Nodes;	// 깊이 우선 순서, 형제는 시간 내림차순
+};
+
+struct FCPUFrameRecord
+{
+	uint64 FrameNumber = 0;
+	double FrameMs = 0.0;
+	TArray<FCPUStatFrameTotal> Stats;	// StatId 인덱스
+};
+
+/**
+ * @brief 스레드 인식 계층형 CPU 프로파일러 (싱글톤)
+ *
+ * - 생산자(측정 스레드): 스레드별 고정 크기 링 버퍼에 이벤트를 쓰고 WriteIndex만 갱신 (잠금 없음)
+ * - 소비자(메인 스레드 EndFrame): 새 이벤트를 읽어 스코프 트리, 통계 합계, 프레임 히스토리를 만든다
+ * - 한 프레임에 링 버퍼 용량보다 많은 이벤트가 쌓이면 오래된 이벤트는 버리고 개수를 센다
+ * - 트레이스 캡처: N 프레임의 스코프를 Chrome/Perfetto trace JSON으로 저장
+ */
+class FCPUProfiler
+{
+public:
+	static constexpr uint32 EventBufferCapacity = 1u << 16;	// 스레드당 이벤트 수 (2의 거듭제곱)
+	static constexpr int32 MaxHistoryFrames = 240;
+
+	static FCPUProfiler& Get();
+
+	static void BeginScope(uint32 StatId);
+	static void EndScope(uint32 StatId);
+	static void SetCurrentThreadName(const char* InName);
+
+	void SetEnabled(bool bInEnabled) { bEnabled.store(bInEnabled, std::memory_order_relaxed); }
+	bool IsEnabled() const { return bEnabled.load(std::memory_order_relaxed); }
+
+	// 메인 스레드에서 프레임마다 한 번 호출
+	void EndFrame();
+
+	// 지난 프레임 결과
+	uint64 GetFrameNumber() const { return FrameNumber; }
+	const FCPUFrameRecord* GetLastFrame() const;
+	FTimeProfile GetLastFrameProfile(const FString& StatName) const;
+	const TArray<FCPUThreadFrameTree>& GetLastFrameTrees() const { return LastFrameTrees; }
+
+	// 히스토리 (0 = 가장 오래된 프레임)
+	int32 GetNumHistoryFrames() const { return HistoryCount; }
+	const FCPUFrameRecord& GetHistoryFrame(int32 IndexFromOldest) const;
+
+	static const char* GetStatName(uint32 StatId);
+	static int32 FindStatId(const FString& StatName);
+	static uint32 GetNumStats();
+	FString GetThreadName(int32 ThreadIndex) const;
+	uint64 GetNumDroppedEvents() const;
+
+	// 다음 프레임부터 NumFrames 동안 캡처해 OutputPath에 저장
+	void BeginTraceCapture(int32 NumFrames, const FString& OutputPath);
+	bool IsCapturingTrace() const { return bCaptureArmed || RemainingCaptureFrames > 0; }
+
+private:
+	FCPUProfiler() = default;
+	~FCPUProfiler();
+	FCPUProfiler(const FCPUProfiler&) = delete;
+	FCPUProfiler& operator=(const FCPUProfiler&) = delete;
+
+	struct FThreadBuffer;
+	struct FCapturedScope
+	{
+		uint32 StatId;
+		int32 ThreadIndex;
+		uint64 StartCycles;
+		uint64 EndCycles;
+	};
+
+	static FThreadBuffer* GetThreadBuffer();
+	static void RecordEvent(uint32 StatId, bool bBegin);
+
+	void ConsumeThreadBuffer(FThreadBuffer& Buffer, FCPUFrameRecord& Frame);
+	static int32 FindOrAddNode(FThreadBuffer& Buffer, int32 Parent, uint32 StatId);
+	static void SortTreeDepthFirst(const TArray<FCPUScopeNode>& InNodes, TArray<FCPUScopeNode>& OutNodes);
+	bool WriteTrace() const;
+
+private:
+	std::atomic<bool> bEnabled{ true };
+
+	mutable std::mutex BufferMutex;				// 스레드 버퍼 등록 (드묾)
+	TArray<std::unique_ptr<FThreadBuffer>> ThreadBuffers;
+
+	uint64 FrameNumber = 0;
+	uint64 LastFrameEndCycles = 0;
+
+	TArray<FCPUFrameRecord> History;			// 링 (MaxHistoryFrames)
+	int32 HistoryHead = 0;						// 다음에 쓸 위치
+	int32 HistoryCount = 0;
+	TArray<FCPUThreadFrameTree> LastFrameTrees;
+
+	// 트레이스 캡처
+	bool bCaptureArmed = false;
+	int32 RequestedCaptureFrames = 0;
+	int32 RemainingCaptureFrames = 0;
+	FString CaptureOutputPath;
+	uint64 CaptureStartCycles = 0;
+	TArray<FCapturedScope> CapturedScopes;
+	TArray<TPair<uint64, uint64>> CapturedFrameMarkers;	// (프레임 번호, 끝 사이클)
+};
+
+/**
+ * @brief TIME_PROFILE이 만드는 스코프 객체 (Finish로 일찍 끝낼 수 있음)
+ */
+class FCPUProfileScope
+{
+public:
+	explicit FCPUProfileScope(const FStatDescriptor& InStat)
+		: StatId(InStat.Id)
+	{
+		FCPUProfiler::BeginScope(StatId);
+	}
+
+	~FCPUProfileScope()
+	{
+		Finish();
+	}
+
+	void Finish()
+	{
+		if (!bFinished)
+		{
+			bFinished = true;
+			FCPUProfiler::EndScope(StatId);
+		}
+	}
+
+private:
+	uint32 StatId;
+	bool bFinished = false;
+};
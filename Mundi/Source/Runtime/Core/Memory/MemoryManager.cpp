@@ -3,6 +3,8 @@
 #include <cstddef>
 #include <malloc.h>
 #include <algorithm>
+#include <cstdlib>
+#include <new>
 
 uint32 FMemoryManager::TotalAllocationBytes = 0;
 uint32 FMemoryManager::TotalAllocationCount = 0;
@@ -44,4 +46,103 @@ void FMemoryManager::Deallocate(void* Ptr)
 #else
 	_aligned_free(Raw);
 #endif
-}
\ No newline at end of file
+}
+
+// ============================================================
+// 전역 operator new/delete 대체: 스레드별 힙 할당 횟수만 센다
+// (UObject는 클래스 operator new로 Allocate를 쓰므로 여기 포함되지 않음)
+// WITH_HEAP_ALLOC_COUNTING=1로 빌드할 때만 대체한다
+// ============================================================
+#if WITH_HEAP_ALLOC_COUNTING
+namespace
+{
+	thread_local uint64 GThreadHeapAllocationCount = 0;
+
+	void* CountedMalloc(std::size_t Size)
+	{
+		++GThreadHeapAllocationCount;
+		return std::malloc(Size ? Size : 1);
+	}
+
+	void* CountedAlignedMalloc(std::size_t Size, std::align_val_t Alignment)
+	{
+		++GThreadHeapAllocationCount;
+		return _aligned_malloc(Size ? Size : 1, static_cast<std::size_t>(Alignment));
+	}
+}
+
+uint64 FMemoryManager::GetThreadHeapAllocationCount()
+{
+	return GThreadHeapAllocationCount;
+}
+
+void* operator new(std::size_t Size)
+{
+	if (void* Ptr = CountedMalloc(Size))
+		return Ptr;
+	throw std::bad_alloc();
+}
+
+void* operator new[](std::size_t Size)
+{
+	if (void* Ptr = CountedMalloc(Size))
+		return Ptr;
+	throw std::bad_alloc();
+}
+
+void* operator new(std::size_t Size, const std::nothrow_t&) noexcept
+{
+	return CountedMalloc(Size);
+}
+
+void* operator new[](std::size_t Size, const std::nothrow_t&) noexcept
+{
+	return CountedMalloc(Size);
+}
+
+void* operator new(std::size_t Size, std::align_val_t Alignment)
+{
+	if (void* Ptr = CountedAlignedMalloc(Size, Alignment))
+		return Ptr;
+	throw std::bad_alloc();
+}
+
+void* operator new[](std::size_t Size, std::align_val_t Alignment)
+{
+	if (void* Ptr = CountedAlignedMalloc(Size, Alignment))
+		return Ptr;
+	throw std::bad_alloc();
+}
+
+void* operator new(std::size_t Size, std::align_val_t Alignment, const std::nothrow_t&) noexcept
+{
+	return CountedAlignedMalloc(Size, Alignment);
+}
+
+void* operator new[](std::size_t Size, std::align_val_t Alignment, const std::nothrow_t&) noexcept
+{
+	return CountedAlignedMalloc(Size, Alignment);
+}
+
+void operator delete(void* Ptr) noexcept { std::free(Ptr); }
+void operator delete[](void* Ptr) noexcept { std::free(Ptr); }
+void operator delete(void* Ptr, std::size_t) noexcept { std::free(Ptr); }
+void operator delete[](void* Ptr, std::size_t) noexcept { std::free(Ptr); }
+void operator delete(void* Ptr, const std::nothrow_t&) noexcept { std::free(Ptr); }
+void operator delete[](void* Ptr, const std::nothrow_t&) noexcept { std::free(Ptr); }
+
+void operator delete(void* Ptr, std::align_val_t) noexcept { _aligned_free(Ptr); }
+void operator delete[](void* Ptr, std::align_val_t) noexcept { _aligned_free(Ptr); }
+void operator delete(void* Ptr, std::size_t, std::align_val_t) noexcept { _aligned_free(Ptr); }
+void operator delete[](void* Ptr, std::size_t, std::align_val_t) noexcept { _aligned_free(Ptr); }
+void operator delete(void* Ptr, std::align_val_t, const std::nothrow_t&) noexcept { _aligned_free(Ptr); }
+void operator delete[](void* Ptr, std::align_val_t, const std::nothrow_t&) noexcept { _aligned_free(Ptr); }
+
+#else
+
+uint64 FMemoryManager::GetThreadHeapAllocationCount()
+{
+	return 0;
+}
+
+#endif // WITH_HEAP_ALLOC_COUNTING
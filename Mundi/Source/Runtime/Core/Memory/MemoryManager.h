@@ -2,6 +2,12 @@
 #include <cstddef>
 #include "UEContainer.h"
 
+// 1이면 전역 operator new/delete를 대체해 스레드별 힙 할당 횟수를 센다 (BENCH POSE 무할당 검증용)
+// 기본 빌드에서는 CRT 할당자를 그대로 쓴다
+#ifndef WITH_HEAP_ALLOC_COUNTING
+#define WITH_HEAP_ALLOC_COUNTING 0
+#endif
+
 class FMemoryManager
 {
 public:
@@ -9,6 +15,11 @@ public:
 	static void* Allocate(SIZE_T Size, SIZE_T Alignment);
 	static void  Deallocate(void* Ptr);
 
+	// 현재 스레드에서 전역 operator new가 호출된 누적 횟수 (프레임 무할당 검증용)
+	// WITH_HEAP_ALLOC_COUNTING이 꺼져 있으면 항상 0
+	static uint64 GetThreadHeapAllocationCount();
+	static constexpr bool IsHeapAllocationCountingEnabled() { return WITH_HEAP_ALLOC_COUNTING != 0; }
+
 public:
 	static uint32 TotalAllocationBytes;
 	static uint32 TotalAllocationCount;
@@ -1,12 +1,5 @@
 ﻿#pragma once
 
-
-#define TIME_PROFILE(Key)\
-FScopeCycleCounter Key##Counter(#Key); //현재 스코프 단위로 측정
-
-#define TIME_PROFILE_END(Key)\
-Key##Counter.Finish();
-
 class FWindowsPlatformTime
 {
 public:
@@ -59,12 +52,6 @@ public:
 	}
 };
 
-struct TStatId
-{
-	FString Key;
-	TStatId() = default;
-	TStatId(const FString& InKey) : Key(InKey) {}
-};
 struct FTimeProfile
 {
 	double Milliseconds;
@@ -107,25 +94,17 @@ struct FTimeProfile
 
 typedef FWindowsPlatformTime FPlatformTime;
 
+// 단순 구간 타이머 (통계 기록은 CPUProfiler.h의 TIME_PROFILE 사용)
 class FScopeCycleCounter
 {
 public:
-	FScopeCycleCounter(TStatId StatId)
-		: StartCycles(FPlatformTime::Cycles64()) //생성 시 사이클 저장
-		, UsedStatId(StatId) //키값 저장
-	{
-	}
-	FScopeCycleCounter() : StartCycles(FPlatformTime::Cycles64()), UsedStatId()
-	{
-	}
-
-	FScopeCycleCounter(const FString& Key) : StartCycles(FPlatformTime::Cycles64()), UsedStatId(TStatId(Key))
+	FScopeCycleCounter() : StartCycles(FPlatformTime::Cycles64()) //생성 시 사이클 저장
 	{
 	}
 
 	~FScopeCycleCounter()
 	{
-		Finish(); //소멸 시 현재 사이클 구해서 현재 - 생성 사이클로 시간 측정
+		Finish();
 	}
 
 	double Finish()
@@ -138,25 +117,12 @@ public:
 		const uint64 EndCycles = FPlatformTime::Cycles64();
 		const uint64 CycleDiff = EndCycles - StartCycles;
 
-		double Milliseconds = FWindowsPlatformTime::ToMilliseconds(CycleDiff);
-		if (UsedStatId.Key.empty() == false)
-		{
-			AddTimeProfile(UsedStatId, Milliseconds); //키 값이 있을경우 Map에 저장
-		}
-		return Milliseconds;
+		return FWindowsPlatformTime::ToMilliseconds(CycleDiff);
 	}
 
-	static void AddTimeProfile(const TStatId& Key, double InMilliseconds);
-	static void TimeProfileInit();
-
-	//이거 왜 안됨?
-	//static const TMap<FString, FTimeProfile>& GetTimeProfiles();
-
-	static const TArray<FString> GetTimeProfileKeys();
-	static const TArray<FTimeProfile> GetTimeProfileValues();
-	static const FTimeProfile& GetTimeProfile(const FString& Key);
 private:
 	bool bIsFinish = false;
 	uint64 StartCycles;
-	TStatId UsedStatId;
-};
\ No newline at end of file
+};
+
+#include "CPUProfiler.h"
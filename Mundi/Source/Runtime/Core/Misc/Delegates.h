@@ -1,84 +1,303 @@
 ﻿#pragma once
 
-#include <vector>
-#include <functional>
-#include <algorithm>
+#include <new>
 #include <memory>
+#include <type_traits>
+#include <utility>
+#include "ObjectFactory.h"
 
-using FDelegateHandle = size_t;
+class UObject;
 
+// 델리게이트 바인딩 핸들: 슬롯 인덱스 + 세대
+// - 슬롯이 해제되면 세대가 바뀌므로, 이미 해제된 핸들로 Remove해도 재사용된 다른 바인딩을 지우지 않는다
+// - 기본값(세대 0)은 무효 핸들
+struct FDelegateHandle
+{
+	uint32 Index = 0;
+	uint32 Generation = 0;
+
+	bool IsValid() const { return Generation != 0; }
+	void Reset() { Index = 0; Generation = 0; }
+
+	bool operator==(const FDelegateHandle& Other) const { return Index == Other.Index && Generation == Other.Generation; }
+	bool operator!=(const FDelegateHandle& Other) const { return !(*this == Other); }
+};
+
+/**
+ * 멀티캐스트 델리게이트
+ * - 핸들러는 슬롯의 고정 크기 버퍼(InlineSize)에 직접 저장, 넘치는 캡처만 힙에 할당
+ * - 슬롯은 청크 단위로 할당되어 주소가 바뀌지 않음 (Broadcast 중 Add 해도 실행 중인 핸들러가 이동하지 않음)
+ * - Remove는 핸들 세대 확인 후 O(1), 빈 슬롯은 프리 리스트로 재사용
+ * - Broadcast 중 Remove/Clear는 즉시 무효화하고 실제 해제는 가장 바깥 Broadcast가 끝난 뒤 수행
+ *   (Broadcast 중 추가된 핸들러는 다음 Broadcast부터 호출)
+ * - UObject에 바인딩하면 호출 전에 생존 여부를 확인하고, 삭제된 오브젝트의 바인딩은 자동 해제
+ * - 호출 순서는 슬롯 순서 (제거 후 재사용된 슬롯은 먼저 추가된 핸들러보다 앞에서 호출될 수 있음)
+ * - 복사 시 바인딩은 복사하지 않는다 (PIE 복제된 오브젝트가 원본 오브젝트의 핸들러를 호출하지 않도록)
+ */
 template<typename... Args>
 class TDelegate
 {
 public:
-	using HandlerType = std::function<void(Args...)>;
+	static constexpr SIZE_T InlineSize = 32;		// 포인터 4개 (멤버 함수 바인딩 포함 대부분의 람다가 들어감)
 
-	TDelegate() : NextHandle(1) {}
+	TDelegate() = default;
+	TDelegate(const TDelegate&) {}
+	TDelegate& operator=(const TDelegate&) { return *this; }
 
-	FDelegateHandle Add(const HandlerType& Handler)
+	~TDelegate()
 	{
-		FDelegateHandle Handle = NextHandle++;
-		Handlers.push_back({ Handle, Handler });
-		return Handle;
+		for (int32 Index = 0; Index < NumSlots; ++Index)
+		{
+			FSlot& Slot = GetSlot(Index);
+			if (Slot.Ops)
+			{
+				Slot.Ops->Destroy(Slot.Storage);
+			}
+		}
 	}
 
-	// original: template<typename T>
+	// 람다/함수 객체 바인딩 (수명은 호출자가 관리)
+	template<typename FuncType>
+	FDelegateHandle Add(FuncType&& Func)
+	{
+		return Bind(std::forward<FuncType>(Func), nullptr, 0, 0);
+	}
+
+	// Owner가 삭제되면 자동으로 해제되는 람다 바인딩
+	template<typename TObj, typename FuncType>
+	FDelegateHandle AddWeakLambda(TObj* Owner, FuncType&& Func)
+	{
+		static_assert(std::is_base_of_v<UObject, TObj>, "AddWeakLambda requires a UObject owner");
+		return Bind(std::forward<FuncType>(Func), Owner, Owner ? Owner->UUID : 0, Owner ? Owner->InternalIndex : UINT32_MAX);
+	}
+
+	// 멤버 함수 바인딩, UObject 파생 인스턴스는 삭제 시 자동 해제
 	template<typename TObj, typename TClass>
 	FDelegateHandle AddDynamic(TObj* Instance, void(TClass::* Func)(Args...))
 	{
-		FDelegateHandle Handle = NextHandle++;
-		Handlers.push_back({
-			Handle,
-			[=](Args... args) {
-			(Instance->*Func)(args...); }
-		});
-		return Handle;
+		struct FMemberCall
+		{
+			TObj* Instance;
+			void(TClass::* Func)(Args...);
+
+			void operator()(Args... args) const { (Instance->*Func)(args...); }
+		};
+
+		if constexpr (std::is_base_of_v<UObject, TObj>)
+		{
+			return Bind(FMemberCall{ Instance, Func }, Instance, Instance->UUID, Instance->InternalIndex);
+		}
+		else
+		{
+			return Bind(FMemberCall{ Instance, Func }, nullptr, 0, 0);
+		}
 	}
 
-	void Broadcast(Args... args) 
+	void Broadcast(Args... args)
 	{
-		for (auto& Entry : Handlers) {
-			if (Entry.Handler)
+		// 이번 호출 중 추가된 슬롯은 방문하지 않는다
+		const int32 NumToVisit = NumSlots;
+		++BroadcastDepth;
+		for (int32 Index = 0; Index < NumToVisit; ++Index)
+		{
+			FSlot& Slot = GetSlot(Index);
+			if (!Slot.Ops || Slot.NextFree == PendingRemoveMark)
 			{
-				Entry.Handler(args...);
+				continue;
 			}
+			if (Slot.WeakObject && !ObjectFactory::IsObjectAlive(Slot.WeakObject, Slot.WeakUUID, Slot.WeakIndexHint))
+			{
+				RemoveSlot(Index);
+				continue;
+			}
+			Slot.Ops->Invoke(Slot.Storage, args...);
+		}
+		if (--BroadcastDepth == 0 && !PendingRemovals.IsEmpty())
+		{
+			FlushPendingRemovals();
 		}
 	}
 
-	void Remove(FDelegateHandle Handle)
+	// 핸들이 가리키는 바인딩이 아직 살아 있으면 해제하고 true
+	bool Remove(FDelegateHandle Handle)
 	{
-		auto it = std::remove_if(Handlers.begin(), Handlers.end(),
-		[&](const Entry& e)
+		if (!Handle.IsValid() || Handle.Index >= static_cast<uint32>(NumSlots))
 		{
-			return e.Handle == Handle;
-		});
-		Handlers.erase(it, Handlers.end());
+			return false;
+		}
+
+		FSlot& Slot = GetSlot(static_cast<int32>(Handle.Index));
+		if (!Slot.Ops || Slot.Generation != Handle.Generation)
+		{
+			return false;
+		}
+		RemoveSlot(static_cast<int32>(Handle.Index));
+		return true;
 	}
 
+	// 모든 바인딩 해제 (슬롯 세대는 유지하므로 이전 핸들은 계속 무효)
 	void Clear()
 	{
-		Handlers.clear();
+		for (int32 Index = 0; Index < NumSlots; ++Index)
+		{
+			FSlot& Slot = GetSlot(Index);
+			if (Slot.Ops && Slot.NextFree != PendingRemoveMark)
+			{
+				RemoveSlot(Index);
+			}
+		}
 	}
 
+	bool IsBound() const { return NumBound > 0; }
+	int32 Num() const { return NumBound; }
+
+	// 인라인 버퍼에 들어가지 못해 힙에 할당된 핸들러 수 (전체 델리게이트 누적, 벤치마크/진단용)
+	static uint64 GetNumHeapBindings() { return NumHeapBindings; }
+
 private:
-	struct Entry
+	struct FCallableOps
+	{
+		void (*Invoke)(void* Storage, Args... args);
+		void (*Destroy)(void* Storage);
+	};
+
+	template<typename FStored>
+	struct TInlineOps
+	{
+		static void Invoke(void* Storage, Args... args) { (*static_cast<FStored*>(Storage))(args...); }
+		static void Destroy(void* Storage) { static_cast<FStored*>(Storage)->~FStored(); }
+		static constexpr FCallableOps Ops{ &Invoke, &Destroy };
+	};
+
+	template<typename FStored>
+	struct THeapOps
+	{
+		static void Invoke(void* Storage, Args... args) { (**static_cast<FStored**>(Storage))(args...); }
+		static void Destroy(void* Storage) { delete *static_cast<FStored**>(Storage); }
+		static constexpr FCallableOps Ops{ &Invoke, &Destroy };
+	};
+
+	// 64바이트 (캐시 라인 하나)
+	struct FSlot
 	{
-		FDelegateHandle Handle;
-		HandlerType Handler;
+		alignas(16) unsigned char Storage[InlineSize];
+		const FCallableOps* Ops = nullptr;		// nullptr이면 빈 슬롯
+		const UObject* WeakObject = nullptr;	// 생존 확인 대상 (nullptr이면 확인 안 함)
+		uint32 WeakUUID = 0;
+		uint32 WeakIndexHint = 0;				// GUObjectArray 인덱스 (압축으로 바뀌면 ObjectFactory가 갱신)
+		uint32 Generation = 1;
+		int32 NextFree = -1;					// 빈 슬롯: 다음 빈 슬롯, 바인딩 중: PendingRemoveMark 여부
 	};
 
-	std::vector<Entry> Handlers;
-	FDelegateHandle NextHandle;
+	static constexpr int32 PendingRemoveMark = -2;
+	static constexpr int32 ChunkShift = 3;
+	static constexpr int32 ChunkSize = 1 << ChunkShift;
+
+	FSlot& GetSlot(int32 Index) { return Chunks[Index >> ChunkShift][Index & (ChunkSize - 1)]; }
+
+	template<typename FuncType>
+	FDelegateHandle Bind(FuncType&& Func, const UObject* WeakObject, uint32 WeakUUID, uint32 WeakIndex)
+	{
+		using FStored = std::decay_t<FuncType>;
+
+		const int32 Index = AllocateSlot();
+		FSlot& Slot = GetSlot(Index);
+		if constexpr (sizeof(FStored) <= InlineSize && alignof(FStored) <= 16)
+		{
+			new (Slot.Storage) FStored(std::forward<FuncType>(Func));
+			Slot.Ops = &TInlineOps<FStored>::Ops;
+		}
+		else
+		{
+			*reinterpret_cast<FStored**>(Slot.Storage) = new FStored(std::forward<FuncType>(Func));
+			Slot.Ops = &THeapOps<FStored>::Ops;
+			++NumHeapBindings;
+		}
+
+		// 팩토리에 등록되지 않은 오브젝트(ConstructObject 직후 등)는 추적할 수 없으므로 일반 바인딩으로 취급
+		const bool bTrackObject = WeakObject && WeakIndex != UINT32_MAX;
+		Slot.WeakObject = bTrackObject ? WeakObject : nullptr;
+		Slot.WeakUUID = WeakUUID;
+		Slot.WeakIndexHint = WeakIndex;
+		Slot.NextFree = -1;
+		++NumBound;
+
+		return FDelegateHandle{ static_cast<uint32>(Index), Slot.Generation };
+	}
+
+	int32 AllocateSlot()
+	{
+		// Broadcast 중에는 빈 슬롯을 재사용하지 않는다 (방문 범위 안의 슬롯에 새 핸들러가 들어가지 않도록)
+		if (FirstFree != -1 && BroadcastDepth == 0)
+		{
+			const int32 Index = FirstFree;
+			FirstFree = GetSlot(Index).NextFree;
+			return Index;
+		}
+
+		if ((NumSlots & (ChunkSize - 1)) == 0)
+		{
+			Chunks.push_back(std::make_unique<FSlot[]>(ChunkSize));
+		}
+		return NumSlots++;
+	}
+
+	void RemoveSlot(int32 Index)
+	{
+		FSlot& Slot = GetSlot(Index);
+		Slot.Generation = (Slot.Generation == UINT32_MAX) ? 1 : Slot.Generation + 1;
+		--NumBound;
+
+		if (BroadcastDepth > 0)
+		{
+			// 실행 중인 핸들러 자신일 수 있으므로 소멸은 Broadcast가 끝난 뒤로 미룬다
+			Slot.NextFree = PendingRemoveMark;
+			PendingRemovals.Add(Index);
+			return;
+		}
+		ReleaseSlot(Index);
+	}
+
+	void ReleaseSlot(int32 Index)
+	{
+		FSlot& Slot = GetSlot(Index);
+		const FCallableOps* Ops = Slot.Ops;
+		Slot.Ops = nullptr;
+		Slot.WeakObject = nullptr;
+		Slot.NextFree = FirstFree;
+		FirstFree = Index;
+		Ops->Destroy(Slot.Storage);
+	}
+
+	void FlushPendingRemovals()
+	{
+		TArray<int32> Removals = std::move(PendingRemovals);
+		PendingRemovals.Empty();
+		for (int32 Index : Removals)
+		{
+			ReleaseSlot(Index);
+		}
+	}
+
+private:
+	TArray<std::unique_ptr<FSlot[]>> Chunks;
+	TArray<int32> PendingRemovals;
+	int32 NumSlots = 0;
+	int32 NumBound = 0;
+	int32 FirstFree = -1;
+	int32 BroadcastDepth = 0;
+
+	inline static uint64 NumHeapBindings = 0;
 };
 
 // 델리게이트 인스턴스 생성용 매크로 (실제 멤버 변수 선언)
 #define DECLARE_DELEGATE(Name, ...)				TDelegate<__VA_ARGS__> Name
 #define DECLARE_DELEGATE_OneParam(Name, T1)		TDelegate<T1> Name
 #define DECLARE_DELEGATE_TwoParam(Name, T1, T2)	TDelegate<T1, T2> Name
-#define DECLARE_DYNAMIC_DELEGATE(Name, ...)		std::shared_ptr<TDelegate<__VA_ARGS__>> Name = std::make_shared<TDelegate<__VA_ARGS__>>();
+#define DECLARE_DYNAMIC_DELEGATE(Name, ...)		TDelegate<__VA_ARGS__> Name
 
 // 델리게이트 타입 정의용 매크로 (인스턴스 직접 선언해서 여러 군데에 재사용)
 #define DECLARE_DELEGATE_TYPE(Name, ...)          using Name = TDelegate<__VA_ARGS__>;
 #define DECLARE_DELEGATE_TYPE_OneParam(Name, T1)  using Name = TDelegate<T1>;
 #define DECLARE_DELEGATE_TYPE_TwoParam(Name, T1, T2) using Name = TDelegate<T1, T2>;
-#define DECLARE_DYNAMIC_DELEGATE_TYPE(Name, ...)  using Name = std::shared_ptr<TDelegate<__VA_ARGS__>>;
\ No newline at end of file
+#define DECLARE_DYNAMIC_DELEGATE_TYPE(Name, ...)  using Name = TDelegate<__VA_ARGS__>;
\ No newline at end of file
@@ -180,10 +180,12 @@ enum class EEngineShowFlags : uint64
     
     SF_Particle = 1ull << 20,
     SF_DOF = 1ull << 21,          // Enable/disable Depth of Field
+    SF_AutoInstancing = 1ull << 22, // 같은 스태틱 메시/머티리얼 드로우를 인스턴스 드로우로 합치기
+    SF_OcclusionCulling = 1ull << 23, // CPU 소프트웨어 오클루전 컬링 (가려진 스태틱 메시를 불투명 패스에서 제외)
 
     // Default enabled flags
     SF_DefaultEnabled = SF_Primitives | SF_StaticMeshes | SF_SkeletalMeshes | SF_Grid | SF_Lighting | SF_Decals |
-        SF_Fog | SF_FXAA | SF_Billboard | SF_EditorIcon | SF_Shadows | SF_ShadowAntiAliasing | SF_GPUSkinning | SF_Particle | SF_DOF,
+        SF_Fog | SF_FXAA | SF_Billboard | SF_EditorIcon | SF_Shadows | SF_ShadowAntiAliasing | SF_GPUSkinning | SF_Particle | SF_DOF | SF_AutoInstancing | SF_OcclusionCulling,
 
     // All flags (for initialization/reset)
     SF_All = 0xFFFFFFFFFFFFFFFFull
@@ -2,28 +2,50 @@
 
 #include "ObjectFactory.h"
 
+// TObject와 그 자식 클래스들의 오브젝트 목록만 순회 (전체 GUObjectArray를 훑지 않음)
+// 클래스 트리 전위 순서에서 [TreeIndex, TreeEnd) 구간이 TObject 계열 클래스들이다
+// 순회 중 현재 객체를 삭제해도 된다 (클래스 목록은 swap-remove이므로 같은 인덱스로 옮겨진 객체를 다시 방문)
+//
+// 순회 순서: 클래스 트리 전위 순 -> 클래스별 목록 순 (생성 순서가 아님)
+// - 클래스 목록은 생성 시 뒤에 추가되지만 삭제가 swap-remove이므로 삭제 이후에는 생성 순서가 깨진다
+// - "첫 번째로 찾은 객체"나 저장/복제 순서처럼 생성 순서가 필요하면 GUObjectArray를 인덱스 순으로 순회할 것
 template<typename TObject>
 class TObjectIterator
 {
 public:
 	TObjectIterator()
 	{
+		const UClass* BaseClass = TObject::StaticClass();
+		if (BaseClass->TreeIndex >= 0)
+		{
+			ClassIndex = BaseClass->TreeIndex;
+			ClassEnd = BaseClass->TreeEnd;
+		}
 		++(*this); // 첫 번째 유효 객체로 이동
 	}
 
 	// 다음 객체로 이동
 	TObjectIterator& operator++()
 	{
-		++CurrentIndex;
+		// 현재 객체가 삭제되어 자리에 다른 객체가 옮겨져 왔으면 인덱스를 유지
+		const TArray<UClass*>& Classes = UClass::GetClassesInTreeOrder();
+		const bool bCurrentRemoved = CurrentObject && ClassIndex < ClassEnd
+			&& ObjectIndex < Classes[ClassIndex]->Objects.Num()
+			&& Classes[ClassIndex]->Objects[ObjectIndex] != CurrentObject;
+		if (!bCurrentRemoved)
+		{
+			++ObjectIndex;
+		}
 		AdvanceToNextValidObject();
+		CurrentObject = (ClassIndex < ClassEnd) ? Classes[ClassIndex]->Objects[ObjectIndex] : nullptr;
 		return *this;
 	}
 
 	// 현재 객체에 접근
 	TObject* operator*() const
 	{
-		// 이 시점의 CurrentIndex는 유효한 TObject를 가리키고 있어야 함
-		return static_cast<TObject*>(GUObjectArray[CurrentIndex]);
+		// 이 시점의 ClassIndex/ObjectIndex는 유효한 TObject를 가리키고 있어야 함
+		return static_cast<TObject*>(UClass::GetClassesInTreeOrder()[ClassIndex]->Objects[ObjectIndex]);
 	}
 
 	// 현재 객체에 접근 (포인터 연산자)
@@ -35,34 +57,36 @@ public:
 	// 비교 연산자
 	bool operator!=(const TObjectIterator& Other) const
 	{
-		return CurrentIndex != Other.CurrentIndex;
+		return ClassIndex != Other.ClassIndex || ObjectIndex != Other.ObjectIndex;
 	}
 
 	// bool 변환 연산자
 	explicit operator bool() const
 	{
-		// CurrentIndex가 배열 범위 내에 있는지 확인
-		return CurrentIndex < GUObjectArray.Num();
+		return ClassIndex < ClassEnd;
 	}
 
 private:
-	// 현재 인덱스부터 시작하여 다음 유효 객체를 찾는 헬퍼 함수
+	// 현재 클래스 목록이 끝났으면 다음 (자식) 클래스 목록으로 넘어가는 헬퍼 함수
 	void AdvanceToNextValidObject()
 	{
-		while (CurrentIndex < GUObjectArray.Num())
+		const TArray<UClass*>& Classes = UClass::GetClassesInTreeOrder();
+		while (ClassIndex < ClassEnd)
 		{
-			UObject* Object = GUObjectArray[CurrentIndex];
-			// 현재 객체가 유효하고, TObject 타입이면 검색 종료
-			if (Object && Object->IsA<TObject>())
+			if (ObjectIndex < Classes[ClassIndex]->Objects.Num())
 			{
 				break;
 			}
 
-			// 다음 인덱스로 이동
-			++CurrentIndex;
+			// 다음 클래스로 이동
+			++ClassIndex;
+			ObjectIndex = 0;
 		}
 	}
 
 private:
-	int32 CurrentIndex = -1;
+	int32 ClassIndex = 0;
+	int32 ClassEnd = 0;
+	int32 ObjectIndex = -1;
+	UObject* CurrentObject = nullptr;	// 현재 인덱스에서 방문한 객체 (삭제 감지용)
 };
@@ -2,6 +2,10 @@
 #include "AIController.h"
 #include "Pawn.h"
 #include "Actor.h"
+#include "Character.h"
+#include "CharacterMovementComponent.h"
+#include "World.h"
+#include "Source/Runtime/Engine/Navigation/NavigationSystem.h"
 
 AAIController::AAIController()
 {
@@ -21,6 +25,12 @@ void AAIController::Tick(float DeltaSeconds)
         return;
     }
 
+    // 경로 추종 (MoveTo 호출 시에만)
+    if (bIsMoving)
+    {
+        UpdatePathFollowing(DeltaSeconds);
+    }
+
     //// 이동 처리
     //if (bIsMoving)
     //{
@@ -53,6 +63,7 @@ void AAIController::MoveToActor(AActor* Goal, float InAcceptanceRadius)
     AcceptanceRadius = InAcceptanceRadius;
     bIsMoving = true;
     bHasMoveGoal = true;
+    RequestPathTo(MoveDestination);
 }
 
 void AAIController::MoveToLocation(const FVector& Location, float InAcceptanceRadius)
@@ -61,12 +72,108 @@ void AAIController::MoveToLocation(const FVector& Location, float InAcceptanceRa
     AcceptanceRadius = InAcceptanceRadius;
     bIsMoving = true;
     bHasMoveGoal = true;
+    RequestPathTo(MoveDestination);
 }
 
 void AAIController::StopMovement()
 {
     bIsMoving = false;
     bHasMoveGoal = false;
+
+    if (PathRequest)
+    {
+        if (FNavigationSystem* Nav = GetNavigationSystem())
+        {
+            Nav->CancelPath(PathRequest);
+        }
+        PathRequest = FNavPathHandle();
+    }
+    if (UCharacterMovementComponent* Movement = GetCharacterMovement())
+    {
+        Movement->StopPathFollowing();
+    }
+    CurrentPath.Reset();
+    bHasPathGoal = false;
+}
+
+void AAIController::RequestPathTo(const FVector& Goal)
+{
+    FNavigationSystem* Nav = GetNavigationSystem();
+    if (!bUseNavigation || !Nav || !Pawn)
+    {
+        return;
+    }
+
+    // 매 Tick MoveTo를 불러도 목표가 거의 그대로면 진행 중인 요청/경로를 유지
+    if (bHasPathGoal && (Goal - PathGoal).SizeSquared() < RepathDistance * RepathDistance)
+    {
+        return;
+    }
+
+    if (PathRequest)
+    {
+        Nav->CancelPath(PathRequest);
+    }
+
+    PathGoal = Goal;
+    bHasPathGoal = true;
+    PathRequest = Nav->RequestPath(Pawn->GetActorLocation(), Goal, CurrentPath.IsValid() ? &CurrentPath : nullptr);
+}
+
+void AAIController::UpdatePathFollowing(float DeltaTime)
+{
+    FNavigationSystem* Nav = GetNavigationSystem();
+    UCharacterMovementComponent* Movement = GetCharacterMovement();
+    if (!bUseNavigation || !Nav || !Movement || !bHasPathGoal)
+    {
+        UpdateMovement(DeltaTime);
+        return;
+    }
+
+    // 새 경로가 나올 때까지는 이전 경로를 계속 따라간다
+    if (PathRequest)
+    {
+        const ENavPathStatus Status = Nav->GetPathStatus(PathRequest);
+        if (Status == ENavPathStatus::Succeeded || Status == ENavPathStatus::Failed)
+        {
+            FNavPath NewPath;
+            const bool bFound = Nav->ConsumePath(PathRequest, NewPath);
+            PathRequest = FNavPathHandle();
+
+            if (!bFound)
+            {
+                StopMovement();
+                OnMoveCompleted(false);
+                return;
+            }
+
+            CurrentPath = std::move(NewPath);
+            Movement->FollowPath(CurrentPath.Points, AcceptanceRadius);
+        }
+        else if (Status == ENavPathStatus::Invalid)
+        {
+            PathRequest = FNavPathHandle();
+        }
+    }
+
+    if (!PathRequest && Movement->HasReachedPathEnd())
+    {
+        const bool bSuccess = !CurrentPath.bPartial;
+        StopMovement();
+        OnMoveCompleted(bSuccess);
+    }
+}
+
+FNavigationSystem* AAIController::GetNavigationSystem() const
+{
+    UWorld* World = GetWorld();
+    return World ? World->GetNavigationSystem() : nullptr;
+}
+
+UCharacterMovementComponent* AAIController::GetCharacterMovement() const
+{
+    ACharacter* Character = Cast<ACharacter>(Pawn);
+    return Character ? Character->GetCharacterMovement() : nullptr;
 }
 
 void AAIController::UpdateMovement(float DeltaTime)
@@ -90,8 +197,14 @@ void AAIController::UpdateMovement(float DeltaTime)
         return;
     }
 
-    // 이동
+    // 이동: 캐릭터면 이동 입력으로 넘겨 CharacterMovement가 충돌/중력을 처리
     Direction = Direction.GetNormalized();
+    if (GetCharacterMovement())
+    {
+        Pawn->AddMovementInput(Direction);
+        return;
+    }
+
     FVector NewLocation = CurrentLocation + Direction * MoveSpeed * DeltaTime;
     Pawn->SetActorLocation(NewLocation);
 }
@@ -1,9 +1,12 @@
 #pragma once
 
 #include "Controller.h"
+#include "Source/Runtime/Engine/Navigation/NavPathQueryService.h"
 #include "AAIController.generated.h"
 
 class APawn;
+class FNavigationSystem;
+class UCharacterMovementComponent;
 
 // ============================================================================
 // AAIController - AI 컨트롤러 베이스 클래스
@@ -71,6 +74,15 @@ protected:
     void UpdateMovement(float DeltaTime);
     void UpdateRotation(float DeltaTime);
 
+    /** 내비메시 경로 요청 (목표가 RepathDistance 이상 움직였을 때만 다시 요청) */
+    void RequestPathTo(const FVector& Goal);
+
+    /** 완료된 경로를 CharacterMovement에 넘기고 도착을 판정, 내비게이션이 없으면 직선 이동 */
+    void UpdatePathFollowing(float DeltaTime);
+
+    FNavigationSystem* GetNavigationSystem() const;
+    UCharacterMovementComponent* GetCharacterMovement() const;
+
 protected:
     // ========== AI 상태 ==========
     UPROPERTY(EditAnywhere, Category = "AI")
@@ -93,6 +105,18 @@ protected:
     bool bIsMoving = false;
     bool bHasMoveGoal = false;
 
+    // ========== 경로 탐색 ==========
+    UPROPERTY(EditAnywhere, Category = "Navigation")
+    bool bUseNavigation = true;
+
+    UPROPERTY(EditAnywhere, Category = "Navigation")
+    float RepathDistance = 1.f;
+
+    FNavPathHandle PathRequest;
+    FNavPath CurrentPath;           // 다음 요청에 넘겨 통로 재사용
+    FVector PathGoal = FVector();
+    bool bHasPathGoal = false;
+
     // ========== 회전 ==========
     FVector FocusLocation = FVector();
     bool bHasFocusPoint = false;
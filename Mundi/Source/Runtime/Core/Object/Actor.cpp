@@ -610,6 +610,8 @@ void AActor::DuplicateSubObjects()
 	// ========================================================================
 	TMap<UActorComponent*, UActorComponent*> OldToNewComponentMap;
 	TSet<UActorComponent*> NewOwnedComponents;
+	OldToNewComponentMap.reserve(OwnedComponents.Num());
+	NewOwnedComponents.reserve(OwnedComponents.Num());
 
 	for (UActorComponent* OriginalComp : OwnedComponents)
 	{
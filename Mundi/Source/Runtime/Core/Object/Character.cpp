@@ -259,10 +259,14 @@ void ACharacter::EnableWeaponCollision(bool bEnable)
 	// CapsuleComponent의 PhysX 기반 트리거 충돌 사용
 	WeaponCollider->EnableTriggerCollision(bEnable);
 
+	// 이전 바인딩 해제 (다른 리스너의 바인딩은 유지, 반복 활성화 시 중복 바인딩 방지)
+	WeaponCollider->OnTriggerHit.Remove(WeaponTriggerHandle);
+	WeaponTriggerHandle.Reset();
+
 	if (bEnable)
 	{
-		// 델리게이트 바인딩
-		WeaponCollider->OnTriggerHit.Add(
+		// 델리게이트 바인딩 (캐릭터가 삭제되면 자동 해제)
+		WeaponTriggerHandle = WeaponCollider->OnTriggerHit.AddWeakLambda(this,
 			[this](AActor* OtherActor, const FVector& HitLocation)
 			{
 				if (OtherActor && OtherActor != this)
@@ -271,11 +275,6 @@ void ACharacter::EnableWeaponCollision(bool bEnable)
 				}
 			});
 	}
-	else
-	{
-		// 델리게이트 해제
-		WeaponCollider->OnTriggerHit.Clear();
-	}
 }
 
 void ACharacter::OnWeaponOverlap(AActor* OtherActor, const FVector& HitLocation)
@@ -42,6 +42,7 @@ public:
 
 	/** 무기 충돌 컴포넌트 (칼날 히트박스) */
 	UCapsuleComponent* WeaponCollider = nullptr;
+	FDelegateHandle WeaponTriggerHandle;	// WeaponCollider->OnTriggerHit 바인딩
 
 	
 	/** 무기가 부착될 본 이름 */
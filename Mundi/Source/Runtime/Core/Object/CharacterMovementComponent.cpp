@@ -57,6 +57,10 @@ void UCharacterMovementComponent::TickComponent(float DeltaSeconds)
 	// 입력 소비 및 정규화
 	FVector FrameInputVector = CharacterOwner->ConsumeMovementInputVector();
 	FrameInputVector.Z = 0.0f;
+	if (FrameInputVector.IsZero() && IsFollowingPath())
+	{
+		FrameInputVector = ComputePathFollowingInput();
+	}
 	if (!FrameInputVector.IsZero())
 	{
 		FrameInputVector.Normalize();
@@ -98,6 +102,49 @@ void UCharacterMovementComponent::SetSprinting(bool bSprint)
 	TargetWalkSpeed = bSprint ? SprintWalkSpeed : DefaultWalkSpeed;
 }
 
+void UCharacterMovementComponent::FollowPath(const TArray<FVector>& InPathPoints, float InAcceptanceRadius)
+{
+	PathPoints = InPathPoints;
+	PathAcceptanceRadius = InAcceptanceRadius;
+	bPathEndReached = false;
+
+	// 첫 점은 시작 위치이므로 바로 다음 점부터 따라간다
+	PathPointIndex = PathPoints.Num() > 1 ? 1 : 0;
+}
+
+void UCharacterMovementComponent::StopPathFollowing()
+{
+	PathPoints.Empty();
+	PathPointIndex = 0;
+	bPathEndReached = false;
+}
+
+FVector UCharacterMovementComponent::ComputePathFollowingInput()
+{
+	const FVector Location = UpdatedComponent->GetWorldLocation();
+
+	// 수평 거리로 도착 판정 (바닥 높이와 캡슐 중심 높이가 다르므로 Z는 무시)
+	while (PathPointIndex < PathPoints.Num())
+	{
+		FVector ToTarget = PathPoints[PathPointIndex] - Location;
+		ToTarget.Z = 0.0f;
+
+		const bool bLastPoint = PathPointIndex == PathPoints.Num() - 1;
+		const float Radius = bLastPoint ? PathAcceptanceRadius : FMath::Max(PathAcceptanceRadius * 0.5f, 0.1f);
+		if (ToTarget.SizeSquared() > Radius * Radius)
+		{
+			return ToTarget.GetNormalized();
+		}
+
+		++PathPointIndex;
+		if (bLastPoint)
+		{
+			bPathEndReached = true;
+		}
+	}
+	return FVector::Zero();
+}
+
 void UCharacterMovementComponent::PhysWalking(float DeltaSecond, const FVector& InputVector)
 {
 	// 입력 벡터는 TickComponent에서 이미 정규화되어 전달됨
@@ -44,6 +44,12 @@ public:
 	// 달리기 상태 설정
 	void SetSprinting(bool bSprint);
 
+	// 경로 추종 (AI): 이번 프레임 이동 입력이 없을 때 다음 꺾임점 방향으로 걷는다
+	void FollowPath(const TArray<FVector>& InPathPoints, float InAcceptanceRadius);
+	void StopPathFollowing();
+	bool IsFollowingPath() const { return PathPointIndex < PathPoints.Num(); }
+	bool HasReachedPathEnd() const { return bPathEndReached; }
+
 protected:
 	void PhysWalking(float DeltaSecond, const FVector& InputVector);
 	void PhysFalling(float DeltaSecond);
@@ -86,10 +92,19 @@ protected:
 	 */
 	bool ResolveOverlaps();
 
+	/** 경로 추종 입력 (도착한 꺾임점은 건너뛴다), 경로가 없으면 Zero */
+	FVector ComputePathFollowingInput();
+
 protected:
 	ACharacter* CharacterOwner = nullptr;
 	bool bIsFalling = false;
 
+	// 경로 추종 상태
+	TArray<FVector> PathPoints;
+	int32 PathPointIndex = 0;
+	float PathAcceptanceRadius = 0.5f;
+	bool bPathEndReached = false;
+
 	const float GLOBAL_GRAVITY_Z = -9.8f;
 	const float GravityScale = 1.0f;
 };
@@ -10,6 +10,81 @@ FString UObject::GetComparisonName()
     return FString();
 }
 
+UClass* UClass::FindClass(const FName& InClassName)
+{
+    // 이름 -> 클래스 맵은 첫 조회 시(또는 클래스가 추가된 뒤) 한 번만 구성
+    static TMap<FName, UClass*> ClassMap;
+    if (bClassMapDirty)
+    {
+        ClassMap.clear();
+        for (UClass* Class : GetAllClasses())
+        {
+            if (Class)
+            {
+                ClassMap.emplace(FName(Class->Name), Class);
+            }
+        }
+        bClassMapDirty = false;
+    }
+
+    auto It = ClassMap.find(InClassName);
+    return It != ClassMap.end() ? It->second : nullptr;
+}
+
+void UClass::RebuildClassTree()
+{
+    // UObject는 SignUpClass를 거치지 않으므로 루트로 직접 넣는다
+    UClass* RootClass = UObject::StaticClass();
+
+    TMap<const UClass*, TArray<UClass*>> Children;
+    TArray<UClass*> Roots;
+    Roots.Add(RootClass);
+    for (UClass* Class : GetAllClasses())
+    {
+        if (!Class || Class == RootClass) continue;
+
+        if (Class->Super) Children[Class->Super].Add(Class);
+        else              Roots.Add(Class);
+    }
+
+    TArray<UClass*>& TreeOrder = GetClassesInTreeOrder();
+    TreeOrder.clear();
+
+    // 반복 DFS: 진입 시 TreeIndex, 서브트리를 모두 방문한 뒤 TreeEnd
+    struct FVisit
+    {
+        UClass* Class;
+        bool bExit;
+    };
+    TArray<FVisit> Stack;
+    for (int32 i = Roots.Num() - 1; i >= 0; --i)
+    {
+        Stack.Add({ Roots[i], false });
+    }
+
+    while (!Stack.IsEmpty())
+    {
+        const FVisit Visit = Stack.Pop();
+        if (Visit.bExit)
+        {
+            Visit.Class->TreeEnd = TreeOrder.Num();
+            continue;
+        }
+
+        Visit.Class->TreeIndex = TreeOrder.Num();
+        TreeOrder.Add(Visit.Class);
+        Stack.Add({ Visit.Class, true });
+
+        if (TArray<UClass*>* ChildList = Children.Find(Visit.Class))
+        {
+            for (int32 i = ChildList->Num() - 1; i >= 0; --i)
+            {
+                Stack.Add({ (*ChildList)[i], false });
+            }
+        }
+    }
+}
+
 // 리플렉션 기반 자동 직렬화 (현재 클래스의 프로퍼티만 처리)
 void UObject::Serialize(const bool bInIsLoading, JSON& InOutHandle)
 {
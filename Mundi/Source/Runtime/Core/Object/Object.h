@@ -29,6 +29,13 @@ struct UClass
     mutable TArray<FProperty> CachedAllProperties;  // GetAllProperties() 캐시 (성능 최적화)
     mutable bool bAllPropertiesCached = false;      // 캐시 유효성 플래그
 
+    // 클래스 트리 전위 순회 번호, [TreeIndex, TreeEnd) 구간이 자신과 모든 자식 클래스 (IsChildOf O(1) 판정)
+    int32 TreeIndex = -1;
+    int32 TreeEnd = -1;
+
+    // 정확히 이 클래스인 살아있는 오브젝트 목록 (ObjectFactory가 생성/삭제 시 관리, TObjectIterator용)
+    TArray<UObject*> Objects;
+
     constexpr UClass() = default;
     constexpr UClass(const char* n, const UClass* s, SIZE_T z)
         :Name(n), Super(s), Size(z)
@@ -37,6 +44,11 @@ struct UClass
     bool IsChildOf(const UClass* Base) const noexcept
     {
         if (!Base) return false;
+        if (TreeIndex >= 0 && Base->TreeIndex >= 0)
+        {
+            return Base->TreeIndex <= TreeIndex && TreeIndex < Base->TreeEnd;
+        }
+        // 트리에 아직 편입되지 않은 클래스 (등록 이전)
         for (auto c = this; c; c = c->Super)
             if (c == Base) return true;
         return false;
@@ -48,25 +60,27 @@ struct UClass
         return AllClasses;
     }
 
+    // 클래스 트리 전위 순회 순서, 인덱스가 TreeIndex와 같다
+    static TArray<UClass*>& GetClassesInTreeOrder()
+    {
+        static TArray<UClass*> TreeOrder;
+        return TreeOrder;
+    }
+
     static void SignUpClass(UClass* InClass)
     {
         if (InClass)
         {
             GetAllClasses().emplace_back(InClass);
+            RebuildClassTree();
+            bClassMapDirty = true;
         }
     }
-    static UClass* FindClass(const FName& InClassName)
-    {
-        for (UClass* Class : GetAllClasses())
-        {
-            if (Class && InClassName == Class->Name)
-            {
-                return Class;
-            }
-        }
 
-        return nullptr;
-    }
+    static UClass* FindClass(const FName& InClassName);
+
+    // 등록된 모든 클래스(+UObject)의 TreeIndex/TreeEnd 재계산, 클래스 등록 시 호출
+    static void RebuildClassTree();
 
     // 리플렉션 시스템 메서드
     // 주의: 프로퍼티는 static 초기화 시점에만 등  록되며, 런타임 중 추가/삭제 불가
@@ -150,6 +164,9 @@ public:
         }
         return Result;
     }
+
+private:
+    inline static bool bClassMapDirty = true;   // FindClass 이름 맵 재구성 필요 여부
 };
 
 class UObject
@@ -3,6 +3,74 @@
 // 전역 오브젝트 배열 정의 (한 번만!)
 TArray<UObject*> GUObjectArray;
 
+namespace
+{
+    // GUObjectArray와 같은 인덱스를 쓰는 슬롯 정보
+    struct FObjectSlot
+    {
+        UClass* Class = nullptr;
+        int32 ClassListIndex = -1;  // Class->Objects 내 위치 (삭제 시 swap-remove)
+    };
+
+    TArray<FObjectSlot> GObjectSlots;
+    TArray<int32> GFreeObjectSlots;             // 비어 있는 GUObjectArray 인덱스 (재사용해서 배열을 조밀하게 유지)
+    TMap<UObject*, int32> GObjectIndexMap;      // 역참조 없이 관리 중인 오브젝트인지 확인
+    int32 GNumLiveObjects = 0;                  // 빈 슬롯 재사용으로 GUObjectArray.Num()은 개수가 아니므로 따로 센다
+
+    // 0번 슬롯은 피킹에서 "없음"으로 쓰이므로 빈 슬롯이 되어도 재사용하지 않는다
+    constexpr int32 ReservedObjectSlot = 0;
+
+    int32 RegisterObject(UObject* Obj)
+    {
+        int32 Index = -1;
+        if (!GFreeObjectSlots.IsEmpty())
+        {
+            Index = GFreeObjectSlots.Pop();
+            GUObjectArray[Index] = Obj;
+        }
+        else
+        {
+            Index = GUObjectArray.Add(Obj);
+            GObjectSlots.Add(FObjectSlot());
+        }
+
+        UClass* Class = Obj->GetClass();
+        FObjectSlot& Slot = GObjectSlots[Index];
+        Slot.Class = Class;
+        Slot.ClassListIndex = Class->Objects.Num();
+        Class->Objects.Add(Obj);
+
+        GObjectIndexMap[Obj] = Index;
+        ++GNumLiveObjects;
+        Obj->InternalIndex = static_cast<uint32>(Index);
+        return Index;
+    }
+
+    void UnregisterObject(int32 Index)
+    {
+        FObjectSlot& Slot = GObjectSlots[Index];
+        if (Slot.Class)
+        {
+            // 클래스 목록의 마지막 오브젝트를 빈 자리로 옮긴다 (마지막 오브젝트는 살아있으므로 역참조 가능)
+            TArray<UObject*>& Objects = Slot.Class->Objects;
+            UObject* LastObject = Objects.Last();
+            Objects[Slot.ClassListIndex] = LastObject;
+            GObjectSlots[LastObject->InternalIndex].ClassListIndex = Slot.ClassListIndex;
+            Objects.Pop();
+        }
+
+        GObjectIndexMap.Remove(GUObjectArray[Index]);
+        GUObjectArray[Index] = nullptr;
+        --GNumLiveObjects;
+        Slot = FObjectSlot();
+
+        if (Index != ReservedObjectSlot)
+        {
+            GFreeObjectSlots.Add(Index);
+        }
+    }
+}
+
 namespace ObjectFactory
 {
     TMap<UClass*, ConstructFunc>& GetRegistry()
@@ -29,11 +97,7 @@ namespace ObjectFactory
         UObject* Obj = ConstructObject(Class);
         if (!Obj) return nullptr;
 
-        int32 idx = -1;
-
-        idx = GUObjectArray.Add(Obj);
-
-        Obj->InternalIndex = static_cast<uint32>(idx);
+        RegisterObject(Obj);
 
         static TMap<UClass*, int> NameCounters;
         int Count = ++NameCounters[Class];
@@ -55,53 +119,62 @@ namespace ObjectFactory
         if (!Obj) return nullptr;
 
         // 배열에 등록: 빈 슬롯 재사용
-        int32 idx = -1;
+        RegisterObject(Obj);
 
-        idx = GUObjectArray.Add(Obj);
-        //}
-        Obj->InternalIndex = static_cast<uint32>(idx);
-
-        static TMap<UClass*, int> NameCounters;
-        int Count = ++NameCounters[Class];
-
-        // NOTE: 복제 시 이름을 그대로 유지
-        //const std::string base = Class->Name; // FName -> string
-        //std::string unique;
-        //unique.reserve(base.size() + 1 + 12);            // "_" + 최대 10~12자리 여유
-        //unique.append(base);
-        //unique.push_back('_');
-        //unique.append(std::to_string(Count));
-
-        //Obj->ObjectName = FName(unique);
+        // NOTE: 복제 시 이름을 그대로 유지 (이름 카운터 조회 없음)
 
         return Obj;
     }
 
+    void ReserveObjects(int32 NumAdditional)
+    {
+        const int32 NumNewSlots = NumAdditional - GFreeObjectSlots.Num();
+        if (NumNewSlots <= 0) return;
+        GUObjectArray.Reserve(GUObjectArray.Num() + NumNewSlots);
+        GObjectSlots.Reserve(GObjectSlots.Num() + NumNewSlots);
+    }
+
     void DeleteObject(UObject* Obj)
     {
         if (!Obj) return;
 
         // Important: DO NOT dereference Obj fields before verifying it is still in GUObjectArray.
-        int32 FoundIndex = -1;
-        for (int32 i = 0; i < GUObjectArray.Num(); ++i)
-        {
-            if (GUObjectArray[i] == Obj)
-            {
-                FoundIndex = i;
-                break;
-            }
-        }
-        if (FoundIndex < 0)
+        auto It = GObjectIndexMap.find(Obj);
+        if (It == GObjectIndexMap.end())
         {
             // Not managed or already deleted.
             return;
         }
 
-        GUObjectArray[FoundIndex] = nullptr;
+        UnregisterObject(It->second);
         // Safe to delete now; Obj still valid since we found it in GUObjectArray
         Obj->DestroyInternal();
     }
 
+    int32 GetNumLiveObjects()
+    {
+        return GNumLiveObjects;
+    }
+
+    bool IsObjectAlive(const UObject* Obj, uint32 UUID, uint32& InOutIndexHint)
+    {
+        if (!Obj) return false;
+
+        // 빠른 경로: 인덱스 슬롯에 같은 포인터가 있으면 살아있는 오브젝트이므로 역참조 가능
+        if (InOutIndexHint < static_cast<uint32>(GUObjectArray.Num()) && GUObjectArray[InOutIndexHint] == Obj)
+        {
+            return Obj->UUID == UUID;
+        }
+
+        auto It = GObjectIndexMap.find(const_cast<UObject*>(Obj));
+        if (It == GObjectIndexMap.end())
+        {
+            return false;
+        }
+        InOutIndexHint = static_cast<uint32>(It->second);
+        return Obj->UUID == UUID;
+    }
+
     void DeleteAll(bool bCallBeginDestroy)
     {
         // 실제 삭제 (역순 안전)
@@ -114,6 +187,14 @@ namespace ObjectFactory
         }
         GUObjectArray.Empty();
         GUObjectArray.Shrink();
+        GObjectSlots.Empty();
+        GFreeObjectSlots.Empty();
+        GObjectIndexMap.Empty();
+        GNumLiveObjects = 0;
+        for (UClass* Class : UClass::GetClassesInTreeOrder())
+        {
+            Class->Objects.Empty();
+        }
     }
 
     // (선택) null 슬롯 압축
@@ -127,6 +208,8 @@ namespace ObjectFactory
                 if (write != read)
                 {
                     GUObjectArray[write] = Obj;
+                    GObjectSlots[write] = GObjectSlots[read];
+                    GObjectIndexMap[Obj] = write;
                     Obj->InternalIndex = static_cast<uint32>(write);
                     GUObjectArray[read] = nullptr;
                 }
@@ -135,5 +218,7 @@ namespace ObjectFactory
         }
         // 크기(Num) 축소 + 불필요한 capacity도 반환
         GUObjectArray.SetNum(write);
+        GObjectSlots.SetNum(write);
+        GFreeObjectSlots.Empty();
     }
 }
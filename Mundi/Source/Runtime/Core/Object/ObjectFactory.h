@@ -34,6 +34,9 @@ namespace ObjectFactory
     // 4) GUObjectArray 자동 등록
     UObject* AddToGUObjectArray(UClass* Class, UObject* Obj);
 
+    // 대량 생성/복제 전에 GUObjectArray 용량을 미리 확보 (PIE 월드 복제 등)
+    void ReserveObjects(int32 NumAdditional);
+
     // 5) 복사생성자 호출 + GUObjectArray 자동 등록
     template<class T>
     inline T* DuplicateObject(const UObject* Source)
@@ -44,10 +47,15 @@ namespace ObjectFactory
 
     // 개별 삭제(단일 소유자: Factory)
     void DeleteObject(UObject* Obj);
+    // Obj가 아직 삭제되지 않았는지 확인 (Obj를 먼저 역참조하지 않음, 같은 주소에 새로 생긴 오브젝트는 UUID로 구분)
+    // InOutIndexHint: 마지막으로 확인된 GUObjectArray 인덱스, 슬롯 압축으로 바뀌었으면 갱신
+    bool IsObjectAlive(const UObject* Obj, uint32 UUID, uint32& InOutIndexHint);
     // 종료시 일괄 정리
     void DeleteAll(bool bCallBeginDestroy = true);
     // Null 슬롯 압축하여 배열 크기 축소
     void CompactNullSlots();
+    // 등록된(삭제되지 않은) 오브젝트 수
+    int32 GetNumLiveObjects();
 }
 
 // ── 등록 매크로 ─────────────────────────────────────────────
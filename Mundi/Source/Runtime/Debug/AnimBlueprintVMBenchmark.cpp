@@ -0,0 +1,207 @@
+﻿#include "pch.h"
+#include "AnimBlueprintVMBenchmark.h"
+#include "BenchmarkHarness.h"
+#include "Source/Editor/BlueprintGraph/BlueprintBytecode.h"
+#include "Source/Editor/BlueprintGraph/BlueprintEvaluator.h"
+#include "Source/Editor/BlueprintGraph/K2Node_Animation.h"
+#include "Source/Editor/BlueprintGraph/K2Node_CharacterMovement.h"
+#include "Source/Editor/BlueprintGraph/K2Node_Expression.h"
+#include "Source/Editor/BlueprintGraph/K2Node_Literal.h"
+#include "Source/Editor/BlueprintGraph/K2Node_Math.h"
+#include "Source/Editor/BlueprintGraph/K2Node_Misc.h"
+#include "Source/Runtime/Engine/Animation/AnimInstance.h"
+
+namespace
+{
+	struct FBenchGraph
+	{
+		TArray<UEdGraphNode*> Nodes;
+		TArray<UEdGraphPin*> Conditions;	// 전이 노드의 "Can Transition" 입력 핀
+	};
+
+	template <typename T>
+	T* AddNode(FBenchGraph& Graph)
+	{
+		T* Node = NewObject<T>();
+		Node->AllocateDefaultPins();
+		Graph.Nodes.Add(Node);
+		return Node;
+	}
+
+	void Link(UEdGraphNode* From, const char* OutputPin, UEdGraphNode* To, const char* InputPin)
+	{
+		From->FindPin(OutputPin, EEdGraphPinDirection::EGPD_Output)->MakeLinkTo(To->FindPin(InputPin, EEdGraphPinDirection::EGPD_Input));
+	}
+
+	// Legacy 평가기는 빈 기본값에서 예외가 나므로 연결되지 않은 숫자 핀은 채운다
+	void SetDefault(UEdGraphNode* Node, const char* InputPin, const char* Value)
+	{
+		Node->FindPin(InputPin, EEdGraphPinDirection::EGPD_Input)->DefaultValue = Value;
+	}
+
+	void AddCondition(FBenchGraph& Graph, UEdGraphNode* Source, const char* OutputPin)
+	{
+		UK2Node_AnimTransition* Transition = AddNode<UK2Node_AnimTransition>(Graph);
+		Link(Source, OutputPin, Transition, "Can Transition");
+		Graph.Conditions.Add(Transition->FindPin("Can Transition", EEdGraphPinDirection::EGPD_Input));
+	}
+
+	void BuildLocomotionGraph(FBenchGraph& Graph)
+	{
+		UK2Node_GetSpeed* Speed = AddNode<UK2Node_GetSpeed>(Graph);
+		UK2Node_GetIsFalling* Falling = AddNode<UK2Node_GetIsFalling>(Graph);
+		UK2Node_GetLocalVelocity* LocalVelocity = AddNode<UK2Node_GetLocalVelocity>(Graph);
+		UK2Node_GetMousePosition* Mouse = AddNode<UK2Node_GetMousePosition>(Graph);
+		UK2Node_IsPressed* Jump = AddNode<UK2Node_IsPressed>(Graph);
+		UK2Node_Literal_Float* RunSpeed = AddNode<UK2Node_Literal_Float>(Graph);
+		RunSpeed->Value = 300.0f;
+
+		// Idle -> Walk : Speed > 10 && !Falling
+		UK2Node_Greater_FloatFloat* IsMoving = AddNode<UK2Node_Greater_FloatFloat>(Graph);
+		Link(Speed, "Speed", IsMoving, "A");
+		SetDefault(IsMoving, "B", "10.0");
+		UK2Node_Not_Bool* NotFalling = AddNode<UK2Node_Not_Bool>(Graph);
+		Link(Falling, "Is Falling", NotFalling, "A");
+		UK2Node_And_BoolBool* StartWalk = AddNode<UK2Node_And_BoolBool>(Graph);
+		Link(IsMoving, "Result", StartWalk, "A");
+		Link(NotFalling, "Result", StartWalk, "B");
+		AddCondition(Graph, StartWalk, "Result");
+
+		// Walk -> Idle : !(Speed > 10) (IsMoving 공유)
+		UK2Node_Not_Bool* Stopped = AddNode<UK2Node_Not_Bool>(Graph);
+		Link(IsMoving, "Result", Stopped, "A");
+		AddCondition(Graph, Stopped, "Result");
+
+		// Walk -> Run : Speed > RunSpeed
+		UK2Node_Greater_FloatFloat* IsRunning = AddNode<UK2Node_Greater_FloatFloat>(Graph);
+		Link(Speed, "Speed", IsRunning, "A");
+		Link(RunSpeed, "Value", IsRunning, "B");
+		AddCondition(Graph, IsRunning, "Result");
+
+		// Run -> Walk : !(Speed > RunSpeed)
+		UK2Node_Not_Bool* StopRunning = AddNode<UK2Node_Not_Bool>(Graph);
+		Link(IsRunning, "Result", StopRunning, "A");
+		AddCondition(Graph, StopRunning, "Result");
+
+		// Any -> Jump : Falling || Space
+		UK2Node_Or_BoolBool* StartJump = AddNode<UK2Node_Or_BoolBool>(Graph);
+		Link(Falling, "Is Falling", StartJump, "A");
+		Link(Jump, "Result", StartJump, "B");
+		AddCondition(Graph, StartJump, "Result");
+
+		// Strafe : Select(MouseX > 960, LocalX, LocalY * 2) > RunSpeed / 4 && (3 + 2 == 5)
+		UK2Node_Greater_FloatFloat* MouseRight = AddNode<UK2Node_Greater_FloatFloat>(Graph);
+		Link(Mouse, "X", MouseRight, "A");
+		SetDefault(MouseRight, "B", "960.0");
+		UK2Node_Multiply_FloatFloat* Forward = AddNode<UK2Node_Multiply_FloatFloat>(Graph);
+		Link(LocalVelocity, "Y", Forward, "A");
+		SetDefault(Forward, "B", "2.0");
+		UK2Node_Select_Float* Lateral = AddNode<UK2Node_Select_Float>(Graph);
+		Link(MouseRight, "Result", Lateral, "Condition");
+		Link(LocalVelocity, "X", Lateral, "TrueValue");
+		Link(Forward, "Result", Lateral, "FalseValue");
+		UK2Node_Divide_FloatFloat* Threshold = AddNode<UK2Node_Divide_FloatFloat>(Graph);
+		Link(RunSpeed, "Value", Threshold, "A");
+		SetDefault(Threshold, "B", "4.0");
+		UK2Node_Greater_FloatFloat* IsStrafing = AddNode<UK2Node_Greater_FloatFloat>(Graph);
+		Link(Lateral, "Result", IsStrafing, "A");
+		Link(Threshold, "Result", IsStrafing, "B");
+		UK2Node_Add_IntInt* Sum = AddNode<UK2Node_Add_IntInt>(Graph);
+		SetDefault(Sum, "A", "3");
+		SetDefault(Sum, "B", "2");
+		UK2Node_Equal_IntInt* SumCheck = AddNode<UK2Node_Equal_IntInt>(Graph);
+		Link(Sum, "Result", SumCheck, "A");
+		SetDefault(SumCheck, "B", "5");
+		UK2Node_And_BoolBool* Strafe = AddNode<UK2Node_And_BoolBool>(Graph);
+		Link(IsStrafing, "Result", Strafe, "A");
+		Link(SumCheck, "Result", Strafe, "B");
+		AddCondition(Graph, Strafe, "Result");
+	}
+}
+
+void FAnimBlueprintVMBenchmark::Run(int32 NumInstances, int32 NumFrames)
+{
+	if (NumInstances <= 0 || NumFrames <= 0)
+	{
+		return;
+	}
+
+	FBenchGraph Graph;
+	BuildLocomotionGraph(Graph);
+	const int32 NumConditions = Graph.Conditions.Num();
+
+	TArray<UAnimInstance*> Instances = FBenchmarkHarness::CreateObjects<UAnimInstance>(NumInstances);
+	TArray<FBlueprintContext> Contexts;
+	Contexts.Reserve(NumInstances);
+	for (UAnimInstance* Instance : Instances)
+	{
+		Contexts.Add(FBlueprintContext(Instance));
+	}
+
+	// FAnimBlueprintCompiler::Compile과 같이 인스턴스마다 조건별 프로그램 컴파일
+	TArray<FBlueprintProgram> Programs;
+	Programs.resize(NumInstances * NumConditions);
+	int32 NumCompileFailures = 0;
+	FScopeCycleCounter CompileCounter;
+	for (int32 i = 0; i < NumInstances; ++i)
+	{
+		for (int32 c = 0; c < NumConditions; ++c)
+		{
+			if (!FBlueprintExpressionCompiler::Compile(Graph.Conditions[c], EBlueprintRegisterType::Bool, Programs[i * NumConditions + c]))
+			{
+				++NumCompileFailures;
+			}
+		}
+	}
+	const double CompileMs = CompileCounter.Finish();
+
+	int32 Sink = 0;
+
+	const FBenchTiming Legacy = FBenchmarkHarness::MeasureFrames(NumFrames, [&](int32)
+	{
+		for (int32 i = 0; i < NumInstances; ++i)
+		{
+			for (int32 c = 0; c < NumConditions; ++c)
+			{
+				Sink += FBlueprintEvaluator::EvaluateInput<bool>(Graph.Conditions[c], &Contexts[i]) ? 1 : 0;
+			}
+		}
+	});
+
+	const FBenchTiming Bytecode = FBenchmarkHarness::MeasureFrames(NumFrames, [&](int32)
+	{
+		for (int32 i = 0; i < NumInstances; ++i)
+		{
+			for (int32 c = 0; c < NumConditions; ++c)
+			{
+				Sink += Programs[i * NumConditions + c].ExecuteBool(&Contexts[i]) ? 1 : 0;
+			}
+		}
+	});
+
+	int32 NumMismatches = 0;
+	for (int32 i = 0; i < NumInstances; ++i)
+	{
+		for (int32 c = 0; c < NumConditions; ++c)
+		{
+			const bool bLegacy = FBlueprintEvaluator::EvaluateInput<bool>(Graph.Conditions[c], &Contexts[i]);
+			const bool bBytecode = Programs[i * NumConditions + c].ExecuteBool(&Contexts[i]);
+			NumMismatches += bLegacy != bBytecode ? 1 : 0;
+		}
+	}
+
+	FBenchmarkHarness::LogHeader("AnimBP: %d instances x %d conditions, %d frames", NumInstances, NumConditions, NumFrames);
+	for (int32 c = 0; c < NumConditions; ++c)
+	{
+		const FBlueprintProgram& Program = Programs[c];
+		FBenchmarkHarness::LogLine("Condition %d : %d instructions, %d registers, %d fallback calls",
+			c, Program.GetNumInstructions(), Program.GetNumRegisters(), Program.GetNumFallbackCalls());
+	}
+	FBenchmarkHarness::LogLine("Compile : %.3f ms total (%d failures, sink %d)", CompileMs, NumCompileFailures, Sink);
+	FBenchmarkHarness::LogTiming("Legacy evaluator", Legacy);
+	FBenchmarkHarness::LogTiming("Bytecode VM", Bytecode, &Legacy);
+	FBenchmarkHarness::LogMismatches("Bytecode vs legacy", NumMismatches, NumInstances * NumConditions);
+
+	FBenchmarkHarness::DeleteObjects(Graph.Nodes);
+	FBenchmarkHarness::DeleteObjects(Instances);
+}
@@ -0,0 +1,8 @@
+﻿#pragma once
+
+// 전이 조건 재귀 평가기 vs 바이트코드 VM (콘솔: BENCH ANIMBP)
+class FAnimBlueprintVMBenchmark
+{
+public:
+	static void Run(int32 NumInstances = 500, int32 NumFrames = 200);
+};
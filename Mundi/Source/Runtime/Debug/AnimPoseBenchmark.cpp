@@ -0,0 +1,263 @@
+﻿#include "pch.h"
+#include "AnimPoseBenchmark.h"
+#include "BenchmarkHarness.h"
+#include "MemoryManager.h"
+#include "Source/Runtime/Engine/Animation/AnimInstance.h"
+#include "Source/Runtime/Engine/Animation/AnimSequence.h"
+#include "Source/Runtime/Engine/Animation/AnimMontage.h"
+#include "Source/Runtime/Engine/Animation/AnimDateModel.h"
+#include "Source/Runtime/Engine/Animation/AnimationStateMachine.h"
+#include "Source/Editor/FBX/BlendSpace/BlendSpace1D.h"
+#include "Source/Editor/FBX/BlendSpace/BlendSpace2D.h"
+
+namespace
+{
+	constexpr int32 NumKeys = 31;
+	constexpr int32 FrameRate = 30;
+
+	// 척추(0..Spine)는 일렬, 나머지는 앞쪽 본에 무작위로 붙이는 합성 스켈레톤
+	void BuildSkeleton(FSkeleton& Skeleton, int32 NumBones)
+	{
+		Skeleton.Name = "BenchSkeleton";
+		Skeleton.Bones.SetNum(NumBones);
+		for (int32 BoneIndex = 0; BoneIndex < NumBones; ++BoneIndex)
+		{
+			FBone& Bone = Skeleton.Bones[BoneIndex];
+			Bone.Name = "Bone_" + std::to_string(BoneIndex);
+			Bone.ParentIndex = (BoneIndex == 0) ? INDEX_NONE : (BoneIndex < 4 ? BoneIndex - 1 : (BoneIndex * 7) % BoneIndex);
+			Skeleton.BoneNameToIndex[Bone.Name] = BoneIndex;
+		}
+	}
+
+	UAnimSequence* CreateSequence(const FSkeleton& Skeleton, float PlayLength, float Phase)
+	{
+		UAnimSequence* Sequence = NewObject<UAnimSequence>();
+		UAnimDataModel* Model = Sequence->GetDataModel();
+
+		const int32 NumBones = Skeleton.Bones.Num();
+		TArray<FVector> PosKeys;
+		TArray<FQuat> RotKeys;
+		TArray<FVector> ScaleKeys;
+		PosKeys.SetNum(NumKeys);
+		RotKeys.SetNum(NumKeys);
+		ScaleKeys.SetNum(NumKeys);
+
+		for (int32 BoneIndex = 0; BoneIndex < NumBones; ++BoneIndex)
+		{
+			for (int32 Key = 0; Key < NumKeys; ++Key)
+			{
+				const float T = Phase + BoneIndex * 0.13f + Key * 0.21f;
+				PosKeys[Key] = FVector(std::sin(T), std::cos(T) * 0.5f, 1.0f + 0.1f * Key);
+				RotKeys[Key] = FQuat::FromAxisAngle(FVector(0.0f, 0.0f, 1.0f), T).GetNormalized();
+				ScaleKeys[Key] = FVector(1.0f, 1.0f, 1.0f);
+			}
+
+			const FName BoneName(Skeleton.Bones[BoneIndex].Name);
+			Model->AddBoneTrack(BoneName);
+			Model->SetBoneTrackKeys(BoneName, PosKeys, RotKeys, ScaleKeys);
+		}
+
+		Model->SetFrameRate(FrameRate);
+		Model->SetNumberOfFrames(NumKeys - 1);
+		Model->SetNumberOfKeys(NumKeys);
+		Model->SetPlayLength(PlayLength);
+		return Sequence;
+	}
+
+	void EvaluateLegacy(UAnimSequence* Sequence, float Time, bool bLooping, int32 NumBones, FPoseContext& OutContext)
+	{
+		OutContext = FPoseContext(NumBones);
+		Sequence->GetAnimationPose(OutContext, FAnimExtractContext(Time, bLooping));
+	}
+
+	// 기존 방식: 단계마다 TArray<FTransform>을 새로 만들어 Slerp 블렌드
+	TArray<FTransform> BlendLegacy(const TArray<FTransform>& A, const TArray<FTransform>& B, float Alpha)
+	{
+		TArray<FTransform> Result;
+		Result.SetNum(A.Num());
+		for (int32 BoneIndex = 0; BoneIndex < A.Num(); ++BoneIndex)
+		{
+			Result[BoneIndex].Blend(A[BoneIndex], B[BoneIndex], Alpha);
+		}
+		return Result;
+	}
+
+	void LogAllocationCheck(const char* Label, uint64 Allocs)
+	{
+		if (!FMemoryManager::IsHeapAllocationCountingEnabled())
+		{
+			FBenchmarkHarness::LogLine("%s allocations : SKIP (build with WITH_HEAP_ALLOC_COUNTING=1)", Label);
+			return;
+		}
+		char CheckLabel[64];
+		sprintf_s(CheckLabel, sizeof(CheckLabel), "%s allocations", Label);
+		FBenchmarkHarness::LogCheck(CheckLabel, Allocs == 0, "%llu in steady-state update", Allocs);
+	}
+
+	// 상태 머신 + BlendSpace1D/2D 크로스페이드 경로
+	void RunStateMachinePass(FSkeleton& Skeleton, const TArray<UAnimSequence*>& Sequences, int32 NumFrames, int32 WarmupFrames, float DeltaSeconds, float RunLength)
+	{
+		UBlendSpace1D* Locomotion = NewObject<UBlendSpace1D>();
+		Locomotion->SetParameterRange(0.0f, 600.0f);
+		Locomotion->AddSample(Sequences[0], 0.0f);
+		Locomotion->AddSample(Sequences[1], 300.0f);
+		Locomotion->AddSample(Sequences[2], 600.0f);
+
+		UBlendSpace2D* Strafe = NewObject<UBlendSpace2D>();
+		Strafe->SetParameterRange(FVector2D(-600.0f, -600.0f), FVector2D(600.0f, 600.0f));
+		Strafe->AddSample(Sequences[0], 0.0f, 0.0f);
+		Strafe->AddSample(Sequences[1], 0.0f, 600.0f);
+		Strafe->AddSample(Sequences[2], 0.0f, -600.0f);
+		Strafe->AddSample(Sequences[3], -600.0f, 0.0f);
+		Strafe->AddSample(Sequences[1], 600.0f, 0.0f);
+		Strafe->Triangulate();
+
+		UAnimInstance* Instance = NewObject<UAnimInstance>();
+		Instance->CurrentSkeleton = &Skeleton;
+
+		UAnimationStateMachine* StateMachine = NewObject<UAnimationStateMachine>();
+		StateMachine->Initialize(Instance);
+		StateMachine->SetLogStateChanges(false);
+		StateMachine->AddState(FAnimationState("Locomotion", Locomotion, true, 1.0f));
+		StateMachine->AddState(FAnimationState("Strafe", Strafe, true, 1.0f));
+		StateMachine->AddTransition(FStateTransition("Locomotion", "Strafe", {
+			FTransitionRule(FAnimStateMachineInputs::Speed, EAnimTransitionCompare::Greater, 300.0f) }, RunLength));
+		StateMachine->AddTransition(FStateTransition("Strafe", "Locomotion", {
+			FTransitionRule(FAnimStateMachineInputs::Speed, EAnimTransitionCompare::LessEqual, 300.0f) }, RunLength));
+		StateMachine->SetInitialState("Locomotion");
+		Instance->SetStateMachine(StateMachine);
+
+		// Speed는 300 위에서만 움직여 전이 없이 규칙만 재평가된다
+		auto DriveInputs = [&](int32 Frame)
+		{
+			const float Speed = 450.0f + 140.0f * std::sin(Frame * 0.1f);
+			Instance->SetMovementSpeed(Speed);
+			Locomotion->SetParameter(Speed);
+			Strafe->SetParameter(std::cos(Frame * 0.05f) * Speed, std::sin(Frame * 0.05f) * Speed);
+		};
+
+		// 워밍업에서 Strafe로 전이, 긴 블렌드로 측정 내내 두 블렌드 스페이스를 평가
+		Instance->SetMovementSpeed(100.0f);
+		Instance->NativeUpdateAnimation(DeltaSeconds);
+		for (int32 Frame = 0; Frame < WarmupFrames; ++Frame)
+		{
+			DriveInputs(Frame);
+			Instance->NativeUpdateAnimation(DeltaSeconds);
+		}
+
+		const uint64 AllocStart = FMemoryManager::GetThreadHeapAllocationCount();
+		const FBenchTiming Timing = FBenchmarkHarness::MeasureFrames(NumFrames, [&](int32 Frame)
+		{
+			DriveInputs(WarmupFrames + Frame);
+			Instance->NativeUpdateAnimation(DeltaSeconds);
+		});
+		const uint64 Allocs = FMemoryManager::GetThreadHeapAllocationCount() - AllocStart;
+
+		FBenchmarkHarness::LogTiming("StateMachine + BlendSpace1D/2D", Timing);
+		FBenchmarkHarness::LogLine("  %.1f allocs/frame (state %s)",
+			static_cast<double>(Allocs) / NumFrames, StateMachine->GetCurrentState().ToString().c_str());
+		LogAllocationCheck("state machine", Allocs);
+
+		Instance->SetStateMachine(nullptr);
+		Instance->CurrentSkeleton = nullptr;
+		ObjectFactory::DeleteObject(StateMachine);
+		ObjectFactory::DeleteObject(Instance);
+		ObjectFactory::DeleteObject(Strafe);
+		ObjectFactory::DeleteObject(Locomotion);
+	}
+}
+
+void FAnimPoseBenchmark::Run(int32 NumBones, int32 NumFrames)
+{
+	NumBones = FMath::Max(NumBones, 8);
+	NumFrames = FMath::Max(NumFrames, 1);
+	const float DeltaSeconds = 1.0f / 60.0f;
+	const int32 WarmupFrames = 16;
+
+	FSkeleton Skeleton;
+	BuildSkeleton(Skeleton, NumBones);
+
+	TArray<UAnimSequence*> Sequences;
+	const float RunLength = DeltaSeconds * (NumFrames + WarmupFrames) * 2.0f + 1.0f;
+	for (int32 Index = 0; Index < 4; ++Index)
+	{
+		Sequences.Add(CreateSequence(Skeleton, 1.0f + Index * 0.25f, Index * 0.7f));
+	}
+	UAnimSequence* MontageSequence = CreateSequence(Skeleton, RunLength, 2.1f);
+
+	UAnimMontage* Montage = NewObject<UAnimMontage>();
+	Montage->SetSourceSequence(MontageSequence);
+
+	// 블렌드 시간을 길게 잡아 측정 구간 내내 모든 블렌드 단계를 거치게 한다
+	UAnimInstance* Instance = NewObject<UAnimInstance>();
+	Instance->CurrentSkeleton = &Skeleton;
+	Instance->PlaySequence(Sequences[0], true, 1.0f);
+	Instance->BlendTo(Sequences[1], true, 1.0f, RunLength);
+	Instance->PlaySequence(Sequences[2], EAnimLayer::Upper, true, 1.0f);
+	Instance->BlendTo(Sequences[3], EAnimLayer::Upper, true, 1.0f, RunLength);
+	Instance->EnableUpperBodySplit(FName(Skeleton.Bones[2].Name));
+	Instance->Montage_Play(Montage, RunLength * 0.25f, 0.1f, 1.0f);
+
+	for (int32 Frame = 0; Frame < WarmupFrames; ++Frame)
+	{
+		Instance->NativeUpdateAnimation(DeltaSeconds);
+	}
+
+	// Pooled
+	const uint64 PooledAllocStart = FMemoryManager::GetThreadHeapAllocationCount();
+	const FBenchTiming Pooled = FBenchmarkHarness::MeasureFrames(NumFrames, [&](int32)
+	{
+		Instance->NativeUpdateAnimation(DeltaSeconds);
+	});
+	const uint64 PooledAllocs = FMemoryManager::GetThreadHeapAllocationCount() - PooledAllocStart;
+
+	// Legacy
+	FPoseContext BaseA, BaseB, UpperA, UpperB, MontagePose;
+	float Sink = 0.0f;
+	const uint64 LegacyAllocStart = FMemoryManager::GetThreadHeapAllocationCount();
+	const FBenchTiming Legacy = FBenchmarkHarness::MeasureFrames(NumFrames, [&](int32 Frame)
+	{
+		const float Time = Frame * DeltaSeconds;
+		EvaluateLegacy(Sequences[0], Time, true, NumBones, BaseA);
+		EvaluateLegacy(Sequences[1], Time, true, NumBones, BaseB);
+		TArray<FTransform> Pose = BlendLegacy(BaseA.Pose, BaseB.Pose, 0.5f);
+
+		EvaluateLegacy(Sequences[2], Time, true, NumBones, UpperA);
+		EvaluateLegacy(Sequences[3], Time, true, NumBones, UpperB);
+		TArray<FTransform> UpperPose = BlendLegacy(UpperA.Pose, UpperB.Pose, 0.5f);
+		for (int32 BoneIndex = 0; BoneIndex < NumBones; ++BoneIndex)
+		{
+			if (Instance->UpperBodyWeights[BoneIndex] > 0.0f)
+			{
+				Pose[BoneIndex] = UpperPose[BoneIndex];
+			}
+		}
+
+		EvaluateLegacy(MontageSequence, Time, false, NumBones, MontagePose);
+		TArray<FTransform> Result = BlendLegacy(Pose, MontagePose.Pose, 0.5f);
+		Sink += Result[NumBones - 1].Translation.X;
+	});
+	const uint64 LegacyAllocs = FMemoryManager::GetThreadHeapAllocationCount() - LegacyAllocStart;
+
+	const double PooledAllocsPerFrame = static_cast<double>(PooledAllocs) / NumFrames;
+	const double LegacyAllocsPerFrame = static_cast<double>(LegacyAllocs) / NumFrames;
+
+	FBenchmarkHarness::LogHeader("Pose: %d bones, %d frames (base crossfade + upper layer crossfade + montage)", NumBones, NumFrames);
+	FBenchmarkHarness::LogTiming("Legacy TArray/Slerp", Legacy);
+	FBenchmarkHarness::LogTiming("Pooled SoA", Pooled, &Legacy);
+	FBenchmarkHarness::LogLine("Allocs/frame : legacy %.1f, pooled %.1f (sink %.3f)", LegacyAllocsPerFrame, PooledAllocsPerFrame, Sink);
+	FBenchmarkHarness::LogLine("Pose stack : peak depth %d / %d", Instance->GetPoseStack().GetPeakDepth(), Instance->GetPoseStack().GetMaxPoses());
+	LogAllocationCheck("layered", PooledAllocs);
+
+	RunStateMachinePass(Skeleton, Sequences, NumFrames, WarmupFrames, DeltaSeconds, RunLength);
+
+	Instance->CurrentSkeleton = nullptr;
+	ObjectFactory::DeleteObject(Instance);
+	ObjectFactory::DeleteObject(Montage);
+	Sequences.Add(MontageSequence);
+	for (UAnimSequence* Sequence : Sequences)
+	{
+		ObjectFactory::DeleteObject(Sequence->GetDataModel());
+		ObjectFactory::DeleteObject(Sequence);
+	}
+}
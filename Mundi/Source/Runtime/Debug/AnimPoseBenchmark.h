@@ -0,0 +1,8 @@
+﻿#pragma once
+
+// 임시 배열 포즈 블렌드 vs 포즈 스택, 정상 상태 무할당 검사 (콘솔: BENCH POSE)
+class FAnimPoseBenchmark
+{
+public:
+	static void Run(int32 NumBones = 80, int32 NumFrames = 2000);
+};
@@ -0,0 +1,145 @@
+﻿#include "pch.h"
+#include "AnimStateMachineBenchmark.h"
+#include "BenchmarkHarness.h"
+#include "Source/Runtime/Engine/Animation/AnimInstance.h"
+#include "Source/Runtime/Engine/Animation/AnimationStateMachine.h"
+
+namespace
+{
+	constexpr float WalkThreshold = 0.1f;
+	constexpr float RunThreshold = 5.0f;
+
+	using ERule = EAnimTransitionCompare;
+
+	void AddLocomotionStates(UAnimationStateMachine* Machine)
+	{
+		Machine->AddState(FAnimationState("Idle", static_cast<UAnimSequence*>(nullptr)));
+		Machine->AddState(FAnimationState("Walk", static_cast<UAnimSequence*>(nullptr)));
+		Machine->AddState(FAnimationState("Run", static_cast<UAnimSequence*>(nullptr)));
+		Machine->AddState(FAnimationState("Jump", static_cast<UAnimSequence*>(nullptr)));
+	}
+
+	// 기존 방식: 조건이 무엇을 읽는지 모르므로 매 프레임 평가
+	void BuildPolling(UAnimationStateMachine* Machine)
+	{
+		AddLocomotionStates(Machine);
+		const int32 Speed = Machine->FindVariable(FAnimStateMachineInputs::Speed);
+		const int32 Grounded = Machine->FindVariable(FAnimStateMachineInputs::IsGrounded);
+		auto SpeedOf = [Machine, Speed]() { return Machine->GetVariable(Speed); };
+		auto InAir = [Machine, Grounded]() { return Machine->GetVariable(Grounded) == 0.0f; };
+
+		for (const char* From : { "Idle", "Walk", "Run" })
+		{
+			Machine->AddTransition(FStateTransition(From, "Jump", InAir));
+		}
+		Machine->AddTransition(FStateTransition("Idle", "Walk", [SpeedOf]() { return SpeedOf() >= WalkThreshold && SpeedOf() < RunThreshold; }));
+		Machine->AddTransition(FStateTransition("Idle", "Run", [SpeedOf]() { return SpeedOf() >= RunThreshold; }));
+		Machine->AddTransition(FStateTransition("Walk", "Idle", [SpeedOf]() { return SpeedOf() < WalkThreshold; }));
+		Machine->AddTransition(FStateTransition("Walk", "Run", [SpeedOf]() { return SpeedOf() >= RunThreshold; }));
+		Machine->AddTransition(FStateTransition("Run", "Walk", [SpeedOf]() { return SpeedOf() >= WalkThreshold && SpeedOf() < RunThreshold; }));
+		Machine->AddTransition(FStateTransition("Run", "Idle", [SpeedOf]() { return SpeedOf() < WalkThreshold; }));
+		Machine->AddTransition(FStateTransition("Jump", "Idle", [InAir]() { return !InAir(); }));
+	}
+
+	// 입력 변수 규칙: Speed/IsGrounded가 바뀔 때만 평가
+	void BuildEventDriven(UAnimationStateMachine* Machine)
+	{
+		AddLocomotionStates(Machine);
+		const FName Speed = FAnimStateMachineInputs::Speed;
+		const FName Grounded = FAnimStateMachineInputs::IsGrounded;
+
+		for (const char* From : { "Idle", "Walk", "Run" })
+		{
+			Machine->AddTransition(FStateTransition(From, "Jump", { FTransitionRule(Grounded, ERule::Equal, 0.0f) }));
+		}
+		Machine->AddTransition(FStateTransition("Idle", "Walk", { FTransitionRule(Speed, ERule::GreaterEqual, WalkThreshold), FTransitionRule(Speed, ERule::Less, RunThreshold) }));
+		Machine->AddTransition(FStateTransition("Idle", "Run", { FTransitionRule(Speed, ERule::GreaterEqual, RunThreshold) }));
+		Machine->AddTransition(FStateTransition("Walk", "Idle", { FTransitionRule(Speed, ERule::Less, WalkThreshold) }));
+		Machine->AddTransition(FStateTransition("Walk", "Run", { FTransitionRule(Speed, ERule::GreaterEqual, RunThreshold) }));
+		Machine->AddTransition(FStateTransition("Run", "Walk", { FTransitionRule(Speed, ERule::GreaterEqual, WalkThreshold), FTransitionRule(Speed, ERule::Less, RunThreshold) }));
+		Machine->AddTransition(FStateTransition("Run", "Idle", { FTransitionRule(Speed, ERule::Less, WalkThreshold) }));
+		Machine->AddTransition(FStateTransition("Jump", "Idle", { FTransitionRule(Grounded, ERule::Equal, 1.0f) }));
+	}
+
+	struct FPassResult
+	{
+		FBenchTiming Timing;
+		uint64 NumEvaluations = 0;
+		TArray<int32> FinalStates;
+	};
+
+	FPassResult RunPass(UAnimInstance* Owner, int32 NumMachines, int32 NumFrames, int32 MovingPercent, bool bEventDriven)
+	{
+		TArray<UAnimationStateMachine*> Machines = FBenchmarkHarness::CreateObjects<UAnimationStateMachine>(NumMachines);
+		TArray<int32> SpeedIndices;
+		TArray<int32> GroundedIndices;
+		for (UAnimationStateMachine* Machine : Machines)
+		{
+			Machine->SetLogStateChanges(false);
+			Machine->Initialize(Owner);
+			if (bEventDriven)
+			{
+				BuildEventDriven(Machine);
+			}
+			else
+			{
+				BuildPolling(Machine);
+			}
+			Machine->SetInitialState("Idle");
+			SpeedIndices.Add(Machine->FindVariable(FAnimStateMachineInputs::Speed));
+			GroundedIndices.Add(Machine->FindVariable(FAnimStateMachineInputs::IsGrounded));
+		}
+
+		FPassResult Result;
+		for (int32 Frame = 0; Frame < NumFrames; ++Frame)
+		{
+			FBenchScope Scope(Result.Timing);
+			for (int32 i = 0; i < NumMachines; ++i)
+			{
+				// 값이 같으면 변경으로 치지 않는다
+				const bool bMoving = (i % 100) < MovingPercent;
+				const float Speed = bMoving ? 3.0f + 3.0f * std::sin(Frame * 0.05f + i) : 0.0f;
+				const bool bGrounded = !(bMoving && (Frame + i) % 120 < 10);
+				Machines[i]->SetVariable(SpeedIndices[i], Speed);
+				Machines[i]->SetVariable(GroundedIndices[i], bGrounded ? 1.0f : 0.0f);
+				Machines[i]->ProcessState(1.0f / 60.0f);
+			}
+		}
+
+		for (UAnimationStateMachine* Machine : Machines)
+		{
+			Result.NumEvaluations += Machine->GetNumConditionEvaluations();
+			Result.FinalStates.Add(Machine->GetCurrentStateIndex());
+		}
+		FBenchmarkHarness::DeleteObjects(Machines);
+		return Result;
+	}
+}
+
+void FAnimStateMachineBenchmark::Run(int32 NumMachines, int32 NumFrames, int32 MovingPercent)
+{
+	if (NumMachines <= 0 || NumFrames <= 0)
+	{
+		return;
+	}
+
+	UAnimInstance* Owner = NewObject<UAnimInstance>();
+
+	const FPassResult Polling = RunPass(Owner, NumMachines, NumFrames, MovingPercent, false);
+	const FPassResult EventDriven = RunPass(Owner, NumMachines, NumFrames, MovingPercent, true);
+
+	int32 NumMismatches = 0;
+	for (int32 i = 0; i < NumMachines; ++i)
+	{
+		NumMismatches += Polling.FinalStates[i] != EventDriven.FinalStates[i] ? 1 : 0;
+	}
+
+	FBenchmarkHarness::LogHeader("AnimSM: %d state machines (%d%% moving) x %d frames", NumMachines, MovingPercent, NumFrames);
+	FBenchmarkHarness::LogTiming("Polling", Polling.Timing);
+	FBenchmarkHarness::LogTiming("Event-driven", EventDriven.Timing, &Polling.Timing);
+	FBenchmarkHarness::LogLine("Evaluations/frame : polling %.1f, event-driven %.1f",
+		static_cast<double>(Polling.NumEvaluations) / NumFrames, static_cast<double>(EventDriven.NumEvaluations) / NumFrames);
+	FBenchmarkHarness::LogMismatches("Final states", NumMismatches, NumMachines);
+
+	ObjectFactory::DeleteObject(Owner);
+}
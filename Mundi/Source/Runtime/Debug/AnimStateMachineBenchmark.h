@@ -0,0 +1,8 @@
+﻿#pragma once
+
+// 전이 조건 매 프레임 폴링 vs 입력 변수 변경 시 평가 (콘솔: BENCH ANIMSM)
+class FAnimStateMachineBenchmark
+{
+public:
+	static void Run(int32 NumMachines = 2000, int32 NumFrames = 300, int32 MovingPercent = 10);
+};
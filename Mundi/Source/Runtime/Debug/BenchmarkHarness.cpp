@@ -0,0 +1,59 @@
+﻿#include "pch.h"
+#include "BenchmarkHarness.h"
+
+namespace
+{
+	void LogFormatted(const char* Prefix, const char* Format, va_list Args)
+	{
+		char Buffer[512];
+		vsnprintf(Buffer, sizeof(Buffer), Format, Args);
+		UE_LOG("%s%s", Prefix, Buffer);
+	}
+}
+
+void FBenchmarkHarness::LogHeader(const char* Format, ...)
+{
+	va_list Args;
+	va_start(Args, Format);
+	LogFormatted("[Bench] ", Format, Args);
+	va_end(Args);
+}
+
+void FBenchmarkHarness::LogLine(const char* Format, ...)
+{
+	va_list Args;
+	va_start(Args, Format);
+	LogFormatted("[Bench]   ", Format, Args);
+	va_end(Args);
+}
+
+void FBenchmarkHarness::LogTiming(const char* Label, const FBenchTiming& Timing, const FBenchTiming* Baseline)
+{
+	if (Baseline)
+	{
+		LogLine("%s : %.3f ms/frame (worst %.3f), x%.2f",
+			Label, Timing.GetAverageMs(), Timing.WorstMs, Speedup(Baseline->TotalMs, Timing.TotalMs));
+	}
+	else
+	{
+		LogLine("%s : %.3f ms/frame (worst %.3f)", Label, Timing.GetAverageMs(), Timing.WorstMs);
+	}
+}
+
+void FBenchmarkHarness::LogMismatches(const char* Label, int32 NumMismatches, int32 NumCompared)
+{
+	LogLine("%s : %s, %d / %d mismatches", Label, NumMismatches == 0 ? "PASS" : "FAIL", NumMismatches, NumCompared);
+}
+
+void FBenchmarkHarness::LogCheck(const char* Label, bool bPass, const char* DetailFormat, ...)
+{
+	char Detail[256] = "";
+	if (DetailFormat)
+	{
+		va_list Args;
+		va_start(Args, DetailFormat);
+		vsnprintf(Detail, sizeof(Detail), DetailFormat, Args);
+		va_end(Args);
+	}
+	LogLine(Detail[0] ? "%s : %s (%s)" : "%s : %s%s", Label, bPass ? "PASS" : "FAIL", Detail);
+}
@@ -0,0 +1,86 @@
+﻿#pragma once
+#include "PlatformTime.h"
+
+// 프레임별 구간 시간 누적 (평균/최악)
+struct FBenchTiming
+{
+	double TotalMs = 0.0;
+	double WorstMs = 0.0;
+	int32 NumSamples = 0;
+
+	void Add(double Ms)
+	{
+		TotalMs += Ms;
+		WorstMs = std::max(WorstMs, Ms);
+		++NumSamples;
+	}
+
+	double GetAverageMs() const { return NumSamples > 0 ? TotalMs / NumSamples : 0.0; }
+};
+
+// 스코프가 끝날 때 경과 시간을 FBenchTiming에 더한다
+class FBenchScope
+{
+public:
+	explicit FBenchScope(FBenchTiming& InTiming) : Timing(InTiming) {}
+	~FBenchScope() { Timing.Add(Counter.Finish()); }
+
+private:
+	FBenchTiming& Timing;
+	FScopeCycleCounter Counter;
+};
+
+// 콘솔 BENCH 명령 공용 출력/픽스처 (출력은 모두 "[Bench]" 접두사)
+class FBenchmarkHarness
+{
+public:
+	static double Speedup(double BaselineMs, double OptimizedMs)
+	{
+		return OptimizedMs > 0.0 ? BaselineMs / OptimizedMs : 0.0;
+	}
+
+	// Func(Frame)를 NumFrames번 실행하며 프레임마다 시간 측정
+	template<typename TFunc>
+	static FBenchTiming MeasureFrames(int32 NumFrames, TFunc&& Func)
+	{
+		FBenchTiming Timing;
+		for (int32 Frame = 0; Frame < NumFrames; ++Frame)
+		{
+			FBenchScope Scope(Timing);
+			Func(Frame);
+		}
+		return Timing;
+	}
+
+	// 벤치마크 제목 줄
+	static void LogHeader(const char* Format, ...);
+	// 제목 아래 들여쓴 줄
+	static void LogLine(const char* Format, ...);
+	// "Label : 평균 ms/frame (worst), Baseline 대비 배율"
+	static void LogTiming(const char* Label, const FBenchTiming& Timing, const FBenchTiming* Baseline = nullptr);
+	// 기준 구현과의 결과 비교 (0개면 PASS)
+	static void LogMismatches(const char* Label, int32 NumMismatches, int32 NumCompared);
+	static void LogCheck(const char* Label, bool bPass, const char* DetailFormat = nullptr, ...);
+
+	template<typename T>
+	static TArray<T*> CreateObjects(int32 Num)
+	{
+		TArray<T*> Objects;
+		Objects.Reserve(Num);
+		for (int32 i = 0; i < Num; ++i)
+		{
+			Objects.Add(NewObject<T>());
+		}
+		return Objects;
+	}
+
+	template<typename T>
+	static void DeleteObjects(TArray<T*>& Objects)
+	{
+		for (T* Object : Objects)
+		{
+			ObjectFactory::DeleteObject(Object);
+		}
+		Objects.Empty();
+	}
+};
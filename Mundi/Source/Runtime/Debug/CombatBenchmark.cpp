@@ -0,0 +1,134 @@
+﻿#include "pch.h"
+#include "CombatBenchmark.h"
+#include "BenchmarkHarness.h"
+#include "Collision.h"
+#include "Source/Runtime/Engine/Physics/PhysScene.h"
+#include "Source/Runtime/Game/Combat/CombatResolver.h"
+#include <random>
+
+namespace
+{
+	constexpr float FieldHalfSize = 30.0f;
+
+	struct FPassResult
+	{
+		FBenchTiming Timing;
+		int64 NumHits = 0;
+	};
+
+	// 히트박스 위치를 프레임마다 원을 따라 조금씩 옮긴다 (휘두르기 대용)
+	void MoveHitboxes(TArray<FBoxOverlapQuery>& Queries, const TArray<FVector>& Origins, int32 Frame)
+	{
+		for (int32 i = 0; i < Queries.Num(); ++i)
+		{
+			const float Angle = Frame * 0.15f + i * 0.37f;
+			Queries[i].Center = Origins[i] + FVector(std::cos(Angle), std::sin(Angle), 0.0f) * 0.8f;
+		}
+	}
+
+	FPassResult RunBaseline(const FPhysScene& Scene, TArray<FBoxOverlapQuery> Queries, const TArray<FVector>& Origins, int32 NumFrames)
+	{
+		TArray<TArray<uint64>> HitTargets;			// 히트박스별 이번 공격에 맞은 대상
+		HitTargets.SetNum(Queries.Num());
+
+		FPassResult Result;
+		for (int32 Frame = 0; Frame < NumFrames; ++Frame)
+		{
+			MoveHitboxes(Queries, Origins, Frame);
+
+			FBenchScope Scope(Result.Timing);
+			for (int32 i = 0; i < Queries.Num(); ++i)
+			{
+				const FBoxOverlapQuery& Query = Queries[i];
+				FHitResult Hit;
+				const FVector SweepEnd = Query.Center + FVector(0.01f, 0.0f, 0.0f);
+				if (Scene.SweepBox(Query.Center, SweepEnd, Query.HalfExtents, Query.Rotation, Hit))
+				{
+					// 합성 바디는 액터가 없으므로 충돌 위치의 1m 셀로 대상 구분
+					const int32 CellX = static_cast<int32>(std::floor(Hit.ImpactPoint.X));
+					const int32 CellY = static_cast<int32>(std::floor(Hit.ImpactPoint.Y));
+					const uint64 Target = FCombatResolver::MakePairKey(static_cast<uint32>(CellX), static_cast<uint32>(CellY));
+					if (!HitTargets[i].Contains(Target))
+					{
+						HitTargets[i].Add(Target);
+						++Result.NumHits;
+					}
+				}
+			}
+		}
+		return Result;
+	}
+
+	FPassResult RunBatched(const FPhysScene& Scene, TArray<FBoxOverlapQuery> Queries, const TArray<FVector>& Origins, int32 NumFrames)
+	{
+		TArray<FOverlapHitResult> Overlaps;
+		TSet<uint64> HitPairs;						// (히트박스, 대상) 쌍, 공격 단위로 유지
+
+		FPassResult Result;
+		for (int32 Frame = 0; Frame < NumFrames; ++Frame)
+		{
+			MoveHitboxes(Queries, Origins, Frame);
+
+			FBenchScope Scope(Result.Timing);
+			Scene.OverlapBoxBatch(Queries, Overlaps);
+			for (const FOverlapHitResult& Overlap : Overlaps)
+			{
+				const uint32 BodyId = static_cast<uint32>(reinterpret_cast<uintptr_t>(Overlap.HitBody) >> 4);
+				const uint64 PairKey = FCombatResolver::MakePairKey(static_cast<uint32>(Overlap.QueryIndex), BodyId);
+				if (!HitPairs.Contains(PairKey))
+				{
+					HitPairs.Add(PairKey);
+					++Result.NumHits;
+				}
+			}
+		}
+		return Result;
+	}
+}
+
+void FCombatBenchmark::Run(int32 NumHitboxes, int32 NumVictims, int32 NumFrames)
+{
+	FPhysScene Scene;
+	if (!Scene.Initialize())
+	{
+		FBenchmarkHarness::LogHeader("Combat FAIL: PhysScene initialize failed");
+		return;
+	}
+
+	std::mt19937 Random(4321);
+	std::uniform_real_distribution<float> Coord(-FieldHalfSize, FieldHalfSize);
+
+	// 1. 피해자 대용 정적 박스 (캐릭터 크기)
+	{
+		PxPhysics* Physics = Scene.GetPhysics();
+		PxMaterial* Material = Scene.GetDefaultMaterial();
+		PxScene* PxSceneHandle = Scene.GetScene();
+		SCOPED_PHYSX_WRITE_LOCK(*PxSceneHandle);
+		for (int32 i = 0; i < NumVictims; ++i)
+		{
+			PxRigidStatic* Body = Physics->createRigidStatic(PxTransform(PxVec3(Coord(Random), Coord(Random), 1.0f)));
+			PxRigidActorExt::createExclusiveShape(*Body, PxBoxGeometry(0.4f, 0.4f, 1.0f), *Material);
+			PxSceneHandle->addActor(*Body);
+		}
+	}
+
+	// 2. 히트박스 (무기 크기), 피해자 근처에 몰리도록 같은 범위에 배치
+	TArray<FBoxOverlapQuery> Queries;
+	TArray<FVector> Origins;
+	Queries.SetNum(NumHitboxes);
+	Origins.SetNum(NumHitboxes);
+	for (int32 i = 0; i < NumHitboxes; ++i)
+	{
+		Origins[i] = FVector(Coord(Random), Coord(Random), 1.0f);
+		Queries[i].HalfExtents = FVector(0.6f, 0.15f, 0.15f);
+		Queries[i].Rotation = FQuat::Identity();
+	}
+
+	const FPassResult Baseline = RunBaseline(Scene, Queries, Origins, NumFrames);
+	const FPassResult Batched = RunBatched(Scene, Queries, Origins, NumFrames);
+
+	FBenchmarkHarness::LogHeader("Combat: %d hitboxes vs %d victims x %d frames", NumHitboxes, NumVictims, NumFrames);
+	FBenchmarkHarness::LogTiming("Baseline (serial sweep)", Baseline.Timing);
+	FBenchmarkHarness::LogTiming("Batched (parallel overlap)", Batched.Timing, &Baseline.Timing);
+	FBenchmarkHarness::LogLine("Unique hits : baseline %lld, batched %lld", Baseline.NumHits, Batched.NumHits);
+}
@@ -0,0 +1,8 @@
+﻿#pragma once
+
+// 히트박스별 직렬 Sweep vs 배치 병렬 오버랩 (콘솔: BENCH COMBAT)
+class FCombatBenchmark
+{
+public:
+	static void Run(int32 NumHitboxes = 300, int32 NumVictims = 300, int32 NumFrames = 120);
+};
@@ -0,0 +1,235 @@
+﻿#include "pch.h"
+#include "DelegateBenchmark.h"
+#include "BenchmarkHarness.h"
+#include "ActorComponent.h"
+#include <random>
+
+namespace
+{
+	// 기존 TDelegate와 같은 구조 (비교 기준)
+	template<typename... Args>
+	class TLegacyDelegate
+	{
+	public:
+		using HandlerType = std::function<void(Args...)>;
+
+		size_t Add(const HandlerType& Handler)
+		{
+			const size_t Handle = NextHandle++;
+			Handlers.push_back({ Handle, Handler });
+			return Handle;
+		}
+
+		template<typename TObj, typename TClass>
+		size_t AddDynamic(TObj* Instance, void(TClass::* Func)(Args...))
+		{
+			return Add([=](Args... args) { (Instance->*Func)(args...); });
+		}
+
+		void Broadcast(Args... args)
+		{
+			for (auto& Entry : Handlers)
+			{
+				if (Entry.Handler)
+				{
+					Entry.Handler(args...);
+				}
+			}
+		}
+
+		void Remove(size_t Handle)
+		{
+			auto It = std::remove_if(Handlers.begin(), Handlers.end(), [&](const Entry& E) { return E.Handle == Handle; });
+			Handlers.erase(It, Handlers.end());
+		}
+
+	private:
+		struct Entry
+		{
+			size_t Handle;
+			HandlerType Handler;
+		};
+
+		std::vector<Entry> Handlers;
+		size_t NextHandle = 1;
+	};
+
+	struct FEventSink
+	{
+		int64 Count = 0;
+		float Sum = 0.0f;
+
+		void OnEvent(int32 Value, const FVector& Location)
+		{
+			++Count;
+			Sum += Location.X * static_cast<float>(Value);
+		}
+	};
+
+	struct FPassResult
+	{
+		double BroadcastMs = 0.0;
+		double ChurnMs = 0.0;
+		int64 NumCalls = 0;
+	};
+
+	// 핸들러 절반은 멤버 함수, 절반은 포인터 3개를 캡처한 람다 (오버랩/히트 핸들러 크기)
+	template<typename TDelegateType, typename THandle>
+	THandle BindHandler(TDelegateType& Delegate, FEventSink& Sink, int32 HandlerIndex, const float* Scale, const int32* Bias)
+	{
+		if (HandlerIndex % 2 == 0)
+		{
+			return Delegate.AddDynamic(&Sink, &FEventSink::OnEvent);
+		}
+		FEventSink* SinkPtr = &Sink;
+		return Delegate.Add([SinkPtr, Scale, Bias](int32 Value, const FVector& Location)
+		{
+			SinkPtr->OnEvent(Value + *Bias, Location * *Scale);
+		});
+	}
+
+	template<typename TDelegateType, typename THandle>
+	FPassResult RunPass(int32 NumDelegates, int32 NumHandlers, int32 NumBroadcasts, uint32 Seed)
+	{
+		TArray<TDelegateType> Delegates;
+		Delegates.SetNum(NumDelegates);
+		TArray<FEventSink> Sinks;
+		Sinks.SetNum(NumDelegates);
+		TArray<TArray<THandle>> Handles;
+		Handles.SetNum(NumDelegates);
+
+		const float Scale = 1.0f;
+		const int32 Bias = 0;
+		for (int32 d = 0; d < NumDelegates; ++d)
+		{
+			for (int32 h = 0; h < NumHandlers; ++h)
+			{
+				Handles[d].Add(BindHandler<TDelegateType, THandle>(Delegates[d], Sinks[d], h, &Scale, &Bias));
+			}
+		}
+
+		FPassResult Result;
+
+		// 1. Broadcast 처리량
+		const FVector Location(1.0f, 2.0f, 3.0f);
+		FScopeCycleCounter BroadcastCounter;
+		for (int32 b = 0; b < NumBroadcasts; ++b)
+		{
+			for (int32 d = 0; d < NumDelegates; ++d)
+			{
+				Delegates[d].Broadcast(b, Location);
+			}
+		}
+		Result.BroadcastMs = BroadcastCounter.Finish();
+
+		// 2. 바인딩 교체: 임의 순서로 모두 제거 후 다시 추가
+		std::mt19937 Random(Seed);
+		TArray<int32> Order;
+		for (int32 h = 0; h < NumHandlers; ++h)
+		{
+			Order.Add(h);
+		}
+		FScopeCycleCounter ChurnCounter;
+		for (int32 Round = 0; Round < 10; ++Round)
+		{
+			for (int32 d = 0; d < NumDelegates; ++d)
+			{
+				std::shuffle(Order.begin(), Order.end(), Random);
+				for (int32 h : Order)
+				{
+					Delegates[d].Remove(Handles[d][h]);
+				}
+				for (int32 h = 0; h < NumHandlers; ++h)
+				{
+					Handles[d][h] = BindHandler<TDelegateType, THandle>(Delegates[d], Sinks[d], h, &Scale, &Bias);
+				}
+			}
+		}
+		Result.ChurnMs = ChurnCounter.Finish();
+
+		for (const FEventSink& Sink : Sinks)
+		{
+			Result.NumCalls += Sink.Count;
+		}
+		return Result;
+	}
+
+	// Broadcast 중 제거된 핸들러는 이후 호출되지 않고, 추가된 핸들러는 다음 Broadcast부터 호출
+	void VerifyRemovalDuringBroadcast()
+	{
+		TDelegate<int32, const FVector&> Delegate;
+		int32 OneShotCalls = 0;
+		int32 PersistentCalls = 0;
+		int32 LateCalls = 0;
+
+		FDelegateHandle OneShotHandle;
+		OneShotHandle = Delegate.Add([&](int32, const FVector&)
+		{
+			++OneShotCalls;
+			Delegate.Remove(OneShotHandle);
+			Delegate.Add([&LateCalls](int32, const FVector&) { ++LateCalls; });
+		});
+		Delegate.Add([&PersistentCalls](int32, const FVector&) { ++PersistentCalls; });
+
+		Delegate.Broadcast(0, FVector());
+		Delegate.Broadcast(1, FVector());
+		const bool bStaleRemoveIgnored = !Delegate.Remove(OneShotHandle);
+
+		const bool bPass = OneShotCalls == 1 && PersistentCalls == 2 && LateCalls == 1 && Delegate.Num() == 2 && bStaleRemoveIgnored;
+		FBenchmarkHarness::LogCheck("Remove during broadcast", bPass, "one-shot %d/1, persistent %d/2, added-in-broadcast %d/1, bound %d/2",
+			OneShotCalls, PersistentCalls, LateCalls, Delegate.Num());
+	}
+
+	// 삭제된 UObject에 묶인 바인딩은 호출되지 않고 자동 해제
+	void VerifyWeakBinding(int32 NumOwners)
+	{
+		TDelegate<int32, const FVector&> Delegate;
+		TArray<UActorComponent*> Owners = FBenchmarkHarness::CreateObjects<UActorComponent>(NumOwners);
+		int32 NumCalls = 0;
+		for (UActorComponent* Owner : Owners)
+		{
+			Delegate.AddWeakLambda(Owner, [&NumCalls](int32, const FVector&) { ++NumCalls; });
+		}
+
+		for (int32 i = 0; i < NumOwners; i += 2)
+		{
+			ObjectFactory::DeleteObject(Owners[i]);
+		}
+		// 삭제된 주소/슬롯을 새 오브젝트가 재사용해도 UUID가 달라 호출되지 않아야 함
+		TArray<UActorComponent*> Replacements = FBenchmarkHarness::CreateObjects<UActorComponent>((NumOwners + 1) / 2);
+
+		Delegate.Broadcast(0, FVector());
+		const int32 Expected = NumOwners / 2;
+		const bool bPass = NumCalls == Expected && Delegate.Num() == Expected;
+		FBenchmarkHarness::LogCheck("Weak UObject binding", bPass, "calls %d, bound %d, expected %d", NumCalls, Delegate.Num(), Expected);
+
+		for (int32 i = 1; i < NumOwners; i += 2)
+		{
+			ObjectFactory::DeleteObject(Owners[i]);
+		}
+		FBenchmarkHarness::DeleteObjects(Replacements);
+	}
+}
+
+void FDelegateBenchmark::Run(int32 NumDelegates, int32 NumHandlers, int32 NumBroadcasts)
+{
+	using FInlineDelegate = TDelegate<int32, const FVector&>;
+
+	const uint64 HeapBindingsBefore = FInlineDelegate::GetNumHeapBindings();
+	const FPassResult Baseline = RunPass<TLegacyDelegate<int32, const FVector&>, size_t>(NumDelegates, NumHandlers, NumBroadcasts, 1234);
+	const FPassResult Inline = RunPass<FInlineDelegate, FDelegateHandle>(NumDelegates, NumHandlers, NumBroadcasts, 1234);
+	const uint64 HeapBindings = FInlineDelegate::GetNumHeapBindings() - HeapBindingsBefore;
+
+	const double NumInvocations = static_cast<double>(NumDelegates) * NumHandlers * NumBroadcasts;
+	FBenchmarkHarness::LogHeader("Delegate: %d delegates x %d handlers x %d broadcasts", NumDelegates, NumHandlers, NumBroadcasts);
+	FBenchmarkHarness::LogLine("Baseline (std::function) : broadcast %.3f ms (%.2f ns/call), rebind churn %.3f ms, %lld calls",
+		Baseline.BroadcastMs, Baseline.BroadcastMs * 1.0e6 / NumInvocations, Baseline.ChurnMs, Baseline.NumCalls);
+	FBenchmarkHarness::LogLine("Inline (slot buffer) : broadcast %.3f ms (%.2f ns/call), rebind churn %.3f ms, %lld calls",
+		Inline.BroadcastMs, Inline.BroadcastMs * 1.0e6 / NumInvocations, Inline.ChurnMs, Inline.NumCalls);
+	FBenchmarkHarness::LogLine("Speedup : broadcast x%.2f, churn x%.2f, heap bindings %llu",
+		FBenchmarkHarness::Speedup(Baseline.BroadcastMs, Inline.BroadcastMs),
+		FBenchmarkHarness::Speedup(Baseline.ChurnMs, Inline.ChurnMs), HeapBindings);
+
+	VerifyRemovalDuringBroadcast();
+	VerifyWeakBinding(64);
+}
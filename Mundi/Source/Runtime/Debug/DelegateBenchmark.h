@@ -0,0 +1,8 @@
+﻿#pragma once
+
+// std::function 델리게이트 vs 인라인 슬롯 델리게이트 (콘솔: BENCH DELEGATE)
+class FDelegateBenchmark
+{
+public:
+	static void Run(int32 NumDelegates = 2000, int32 NumHandlers = 8, int32 NumBroadcasts = 200);
+};
@@ -0,0 +1,231 @@
+﻿#include "pch.h"
+#include "FrameBenchmark.h"
+#include "PlatformTime.h"
+#include "JsonSerializer.h"
+
+FFrameBenchmarkSettings FFrameBenchmark::Settings;
+
+namespace
+{
+	// "-key=value" 또는 "-key" 토큰 (따옴표로 감싼 값 허용)
+	TArray<TPair<FString, FString>> TokenizeCommandLine(const char* CommandLine)
+	{
+		TArray<TPair<FString, FString>> Tokens;
+		if (!CommandLine)
+		{
+			return Tokens;
+		}
+
+		const FString Line = CommandLine;
+		size_t Pos = 0;
+		while (Pos < Line.size())
+		{
+			while (Pos < Line.size() && std::isspace(static_cast<unsigned char>(Line[Pos])))
+			{
+				++Pos;
+			}
+			if (Pos >= Line.size())
+			{
+				break;
+			}
+
+			FString Token;
+			bool bInQuotes = false;
+			while (Pos < Line.size() && (bInQuotes || !std::isspace(static_cast<unsigned char>(Line[Pos]))))
+			{
+				if (Line[Pos] == '"')
+				{
+					bInQuotes = !bInQuotes;
+				}
+				else
+				{
+					Token += Line[Pos];
+				}
+				++Pos;
+			}
+
+			while (!Token.empty() && (Token[0] == '-' || Token[0] == '/'))
+			{
+				Token.erase(0, 1);
+			}
+			const size_t Equals = Token.find('=');
+			FString Key = Token.substr(0, Equals);
+			std::transform(Key.begin(), Key.end(), Key.begin(), [](unsigned char C) { return static_cast<char>(std::tolower(C)); });
+			Tokens.Add({ Key, Equals == FString::npos ? FString() : Token.substr(Equals + 1) });
+		}
+		return Tokens;
+	}
+
+	JSON MakeStatsJson(TArray<double> Samples)
+	{
+		JSON Obj = JSON::Make(JSON::Class::Object);
+		if (Samples.IsEmpty())
+		{
+			return Obj;
+		}
+
+		std::sort(Samples.begin(), Samples.end());
+		double Sum = 0.0;
+		for (double Sample : Samples)
+		{
+			Sum += Sample;
+		}
+		auto Percentile = [&Samples](double P)
+		{
+			const size_t Index = static_cast<size_t>(P * static_cast<double>(Samples.size() - 1) + 0.5);
+			return Samples[std::min(Index, Samples.size() - 1)];
+		};
+
+		Obj["avgMs"] = Sum / static_cast<double>(Samples.size());
+		Obj["minMs"] = Samples.front();
+		Obj["maxMs"] = Samples.back();
+		Obj["p50Ms"] = Percentile(0.50);
+		Obj["p95Ms"] = Percentile(0.95);
+		Obj["p99Ms"] = Percentile(0.99);
+		return Obj;
+	}
+}
+
+void FFrameBenchmark::ParseCommandLine(const char* CommandLine)
+{
+	for (const TPair<FString, FString>& Token : TokenizeCommandLine(CommandLine))
+	{
+		const FString& Key = Token.first;
+		const FString& Value = Token.second;
+		try
+		{
+			if (Key == "benchmark")
+			{
+				Settings.bEnabled = true;
+				if (!Value.empty())
+				{
+					Settings.ScenePath = Value;
+				}
+			}
+			else if (Key == "nullrhi")
+			{
+				Settings.bNullRHI = true;
+			}
+			else if (Key == "frames")
+			{
+				Settings.NumFrames = std::max(1, std::stoi(Value));
+			}
+			else if (Key == "warmup")
+			{
+				Settings.NumWarmupFrames = std::max(0, std::stoi(Value));
+			}
+			else if (Key == "fixeddt")
+			{
+				Settings.FixedDeltaSeconds = std::max(1e-4f, std::stof(Value));
+			}
+			else if (Key == "res")
+			{
+				const size_t X = Value.find_first_of("xX");
+				if (X != FString::npos)
+				{
+					Settings.Width = static_cast<uint32>(std::max(1, std::stoi(Value.substr(0, X))));
+					Settings.Height = static_cast<uint32>(std::max(1, std::stoi(Value.substr(X + 1))));
+				}
+			}
+			else if (Key == "out" && !Value.empty())
+			{
+				Settings.OutputPath = Value;
+			}
+		}
+		catch (const std::exception&)
+		{
+			UE_LOG("[warning] Benchmark: invalid value for -%s: '%s'", Key.c_str(), Value.c_str());
+		}
+	}
+}
+
+void FFrameBenchmark::Begin()
+{
+	FrameMilliseconds.Empty();
+	FrameMilliseconds.Reserve(Settings.NumFrames);
+	Phases.Empty();
+	NumMeasuredFrames = 0;
+}
+
+void FFrameBenchmark::EndFrame(int32 FrameIndex, double InFrameMilliseconds)
+{
+	if (FrameIndex < Settings.NumWarmupFrames)
+	{
+		return;
+	}
+	FrameMilliseconds.Add(InFrameMilliseconds);
+
+	// 호출 전에 FCPUProfiler::EndFrame()으로 방금 프레임이 확정되어 있어야 한다
+	const FCPUFrameRecord* Frame = FCPUProfiler::Get().GetLastFrame();
+	const int32 NumStats = Frame ? Frame->Stats.Num() : 0;
+	for (int32 StatId = 0; StatId < NumStats; ++StatId)
+	{
+		const FCPUStatFrameTotal& Total = Frame->Stats[StatId];
+		const FString Key = FCPUProfiler::GetStatName(StatId);
+		if (Total.CallCount == 0 && !Phases.Contains(Key))
+		{
+			continue;
+		}
+		FPhaseSamples& Samples = Phases[Key];
+
+		// 중간 프레임부터 처음 나타난 단계는 앞 프레임을 0으로 채운다
+		if (Samples.Milliseconds.Num() < NumMeasuredFrames)
+		{
+			Samples.Milliseconds.resize(NumMeasuredFrames, 0.0);
+		}
+		Samples.Milliseconds.Add(Total.InclusiveMs);
+		Samples.TotalCalls += Total.CallCount;
+	}
+
+	++NumMeasuredFrames;
+}
+
+bool FFrameBenchmark::WriteResults() const
+{
+	double TotalMs = 0.0;
+	for (double Ms : FrameMilliseconds)
+	{
+		TotalMs += Ms;
+	}
+
+	JSON Root = JSON::Make(JSON::Class::Object);
+	Root["scene"] = Settings.ScenePath;
+	Root["frames"] = NumMeasuredFrames;
+	Root["warmupFrames"] = Settings.NumWarmupFrames;
+	Root["fixedDeltaSeconds"] = static_cast<double>(Settings.FixedDeltaSeconds);
+	Root["nullRHI"] = Settings.bNullRHI;
+	Root["width"] = static_cast<int32>(Settings.Width);
+	Root["height"] = static_cast<int32>(Settings.Height);
+	Root["totalSeconds"] = TotalMs / 1000.0;
+	Root["frame"] = MakeStatsJson(FrameMilliseconds);
+
+	// 실행마다 같은 순서로 기록되도록 단계 이름순으로 출력 (TMap 순회 순서는 일정하지 않음)
+	TArray<FString> PhaseNames = Phases.GetKeys();
+	PhaseNames.Sort();
+
+	JSON PhasesJson = JSON::Make(JSON::Class::Object);
+	for (const FString& PhaseName : PhaseNames)
+	{
+		const FPhaseSamples& Phase = *Phases.Find(PhaseName);
+		TArray<double> Samples = Phase.Milliseconds;
+		if (Samples.Num() < NumMeasuredFrames)
+		{
+			Samples.resize(NumMeasuredFrames, 0.0);
+		}
+
+		JSON PhaseJson = MakeStatsJson(std::move(Samples));
+		PhaseJson["callsPerFrame"] = NumMeasuredFrames > 0 ? static_cast<double>(Phase.TotalCalls) / NumMeasuredFrames : 0.0;
+		PhasesJson[PhaseName] = PhaseJson;
+	}
+	Root["phases"] = PhasesJson;
+
+	if (!FJsonSerializer::SaveJsonToFile(Root, UTF8ToWide(Settings.OutputPath)))
+	{
+		UE_LOG("[error] Benchmark: failed to write %s", Settings.OutputPath.c_str());
+		return false;
+	}
+
+	const double AverageMs = FrameMilliseconds.IsEmpty() ? 0.0 : TotalMs / FrameMilliseconds.Num();
+	UE_LOG("Benchmark: %d frames, avg %.3f ms -> %s", NumMeasuredFrames, AverageMs, Settings.OutputPath.c_str());
+	return true;
+}
@@ -0,0 +1,48 @@
+﻿#pragma once
+
+// 명령줄 벤치마크 설정
+// 예) Mundi.exe -benchmark=Data/Scenes/PlayScene.scene -frames=600 -warmup=60 -fixeddt=0.0166667 -res=1920x1080 -nullrhi -out=Benchmark.json
+struct FFrameBenchmarkSettings
+{
+	bool bEnabled = false;			// -benchmark
+	bool bNullRHI = false;			// -nullrhi (벤치마크가 아니어도 단독으로 쓸 수 있음)
+	FString ScenePath;				// -benchmark=<.scene>
+	int32 NumFrames = 600;			// -frames=
+	int32 NumWarmupFrames = 60;		// -warmup= (측정에서 제외, 셰이더/캐시 워밍업)
+	float FixedDeltaSeconds = 1.0f / 60.0f;	// -fixeddt=
+	uint32 Width = 1920;			// -res=WxH
+	uint32 Height = 1080;
+	FString OutputPath = "Benchmark.json";	// -out=
+};
+
+/**
+ * CPU 프레임 벤치마크 (게임 빌드 명령줄 모드)
+ * - 씬을 로드해 고정 타임스텝으로 N 프레임을 돌리고, 프레임마다 TIME_PROFILE 스코프 값을 수집
+ * - Null RHI와 함께 쓰면 GPU 대기 없이 월드 틱/애니메이션/파티클/컬링/배치 수집 비용만 측정된다
+ * - 결과는 단계별 평균/최소/최대/백분위수를 JSON으로 저장
+ */
+class FFrameBenchmark
+{
+public:
+	static void ParseCommandLine(const char* CommandLine);
+	static const FFrameBenchmarkSettings& GetSettings() { return Settings; }
+	static bool IsEnabled() { return Settings.bEnabled; }
+
+	void Begin();
+	// 한 프레임이 끝난 뒤 호출, TIME_PROFILE 누적값을 가져오고 초기화한다
+	void EndFrame(int32 FrameIndex, double FrameMilliseconds);
+	bool WriteResults() const;
+
+private:
+	struct FPhaseSamples
+	{
+		TArray<double> Milliseconds;	// 측정 프레임마다 하나 (해당 프레임에 없으면 0)
+		uint64 TotalCalls = 0;
+	};
+
+	static FFrameBenchmarkSettings Settings;
+
+	TArray<double> FrameMilliseconds;
+	TMap<FString, FPhaseSamples> Phases;
+	int32 NumMeasuredFrames = 0;
+};
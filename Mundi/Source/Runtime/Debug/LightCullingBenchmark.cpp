@@ -0,0 +1,136 @@
+﻿#include "pch.h"
+#include "LightCullingBenchmark.h"
+#include "TileLightCuller.h"
+#include "BenchmarkHarness.h"
+#include <random>
+
+namespace
+{
+	constexpr float BenchNearClip = 1.0f;
+	constexpr float BenchFarClip = 1000.0f;
+
+	// 카메라 앞쪽 공간에 라이트를 흩뿌린다 (엔진 좌표: X 전방, Z 위)
+	void GenerateLights(int32 NumLights, TArray<FPointLightInfo>& OutPointLights, TArray<FSpotLightInfo>& OutSpotLights)
+	{
+		std::mt19937 Random(1234u + static_cast<uint32>(NumLights));
+		std::uniform_real_distribution<float> Forward(0.0f, 600.0f);
+		std::uniform_real_distribution<float> Side(-300.0f, 300.0f);
+		std::uniform_real_distribution<float> Height(-150.0f, 150.0f);
+		std::uniform_real_distribution<float> Radius(5.0f, 40.0f);
+
+		OutPointLights.Empty();
+		OutSpotLights.Empty();
+		for (int32 i = 0; i < NumLights; ++i)
+		{
+			const FVector Position(Forward(Random), Side(Random), Height(Random));
+			if (i % 2 == 0)
+			{
+				FPointLightInfo Light{};
+				Light.Position = Position;
+				Light.AttenuationRadius = Radius(Random);
+				OutPointLights.Add(Light);
+			}
+			else
+			{
+				FSpotLightInfo Light{};
+				Light.Position = Position;
+				Light.Direction = FVector(1.0f, 0.0f, 0.0f);
+				Light.AttenuationRadius = Radius(Random);
+				OutSpotLights.Add(Light);
+			}
+		}
+	}
+
+	// 타일 목록이 다른 타일 수, 전체 라이트 수 차이 (Tiled - Reference)
+	void CompareLightLists(const FTileLightCuller& Reference, const FTileLightCuller& Tiled, int32& OutMismatchTiles, int64& OutLightDelta)
+	{
+		OutMismatchTiles = 0;
+		OutLightDelta = 0;
+
+		const TArray<uint32>& RefIndices = Reference.GetLightIndices();
+		const TArray<uint32>& NewIndices = Tiled.GetLightIndices();
+		const UINT Stride = Reference.GetLightListStride();
+		const UINT NumTiles = Reference.GetClusterCount();
+		if (Tiled.GetClusterCount() != NumTiles || Tiled.GetLightListStride() != Stride)
+		{
+			OutMismatchTiles = static_cast<int32>(NumTiles);
+			return;
+		}
+
+		for (UINT Tile = 0; Tile < NumTiles; ++Tile)
+		{
+			const uint32* Ref = RefIndices.GetData() + Tile * Stride;
+			const uint32* New = NewIndices.GetData() + Tile * Stride;
+			OutLightDelta += static_cast<int64>(New[0]) - static_cast<int64>(Ref[0]);
+			if (Ref[0] != New[0] || memcmp(Ref + 1, New + 1, Ref[0] * sizeof(uint32)) != 0)
+			{
+				++OutMismatchTiles;
+			}
+		}
+	}
+}
+
+void FLightCullingBenchmark::Run(int32 NumFrames)
+{
+	if (NumFrames <= 0)
+	{
+		return;
+	}
+
+	struct FResolution { UINT Width; UINT Height; };
+	const FResolution Resolutions[] = { { 1920, 1080 }, { 3840, 2160 } };
+	const int32 LightCounts[] = { 256, 1024 };
+	constexpr UINT TileSize = 16;
+	constexpr UINT ClusterSlices = 16;
+
+	FTileLightCuller Reference;
+	FTileLightCuller Tiled;
+	FTileLightCuller Clustered;
+	Reference.Initialize(nullptr, TileSize, 0);
+	Tiled.Initialize(nullptr, TileSize, 0);
+	Clustered.Initialize(nullptr, TileSize, ClusterSlices);
+
+	const FMatrix ViewMatrix = FMatrix::LookAtLH(FVector(-50.0f, 0.0f, 10.0f), FVector(100.0f, 0.0f, 0.0f), FVector(0.0f, 0.0f, 1.0f));
+
+	TArray<FPointLightInfo> PointLights;
+	TArray<FSpotLightInfo> SpotLights;
+
+	FBenchmarkHarness::LogHeader("LightCull: tile %u px, %d frames, clustered %u slices", TileSize, NumFrames, ClusterSlices);
+
+	for (const FResolution& Resolution : Resolutions)
+	{
+		const float Aspect = static_cast<float>(Resolution.Width) / static_cast<float>(Resolution.Height);
+		const FMatrix ProjMatrix = FMatrix::PerspectiveFovLH(DegreesToRadians(60.0f), Aspect, BenchNearClip, BenchFarClip);
+
+		for (int32 NumLights : LightCounts)
+		{
+			GenerateLights(NumLights, PointLights, SpotLights);
+
+			const FBenchTiming ReferenceTiming = FBenchmarkHarness::MeasureFrames(NumFrames, [&](int32)
+			{
+				Reference.BuildLightListsReference(PointLights, SpotLights, ViewMatrix, ProjMatrix, BenchNearClip, BenchFarClip, Resolution.Width, Resolution.Height);
+			});
+			const FBenchTiming TiledTiming = FBenchmarkHarness::MeasureFrames(NumFrames, [&](int32)
+			{
+				Tiled.BuildLightLists(PointLights, SpotLights, ViewMatrix, ProjMatrix, BenchNearClip, BenchFarClip, Resolution.Width, Resolution.Height);
+			});
+			const FBenchTiming ClusteredTiming = FBenchmarkHarness::MeasureFrames(NumFrames, [&](int32)
+			{
+				Clustered.BuildLightLists(PointLights, SpotLights, ViewMatrix, ProjMatrix, BenchNearClip, BenchFarClip, Resolution.Width, Resolution.Height);
+			});
+
+			int32 MismatchTiles = 0;
+			int64 LightDelta = 0;
+			CompareLightLists(Reference, Tiled, MismatchTiles, LightDelta);
+
+			FBenchmarkHarness::LogHeader("LightCull %ux%u, %d lights (%u tiles)", Resolution.Width, Resolution.Height, NumLights, Tiled.GetClusterCount());
+			FBenchmarkHarness::LogTiming("Reference serial", ReferenceTiming);
+			FBenchmarkHarness::LogTiming("Tiled parallel", TiledTiming, &ReferenceTiming);
+			FBenchmarkHarness::LogTiming("Clustered", ClusteredTiming, &ReferenceTiming);
+			FBenchmarkHarness::LogLine("Lights per tile : reference %.1f, tiled %.1f, clustered %.1f (max %u), light delta %lld",
+				Reference.GetStats().AvgLightsPerTile, Tiled.GetStats().AvgLightsPerTile,
+				Clustered.GetStats().AvgLightsPerTile, Clustered.GetStats().MaxLightsPerTile, LightDelta);
+			FBenchmarkHarness::LogMismatches("Tiled vs reference tiles", MismatchTiles, static_cast<int32>(Tiled.GetClusterCount()));
+		}
+	}
+}
@@ -0,0 +1,8 @@
+﻿#pragma once
+
+// 직렬 타일 컬링 vs 병렬 타일/클러스터 컬링 (콘솔: BENCH LIGHTCULL)
+class FLightCullingBenchmark
+{
+public:
+	static void Run(int32 NumFrames = 5);
+};
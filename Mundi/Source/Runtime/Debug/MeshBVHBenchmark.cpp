@@ -0,0 +1,133 @@
+﻿#include "pch.h"
+#include "MeshBVHBenchmark.h"
+#include "MeshBVH.h"
+#include "StaticMesh.h"
+#include "ResourceManager.h"
+#include "BenchmarkHarness.h"
+#include <random>
+
+namespace
+{
+	// 전수 검사와 비교할 레이 수 (삼각형 수에 비례해 느리므로 일부만)
+	constexpr int32 NumReferenceRays = 1000;
+
+	// 경계를 감싸는 구 위에서 출발해 경계 안쪽 임의 점을 향하는 레이
+	void GenerateRays(const FAABB& Bounds, int32 NumRays, TArray<FRay>& OutRays)
+	{
+		std::mt19937 Random(4321u);
+		std::uniform_real_distribution<float> Unit(-1.0f, 1.0f);
+		std::uniform_real_distribution<float> Fraction(0.0f, 1.0f);
+
+		const FVector Center = (Bounds.Min + Bounds.Max) * 0.5f;
+		const FVector Extent = Bounds.Max - Bounds.Min;
+		const float Radius = std::max(Extent.Size(), KINDA_SMALL_NUMBER) * 1.5f;
+
+		OutRays.Empty();
+		OutRays.Reserve(NumRays);
+		for (int32 i = 0; i < NumRays; ++i)
+		{
+			FVector OnSphere(Unit(Random), Unit(Random), Unit(Random));
+			const float Length = OnSphere.Size();
+			OnSphere = Length > KINDA_SMALL_NUMBER ? OnSphere / Length : FVector(1.0f, 0.0f, 0.0f);
+
+			const FVector Target(
+				Bounds.Min.X + Extent.X * Fraction(Random),
+				Bounds.Min.Y + Extent.Y * Fraction(Random),
+				Bounds.Min.Z + Extent.Z * Fraction(Random));
+			const FVector Origin = Center + OnSphere * Radius;
+			FVector Direction = Target - Origin;
+			Direction.Normalize();
+			OutRays.Add(FRay{ Origin, Direction });
+		}
+	}
+
+	bool IntersectBruteForce(const FRay& Ray, const FStaticMesh& Mesh, float& OutDistance)
+	{
+		bool bHit = false;
+		float Closest = FLT_MAX;
+		const int32 NumTriangles = Mesh.Indices.Num() / 3;
+		for (int32 TriangleID = 0; TriangleID < NumTriangles; ++TriangleID)
+		{
+			float HitT = 0.0f;
+			if (IntersectRayTriangleMT(Ray,
+				Mesh.Vertices[Mesh.Indices[3 * TriangleID + 0]].pos,
+				Mesh.Vertices[Mesh.Indices[3 * TriangleID + 1]].pos,
+				Mesh.Vertices[Mesh.Indices[3 * TriangleID + 2]].pos, HitT) && HitT < Closest)
+			{
+				Closest = HitT;
+				bHit = true;
+			}
+		}
+		OutDistance = Closest;
+		return bHit;
+	}
+}
+
+void FMeshBVHBenchmark::Run(int32 NumRays)
+{
+	if (NumRays <= 0)
+	{
+		return;
+	}
+
+	const char* MeshNames[] = { "SHC.obj", "CGC.obj", "katana2.obj", "SmoothSphere.obj", "Car.obj" };
+
+	FBenchmarkHarness::LogHeader("MeshBVH: %d rays per mesh, %d reference rays", NumRays, NumReferenceRays);
+
+	TArray<FRay> Rays;
+	for (const char* MeshName : MeshNames)
+	{
+		const FString MeshPath = GDataDir + "/Model/" + MeshName;
+		UStaticMesh* StaticMesh = UResourceManager::GetInstance().Load<UStaticMesh>(MeshPath);
+		FStaticMesh* Mesh = StaticMesh ? StaticMesh->GetStaticMeshAsset() : nullptr;
+		if (!Mesh || Mesh->Indices.Num() < 3)
+		{
+			FBenchmarkHarness::LogLine("FAIL : could not load %s", MeshPath.c_str());
+			continue;
+		}
+
+		FMeshBVH BVH;
+		FScopeCycleCounter BuildCounter;
+		BVH.Build(Mesh->Vertices, Mesh->Indices);
+		const double BuildMs = BuildCounter.Finish();
+
+		GenerateRays(StaticMesh->GetLocalBound(), NumRays, Rays);
+
+		int32 NumHits = 0;
+		FScopeCycleCounter TraceCounter;
+		for (const FRay& Ray : Rays)
+		{
+			float HitDistance;
+			NumHits += BVH.IntersectRay(Ray, HitDistance) ? 1 : 0;
+		}
+		const double TraceMs = TraceCounter.Finish();
+
+		// 전수 검사 기준 (히트 여부 + 최근접 거리)
+		const int32 NumCompared = std::min(NumReferenceRays, Rays.Num());
+		int32 NumMismatches = 0;
+		FScopeCycleCounter ReferenceCounter;
+		for (int32 i = 0; i < NumCompared; ++i)
+		{
+			float ReferenceDistance;
+			const bool bReferenceHit = IntersectBruteForce(Rays[i], *Mesh, ReferenceDistance);
+
+			float HitDistance;
+			const bool bHit = BVH.IntersectRay(Rays[i], HitDistance);
+			if (bHit != bReferenceHit || (bHit && std::abs(HitDistance - ReferenceDistance) > 1e-4f * std::max(1.0f, ReferenceDistance)))
+			{
+				++NumMismatches;
+			}
+		}
+		const double ReferenceMs = ReferenceCounter.Finish();
+
+		const double RaysPerSecond = TraceMs > 0.0 ? NumRays / (TraceMs * 0.001) : 0.0;
+		const double ReferenceRaysPerSecond = ReferenceMs > 0.0 ? NumCompared / (ReferenceMs * 0.001) : 0.0;
+		const double MemoryKB = (BVH.GetNumNodes() * sizeof(FMeshBVHNode) + BVH.GetNumBlocks() * sizeof(FMeshBVHTriangleBlock)) / 1024.0;
+
+		FBenchmarkHarness::LogHeader("MeshBVH %s: %u tris | build %.2f ms | %d nodes, %d blocks, depth %u, %.0f KB",
+			MeshName, BVH.GetNumTriangles(), BuildMs, BVH.GetNumNodes(), BVH.GetNumBlocks(), BVH.GetMaxDepth(), MemoryKB);
+		FBenchmarkHarness::LogLine("Trace : %.2f ms (%.2f Mrays/s, hit %.1f%%), brute force %.0f rays/s",
+			TraceMs, RaysPerSecond / 1e6, 100.0 * NumHits / NumRays, ReferenceRaysPerSecond);
+		FBenchmarkHarness::LogMismatches("BVH vs brute force", NumMismatches, NumCompared);
+	}
+}
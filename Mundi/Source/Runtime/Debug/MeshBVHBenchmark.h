@@ -0,0 +1,8 @@
+﻿#pragma once
+
+// 메시 BVH 빌드/레이 처리량, 전수 검사와 비교 (콘솔: BENCH MESHBVH)
+class FMeshBVHBenchmark
+{
+public:
+	static void Run(int32 NumRays = 200000);
+};
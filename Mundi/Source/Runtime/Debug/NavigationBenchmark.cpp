@@ -0,0 +1,156 @@
+﻿#include "pch.h"
+#include "NavigationBenchmark.h"
+#include "BenchmarkHarness.h"
+#include "Source/Runtime/Engine/Navigation/NavMeshBuilder.h"
+#include "Source/Runtime/Engine/Navigation/NavPathQueryService.h"
+#include <random>
+
+namespace
+{
+	constexpr float GroundHalfSize = 40.0f;
+	constexpr int32 PillarGrid = 14;
+	constexpr float PillarSpacing = 5.0f;
+
+	// 80m x 80m 바닥 + 기둥 격자 (MovedPillar번 기둥만 PillarOffset만큼 옮김)
+	void BuildScene(FNavGeometry& Geometry, int32 MovedPillar, const FVector& PillarOffset)
+	{
+		Geometry.Reset();
+		Geometry.AddBox(FVector(0.0f, 0.0f, -0.5f), FVector(GroundHalfSize, GroundHalfSize, 0.5f), FQuat::Identity());
+
+		const float GridOrigin = -(PillarGrid - 1) * PillarSpacing * 0.5f;
+		for (int32 Y = 0; Y < PillarGrid; ++Y)
+		{
+			for (int32 X = 0; X < PillarGrid; ++X)
+			{
+				const int32 Index = Y * PillarGrid + X;
+				FVector Center(GridOrigin + X * PillarSpacing, GridOrigin + Y * PillarSpacing, 1.0f);
+				if (Index == MovedPillar)
+				{
+					Center += PillarOffset;
+				}
+
+				// 기둥 사이사이 낮은 벽을 섞어 우회 경로를 만든다
+				const FVector HalfExtent = (Index % 5 == 0) ? FVector(2.0f, 0.3f, 1.0f) : FVector(0.75f, 0.75f, 1.0f);
+				Geometry.AddBox(Center, HalfExtent, FQuat::Identity());
+			}
+		}
+	}
+
+	struct FPassResult
+	{
+		FBenchTiming Timing;
+		int32 NumFailed = 0;
+		int64 TotalPathPoints = 0;
+		FNavPathQueryStats Stats;
+	};
+
+	FPassResult RunQueryPass(const FNavMesh& NavMesh, const TArray<FVector>& AgentStarts, int32 NumFrames, bool bBatched)
+	{
+		FNavPathQueryService Service(NavMesh);
+		Service.bParallel = bBatched;
+		Service.bCorridorReuse = bBatched;
+		Service.MaxActiveQueries = AgentStarts.Num();
+		Service.MaxIterationsPerQuery = 1 << 20;     // 프레임 안에 전부 끝내서 두 방식의 작업량을 같게 비교
+
+		const int32 NumAgents = AgentStarts.Num();
+		TArray<FVector> Agents = AgentStarts;
+		TArray<FNavPath> Paths;
+		TArray<FNavPathHandle> Handles;
+		Paths.SetNum(NumAgents);
+		Handles.SetNum(NumAgents);
+
+		FPassResult Result;
+		for (int32 Frame = 0; Frame < NumFrames; ++Frame)
+		{
+			// 목표는 원을 따라 천천히 이동
+			const float Angle = Frame * 0.01f;
+			const FVector Target(std::cos(Angle) * 30.0f, std::sin(Angle) * 30.0f, 0.0f);
+
+			{
+				FBenchScope Scope(Result.Timing);
+				for (int32 i = 0; i < NumAgents; ++i)
+				{
+					Handles[i] = Service.RequestPath(Agents[i], Target, &Paths[i]);
+				}
+				Service.Tick();
+				for (int32 i = 0; i < NumAgents; ++i)
+				{
+					if (!Service.ConsumePath(Handles[i], Paths[i]))
+					{
+						++Result.NumFailed;
+					}
+				}
+			}
+
+			// 에이전트는 경로를 따라 조금씩 전진
+			for (int32 i = 0; i < NumAgents; ++i)
+			{
+				const TArray<FVector>& Points = Paths[i].Points;
+				Result.TotalPathPoints += Points.Num();
+				if (Points.Num() > 1)
+				{
+					FVector ToNext = Points[1] - Agents[i];
+					ToNext.Z = 0.0f;
+					const float Distance = ToNext.Size();
+					if (Distance > KINDA_SMALL_NUMBER)
+					{
+						Agents[i] += ToNext * (std::min(0.05f, Distance) / Distance);
+					}
+				}
+			}
+		}
+
+		Result.Stats = Service.GetStats();
+		return Result;
+	}
+}
+
+void FNavigationBenchmark::Run(int32 NumAgents, int32 NumFrames)
+{
+	FNavMeshConfig Config;
+	FNavGeometry Geometry;
+	FNavMesh NavMesh;
+	FNavMeshBuilder Builder;
+
+	// 1. 새로 빌드 / 기둥 하나 이동 후 다시 빌드
+	BuildScene(Geometry, INDEX_NONE, FVector());
+	const FNavMeshBuildStats ColdStats = Builder.Build(Config, Geometry, NavMesh);
+	FBenchmarkHarness::LogHeader("Nav build (cold): %d shapes, %d tiles, %d polys, %d links, %.2fms",
+		ColdStats.NumShapes, ColdStats.NumTiles, ColdStats.NumPolys, ColdStats.NumLinks, ColdStats.BuildMs);
+
+	BuildScene(Geometry, PillarGrid * PillarGrid / 2, FVector(1.0f, 0.5f, 0.0f));
+	const FNavMeshBuildStats WarmStats = Builder.Build(Config, Geometry, NavMesh);
+	FBenchmarkHarness::LogHeader("Nav build (1 obstacle moved): %d built, %d cached, %.2fms (x%.1f)",
+		WarmStats.BuiltTiles, WarmStats.CachedTiles, WarmStats.BuildMs, FBenchmarkHarness::Speedup(ColdStats.BuildMs, WarmStats.BuildMs));
+
+	if (NavMesh.IsEmpty())
+	{
+		FBenchmarkHarness::LogHeader("Nav FAIL: navmesh is empty");
+		return;
+	}
+
+	// 2. 에이전트 시작 위치 (메시 위로 투영)
+	std::mt19937 Random(1234);
+	std::uniform_real_distribution<float> Coord(-GroundHalfSize + 2.0f, GroundHalfSize - 2.0f);
+	TArray<FVector> AgentStarts;
+	while (AgentStarts.Num() < NumAgents)
+	{
+		FVector OnMesh;
+		if (NavMesh.FindNearestPoly(FVector(Coord(Random), Coord(Random), 0.0f), 2.0f, &OnMesh) != INDEX_NONE)
+		{
+			AgentStarts.Add(OnMesh);
+		}
+	}
+
+	const FPassResult Baseline = RunQueryPass(NavMesh, AgentStarts, NumFrames, false);
+	const FPassResult Batched = RunQueryPass(NavMesh, AgentStarts, NumFrames, true);
+
+	const double TotalQueries = static_cast<double>(NumAgents) * NumFrames;
+	FBenchmarkHarness::LogHeader("Nav paths: %d agents x %d frames", NumAgents, NumFrames);
+	FBenchmarkHarness::LogTiming("Baseline (serial A*)", Baseline.Timing);
+	FBenchmarkHarness::LogLine("  %llu searched, %d failed, %.1f points/path",
+		Baseline.Stats.TotalSearched, Baseline.NumFailed, Baseline.TotalPathPoints / TotalQueries);
+	FBenchmarkHarness::LogTiming("Batched (parallel+reuse)", Batched.Timing, &Baseline.Timing);
+	FBenchmarkHarness::LogLine("  %llu reused, %llu searched, %d failed, %.1f points/path",
+		Batched.Stats.TotalReused, Batched.Stats.TotalSearched, Batched.NumFailed, Batched.TotalPathPoints / TotalQueries);
+}
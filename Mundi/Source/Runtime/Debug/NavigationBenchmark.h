@@ -0,0 +1,8 @@
+﻿#pragma once
+
+// 내비메시 증분 빌드 + 직렬 A* vs 배치 병렬 경로 탐색 (콘솔: BENCH NAV)
+class FNavigationBenchmark
+{
+public:
+	static void Run(int32 NumAgents = 500, int32 NumFrames = 120);
+};
@@ -0,0 +1,254 @@
+﻿#include "pch.h"
+#include "OcclusionCullingBenchmark.h"
+#include "Occlusion.h"
+#include "StaticMesh.h"
+#include "ResourceManager.h"
+#include "JsonSerializer.h"
+#include "BenchmarkHarness.h"
+
+namespace
+{
+	constexpr int32 BenchViewWidth = 1920;
+	constexpr int32 BenchViewHeight = 1080;
+	constexpr int32 BenchGridWidth = 512;
+
+	struct FBenchMesh
+	{
+		UStaticMesh* StaticMesh = nullptr;
+		FMatrix WorldMatrix;
+	};
+
+	struct FBenchLayout
+	{
+		TArray<FBenchMesh> Meshes;
+		FVector CameraLocation;
+		FVector CameraRotation;		// (Roll, Pitch, Yaw)
+		float FOV = 60.0f;
+		float NearClip = 0.1f;
+		float FarClip = 2000.0f;
+	};
+
+	struct FBenchComponent
+	{
+		uint32 ParentId = 0;
+		FTransform RelativeTransform;
+		FString StaticMeshPath;
+	};
+
+	FMatrix ResolveWorldMatrix(uint32 Id, const TMap<uint32, FBenchComponent>& Components, int32 Depth = 0)
+	{
+		const FBenchComponent* Component = Components.Find(Id);
+		if (!Component)
+		{
+			return FMatrix::Identity();
+		}
+
+		const FMatrix Relative = Component->RelativeTransform.ToMatrix();
+		if (Component->ParentId == 0 || Depth > 32)
+		{
+			return Relative;
+		}
+		return Relative * ResolveWorldMatrix(Component->ParentId, Components, Depth + 1);
+	}
+
+	// 씬 파일에서 스태틱 메시 컴포넌트의 월드 행렬과 에디터 카메라만 읽는다
+	bool LoadLayout(const FString& ScenePath, FBenchLayout& OutLayout)
+	{
+		JSON Root;
+		if (!FJsonSerializer::LoadJsonFromFile(Root, UTF8ToWide(ScenePath)))
+		{
+			FBenchmarkHarness::LogLine("FAIL : could not load %s", ScenePath.c_str());
+			return false;
+		}
+
+		JSON CameraJson;
+		if (FJsonSerializer::ReadObject(Root, "PerspectiveCamera", CameraJson))
+		{
+			FJsonSerializer::ReadVector(CameraJson, "Location", OutLayout.CameraLocation);
+			FJsonSerializer::ReadVector(CameraJson, "Rotation", OutLayout.CameraRotation);
+			FJsonSerializer::ReadArrayFloat(CameraJson, "FOV", OutLayout.FOV, 60.0f);
+			FJsonSerializer::ReadArrayFloat(CameraJson, "NearClip", OutLayout.NearClip, 0.1f);
+			FJsonSerializer::ReadArrayFloat(CameraJson, "FarClip", OutLayout.FarClip, 2000.0f);
+		}
+
+		TMap<uint32, FBenchComponent> Components;
+		TArray<uint32> MeshComponentIds;
+		JSON ActorsJson;
+		if (FJsonSerializer::ReadObject(Root, "Actors", ActorsJson))
+		{
+			for (auto& Pair : ActorsJson.ObjectRange())
+			{
+				JSON ComponentsJson;
+				if (!FJsonSerializer::ReadArray(Pair.second, "OwnedComponents", ComponentsJson, nullptr, false))
+				{
+					continue;
+				}
+
+				for (uint32 i = 0; i < static_cast<uint32>(ComponentsJson.size()); ++i)
+				{
+					JSON ComponentJson = ComponentsJson.at(i);
+					uint32 Id = 0;
+					if (!FJsonSerializer::ReadUint32(ComponentJson, "Id", Id, 0, false))
+					{
+						continue;
+					}
+
+					FBenchComponent Component;
+					FVector Location, RotationEuler, Scale;
+					FJsonSerializer::ReadUint32(ComponentJson, "ParentId", Component.ParentId, 0, false);
+					FJsonSerializer::ReadVector(ComponentJson, "RelativeLocation", Location, FVector::Zero(), false);
+					FJsonSerializer::ReadVector(ComponentJson, "RelativeRotationEuler", RotationEuler, FVector::Zero(), false);
+					FJsonSerializer::ReadVector(ComponentJson, "RelativeScale", Scale, FVector(1.0f, 1.0f, 1.0f), false);
+					Component.RelativeTransform = FTransform(Location, FQuat::MakeFromEulerZYX(RotationEuler), Scale);
+
+					FString Type;
+					FJsonSerializer::ReadString(ComponentJson, "Type", Type, "", false);
+					if (Type == "UStaticMeshComponent")
+					{
+						FJsonSerializer::ReadString(ComponentJson, "StaticMesh", Component.StaticMeshPath, "", false);
+						if (!Component.StaticMeshPath.empty())
+						{
+							MeshComponentIds.Add(Id);
+						}
+					}
+					Components.Add(Id, Component);
+				}
+			}
+		}
+
+		for (uint32 Id : MeshComponentIds)
+		{
+			FBenchMesh Mesh;
+			Mesh.StaticMesh = UResourceManager::GetInstance().Load<UStaticMesh>(Components[Id].StaticMeshPath);
+			if (Mesh.StaticMesh && Mesh.StaticMesh->GetStaticMeshAsset())
+			{
+				Mesh.WorldMatrix = ResolveWorldMatrix(Id, Components);
+				OutLayout.Meshes.Add(Mesh);
+			}
+		}
+		return !OutLayout.Meshes.IsEmpty();
+	}
+
+	FAABB TransformBound(const FAABB& LocalBound, const FMatrix& WorldMatrix)
+	{
+		FVector Min(FLT_MAX, FLT_MAX, FLT_MAX);
+		FVector Max(-FLT_MAX, -FLT_MAX, -FLT_MAX);
+		for (int32 Corner = 0; Corner < 8; ++Corner)
+		{
+			const FVector Local(
+				(Corner & 1) ? LocalBound.Max.X : LocalBound.Min.X,
+				(Corner & 2) ? LocalBound.Max.Y : LocalBound.Min.Y,
+				(Corner & 4) ? LocalBound.Max.Z : LocalBound.Min.Z);
+			const FVector World = Local * WorldMatrix;
+			Min = FVector(std::min(Min.X, World.X), std::min(Min.Y, World.Y), std::min(Min.Z, World.Z));
+			Max = FVector(std::max(Max.X, World.X), std::max(Max.Y, World.Y), std::max(Max.Z, World.Z));
+		}
+		return FAABB(Min, Max);
+	}
+}
+
+void FOcclusionCullingBenchmark::Run(int32 NumFrames)
+{
+	if (NumFrames <= 0)
+	{
+		return;
+	}
+
+	const char* SceneNames[] = { "DemoScene", "TESTSCENE" };
+	const int32 TileCounts[] = { 1, 4, 8 };
+
+	FOcclusionCullingManagerCPU Culler;
+	Culler.Initialize(BenchGridWidth, BenchGridWidth * BenchViewHeight / BenchViewWidth);
+
+	FBenchmarkHarness::LogHeader("Occlusion: %dx%d view, %dx%d depth, %d frames",
+		BenchViewWidth, BenchViewHeight, Culler.GetGrid().GetWidth(), Culler.GetGrid().GetHeight(), NumFrames);
+
+	for (const char* SceneName : SceneNames)
+	{
+		FBenchLayout Layout;
+		if (!LoadLayout(GDataDir + "/Scenes/" + SceneName + ".scene", Layout))
+		{
+			continue;
+		}
+
+		// 에디터 카메라와 같은 축/순서 (Pitch = Y축, Yaw = Z축)
+		const FQuat CameraRotation =
+			FQuat::FromAxisAngle(FVector(0.0f, 0.0f, 1.0f), DegreesToRadians(Layout.CameraRotation.Z)) *
+			FQuat::FromAxisAngle(FVector(0.0f, 1.0f, 0.0f), DegreesToRadians(Layout.CameraRotation.Y));
+		const FVector Forward = CameraRotation.RotateVector(FVector(1.0f, 0.0f, 0.0f));
+		const FMatrix ViewMatrix = FMatrix::LookAtLH(Layout.CameraLocation, Layout.CameraLocation + Forward, FVector(0.0f, 0.0f, 1.0f));
+		const FMatrix ProjMatrix = FMatrix::PerspectiveFovLH(DegreesToRadians(Layout.FOV),
+			static_cast<float>(BenchViewWidth) / static_cast<float>(BenchViewHeight), Layout.NearClip, Layout.FarClip);
+		const FMatrix ViewProj = ViewMatrix * ProjMatrix;
+
+		// 배치 전체 경계 (반복 간격)
+		TArray<FAABB> LocalLayoutBounds;
+		FVector LayoutMin(FLT_MAX, FLT_MAX, FLT_MAX), LayoutMax(-FLT_MAX, -FLT_MAX, -FLT_MAX);
+		for (const FBenchMesh& Mesh : Layout.Meshes)
+		{
+			const FAABB Bound = TransformBound(Mesh.StaticMesh->GetLocalBound(), Mesh.WorldMatrix);
+			LocalLayoutBounds.Add(Bound);
+			LayoutMin = FVector(std::min(LayoutMin.X, Bound.Min.X), std::min(LayoutMin.Y, Bound.Min.Y), 0.0f);
+			LayoutMax = FVector(std::max(LayoutMax.X, Bound.Max.X), std::max(LayoutMax.Y, Bound.Max.Y), 0.0f);
+		}
+		const FVector Spacing = LayoutMax - LayoutMin;
+
+		for (int32 Tiles : TileCounts)
+		{
+			TArray<FCandidateDrawable> Candidates;
+			TArray<FOccluderInstance> AllOccluders;
+			for (int32 TileY = 0; TileY < Tiles; ++TileY)
+			{
+				for (int32 TileX = 0; TileX < Tiles; ++TileX)
+				{
+					// 카메라가 있는 원래 배치를 중심으로 반복
+					const FVector Offset(Spacing.X * (TileX - Tiles / 2), Spacing.Y * (TileY - Tiles / 2), 0.0f);
+					const FMatrix OffsetMatrix = FMatrix::MakeTranslation(Offset);
+					for (int32 i = 0; i < Layout.Meshes.Num(); ++i)
+					{
+						FCandidateDrawable Candidate;
+						Candidate.ActorIndex = static_cast<uint32>(Candidates.Num());
+						Candidate.Bound = FAABB(LocalLayoutBounds[i].Min + Offset, LocalLayoutBounds[i].Max + Offset);
+						Candidate.WorldViewProj = ViewProj;
+						Candidates.Add(Candidate);
+
+						FOccluderInstance Occluder;
+						Occluder.Mesh = Culler.GetOccluderMesh(Layout.Meshes[i].StaticMesh->GetStaticMeshAsset());
+						Occluder.WorldViewProj = Layout.Meshes[i].WorldMatrix * OffsetMatrix * ViewProj;
+						const float Radius = (Candidate.Bound.Max - Candidate.Bound.Min).Size() * 0.5f;
+						Occluder.ScreenSize = Radius / std::max(FVector::Distance(Candidate.Bound.GetCenter(), Layout.CameraLocation), Layout.NearClip);
+						AllOccluders.Add(Occluder);
+					}
+				}
+			}
+
+			double SelectMs = 0.0, RasterMs = 0.0, HZBMs = 0.0, TestMs = 0.0;
+			TArray<FOccluderInstance> Occluders;
+			TArray<uint8_t> VisibleFlags;
+			for (int32 Frame = 0; Frame < NumFrames; ++Frame)
+			{
+				FScopeCycleCounter SelectCounter;
+				Occluders = AllOccluders;
+				FOcclusionCullingManagerCPU::SelectOccluders(Occluders);
+				SelectMs += SelectCounter.Finish();
+
+				VisibleFlags.assign(Candidates.Num(), 1);
+				Culler.BuildOccluderDepth(Occluders);
+				Culler.BuildHZB();
+				Culler.TestOcclusion(Candidates, VisibleFlags);
+
+				RasterMs += Culler.GetStats().RasterMs;
+				HZBMs += Culler.GetStats().HZBMs;
+				TestMs += Culler.GetStats().TestMs;
+			}
+
+			const FOcclusionStats& Stats = Culler.GetStats();
+			FBenchmarkHarness::LogHeader("Occlusion %s x%d (%d candidates)", SceneName, Tiles * Tiles, Candidates.Num());
+			FBenchmarkHarness::LogLine("Occluders : %u (%u triangles after clip/backface)", Stats.NumOccluders, Stats.NumOccluderTriangles);
+			FBenchmarkHarness::LogLine("Culled : %u occluded, %u offscreen, %u visible",
+				Stats.NumOccluded, Stats.NumOffscreen, Stats.NumCandidates - Stats.NumOccluded - Stats.NumOffscreen);
+			FBenchmarkHarness::LogLine("Time (avg) : select %.3f ms, raster %.3f ms, HZB %.3f ms, test %.3f ms",
+				SelectMs / NumFrames, RasterMs / NumFrames, HZBMs / NumFrames, TestMs / NumFrames);
+		}
+	}
+}
@@ -0,0 +1,8 @@
+﻿#pragma once
+
+// 씬 파일 배치 반복 기준 CPU 오클루전 컬링 (콘솔: BENCH OCCLUSION)
+class FOcclusionCullingBenchmark
+{
+public:
+	static void Run(int32 NumFrames = 5);
+};
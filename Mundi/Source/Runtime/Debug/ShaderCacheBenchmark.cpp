@@ -0,0 +1,198 @@
+﻿#include "pch.h"
+#include "ShaderCacheBenchmark.h"
+#include "ShaderCompiler.h"
+#include "SceneView.h"
+#include "BenchmarkHarness.h"
+#include <map>
+
+namespace
+{
+	const FString BenchShaderPath = "Shaders/Materials/UberLit.hlsl";
+
+	// 지연 후 입력에서 유도한 바이트를 돌려주는 스텁 (워커에서 동시에 호출됨)
+	class FStubShaderCompileBackend : public IShaderCompileBackend
+	{
+	public:
+		explicit FStubShaderCompileBackend(float InCompileMs) : CompileMs(InCompileMs) {}
+
+		bool Compile(const FShaderCompileInput& Input, FShaderCompileOutput& Output) override
+		{
+			++NumCalls;
+			std::this_thread::sleep_for(std::chrono::microseconds(static_cast<int64>(CompileMs * 1000.0f)));
+			MakeBytecode(Input, Output.Bytecode);
+			return true;
+		}
+
+		static void MakeBytecode(const FShaderCompileInput& Input, TArray<uint8>& OutBytecode)
+		{
+			uint64 Hash = FShaderBytecodeCache::HashBytes(Input.EntryPoint.data(), Input.EntryPoint.size());
+			for (const TPair<FString, FString>& Define : Input.Defines)
+			{
+				Hash = FShaderBytecodeCache::HashBytes(Define.first.data(), Define.first.size(), Hash);
+				Hash = FShaderBytecodeCache::HashBytes(Define.second.data(), Define.second.size(), Hash);
+			}
+
+			OutBytecode.SetNum(256);
+			for (int32 i = 0; i < OutBytecode.Num(); ++i)
+			{
+				Hash = Hash * 6364136223846793005ull + 1442695040888963407ull;
+				OutBytecode[i] = static_cast<uint8>(Hash >> 56);
+			}
+		}
+
+		std::atomic<int32> NumCalls{ 0 };
+
+	private:
+		float CompileMs;
+	};
+
+	// UShader::BuildStageCompiles와 같은 규칙 (VS + PS, 정렬된 Define)
+	void BuildStages(FShaderBytecodeCache& Cache, const TArray<FShaderMacro>& Macros, uint32 CompileFlags, TArray<FShaderStageCompile>& OutStages)
+	{
+		std::map<FString, FString> SortedDefines;
+		for (const FShaderMacro& Macro : Macros)
+		{
+			SortedDefines[Macro.Name.ToString()] = Macro.Definition.ToString();
+		}
+
+		static const char* EntryPoints[2][2] = { { "mainVS", "vs_5_0" }, { "mainPS", "ps_5_0" } };
+		for (const auto& Entry : EntryPoints)
+		{
+			FShaderStageCompile& Stage = OutStages.emplace_back();
+			Stage.Input.SourcePath = BenchShaderPath;
+			Stage.Input.EntryPoint = Entry[0];
+			Stage.Input.Target = Entry[1];
+			Stage.Input.CompileFlags = CompileFlags;
+			for (const auto& Define : SortedDefines)
+			{
+				Stage.Input.Defines.emplace_back(Define.first, Define.second);
+			}
+			Stage.CacheKey = Cache.MakeKey(Stage.Input, TArray<FString>());
+		}
+	}
+
+	TArray<TArray<FShaderMacro>> GetBenchMacroSets()
+	{
+		TArray<TArray<FShaderMacro>> MacroSets;
+		for (const TArray<FShaderMacro>& ViewMacros : FSceneView::GetAllViewShaderMacroSets())
+		{
+			MacroSets.Add(ViewMacros);
+			TArray<FShaderMacro> Instanced = ViewMacros;
+			Instanced.Add(FShaderMacro{ "USE_INSTANCING", "1" });
+			MacroSets.Add(std::move(Instanced));
+		}
+		return MacroSets;
+	}
+}
+
+void FShaderCacheBenchmark::Run(float SimulatedCompileMs)
+{
+	const FString CacheDir = GCacheDir + "/ShaderCacheBench";
+	std::error_code Error;
+	std::filesystem::remove_all(CacheDir, Error);
+
+	const TArray<TArray<FShaderMacro>> MacroSets = GetBenchMacroSets();
+	const int32 NumWorkers = std::clamp(static_cast<int32>(std::thread::hardware_concurrency()) / 2, 1, 4);
+	FBenchmarkHarness::LogHeader("ShaderCache: %s, %d variants x 2 stages, stub compile %.1f ms, %d workers",
+		BenchShaderPath.c_str(), MacroSets.Num(), SimulatedCompileMs, NumWorkers);
+
+	// 1. 콜드 동기 컴파일 (워커 없음)
+	double SyncMs = 0.0;
+	{
+		FStubShaderCompileBackend Backend(SimulatedCompileMs);
+		FShaderCompileManager Manager(&Backend, CacheDir, 0);
+
+		FScopeCycleCounter Counter;
+		for (const TArray<FShaderMacro>& Macros : MacroSets)
+		{
+			TArray<FShaderStageCompile> Stages;
+			BuildStages(Manager.GetCache(), Macros, 0, Stages);
+			Manager.CompileSync(Stages);
+		}
+		SyncMs = Counter.Finish();
+		FBenchmarkHarness::LogLine("Cold sync : %.2f ms (backend calls %d)", SyncMs, Backend.NumCalls.load());
+	}
+	std::filesystem::remove_all(CacheDir, Error);
+
+	// 2. 콜드 백그라운드 컴파일
+	{
+		FStubShaderCompileBackend Backend(SimulatedCompileMs);
+		FShaderCompileManager Manager(&Backend, CacheDir, NumWorkers);
+
+		int32 NumCallbacks = 0;
+		int32 Owner = 0;
+		FScopeCycleCounter Counter;
+		for (const TArray<FShaderMacro>& Macros : MacroSets)
+		{
+			TArray<FShaderStageCompile> Stages;
+			BuildStages(Manager.GetCache(), Macros, 0, Stages);
+			Manager.SubmitAsync(&Owner, std::move(Stages), [&NumCallbacks](TArray<FShaderStageCompile>&) { ++NumCallbacks; });
+		}
+		FScopeCycleCounter WaitCounter;
+		Manager.WaitForAll();
+		const double WaitMs = WaitCounter.Finish();
+		const double AsyncMs = Counter.Finish();
+		FBenchmarkHarness::LogLine("Cold async : %.2f ms (submit %.3f ms, x%.2f, callbacks %d/%d, backend calls %d)",
+			AsyncMs, AsyncMs - WaitMs, FBenchmarkHarness::Speedup(SyncMs, AsyncMs), NumCallbacks, MacroSets.Num(), Backend.NumCalls.load());
+	}
+
+	// 3. 웜 (새 매니저 = 재시작, 디스크 캐시에서만 로드)
+	{
+		FStubShaderCompileBackend Backend(SimulatedCompileMs);
+		FShaderCompileManager Manager(&Backend, CacheDir, NumWorkers);
+
+		int32 NumMisses = 0;
+		int32 NumMismatches = 0;
+		FScopeCycleCounter Counter;
+		TArray<TArray<FShaderStageCompile>> Loaded;
+		Loaded.Reserve(MacroSets.Num());
+		for (const TArray<FShaderMacro>& Macros : MacroSets)
+		{
+			TArray<FShaderStageCompile>& Stages = Loaded.emplace_back();
+			BuildStages(Manager.GetCache(), Macros, 0, Stages);
+			if (!Manager.LoadFromCache(Stages))
+			{
+				++NumMisses;
+			}
+		}
+		const double WarmMs = Counter.Finish();
+
+		for (const TArray<FShaderStageCompile>& Stages : Loaded)
+		{
+			for (const FShaderStageCompile& Stage : Stages)
+			{
+				TArray<uint8> Expected;
+				FStubShaderCompileBackend::MakeBytecode(Stage.Input, Expected);
+				NumMismatches += (Stage.Bytecode != Expected) ? 1 : 0;
+			}
+		}
+		FBenchmarkHarness::LogLine("Warm : %.2f ms (misses %d, backend calls %d)", WarmMs, NumMisses, Backend.NumCalls.load());
+		FBenchmarkHarness::LogMismatches("Cached bytecode", NumMismatches, MacroSets.Num() * 2);
+
+		// 4. 컴파일 플래그가 바뀌면 모든 키가 달라져야 한다
+		int32 NumStaleHits = 0;
+		for (const TArray<FShaderMacro>& Macros : MacroSets)
+		{
+			TArray<FShaderStageCompile> Stages;
+			BuildStages(Manager.GetCache(), Macros, D3DCOMPILE_SKIP_OPTIMIZATION, Stages);
+			NumStaleHits += Manager.IsCached(Stages) ? 1 : 0;
+		}
+		FBenchmarkHarness::LogCheck("Invalidate on flag change", NumStaleHits == 0, "stale hits %d", NumStaleHits);
+
+		// 5. Owner를 취소하면 결과는 캐시에만 남고 콜백은 불리지 않는다
+		int32 NumCallbacks = 0;
+		int32 Owner = 0;
+		for (const TArray<FShaderMacro>& Macros : MacroSets)
+		{
+			TArray<FShaderStageCompile> Stages;
+			BuildStages(Manager.GetCache(), Macros, D3DCOMPILE_SKIP_OPTIMIZATION, Stages);
+			Manager.SubmitAsync(&Owner, std::move(Stages), [&NumCallbacks](TArray<FShaderStageCompile>&) { ++NumCallbacks; });
+		}
+		Manager.CancelJobs(&Owner);
+		Manager.WaitForAll();
+		FBenchmarkHarness::LogCheck("Cancel", NumCallbacks == 0 && Manager.GetNumPendingJobs() == 0,
+			"callbacks %d, pending %d", NumCallbacks, Manager.GetNumPendingJobs());
+	}
+
+	std::filesystem::remove_all(CacheDir, Error);
+}
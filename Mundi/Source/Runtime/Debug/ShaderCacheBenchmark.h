@@ -0,0 +1,8 @@
+﻿#pragma once
+
+// 스텁 컴파일러로 셰이더 캐시 콜드/웜/무효화/취소 검사 (콘솔: BENCH SHADERCACHE)
+class FShaderCacheBenchmark
+{
+public:
+	static void Run(float SimulatedCompileMs = 20.0f);
+};
@@ -0,0 +1,129 @@
+﻿#include "pch.h"
+#include "TransformBenchmark.h"
+#include "SceneComponent.h"
+#include "BenchmarkHarness.h"
+
+namespace
+{
+	// 이전 GetWorldTransform과 동일한 재귀 계산 (비교 기준)
+	FTransform LegacyWorldTransform(const USceneComponent* Comp)
+	{
+		const FTransform Relative(Comp->GetRelativeLocation(), Comp->GetRelativeRotation(), Comp->GetRelativeScale());
+		if (const USceneComponent* Parent = Comp->GetAttachParent())
+		{
+			return LegacyWorldTransform(Parent).GetWorldTransform(Relative);
+		}
+		return Relative;
+	}
+
+	// 결과가 최적화로 사라지지 않도록 누적
+	float Consume(const FVector& Location, const FQuat& Rotation, const FVector& Scale, const FMatrix& Matrix)
+	{
+		return Location.X + Rotation.W + Scale.Z + Matrix.M[3][0];
+	}
+
+	void MoveRoots(const TArray<USceneComponent*>& Roots, int32 Frame)
+	{
+		const FVector Offset(0.01f, 0.0f, 0.0f);
+		const FQuat Spin = FQuat::FromAxisAngle(FVector(0, 0, 1), 0.01f);
+		for (int32 i = 0; i < Roots.Num(); ++i)
+		{
+			// 절반만 움직여 깨끗한 서브트리가 섞이도록 한다
+			if ((i + Frame) % 2 == 0)
+			{
+				Roots[i]->AddRelativeLocation(Offset);
+				Roots[i]->AddRelativeRotation(Spin);
+			}
+		}
+	}
+}
+
+void FTransformBenchmark::Run(int32 NumComponents, int32 Depth, int32 NumFrames)
+{
+	if (NumComponents <= 0 || Depth <= 0 || NumFrames <= 0)
+	{
+		return;
+	}
+
+	const int32 NumChains = (NumComponents + Depth - 1) / Depth;
+	TArray<USceneComponent*> Roots;
+	TArray<USceneComponent*> All;
+	Roots.Reserve(NumChains);
+	All.Reserve(NumChains * Depth);
+
+	for (int32 ChainIndex = 0; ChainIndex < NumChains; ++ChainIndex)
+	{
+		USceneComponent* Parent = nullptr;
+		for (int32 Level = 0; Level < Depth; ++Level)
+		{
+			USceneComponent* Comp = NewObject<USceneComponent>();
+			Comp->SetRelativeLocation(FVector(1.0f, 0.5f * Level, 0.0f));
+			Comp->SetRelativeRotation(FQuat::FromAxisAngle(FVector(0, 0, 1), 0.1f * Level));
+			Comp->SetRelativeScale(FVector(1.01f, 1.01f, 1.01f));
+			if (Parent)
+			{
+				Comp->SetupAttachment(Parent, EAttachmentRule::KeepRelative);
+			}
+			else
+			{
+				Roots.Add(Comp);
+			}
+			All.Add(Comp);
+			Parent = Comp;
+		}
+	}
+
+	float Sink = 0.0f;
+
+	// Legacy: 조회마다 체인 전체 재귀
+	FBenchTiming Legacy;
+	for (int32 Frame = 0; Frame < NumFrames; ++Frame)
+	{
+		MoveRoots(Roots, Frame);
+		FBenchScope Scope(Legacy);
+		for (const USceneComponent* Comp : All)
+		{
+			const FVector Location = LegacyWorldTransform(Comp).Translation;
+			const FQuat Rotation = LegacyWorldTransform(Comp).Rotation;
+			const FVector Scale = LegacyWorldTransform(Comp).Scale3D;
+			const FMatrix Matrix = LegacyWorldTransform(Comp).ToMatrix();
+			Sink += Consume(Location, Rotation, Scale, Matrix);
+		}
+	}
+
+	// Cached: 배치 패스로 더티 서브트리만 확정 후 캐시 조회
+	FBenchTiming Cached;
+	FBenchTiming Update;
+	for (int32 Frame = 0; Frame < NumFrames; ++Frame)
+	{
+		MoveRoots(Roots, Frame);
+		FBenchScope Scope(Cached);
+		{
+			FBenchScope UpdateScope(Update);
+			USceneComponent::UpdateWorldTransforms(Roots);
+		}
+		for (const USceneComponent* Comp : All)
+		{
+			Sink += Consume(Comp->GetWorldLocation(), Comp->GetWorldRotation(), Comp->GetWorldScale(), Comp->GetWorldMatrix());
+		}
+	}
+
+	float MaxError = 0.0f;
+	for (const USceneComponent* Comp : All)
+	{
+		const FVector Delta = Comp->GetWorldLocation() - LegacyWorldTransform(Comp).Translation;
+		MaxError = std::max(MaxError, std::max(std::abs(Delta.X), std::max(std::abs(Delta.Y), std::abs(Delta.Z))));
+	}
+
+	FBenchmarkHarness::LogHeader("Transform: %d components, depth %d, %d frames", All.Num(), Depth, NumFrames);
+	FBenchmarkHarness::LogTiming("Legacy recursive", Legacy);
+	FBenchmarkHarness::LogTiming("Cached", Cached, &Legacy);
+	FBenchmarkHarness::LogLine("Update pass : %.3f ms/frame (sink %f)", Update.GetAverageMs(), Sink);
+	FBenchmarkHarness::LogCheck("Cache matches recursive", MaxError < 1e-3f, "max location error %f", MaxError);
+
+	// 루트 삭제 시 자식은 소멸자에서 함께 정리된다
+	for (USceneComponent* Root : Roots)
+	{
+		Root->DestroyComponent();
+	}
+}
@@ -0,0 +1,8 @@
+﻿#pragma once
+
+// 재귀 월드 트랜스폼 vs 캐시 (콘솔: BENCH TRANSFORM)
+class FTransformBenchmark
+{
+public:
+	static void Run(int32 NumComponents = 10000, int32 Depth = 5, int32 NumFrames = 60);
+};
@@ -0,0 +1,230 @@
+﻿#include "pch.h"
+#include "AIDecisionScheduler.h"
+#include "CameraComponent.h"
+#include "PlatformTime.h"
+
+void FAIDecisionScheduler::RegisterAgent(AActor* Agent)
+{
+    if (!Agent || AgentIndexByActor.Contains(Agent))
+    {
+        return;
+    }
+
+    FAgentSchedule Schedule;
+    Schedule.Agent = Agent;
+    AgentIndexByActor.Add(Agent, Agents.Num());
+    Agents.Add(Schedule);
+}
+
+void FAIDecisionScheduler::UnregisterAgent(const AActor* Agent)
+{
+    const int32* Found = AgentIndexByActor.Find(Agent);
+    if (!Found)
+    {
+        return;
+    }
+
+    const int32 Index = *Found;
+    AgentIndexByActor.Remove(Agent);
+
+    const int32 LastIndex = Agents.Num() - 1;
+    if (Index != LastIndex)
+    {
+        Agents[Index] = Agents[LastIndex];
+        AgentIndexByActor[Agents[Index].Agent] = Index;
+    }
+    Agents.pop_back();
+}
+
+bool FAIDecisionScheduler::IsOutsideView(const FVector& Location) const
+{
+    const FVector ToLocation = Location - ViewLocation;
+    const float Along = FVector::Dot(ToLocation, ViewForward);
+    if (Along < 0.0f)
+    {
+        return true;    // 카메라 뒤
+    }
+
+    const float Perpendicular = (ToLocation - ViewForward * Along).Size();
+    return Perpendicular * CosConeAngle > Along * SinConeAngle;
+}
+
+float FAIDecisionScheduler::ComputeInterval(const FVector& Location, bool& bOutOffscreen) const
+{
+    bOutOffscreen = bHasView && IsOutsideView(Location);
+
+    // 플레이어가 없으면 뷰 위치를 기준으로 거리 우선순위를 매긴다
+    float Interval = Settings.MaxInterval;
+    if (bHasPlayer || bHasView)
+    {
+        const FVector& Origin = bHasPlayer ? PlayerLocation : ViewLocation;
+        const float Distance = (Location - Origin).Size();
+        const float Range = FMath::Max(Settings.FarDistance - Settings.NearDistance, KINDA_SMALL_NUMBER);
+        const float Alpha = FMath::Clamp((Distance - Settings.NearDistance) / Range, 0.0f, 1.0f);
+        Interval = Settings.MinInterval + (Settings.MaxInterval - Settings.MinInterval) * Alpha;
+    }
+
+    if (bOutOffscreen)
+    {
+        Interval = FMath::Max(Interval, Settings.OffscreenInterval);
+    }
+    return FMath::Max(Interval, 0.0f);
+}
+
+void FAIDecisionScheduler::BeginFrame(const AActor* Player, const UCameraComponent* ViewCamera)
+{
+    PublishStats();
+
+    const uint64 StartCycles = FPlatformTime::Cycles64();
+
+    bHasPlayer = Player != nullptr;
+    if (bHasPlayer)
+    {
+        PlayerLocation = Player->GetActorLocation();
+    }
+
+    bHasView = ViewCamera != nullptr && ViewCamera->GetProjectionMode() == ECameraProjectionMode::Perspective;
+    if (bHasView)
+    {
+        ViewLocation = ViewCamera->GetWorldLocation();
+        ViewForward = ViewCamera->GetForward().GetNormalized();
+
+        // 애니메이션 URO와 같은 16:9 대각선 기준 시야 원뿔
+        const float HalfFOV = FMath::Clamp(ViewCamera->GetFOV(), 1.0f, 179.0f) * 0.5f * (PI / 180.0f);
+        const float TanDiagonal = std::tan(HalfFOV) * std::sqrt(1.0f + (16.0f / 9.0f) * (16.0f / 9.0f));
+        const float ConeAngle = std::atan(TanDiagonal);
+        SinConeAngle = std::sin(ConeAngle);
+        CosConeAngle = std::cos(ConeAngle);
+    }
+
+    CurrentStats.NumAgents = static_cast<uint32>(Agents.Num());
+
+    DueScratch.Empty();
+    int32 NumForced = 0;
+    for (int32 i = 0; i < Agents.Num(); ++i)
+    {
+        FAgentSchedule& Schedule = Agents[i];
+        Schedule.bGranted = false;
+        Schedule.bForced = false;
+
+        if (!Settings.bEnabled)
+        {
+            Schedule.bGranted = true;
+            Schedule.bForced = true;
+            continue;
+        }
+
+        Schedule.Interval = ComputeInterval(Schedule.Agent->GetActorLocation(), Schedule.bOffscreen);
+        if (Schedule.bOffscreen)
+        {
+            ++CurrentStats.NumOffscreen;
+        }
+
+        // 이번 Tick의 시간까지 더한 예상 경과 시간으로 판정
+        // 한 번도 결정하지 않았거나 이벤트로 요청된 에이전트는 가장 먼저 (스폰/피격 직후 반응)
+        const float ExpectedTime = Schedule.TimeSinceDecision + Schedule.LastDeltaTime;
+        const bool bImmediate = !Schedule.bHasDecided || Schedule.bDecisionRequested;
+        if (!bImmediate && ExpectedTime < Schedule.Interval)
+        {
+            continue;
+        }
+
+        Schedule.Urgency = !bImmediate ? ExpectedTime / FMath::Max(Schedule.Interval, KINDA_SMALL_NUMBER) : FLT_MAX;
+        if (ExpectedTime >= Settings.MaxLatency)
+        {
+            Schedule.bForced = true;
+            Schedule.bGranted = true;
+            ++NumForced;
+        }
+        else
+        {
+            DueScratch.Add(i);
+        }
+    }
+
+    CurrentStats.NumDue = static_cast<uint32>(DueScratch.Num() + NumForced);
+    if (!Settings.bEnabled)
+    {
+        CurrentStats.NumDue = CurrentStats.NumAgents;
+    }
+
+    // 밀린 비율이 큰 순서로 남은 예산만큼 허가, 밀린 에이전트는 다음 프레임에 비율이 더 커져 앞선다
+    const int32 NumSlots = FMath::Max(Settings.MaxDecisionsPerFrame - NumForced, 0);
+    if (DueScratch.Num() > NumSlots)
+    {
+        std::nth_element(DueScratch.begin(), DueScratch.begin() + NumSlots, DueScratch.end(),
+            [this](int32 A, int32 B) { return Agents[A].Urgency > Agents[B].Urgency; });
+        DueScratch.SetNum(NumSlots);
+    }
+    for (int32 Index : DueScratch)
+    {
+        Agents[Index].bGranted = true;
+    }
+
+    CurrentStats.ScheduleMs = FPlatformTime::ToMilliseconds(FPlatformTime::Cycles64() - StartCycles);
+}
+
+bool FAIDecisionScheduler::TryBeginDecision(const AActor* Agent, float DeltaTime, float& OutDecisionDeltaTime)
+{
+    OutDecisionDeltaTime = DeltaTime;
+
+    const int32* Found = AgentIndexByActor.Find(Agent);
+    if (Found)
+    {
+        FAgentSchedule& Schedule = Agents[*Found];
+        Schedule.TimeSinceDecision += DeltaTime;
+        Schedule.LastDeltaTime = DeltaTime;
+        if (!Schedule.bGranted)
+        {
+            return false;
+        }
+        Schedule.bGranted = false;
+
+        // 시간 예산은 Tick 순서대로 소모된다, 프레임에 최소 한 번은 결정해 진행을 보장
+        if (!Schedule.bForced && CurrentStats.NumDecisions > 0
+            && FPlatformTime::ToMilliseconds(FrameDecisionCycles) >= Settings.FrameBudgetMs)
+        {
+            return false;
+        }
+
+        const double LatencyMs = Schedule.TimeSinceDecision * 1000.0;
+        LatencySumMs += LatencyMs;
+        CurrentStats.MaxLatencyMs = FMath::Max(CurrentStats.MaxLatencyMs, LatencyMs);
+
+        OutDecisionDeltaTime = Schedule.TimeSinceDecision;
+        Schedule.TimeSinceDecision = 0.0f;
+        Schedule.bHasDecided = true;
+        Schedule.bDecisionRequested = false;
+    }
+
+    ++CurrentStats.NumDecisions;
+    DecisionStartCycles = FPlatformTime::Cycles64();
+    return true;
+}
+
+void FAIDecisionScheduler::EndDecision()
+{
+    FrameDecisionCycles += FPlatformTime::Cycles64() - DecisionStartCycles;
+}
+
+void FAIDecisionScheduler::RequestDecision(const AActor* Agent)
+{
+    if (const int32* Found = AgentIndexByActor.Find(Agent))
+    {
+        Agents[*Found].bDecisionRequested = true;
+    }
+}
+
+void FAIDecisionScheduler::PublishStats()
+{
+    CurrentStats.DecisionMs = FPlatformTime::ToMilliseconds(FrameDecisionCycles);
+    CurrentStats.NumDeferred = CurrentStats.NumDue > CurrentStats.NumDecisions ? CurrentStats.NumDue - CurrentStats.NumDecisions : 0;
+    CurrentStats.AvgLatencyMs = CurrentStats.NumDecisions > 0 ? LatencySumMs / CurrentStats.NumDecisions : 0.0;
+
+    LastStats = CurrentStats;
+    FAIStatManager::GetInstance().Publish(LastStats);
+
+    CurrentStats.Reset();
+    FrameDecisionCycles = 0;
+    LatencySumMs = 0.0;
+}
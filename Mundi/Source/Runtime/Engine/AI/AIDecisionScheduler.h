@@ -0,0 +1,99 @@
+﻿#pragma once
+#include "AIStats.h"
+
+class AActor;
+class UCameraComponent;
+
+/**
+ * @brief AI 결정 스케줄러 설정
+ * - 플레이어와의 거리로 MinInterval..MaxInterval 사이의 결정 주기를 정하고, 화면 밖이면 OffscreenInterval 이상으로 늘린다
+ * - 주기가 돌아온 에이전트 중 밀린 비율(경과 시간 / 주기)이 큰 순서로 프레임 예산만큼만 결정한다
+ */
+struct FAIDecisionSchedulerSettings
+{
+    bool bEnabled = true;
+
+    int32 MaxDecisionsPerFrame = 24;    // 프레임당 결정 수 상한
+    float FrameBudgetMs = 1.0f;         // 프레임당 결정 시간 예산 (넘으면 남은 에이전트는 다음 프레임)
+
+    float NearDistance = 10.0f;         // 이 안쪽은 MinInterval (미터)
+    float FarDistance = 60.0f;          // 이 바깥은 MaxInterval
+    float MinInterval = 0.05f;          // 초
+    float MaxInterval = 0.5f;
+    float OffscreenInterval = 0.25f;    // 화면 밖 최소 주기
+
+    float MaxLatency = 1.0f;            // 이보다 오래 밀린 에이전트는 예산과 무관하게 결정 (기아 방지)
+};
+
+/**
+ * @brief 월드별 AI 결정 스케줄러 (PIE 월드가 소유)
+ * - UWorld::Tick이 액터 Tick 전에 BeginFrame으로 플레이어/뷰 정보를 넘기면 이번 프레임에 결정할 에이전트를 고른다
+ * - 에이전트는 Tick에서 TryBeginDecision이 허가할 때만 감지/상태 전환을 수행하고(누적 시간으로 한 번에 진행),
+ *   이동/회전 조향은 매 프레임 계속한다
+ * - 등록되지 않은 에이전트는 매 프레임 결정한다
+ */
+class FAIDecisionScheduler
+{
+public:
+    void RegisterAgent(AActor* Agent);
+    void UnregisterAgent(const AActor* Agent);
+    bool IsRegistered(const AActor* Agent) const { return AgentIndexByActor.Contains(Agent); }
+    int32 GetNumAgents() const { return Agents.Num(); }
+
+    void BeginFrame(const AActor* Player, const UCameraComponent* ViewCamera);
+
+    /**
+     * @brief 매 Tick 호출, 에이전트 시간(커스텀 시간 배율 반영)을 누적하고 이번 프레임 결정 허가 여부를 돌려준다
+     * - 허가되면 EndDecision까지의 시간을 AI 비용으로 센다
+     * @param OutDecisionDeltaTime 직전 결정 이후 누적 시간 (미등록 에이전트는 DeltaTime)
+     */
+    bool TryBeginDecision(const AActor* Agent, float DeltaTime, float& OutDecisionDeltaTime);
+    void EndDecision();
+
+    /** 피격/공격 종료 같은 이벤트 직후 다음 프레임에 가장 먼저 결정하도록 요청 */
+    void RequestDecision(const AActor* Agent);
+
+    FAIDecisionSchedulerSettings& GetSettings() { return Settings; }
+    const FAIDecisionSchedulerSettings& GetSettings() const { return Settings; }
+
+    const FAIStats& GetLastFrameStats() const { return LastStats; }
+
+private:
+    struct FAgentSchedule
+    {
+        AActor* Agent = nullptr;
+        float TimeSinceDecision = 0.0f;
+        float LastDeltaTime = 0.0f;     // BeginFrame에서 이번 Tick 이후 경과 시간 추정에 사용
+        float Interval = 0.0f;
+        float Urgency = 0.0f;           // TimeSinceDecision / Interval, 1 이상이면 주기 도래
+        bool bHasDecided = false;
+        bool bDecisionRequested = false;
+        bool bOffscreen = false;
+        bool bGranted = false;          // 이번 프레임 결정 허가
+        bool bForced = false;           // MaxLatency 초과 (시간 예산 무시)
+    };
+
+    float ComputeInterval(const FVector& Location, bool& bOutOffscreen) const;
+    bool IsOutsideView(const FVector& Location) const;
+    void PublishStats();
+
+    FAIDecisionSchedulerSettings Settings;
+
+    TArray<FAgentSchedule> Agents;                  // 밀집 배열 (해제 시 마지막 원소와 교체)
+    TMap<const AActor*, int32> AgentIndexByActor;
+    TArray<int32> DueScratch;                       // BeginFrame 후보 목록 (할당 재사용)
+
+    bool bHasPlayer = false;
+    FVector PlayerLocation;
+    bool bHasView = false;
+    FVector ViewLocation;
+    FVector ViewForward;
+    float SinConeAngle = 1.0f;
+    float CosConeAngle = 0.0f;
+
+    uint64 DecisionStartCycles = 0;
+    uint64 FrameDecisionCycles = 0;
+    double LatencySumMs = 0.0;
+    FAIStats CurrentStats;
+    FAIStats LastStats;
+};
@@ -0,0 +1,56 @@
+﻿#pragma once
+#include "UEContainer.h"
+
+// AI 결정 스케줄러 프레임 통계 (FAIDecisionScheduler가 BeginFrame마다 지난 프레임 결과를 게시)
+struct FAIStats
+{
+    uint32 NumAgents = 0;           // 등록된 에이전트
+    uint32 NumDue = 0;              // 결정 주기가 돌아온 에이전트
+    uint32 NumDecisions = 0;        // 실제로 결정(감지/상태 전환)을 수행
+    uint32 NumDeferred = 0;         // 주기가 됐지만 예산 초과로 다음 프레임으로 밀림
+    uint32 NumOffscreen = 0;
+
+    double DecisionMs = 0.0;        // 결정 로직 총 시간
+    double ScheduleMs = 0.0;        // 우선순위 계산/선정 시간
+    double AvgLatencyMs = 0.0;      // 결정 사이 간격 (직전 결정 이후 경과 시간)
+    double MaxLatencyMs = 0.0;
+
+    void Reset()
+    {
+        *this = FAIStats();
+    }
+};
+
+// AI 통계 전역 매니저 (싱글톤, PIE 월드의 스케줄러가 게시)
+class FAIStatManager
+{
+public:
+    static FAIStatManager& GetInstance()
+    {
+        static FAIStatManager Instance;
+        return Instance;
+    }
+
+    void Publish(const FAIStats& InStats)
+    {
+        LastStats = InStats;
+    }
+
+    const FAIStats& GetStats() const
+    {
+        return LastStats;
+    }
+
+    void ResetStats()
+    {
+        LastStats.Reset();
+    }
+
+private:
+    FAIStatManager() = default;
+    ~FAIStatManager() = default;
+    FAIStatManager(const FAIStatManager&) = delete;
+    FAIStatManager& operator=(const FAIStatManager&) = delete;
+
+    FAIStats LastStats;
+};
@@ -132,8 +132,12 @@ bool UAnimDataModel::GetBoneTrackTransform(const FName& BoneName, int32 KeyIndex
 
 FTransform UAnimDataModel::EvaluateBoneTrackTransform(const FName& BoneName, float Time, bool bInterpolate) const
 {
-    const FBoneAnimationTrack* Track = FindBoneTrack(BoneName);
-    if (!Track)
+    return EvaluateBoneTrackTransformByIndex(FindBoneTrackIndex(BoneName), Time);
+}
+
+FTransform UAnimDataModel::EvaluateBoneTrackTransformByIndex(int32 TrackIndex, float Time) const
+{
+    if (TrackIndex < 0 || TrackIndex >= BoneAnimationTracks.Num())
     {
         return FTransform();
     }
@@ -143,7 +147,7 @@ FTransform UAnimDataModel::EvaluateBoneTrackTransform(const FName& BoneName, flo
         return FTransform();
     }
 
-    const FRawAnimSequenceTrack& RawTrack = Track->InternalTrack;
+    const FRawAnimSequenceTrack& RawTrack = BoneAnimationTracks[TrackIndex].InternalTrack;
 
     // 시간 클램프
     float PlayLength = this->PlayLength;
@@ -63,6 +63,8 @@ public:
 
     // Interpolation
     FTransform EvaluateBoneTrackTransform(const FName& BoneName, float Time, bool bInterpolate = true) const;
+    // 이름 검색 없이 트랙 인덱스로 평가 (매 프레임 전체 본 평가용)
+    FTransform EvaluateBoneTrackTransformByIndex(int32 TrackIndex, float Time) const;
 
 private:
     TArray<FBoneAnimationTrack> BoneAnimationTracks;
@@ -5,6 +5,9 @@
 #include "AnimationStateMachine.h"
 #include "AnimSequence.h"
 #include "AnimMontage.h"
+#include "AnimationRuntime.h"
+#include "AnimUpdateRateManager.h"
+#include "CharacterMovementComponent.h"
 // For notify dispatching
 #include "Source/Runtime/Engine/Animation/AnimNotify/AnimNotify.h"
 
@@ -35,6 +38,7 @@ void UAnimInstance::NativeUpdateAnimation(float DeltaSeconds)
     // ============================================================
     if (AnimStateMachine)
     {
+        SampleMovementInputs();
         AnimStateMachine->ProcessState(DeltaSeconds);
     }
 
@@ -52,8 +56,19 @@ void UAnimInstance::NativeUpdateAnimation(float DeltaSeconds)
 
     // ============================================================
     // 2. 기본 포즈 평가 (상태머신 결과)
+    // 모든 중간 포즈는 포즈 스택에서 빌리며, 본 수가 바뀔 때만 스택을 재할당한다
     // ============================================================
-    TArray<FTransform> BasePose;
+    SharedPoseHits = 0;
+    SharedPoseMisses = 0;
+
+    PoseStack.Reset(GetNumPoseBones());
+    FAnimPoseStackMark PoseMark(PoseStack);
+
+    FPoseView Pose = PoseStack.Push();
+    if (!Pose.IsValid())
+    {
+        return;
+    }
 
     const bool bIsBlending = (BlendTimeRemaining > 0.0f && (BlendTargetState.Sequence != nullptr || BlendTargetState.PoseProvider != nullptr));
 
@@ -65,12 +80,11 @@ void UAnimInstance::NativeUpdateAnimation(float DeltaSeconds)
         float BlendAlpha = 1.0f - (BlendTimeRemaining / SafeTotalTime);
         BlendAlpha = FMath::Clamp(BlendAlpha, 0.0f, 1.0f);
 
-        TArray<FTransform> FromPose;
-        TArray<FTransform> TargetPose;
-        EvaluatePoseForState(CurrentPlayState, FromPose, DeltaSeconds);
+        FPoseView TargetPose = PoseStack.Push();
+        EvaluatePoseForState(CurrentPlayState, Pose, DeltaSeconds);
         EvaluatePoseForState(BlendTargetState, TargetPose, DeltaSeconds);
 
-        BlendPoseArrays(FromPose, TargetPose, BlendAlpha, BasePose);
+        FAnimationRuntime::BlendTwoPosesTogether(Pose, TargetPose, BlendAlpha, Pose);
 
         BlendTimeRemaining = FMath::Max(BlendTimeRemaining - DeltaSeconds, 0.0f);
         if (BlendTimeRemaining <= 1e-4f)
@@ -85,29 +99,41 @@ void UAnimInstance::NativeUpdateAnimation(float DeltaSeconds)
     }
     else
     {
-        EvaluatePoseForState(CurrentPlayState, BasePose, DeltaSeconds);
+        EvaluatePoseForState(CurrentPlayState, Pose, DeltaSeconds);
     }
 
     // ============================================================
-    // 3. 몽타주 처리 (상태머신 위에 오버레이)
+    // 3. 상체 레이어 (본별 가중치로 마스크 블렌드)
     // ============================================================
-    TArray<FTransform> FinalPose = BasePose;
+    if (bUseUpperBody)
+    {
+        FAnimPoseStackMark LayerMark(PoseStack);
+        FPoseView UpperPose = PoseStack.Push();
+        if (UpperPose.IsValid() && EvaluateLayerPose((int32)EAnimLayer::Upper, UpperPose, DeltaSeconds))
+        {
+            FAnimationRuntime::BlendPosesPerBone(Pose, UpperPose, UpperBodyWeights, 1.0f, Pose);
+        }
+    }
 
+    // ============================================================
+    // 4. 몽타주 처리 (상태머신 위에 오버레이)
+    // ============================================================
     if (bMontageActive && MontageState.Montage)
     {
-        FinalPose = ProcessMontage(BasePose, DeltaSeconds);
+        ProcessMontage(Pose, DeltaSeconds);
     }
 
     // ============================================================
-    // 4. 최종 포즈 적용
+    // 5. 최종 포즈 적용 (OutputPose는 크기가 같으면 재할당 없음)
     // ============================================================
-    if (OwningComponent && FinalPose.Num() > 0)
+    if (OwningComponent)
     {
-        OwningComponent->SetAnimationPose(FinalPose);
+        Pose.CopyTo(OutputPose);
+        OwningComponent->SetAnimationPose(OutputPose);
     }
 
     // ============================================================
-    // 5. 노티파이 & 커브
+    // 6. 노티파이 & 커브
     // ============================================================
     TriggerAnimNotifies(DeltaSeconds);
     UpdateAnimationCurves();
@@ -116,7 +142,17 @@ void UAnimInstance::NativeUpdateAnimation(float DeltaSeconds)
 
 void UAnimInstance::EvaluatePose(TArray<FTransform>& OutPose)
 {
-    EvaluatePoseForState(CurrentPlayState, OutPose);
+    OutPose.Empty();
+
+    PoseStack.Reset(GetNumPoseBones());
+    FAnimPoseStackMark PoseMark(PoseStack);
+
+    FPoseView Pose = PoseStack.Push();
+    if (Pose.IsValid())
+    {
+        EvaluatePoseForState(CurrentPlayState, Pose);
+        Pose.CopyTo(OutPose);
+    }
 }
 // ============================================================
 // Playback API
@@ -207,6 +243,12 @@ void UAnimInstance::BlendTo(UAnimSequence* Sequence, bool bLoop, float InPlayRat
 
 void UAnimInstance::BlendTo(UAnimSequence* Sequence, EAnimLayer Layer, bool bLoop, float InPlayRate, float BlendTime)
 {
+    if (!Sequence)
+    {
+        UE_LOG("UAnimInstance::BlendTo - Invalid sequence");
+        return;
+    }
+
     int32 LayerIndex = (int32)Layer;
 
     BlendTargets[LayerIndex].Sequence = Sequence;
@@ -219,6 +261,17 @@ void UAnimInstance::BlendTo(UAnimSequence* Sequence, EAnimLayer Layer, bool bLoo
 
     LayerBlendTimeRemaining[LayerIndex] = FMath::Max(BlendTime, 0.0f);
     LayerBlendTotalTime[LayerIndex] = LayerBlendTimeRemaining[LayerIndex];
+
+    // 블렌드 시간이 없거나 레이어가 비어 있으면 즉시 전환
+    const bool bLayerEmpty = !Layers[LayerIndex].PoseProvider && !Layers[LayerIndex].Sequence;
+    if (LayerBlendTimeRemaining[LayerIndex] <= 0.0f || bLayerEmpty)
+    {
+        Layers[LayerIndex] = BlendTargets[LayerIndex];
+        Layers[LayerIndex].BlendWeight = 1.0f;
+        BlendTargets[LayerIndex] = FAnimationPlayState();
+        LayerBlendTimeRemaining[LayerIndex] = 0.0f;
+        LayerBlendTotalTime[LayerIndex] = 0.0f;
+    }
 }
 
 void UAnimInstance::PlayPoseProvider(IAnimPoseProvider* Provider, bool bLoop, float InPlayRate)
@@ -285,28 +338,19 @@ void UAnimInstance::EnableUpperBodySplit(FName BoneName)
     int32 RootBoneIdx = CurrentSkeleton->FindBoneIndex(BoneName);
     if (RootBoneIdx == INDEX_NONE) return;
 
-    const int32 NumBones = CurrentSkeleton->GetNumBones();
-    UpperBodyMask = { false };
+    const int32 NumBones = CurrentSkeleton->Bones.Num();
+    UpperBodyWeights.SetNum(NumBones);
 
-    // BFS로 자식 bone을 모두 True로 변경
-
-    TArray<int32> BoneQueue;
-    BoneQueue.Add(RootBoneIdx);
-     
-    while (BoneQueue.Num() > 0)
+    // 본마다 부모를 따라 올라가 RootBoneIdx를 만나면 상체 (본 순서가 부모 우선이 아니어도 동작)
+    for (int32 BoneIndex = 0; BoneIndex < NumBones; ++BoneIndex)
     {
-        int32 CurrentIdx = BoneQueue.Pop();
-
-        UpperBodyMask[CurrentIdx] = true;
-            
-        //// TODO: 자식 본 찾기
-        //for (int32 i = CurrentIdx + 1; i < NumBones; ++i)
-        //{
-        //    if (CurrentSkeleton->GetParentIndex(i) == CurrentIdx)
-        //    {
-        //        BoneQueue.Add(i);
-        //    }
-        //}
+        int32 Current = BoneIndex;
+        int32 Steps = 0;
+        while (Current != INDEX_NONE && Current != RootBoneIdx && Steps++ < NumBones)
+        {
+            Current = CurrentSkeleton->Bones[Current].ParentIndex;
+        }
+        UpperBodyWeights[BoneIndex] = (Current == RootBoneIdx) ? 1.0f : 0.0f;
     }
     bUseUpperBody = true; 
 }
@@ -328,8 +372,8 @@ void UAnimInstance::TriggerAnimNotifies(float DeltaSeconds)
         return;
     }
 
-    // UAnimSequenceBase의 GetAnimNotify를 사용하여 노티파이 수집
-    TArray<FPendingAnimNotify> PendingNotifies;
+    // UAnimSequenceBase의 GetAnimNotify를 사용하여 노티파이 수집 (배열은 프레임 간 재사용)
+    TArray<FPendingAnimNotify>& PendingNotifies = PendingNotifyScratch;
 
     // PoseProvider가 있으면 그 시간을 사용 (BlendSpace1D의 경우 내부 시간 추적 사용)
     // 그렇지 않으면 AnimInstance의 시간 사용
@@ -433,45 +477,124 @@ void UAnimInstance::SetStateMachine(UAnimationStateMachine* InStateMachine)
     if (AnimStateMachine)
     {
         AnimStateMachine->Initialize(this);
+
+        // 현재 파라미터로 입력 변수 초기화
+        AnimStateMachine->SetVariable(FAnimStateMachineInputs::Speed, MovementSpeed);
+        AnimStateMachine->SetBoolVariable(FAnimStateMachineInputs::IsMoving, bIsMoving);
+        AnimStateMachine->SetBoolVariable(FAnimStateMachineInputs::IsGrounded, bIsGrounded);
         UE_LOG("AnimInstance: StateMachine set and initialized");
     }
 }
-void UAnimInstance::EvaluatePoseForState(const FAnimationPlayState& PlayState, TArray<FTransform>& OutPose, float DeltaTime) const
+
+void UAnimInstance::SetMovementSpeed(float Speed)
 {
-    OutPose.Empty();
+    MovementSpeed = Speed;
+    if (AnimStateMachine)
+    {
+        AnimStateMachine->SetVariable(FAnimStateMachineInputs::Speed, Speed);
+    }
+}
 
-    // PoseProvider가 있으면 그것을 사용 (BlendSpace 등)
-    if (PlayState.PoseProvider)
+void UAnimInstance::SetIsMoving(bool bInMoving)
+{
+    bIsMoving = bInMoving;
+    if (AnimStateMachine)
+    {
+        AnimStateMachine->SetBoolVariable(FAnimStateMachineInputs::IsMoving, bInMoving);
+    }
+}
+
+void UAnimInstance::SetIsGrounded(bool bInGrounded)
+{
+    bIsGrounded = bInGrounded;
+    if (AnimStateMachine)
     {
-        const int32 NumBones = PlayState.PoseProvider->GetNumBoneTracks();
-        OutPose.SetNum(NumBones);
+        AnimStateMachine->SetBoolVariable(FAnimStateMachineInputs::IsGrounded, bInGrounded);
+    }
+}
 
-        // const_cast 필요: EvaluatePose가 non-const (내부 상태 변경 가능)
-        const_cast<IAnimPoseProvider*>(PlayState.PoseProvider)->EvaluatePose(
-            PlayState.CurrentTime, DeltaTime, OutPose);
+void UAnimInstance::SampleMovementInputs()
+{
+    if (!AnimStateMachine || !AnimStateMachine->ShouldSampleMovementInputs() || !OwningComponent)
+    {
         return;
     }
 
-    // 기존 방식: Sequence 직접 사용
-    if (!PlayState.Sequence)
+    AActor* OwnerActor = OwningComponent->GetOwner();
+    UCharacterMovementComponent* MoveComp = OwnerActor
+        ? Cast<UCharacterMovementComponent>(OwnerActor->GetComponent(UCharacterMovementComponent::StaticClass()))
+        : nullptr;
+    if (!MoveComp)
     {
         return;
     }
 
-    UAnimDataModel* DataModel = PlayState.Sequence->GetDataModel();
-    if (!DataModel)
+    // 전이 조건(바이트코드)이 읽는 값과 같은 기준으로 채운다 (Get Speed = 속도 벡터 길이)
+    const float Speed = MoveComp->GetVelocity().Size();
+    SetMovementSpeed(Speed);
+    SetIsMoving(Speed > KINDA_SMALL_NUMBER);
+    SetIsGrounded(!MoveComp->IsFalling());
+}
+void UAnimInstance::EvaluatePoseForState(const FAnimationPlayState& PlayState, FPoseView& OutPose, float DeltaTime)
+{
+    if (!OutPose.IsValid())
     {
         return;
     }
 
-    const int32 NumBones = DataModel->GetNumBoneTracks();
-    OutPose.SetNum(NumBones);
+    // 시퀀스 단독 재생이면 군중 공유 캐시를 거친다 (양자화된 시간으로 평가, 같은 키는 한 번만 평가)
+    const bool bSequenceOnly = PlayState.Sequence && (!PlayState.PoseProvider || PlayState.PoseProvider == PlayState.Sequence);
+    if (PoseShareCache && bSequenceOnly)
+    {
+        if (PoseShareCache->EvaluateShared(PlayState.Sequence, PlayState.CurrentTime, PlayState.bIsLooping, OutPose))
+        {
+            ++SharedPoseHits;
+        }
+        else
+        {
+            ++SharedPoseMisses;
+        }
+        return;
+    }
+
+    // PoseProvider가 있으면 그것을 사용 (BlendSpace 등, 중간 포즈는 같은 스택에서 빌림)
+    if (PlayState.PoseProvider)
+    {
+        PlayState.PoseProvider->EvaluatePose(PlayState.CurrentTime, DeltaTime, OutPose, PoseStack);
+        return;
+    }
+
+    // 기존 방식: Sequence 직접 사용
+    if (!PlayState.Sequence)
+    {
+        OutPose.SetIdentity();
+        return;
+    }
 
     FAnimExtractContext ExtractContext(PlayState.CurrentTime, PlayState.bIsLooping);
-    FPoseContext PoseContext(NumBones);
-    PlayState.Sequence->GetAnimationPose(PoseContext, ExtractContext);
+    PlayState.Sequence->GetAnimationPose(OutPose, ExtractContext);
+}
+
+int32 UAnimInstance::GetNumBonesForState(const FAnimationPlayState& PlayState) const
+{
+    if (PlayState.PoseProvider)
+    {
+        return PlayState.PoseProvider->GetNumBoneTracks();
+    }
 
-    OutPose = PoseContext.Pose;
+    UAnimDataModel* DataModel = PlayState.Sequence ? PlayState.Sequence->GetDataModel() : nullptr;
+    return DataModel ? DataModel->GetNumBoneTracks() : 0;
+}
+
+int32 UAnimInstance::GetNumPoseBones() const
+{
+    // 블렌드 타깃/레이어/몽타주가 현재 상태보다 트랙이 많을 수 있으므로 스켈레톤 기준으로 잡는다
+    // (트랙이 없는 본은 GetAnimationPose가 항등 변환으로 채운다)
+    if (CurrentSkeleton && CurrentSkeleton->Bones.Num() > 0)
+    {
+        return CurrentSkeleton->Bones.Num();
+    }
+    return GetNumBonesForState(CurrentPlayState);
 }
 
 void UAnimInstance::AdvancePlayState(FAnimationPlayState& PlayState, float DeltaSeconds)
@@ -538,86 +661,49 @@ FQuat UAnimInstance::ConsumeRootMotionRotation()
     return Result;
 }
 
-void UAnimInstance::BlendPoseArrays(const TArray<FTransform>& FromPose, const TArray<FTransform>& ToPose, float Alpha, TArray<FTransform>& OutPose) const
+bool UAnimInstance::EvaluateLayerPose(int32 LayerIndex, FPoseView& OutPose, float DeltaSeconds)
 {
-    const int32 NumBones = FMath::Min(FromPose.Num(), ToPose.Num());
-    if (NumBones == 0)
-    {
-        OutPose = FromPose;
-        return;
-    }
+    FAnimationPlayState& Layer = Layers[LayerIndex];
+    FAnimationPlayState& BlendTarget = BlendTargets[LayerIndex];
 
-    const float ClampedAlpha = FMath::Clamp(Alpha, 0.0f, 1.0f);
-    OutPose.SetNum(NumBones);
-
-    for (int32 BoneIndex = 0; BoneIndex < NumBones; ++BoneIndex)
+    if (!Layer.PoseProvider && !Layer.Sequence)
     {
-        const FTransform& From = FromPose[BoneIndex];
-        const FTransform& To = ToPose[BoneIndex];
-
-        FTransform Result;
-        //Result.Lerp(From,To,ClampedAlpha);
-        Result.Translation = FMath::Lerp(From.Translation, To.Translation, ClampedAlpha);
-        Result.Scale3D = FMath::Lerp(From.Scale3D, To.Scale3D, ClampedAlpha);
-        Result.Rotation = FQuat::Slerp(From.Rotation, To.Rotation, ClampedAlpha);
-        Result.Rotation.Normalize();
-
-        OutPose[BoneIndex] = Result;
+        return false;
     }
-}
-
-void UAnimInstance::GetPoseForLayer(int32 LayerIndex, TArray<FTransform>& OutPose,float DeltaSeconds)
-{
-    if (!Layers[LayerIndex].Sequence) return;
 
     // 시간 갱신
-    AdvancePlayState(Layers[LayerIndex], DeltaSeconds);
-
-    const bool bIsBlending = (BlendTimeRemaining > 0.0f && (BlendTargetState.Sequence != nullptr || BlendTargetState.PoseProvider != nullptr));
+    AdvancePlayState(Layer, DeltaSeconds);
+    EvaluatePoseForState(Layer, OutPose, DeltaSeconds);
 
-    if (bIsBlending)
+    const bool bIsBlending = (LayerBlendTimeRemaining[LayerIndex] > 0.0f && (BlendTarget.Sequence != nullptr || BlendTarget.PoseProvider != nullptr));
+    if (!bIsBlending)
     {
-        AdvancePlayState(BlendTargetState, DeltaSeconds);
-
-        const float SafeTotalTime = FMath::Max(BlendTotalTime, 1e-6f);
-        float BlendAlpha = 1.0f - (BlendTimeRemaining / SafeTotalTime);
-        BlendAlpha = FMath::Clamp(BlendAlpha, 0.0f, 1.0f);
-
-        TArray<FTransform> FromPose;
-        TArray<FTransform> TargetPose;
-        EvaluatePoseForState(CurrentPlayState, FromPose, DeltaSeconds);
-        EvaluatePoseForState(BlendTargetState, TargetPose, DeltaSeconds);
+        return true;
+    }
 
-        TArray<FTransform> BlendedPose;
-        BlendPoseArrays(FromPose, TargetPose, BlendAlpha, BlendedPose);
+    AdvancePlayState(BlendTarget, DeltaSeconds);
 
-        if (OwningComponent && BlendedPose.Num() > 0)
-        {
-            OwningComponent->SetAnimationPose(BlendedPose);
-        }
-
-        BlendTimeRemaining = FMath::Max(BlendTimeRemaining - DeltaSeconds, 0.0f);
-        if (BlendTimeRemaining <= 1e-4f)
-        {
-            CurrentPlayState = BlendTargetState;
-            CurrentPlayState.BlendWeight = 1.0f;
+    const float SafeTotalTime = FMath::Max(LayerBlendTotalTime[LayerIndex], 1e-6f);
+    const float BlendAlpha = FMath::Clamp(1.0f - (LayerBlendTimeRemaining[LayerIndex] / SafeTotalTime), 0.0f, 1.0f);
 
-            BlendTargetState = FAnimationPlayState();
-            BlendTimeRemaining = 0.0f;
-            BlendTotalTime = 0.0f;
-        }
+    {
+        FAnimPoseStackMark Mark(PoseStack);
+        FPoseView TargetPose = PoseStack.Push();
+        EvaluatePoseForState(BlendTarget, TargetPose, DeltaSeconds);
+        FAnimationRuntime::BlendTwoPosesTogether(OutPose, TargetPose, BlendAlpha, OutPose);
     }
-    else if (OwningComponent)
+
+    LayerBlendTimeRemaining[LayerIndex] = FMath::Max(LayerBlendTimeRemaining[LayerIndex] - DeltaSeconds, 0.0f);
+    if (LayerBlendTimeRemaining[LayerIndex] <= 1e-4f)
     {
-        TArray<FTransform> Pose;
-        EvaluatePoseForState(CurrentPlayState, Pose, DeltaSeconds);
+        Layer = BlendTarget;
+        Layer.BlendWeight = 1.0f;
 
-        if (Pose.Num() > 0)
-        {
-            OwningComponent->SetAnimationPose(Pose);
-        }
+        BlendTarget = FAnimationPlayState();
+        LayerBlendTimeRemaining[LayerIndex] = 0.0f;
+        LayerBlendTotalTime[LayerIndex] = 0.0f;
     }
-
+    return true;
 }
 
 // ============================================================
@@ -728,28 +814,26 @@ void UAnimInstance::Montage_SetPlayRate(float NewPlayRate)
     }
 }
 
-TArray<FTransform> UAnimInstance::ProcessMontage(const TArray<FTransform>& BasePose, float DeltaSeconds)
+void UAnimInstance::ProcessMontage(FPoseView& InOutPose, float DeltaSeconds)
 {
-    TArray<FTransform> Result = BasePose;
-
     if (!MontageState.bIsPlaying || !MontageState.Montage)
     {
         bMontageActive = false;
-        return Result;
+        return;
     }
 
     UAnimSequence* SourceSequence = MontageState.Montage->GetSourceSequence();
     if (!SourceSequence)
     {
         bMontageActive = false;
-        return Result;
+        return;
     }
 
     float PlayLength = MontageState.Montage->GetPlayLength();
     if (PlayLength <= 0.0f)
     {
         bMontageActive = false;
-        return Result;
+        return;
     }
 
     // ============================================================
@@ -762,7 +846,7 @@ TArray<FTransform> UAnimInstance::ProcessMontage(const TArray<FTransform>& BaseP
     // 몽타주 노티파이 처리
     // ============================================================
     float DeltaMove = DeltaSeconds * MontageState.PlayRate;
-    TArray<FPendingAnimNotify> PendingNotifies;
+    TArray<FPendingAnimNotify>& PendingNotifies = MontageNotifyScratch;
     MontageState.Montage->GetAnimNotifiesInRange(MontageState.PreviousTime, DeltaMove, PendingNotifies);
 
     for (const FPendingAnimNotify& Pending : PendingNotifies)
@@ -831,32 +915,28 @@ TArray<FTransform> UAnimInstance::ProcessMontage(const TArray<FTransform>& BaseP
     MontageState.CurrentWeight = FMath::Clamp(TargetWeight, 0.0f, 1.0f);
 
     // ============================================================
-    // 몽타주 포즈 평가 (원본 시퀀스에서)
+    // 몽타주 포즈 평가 (원본 시퀀스에서) + 블렌딩 (BasePose + MontagePose)
+    // 루트 모션은 SkeletalMeshComponent::SetAnimationPose에서 최종 포즈로부터 추출됨
     // ============================================================
-    TArray<FTransform> MontagePose;
-
     UAnimDataModel* DataModel = SourceSequence->GetDataModel();
-    if (DataModel && BasePose.Num() > 0)
+    if (DataModel && InOutPose.IsValid() && MontageState.CurrentWeight > 0.0f)
     {
-        const int32 NumBones = DataModel->GetNumBoneTracks();
-        MontagePose.SetNum(NumBones);
+        FAnimPoseStackMark Mark(PoseStack);
+        FPoseView MontagePose = PoseStack.Push();
+
+        // 몽타주 트랙이 더 적으면 그 뒤의 본은 기본 포즈 유지
+        MontagePose.NumBones = FMath::Min(MontagePose.NumBones, DataModel->GetNumBoneTracks());
 
         // 포즈 평가 시간을 EffectivePlayLength로 클램프 (제자리 복귀 방지)
         float MaxEvalTime = (MontageState.EffectivePlayLength > 0.0f) ? MontageState.EffectivePlayLength : PlayLength;
         float PoseEvalTime = FMath::Min(MontageState.CurrentTime, MaxEvalTime);
         FAnimExtractContext Context(PoseEvalTime, false);  // 루프 안 함
-        FPoseContext PoseContext(NumBones);
-        SourceSequence->GetAnimationPose(PoseContext, Context);
-        MontagePose = PoseContext.Pose;
-    }
+        SourceSequence->GetAnimationPose(MontagePose, Context);
 
-    // ============================================================
-    // 블렌딩 (BasePose + MontagePose)
-    // 루트 모션은 SkeletalMeshComponent::SetAnimationPose에서 최종 포즈로부터 추출됨
-    // ============================================================
-    if (MontagePose.Num() > 0 && MontageState.CurrentWeight > 0.0f)
-    {
-        BlendPoseArrays(BasePose, MontagePose, MontageState.CurrentWeight, Result);
+        if (MontagePose.IsValid() && MontagePose.NumBones > 0)
+        {
+            FAnimationRuntime::BlendTwoPosesTogether(InOutPose, MontagePose, MontageState.CurrentWeight, InOutPose);
+        }
     }
 
     // ============================================================
@@ -886,6 +966,4 @@ TArray<FTransform> UAnimInstance::ProcessMontage(const TArray<FTransform>& BaseP
 
         UE_LOG("Montage finished: %s (RootMotion disabled)", MontageState.Montage->ObjectName.ToString().c_str());
     }
-
-    return Result;
 }
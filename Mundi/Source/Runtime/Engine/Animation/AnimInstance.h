@@ -7,6 +7,7 @@ class UAnimationStateMachine;
 class UAnimSequence;
 class UAnimMontage;
 class USkeletalMeshComponent;
+class FAnimPoseShareCache;
 
 /**
  * @brief 애니메이션 재생 상태를 관리하는 구조체
@@ -149,6 +150,8 @@ class UAnimInstance : public UObject
     // 루트 모션 관련 멤버에 접근할 수 있도록 허용
     friend class USkeletalMeshComponent;
     friend class UAnimationStateMachine;
+    // 합성 스켈레톤으로 레이어 평가의 힙 할당을 검증
+    friend class FAnimPoseBenchmark;
 
 public:
     UAnimInstance() = default;
@@ -242,7 +245,10 @@ public:
      */
     UAnimSequence* GetCurrentSequence() const { return CurrentPlayState.Sequence; }
 
-    // 상/하체 분리 설정
+    /**
+     * @brief 상/하체 분리 설정
+     * @param BoneName 상체 루트 본 (이 본과 모든 자식 본이 Upper 레이어 포즈를 따른다)
+     */
     void EnableUpperBodySplit(FName BoneName);
 
     // ============================================================
@@ -260,6 +266,12 @@ public:
      */
     void UpdateAnimationCurves();
 
+    /**
+     * @brief 소유 액터의 무브먼트 컴포넌트에서 상태머신 기본 입력 변수를 채운다
+     * @note 상태머신이 요청한 경우에만 (블루프린트 전이 조건이 무브먼트를 직접 읽을 때)
+     */
+    void SampleMovementInputs();
+
     // ============================================================
     // State Machine & Parameters
     // ============================================================
@@ -275,9 +287,9 @@ public:
     void SetStateMachine(UAnimationStateMachine* InStateMachine);
 
     /**
-     * @brief 이동 속도 설정 (상태머신 전이 조건용)
+     * @brief 이동 속도 설정 (상태머신 Speed 입력 변수도 갱신)
      */
-    void SetMovementSpeed(float Speed) { MovementSpeed = Speed; }
+    void SetMovementSpeed(float Speed);
 
     /**
      * @brief 이동 속도 가져오기
@@ -285,15 +297,21 @@ public:
     float GetMovementSpeed() const { return MovementSpeed; }
 
     /**
-     * @brief 이동 모드 설정 (상태머신 전이 조건용)
+     * @brief 이동 모드 설정 (상태머신 IsMoving 입력 변수도 갱신)
      */
-    void SetIsMoving(bool bInMoving) { bIsMoving = bInMoving; }
+    void SetIsMoving(bool bInMoving);
 
     /**
      * @brief 이동 중인지 확인
      */
     bool GetIsMoving() const { return bIsMoving; }
 
+    /**
+     * @brief 지면 위 여부 설정 (상태머신 IsGrounded 입력 변수도 갱신)
+     */
+    void SetIsGrounded(bool bInGrounded);
+    bool GetIsGrounded() const { return bIsGrounded; }
+
     // ============================================================
     // Root Motion
     // ============================================================
@@ -403,15 +421,32 @@ public:
 
     USkeletalMeshComponent* GetOwningComponent() const { return OwningComponent; }
 
+    /** 지난 평가에서 사용한 포즈 스택 (최대 깊이 확인용) */
+    const FAnimPoseStack& GetPoseStack() const { return PoseStack; }
+
+    /**
+     * @brief 군중 포즈 공유 캐시 지정 (nullptr이면 공유 안 함)
+     * 지정되면 시퀀스 단독 상태는 양자화된 시간으로 평가되어 같은 프레임의 다른 인스턴스와 포즈를 공유한다
+     */
+    void SetPoseShareCache(FAnimPoseShareCache* InCache) { PoseShareCache = InCache; }
+
+    /** 지난 NativeUpdateAnimation에서 공유 캐시 적중/미스 횟수 */
+    int32 GetSharedPoseHits() const { return SharedPoseHits; }
+    int32 GetSharedPoseMisses() const { return SharedPoseMisses; }
+
 protected:
     // PlayState 헬퍼
-    void EvaluatePoseForState(const FAnimationPlayState& PlayState, TArray<FTransform>& OutPose, float DeltaTime = 0.0f) const;
+    void EvaluatePoseForState(const FAnimationPlayState& PlayState, FPoseView& OutPose, float DeltaTime = 0.0f);
     void AdvancePlayState(FAnimationPlayState& PlayState, float DeltaSeconds);
-    void BlendPoseArrays(const TArray<FTransform>& FromPose, const TArray<FTransform>& ToPose, float Alpha, TArray<FTransform>& OutPose) const;
-    void GetPoseForLayer(int32 LayerIndex, TArray<FTransform>& OutPose, float DeltaSeconds);
+    int32 GetNumBonesForState(const FAnimationPlayState& PlayState) const;
+    // 포즈 스택 크기: 스켈레톤 본 수 (스켈레톤이 없으면 현재 상태의 트랙 수)
+    int32 GetNumPoseBones() const;
 
-    // 몽타주 헬퍼
-    TArray<FTransform> ProcessMontage(const TArray<FTransform>& BasePose, float DeltaSeconds);
+    // 레이어 상태(와 레이어 블렌드 타깃)를 갱신/평가, 재생 중인 레이어가 없으면 false
+    bool EvaluateLayerPose(int32 LayerIndex, FPoseView& OutPose, float DeltaSeconds);
+
+    // 몽타주 헬퍼 (InOutPose 위에 몽타주 포즈를 덮어 섞는다)
+    void ProcessMontage(FPoseView& InOutPose, float DeltaSeconds);
 
     // 소유 컴포넌트
     USkeletalMeshComponent* OwningComponent = nullptr;
@@ -436,6 +471,7 @@ protected:
     // 애니메이션 파라미터 (상태머신 전이 조건용)
     float MovementSpeed = 0.0f;
     bool bIsMoving = false;
+    bool bIsGrounded = true;
 
     // 루트 모션 관련
     bool bEnableRootMotion = false;
@@ -456,7 +492,20 @@ protected:
 
     //마스킹 데이터
     bool bUseUpperBody = false;
-    TArray<bool> UpperBodyMask; // true면 상체
+    TArray<float> UpperBodyWeights; // 본별 Upper 레이어 가중치 (1이면 상체)
+
+    // ============================================================
+    // Pose Evaluation Buffers (프레임 간 재사용, 본 수가 바뀔 때만 재할당)
+    // ============================================================
+
+    FAnimPoseStack PoseStack;
+    TArray<FTransform> OutputPose;                      // SetAnimationPose에 넘기는 최종 포즈
+    TArray<FPendingAnimNotify> PendingNotifyScratch;    // TriggerAnimNotifies
+    TArray<FPendingAnimNotify> MontageNotifyScratch;    // ProcessMontage
+
+    FAnimPoseShareCache* PoseShareCache = nullptr;
+    int32 SharedPoseHits = 0;
+    int32 SharedPoseMisses = 0;
 
     // ============================================================
     // Montage
@@ -0,0 +1,104 @@
+﻿#include "pch.h"
+#include "AnimPoseStack.h"
+
+static_assert(sizeof(FQuat) == 16, "FPoseView 회전 스트림은 본당 float 4개를 가정한다");
+static_assert(sizeof(FVector) == 12, "FPoseView 이동/스케일 스트림은 본당 float 3개를 가정한다");
+
+// ============================================================
+// FPoseView
+// ============================================================
+
+void FPoseView::SetIdentity()
+{
+    for (int32 BoneIndex = 0; BoneIndex < NumBones; ++BoneIndex)
+    {
+        Rotations[BoneIndex] = FQuat::Identity();
+        Translations[BoneIndex] = FVector(0.0f, 0.0f, 0.0f);
+        Scales[BoneIndex] = FVector(1.0f, 1.0f, 1.0f);
+    }
+}
+
+void FPoseView::CopyFrom(const FPoseView& Other)
+{
+    if (Other.Rotations == Rotations)
+    {
+        return;
+    }
+
+    const int32 Count = FMath::Min(NumBones, Other.NumBones);
+    std::memcpy(Rotations, Other.Rotations, sizeof(FQuat) * Count);
+    std::memcpy(Translations, Other.Translations, sizeof(FVector) * Count);
+    std::memcpy(Scales, Other.Scales, sizeof(FVector) * Count);
+}
+
+void FPoseView::CopyFrom(const TArray<FTransform>& Pose)
+{
+    const int32 Count = FMath::Min(NumBones, Pose.Num());
+    for (int32 BoneIndex = 0; BoneIndex < Count; ++BoneIndex)
+    {
+        SetBoneTransform(BoneIndex, Pose[BoneIndex]);
+    }
+}
+
+void FPoseView::CopyTo(TArray<FTransform>& OutPose) const
+{
+    OutPose.SetNum(NumBones);
+    for (int32 BoneIndex = 0; BoneIndex < NumBones; ++BoneIndex)
+    {
+        OutPose[BoneIndex] = GetBoneTransform(BoneIndex);
+    }
+}
+
+// ============================================================
+// FAnimPoseStack
+// ============================================================
+
+void FAnimPoseStack::Reset(int32 InNumBones, int32 InMaxPoses)
+{
+    InNumBones = FMath::Max(InNumBones, 0);
+    InMaxPoses = FMath::Max(InMaxPoses, 1);
+
+    Depth = 0;
+    PeakDepth = 0;
+    bOverflowReported = false;
+
+    if (InNumBones == NumBones && InMaxPoses == MaxPoses)
+    {
+        return;
+    }
+
+    NumBones = InNumBones;
+    MaxPoses = InMaxPoses;
+
+    // 회전은 본당 1블록, 이동/스케일은 float 3개씩 이어 붙여 4개 단위로 올림
+    VectorBlocks = (NumBones * 3 + 3) / 4;
+    BlocksPerPose = NumBones + VectorBlocks * 2;
+
+    Storage.Empty();
+    Storage.Shrink();
+    Storage.SetNum(BlocksPerPose * MaxPoses);
+}
+
+FPoseView FAnimPoseStack::Push()
+{
+    if (Depth >= MaxPoses || NumBones == 0)
+    {
+        if (!bOverflowReported && NumBones > 0)
+        {
+            UE_LOG("FAnimPoseStack::Push - Pose stack exhausted (%d poses, %d bones)", MaxPoses, NumBones);
+            bOverflowReported = true;
+        }
+        return FPoseView();
+    }
+
+    FBlock* Base = Storage.data() + static_cast<SIZE_T>(Depth) * BlocksPerPose;
+    ++Depth;
+    PeakDepth = FMath::Max(PeakDepth, Depth);
+
+    FPoseView View;
+    View.Rotations = reinterpret_cast<FQuat*>(Base);
+    View.Translations = reinterpret_cast<FVector*>(Base + NumBones);
+    View.Scales = reinterpret_cast<FVector*>(Base + NumBones + VectorBlocks);
+    View.NumBones = NumBones;
+    return View;
+}
@@ -0,0 +1,98 @@
+﻿#pragma once
+
+/**
+ * @brief 포즈 스택에서 빌려 쓰는 고정 크기 포즈 (SoA)
+ * - 회전/이동/스케일을 각각 연속 배열로 두어 블렌드 커널이 스트림 단위로 SIMD 처리할 수 있게 한다
+ * - 메모리는 FAnimPoseStack이 소유하며, 뷰는 스택 마크가 풀리기 전까지만 유효
+ */
+struct FPoseView
+{
+    FQuat* Rotations = nullptr;     // 16바이트 정렬
+    FVector* Translations = nullptr; // 16바이트 정렬, float 4개 단위로 패딩
+    FVector* Scales = nullptr;       // 16바이트 정렬, float 4개 단위로 패딩
+    int32 NumBones = 0;
+
+    bool IsValid() const { return Rotations != nullptr; }
+
+    FTransform GetBoneTransform(int32 BoneIndex) const
+    {
+        return FTransform(Translations[BoneIndex], Rotations[BoneIndex], Scales[BoneIndex]);
+    }
+
+    void SetBoneTransform(int32 BoneIndex, const FTransform& Transform)
+    {
+        Translations[BoneIndex] = Transform.Translation;
+        Rotations[BoneIndex] = Transform.Rotation;
+        Scales[BoneIndex] = Transform.Scale3D;
+    }
+
+    void SetIdentity();
+    void CopyFrom(const FPoseView& Other);
+
+    // AoS 배열과 변환 (OutPose가 이미 본 수만큼 크면 재할당 없음)
+    void CopyFrom(const TArray<FTransform>& Pose);
+    void CopyTo(TArray<FTransform>& OutPose) const;
+};
+
+/**
+ * @brief 애니메이션 평가 한 번 동안 쓰는 포즈 스택 할당기
+ * - Reset에서 본 수 x 최대 포즈 수만큼 한 번에 확보하고, 이후 Push/Pop은 오프셋 이동만 한다
+ * - 본 수가 바뀔 때만 재할당 (같은 스켈레톤을 계속 평가하면 힙 할당 0회)
+ * - 용량을 넘으면 무효 뷰를 반환하며, 호출자는 해당 포즈를 건너뛴다
+ *
+ * @example
+ * FAnimPoseStackMark Mark(PoseStack);     // 스코프를 벗어나면 이 시점으로 되돌림
+ * FPoseView Target = PoseStack.Push();
+ * EvaluatePoseForState(BlendTargetState, Target, DeltaSeconds);
+ * FAnimationRuntime::BlendTwoPosesTogether(OutPose, Target, Alpha, OutPose);
+ */
+class FAnimPoseStack
+{
+public:
+    static constexpr int32 DefaultMaxPoses = 16;
+
+    void Reset(int32 InNumBones, int32 InMaxPoses = DefaultMaxPoses);
+
+    FPoseView Push();
+    void PopTo(int32 InDepth) { Depth = InDepth; }
+
+    int32 GetDepth() const { return Depth; }
+    int32 GetPeakDepth() const { return PeakDepth; }
+    int32 GetMaxPoses() const { return MaxPoses; }
+    int32 GetNumBones() const { return NumBones; }
+
+private:
+    struct alignas(16) FBlock
+    {
+        float Data[4];
+    };
+
+    TArray<FBlock> Storage;
+    int32 NumBones = 0;
+    int32 VectorBlocks = 0;   // 이동/스케일 스트림 하나의 블록 수
+    int32 BlocksPerPose = 0;
+    int32 MaxPoses = 0;
+    int32 Depth = 0;
+    int32 PeakDepth = 0;
+    bool bOverflowReported = false;
+};
+
+/**
+ * @brief 스코프 단위 포즈 스택 마크, 소멸 시 생성 시점의 깊이로 되돌린다
+ */
+struct FAnimPoseStackMark
+{
+    explicit FAnimPoseStackMark(FAnimPoseStack& InStack)
+        : Stack(InStack), SavedDepth(InStack.GetDepth())
+    {
+    }
+
+    ~FAnimPoseStackMark() { Stack.PopTo(SavedDepth); }
+
+    FAnimPoseStackMark(const FAnimPoseStackMark&) = delete;
+    FAnimPoseStackMark& operator=(const FAnimPoseStackMark&) = delete;
+
+private:
+    FAnimPoseStack& Stack;
+    int32 SavedDepth;
+};
@@ -4,6 +4,29 @@
 
 IMPLEMENT_CLASS(UAnimSequence)
 
+namespace
+{
+    float GetExtractionTime(const UAnimDataModel* Model, const FAnimExtractContext& ExtractionContext)
+    {
+        float CurrentTime = static_cast<float>(ExtractionContext.CurrentTime);
+
+        // Handle looping
+        if (ExtractionContext.bLooping)
+        {
+            float PlayLength = Model->GetPlayLength();
+            if (PlayLength > 0.0f)
+            {
+                CurrentTime = FMath::Fmod(CurrentTime, PlayLength);
+                if (CurrentTime < 0.0f)
+                {
+                    CurrentTime += PlayLength;
+                }
+            }
+        }
+        return CurrentTime;
+    }
+}
+
 UAnimSequence::UAnimSequence()
 {
 }
@@ -40,32 +63,15 @@ void UAnimSequence::GetBonePose(FPoseContext& OutPoseContext, const FAnimExtract
     }
 
     // Get current time and convert to frame
-    float CurrentTime = static_cast<float>(ExtractionContext.CurrentTime);
-
-    // Handle looping
-    if (ExtractionContext.bLooping)
-    {
-        float PlayLength = Model->GetPlayLength();
-        if (PlayLength > 0.0f)
-        {
-            CurrentTime = FMath::Fmod(CurrentTime, PlayLength);
-            if (CurrentTime < 0.0f)
-            {
-                CurrentTime += PlayLength;
-            }
-        }
-    }
+    const float CurrentTime = GetExtractionTime(Model, ExtractionContext);
 
     // 각 본의 전체 키 배열을 그대로 담고 있는 컨테이너를 리턴
     const TArray<FBoneAnimationTrack>& BoneTracks = Model->GetBoneAnimationTracks();
 
     for (int32 TrackIndex = 0; TrackIndex < BoneTracks.Num(); ++TrackIndex)
     {
-        const FBoneAnimationTrack& Track = BoneTracks[TrackIndex];
-        FName BoneName = Track.Name;
-
         // 이 본 이름의 트랙 데이터를 주어진 시간(Time)에 맞춰 평가해, 하나의 FTransform으로 돌려주는 함수
-        // 1. 본 이름으로 FBoneAnimationTrack을 찾음
+        // 1. 트랙 인덱스로 FBoneAnimationTrack을 바로 가져옴 (본마다 이름 검색하지 않음)
         // 2. 애니 전체 프레임 수와 프레임 레이트를 보고, 현재 시간(Time)을 정수 프레임 인덱스 두개(Frame0/Frame1)와 보간 비율로 선형보간
         //
         // <선형보간 하는 이유>
@@ -73,7 +79,7 @@ void UAnimSequence::GetBonePose(FPoseContext& OutPoseContext, const FAnimExtract
         // 대로 쓰면 "툭툭 끊겨" 보임. EvaluateBoneTrackTransform은 그걸 부드럽게 만들기 위해 Time을 프레임 단위로 환산하고,
         // 바로 앞/뒤의 두 키(Frame0, Frame1) 값을 가져와서 Alpha 비율만큼 보간 위치·스케일은 선형 보간, 회전은 쿼터니언 Slerp을 씀
         // 애니메이션은 "어느 타이밍에 정확히 이 포즈"같이 명시된 키를 그대로 지켜야 하므로 Apporximation 대신 Interpolation을 사용해야함
-        FTransform BoneTransform = Model->EvaluateBoneTrackTransform(BoneName, CurrentTime, true);
+        FTransform BoneTransform = Model->EvaluateBoneTrackTransformByIndex(TrackIndex, CurrentTime);
 
         // Store in pose context (you'll need to map bone name to index)
         // For now, we'll just use track index
@@ -84,6 +90,27 @@ void UAnimSequence::GetBonePose(FPoseContext& OutPoseContext, const FAnimExtract
     }
 }
 
+void UAnimSequence::GetAnimationPose(FPoseView& OutPose, const FAnimExtractContext& ExtractionContext) const
+{
+    const UAnimDataModel* Model = GetDataModel();
+    if (!Model || !OutPose.IsValid() || Model->GetNumberOfFrames() <= 0 || Model->GetFrameRate() <= 0)
+    {
+        return;
+    }
+
+    const float CurrentTime = GetExtractionTime(Model, ExtractionContext);
+    const int32 NumTracks = FMath::Min(Model->GetNumBoneTracks(), OutPose.NumBones);
+
+    for (int32 TrackIndex = 0; TrackIndex < NumTracks; ++TrackIndex)
+    {
+        OutPose.SetBoneTransform(TrackIndex, Model->EvaluateBoneTrackTransformByIndex(TrackIndex, CurrentTime));
+    }
+    for (int32 BoneIndex = NumTracks; BoneIndex < OutPose.NumBones; ++BoneIndex)
+    {
+        OutPose.SetBoneTransform(BoneIndex, FTransform());
+    }
+}
+
 bool UAnimSequence::IsCompatibleWith(const TArray<FName>& SkeletonBoneNames) const
 {
     if (BoneNames.Num() == 0)
@@ -134,6 +161,12 @@ void UAnimSequence::EvaluatePose(float Time, float DeltaTime, TArray<FTransform>
     OutPose = PoseContext.Pose;
 }
 
+void UAnimSequence::EvaluatePose(float Time, float DeltaTime, FPoseView& OutPose, FAnimPoseStack& PoseStack)
+{
+    // 루핑은 TArray 버전과 같이 기본 true
+    GetAnimationPose(OutPose, FAnimExtractContext(Time, true));
+}
+
 int32 UAnimSequence::GetNumBoneTracks() const
 {
     const UAnimDataModel* Model = GetDataModel();
@@ -55,6 +55,10 @@ public:
      * @brief 현재 시간에 해당하는 포즈를 평가
      */
     virtual void EvaluatePose(float Time, float DeltaTime, TArray<FTransform>& OutPose) override;
+    virtual void EvaluatePose(float Time, float DeltaTime, FPoseView& OutPose, FAnimPoseStack& PoseStack) override;
+
+    // 포즈 뷰에 직접 평가 (트랙 수보다 많은 본은 항등 트랜스폼)
+    void GetAnimationPose(FPoseView& OutPose, const FAnimExtractContext& ExtractionContext) const;
 
     /**
      * @brief 본 트랙 개수 반환
@@ -2,6 +2,7 @@
 #include "pch.h"
 #include "AnimNotify/AnimNotify.h"
 #include "AnimNotify/AnimNotifyState.h"
+#include "AnimPoseStack.h"
 
 
 enum class EAnimationMode : uint8
@@ -73,6 +74,20 @@ public:
      */
     virtual void EvaluatePose(float Time, float DeltaTime, TArray<FTransform>& OutPose) = 0;
 
+    /**
+     * @brief 포즈 스택 뷰에 직접 평가 (UAnimInstance 평가 경로, 힙 할당 없음)
+     * @param OutPose 출력 포즈 (PoseStack에서 받은 뷰)
+     * @param PoseStack 중간 포즈가 필요할 때 빌려 쓰는 스택
+     * @note 기본 구현은 스레드별 임시 배열로 위의 EvaluatePose를 호출해 복사한다
+     */
+    virtual void EvaluatePose(float Time, float DeltaTime, FPoseView& OutPose, FAnimPoseStack& PoseStack)
+    {
+        thread_local TArray<FTransform> ScratchPose;
+        ScratchPose.SetNum(GetNumBoneTracks());
+        EvaluatePose(Time, DeltaTime, ScratchPose);
+        OutPose.CopyFrom(ScratchPose);
+    }
+
     /**
      * @brief 애니메이션 총 재생 길이 반환
      */
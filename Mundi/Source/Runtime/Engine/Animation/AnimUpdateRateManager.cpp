@@ -0,0 +1,173 @@
+﻿#include "pch.h"
+#include "AnimUpdateRateManager.h"
+#include "AnimSequence.h"
+#include "AnimUpdateRateStats.h"
+#include "CameraComponent.h"
+
+// ============================================================
+// FAnimPoseShareCache
+// ============================================================
+
+void FAnimPoseShareCache::BeginFrame(float InTimeStep)
+{
+    TimeStep = FMath::Max(InTimeStep, 1e-4f);
+    NumEntries = 0;
+    NumHits = 0;
+
+    // 엔트리 수의 2배 크기 버킷 (처음 한 번만 할당)
+    if (Buckets.Num() != MaxEntries * 2)
+    {
+        Buckets.SetNum(MaxEntries * 2);
+    }
+    std::fill(Buckets.begin(), Buckets.end(), INDEX_NONE);
+}
+
+uint32 FAnimPoseShareCache::HashKey(const UAnimSequence* Sequence, int32 TimeKey, bool bLooping, int32 NumBones) const
+{
+    uint64 Key = reinterpret_cast<uintptr_t>(Sequence);
+    Key ^= (static_cast<uint64>(static_cast<uint32>(TimeKey)) << 1) * 0x9E3779B97F4A7C15ull;
+    Key ^= (static_cast<uint64>(NumBones) << 33) ^ (bLooping ? 1ull : 0ull);
+    Key ^= Key >> 29;
+    return static_cast<uint32>(Key * 0xBF58476D1CE4E5B9ull >> 32);
+}
+
+bool FAnimPoseShareCache::EvaluateShared(const UAnimSequence* Sequence, float Time, bool bLooping, FPoseView& OutPose)
+{
+    if (!Sequence || !OutPose.IsValid())
+    {
+        return false;
+    }
+
+    const int32 TimeKey = static_cast<int32>(std::floor(Time / TimeStep + 0.5f));
+    const float QuantizedTime = TimeKey * TimeStep;
+
+    const uint32 Mask = static_cast<uint32>(Buckets.Num() - 1);
+    uint32 Slot = HashKey(Sequence, TimeKey, bLooping, OutPose.NumBones) & Mask;
+    for (int32 Probe = 0; Probe < Buckets.Num(); ++Probe, Slot = (Slot + 1) & Mask)
+    {
+        const int32 EntryIndex = Buckets[Slot];
+        if (EntryIndex == INDEX_NONE)
+        {
+            break;
+        }
+
+        FEntry& Entry = Entries[EntryIndex];
+        if (Entry.Sequence == Sequence && Entry.TimeKey == TimeKey && Entry.bLooping == bLooping && Entry.NumBones == OutPose.NumBones)
+        {
+            OutPose.CopyFrom(Entry.GetView());
+            ++NumHits;
+            return true;
+        }
+    }
+
+    // 미스: 양자화된 시간으로 평가 (같은 키의 다른 인스턴스와 결과가 같아야 하므로)
+    Sequence->GetAnimationPose(OutPose, FAnimExtractContext(QuantizedTime, bLooping));
+
+    if (NumEntries >= MaxEntries || Buckets[Slot] != INDEX_NONE)
+    {
+        return false;   // 가득 참: 공유 없이 평가만
+    }
+
+    if (Entries.Num() <= NumEntries)
+    {
+        Entries.SetNum(NumEntries + 1);
+    }
+
+    FEntry& NewEntry = Entries[NumEntries];
+    NewEntry.Sequence = Sequence;
+    NewEntry.TimeKey = TimeKey;
+    NewEntry.NumBones = OutPose.NumBones;
+    NewEntry.bLooping = bLooping;
+    NewEntry.Storage.Reset(OutPose.NumBones, 1);
+
+    FPoseView Cached = NewEntry.GetView();
+    Cached.CopyFrom(OutPose);
+
+    Buckets[Slot] = NumEntries++;
+    return false;
+}
+
+// ============================================================
+// FAnimationUpdateRateManager
+// ============================================================
+
+void FAnimationUpdateRateManager::BeginFrame(const UCameraComponent* ViewCamera)
+{
+    ++FrameNumber;
+    PoseShareCache.BeginFrame(Settings.PoseShareTimeStep);
+
+    bHasView = ViewCamera != nullptr && ViewCamera->GetProjectionMode() == ECameraProjectionMode::Perspective;
+    if (!bHasView)
+    {
+        return;
+    }
+
+    ViewLocation = ViewCamera->GetWorldLocation();
+    ViewForward = ViewCamera->GetForward().GetNormalized();
+
+    const float HalfFOV = FMath::Clamp(ViewCamera->GetFOV(), 1.0f, 179.0f) * 0.5f * (PI / 180.0f);
+    TanHalfFOV = std::tan(HalfFOV);
+
+    // 화면비를 알 수 없으므로 16:9 대각선 기준의 보수적인 원뿔로 화면 밖 판정
+    const float TanDiagonal = TanHalfFOV * std::sqrt(1.0f + (16.0f / 9.0f) * (16.0f / 9.0f));
+    const float ConeAngle = std::atan(TanDiagonal);
+    SinConeAngle = std::sin(ConeAngle);
+    CosConeAngle = std::cos(ConeAngle);
+}
+
+bool FAnimationUpdateRateManager::IsOutsideView(const FVector& Origin, float Radius) const
+{
+    const FVector ToOrigin = Origin - ViewLocation;
+    const float Along = FVector::Dot(ToOrigin, ViewForward);
+    if (Along < -Radius)
+    {
+        return true;    // 카메라 뒤
+    }
+
+    const float Perpendicular = (ToOrigin - ViewForward * Along).Size();
+    return Perpendicular * CosConeAngle - Along * SinConeAngle > Radius;
+}
+
+void FAnimationUpdateRateManager::UpdateParams(const FVector& BoundsOrigin, float BoundsRadius, float DeltaTime, FAnimUpdateRateParams& InOutParams) const
+{
+    FAnimUpdateRateParams& Params = InOutParams;
+    Params.AccumulatedDeltaTime += DeltaTime;
+
+    if (!Settings.bEnabled || !bHasView)
+    {
+        Params.LODLevel = 0;
+        Params.UpdateInterval = 1;
+        Params.bOffscreen = false;
+        Params.bInterpolate = false;
+        Params.bSharePose = false;
+        Params.bEvaluateThisFrame = true;
+        return;
+    }
+
+    const float Radius = FMath::Max(BoundsRadius, 0.01f);
+    const float Distance = (BoundsOrigin - ViewLocation).Size();
+    const float ScreenSize = Radius / FMath::Max(Distance * TanHalfFOV, 1e-4f);
+
+    int32 LODLevel = 0;
+    for (int32 Level = 0; Level < FAnimUpdateRateSettings::NumLODs - 1; ++Level)
+    {
+        if (Distance > Settings.DistanceThresholds[Level] || ScreenSize < Settings.ScreenSizeThresholds[Level])
+        {
+            LODLevel = Level + 1;
+        }
+    }
+
+    Params.LODLevel = LODLevel;
+    Params.bOffscreen = IsOutsideView(BoundsOrigin, Radius);
+    Params.UpdateInterval = FMath::Max(Params.bOffscreen ? Settings.OffscreenUpdateInterval : Settings.UpdateIntervals[LODLevel], 1);
+    Params.bInterpolate = Settings.bInterpolateSkippedFrames && !Params.bOffscreen && Params.UpdateInterval > 1;
+    Params.bSharePose = Settings.bEnablePoseSharing && (Params.bOffscreen || LODLevel >= Settings.PoseShareMinLOD);
+
+    // 같은 간격의 인스턴스들이 같은 프레임에 몰리지 않도록 위상을 나눠 평가
+    const uint32 Slot = (FrameNumber + static_cast<uint32>(Params.FramePhase)) % static_cast<uint32>(Params.UpdateInterval);
+    Params.bEvaluateThisFrame = !Params.bHasEvaluated || Slot == 0 || Params.FramesSinceUpdate + 1 >= Params.UpdateInterval;
+    if (!Params.bEvaluateThisFrame)
+    {
+        ++Params.FramesSinceUpdate;
+    }
+}
@@ -0,0 +1,141 @@
+﻿#pragma once
+#include "AnimPoseStack.h"
+
+class UAnimSequence;
+class UCameraComponent;
+
+/**
+ * @brief 애니메이션 업데이트 주기 최적화(URO) 설정
+ * - 거리와 화면 크기 중 더 나쁜 쪽으로 LOD를 정하고, LOD마다 N프레임에 한 번만 포즈를 평가한다
+ * - 화면 밖(시야 원뿔 밖)이면 OffscreenUpdateInterval로 평가하고 건너뛴 프레임은 스키닝도 하지 않는다
+ */
+struct FAnimUpdateRateSettings
+{
+    static constexpr int32 NumLODs = 4;
+
+    bool bEnabled = true;
+    bool bInterpolateSkippedFrames = true;  // 화면 안에서 건너뛴 프레임은 마지막 두 평가 포즈 사이를 보간
+    bool bEnablePoseSharing = true;
+
+    // LOD 1..3 진입 기준 (하나라도 넘으면 해당 단계)
+    float DistanceThresholds[NumLODs - 1] = { 15.0f, 40.0f, 100.0f };     // 미터
+    float ScreenSizeThresholds[NumLODs - 1] = { 0.3f, 0.12f, 0.04f };    // 바운드 반지름 / 화면 절반 높이
+
+    int32 UpdateIntervals[NumLODs] = { 1, 2, 4, 8 };  // 2의 거듭제곱 (프레임 위상 분산에 사용)
+    int32 OffscreenUpdateInterval = 16;
+
+    // 포즈 공유: 이 LOD 이상(또는 화면 밖)인 인스턴스만 양자화된 시간으로 같은 시퀀스 포즈를 공유
+    int32 PoseShareMinLOD = 1;
+    float PoseShareTimeStep = 1.0f / 30.0f;
+};
+
+/**
+ * @brief 컴포넌트별 URO 상태 (USkeletalMeshComponent가 소유)
+ */
+struct FAnimUpdateRateParams
+{
+    int32 LODLevel = 0;
+    int32 UpdateInterval = 1;
+    int32 FramePhase = 0;               // (프레임 번호 + 위상) % 간격 == 0 인 프레임에 평가
+    int32 FramesSinceUpdate = 0;
+    float AccumulatedDeltaTime = 0.0f;  // 마지막 평가 이후 누적 시간 (평가 시 한 번에 진행)
+    bool bOffscreen = false;
+    bool bEvaluateThisFrame = true;
+    bool bInterpolate = false;
+    bool bSharePose = false;
+    bool bHasEvaluated = false;
+
+    // 평가 프레임에 호출: 누적 시간을 돌려주고 초기화
+    float ConsumeDeltaTime()
+    {
+        const float DeltaTime = AccumulatedDeltaTime;
+        AccumulatedDeltaTime = 0.0f;
+        FramesSinceUpdate = 0;
+        bHasEvaluated = true;
+        return DeltaTime;
+    }
+
+    // 이전 평가 포즈 -> 최신 평가 포즈 보간 비율 (평가 프레임 1/N, 다음 평가 직전 1)
+    float GetInterpolationAlpha() const
+    {
+        return FMath::Min(1.0f, static_cast<float>(FramesSinceUpdate + 1) / static_cast<float>(FMath::Max(UpdateInterval, 1)));
+    }
+};
+
+/**
+ * @brief 같은 시퀀스를 양자화된 같은 시간에 재생하는 인스턴스끼리 한 프레임 동안 포즈를 공유하는 캐시
+ * - 키: (시퀀스, 시간 / PoseShareTimeStep 반올림, 루프 여부, 본 수)
+ * - 엔트리와 해시 버킷은 프레임 간 재사용 (같은 군중이면 힙 할당 없음)
+ */
+class FAnimPoseShareCache
+{
+public:
+    static constexpr int32 MaxEntries = 256;
+
+    void BeginFrame(float InTimeStep);
+
+    /**
+     * @brief 캐시에 있으면 복사, 없으면 양자화된 시간으로 평가해 OutPose에 쓰고 캐시에 저장
+     * @return 캐시 적중 여부
+     */
+    bool EvaluateShared(const UAnimSequence* Sequence, float Time, bool bLooping, FPoseView& OutPose);
+
+    int32 GetNumEntries() const { return NumEntries; }
+    int32 GetNumHits() const { return NumHits; }
+
+private:
+    struct FEntry
+    {
+        const UAnimSequence* Sequence = nullptr;
+        int32 TimeKey = 0;
+        int32 NumBones = 0;
+        bool bLooping = false;
+        FAnimPoseStack Storage;     // 포즈 1개 분량
+
+        FPoseView GetView()
+        {
+            Storage.PopTo(0);
+            return Storage.Push();
+        }
+    };
+
+    uint32 HashKey(const UAnimSequence* Sequence, int32 TimeKey, bool bLooping, int32 NumBones) const;
+
+    TArray<FEntry> Entries;     // [0, NumEntries)만 이번 프레임 유효
+    TArray<int32> Buckets;      // 개방 주소법, INDEX_NONE = 빈 칸
+    int32 NumEntries = 0;
+    int32 NumHits = 0;
+    float TimeStep = 1.0f / 30.0f;
+};
+
+/**
+ * @brief 월드별 애니메이션 업데이트 주기 관리자
+ * - UWorld::Tick이 액터 Tick 전에 BeginFrame으로 뷰 정보를 넘긴다
+ * - USkeletalMeshComponent는 매 프레임 UpdateParams로 이번 프레임 평가/보간/생략 여부를 받는다
+ */
+class FAnimationUpdateRateManager
+{
+public:
+    void BeginFrame(const UCameraComponent* ViewCamera);
+
+    void UpdateParams(const FVector& BoundsOrigin, float BoundsRadius, float DeltaTime, FAnimUpdateRateParams& InOutParams) const;
+
+    FAnimUpdateRateSettings& GetSettings() { return Settings; }
+    const FAnimUpdateRateSettings& GetSettings() const { return Settings; }
+
+    FAnimPoseShareCache& GetPoseShareCache() { return PoseShareCache; }
+
+private:
+    bool IsOutsideView(const FVector& Origin, float Radius) const;
+
+    FAnimUpdateRateSettings Settings;
+    FAnimPoseShareCache PoseShareCache;
+
+    uint32 FrameNumber = 0;
+    bool bHasView = false;
+    FVector ViewLocation;
+    FVector ViewForward;
+    float TanHalfFOV = 1.0f;
+    float SinConeAngle = 1.0f;     // 화면 대각선 기준 시야 원뿔
+    float CosConeAngle = 0.0f;
+};
@@ -0,0 +1,64 @@
+﻿#pragma once
+#include "UEContainer.h"
+
+// 애니메이션 업데이트 주기 최적화 통계 (오버레이 출력 주기마다 리셋)
+// 스켈레탈 메시 인스턴스 하나는 프레임마다 아래 넷 중 하나로 센다
+struct FAnimUpdateRateStats
+{
+    uint32 EvaluatedInstances = 0;      // 직접 포즈를 평가
+    uint32 SharedInstances = 0;         // 평가했지만 시퀀스 포즈를 모두 공유 캐시에서 받음
+    uint32 InterpolatedInstances = 0;   // 평가를 건너뛰고 이전 두 포즈 사이를 보간
+    uint32 SkippedInstances = 0;        // 평가도 스키닝도 건너뜀 (화면 밖)
+
+    uint32 SharedPoses = 0;             // 공유 캐시에 새로 만든 포즈 수
+    uint32 SharedPoseHits = 0;          // 공유 캐시 적중 수
+
+    void Reset()
+    {
+        EvaluatedInstances = 0;
+        SharedInstances = 0;
+        InterpolatedInstances = 0;
+        SkippedInstances = 0;
+        SharedPoses = 0;
+        SharedPoseHits = 0;
+    }
+};
+
+// 애니메이션 업데이트 통계 전역 매니저 (싱글톤)
+class FAnimUpdateRateStatManager
+{
+public:
+    static FAnimUpdateRateStatManager& GetInstance()
+    {
+        static FAnimUpdateRateStatManager Instance;
+        return Instance;
+    }
+
+    void AddEvaluated() { ++CurrentStats.EvaluatedInstances; }
+    void AddShared() { ++CurrentStats.SharedInstances; }
+    void AddInterpolated() { ++CurrentStats.InterpolatedInstances; }
+    void AddSkipped() { ++CurrentStats.SkippedInstances; }
+    void AddSharedPoses(uint32 NumPoses, uint32 NumHits)
+    {
+        CurrentStats.SharedPoses += NumPoses;
+        CurrentStats.SharedPoseHits += NumHits;
+    }
+
+    const FAnimUpdateRateStats& GetStats() const
+    {
+        return CurrentStats;
+    }
+
+    void ResetStats()
+    {
+        CurrentStats.Reset();
+    }
+
+private:
+    FAnimUpdateRateStatManager() = default;
+    ~FAnimUpdateRateStatManager() = default;
+    FAnimUpdateRateStatManager(const FAnimUpdateRateStatManager&) = delete;
+    FAnimUpdateRateStatManager& operator=(const FAnimUpdateRateStatManager&) = delete;
+
+    FAnimUpdateRateStats CurrentStats;
+};
@@ -1,6 +1,81 @@
 ﻿#include "pch.h"
 #include "AnimationRuntime.h"
 #include "AnimTypes.h"
+#include "AnimPoseStack.h"
+#include <immintrin.h>
+
+namespace
+{
+	// 네 성분 내적을 모든 레인에 브로드캐스트 (SSE2)
+	inline __m128 Dot4(__m128 A, __m128 B)
+	{
+		__m128 Mul = _mm_mul_ps(A, B);
+		__m128 Sum = _mm_add_ps(Mul, _mm_shuffle_ps(Mul, Mul, _MM_SHUFFLE(2, 3, 0, 1)));
+		return _mm_add_ps(Sum, _mm_shuffle_ps(Sum, Sum, _MM_SHUFFLE(1, 0, 3, 2)));
+	}
+
+	// 길이가 0에 가까우면 항등 회전
+	inline __m128 NormalizeQuat(__m128 Q)
+	{
+		const __m128 LengthSq = Dot4(Q, Q);
+		const __m128 bValid = _mm_cmpgt_ps(LengthSq, _mm_set1_ps(1e-8f));
+		const __m128 Normalized = _mm_div_ps(Q, _mm_sqrt_ps(LengthSq));
+		return _mm_or_ps(_mm_and_ps(bValid, Normalized), _mm_andnot_ps(bValid, _mm_set_ps(1.0f, 0.0f, 0.0f, 0.0f)));
+	}
+
+	// B를 A와 같은 반구로 뒤집는다 (최단 경로)
+	inline __m128 AlignHemisphere(__m128 A, __m128 B)
+	{
+		const __m128 Sign = _mm_and_ps(Dot4(A, B), _mm_set1_ps(-0.0f));
+		return _mm_xor_ps(B, Sign);
+	}
+
+	inline __m128 NlerpQuat(__m128 A, __m128 B, __m128 Alpha)
+	{
+		B = AlignHemisphere(A, B);
+		return NormalizeQuat(_mm_add_ps(A, _mm_mul_ps(_mm_sub_ps(B, A), Alpha)));
+	}
+
+	// 이동/스케일 스트림은 float 4개 블록 단위로 처리하고, 본 수가 4의 배수가 아니면 남는 float은 스칼라로 처리
+	// (뷰의 본 수를 줄여 일부 본만 섞을 때 다음 본의 값을 건드리지 않기 위함)
+	void LerpStream(const FVector* A, const FVector* B, float Alpha, FVector* Out, int32 NumBones)
+	{
+		const float* PtrA = reinterpret_cast<const float*>(A);
+		const float* PtrB = reinterpret_cast<const float*>(B);
+		float* PtrOut = reinterpret_cast<float*>(Out);
+		const int32 NumFloats = NumBones * 3;
+		const int32 NumBlockFloats = NumFloats & ~3;
+		const __m128 AlphaV = _mm_set1_ps(Alpha);
+
+		for (int32 Index = 0; Index < NumBlockFloats; Index += 4)
+		{
+			const __m128 VA = _mm_load_ps(PtrA + Index);
+			const __m128 VB = _mm_load_ps(PtrB + Index);
+			_mm_store_ps(PtrOut + Index, _mm_add_ps(VA, _mm_mul_ps(_mm_sub_ps(VB, VA), AlphaV)));
+		}
+		for (int32 Index = NumBlockFloats; Index < NumFloats; ++Index)
+		{
+			PtrOut[Index] = PtrA[Index] + (PtrB[Index] - PtrA[Index]) * Alpha;
+		}
+	}
+
+	inline void LerpBone(const FPoseView& A, const FPoseView& B, int32 BoneIndex, float Alpha, FPoseView& Out)
+	{
+		const __m128 RA = _mm_load_ps(&A.Rotations[BoneIndex].X);
+		const __m128 RB = _mm_load_ps(&B.Rotations[BoneIndex].X);
+		_mm_store_ps(&Out.Rotations[BoneIndex].X, NlerpQuat(RA, RB, _mm_set1_ps(Alpha)));
+
+		Out.Translations[BoneIndex] = FMath::Lerp(A.Translations[BoneIndex], B.Translations[BoneIndex], Alpha);
+		Out.Scales[BoneIndex] = FMath::Lerp(A.Scales[BoneIndex], B.Scales[BoneIndex], Alpha);
+	}
+
+	inline void CopyBone(const FPoseView& Source, int32 BoneIndex, FPoseView& Out)
+	{
+		Out.Rotations[BoneIndex] = Source.Rotations[BoneIndex];
+		Out.Translations[BoneIndex] = Source.Translations[BoneIndex];
+		Out.Scales[BoneIndex] = Source.Scales[BoneIndex];
+	}
+}
 
 ETypeAdvanceAnim FAnimationRuntime::AdvanceTime(const bool bAllowLooping, const float MoveDelta, float& InOutTime, const float EndTime)
 {
@@ -39,4 +114,178 @@ ETypeAdvanceAnim FAnimationRuntime::AdvanceTime(const bool bAllowLooping, const
 	
 	InOutTime = NewTime;
 	return ETAA_Default;
-}
\ No newline at end of file
+}
+
+void FAnimationRuntime::BlendTwoPosesTogether(const FPoseView& SourcePose1, const FPoseView& SourcePose2, float Alpha, FPoseView& OutPose)
+{
+	if (!SourcePose1.IsValid() || !SourcePose2.IsValid() || !OutPose.IsValid())
+	{
+		return;
+	}
+
+	const float ClampedAlpha = FMath::Clamp(Alpha, 0.0f, 1.0f);
+	if (ClampedAlpha <= 0.0f)
+	{
+		OutPose.CopyFrom(SourcePose1);
+		return;
+	}
+	if (ClampedAlpha >= 1.0f)
+	{
+		OutPose.CopyFrom(SourcePose2);
+		return;
+	}
+
+	const int32 NumBones = FMath::Min(FMath::Min(SourcePose1.NumBones, SourcePose2.NumBones), OutPose.NumBones);
+	const __m128 AlphaV = _mm_set1_ps(ClampedAlpha);
+
+	for (int32 BoneIndex = 0; BoneIndex < NumBones; ++BoneIndex)
+	{
+		const __m128 A = _mm_load_ps(&SourcePose1.Rotations[BoneIndex].X);
+		const __m128 B = _mm_load_ps(&SourcePose2.Rotations[BoneIndex].X);
+		_mm_store_ps(&OutPose.Rotations[BoneIndex].X, NlerpQuat(A, B, AlphaV));
+	}
+
+	LerpStream(SourcePose1.Translations, SourcePose2.Translations, ClampedAlpha, OutPose.Translations, NumBones);
+	LerpStream(SourcePose1.Scales, SourcePose2.Scales, ClampedAlpha, OutPose.Scales, NumBones);
+}
+
+void FAnimationRuntime::BlendPosesPerBone(const FPoseView& BasePose, const FPoseView& BlendPose, const TArray<float>& BoneWeights, float Alpha, FPoseView& OutPose)
+{
+	if (!BasePose.IsValid() || !BlendPose.IsValid() || !OutPose.IsValid())
+	{
+		return;
+	}
+
+	const float ClampedAlpha = FMath::Clamp(Alpha, 0.0f, 1.0f);
+	const int32 NumBones = FMath::Min(FMath::Min(BasePose.NumBones, BlendPose.NumBones), OutPose.NumBones);
+	const bool bInPlace = (BasePose.Rotations == OutPose.Rotations);
+
+	for (int32 BoneIndex = 0; BoneIndex < NumBones; ++BoneIndex)
+	{
+		const float Weight = (BoneIndex < BoneWeights.Num() ? BoneWeights[BoneIndex] : 0.0f) * ClampedAlpha;
+
+		if (Weight <= 0.0f)
+		{
+			if (!bInPlace)
+			{
+				CopyBone(BasePose, BoneIndex, OutPose);
+			}
+		}
+		else if (Weight >= 1.0f)
+		{
+			CopyBone(BlendPose, BoneIndex, OutPose);
+		}
+		else
+		{
+			LerpBone(BasePose, BlendPose, BoneIndex, Weight, OutPose);
+		}
+	}
+}
+
+void FAnimationRuntime::BlendPosesWeighted(const FPoseView* Poses, const float* Weights, int32 NumPoses, FPoseView& OutPose)
+{
+	if (NumPoses <= 0 || !OutPose.IsValid())
+	{
+		return;
+	}
+
+	int32 NumBones = OutPose.NumBones;
+	for (int32 PoseIndex = 0; PoseIndex < NumPoses; ++PoseIndex)
+	{
+		if (!Poses[PoseIndex].IsValid())
+		{
+			return;
+		}
+		NumBones = FMath::Min(NumBones, Poses[PoseIndex].NumBones);
+	}
+
+	if (NumPoses == 1)
+	{
+		OutPose.CopyFrom(Poses[0]);
+		return;
+	}
+
+	// 회전: 첫 포즈 반구에 맞춘 가중 합을 정규화
+	for (int32 BoneIndex = 0; BoneIndex < NumBones; ++BoneIndex)
+	{
+		const __m128 First = _mm_load_ps(&Poses[0].Rotations[BoneIndex].X);
+		__m128 Sum = _mm_mul_ps(First, _mm_set1_ps(Weights[0]));
+		for (int32 PoseIndex = 1; PoseIndex < NumPoses; ++PoseIndex)
+		{
+			const __m128 Q = AlignHemisphere(First, _mm_load_ps(&Poses[PoseIndex].Rotations[BoneIndex].X));
+			Sum = _mm_add_ps(Sum, _mm_mul_ps(Q, _mm_set1_ps(Weights[PoseIndex])));
+		}
+		_mm_store_ps(&OutPose.Rotations[BoneIndex].X, NormalizeQuat(Sum));
+	}
+
+	// 이동/스케일: 블록 단위 가중 합 (출력이 첫 포즈와 같아도 블록을 다 읽은 뒤 쓴다)
+	const int32 NumFloats = NumBones * 3;
+	const int32 NumBlockFloats = NumFloats & ~3;
+	for (int32 Stream = 0; Stream < 2; ++Stream)
+	{
+		float* PtrOut = reinterpret_cast<float*>(Stream == 0 ? OutPose.Translations : OutPose.Scales);
+		for (int32 Index = 0; Index < NumBlockFloats; Index += 4)
+		{
+			__m128 Sum = _mm_setzero_ps();
+			for (int32 PoseIndex = 0; PoseIndex < NumPoses; ++PoseIndex)
+			{
+				const float* PtrIn = reinterpret_cast<const float*>(Stream == 0 ? Poses[PoseIndex].Translations : Poses[PoseIndex].Scales);
+				Sum = _mm_add_ps(Sum, _mm_mul_ps(_mm_load_ps(PtrIn + Index), _mm_set1_ps(Weights[PoseIndex])));
+			}
+			_mm_store_ps(PtrOut + Index, Sum);
+		}
+		for (int32 Index = NumBlockFloats; Index < NumFloats; ++Index)
+		{
+			float Sum = 0.0f;
+			for (int32 PoseIndex = 0; PoseIndex < NumPoses; ++PoseIndex)
+			{
+				const float* PtrIn = reinterpret_cast<const float*>(Stream == 0 ? Poses[PoseIndex].Translations : Poses[PoseIndex].Scales);
+				Sum += PtrIn[Index] * Weights[PoseIndex];
+			}
+			PtrOut[Index] = Sum;
+		}
+	}
+}
+
+void FAnimationRuntime::AccumulateAdditivePose(FPoseView& BasePose, const FPoseView& AdditivePose, float Alpha)
+{
+	if (!BasePose.IsValid() || !AdditivePose.IsValid() || Alpha <= 0.0f)
+	{
+		return;
+	}
+
+	const int32 NumBones = FMath::Min(BasePose.NumBones, AdditivePose.NumBones);
+	const __m128 AlphaV = _mm_set1_ps(Alpha);
+	const __m128 Identity = _mm_set_ps(1.0f, 0.0f, 0.0f, 0.0f);
+
+	for (int32 BoneIndex = 0; BoneIndex < NumBones; ++BoneIndex)
+	{
+		FQuat Delta;
+		_mm_storeu_ps(&Delta.X, NlerpQuat(Identity, _mm_load_ps(&AdditivePose.Rotations[BoneIndex].X), AlphaV));
+		BasePose.Rotations[BoneIndex] = (Delta * BasePose.Rotations[BoneIndex]).GetNormalized();
+	}
+
+	float* Translations = reinterpret_cast<float*>(BasePose.Translations);
+	float* Scales = reinterpret_cast<float*>(BasePose.Scales);
+	const float* AddTranslations = reinterpret_cast<const float*>(AdditivePose.Translations);
+	const float* AddScales = reinterpret_cast<const float*>(AdditivePose.Scales);
+	const int32 NumFloats = NumBones * 3;
+	const int32 NumBlockFloats = NumFloats & ~3;
+	const __m128 One = _mm_set1_ps(1.0f);
+
+	// 스케일 델타는 배율로 저장: S * (1 + (Add - 1) * Alpha)
+	for (int32 Index = 0; Index < NumBlockFloats; Index += 4)
+	{
+		const __m128 T = _mm_load_ps(Translations + Index);
+		_mm_store_ps(Translations + Index, _mm_add_ps(T, _mm_mul_ps(_mm_load_ps(AddTranslations + Index), AlphaV)));
+
+		const __m128 S = _mm_load_ps(Scales + Index);
+		const __m128 Factor = _mm_add_ps(One, _mm_mul_ps(_mm_sub_ps(_mm_load_ps(AddScales + Index), One), AlphaV));
+		_mm_store_ps(Scales + Index, _mm_mul_ps(S, Factor));
+	}
+	for (int32 Index = NumBlockFloats; Index < NumFloats; ++Index)
+	{
+		Translations[Index] += AddTranslations[Index] * Alpha;
+		Scales[Index] *= 1.0f + (AddScales[Index] - 1.0f) * Alpha;
+	}
+}
@@ -1,10 +1,27 @@
 ﻿#pragma once 
 #include "AnimTypes.h"
 
+struct FPoseView;
+
 class FAnimationRuntime
 {
 public:
 
 	static ETypeAdvanceAnim AdvanceTime(const bool bAllowLooping, const float MoveDelta, float& InOutTime, const float EndTime);
 
+	// ============================================================
+	// 포즈 블렌드 커널 (FAnimPoseStack에서 받은 뷰 전용, 출력은 입력과 같은 뷰여도 된다)
+	// 회전은 최단 경로 Nlerp, 이동/스케일은 스트림 단위 SSE 선형 보간
+	// ============================================================
+
+	static void BlendTwoPosesTogether(const FPoseView& SourcePose1, const FPoseView& SourcePose2, float Alpha, FPoseView& OutPose);
+
+	// 본별 가중치(0~1) x Alpha로 BlendPose를 섞는다 (상/하체 분리 등), 가중치 배열보다 뒤의 본은 BasePose 유지
+	static void BlendPosesPerBone(const FPoseView& BasePose, const FPoseView& BlendPose, const TArray<float>& BoneWeights, float Alpha, FPoseView& OutPose);
+
+	// 가중치 합이 1인 여러 포즈의 가중 평균 (BlendSpace 삼각형 등)
+	static void BlendPosesWeighted(const FPoseView* Poses, const float* Weights, int32 NumPoses, FPoseView& OutPose);
+
+	// 델타 포즈를 Alpha만큼 누적: 이동은 더하고, 회전은 앞에 곱하고, 스케일은 곱한다
+	static void AccumulateAdditivePose(FPoseView& BasePose, const FPoseView& AdditivePose, float Alpha);
 };
\ No newline at end of file
@@ -9,35 +9,63 @@ void UAnimationStateMachine::Initialize(UAnimInstance* InOwner, EAnimLayer InLay
 {
     Owner = InOwner;
     TargetLayer = InLayer;
-    
-    UE_LOG("AnimationStateMachine initialized");
+
+    // 기본 입력 변수 (AnimInstance가 갱신)
+    DeclareVariable(FAnimStateMachineInputs::Speed);
+    DeclareVariable(FAnimStateMachineInputs::IsMoving);
+    DeclareVariable(FAnimStateMachineInputs::IsGrounded, 1.0f);
+
+    if (bLogStateChanges)
+    {
+        UE_LOG("AnimationStateMachine initialized");
+    }
 }
 
 void UAnimationStateMachine::AddState(const FAnimationState& State)
 {
+    if (StateIndexByName.Contains(State.Name))
+    {
+        UE_LOG("AnimationStateMachine::AddState - Duplicate state: %s", State.Name.ToString().c_str());
+        return;
+    }
+
+    StateIndexByName.Add(State.Name, States.Num());
     States.Add(State);
-    UE_LOG("AnimationStateMachine: State added - %s", State.Name.ToString().c_str());
+    bTransitionIndexDirty = true;
+
+    if (bLogStateChanges)
+    {
+        UE_LOG("AnimationStateMachine: State added - %s", State.Name.ToString().c_str());
+    }
 }
 
 void UAnimationStateMachine::AddTransition(const FStateTransition& Transition)
 {
     Transitions.Add(Transition);
-    UE_LOG("AnimationStateMachine: Transition added - %s -> %s",
-        Transition.FromState.ToString().c_str(),
-        Transition.ToState.ToString().c_str());
+    bTransitionIndexDirty = true;
+
+    if (bLogStateChanges)
+    {
+        UE_LOG("AnimationStateMachine: Transition added - %s -> %s",
+            Transition.FromState.ToString().c_str(),
+            Transition.ToState.ToString().c_str());
+    }
 }
 
 void UAnimationStateMachine::SetInitialState(const FName& StateName)
 {
-    const FAnimationState* State = FindState(StateName);
-    if (!State)
+    const int32 StateIndex = FindStateIndex(StateName);
+    if (StateIndex == INDEX_NONE)
     {
         UE_LOG("AnimationStateMachine::SetInitialState - State not found: %s",
             StateName.ToString().c_str());
         return;
     }
 
+    const FAnimationState* State = &States[StateIndex];
     CurrentStateName = StateName;
+    CurrentStateIndex = StateIndex;
+    bEvaluateAllTransitions = true;
 
     // 초기 상태의 애니메이션 재생
     if (Owner)
@@ -56,8 +84,12 @@ void UAnimationStateMachine::SetInitialState(const FName& StateName)
             // 새 방식: PoseProvider 재생 (BlendSpace 등)
             Owner->PlayPoseProvider(State->PoseProvider, State->bLoop, State->PlayRate);
         }
-        UE_LOG("AnimationStateMachine: Initial state set to '%s' (RootMotion: %d)",
-            StateName.ToString().c_str(), State->bEnableRootMotion ? 1 : 0);
+
+        if (bLogStateChanges)
+        {
+            UE_LOG("AnimationStateMachine: Initial state set to '%s' (RootMotion: %d)",
+                StateName.ToString().c_str(), State->bEnableRootMotion ? 1 : 0);
+        }
     }
 }
 
@@ -68,10 +100,13 @@ void UAnimationStateMachine::ProcessState(float DeltaSeconds)
         return;
     }
 
-    const FAnimationState* CurrentState = FindState(CurrentStateName);
-    if (CurrentState && CurrentState->OnUpdate)
+    if (CurrentStateIndex != INDEX_NONE)
     {
-        CurrentState->OnUpdate();
+        const FAnimationState& CurrentState = States[CurrentStateIndex];
+        if (CurrentState.OnUpdate)
+        {
+            CurrentState.OnUpdate();
+        }
     }
 
     // 전이 조건 평가
@@ -80,45 +115,213 @@ void UAnimationStateMachine::ProcessState(float DeltaSeconds)
 
 const FAnimationState* UAnimationStateMachine::FindState(const FName& StateName) const
 {
-    for (const FAnimationState& State : States)
-    {
-        if (State.Name == StateName)
-        {
-            return &State;
-        }
-    }
-    return nullptr;
+    const int32 StateIndex = FindStateIndex(StateName);
+    return StateIndex != INDEX_NONE ? &States[StateIndex] : nullptr;
+}
+
+int32 UAnimationStateMachine::FindStateIndex(const FName& StateName) const
+{
+    const int32* Index = StateIndexByName.Find(StateName);
+    return Index ? *Index : INDEX_NONE;
 }
 
 void UAnimationStateMachine::Clear()
 {
     States.Empty();
+    StateIndexByName.Empty();
     Transitions.Empty();
+    TransitionsByState.Empty();
+    bTransitionIndexDirty = true;
+    bEvaluateAllTransitions = true;
+    bSampleMovementInputs = false;
+    // 변수 선언은 유지 (AnimInstance가 계속 갱신), 컴파일 결과가 새로 읽는 변수는 다시 선언된다
     // @todo FName_None으로 대체
     CurrentStateName = "";
+    CurrentStateIndex = INDEX_NONE;
 }
 
-void UAnimationStateMachine::EvaluateTransitions()
+// ============================================================
+// 입력 변수
+// ============================================================
+
+int32 UAnimationStateMachine::DeclareVariable(const FName& VariableName, float InitialValue)
+{
+    if (const int32* Found = VariableIndexByName.Find(VariableName))
+    {
+        return *Found;
+    }
+
+    const int32 Index = VariableNames.Num();
+    VariableIndexByName.Add(VariableName, Index);
+    VariableNames.Add(VariableName);
+    VariableValues.Add(InitialValue);
+
+    // 새 변수에 의존하는 전이 마스크를 다시 만든다
+    bTransitionIndexDirty = true;
+    return Index;
+}
+
+int32 UAnimationStateMachine::FindVariable(const FName& VariableName) const
 {
-    for (const FStateTransition& Transition : Transitions)
+    const int32* Found = VariableIndexByName.Find(VariableName);
+    return Found ? *Found : INDEX_NONE;
+}
+
+void UAnimationStateMachine::SetVariable(int32 VariableIndex, float Value)
+{
+    if (VariableIndex < 0 || VariableIndex >= VariableValues.Num())
     {
-        // 현재 상태에서 출발하는 전이만 평가
-        if (Transition.FromState != CurrentStateName)
+        return;
+    }
+
+    if (VariableValues[VariableIndex] != Value)
+    {
+        VariableValues[VariableIndex] = Value;
+        DirtyInputMask |= VariableBit(VariableIndex);
+    }
+}
+
+void UAnimationStateMachine::SetVariable(const FName& VariableName, float Value)
+{
+    int32 VariableIndex = FindVariable(VariableName);
+    if (VariableIndex == INDEX_NONE)
+    {
+        VariableIndex = DeclareVariable(VariableName, Value);
+        DirtyInputMask |= VariableBit(VariableIndex);
+        return;
+    }
+    SetVariable(VariableIndex, Value);
+}
+
+float UAnimationStateMachine::GetVariable(int32 VariableIndex) const
+{
+    return (VariableIndex >= 0 && VariableIndex < VariableValues.Num()) ? VariableValues[VariableIndex] : 0.0f;
+}
+
+float UAnimationStateMachine::GetVariable(const FName& VariableName) const
+{
+    return GetVariable(FindVariable(VariableName));
+}
+
+// ============================================================
+// 전이 평가
+// ============================================================
+
+void UAnimationStateMachine::RebuildTransitionIndex()
+{
+    TransitionsByState.Empty();
+    TransitionsByState.SetNum(States.Num());
+
+    for (int32 TransitionIndex = 0; TransitionIndex < Transitions.Num(); ++TransitionIndex)
+    {
+        FStateTransition& Transition = Transitions[TransitionIndex];
+
+        const int32 FromIndex = FindStateIndex(Transition.FromState);
+        const int32 ToIndex = FindStateIndex(Transition.ToState);
+        if (FromIndex == INDEX_NONE || ToIndex == INDEX_NONE)
         {
+            UE_LOG("AnimationStateMachine: Transition ignored, state not found - %s -> %s",
+                Transition.FromState.ToString().c_str(),
+                Transition.ToState.ToString().c_str());
             continue;
         }
 
-        // 조건 함수가 없으면 건너뛰기
-        if (!Transition.Condition)
+        // 조건이 하나도 없으면 기존과 같이 전이하지 않음
+        if (!Transition.Condition && Transition.Rules.IsEmpty())
         {
             continue;
         }
 
-        // 조건 평가
-        if (Transition.Condition())
+        FTransitionEntry Entry;
+        Entry.TransitionIndex = TransitionIndex;
+        Entry.ToStateIndex = ToIndex;
+        Entry.bPolled = Transition.Condition && Transition.bPollCondition;
+
+        for (FTransitionRule& Rule : Transition.Rules)
+        {
+            Rule.VariableIndex = DeclareVariable(Rule.Input);
+            Entry.InputMask |= VariableBit(Rule.VariableIndex);
+        }
+        if (Transition.Condition)
+        {
+            for (const FName& Input : Transition.Inputs)
+            {
+                Entry.InputMask |= VariableBit(DeclareVariable(Input));
+            }
+        }
+
+        FStateTransitionList& List = TransitionsByState[FromIndex];
+        List.Entries.Add(Entry);
+        List.CombinedInputMask |= Entry.InputMask;
+        List.bHasPolled |= Entry.bPolled;
+    }
+
+    // 색인 갱신 중 선언된 변수는 이미 반영됨
+    bTransitionIndexDirty = false;
+    bEvaluateAllTransitions = true;
+}
+
+bool UAnimationStateMachine::PassesTransition(const FStateTransition& Transition) const
+{
+    for (const FTransitionRule& Rule : Transition.Rules)
+    {
+        const float Value = VariableValues[Rule.VariableIndex];
+        bool bPass = false;
+        switch (Rule.Compare)
+        {
+        case EAnimTransitionCompare::Less:         bPass = Value < Rule.Value; break;
+        case EAnimTransitionCompare::LessEqual:    bPass = Value <= Rule.Value; break;
+        case EAnimTransitionCompare::Greater:      bPass = Value > Rule.Value; break;
+        case EAnimTransitionCompare::GreaterEqual: bPass = Value >= Rule.Value; break;
+        case EAnimTransitionCompare::Equal:        bPass = Value == Rule.Value; break;
+        case EAnimTransitionCompare::NotEqual:     bPass = Value != Rule.Value; break;
+        }
+        if (!bPass)
+        {
+            return false;
+        }
+    }
+
+    return !Transition.Condition || Transition.Condition();
+}
+
+void UAnimationStateMachine::EvaluateTransitions()
+{
+    if (bTransitionIndexDirty)
+    {
+        RebuildTransitionIndex();
+    }
+
+    if (CurrentStateIndex == INDEX_NONE)
+    {
+        DirtyInputMask = 0;
+        return;
+    }
+
+    // 조건은 입력 변수만 읽는 순수 함수이므로 (폴링 전이 제외) 지난 평가 이후 바뀐 변수에 의존하는 전이만 다시 본다
+    const FStateTransitionList& List = TransitionsByState[CurrentStateIndex];
+    const uint64 Dirty = DirtyInputMask;
+    const bool bEvaluateAll = bEvaluateAllTransitions;
+    DirtyInputMask = 0;
+    bEvaluateAllTransitions = false;
+
+    if (!bEvaluateAll && !List.bHasPolled && (List.CombinedInputMask & Dirty) == 0)
+    {
+        return;
+    }
+
+    for (const FTransitionEntry& Entry : List.Entries)
+    {
+        if (!bEvaluateAll && !Entry.bPolled && (Entry.InputMask & Dirty) == 0)
+        {
+            continue;
+        }
+
+        ++NumConditionEvaluations;
+        if (PassesTransition(Transitions[Entry.TransitionIndex]))
         {
             // 조건이 만족되면 상태 전이
-            ChangeState(Transition.ToState, Transition.BlendTime);
+            ChangeState(Entry.ToStateIndex, Transitions[Entry.TransitionIndex].BlendTime);
             break; // 하나의 전이만 처리
         }
     }
@@ -126,26 +329,39 @@ void UAnimationStateMachine::EvaluateTransitions()
 
 void UAnimationStateMachine::ChangeState(const FName& NewStateName, float BlendTime)
 {
-    if (CurrentStateName == NewStateName)
+    const int32 NewStateIndex = FindStateIndex(NewStateName);
+    if (NewStateIndex == INDEX_NONE)
+    {
+        UE_LOG("AnimationStateMachine::ChangeState - State not found: %s",
+            NewStateName.ToString().c_str());
+        return;
+    }
+    ChangeState(NewStateIndex, BlendTime);
+}
+
+void UAnimationStateMachine::ChangeState(int32 NewStateIndex, float BlendTime)
+{
+    if (CurrentStateIndex == NewStateIndex)
     {
         return; // 이미 해당 상태
     }
 
-    const FAnimationState* NewState = FindState(NewStateName);
-    if (!NewState)
+    const FAnimationState* NewState = &States[NewStateIndex];
+
+    if (bLogStateChanges)
     {
-        UE_LOG("AnimationStateMachine::ChangeState - State not found: %s",
-            NewStateName.ToString().c_str());
-        return;
+        UE_LOG("AnimationStateMachine: State transition - %s -> %s (BlendTime: %.2f, RootMotion: %d)",
+            CurrentStateName.ToString().c_str(),
+            NewState->Name.ToString().c_str(),
+            BlendTime,
+            NewState->bEnableRootMotion ? 1 : 0);
     }
 
-    UE_LOG("AnimationStateMachine: State transition - %s -> %s (BlendTime: %.2f, RootMotion: %d)",
-        CurrentStateName.ToString().c_str(),
-        NewStateName.ToString().c_str(),
-        BlendTime,
-        NewState->bEnableRootMotion ? 1 : 0);
+    CurrentStateName = NewState->Name;
+    CurrentStateIndex = NewStateIndex;
 
-    CurrentStateName = NewStateName;
+    // 새 상태에서 나가는 전이는 다음 평가에서 변수 변경 여부와 무관하게 한 번 모두 평가
+    bEvaluateAllTransitions = true;
 
     // 새 상태의 애니메이션 재생
     if (Owner)
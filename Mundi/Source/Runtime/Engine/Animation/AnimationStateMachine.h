@@ -40,6 +40,8 @@ struct FAnimationState
         , PoseProvider(InSequence)  // AnimSequence는 IAnimPoseProvider를 구현
         , bLoop(InLoop)
         , PlayRate(InPlayRate)
+        , bEnableRootMotion(false)
+        , AnimationCutEndTime(0.0f)
     {}
 
     // PoseProvider 직접 설정 생성자 (BlendSpace 등)
@@ -49,11 +51,56 @@ struct FAnimationState
         , PoseProvider(InPoseProvider)
         , bLoop(InLoop)
         , PlayRate(InPlayRate)
+        , bEnableRootMotion(false)
+        , AnimationCutEndTime(0.0f)
+    {}
+};
+
+/**
+ * @brief 상태 머신 기본 입력 변수 이름 (AnimInstance가 매 프레임 갱신)
+ */
+struct FAnimStateMachineInputs
+{
+    static constexpr const char* Speed = "Speed";             // 이동 속력
+    static constexpr const char* IsMoving = "IsMoving";       // 이동 중 (0/1)
+    static constexpr const char* IsGrounded = "IsGrounded";   // 지면 위 (0/1)
+};
+
+enum class EAnimTransitionCompare : uint8
+{
+    Less,
+    LessEqual,
+    Greater,
+    GreaterEqual,
+    Equal,
+    NotEqual
+};
+
+/**
+ * @brief 입력 변수 하나에 대한 비교 규칙 (bool 변수는 0/1로 비교)
+ */
+struct FTransitionRule
+{
+    FName Input;
+    EAnimTransitionCompare Compare = EAnimTransitionCompare::Greater;
+    float Value = 0.0f;
+
+    int32 VariableIndex = -1;   // 상태 머신이 전이 색인을 만들 때 채운다
+
+    FTransitionRule() = default;
+    FTransitionRule(const FName& InInput, EAnimTransitionCompare InCompare, float InValue)
+        : Input(InInput)
+        , Compare(InCompare)
+        , Value(InValue)
     {}
 };
 
 /**
  * @brief 상태 전이 조건
+ * - Rules: 입력 변수 비교 (모두 만족해야 함), 참조한 변수가 바뀔 때만 다시 평가
+ * - Condition: 임의 조건 함수, Inputs에 의존 변수를 적고 bPollCondition을 끄면 Rules와 같이 변경 시에만 평가
+ *   (bPollCondition이 켜져 있으면 기존처럼 현재 상태일 때 매 프레임 평가)
+ * - Rules와 Condition이 모두 있으면 둘 다 만족해야 전이
  */
 struct FStateTransition
 {
@@ -62,6 +109,10 @@ struct FStateTransition
     std::function<bool()> Condition;  // 전이 조건 함수
     float BlendTime;            // 블렌드 시간
 
+    TArray<FTransitionRule> Rules;
+    TArray<FName> Inputs;       // Condition이 읽는 입력 변수
+    bool bPollCondition = true;
+
     FStateTransition()
         : FromState("None")
         , ToState("None")
@@ -75,6 +126,15 @@ struct FStateTransition
         , Condition(InCondition)
         , BlendTime(InBlendTime)
     {}
+
+    FStateTransition(const FName& From, const FName& To, std::initializer_list<FTransitionRule> InRules, float InBlendTime = 0.2f)
+        : FromState(From)
+        , ToState(To)
+        , Condition(nullptr)
+        , BlendTime(InBlendTime)
+        , Rules(InRules)
+        , bPollCondition(false)
+    {}
 };
 
 /**
@@ -98,7 +158,13 @@ struct FStateTransition
  * StateMachine->AddState(FAnimationState("Walk", WalkAnim, true, 1.0f));
  * StateMachine->AddState(FAnimationState("Run", RunAnim, true, 1.0f));
  *
- * // 4. 전이 조건 추가 (람다 함수 사용)
+ * // 4. 전이 조건 추가
+ * // 입력 변수 규칙: Speed가 바뀐 프레임에만 평가된다
+ * StateMachine->AddTransition(FStateTransition("Idle", "Walk", {
+ *     FTransitionRule(FAnimStateMachineInputs::Speed, EAnimTransitionCompare::Greater, 0.0f),
+ *     FTransitionRule(FAnimStateMachineInputs::Speed, EAnimTransitionCompare::Less, 5.0f) }, 0.2f));
+ *
+ * // 람다 함수 (Inputs를 지정하지 않으면 매 프레임 평가)
  * // Idle -> Walk: 이동 속도가 0보다 크고 5 미만일 때
  * StateMachine->AddTransition(FStateTransition(
  *     "Idle", "Walk",
@@ -142,7 +208,7 @@ struct FStateTransition
  * // 6. AnimInstance에 상태머신 연결
  * AnimInstance->SetStateMachine(StateMachine);
  *
- * // 7. 게임플레이 중 파라미터 업데이트 (전이 조건 평가에 사용됨)
+ * // 7. 게임플레이 중 파라미터 업데이트 (변경된 변수에 의존하는 전이만 평가됨)
  * AnimInstance->SetMovementSpeed(3.0f);  // Walk 애니메이션으로 자동 전이
  * AnimInstance->SetMovementSpeed(7.0f);  // Run 애니메이션으로 자동 전이
  * AnimInstance->SetMovementSpeed(0.0f);  // Idle 애니메이션으로 자동 전이
@@ -156,7 +222,7 @@ public:
     virtual ~UAnimationStateMachine() = default;
 
     /**
-     * @brief 상태 머신 초기화
+     * @brief 상태 머신 초기화 (기본 입력 변수 Speed/IsMoving/IsGrounded 선언)
      * @param InOwner 소유 AnimInstance
      */
     void Initialize(UAnimInstance* InOwner, EAnimLayer InLayer = EAnimLayer::Base);
@@ -189,17 +255,52 @@ public:
      * @brief 현재 상태 반환
      */
     FName GetCurrentState() const { return CurrentStateName; }
+    int32 GetCurrentStateIndex() const { return CurrentStateIndex; }
 
     /**
      * @brief 특정 상태 찾기
      */
     const FAnimationState* FindState(const FName& StateName) const;
+    int32 FindStateIndex(const FName& StateName) const;
 
     /**
      * @brief 내부 상태 초기화 (Owner 정보는 유지, 블루프린트 컴파일용)
      */
     void Clear();
 
+    // ========================================================================
+    // 입력 변수 (전이 재평가 트리거)
+    // ========================================================================
+
+    /**
+     * @brief 입력 변수 선언, 이미 있으면 기존 인덱스 반환
+     */
+    int32 DeclareVariable(const FName& VariableName, float InitialValue = 0.0f);
+    int32 FindVariable(const FName& VariableName) const;
+
+    /**
+     * @brief 값이 바뀌면 해당 변수에 의존하는 전이를 다음 ProcessState에서 평가
+     */
+    void SetVariable(int32 VariableIndex, float Value);
+    void SetVariable(const FName& VariableName, float Value);
+    void SetBoolVariable(const FName& VariableName, bool bValue) { SetVariable(VariableName, bValue ? 1.0f : 0.0f); }
+
+    float GetVariable(int32 VariableIndex) const;
+    float GetVariable(const FName& VariableName) const;
+
+    /**
+     * @brief 전이 조건이 캐릭터 무브먼트를 직접 읽는 경우 (블루프린트 컴파일 결과)
+     * AnimInstance가 무브먼트 컴포넌트에서 기본 입력 변수를 매 프레임 채운다
+     */
+    void SetSampleMovementInputs(bool bEnabled) { bSampleMovementInputs = bEnabled; }
+    bool ShouldSampleMovementInputs() const { return bSampleMovementInputs; }
+
+    /** 상태 전이 로그 출력 여부 (벤치마크 등 대량 생성 시 끔) */
+    void SetLogStateChanges(bool bEnabled) { bLogStateChanges = bEnabled; }
+
+    /** 누적 전이 조건 평가 횟수 (Rules/Condition 한 번 검사 = 1) */
+    uint64 GetNumConditionEvaluations() const { return NumConditionEvaluations; }
+
 protected:
     /**
      * @brief 상태 전이 평가
@@ -212,19 +313,67 @@ protected:
      * @param BlendTime 블렌드 시간
      */
     void ChangeState(const FName& NewStateName, float BlendTime);
+    void ChangeState(int32 NewStateIndex, float BlendTime);
+
+    /**
+     * @brief 출발 상태별 전이 목록과 변수 의존 마스크를 다시 만든다 (상태/전이 추가 후 첫 평가 시)
+     */
+    void RebuildTransitionIndex();
+
+    bool PassesTransition(const FStateTransition& Transition) const;
+
+    /** 변수 인덱스 -> 의존 마스크 비트 (64개를 넘으면 비트를 공유해 더 자주 평가될 뿐 누락은 없음) */
+    static uint64 VariableBit(int32 VariableIndex) { return 1ull << (VariableIndex & 63); }
 
 protected:
+    struct FTransitionEntry
+    {
+        int32 TransitionIndex = -1;
+        int32 ToStateIndex = -1;
+        uint64 InputMask = 0;       // 의존 변수 비트
+        bool bPolled = false;       // 매 프레임 평가 (의존 변수를 모르는 Condition)
+    };
+
+    /** 출발 상태 하나의 전이 목록 (추가 순서 유지) */
+    struct FStateTransitionList
+    {
+        TArray<FTransitionEntry> Entries;
+        uint64 CombinedInputMask = 0;
+        bool bHasPolled = false;
+    };
+
     /** 소유 AnimInstance */
     UAnimInstance* Owner = nullptr;
 
-    /** 상태 목록 */
+    /** 상태 목록 (인덱스로 참조) */
     TArray<FAnimationState> States;
+    TMap<FName, int32> StateIndexByName;
 
     /** 전이 목록 */
     TArray<FStateTransition> Transitions;
 
+    /** States와 같은 순서의 출발 상태별 전이 색인 */
+    TArray<FStateTransitionList> TransitionsByState;
+    bool bTransitionIndexDirty = true;
+
+    /** 입력 변수 */
+    TArray<FName> VariableNames;
+    TArray<float> VariableValues;
+    TMap<FName, int32> VariableIndexByName;
+
+    /** 지난 평가 이후 바뀐 변수 비트 */
+    uint64 DirtyInputMask = 0;
+
+    /** 상태 진입 직후에는 나가는 전이를 모두 평가 */
+    bool bEvaluateAllTransitions = true;
+
+    bool bSampleMovementInputs = false;
+    bool bLogStateChanges = true;
+    uint64 NumConditionEvaluations = 0;
+
     /** 현재 상태 */
     FName CurrentStateName;
+    int32 CurrentStateIndex = -1;
 
     /** 애니메이션을 적용시킬 layer */
     EAnimLayer TargetLayer = EAnimLayer::Base;
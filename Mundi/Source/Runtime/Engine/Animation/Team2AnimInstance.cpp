@@ -81,6 +81,8 @@ void UTeam2AnimInstance::BuildStateMachine()
 
     constexpr float BlendTimeSeconds = 0.3f;
 
+    // 전이 조건은 Speed 입력 변수 규칙으로 표현 (SetMovementSpeed로 값이 바뀐 프레임에만 평가)
+
     // Idle 상태 추가 (루프, 1.0배속)
     StateMachine->AddState(FAnimationState("Idle", IdleSequence, true, 1.0f));
 
@@ -95,7 +97,8 @@ void UTeam2AnimInstance::BuildStateMachine()
     // 블렌드 시간: 0.3초 (블렌드 전환)
     StateMachine->AddTransition(FStateTransition(
         "Idle", "Walk",
-        [this]() { return GetMovementSpeed() >= WalkThreshold && GetMovementSpeed() < RunThreshold; },
+        { FTransitionRule(FAnimStateMachineInputs::Speed, EAnimTransitionCompare::GreaterEqual, WalkThreshold),
+          FTransitionRule(FAnimStateMachineInputs::Speed, EAnimTransitionCompare::Less, RunThreshold) },
         BlendTimeSeconds
     ));
 
@@ -104,7 +107,7 @@ void UTeam2AnimInstance::BuildStateMachine()
     // 블렌드 시간: 0.3초 (블렌드 전환)
     StateMachine->AddTransition(FStateTransition(
         "Idle", "Run",
-        [this]() { return GetMovementSpeed() >= RunThreshold; },
+        { FTransitionRule(FAnimStateMachineInputs::Speed, EAnimTransitionCompare::GreaterEqual, RunThreshold) },
         BlendTimeSeconds
     ));
 
@@ -113,7 +116,7 @@ void UTeam2AnimInstance::BuildStateMachine()
     // 블렌드 시간: 0.3초 (블렌드 전환)
     StateMachine->AddTransition(FStateTransition(
         "Walk", "Idle",
-        [this]() { return GetMovementSpeed() < WalkThreshold; },
+        { FTransitionRule(FAnimStateMachineInputs::Speed, EAnimTransitionCompare::Less, WalkThreshold) },
         BlendTimeSeconds
     ));
 
@@ -122,7 +125,7 @@ void UTeam2AnimInstance::BuildStateMachine()
     // 블렌드 시간: 0.3초 (블렌드 전환)
     StateMachine->AddTransition(FStateTransition(
         "Walk", "Run",
-        [this]() { return GetMovementSpeed() >= RunThreshold; },
+        { FTransitionRule(FAnimStateMachineInputs::Speed, EAnimTransitionCompare::GreaterEqual, RunThreshold) },
         BlendTimeSeconds
     ));
 
@@ -131,7 +134,8 @@ void UTeam2AnimInstance::BuildStateMachine()
     // 블렌드 시간: 0.3초 (블렌드 전환)
     StateMachine->AddTransition(FStateTransition(
         "Run", "Walk",
-        [this]() { return GetMovementSpeed() >= WalkThreshold && GetMovementSpeed() < RunThreshold; },
+        { FTransitionRule(FAnimStateMachineInputs::Speed, EAnimTransitionCompare::GreaterEqual, WalkThreshold),
+          FTransitionRule(FAnimStateMachineInputs::Speed, EAnimTransitionCompare::Less, RunThreshold) },
         BlendTimeSeconds
     ));
 
@@ -140,7 +144,7 @@ void UTeam2AnimInstance::BuildStateMachine()
     // 블렌드 시간: 0.3초 (블렌드 전환)
     StateMachine->AddTransition(FStateTransition(
         "Run", "Idle",
-        [this]() { return GetMovementSpeed() < WalkThreshold; },
+        { FTransitionRule(FAnimStateMachineInputs::Speed, EAnimTransitionCompare::Less, WalkThreshold) },
         BlendTimeSeconds
     ));
 
@@ -677,7 +677,7 @@ bool CPickingSystem::CheckActorPicking(const AActor* Actor, const FRay& Ray, flo
 			if (BVH)
 			{
 				float THitLocal;
-				if (BVH->IntersectRay(LocalRay, StaticMesh->Vertices, StaticMesh->Indices, THitLocal))
+				if (BVH->IntersectRay(LocalRay, THitLocal))
 				{
 					const FVector HitLocal = FVector(
 						LocalOrigin4.X + LocalDir4.X * THitLocal,
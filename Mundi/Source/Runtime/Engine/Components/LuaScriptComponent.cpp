@@ -80,6 +80,9 @@ void ULuaScriptComponent::BeginPlay()
 	FuncOnEndOverlap = FLuaManager::GetFunc(Env, "OnEndOverlap");
 	FuncOnHit = FLuaManager::GetFunc(Env, "OnHit");
 	FuncEndPlay		  =	FLuaManager::GetFunc(Env, "EndPlay");
+
+	// Tick은 FLuaManager가 같은 스크립트끼리 묶어서 한 번에 디스패치
+	bTickBatched = LuaVM->RegisterScriptTick(this, ScriptFilePath, FuncTick);
 	
 	if (FuncBeginPlay.valid()) {
 		auto Result = FuncBeginPlay();
@@ -179,6 +182,12 @@ void ULuaScriptComponent::OnHit(UPrimitiveComponent* MyComp, UPrimitiveComponent
 
 void ULuaScriptComponent::TickComponent(float DeltaTime)
 {
+	// 배치 등록된 경우 FLuaManager::TickScripts에서 호출됨
+	if (bTickBatched)
+	{
+		return;
+	}
+
 	if (FuncTick.valid()) {
 		auto Result = FuncTick(DeltaTime);
 		if (!Result.valid()) { sol::error Err = Result; UE_LOG("[Lua][error] %s\n", Err.what()); }
@@ -204,7 +213,7 @@ void ULuaScriptComponent::EndPlay()
 	{
 		Owner->OnComponentBeginOverlap.Remove(BeginHandleLua);
 		Owner->OnComponentEndOverlap.Remove(EndHandleLua);
-		// Owner->OnComponentHit.Remove(HitHandleLua);
+		Owner->OnComponentHit.Remove(HitHandleLua);
 	}
 
 	// 모든 Lua 관련 리소스 정리
@@ -227,8 +236,12 @@ void ULuaScriptComponent::CleanupLuaResources()
 		{
 			// 1. 코루틴 정리 (가장 중요. Use-After-Free 방지)
 			LuaVM->GetScheduler().CancelByOwner(this);
+
+			// 배치 Tick 그룹에서 제외 (디스패치 도중이면 남은 루프에서도 건너뜀)
+			LuaVM->UnregisterScriptTick(this);
 		}
 	}
+	bTickBatched = false;
 
 	// 2. Lua 참조 해제
 	FuncBeginPlay = sol::nil;
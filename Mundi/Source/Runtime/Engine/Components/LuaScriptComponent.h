@@ -17,6 +17,8 @@ public:
 
 	GENERATED_REFLECTION_BODY()
 
+	friend class FLuaManager;
+
 	ULuaScriptComponent();
 	~ULuaScriptComponent() override;
 
@@ -53,4 +55,7 @@ protected:
 	FDelegateHandle HitHandleLua{};
 	
 	bool bIsLuaCleanedUp = false;
+	bool bTickBatched = false;	// FLuaManager 스크립트 Tick 그룹에 등록됨
+	int32 TickGroupIndex = -1;	// 등록된 Tick 그룹과 그룹 내 슬롯 (FLuaManager가 관리)
+	int32 TickSlotIndex = -1;
 };
\ No newline at end of file
@@ -160,6 +160,7 @@ void UMeshComponent::DuplicateSubObjects()
 		// else (원본 UMaterial 애셋인 경우)
 		// 얕은 복사된 포인터(애셋 경로)를 그대로 사용해도 안전합니다.
 	}
+	bMeshDrawCommandsDirty = true;
 }
 
 void UMeshComponent::MarkWorldPartitionDirty()
@@ -237,6 +238,7 @@ void UMeshComponent::SetMaterial(uint32 InElementIndex, UMaterialInterface* InNe
 
 	// 6. 새 머티리얼을 슬롯에 할당합니다.
 	MaterialSlots[InElementIndex] = InNewMaterial;
+	bMeshDrawCommandsDirty = true;
 }
 
 UMaterialInstanceDynamic* UMeshComponent::CreateAndSetMaterialInstanceDynamic(uint32 ElementIndex)
@@ -313,4 +315,5 @@ void UMeshComponent::ClearDynamicMaterials()
 	// (이 배열이 MID 포인터를 가리키고 있었을 수 있으므로
 	//  delete 이후에 비워야 안전합니다.)
 	MaterialSlots.Empty();
+	bMeshDrawCommandsDirty = true;
 }
@@ -44,6 +44,9 @@ protected:
     TArray<UMaterialInterface*> MaterialSlots;
     TArray<UMaterialInstanceDynamic*> DynamicMaterialInstances;
 
+    // 슬롯 교체/MID 생성 시 설정, 캐시된 드로우 커맨드를 다시 빌드하게 한다
+    bool bMeshDrawCommandsDirty = true;
+
 // Shadow Section
 public:
     bool IsCastShadows() const { return bCastShadows; }
@@ -120,14 +120,67 @@ void USceneComponent::AddRelativeScale3D(const FVector& DeltaScale)
 // World API
 // ──────────────────────────────
 FTransform USceneComponent::GetWorldTransform() const
+{
+    return ResolveWorldTransform();
+}
+
+const FTransform& USceneComponent::ResolveWorldTransform() const
 {
     // Dangling pointer 방지를 위한 체크 
-    if (AttachParent && !AttachParent->IsPendingDestroy())
+    const USceneComponent* Parent = (AttachParent && !AttachParent->IsPendingDestroy()) ? AttachParent : nullptr;
+
+    // 깨끗한 컴포넌트는 조상도 모두 깨끗하므로 부모 체인을 보지 않고 바로 반환
+    if (!bIsTransformDirty && CachedParent == Parent)
+    {
+        return CachedWorldTransform;
+    }
+
+    // 부모가 파괴 대기로 빠진 경우처럼 전파 없이 기준이 바뀌었으면 자손 캐시도 무효화
+    if (!bIsTransformDirty)
+    {
+        MarkChildrenTransformDirty();
+    }
+
+    CachedWorldTransform = Parent ? Parent->ResolveWorldTransform().GetWorldTransform(RelativeTransform) : RelativeTransform;
+    CachedParent = Parent;
+    bIsTransformDirty = false;
+    ++TransformGeneration;
+
+    return CachedWorldTransform;
+}
+
+void USceneComponent::UpdateWorldTransforms(const TArray<USceneComponent*>& Roots)
+{
+    // 게임 스레드 전용, 큐 할당 재사용
+    static TArray<USceneComponent*> Queue;
+    Queue.clear();
+    Queue.Reserve(Roots.Num());
+
+    for (USceneComponent* Root : Roots)
     {
-        return AttachParent->GetWorldTransform().GetWorldTransform(RelativeTransform);
+        if (Root && !Root->IsPendingDestroy())
+        {
+            Queue.Add(Root);
+        }
     }
 
-    return RelativeTransform;
+    // 부모가 항상 먼저 확정되므로 자식의 부모 조회는 캐시 적중, 깨끗한 노드는 플래그만 보고 지나간다
+    for (int32 Head = 0; Head < Queue.Num(); ++Head)
+    {
+        const USceneComponent* Comp = Queue[Head];
+        Comp->ResolveWorldTransform();
+        Comp->bTransformUpdateQueued = false;
+        Comp->bTransformUpdateCovered = false;
+
+        for (USceneComponent* Child : Comp->AttachChildren)
+        {
+            if (Child && !Child->IsPendingDestroy())
+            {
+                Queue.Add(Child);
+            }
+        }
+    }
+    Queue.clear();
 }
 
 void USceneComponent::SetWorldTransform(const FTransform& W)
@@ -147,6 +200,7 @@ void USceneComponent::SetWorldTransform(const FTransform& W)
     RelativeRotation = RelativeTransform.Rotation;
     RelativeRotationEuler = RelativeRotation.ToEulerZYXDeg(); // Euler 동기화
     RelativeScale = RelativeTransform.Scale3D;
+    MarkTransformDirty();
     OnTransformUpdated();
 }
  
@@ -272,10 +326,12 @@ void USceneComponent::SetLocalLocationAndRotation(const FVector& L, const FQuat&
 
 FMatrix USceneComponent::GetWorldMatrix() const
 {
-    if (bIsTransformDirty)
+    // 트랜스폼 캐시가 다시 계산된 경우에만 행렬 변환
+    const FTransform& World = ResolveWorldTransform();
+    if (CachedMatrixGeneration != TransformGeneration)
     {
-        CachedWorldMatrix = GetWorldTransform().ToMatrix();
-        bIsTransformDirty = false;
+        CachedWorldMatrix = World.ToMatrix();
+        CachedMatrixGeneration = TransformGeneration;
     }
     return CachedWorldMatrix;
 }
@@ -318,6 +374,11 @@ void USceneComponent::SetupAttachment(USceneComponent* InParent, EAttachmentRule
     RelativeLocation = RelativeTransform.Translation;
     RelativeRotation = RelativeTransform.Rotation;
     RelativeScale = RelativeTransform.Scale3D;
+
+    // 부모가 바뀌었으므로 캐시 무효화 (자손까지 더티 전파)
+    // 이전 부모 서브트리에 맡겨져 있었을 수 있으므로 대기 상태를 새 부모 기준으로 다시 판단
+    bTransformUpdateCovered = false;
+    MarkTransformDirty();
 }
 
 void USceneComponent::DetachFromParent(bool bKeepWorld)
@@ -337,6 +398,8 @@ void USceneComponent::DetachFromParent(bool bKeepWorld)
     RelativeLocation = RelativeTransform.Translation;
     RelativeRotation = RelativeTransform.Rotation;
     RelativeScale = RelativeTransform.Scale3D;
+    bTransformUpdateCovered = false;   // 부모 서브트리에서 빠졌으므로 직접 등록
+    MarkTransformDirty();
 
     // Notify transform update so shapes can refresh overlaps
     OnTransformUpdated();
@@ -349,6 +412,9 @@ void USceneComponent::DuplicateSubObjects()
     AttachParent = nullptr; // 부모 컴포넌트가 이 객체의 SetupAttachment를 호출할 경우, 불필요한 로직(기존 부모에서 제거) 수행 방지
     SpriteComponent = nullptr;
     AttachChildren.clear(); // Actor에서 할당해줌
+    bIsTransformDirty = true; // 원본의 캐시를 복사해 왔으므로 다시 계산
+    bTransformUpdateQueued = false; // 원본 월드의 확정 목록 상태는 가져오지 않음
+    bTransformUpdateCovered = false;
 }
 
 // ──────────────────────────────
@@ -357,6 +423,7 @@ void USceneComponent::DuplicateSubObjects()
 void USceneComponent::UpdateRelativeTransform()
 {
     RelativeTransform = FTransform(RelativeLocation, RelativeRotation, RelativeScale);
+    MarkTransformDirty();
 }
 
 void USceneComponent::Serialize(const bool bInIsLoading, JSON& InOutHandle)
@@ -407,9 +474,50 @@ void USceneComponent::OnRegister(UWorld* InWorld)
     OnTransformUpdated();
 }
 
+void USceneComponent::MarkTransformDirty()
+{
+    // 더티는 위에서 아래로 전파 (이미 더티인 노드의 자손은 이미 더티)
+    if (!bIsTransformDirty)
+    {
+        bIsTransformDirty = true;
+        MarkChildrenTransformDirty();
+    }
+
+    if (bTransformUpdateQueued || bTransformUpdateCovered)
+    {
+        return;
+    }
+
+    // 부모가 대기 중이면 부모 서브트리 순회가 이 컴포넌트까지 확정한다
+    if (AttachParent && (AttachParent->bTransformUpdateQueued || AttachParent->bTransformUpdateCovered))
+    {
+        bTransformUpdateCovered = true;
+        return;
+    }
+
+    // 월드에 속하지 않은 컴포넌트는 GetWorldTransform의 지연 계산에 맡긴다
+    if (UWorld* World = GetWorld())
+    {
+        bTransformUpdateQueued = true;
+        World->EnqueueTransformUpdate(this);
+    }
+}
+
+void USceneComponent::MarkChildrenTransformDirty() const
+{
+    for (USceneComponent* Child : AttachChildren)
+    {
+        if (Child && !Child->bIsTransformDirty)
+        {
+            Child->bIsTransformDirty = true;
+            Child->MarkChildrenTransformDirty();
+        }
+    }
+}
+
 void USceneComponent::OnTransformUpdated()
 {
-    bIsTransformDirty = true;
+    MarkTransformDirty();
     for (USceneComponent* Child : GetAttachChildren())
     {
         Child->OnTransformUpdated();
@@ -70,6 +70,19 @@ public:
     void SetLocalLocationAndRotation(const FVector& L, const FQuat& R);
 
     FMatrix GetWorldMatrix() const; // ToMatrixWithScale
+
+    /**
+     * @brief 더티 서브트리의 월드 트랜스폼을 부모 -> 자식(BFS) 순서로 한 번씩 확정한다.
+     * @note 프레임당 한 번(UWorld::Tick) 호출, 이후 같은 프레임의 조회는 모두 캐시 적중.
+     *       호출하지 않아도 GetWorldTransform이 지연 계산하므로 결과는 같다.
+     */
+    static void UpdateWorldTransforms(const TArray<USceneComponent*>& Roots);
+
+    // 캐시를 무효화하고 월드의 트랜스폼 확정 목록에 등록 (부모가 이미 등록되어 있으면 부모 서브트리 순회에 맡김)
+    void MarkTransformDirty();
+
+    // 트랜스폼 캐시를 다시 계산할 때마다 증가 (행렬 캐시/섀도우 캐시가 변경을 감지하는 용도)
+    uint32 GetTransformGeneration() const { return TransformGeneration; }
       
     // ──────────────────────────────
     // Attach/Detach
@@ -152,8 +165,21 @@ protected:
     UPROPERTY(EditAnywhere, Category="Transform")
     FVector RelativeRotationEuler{ 0,0,0 };
 
+    // 월드 트랜스폼 캐시
+    // - bIsTransformDirty: MarkTransformDirty가 자손까지 위에서 아래로 전파, 깨끗한 노드의 조상은 항상 깨끗함
+    // - 부모가 파괴 대기로 빠지는 경우만 부모 포인터 비교로 감지
+    mutable FTransform CachedWorldTransform;
     mutable FMatrix CachedWorldMatrix = FMatrix::Identity();
+    mutable const USceneComponent* CachedParent = nullptr;
+    mutable uint32 CachedMatrixGeneration = 0;
+    mutable uint32 TransformGeneration = 0;
     mutable bool bIsTransformDirty = true;
+
+    // 프레임 트랜스폼 확정 패스 대기 상태 (UpdateWorldTransforms가 방문하면 해제)
+    // - Queued: 월드의 더티 루트 목록에 직접 들어 있음
+    // - Covered: 대기 중인 조상의 서브트리 순회로 확정됨
+    mutable bool bTransformUpdateQueued = false;
+    mutable bool bTransformUpdateCovered = false;
     
     // Hierarchy
     USceneComponent* AttachParent = nullptr;
@@ -163,6 +189,10 @@ protected:
     FTransform RelativeTransform;
 
     void UpdateRelativeTransform();
+
+    // 캐시가 유효하면 바로 반환 (부모 체인을 보지 않음), 아니면 부모를 먼저 확정하고 계산
+    const FTransform& ResolveWorldTransform() const;
+    void MarkChildrenTransformDirty() const;
     
     uint32 SceneId; // Scene파일에서 불러온 Id. 컴포넌트끼리 자식부모관계 연결하기 위해 저장. Scene에 저장할 때는 UUID를 저장
     uint32 ParentId;
@@ -8,6 +8,7 @@
 #include "Source/Runtime/Engine/Animation/AnimSingleNodeInstance.h"
 #include "Source/Runtime/Engine/Animation/AnimTypes.h"
 #include "Source/Runtime/Engine/Animation/AnimationAsset.h"
+#include "Source/Runtime/Engine/Animation/AnimUpdateRateStats.h"
 #include "Source/Runtime/Engine/Animation/AnimNotify/AnimNotify_PlaySound.h"
 #include "Source/Runtime/Engine/Animation/Team2AnimInstance.h"
 #include "Source/Runtime/Core/Misc/PathUtils.h"
@@ -48,14 +49,15 @@ static FBodyInstance* FindBodyInstanceByName(const TArray<FBodyInstance*>& Bodie
 USkeletalMeshComponent::USkeletalMeshComponent()
 {
     // 기본값 없음 - 프리팹/씬에서 설정
+
+    // 같은 간격의 인스턴스들이 서로 다른 프레임에 평가되도록 위상 분산
+    UpdateRateParams.FramePhase = static_cast<int32>(UUID & 0xFFFF);
 }
 
 void USkeletalMeshComponent::DuplicateSubObjects()
 {
     Super::DuplicateSubObjects();
 
-    UE_LOG("[SkeletalMeshComponent] DuplicateSubObjects CALLED! AnimGraph was: %p", AnimGraph);
-
     // PIE 복제 시 shallow copy된 포인터들을 모두 초기화
     // BeginPlay에서 새로 생성되거나, PIE에서는 사용하지 않음
     AnimGraph = nullptr;  // 파일에서 다시 로드하지 않음 - PIE에서는 애니메이션 없이 실행
@@ -65,8 +67,6 @@ void USkeletalMeshComponent::DuplicateSubObjects()
     PhysicsAssetOverride = nullptr;
     Bodies.Empty();
     Constraints.Empty();
-
-    UE_LOG("[SkeletalMeshComponent] DuplicateSubObjects DONE! AnimGraph is now: %p", AnimGraph);
 }
 
 void USkeletalMeshComponent::BeginPlay()
@@ -283,7 +283,7 @@ void USkeletalMeshComponent::TickComponent(float DeltaTime)
         switch (PhysicsState)
         {
             case EPhysicsAnimationState::AnimationDriven:
-                AnimInstance->NativeUpdateAnimation(DeltaTime);
+                UpdateAnimInstance(DeltaTime);
 
                 // 루트 모션 델타를 Owner에 적용
                 if (AnimInstance->IsRootMotionEnabled())
@@ -737,7 +737,12 @@ void USkeletalMeshComponent::ForceRecomputePose()
     {
         TIME_PROFILE(SkeletalAABB)
         // GetWorldAABB 함수에서 AABB를 갱신중
-        GetWorldAABB();
+        const FAABB PoseBounds = GetWorldAABB();
+        if (PoseBounds.IsValid())
+        {
+            PoseBoundsOffset = PoseBounds.GetCenter() - GetWorldLocation();
+            PoseBoundsRadius = PoseBounds.GetHalfExtent().Size();
+        }
         TIME_PROFILE_END(SkeletalAABB)
     }
     
@@ -1472,10 +1477,101 @@ void USkeletalMeshComponent::SetAnimationPose(const TArray<FTransform>& InPose)
         CurrentLocalSpacePose[0].Translation = FVector::Zero();
     }
 
+    if (bUpdateRateActive)
+    {
+        RecordEvaluatedPose();
+    }
+
     // 포즈 변경 사항을 스키닝에 반영
     ForceRecomputePose();
 }
 
+// ============================================================
+// Update Rate Optimization
+// ============================================================
+
+void USkeletalMeshComponent::UpdateAnimInstance(float DeltaTime)
+{
+    TIME_PROFILE(AnimationUpdate)
+
+    FAnimUpdateRateStatManager& Stats = FAnimUpdateRateStatManager::GetInstance();
+    UWorld* World = GetWorld();
+    FAnimationUpdateRateManager* RateManager = (World && bEnableUpdateRateOptimizations) ? World->GetAnimUpdateRateManager() : nullptr;
+
+    if (!RateManager)
+    {
+        bUpdateRateActive = false;
+        AnimInstance->SetPoseShareCache(nullptr);
+        AnimInstance->NativeUpdateAnimation(DeltaTime);
+        Stats.AddEvaluated();
+        return;
+    }
+
+    bUpdateRateActive = true;
+    RateManager->UpdateParams(GetWorldLocation() + PoseBoundsOffset, PoseBoundsRadius, DeltaTime, UpdateRateParams);
+
+    if (UpdateRateParams.bEvaluateThisFrame)
+    {
+        // 누적 시간으로 한 번에 진행 (노티파이/루트 모션도 누적 구간 전체를 처리)
+        FAnimPoseShareCache& ShareCache = RateManager->GetPoseShareCache();
+        const int32 EntriesBefore = ShareCache.GetNumEntries();
+
+        AnimInstance->SetPoseShareCache(UpdateRateParams.bSharePose ? &ShareCache : nullptr);
+        AnimInstance->NativeUpdateAnimation(UpdateRateParams.ConsumeDeltaTime());
+
+        const int32 Hits = AnimInstance->GetSharedPoseHits();
+        Stats.AddSharedPoses(static_cast<uint32>(ShareCache.GetNumEntries() - EntriesBefore), static_cast<uint32>(Hits));
+        if (Hits > 0 && AnimInstance->GetSharedPoseMisses() == 0)
+        {
+            Stats.AddShared();
+        }
+        else
+        {
+            Stats.AddEvaluated();
+        }
+        return;
+    }
+
+    if (UpdateRateParams.bInterpolate && PreviousEvaluatedPose.Num() == CurrentLocalSpacePose.Num())
+    {
+        InterpolateEvaluatedPoses(UpdateRateParams.GetInterpolationAlpha());
+        ForceRecomputePose();
+        Stats.AddInterpolated();
+        return;
+    }
+
+    // 화면 밖이거나 보간 이력이 없으면 마지막 포즈와 스키닝 결과를 그대로 둔다
+    Stats.AddSkipped();
+}
+
+void USkeletalMeshComponent::RecordEvaluatedPose()
+{
+    std::swap(PreviousEvaluatedPose, LatestEvaluatedPose);
+    LatestEvaluatedPose = CurrentLocalSpacePose;
+
+    // 간격이 1이거나 보간하지 않으면 이력을 끊어 다음 보간이 오래된 포즈에서 시작하지 않게 한다
+    if (!UpdateRateParams.bInterpolate)
+    {
+        PreviousEvaluatedPose.Empty();
+        return;
+    }
+
+    // 건너뛴 프레임 보간과 이어지도록 평가 프레임도 직전 평가 포즈에서 1/N만 진행
+    if (PreviousEvaluatedPose.Num() == LatestEvaluatedPose.Num())
+    {
+        InterpolateEvaluatedPoses(UpdateRateParams.GetInterpolationAlpha());
+    }
+}
+
+void USkeletalMeshComponent::InterpolateEvaluatedPoses(float Alpha)
+{
+    const int32 NumBones = FMath::Min(CurrentLocalSpacePose.Num(), LatestEvaluatedPose.Num());
+    for (int32 BoneIndex = 0; BoneIndex < NumBones; ++BoneIndex)
+    {
+        CurrentLocalSpacePose[BoneIndex].Blend(PreviousEvaluatedPose[BoneIndex], LatestEvaluatedPose[BoneIndex], Alpha);
+    }
+}
+
 void USkeletalMeshComponent::SetAnimInstance(UAnimInstance* InAnimInstance)
 {
     AnimInstance = InAnimInstance;
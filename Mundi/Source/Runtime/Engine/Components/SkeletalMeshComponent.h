@@ -3,6 +3,7 @@
 #include "USkeletalMeshComponent.generated.h"
 // Include for FPendingAnimNotify and FAnimNotifyEvent types
 #include "Source/Runtime/Engine/Animation/AnimTypes.h"
+#include "Source/Runtime/Engine/Animation/AnimUpdateRateManager.h"
 class UAnimationGraph;
 class UAnimationAsset;
 class UAnimSequence;
@@ -183,6 +184,12 @@ protected:
      */
     void TickAnimInstances(float DeltaTime);
 
+    /**
+     * @brief 업데이트 주기 최적화(URO)를 거쳐 AnimInstance 갱신
+     * 평가 프레임이면 누적 시간으로 NativeUpdateAnimation, 아니면 보간하거나 (화면 밖) 아무것도 하지 않는다
+     */
+    void UpdateAnimInstance(float DeltaTime);
+
 protected:
     /** 현재 재생 중인 애니메이션 */
     UPROPERTY()
@@ -215,6 +222,38 @@ protected:
     // Animation graph asset path (.graph). Saved into prefab and used to reload graph.
     UPROPERTY(EditAnywhere, Category = "Animation")
     FString AnimGraphPath;
+
+    /////////////////////////////////////////////////////////////
+    // Update Rate Optimization Section
+    /////////////////////////////////////////////////////////////
+public:
+    void SetUpdateRateOptimizationsEnabled(bool bEnabled) { bEnableUpdateRateOptimizations = bEnabled; }
+    bool IsUpdateRateOptimizationsEnabled() const { return bEnableUpdateRateOptimizations; }
+    const FAnimUpdateRateParams& GetUpdateRateParams() const { return UpdateRateParams; }
+
+protected:
+    /**
+     * @brief 평가된 포즈를 보간 이력에 기록하고, 보간 중이면 표시 포즈를 이전 평가 포즈 쪽으로 되돌린다
+     */
+    void RecordEvaluatedPose();
+
+    /**
+     * @brief 이전/최신 평가 포즈를 Alpha로 보간해 CurrentLocalSpacePose에 쓴다
+     */
+    void InterpolateEvaluatedPoses(float Alpha);
+
+    UPROPERTY(EditAnywhere, Category = "Animation", Tooltip = "거리/화면 크기에 따라 포즈 평가 주기를 낮추고 군중 포즈를 공유")
+    bool bEnableUpdateRateOptimizations = true;
+
+    FAnimUpdateRateParams UpdateRateParams;
+    bool bUpdateRateActive = false;         // 이번 프레임 URO 경로로 갱신했는지 (SetAnimationPose에서 확인)
+
+    TArray<FTransform> PreviousEvaluatedPose;   // 보간 시작 (직전 평가)
+    TArray<FTransform> LatestEvaluatedPose;     // 보간 끝 (최신 평가)
+
+    // ForceRecomputePose에서 갱신하는 포즈 바운드 (LOD 판정용, 컴포넌트 위치 기준)
+    FVector PoseBoundsOffset = FVector::Zero();
+    float PoseBoundsRadius = 1.0f;
       
 // Editor Section
 public:
@@ -75,6 +75,20 @@ void USkinnedMeshComponent::Serialize(const bool bInIsLoading, JSON& InOutHandle
 void USkinnedMeshComponent::DuplicateSubObjects()
 {
    Super::DuplicateSubObjects();
+
+   // 얕은 복사된 버퍼 포인터는 원본 소유이므로 새로 받는다
+   CPUSkinnedVertexBuffer = nullptr;
+   GPUSkinnedVertexBuffer = nullptr;
+   SkinningMatrixBuffer = nullptr;
+   SkinningNormalMatrixBuffer = nullptr;
+   SkinningMatrixSRV = nullptr;
+   SkinningNormalMatrixSRV = nullptr;
+   if (!SkeletalMesh)
+   {
+      return;
+   }
+
+   // CPU 스키닝 결과/스키닝 행렬은 인스턴스마다 필요, GPU 스키닝 입력 정점은 메시의 공유 버퍼를 참조
    SkeletalMesh->CreateCPUSkinnedVertexBuffer(&CPUSkinnedVertexBuffer);
    SkeletalMesh->CreateGPUSkinnedVertexBuffer(&GPUSkinnedVertexBuffer);
    SkeletalMesh->CreateStructuredBuffer(&SkinningMatrixBuffer, &SkinningMatrixSRV, FinalSkinningMatrices.Num());
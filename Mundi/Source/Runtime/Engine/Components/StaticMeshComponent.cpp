@@ -7,6 +7,7 @@
 #include "JsonSerializer.h"
 #include "CameraComponent.h"
 #include "MeshBatchElement.h"
+#include "MeshDrawCommandStats.h"
 #include "Material.h"
 #include "SceneView.h"
 #include "LuaBindHelpers.h"
@@ -150,6 +151,7 @@ void UStaticMeshComponent::OnStaticMeshReleased(UStaticMesh* ReleasedMesh)
 	}
 
 	StaticMesh = nullptr;
+	bMeshDrawCommandsDirty = true;
 }
 
 void UStaticMeshComponent::CollectMeshBatches(TArray<FMeshBatchElement>& OutMeshBatchElements, const FSceneView* View)
@@ -159,6 +161,89 @@ void UStaticMeshComponent::CollectMeshBatches(TArray<FMeshBatchElement>& OutMesh
 		return;
 	}
 
+	const TArray<FCachedMeshDrawCommand>& Commands = GetOrBuildMeshDrawCommands(View);
+	if (Commands.IsEmpty())
+	{
+		return;
+	}
+
+	// 캐시된 커맨드에 인스턴스 데이터(월드 행렬, ObjectID)만 채운다
+	const FMatrix WorldMatrix = GetWorldMatrix();
+	for (const FCachedMeshDrawCommand& Command : Commands)
+	{
+		FMeshBatchElement& BatchElement = OutMeshBatchElements.emplace_back();
+		BatchElement.VertexShader = Command.VertexShader;
+		BatchElement.PixelShader = Command.PixelShader;
+		BatchElement.InputLayout = Command.InputLayout;
+		BatchElement.Material = Command.Material;
+		BatchElement.VertexBuffer = Command.VertexBuffer;
+		BatchElement.IndexBuffer = Command.IndexBuffer;
+		BatchElement.VertexStride = Command.VertexStride;
+		BatchElement.IndexCount = Command.IndexCount;
+		BatchElement.StartIndex = Command.StartIndex;
+		BatchElement.InstancedVertexShader = Command.InstancedVertexShader;
+		BatchElement.InstancedPixelShader = Command.InstancedPixelShader;
+		BatchElement.InstancedInputLayout = Command.InstancedInputLayout;
+		BatchElement.BaseVertexIndex = 0;
+		BatchElement.WorldMatrix = WorldMatrix;
+		BatchElement.ObjectID = InternalIndex;
+		BatchElement.PrimitiveTopology = D3D11_PRIMITIVE_TOPOLOGY_TRIANGLELIST;
+	}
+}
+
+const TArray<FCachedMeshDrawCommand>& UStaticMeshComponent::GetOrBuildMeshDrawCommands(const FSceneView* View)
+{
+	if (!IsMeshDrawCommandCacheValid())
+	{
+		InvalidateMeshDrawCommands();
+	}
+
+	const uint64 ViewShaderKey = View->ViewShaderKey;
+	for (const FCachedMeshDrawCommandSet& Set : CachedDrawCommandSets)
+	{
+		if (Set.ViewShaderKey == ViewShaderKey)
+		{
+			FMeshDrawCommandStatManager::GetInstance().AddCachedCommands(Set.Commands.Num());
+			return Set.Commands;
+		}
+	}
+
+	// 뷰 모드를 계속 바꾸는 경우 가장 오래된 조합부터 버린다
+	if (CachedDrawCommandSets.Num() >= MaxCachedViewSets)
+	{
+		CachedDrawCommandSets.RemoveAt(0);
+	}
+
+	FCachedMeshDrawCommandSet& NewSet = CachedDrawCommandSets.emplace_back();
+	NewSet.ViewShaderKey = ViewShaderKey;
+	BuildMeshDrawCommands(NewSet, View);
+	FMeshDrawCommandStatManager::GetInstance().AddBuiltCommands(NewSet.Commands.Num());
+	return NewSet.Commands;
+}
+
+bool UStaticMeshComponent::IsMeshDrawCommandCacheValid() const
+{
+	return !bMeshDrawCommandsDirty
+		&& CachedDrawMesh == StaticMesh
+		&& CachedDrawVertexBuffer == StaticMesh->GetVertexBuffer()
+		&& CachedShaderGeneration == UShader::GetVariantGeneration()
+		&& CachedMaterialGeneration == UMaterialInterface::GetShaderBindingGeneration()
+		&& CachedDrawMaterialSlots == MaterialSlots;
+}
+
+void UStaticMeshComponent::InvalidateMeshDrawCommands()
+{
+	CachedDrawCommandSets.Empty();
+	CachedDrawMaterialSlots = MaterialSlots;
+	CachedDrawMesh = StaticMesh;
+	CachedDrawVertexBuffer = StaticMesh ? StaticMesh->GetVertexBuffer() : nullptr;
+	CachedShaderGeneration = UShader::GetVariantGeneration();
+	CachedMaterialGeneration = UMaterialInterface::GetShaderBindingGeneration();
+	bMeshDrawCommandsDirty = false;
+}
+
+void UStaticMeshComponent::BuildMeshDrawCommands(FCachedMeshDrawCommandSet& OutSet, const FSceneView* View)
+{
 	const TArray<FGroupInfo>& MeshGroupInfos = StaticMesh->GetMeshGroupInfo();
 
 	auto DetermineMaterialAndShader = [&](uint32 SectionIndex) -> TPair<UMaterialInterface*, UShader*>
@@ -189,6 +274,7 @@ void UStaticMeshComponent::CollectMeshBatches(TArray<FMeshBatchElement>& OutMesh
 
 	const bool bHasSections = !MeshGroupInfos.IsEmpty();
 	const uint32 NumSectionsToProcess = bHasSections ? static_cast<uint32>(MeshGroupInfos.size()) : 1;
+	OutSet.Commands.Reserve(NumSectionsToProcess);
 
 	for (uint32 SectionIndex = 0; SectionIndex < NumSectionsToProcess; ++SectionIndex)
 	{
@@ -218,7 +304,7 @@ void UStaticMeshComponent::CollectMeshBatches(TArray<FMeshBatchElement>& OutMesh
 			continue;
 		}
 
-		FMeshBatchElement BatchElement;
+		FCachedMeshDrawCommand Command;
 		// View 모드 전용 매크로와 머티리얼 개인 매크로를 결합한다
 		TArray<FShaderMacro> ShaderMacros = View->ViewShaderMacros;
 		if (0 < MaterialToUse->GetShaderMacros().Num())
@@ -229,25 +315,33 @@ void UStaticMeshComponent::CollectMeshBatches(TArray<FMeshBatchElement>& OutMesh
 
 		if (ShaderVariant)
 		{
-			BatchElement.VertexShader = ShaderVariant->VertexShader;
-			BatchElement.PixelShader = ShaderVariant->PixelShader;
-			BatchElement.InputLayout = ShaderVariant->InputLayout;
+			Command.VertexShader = ShaderVariant->VertexShader;
+			Command.PixelShader = ShaderVariant->PixelShader;
+			Command.InputLayout = ShaderVariant->InputLayout;
+		}
+
+		// 같은 조합에 인스턴싱 매크로만 더한 변형 (렌더러가 연속된 같은 섹션을 합칠 때 사용)
+		if (ShaderToUse->SupportsInstancing())
+		{
+			ShaderMacros.Add(FShaderMacro("USE_INSTANCING", "1"));
+			if (FShaderVariant* InstancedVariant = ShaderToUse->GetOrCompileShaderVariant(ShaderMacros))
+			{
+				Command.InstancedVertexShader = InstancedVariant->VertexShader;
+				Command.InstancedPixelShader = InstancedVariant->PixelShader;
+				Command.InstancedInputLayout = InstancedVariant->InputLayout;
+			}
 		}
 
 		// UMaterialInterface를 UMaterial로 캐스팅해야 할 수 있음. 렌더러가 UMaterial을 기대한다면.
 		// 지금은 Material.h 구조상 UMaterialInterface에 필요한 정보가 다 있음.
-		BatchElement.Material = MaterialToUse;
-		BatchElement.VertexBuffer = StaticMesh->GetVertexBuffer();
-		BatchElement.IndexBuffer = StaticMesh->GetIndexBuffer();
-		BatchElement.VertexStride = StaticMesh->GetVertexStride();
-		BatchElement.IndexCount = IndexCount;
-		BatchElement.StartIndex = StartIndex;
-		BatchElement.BaseVertexIndex = 0;
-		BatchElement.WorldMatrix = GetWorldMatrix();
-		BatchElement.ObjectID = InternalIndex;
-		BatchElement.PrimitiveTopology = D3D11_PRIMITIVE_TOPOLOGY_TRIANGLELIST;
-
-		OutMeshBatchElements.Add(BatchElement);
+		Command.Material = MaterialToUse;
+		Command.VertexBuffer = StaticMesh->GetVertexBuffer();
+		Command.IndexBuffer = StaticMesh->GetIndexBuffer();
+		Command.VertexStride = StaticMesh->GetVertexStride();
+		Command.IndexCount = IndexCount;
+		Command.StartIndex = StartIndex;
+
+		OutSet.Commands.Add(Command);
 	}
 }
 
@@ -336,6 +430,10 @@ void UStaticMeshComponent::DuplicateSubObjects()
 
 	// BodyInstance는 PIE에서 새로 생성해야 하므로 nullptr로 초기화
 	BodyInstance = nullptr;
+
+	// 원본의 드로우 커맨드 캐시를 복사해 왔으므로 비운다 (MID가 새로 만들어졌다)
+	CachedDrawCommandSets.Empty();
+	bMeshDrawCommandsDirty = true;
 }
 
 void UStaticMeshComponent::InitPhysics(FPhysScene& PhysScene)
@@ -14,6 +14,33 @@ class UMaterialInstanceDynamic;
 class UPhysicalMaterial;
 struct FSceneCompData;
 
+// 섹션 하나를 그리기 위해 미리 해석해 둔 상태 (셰이더 Variant, 버퍼, 머티리얼)
+// 월드 행렬/ObjectID 같은 인스턴스 데이터는 CollectMeshBatches에서 매 프레임 채운다
+struct FCachedMeshDrawCommand
+{
+	ID3D11VertexShader* VertexShader = nullptr;
+	ID3D11PixelShader* PixelShader = nullptr;
+	ID3D11InputLayout* InputLayout = nullptr;
+	UMaterialInterface* Material = nullptr;
+	ID3D11Buffer* VertexBuffer = nullptr;
+	ID3D11Buffer* IndexBuffer = nullptr;
+	uint32 VertexStride = 0;
+	uint32 IndexCount = 0;
+	uint32 StartIndex = 0;
+
+	// 자동 인스턴싱용 USE_INSTANCING 변형 (셰이더가 지원하지 않으면 nullptr)
+	ID3D11VertexShader* InstancedVertexShader = nullptr;
+	ID3D11PixelShader* InstancedPixelShader = nullptr;
+	ID3D11InputLayout* InstancedInputLayout = nullptr;
+};
+
+// 뷰 매크로 조합(뷰 모드, 그림자 AA) 하나에 대한 섹션별 커맨드
+struct FCachedMeshDrawCommandSet
+{
+	uint64 ViewShaderKey = 0;
+	TArray<FCachedMeshDrawCommand> Commands;
+};
+
 UCLASS(DisplayName="스태틱 메시 컴포넌트", Description="정적 메시를 렌더링하는 컴포넌트입니다")
 class UStaticMeshComponent : public UMeshComponent
 {
@@ -109,6 +136,22 @@ protected:
 	FQuat CollisionRotation = FQuat::Identity();
 
 	class UBodySetup* BodySetupOverride = nullptr;
+
+private:
+	const TArray<FCachedMeshDrawCommand>& GetOrBuildMeshDrawCommands(const FSceneView* View);
+	void BuildMeshDrawCommands(FCachedMeshDrawCommandSet& OutSet, const FSceneView* View);
+	bool IsMeshDrawCommandCacheValid() const;
+	void InvalidateMeshDrawCommands();
+
+	// 메시/머티리얼/뷰 모드가 바뀔 때만 다시 빌드, 메인 패스와 그림자 패스가 같은 캐시를 공유한다
+	static constexpr int32 MaxCachedViewSets = 4;
+	TArray<FCachedMeshDrawCommandSet> CachedDrawCommandSets;
+	TArray<UMaterialInterface*> CachedDrawMaterialSlots;	// 빌드 당시 슬롯 (에디터에서 슬롯을 직접 바꾼 경우 감지)
+	UStaticMesh* CachedDrawMesh = nullptr;
+	ID3D11Buffer* CachedDrawVertexBuffer = nullptr;
+	uint32 CachedShaderGeneration = 0;
+	uint32 CachedMaterialGeneration = 0;
+
 public:
 	// Collision/Physics simulation toggles
 	bool IsCollisionEnabled() const { return bEnableCollision; }
@@ -0,0 +1,61 @@
+﻿#include "pch.h"
+#include "ActorRegistry.h"
+
+void FActorRegistry::Register(AActor* Actor)
+{
+    if (!Actor || SlotByActor.Contains(Actor))
+    {
+        return;
+    }
+
+    TArray<AActor*>& Bucket = ActorsByClass[Actor->GetClass()];
+    SlotByActor.Add(Actor, Bucket.Num());
+    Bucket.Add(Actor);
+}
+
+void FActorRegistry::Unregister(AActor* Actor)
+{
+    const int32* Slot = SlotByActor.Find(Actor);
+    if (!Slot)
+    {
+        return;
+    }
+
+    TArray<AActor*>* Bucket = ActorsByClass.Find(Actor->GetClass());
+    if (Bucket)
+    {
+        // 마지막 액터를 빈 자리로 옮기고 위치 갱신
+        const int32 Index = *Slot;
+        AActor* LastActor = Bucket->Last();
+        (*Bucket)[Index] = LastActor;
+        SlotByActor[LastActor] = Index;
+        Bucket->pop_back();
+    }
+    SlotByActor.Remove(Actor);
+}
+
+void FActorRegistry::BulkRegister(const TArray<AActor*>& Actors)
+{
+    SlotByActor.reserve(SlotByActor.size() + Actors.size());
+    for (AActor* Actor : Actors)
+    {
+        Register(Actor);
+    }
+}
+
+void FActorRegistry::Clear()
+{
+    ActorsByClass.Empty();
+    SlotByActor.Empty();
+}
+
+AActor* FActorRegistry::FindFirstActorOfClass(const UClass* BaseClass) const
+{
+    AActor* Found = nullptr;
+    ForEachActorOfClass(BaseClass, [&Found](AActor* Actor)
+    {
+        Found = Actor;
+        return false;
+    });
+    return Found;
+}
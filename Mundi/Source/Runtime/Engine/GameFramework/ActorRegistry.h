@@ -0,0 +1,54 @@
+﻿#pragma once
+#include "Actor.h"
+
+/**
+ * 월드별 클래스 색인 액터 목록
+ * - 액터를 정확한 클래스별 버킷에 담고, 조회 시 클래스 트리 전위 구간 [TreeIndex, TreeEnd)의 버킷만 본다
+ *   (TObjectIterator와 같은 방식, 레벨 전체를 IsA로 훑지 않음)
+ * - 액터별 버킷 위치를 기억해 제거는 swap-remove
+ */
+class FActorRegistry
+{
+public:
+    void Register(AActor* Actor);
+    void Unregister(AActor* Actor);
+    void BulkRegister(const TArray<AActor*>& Actors);
+    void Clear();
+
+    int32 Num() const { return SlotByActor.Num(); }
+
+    // BaseClass와 자식 클래스의 살아있는(파괴 대기 아님) 액터마다 Func 호출, Func가 false를 반환하면 중단
+    template<typename FuncType>
+    void ForEachActorOfClass(const UClass* BaseClass, FuncType&& Func) const
+    {
+        if (!BaseClass || BaseClass->TreeIndex < 0)
+        {
+            return;
+        }
+
+        const TArray<UClass*>& Classes = UClass::GetClassesInTreeOrder();
+        for (int32 ClassIndex = BaseClass->TreeIndex; ClassIndex < BaseClass->TreeEnd; ++ClassIndex)
+        {
+            const TArray<AActor*>* Bucket = ActorsByClass.Find(Classes[ClassIndex]);
+            if (!Bucket)
+            {
+                continue;
+            }
+
+            for (AActor* Actor : *Bucket)
+            {
+                if (!Actor->IsPendingDestroy() && !Func(Actor))
+                {
+                    return;
+                }
+            }
+        }
+    }
+
+    // ForEachActorOfClass 순서의 첫 액터 (레벨 순서와 다를 수 있음)
+    AActor* FindFirstActorOfClass(const UClass* BaseClass) const;
+
+private:
+    TMap<const UClass*, TArray<AActor*>> ActorsByClass;
+    TMap<AActor*, int32> SlotByActor;      // 버킷 내 위치
+};
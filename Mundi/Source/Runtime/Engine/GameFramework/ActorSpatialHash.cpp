@@ -0,0 +1,270 @@
+﻿#include "pch.h"
+#include "ActorSpatialHash.h"
+#include "ActorRegistry.h"
+
+FActorSpatialHash::FActorSpatialHash(float InCellSize)
+    : CellSize(InCellSize)
+    , InvCellSize(1.0f / InCellSize)
+{
+}
+
+void FActorSpatialHash::Rebuild(const FActorRegistry& Registry, const UClass* TrackedClass)
+{
+    Clear();
+
+    Registry.ForEachActorOfClass(TrackedClass, [this](AActor* Actor)
+    {
+        if (Actor->GetRootComponent())
+        {
+            FEntry Entry;
+            Entry.Actor = Actor;
+            Entry.Location = Actor->GetActorLocation();
+            Entry.CellKey = MakeCellKey(ToCell(Entry.Location.X), ToCell(Entry.Location.Y));
+            Entries.Add(Entry);
+        }
+        return true;
+    });
+
+    std::sort(Entries.begin(), Entries.end(), [](const FEntry& A, const FEntry& B) { return A.CellKey < B.CellKey; });
+
+    for (int32 i = 0; i < Entries.Num(); ++i)
+    {
+        EntryIndexByActor.Add(Entries[i].Actor, i);
+        if (Cells.IsEmpty() || Entries[Cells.Last().Start].CellKey != Entries[i].CellKey)
+        {
+            FCell Cell;
+            Cell.CellX = ToCell(Entries[i].Location.X);
+            Cell.CellY = ToCell(Entries[i].Location.Y);
+            Cell.Start = i;
+            CellIndexByKey.Add(Entries[i].CellKey, Cells.Num());
+            Cells.Add(Cell);
+
+            MinCellX = std::min(MinCellX, Cell.CellX);
+            MinCellY = std::min(MinCellY, Cell.CellY);
+            MaxCellX = std::max(MaxCellX, Cell.CellX);
+            MaxCellY = std::max(MaxCellY, Cell.CellY);
+        }
+        ++Cells.Last().Count;
+    }
+}
+
+void FActorSpatialHash::Clear()
+{
+    Entries.Empty();
+    Cells.Empty();
+    CellIndexByKey.Empty();
+    EntryIndexByActor.Empty();
+    MinCellX = MinCellY = std::numeric_limits<int32>::max();
+    MaxCellX = MaxCellY = std::numeric_limits<int32>::min();
+}
+
+void FActorSpatialHash::Remove(const AActor* Actor)
+{
+    const int32* EntryIndex = EntryIndexByActor.Find(Actor);
+    if (!EntryIndex)
+    {
+        return;
+    }
+
+    const int32 Index = *EntryIndex;
+    EntryIndexByActor.Remove(Actor);
+
+    const int32* CellIndex = CellIndexByKey.Find(Entries[Index].CellKey);
+    if (!CellIndex)
+    {
+        return;
+    }
+
+    FCell& Cell = Cells[*CellIndex];
+    const int32 LastIndex = Cell.Start + Cell.Count - 1;
+    if (Index != LastIndex)
+    {
+        Entries[Index] = Entries[LastIndex];
+        EntryIndexByActor[Entries[Index].Actor] = Index;
+    }
+    --Cell.Count;
+}
+
+const FActorSpatialHash::FCell* FActorSpatialHash::FindCell(int32 CellX, int32 CellY) const
+{
+    const int32* Index = CellIndexByKey.Find(MakeCellKey(CellX, CellY));
+    return Index ? &Cells[*Index] : nullptr;
+}
+
+template<typename FuncType>
+void FActorSpatialHash::ForEachCellInRect(int32 MinX, int32 MinY, int32 MaxX, int32 MaxY, FuncType&& Func) const
+{
+    MinX = std::max(MinX, MinCellX);
+    MinY = std::max(MinY, MinCellY);
+    MaxX = std::min(MaxX, MaxCellX);
+    MaxY = std::min(MaxY, MaxCellY);
+    if (MinX > MaxX || MinY > MaxY)
+    {
+        return;
+    }
+
+    // 질의 영역이 넓으면 해시 조회보다 채워진 셀을 훑는 쪽이 싸다
+    const int64 NumRectCells = static_cast<int64>(MaxX - MinX + 1) * (MaxY - MinY + 1);
+    if (NumRectCells > Cells.Num())
+    {
+        for (const FCell& Cell : Cells)
+        {
+            if (Cell.CellX >= MinX && Cell.CellX <= MaxX && Cell.CellY >= MinY && Cell.CellY <= MaxY)
+            {
+                Func(Cell);
+            }
+        }
+        return;
+    }
+
+    for (int32 Y = MinY; Y <= MaxY; ++Y)
+    {
+        for (int32 X = MinX; X <= MaxX; ++X)
+        {
+            if (const FCell* Cell = FindCell(X, Y))
+            {
+                Func(*Cell);
+            }
+        }
+    }
+}
+
+void FActorSpatialHash::QueryRadius(const FVector& Center, float Radius, TArray<AActor*>& OutActors, const UClass* Filter) const
+{
+    const float RadiusSq = Radius * Radius;
+    ForEachCellInRect(ToCell(Center.X - Radius), ToCell(Center.Y - Radius), ToCell(Center.X + Radius), ToCell(Center.Y + Radius),
+        [&](const FCell& Cell)
+    {
+        for (int32 i = Cell.Start; i < Cell.Start + Cell.Count; ++i)
+        {
+            const FEntry& Entry = Entries[i];
+            if ((Entry.Location - Center).SizeSquared() <= RadiusSq && (!Filter || Entry.Actor->IsA(Filter)))
+            {
+                OutActors.Add(Entry.Actor);
+            }
+        }
+    });
+}
+
+void FActorSpatialHash::QueryCone(const FVector& Origin, const FVector& Direction, float Radius, float HalfAngleDegrees,
+    TArray<AActor*>& OutActors, const UClass* Filter) const
+{
+    FVector Forward(Direction.X, Direction.Y, 0.0f);
+    if (Forward.IsZero())
+    {
+        QueryRadius(Origin, Radius, OutActors, Filter);
+        return;
+    }
+    Forward.Normalize();
+
+    const float CosHalfAngle = std::cos(DegreesToRadians(HalfAngleDegrees));
+    const float RadiusSq = Radius * Radius;
+    ForEachCellInRect(ToCell(Origin.X - Radius), ToCell(Origin.Y - Radius), ToCell(Origin.X + Radius), ToCell(Origin.Y + Radius),
+        [&](const FCell& Cell)
+    {
+        for (int32 i = Cell.Start; i < Cell.Start + Cell.Count; ++i)
+        {
+            const FEntry& Entry = Entries[i];
+            const FVector ToEntry = Entry.Location - Origin;
+            if (ToEntry.SizeSquared() > RadiusSq || (Filter && !Entry.Actor->IsA(Filter)))
+            {
+                continue;
+            }
+
+            // 수평 방향 각도만 본다 (겹친 위치는 항상 포함)
+            const float Horizontal = std::sqrt(ToEntry.X * ToEntry.X + ToEntry.Y * ToEntry.Y);
+            const float Dot = ToEntry.X * Forward.X + ToEntry.Y * Forward.Y;
+            if (Horizontal <= KINDA_SMALL_NUMBER || Dot >= CosHalfAngle * Horizontal)
+            {
+                OutActors.Add(Entry.Actor);
+            }
+        }
+    });
+}
+
+void FActorSpatialHash::QueryNearest(const FVector& Center, int32 Count, float MaxRadius, TArray<AActor*>& OutActors,
+    const UClass* Filter, const AActor* Ignore) const
+{
+    if (Count <= 0 || Cells.IsEmpty())
+    {
+        return;
+    }
+
+    // (거리^2, 엔트리) max-heap, 가장 먼 후보가 맨 위
+    TArray<std::pair<float, int32>> Heap;
+    Heap.Reserve(Count + 1);
+    const float MaxRadiusSq = MaxRadius * MaxRadius;
+
+    auto VisitCell = [&](const FCell& Cell)
+    {
+        for (int32 i = Cell.Start; i < Cell.Start + Cell.Count; ++i)
+        {
+            const FEntry& Entry = Entries[i];
+            if (Entry.Actor == Ignore || (Filter && !Entry.Actor->IsA(Filter)))
+            {
+                continue;
+            }
+
+            const float DistSq = (Entry.Location - Center).SizeSquared();
+            if (DistSq > MaxRadiusSq || (Heap.Num() == Count && DistSq >= Heap[0].first))
+            {
+                continue;
+            }
+
+            Heap.Add({ DistSq, i });
+            std::push_heap(Heap.begin(), Heap.end());
+            if (Heap.Num() > Count)
+            {
+                std::pop_heap(Heap.begin(), Heap.end());
+                Heap.pop_back();
+            }
+        }
+    };
+
+    // 중심 셀에서 링을 넓혀 가며, 다음 링의 최소 거리가 현재 Count번째 후보보다 멀면 중단
+    const int32 CenterX = ToCell(Center.X);
+    const int32 CenterY = ToCell(Center.Y);
+    const int32 RingToBounds = std::max({ std::abs(CenterX - MinCellX), std::abs(CenterX - MaxCellX),
+        std::abs(CenterY - MinCellY), std::abs(CenterY - MaxCellY) });
+    const float RingsToRadius = std::ceil(MaxRadius * InvCellSize) + 1.0f;
+    const int32 MaxRing = (RingsToRadius < static_cast<float>(RingToBounds)) ? static_cast<int32>(RingsToRadius) : RingToBounds;
+
+    for (int32 Ring = 0; Ring <= MaxRing; ++Ring)
+    {
+        if (Ring > 0)
+        {
+            const float RingMinDist = (Ring - 1) * CellSize;
+            if (RingMinDist * RingMinDist > MaxRadiusSq || (Heap.Num() == Count && RingMinDist * RingMinDist >= Heap[0].first))
+            {
+                break;
+            }
+        }
+
+        if (Ring == 0)
+        {
+            if (const FCell* Cell = FindCell(CenterX, CenterY))
+            {
+                VisitCell(*Cell);
+            }
+            continue;
+        }
+
+        // 링 둘레의 셀만 방문 (위/아래 변 전체 + 좌/우 변의 나머지)
+        for (int32 X = CenterX - Ring; X <= CenterX + Ring; ++X)
+        {
+            if (const FCell* Cell = FindCell(X, CenterY - Ring)) VisitCell(*Cell);
+            if (const FCell* Cell = FindCell(X, CenterY + Ring)) VisitCell(*Cell);
+        }
+        for (int32 Y = CenterY - Ring + 1; Y <= CenterY + Ring - 1; ++Y)
+        {
+            if (const FCell* Cell = FindCell(CenterX - Ring, Y)) VisitCell(*Cell);
+            if (const FCell* Cell = FindCell(CenterX + Ring, Y)) VisitCell(*Cell);
+        }
+    }
+
+    std::sort_heap(Heap.begin(), Heap.end());
+    for (const auto& Candidate : Heap)
+    {
+        OutActors.Add(Entries[Candidate.second].Actor);
+    }
+}
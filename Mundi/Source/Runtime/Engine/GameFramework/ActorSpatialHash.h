@@ -0,0 +1,79 @@
+﻿#pragma once
+
+class AActor;
+class FActorRegistry;
+
+/**
+ * 액터 위치 균일 격자 해시 (XY 평면 셀, 프레임마다 한 번 다시 구성)
+ * - 엔트리를 셀 키로 정렬해 셀마다 연속 구간으로 저장 (셀 -> 구간은 해시맵)
+ * - 조회는 질의 영역과 겹치는 셀만 보며, 영역의 셀 수가 채워진 셀 수보다 많으면 채워진 셀 목록을 훑는다
+ * - 위치는 Rebuild 시점 값이므로 같은 프레임 안에서 움직인 만큼은 반영되지 않는다
+ */
+class FActorSpatialHash
+{
+public:
+    explicit FActorSpatialHash(float InCellSize = 4.0f);
+
+    // Registry에서 TrackedClass 계열 액터의 현재 위치로 다시 구성
+    void Rebuild(const FActorRegistry& Registry, const UClass* TrackedClass);
+    void Clear();
+
+    // 파괴되는 액터를 다음 Rebuild 전까지 조회에서 제외 (셀 안에서 마지막 엔트리와 교환 후 셀 크기 감소)
+    void Remove(const AActor* Actor);
+
+    /** Center에서 Radius 안의 액터 (Filter 클래스 계열만, nullptr이면 전부) */
+    void QueryRadius(const FVector& Center, float Radius, TArray<AActor*>& OutActors, const UClass* Filter = nullptr) const;
+
+    /** Radius 안에서 수평 방향 Direction 기준 HalfAngleDegrees 이내인 액터 */
+    void QueryCone(const FVector& Origin, const FVector& Direction, float Radius, float HalfAngleDegrees,
+        TArray<AActor*>& OutActors, const UClass* Filter = nullptr) const;
+
+    /** MaxRadius 안에서 가까운 순으로 최대 Count개 (Ignore는 제외) */
+    void QueryNearest(const FVector& Center, int32 Count, float MaxRadius, TArray<AActor*>& OutActors,
+        const UClass* Filter = nullptr, const AActor* Ignore = nullptr) const;
+
+    int32 Num() const { return Entries.Num(); }
+    int32 GetNumCells() const { return Cells.Num(); }
+    float GetCellSize() const { return CellSize; }
+
+private:
+    struct FEntry
+    {
+        AActor* Actor = nullptr;
+        FVector Location;
+        uint64 CellKey = 0;
+    };
+
+    struct FCell
+    {
+        int32 CellX = 0;
+        int32 CellY = 0;
+        int32 Start = 0;
+        int32 Count = 0;
+    };
+
+    int32 ToCell(float Value) const { return static_cast<int32>(std::floor(Value * InvCellSize)); }
+    static uint64 MakeCellKey(int32 CellX, int32 CellY)
+    {
+        return (static_cast<uint64>(static_cast<uint32>(CellX)) << 32) | static_cast<uint32>(CellY);
+    }
+
+    const FCell* FindCell(int32 CellX, int32 CellY) const;
+
+    // [MinCell, MaxCell] 사각형과 겹치는 채워진 셀마다 Func(const FCell&)
+    template<typename FuncType>
+    void ForEachCellInRect(int32 MinX, int32 MinY, int32 MaxX, int32 MaxY, FuncType&& Func) const;
+
+private:
+    float CellSize;
+    float InvCellSize;
+
+    TArray<FEntry> Entries;             // 셀 키 순 정렬
+    TArray<FCell> Cells;
+    TMap<uint64, int32> CellIndexByKey;
+    TMap<const AActor*, int32> EntryIndexByActor;
+    int32 MinCellX = 0;                 // 채워진 셀 범위 (최근접 탐색 링 상한)
+    int32 MinCellY = 0;
+    int32 MaxCellX = -1;
+    int32 MaxCellY = -1;
+};
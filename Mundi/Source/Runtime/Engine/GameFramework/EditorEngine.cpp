@@ -6,7 +6,9 @@
 #include "GameModeBase.h"
 #include "InputManager.h"
 #include "Pawn.h"
+#include "PlatformTime.h"
 #include "SelectionManager.h"
+#include "ShaderCompiler.h"
 #include "USlateManager.h"
 #include <ObjManager.h>
 #include <roapi.h>
@@ -182,6 +184,8 @@ bool UEditorEngine::CreateMainWindow(HINSTANCE hInstance)
 
 bool UEditorEngine::Startup(HINSTANCE hInstance)
 {
+    FCPUProfiler::SetCurrentThreadName("Main");
+
     LoadIniFile();
 
     if (!CreateMainWindow(hInstance))
@@ -203,6 +207,7 @@ bool UEditorEngine::Startup(HINSTANCE hInstance)
     FAudioDevice::Preload();
     RESOURCE.PreloadParticles();
 	RESOURCE.PreloadPhysicsAssets();
+	RESOURCE.PrecompileShaderVariants();
     
     // 블루프린트 액션 데이터베이스 초기화
     FBlueprintActionDatabase::GetInstance().Initialize();
@@ -340,9 +345,15 @@ void UEditorEngine::MainLoop()
         Tick(DeltaSeconds);
         Render();
         
+        // 백그라운드로 컴파일이 끝난 셰이더 Variant 반영 (D3D 셰이더 객체 생성은 메인 스레드에서)
+        FShaderCompileManager::Get().ProcessFinishedJobs();
+
         // Shader Hot Reloading - Call AFTER render to avoid mid-frame resource conflicts
         // This ensures all GPU commands are submitted before we check for shader updates
         UResourceManager::GetInstance().CheckAndReloadShaders(DeltaSeconds);
+
+        // 모든 스레드의 프로파일 이벤트를 모아 이번 프레임 확정 (통계 UI는 다음 프레임에 이 결과를 그린다)
+        FCPUProfiler::Get().EndFrame();
     }
 }
 
@@ -365,6 +376,9 @@ void UEditorEngine::Shutdown()
     // 컴포넌트들이 아직 Tick 중일 수 있으므로 먼저 오디오 시스템을 정지시켜야 함
     FAudioDevice::Shutdown();
 
+    // 셰이더 컴파일 워커 종료 (완료 콜백이 UShader를 참조하므로 리소스 삭제 전에)
+    FShaderCompileManager::Get().Shutdown();
+
     // Delete all UObjects (Components, Actors, Resources)
     // Resource destructors will properly release D3D resources
     ObjectFactory::DeleteAll(true);
@@ -393,9 +407,12 @@ void UEditorEngine::Shutdown()
 void UEditorEngine::StartPIE()
 {
     UE_LOG("[info] START PIE");
+    const uint64 StartCycles = FPlatformTime::Cycles64();
+    const int32 NumObjectsBefore = ObjectFactory::GetNumLiveObjects();
 
     UWorld* EditorWorld = WorldContexts[0].World;
     UWorld* PIEWorld = UWorld::DuplicateWorldForPIE(EditorWorld);
+    const uint64 DuplicateEndCycles = FPlatformTime::Cycles64();
 
     GWorld = PIEWorld;
     SLATE.SetPIEWorld(GWorld);  // SLATE의 카메라를 가져와서 설정, TODO: 추후 월드의 카메라 컴포넌트를 가져와서 설정하도록 변경 필요
@@ -429,7 +446,15 @@ void UEditorEngine::StartPIE()
 
     // NOTE: BeginPlay 중에 삭제된 액터 삭제 후 Tick 시작
     GWorld->ProcessPendingKillActors();
-     
+
+    const uint64 EndCycles = FPlatformTime::Cycles64();
+    LastPIEStartMs = FPlatformTime::ToMilliseconds(EndCycles - StartCycles);
+    UE_LOG("[info] PIE started in %.2f ms (duplicate %.2f ms, begin play %.2f ms, %d actors, %d objects created)",
+        LastPIEStartMs,
+        FPlatformTime::ToMilliseconds(DuplicateEndCycles - StartCycles),
+        FPlatformTime::ToMilliseconds(EndCycles - DuplicateEndCycles),
+        static_cast<int32>(LevelActors.Num()),
+        ObjectFactory::GetNumLiveObjects() - NumObjectsBefore);
 }
 
 void UEditorEngine::EndPIE()
@@ -32,6 +32,7 @@ public:
     void StartPIE();
     void EndPIE();
     bool IsPIEActive() const { return bPIEActive; }
+    double GetLastPIEStartMs() const { return LastPIEStartMs; }   // 월드 복제 + BeginPlay
     
     HWND GetHWND() const { return HWnd; }
     
@@ -71,6 +72,7 @@ private:
     bool bRunning = false;
     bool bUVScrollPaused = true;
     bool bPIEActive = false;
+    double LastPIEStartMs = 0.0;
     float UVScrollTime = 0.0f;
     FVector2D UVScrollSpeed = FVector2D(0.5f, 0.5f);
 
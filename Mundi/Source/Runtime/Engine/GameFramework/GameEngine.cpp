@@ -2,13 +2,16 @@
 #include "GameEngine.h"
 #include "USlateManager.h"
 #include "SelectionManager.h"
+#include "ShaderCompiler.h"
 #include "FViewport.h"
 #include "PlayerCameraManager.h"
+#include "PlatformTime.h"
 #include <ObjManager.h>
 #include "FAudioDevice.h"
 #include <sol/sol.hpp>
 
 #include "BlueprintGraph/BlueprintActionDatabase.h"
+#include "Source/Runtime/Debug/FrameBenchmark.h"
 
 float UGameEngine::ClientWidth = 1024.0f;
 float UGameEngine::ClientHeight = 1024.0f;
@@ -151,8 +154,17 @@ bool UGameEngine::CreateMainWindow(HINSTANCE hInstance)
     if (clientWidth < 800) clientWidth = 1620;
     if (clientHeight < 600) clientHeight = 1024;
 
+    // 벤치마크는 결과가 창 크기에 좌우되지 않도록 명령줄 해상도를 쓰고 창을 띄우지 않는다
+    const FFrameBenchmarkSettings& BenchmarkSettings = FFrameBenchmark::GetSettings();
+    const bool bHeadless = BenchmarkSettings.bEnabled || BenchmarkSettings.bNullRHI;
+    if (bHeadless)
+    {
+        clientWidth = static_cast<int>(BenchmarkSettings.Width);
+        clientHeight = static_cast<int>(BenchmarkSettings.Height);
+    }
+
     // Convert client area size to window size (including title bar and borders)
-    DWORD windowStyle = WS_POPUP | WS_VISIBLE | WS_OVERLAPPEDWINDOW;
+    DWORD windowStyle = WS_POPUP | WS_OVERLAPPEDWINDOW | (bHeadless ? 0 : WS_VISIBLE);
     RECT windowRect = { 0, 0, clientWidth, clientHeight };
     AdjustWindowRect(&windowRect, windowStyle, FALSE);
 
@@ -173,13 +185,26 @@ bool UGameEngine::CreateMainWindow(HINSTANCE hInstance)
 
 bool UGameEngine::Startup(HINSTANCE hInstance)
 {
+    FCPUProfiler::SetCurrentThreadName("Main");
+
     LoadIniFile();
 
     if (!CreateMainWindow(hInstance))
         return false;
 
     // 디바이스 리소스 및 렌더러 생성
-    RHIDevice.Initialize(HWnd);
+    if (FFrameBenchmark::GetSettings().bNullRHI)
+    {
+        RHIDevice.InitializeNull(static_cast<UINT>(ClientWidth), static_cast<UINT>(ClientHeight));
+    }
+    else
+    {
+        RHIDevice.Initialize(HWnd);
+    }
+    if (!RHIDevice.GetDevice())
+    {
+        return false;
+    }
     Renderer = std::make_unique<URenderer>(&RHIDevice);
 
     // Initialize audio device for game runtime
@@ -208,7 +233,11 @@ bool UGameEngine::Startup(HINSTANCE hInstance)
     ///////////////////////////////////
 
     // 시작 scene(level)을 직접 로드 
-    const FString StartupScenePath = GDataDir + "/Scenes/PlayScene.scene";
+    FString StartupScenePath = GDataDir + "/Scenes/PlayScene.scene";
+    if (FFrameBenchmark::IsEnabled() && !FFrameBenchmark::GetSettings().ScenePath.empty())
+    {
+        StartupScenePath = FFrameBenchmark::GetSettings().ScenePath;
+    }
     if (!GWorld->LoadLevelFromFile(UTF8ToWide(StartupScenePath)))
     {
         UE_LOG("Failed to load startup scene: %s", StartupScenePath.c_str());
@@ -232,10 +261,12 @@ void UGameEngine::Tick(float DeltaSeconds)
     //@TODO UV 스크롤 입력 처리 로직 이동
     HandleUVInput(DeltaSeconds);
 
+    TIME_PROFILE(Frame_WorldTick)
     for (auto& WorldContext : WorldContexts)
     {
         WorldContext.World->Tick(DeltaSeconds);
     }
+    TIME_PROFILE_END(Frame_WorldTick)
     INPUT.Update();
 
     FAudioDevice::Update(); 
@@ -243,6 +274,7 @@ void UGameEngine::Tick(float DeltaSeconds)
 
 void UGameEngine::Render()
 {
+    TIME_PROFILE(Frame_Render)
     Renderer->BeginFrame();
 
     if (GWorld)
@@ -288,6 +320,12 @@ void UGameEngine::HandleUVInput(float DeltaSeconds)
 
 void UGameEngine::MainLoop()
 {
+    if (FFrameBenchmark::IsEnabled())
+    {
+        RunBenchmark();
+        return;
+    }
+
     LARGE_INTEGER Frequency;
     QueryPerformanceFrequency(&Frequency);
 
@@ -319,12 +357,62 @@ void UGameEngine::MainLoop()
         Tick(DeltaSeconds);
         Render();
 
+        // 백그라운드로 컴파일이 끝난 셰이더 Variant 반영 (D3D 셰이더 객체 생성은 메인 스레드에서)
+        FShaderCompileManager::Get().ProcessFinishedJobs();
+
         // Shader Hot Reloading - Call AFTER render to avoid mid-frame resource conflicts
         // This ensures all GPU commands are submitted before we check for shader updates
         UResourceManager::GetInstance().CheckAndReloadShaders(DeltaSeconds);
+
+        // 모든 스레드의 프로파일 이벤트를 모아 이번 프레임 확정 (통계 UI는 다음 프레임에 이 결과를 그린다)
+        FCPUProfiler::Get().EndFrame();
     }
 }
 
+void UGameEngine::RunBenchmark()
+{
+    const FFrameBenchmarkSettings& Settings = FFrameBenchmark::GetSettings();
+    const int32 TotalFrames = Settings.NumWarmupFrames + Settings.NumFrames;
+
+    // 측정 프레임이 대체 Variant로 그려지지 않도록 셰이더는 동기 컴파일 (씬 로드 중 제출된 작업도 먼저 반영)
+    FShaderCompileManager& ShaderCompiler = FShaderCompileManager::Get();
+    const bool bWasAsyncCompileEnabled = ShaderCompiler.IsAsyncCompileEnabled();
+    ShaderCompiler.SetAsyncCompileEnabled(false);
+    ShaderCompiler.WaitForAll();
+
+    FFrameBenchmark Benchmark;
+    Benchmark.Begin();
+
+    MSG msg;
+    for (int32 FrameIndex = 0; FrameIndex < TotalFrames && bRunning; ++FrameIndex)
+    {
+        // 숨김 창이라도 메시지는 비워 둔다 (측정 구간 밖)
+        while (PeekMessage(&msg, nullptr, 0, 0, PM_REMOVE))
+        {
+            TranslateMessage(&msg);
+            DispatchMessage(&msg);
+            if (msg.message == WM_QUIT)
+            {
+                bRunning = false;
+            }
+        }
+
+        // 실제 경과 시간 대신 고정 타임스텝 -> 실행마다 같은 시뮬레이션
+        const uint64 FrameStart = FPlatformTime::Cycles64();
+        Tick(Settings.FixedDeltaSeconds);
+        Render();
+        FShaderCompileManager::Get().ProcessFinishedJobs();
+        const double FrameMs = FPlatformTime::ToMilliseconds(FPlatformTime::Cycles64() - FrameStart);
+
+        FCPUProfiler::Get().EndFrame();
+        Benchmark.EndFrame(FrameIndex, FrameMs);
+    }
+
+    Benchmark.WriteResults();
+    ShaderCompiler.SetAsyncCompileEnabled(bWasAsyncCompileEnabled);
+    bRunning = false;
+}
+
 void UGameEngine::Shutdown()
 {
     // AudioDevice 종료 (반드시 ObjectFactory::DeleteAll 이전에 호출)
@@ -338,6 +426,9 @@ void UGameEngine::Shutdown()
     }
     WorldContexts.clear();
 
+    // 셰이더 컴파일 워커 종료 (완료 콜백이 UShader를 참조하므로 리소스 삭제 전에)
+    FShaderCompileManager::Get().Shutdown();
+
     // Delete all UObjects (Components, Actors, Resources)
     // Resource destructors will properly release D3D resources
     ObjectFactory::DeleteAll(true);
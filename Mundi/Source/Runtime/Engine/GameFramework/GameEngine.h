@@ -38,6 +38,9 @@ private:
     void Tick(float DeltaSeconds);
     void Render();
 
+    // 명령줄 -benchmark 모드: 고정 타임스텝으로 N 프레임 실행 후 단계별 시간을 JSON으로 저장
+    void RunBenchmark();
+
     void HandleUVInput(float DeltaSeconds);
 
 private:
@@ -19,7 +19,7 @@ public:
 	~AGameModeBase() override;
 	
 	APawn* DefaultPawn;
-	APlayerController* PlayerController;
+	APlayerController* PlayerController = nullptr;
 	
 	UClass* DefaultPawnClass;
 	UClass* PlayerControllerClass;
@@ -28,8 +28,15 @@
 #include "Level.h"
 #include "LightManager.h"
 #include "LuaManager.h"
+#include "Source/Runtime/Engine/Animation/AnimUpdateRateManager.h"
+#include "Source/Runtime/Engine/Navigation/NavigationSystem.h"
+#include "Source/Runtime/Engine/AI/AIDecisionScheduler.h"
+#include "Source/Runtime/Game/Combat/CombatResolver.h"
 #include "ShapeComponent.h"
 #include "PlayerCameraManager.h"
+#include "Pawn.h"
+#include "PlayerController.h"
+#include "GameModeBase.h"
 #include "Hash.h"
 
 IMPLEMENT_CLASS(UWorld)
@@ -42,6 +49,7 @@ UWorld::UWorld() : Partition(nullptr)  // Will be created in Initialize() based
 	LightManager = std::make_unique<FLightManager>();
 	LightManager->SetOwningWorld(this);  // Set owning world for optimization decisions
 	LuaManager = std::make_unique<FLuaManager>();
+	AnimUpdateRateManager = std::make_unique<FAnimationUpdateRateManager>();
 
 	UnscaledDelta = 0;
 	SlomoOnlyDelta = 0;
@@ -285,6 +293,33 @@ void UWorld::Tick(float DeltaSeconds)
 		PhysScene->WaitForSimulation();
 	}
 
+	// 애니메이션 LOD 기준 뷰 갱신 + 포즈 공유 캐시 비우기 (스켈레탈 메시 Tick 전)
+	if (AnimUpdateRateManager)
+	{
+		UCameraComponent* ViewCamera = nullptr;
+		if (bPie)
+		{
+			ViewCamera = PlayerCameraManager ? PlayerCameraManager->GetViewCamera() : nullptr;
+		}
+		else if (MainEditorCameraActor)
+		{
+			ViewCamera = MainEditorCameraActor->GetCameraComponent();
+		}
+		AnimUpdateRateManager->BeginFrame(ViewCamera);
+	}
+
+	// 이번 프레임 AI 결정 대상 선정 (플레이어 거리/화면 안 우선, 프레임 예산만큼), 적 Tick 전
+	if (AIDecisionScheduler && bPie)
+	{
+		APawn* PlayerPawn = nullptr;
+		if (GameMode && GameMode->PlayerController)
+		{
+			PlayerPawn = GameMode->PlayerController->GetPawn();
+		}
+		UCameraComponent* ViewCamera = PlayerCameraManager ? PlayerCameraManager->GetViewCamera() : nullptr;
+		AIDecisionScheduler->BeginFrame(PlayerPawn, ViewCamera);
+	}
+
 	if (Level)
 	{
 		// Tick 중에 새로운 actor가 추가될 수도 있어서 복사 후 호출
@@ -309,12 +344,46 @@ void UWorld::Tick(float DeltaSeconds)
 		}
     }
 
-	// Lua 코루틴 전용 Tick
+	// Lua 스크립트 Tick (스크립트별 배치 디스패치) + 코루틴 Tick
 	if (LuaManager && bPie)
 	{
 		LuaManager->Tick(GetDeltaTime(EDeltaTime::Game));
 	}
 
+	// 내비메시 재빌드(요청 시) + 이번 프레임 경로 요청 배치 처리, 물리 스텝 전이라 씬 읽기 가능
+	if (NavigationSystem && bPie)
+	{
+		NavigationSystem->Tick(PhysScene.get());
+	}
+
+	// 이번 프레임에 바뀐 서브트리만 부모 -> 자식 순으로 한 번에 확정
+	// 이후 물리/렌더링의 월드 트랜스폼 조회는 캐시 적중
+	if (Level)
+	{
+		TransformUpdateRoots.clear();
+		for (FDirtyTransformRoot& Root : DirtyTransformRoots)
+		{
+			if (ObjectFactory::IsObjectAlive(Root.Component, Root.UUID, Root.IndexHint))
+			{
+				TransformUpdateRoots.Add(Root.Component);
+			}
+		}
+		DirtyTransformRoots.clear();
+		USceneComponent::UpdateWorldTransforms(TransformUpdateRoots);
+
+		// 확정된 위치로 폰 격자 해시 갱신 (다음 프레임 타게팅/AI 감지가 조회, PIE에서만)
+		if (bPie)
+		{
+			PawnSpatialHash.Rebuild(ActorRegistry, APawn::StaticClass());
+		}
+	}
+
+	// 활성 히트박스 배치 오버랩 + 결정적 순서로 데미지 적용 (확정된 트랜스폼 기준, 물리 스텝 전)
+	if (CombatResolver && bPie)
+	{
+		CombatResolver->Resolve(PhysScene.get());
+	}
+
 	// 물리 시뮬레이션 시작 (PIE에서만) - Fixed Timestep
 	if (PhysScene && bPie)
 	{
@@ -340,6 +409,11 @@ void UWorld::Tick(float DeltaSeconds)
 	ProcessPendingKillActors();
 }
 
+void UWorld::EnqueueTransformUpdate(USceneComponent* Component)
+{
+	DirtyTransformRoots.Add({ Component, Component->UUID, Component->InternalIndex });
+}
+
 UWorld* UWorld::DuplicateWorldForPIE(UWorld* InEditorWorld)
 {
 	// 레벨 새로 생성
@@ -355,6 +429,9 @@ UWorld* UWorld::DuplicateWorldForPIE(UWorld* InEditorWorld)
 	// 물리 씬 초기화
 	PIEWorld->PhysScene = std::make_unique<FPhysScene>();
 	PIEWorld->PhysScene->Initialize();
+	PIEWorld->NavigationSystem = std::make_unique<FNavigationSystem>();
+	PIEWorld->AIDecisionScheduler = std::make_unique<FAIDecisionScheduler>();
+	PIEWorld->CombatResolver = std::make_unique<FCombatResolver>();
 
 	PIEWorld->bPie = true;
 	
@@ -362,6 +439,18 @@ UWorld* UWorld::DuplicateWorldForPIE(UWorld* InEditorWorld)
 	GEngine.AddWorldContext(PIEWorldContext);
 	
 	const TArray<AActor*>& SourceActors = InEditorWorld->GetLevel()->GetActors();
+
+	// 복제될 오브젝트(액터 + 컴포넌트) 수만큼 GUObjectArray를 한 번에 확보해 복제 중 재할당 방지
+	int32 NumObjectsToDuplicate = 0;
+	for (AActor* SourceActor : SourceActors)
+	{
+		if (SourceActor)
+		{
+			NumObjectsToDuplicate += 1 + static_cast<int32>(SourceActor->GetOwnedComponents().Num());
+		}
+	}
+	ObjectFactory::ReserveObjects(NumObjectsToDuplicate);
+
 	for (AActor* SourceActor : SourceActors)
 	{
 		if (!SourceActor)
@@ -474,6 +563,13 @@ bool UWorld::DestroyActor(AActor* Actor)
 	// 레벨에서 제거 시도
 	if (Level && Level->RemoveActor(Actor))
 	{
+		ActorRegistry.Unregister(Actor);
+		PawnSpatialHash.Remove(Actor);
+		if (AIDecisionScheduler)
+		{
+			AIDecisionScheduler->UnregisterAgent(Actor);
+		}
+
 		// 메모리 해제
 		ObjectFactory::DeleteObject(Actor);
 		return true; // 성공적으로 삭제
@@ -562,6 +658,8 @@ void UWorld::SetLevel(std::unique_ptr<ULevel> InLevel)
         }
         Level->Clear();
     }
+    ActorRegistry.Clear();
+    PawnSpatialHash.Clear();
     // Clear spatial indices (skip if partition is null for preview worlds)
     if (Partition)
     {
@@ -578,6 +676,7 @@ void UWorld::SetLevel(std::unique_ptr<ULevel> InLevel)
 		{
 			Partition->BulkRegister(Level->GetActors());
 		}
+		ActorRegistry.BulkRegister(Level->GetActors());
         // 인덱스 기반 순회 (BeginPlay에서 SpawnActor 호출 시 iterator 무효화 방지)
         const TArray<AActor*>& Actors = Level->GetActors();
         for (size_t i = 0; i < Actors.Num(); ++i)
@@ -613,6 +712,7 @@ void UWorld::AddActorToLevel(AActor* Actor)
 	if (Level)
 	{
 		Level->AddActor(Actor);
+		ActorRegistry.Register(Actor);
 
 		Actor->SetWorld(this);
 
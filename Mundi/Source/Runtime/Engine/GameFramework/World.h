@@ -6,6 +6,8 @@
 #include "Gizmo/GizmoActor.h"
 #include "LightManager.h"
 #include "Source/Runtime/Engine/Physics/PhysScene.h"
+#include "ActorRegistry.h"
+#include "ActorSpatialHash.h"
 
 // Forward Declarations
 class UResourceManager;
@@ -13,7 +15,12 @@ class UUIManager;
 class UInputManager;
 class USelectionManager;
 class FLuaManager;
+class FAnimationUpdateRateManager;
+class FNavigationSystem;
+class FAIDecisionScheduler;
+class FCombatResolver;
 class AActor;
+class USceneComponent;
 class URenderer;
 class ACameraActor;
 class AGizmoActor;
@@ -71,11 +78,11 @@ public:
     template<class T>
     T* SpawnActor(const FTransform& Transform);
     template<typename T>
-    T* FindActor();
+    T* FindActor();     // 레지스트리 순서의 첫 일치 (레벨 순서 아님)
     template<typename T>
     T* FindComponent();
     template<typename T>
-    TArray<T*> FindActors();
+    TArray<T*> FindActors();    // 레지스트리 순서
     // ObjectName으로 '첫 번째' 액터를 찾아 반환합니다.
     AActor* FindActorByName(const FName& ActorName);
     // 모든 액터의 모든 컴포넌트를 순회하여 ObjectName으로 '첫 번째' 컴포넌트를 찾아 반환합니다 (비용이 매우 크므로 매 프레임 호출을 권장하지 않습니다.)
@@ -89,6 +96,9 @@ public:
     void AddPendingKillActor(AActor* Actor);
     void ProcessPendingKillActors();
 
+    /** 트랜스폼이 바뀐 서브트리 루트 등록 (USceneComponent::MarkTransformDirty가 호출, Tick에서 한 번에 확정) */
+    void EnqueueTransformUpdate(USceneComponent* Component);
+
     void CreateLevel();
 
     void SpawnDefaultActors();
@@ -98,7 +108,16 @@ public:
     ULevel* GetLevel() const { return Level.get(); }
     FLightManager* GetLightManager() const { return LightManager.get(); }
     FLuaManager* GetLuaManager() const { return LuaManager.get(); }
+    FAnimationUpdateRateManager* GetAnimUpdateRateManager() const { return AnimUpdateRateManager.get(); }
     FPhysScene* GetPhysScene() { return PhysScene.get(); }
+    FNavigationSystem* GetNavigationSystem() const { return NavigationSystem.get(); }
+    FAIDecisionScheduler* GetAIDecisionScheduler() const { return AIDecisionScheduler.get(); }
+    FCombatResolver* GetCombatResolver() const { return CombatResolver.get(); }
+
+    /** 클래스별 액터 목록 (FindActor/FindActors가 사용) */
+    const FActorRegistry& GetActorRegistry() const { return ActorRegistry; }
+    /** 폰 위치 격자 해시 (매 프레임 트랜스폼 확정 후 갱신, 반경/원뿔/최근접 조회) */
+    const FActorSpatialHash& GetPawnSpatialHash() const { return PawnSpatialHash; }
 
     /** 뷰어 등 별도의 물리 시뮬레이션이 필요한 월드에서 호출 */
     void InitializePhysScene();
@@ -156,11 +175,20 @@ private:
     ACameraActor* MainEditorCameraActor = nullptr;  // 첫번째 뷰포트 용 에디터 카메라
     AGridActor* GridActor = nullptr;
     AGizmoActor* GizmoActor = nullptr;
-    APlayerCameraManager* PlayerCameraManager;
+    APlayerCameraManager* PlayerCameraManager = nullptr;
 
     /** === 레벨 컨테이너 === */
     std::unique_ptr<ULevel> Level;
     TArray<AActor*> PendingKillActors;  // 지연 삭제 예정 액터 목록
+    // 이번 프레임에 트랜스폼이 바뀐 서브트리 루트 (확정 전에 삭제될 수 있으므로 UUID로 생존 확인)
+    struct FDirtyTransformRoot
+    {
+        USceneComponent* Component = nullptr;
+        uint32 UUID = 0;
+        uint32 IndexHint = 0;
+    };
+    TArray<FDirtyTransformRoot> DirtyTransformRoots;
+    TArray<USceneComponent*> TransformUpdateRoots;  // 프레임 트랜스폼 확정 패스용 (할당 재사용)
 
     /** === 라이트 매니저 ===*/
     std::unique_ptr<FLightManager> LightManager;
@@ -168,9 +196,25 @@ private:
     /** === 루아 매니저 ===*/
     std::unique_ptr<FLuaManager> LuaManager;
 
+    /** === 애니메이션 업데이트 주기 / 군중 포즈 공유 ===*/
+    std::unique_ptr<FAnimationUpdateRateManager> AnimUpdateRateManager;
+
     /** === 물리 씬 ===*/
     std::unique_ptr<FPhysScene> PhysScene;
 
+    /** === 내비게이션 (PIE에서만 생성) ===*/
+    std::unique_ptr<FNavigationSystem> NavigationSystem;
+
+    /** === AI 결정 스케줄러 (PIE에서만 생성) ===*/
+    std::unique_ptr<FAIDecisionScheduler> AIDecisionScheduler;
+
+    /** === 히트박스 전투 판정 (PIE에서만 생성) ===*/
+    std::unique_ptr<FCombatResolver> CombatResolver;
+
+    /** === 액터 조회 색인 ===*/
+    FActorRegistry ActorRegistry;
+    FActorSpatialHash PawnSpatialHash;
+
     // Fixed Timestep 물리 시뮬레이션
     static constexpr float FixedPhysicsDeltaTime = 1.0f / 60.0f;  // 60Hz 물리
     static constexpr int32 MaxPhysicsSubSteps = 8;                 // 최대 서브스텝
@@ -239,6 +283,8 @@ inline T* UWorld::SpawnActor(const FTransform& Transform)
 }
 
 // 월드에서 특정 클래스(T)의 '첫 번째' 액터를 찾아 반환합니다. 없으면 nullptr.
+// '첫 번째'는 레벨 순서가 아니라 레지스트리 순서 (클래스 트리 전위 순으로 버킷, 버킷 안은 등록 순이지만 제거 시 swap-remove로 바뀜)
+// 여러 액터가 일치할 때 특정 액터가 필요하면 FindActorByName이나 직접 보관한 포인터를 쓸 것
 template<typename T>
 inline T* UWorld::FindActor()
 {
@@ -250,16 +296,9 @@ inline T* UWorld::FindActor()
         return nullptr;
     }
 
-    for (AActor* Actor : Level->GetActors())
-    {
-        if (Actor && !Actor->IsPendingDestroy() &&Actor->IsA(TypeClass))
-        {
-            // 찾은 액터를 T* 타입으로 캐스팅하여 반환합니다.
-            // (IsA를 통과했으므로 Cast는 안전함)
-            return Cast<T>(Actor);
-        }
-    }
-    return nullptr;
+    // 클래스 색인에서 T 계열 버킷만 본다 (레벨 전체 순회 없음)
+    // (T 계열 버킷에서 꺼냈으므로 캐스팅은 안전함)
+    return static_cast<T*>(ActorRegistry.FindFirstActorOfClass(TypeClass));
 }
 
 // 월드에서 특정 클래스(T)의 '모든' 액터를 찾아 반환합니다. 없으면 nullptr.
@@ -276,14 +315,12 @@ inline TArray<T*> UWorld::FindActors()
         return FoundActors; // 빈 배열 반환
     }
 
-    for (AActor* Actor : Level->GetActors())
+    ActorRegistry.ForEachActorOfClass(TypeClass, [&FoundActors](AActor* Actor)
     {
-        if (Actor && !Actor->IsPendingDestroy() && Actor->IsA(TypeClass))
-        {
-            // 일치하는 모든 액터를 캐스팅하여 배열에 추가
-            FoundActors.Add(Cast<T>(Actor));
-        }
-    }
+        // 일치하는 모든 액터를 캐스팅하여 배열에 추가
+        FoundActors.Add(static_cast<T*>(Actor));
+        return true;
+    });
     return FoundActors;
 }
 
@@ -0,0 +1,457 @@
+﻿#include "pch.h"
+#include "NavMesh.h"
+#include "Hash.h"
+
+namespace
+{
+    int32 FloorDiv(int32 A, int32 B)
+    {
+        return A >= 0 ? A / B : -((-A + B - 1) / B);
+    }
+
+    uint64 HashFloat(uint64 Seed, float Value)
+    {
+        uint32 Bits = 0;
+        std::memcpy(&Bits, &Value, sizeof(Bits));
+        return HashCombine(Seed, Bits);
+    }
+
+    // > 0 이면 C가 A->B의 왼쪽 (XY 평면)
+    float TriArea2D(const FVector& A, const FVector& B, const FVector& C)
+    {
+        return (B.X - A.X) * (C.Y - A.Y) - (B.Y - A.Y) * (C.X - A.X);
+    }
+
+    bool IsNearlyEqual2D(const FVector& A, const FVector& B)
+    {
+        const float DX = A.X - B.X;
+        const float DY = A.Y - B.Y;
+        return DX * DX + DY * DY < 1.0e-6f;
+    }
+
+    const FNavTileSpan* FindTileSpanForPoly(const FNavMeshTileData& Tile, int32 TileSize, int32 LocalX, int32 LocalY, int32 LocalPoly)
+    {
+        const int32 Cell = LocalY * TileSize + LocalX;
+        for (int32 i = Tile.CellSpanStart[Cell]; i < Tile.CellSpanStart[Cell + 1]; ++i)
+        {
+            if (Tile.Spans[i].Poly == LocalPoly)
+            {
+                return &Tile.Spans[i];
+            }
+        }
+        return nullptr;
+    }
+}
+
+uint64 FNavMeshConfig::GetHash() const
+{
+    uint64 Hash = HashCombine(0, static_cast<uint64>(TileSizeCells));
+    Hash = HashCombine(Hash, static_cast<uint64>(MaxPolyCells));
+    Hash = HashFloat(Hash, CellSize);
+    Hash = HashFloat(Hash, CellHeight);
+    Hash = HashFloat(Hash, AgentRadius);
+    Hash = HashFloat(Hash, AgentHeight);
+    Hash = HashFloat(Hash, AgentMaxClimb);
+    Hash = HashFloat(Hash, AgentMaxSlope);
+    return Hash;
+}
+
+void FNavMesh::Clear()
+{
+    ++Generation;
+    Tiles.Empty();
+    TilePolyBase.Empty();
+    TileIndexByKey.Empty();
+    Polys.Empty();
+    Links.Empty();
+}
+
+void FNavMesh::SetTiles(const FNavMeshConfig& InConfig, TArray<std::shared_ptr<const FNavMeshTileData>>&& InTiles)
+{
+    Clear();
+    Config = InConfig;
+    Tiles = std::move(InTiles);
+
+    const int32 TileSize = Config.TileSizeCells;
+    const float CellSize = Config.CellSize;
+    const float CellHeight = Config.CellHeight;
+
+    int32 NumPolys = 0;
+    TilePolyBase.Reserve(Tiles.Num());
+    for (int32 TileIndex = 0; TileIndex < Tiles.Num(); ++TileIndex)
+    {
+        const FNavMeshTileData& Tile = *Tiles[TileIndex];
+        TilePolyBase.Add(NumPolys);
+        TileIndexByKey.Add(MakeTileKey(Tile.TileX, Tile.TileY), TileIndex);
+        NumPolys += Tile.Polys.Num();
+    }
+
+    Polys.Reserve(NumPolys);
+    for (int32 TileIndex = 0; TileIndex < Tiles.Num(); ++TileIndex)
+    {
+        const FNavMeshTileData& Tile = *Tiles[TileIndex];
+        for (const FNavTilePoly& LocalPoly : Tile.Polys)
+        {
+            FNavPoly Poly;
+            Poly.Tile = TileIndex;
+            Poly.MinCellX = Tile.TileX * TileSize + LocalPoly.MinX;
+            Poly.MinCellY = Tile.TileY * TileSize + LocalPoly.MinY;
+            Poly.MaxCellX = Tile.TileX * TileSize + LocalPoly.MaxX;
+            Poly.MaxCellY = Tile.TileY * TileSize + LocalPoly.MaxY;
+            Poly.Center = FVector(
+                (Poly.MinCellX + Poly.MaxCellX + 1) * 0.5f * CellSize,
+                (Poly.MinCellY + Poly.MaxCellY + 1) * 0.5f * CellSize,
+                (LocalPoly.MinFloor + LocalPoly.MaxFloor) * 0.5f * CellHeight);
+            Polys.Add(Poly);
+        }
+    }
+
+    // 폴리곤 순서(타일 -> 로컬)대로 링크를 붙여야 FirstLink 구간이 연속된다
+    for (int32 TileIndex = 0; TileIndex < Tiles.Num(); ++TileIndex)
+    {
+        BuildLinks(TileIndex);
+    }
+}
+
+void FNavMesh::BuildLinks(int32 TileIndex)
+{
+    const FNavMeshTileData& Tile = *Tiles[TileIndex];
+    const int32 TileSize = Config.TileSizeCells;
+    const float CellSize = Config.CellSize;
+    const float CellHeight = Config.CellHeight;
+    const int32 BaseX = Tile.TileX * TileSize;
+    const int32 BaseY = Tile.TileY * TileSize;
+
+    for (int32 LocalIndex = 0; LocalIndex < Tile.Polys.Num(); ++LocalIndex)
+    {
+        const FNavTilePoly& LocalPoly = Tile.Polys[LocalIndex];
+        FNavPoly& Poly = Polys[TilePolyBase[TileIndex] + LocalIndex];
+        Poly.FirstLink = Links.Num();
+
+        for (int32 Dir = 0; Dir < 4; ++Dir)
+        {
+            // 경계를 따라 같은 이웃 폴리곤이 이어지는 구간을 링크 하나로 만든다
+            const bool bAlongX = (Dir == 1 || Dir == 3);
+            const int32 EdgeCell = (Dir == 0) ? LocalPoly.MinX : (Dir == 2) ? LocalPoly.MaxX : (Dir == 1) ? LocalPoly.MaxY : LocalPoly.MinY;
+            const int32 RunFirst = bAlongX ? LocalPoly.MinX : LocalPoly.MinY;
+            const int32 RunLast = bAlongX ? LocalPoly.MaxX : LocalPoly.MaxY;
+            const float LeftX = static_cast<float>(-NavDirection::OffsetY[Dir]);
+            const float LeftY = static_cast<float>(NavDirection::OffsetX[Dir]);
+
+            int32 CurrentNeighbor = INDEX_NONE;
+            int32 RunStart = RunFirst;
+            float RunStartZ = 0.0f;
+            float PrevZ = 0.0f;
+
+            for (int32 K = RunFirst; K <= RunLast + 1; ++K)
+            {
+                int32 Neighbor = INDEX_NONE;
+                float Z = 0.0f;
+                if (K <= RunLast)
+                {
+                    const int32 LocalX = bAlongX ? K : EdgeCell;
+                    const int32 LocalY = bAlongX ? EdgeCell : K;
+                    const FNavTileSpan* Span = FindTileSpanForPoly(Tile, TileSize, LocalX, LocalY, LocalIndex);
+                    if (Span && Span->NeighborFloor[Dir] != NAV_NO_FLOOR)
+                    {
+                        int32 NeighborTile = INDEX_NONE;
+                        const FNavTileSpan* NeighborSpan = FindSpan(
+                            BaseX + LocalX + NavDirection::OffsetX[Dir],
+                            BaseY + LocalY + NavDirection::OffsetY[Dir],
+                            Span->NeighborFloor[Dir], 0, &NeighborTile);
+                        if (NeighborSpan && NeighborSpan->Poly != INDEX_NONE)
+                        {
+                            Neighbor = TilePolyBase[NeighborTile] + NeighborSpan->Poly;
+                            Z = (Span->Floor + NeighborSpan->Floor) * 0.5f * CellHeight;
+                        }
+                    }
+                }
+
+                if (Neighbor != CurrentNeighbor || K > RunLast)
+                {
+                    if (CurrentNeighbor != INDEX_NONE)
+                    {
+                        FVector A;
+                        FVector B;
+                        if (bAlongX)
+                        {
+                            const float EdgeY = (BaseY + EdgeCell + (Dir == 1 ? 1 : 0)) * CellSize;
+                            A = FVector((BaseX + RunStart) * CellSize, EdgeY, RunStartZ);
+                            B = FVector((BaseX + K) * CellSize, EdgeY, PrevZ);
+                        }
+                        else
+                        {
+                            const float EdgeX = (BaseX + EdgeCell + (Dir == 2 ? 1 : 0)) * CellSize;
+                            A = FVector(EdgeX, (BaseY + RunStart) * CellSize, RunStartZ);
+                            B = FVector(EdgeX, (BaseY + K) * CellSize, PrevZ);
+                        }
+
+                        FNavPolyLink Link;
+                        Link.Neighbor = CurrentNeighbor;
+                        const bool bBIsLeft = (B.X - A.X) * LeftX + (B.Y - A.Y) * LeftY > 0.0f;
+                        Link.PortalLeft = bBIsLeft ? B : A;
+                        Link.PortalRight = bBIsLeft ? A : B;
+                        Links.Add(Link);
+                    }
+                    CurrentNeighbor = Neighbor;
+                    RunStart = K;
+                    RunStartZ = Z;
+                }
+                PrevZ = Z;
+            }
+        }
+
+        Poly.NumLinks = Links.Num() - Poly.FirstLink;
+    }
+}
+
+int32 FNavMesh::FindTileIndex(int32 TileX, int32 TileY) const
+{
+    const int32* Index = TileIndexByKey.Find(MakeTileKey(TileX, TileY));
+    return Index ? *Index : INDEX_NONE;
+}
+
+const FNavTileSpan* FNavMesh::FindSpan(int32 CellX, int32 CellY, int32 Floor, int32 Tolerance, int32* OutTile) const
+{
+    const int32 TileSize = Config.TileSizeCells;
+    const int32 TileX = FloorDiv(CellX, TileSize);
+    const int32 TileY = FloorDiv(CellY, TileSize);
+    const int32 TileIndex = FindTileIndex(TileX, TileY);
+    if (TileIndex == INDEX_NONE)
+    {
+        return nullptr;
+    }
+
+    const FNavMeshTileData& Tile = *Tiles[TileIndex];
+    const int32 Cell = (CellY - TileY * TileSize) * TileSize + (CellX - TileX * TileSize);
+
+    const FNavTileSpan* Best = nullptr;
+    int32 BestDiff = Tolerance + 1;
+    for (int32 i = Tile.CellSpanStart[Cell]; i < Tile.CellSpanStart[Cell + 1]; ++i)
+    {
+        const int32 Diff = std::abs(Tile.Spans[i].Floor - Floor);
+        if (Diff < BestDiff)
+        {
+            BestDiff = Diff;
+            Best = &Tile.Spans[i];
+        }
+    }
+
+    if (Best && OutTile)
+    {
+        *OutTile = TileIndex;
+    }
+    return Best;
+}
+
+const FNavPolyLink* FNavMesh::FindLink(int32 FromPoly, int32 ToPoly) const
+{
+    const FNavPoly& Poly = Polys[FromPoly];
+    for (int32 i = 0; i < Poly.NumLinks; ++i)
+    {
+        const FNavPolyLink& Link = Links[Poly.FirstLink + i];
+        if (Link.Neighbor == ToPoly)
+        {
+            return &Link;
+        }
+    }
+    return nullptr;
+}
+
+int32 FNavMesh::FindNearestPoly(const FVector& Position, float SearchRadius, FVector* OutNearest) const
+{
+    if (IsEmpty())
+    {
+        return INDEX_NONE;
+    }
+
+    const int32 TileSize = Config.TileSizeCells;
+    const float CellSize = Config.CellSize;
+    const float CellHeight = Config.CellHeight;
+    const int32 CenterX = static_cast<int32>(std::floor(Position.X / CellSize));
+    const int32 CenterY = static_cast<int32>(std::floor(Position.Y / CellSize));
+    const int32 Radius = std::max(0, static_cast<int32>(std::ceil(SearchRadius / CellSize)));
+    const float MaxDistSq = SearchRadius * SearchRadius;
+
+    // 캡슐 중심 높이를 넘겨도 되도록 아래쪽은 에이전트 키만큼 더 본다 (층 사이 간격은 항상 에이전트 키 이상)
+    const float MinFloorZ = Position.Z - (Config.AgentHeight + Config.AgentMaxClimb);
+    const float MaxFloorZ = Position.Z + Config.AgentMaxClimb;
+
+    int32 BestPoly = INDEX_NONE;
+    float BestDistSq = FLT_MAX;
+    FVector BestPoint = Position;
+
+    int32 CachedTileX = std::numeric_limits<int32>::max();
+    int32 CachedTileY = 0;
+    int32 CachedTile = INDEX_NONE;
+
+    for (int32 CellY = CenterY - Radius; CellY <= CenterY + Radius; ++CellY)
+    {
+        for (int32 CellX = CenterX - Radius; CellX <= CenterX + Radius; ++CellX)
+        {
+            const float NearestX = FMath::Clamp(Position.X, CellX * CellSize, (CellX + 1) * CellSize);
+            const float NearestY = FMath::Clamp(Position.Y, CellY * CellSize, (CellY + 1) * CellSize);
+            const float DistSqXY = (NearestX - Position.X) * (NearestX - Position.X) + (NearestY - Position.Y) * (NearestY - Position.Y);
+            if (DistSqXY > MaxDistSq || DistSqXY >= BestDistSq)
+            {
+                continue;
+            }
+
+            const int32 TileX = FloorDiv(CellX, TileSize);
+            const int32 TileY = FloorDiv(CellY, TileSize);
+            if (TileX != CachedTileX || TileY != CachedTileY)
+            {
+                CachedTileX = TileX;
+                CachedTileY = TileY;
+                CachedTile = FindTileIndex(TileX, TileY);
+            }
+            if (CachedTile == INDEX_NONE)
+            {
+                continue;
+            }
+
+            const FNavMeshTileData& Tile = *Tiles[CachedTile];
+            const int32 Cell = (CellY - TileY * TileSize) * TileSize + (CellX - TileX * TileSize);
+            for (int32 i = Tile.CellSpanStart[Cell]; i < Tile.CellSpanStart[Cell + 1]; ++i)
+            {
+                const FNavTileSpan& Span = Tile.Spans[i];
+                const float FloorZ = Span.Floor * CellHeight;
+                if (FloorZ < MinFloorZ || FloorZ > MaxFloorZ)
+                {
+                    continue;
+                }
+
+                const float DZ = Position.Z - FloorZ;
+                const float DistSq = DistSqXY + DZ * DZ * 0.25f;
+                if (DistSq < BestDistSq)
+                {
+                    BestDistSq = DistSq;
+                    BestPoly = TilePolyBase[CachedTile] + Span.Poly;
+                    BestPoint = FVector(NearestX, NearestY, FloorZ);
+                }
+            }
+        }
+    }
+
+    if (OutNearest && BestPoly != INDEX_NONE)
+    {
+        *OutNearest = BestPoint;
+    }
+    return BestPoly;
+}
+
+FVector FNavMesh::ClampToPoly(int32 PolyIndex, const FVector& Position) const
+{
+    const FNavPoly& Poly = Polys[PolyIndex];
+    const int32 TileSize = Config.TileSizeCells;
+    const float CellSize = Config.CellSize;
+
+    // 경계 위의 점은 이웃 셀로 넘어가지 않도록 살짝 안쪽으로
+    const float Inset = CellSize * 0.01f;
+    const float X = FMath::Clamp(Position.X, Poly.MinCellX * CellSize + Inset, (Poly.MaxCellX + 1) * CellSize - Inset);
+    const float Y = FMath::Clamp(Position.Y, Poly.MinCellY * CellSize + Inset, (Poly.MaxCellY + 1) * CellSize - Inset);
+
+    const FNavMeshTileData& Tile = *Tiles[Poly.Tile];
+    const int32 CellX = FMath::Clamp(static_cast<int32>(std::floor(X / CellSize)), Poly.MinCellX, Poly.MaxCellX);
+    const int32 CellY = FMath::Clamp(static_cast<int32>(std::floor(Y / CellSize)), Poly.MinCellY, Poly.MaxCellY);
+    const FNavTileSpan* Span = FindTileSpanForPoly(Tile, TileSize, CellX - Tile.TileX * TileSize, CellY - Tile.TileY * TileSize, PolyIndex - TilePolyBase[Poly.Tile]);
+
+    return FVector(X, Y, Span ? Span->Floor * Config.CellHeight : Poly.Center.Z);
+}
+
+bool FNavMesh::FindStraightPath(const FVector& Start, const FVector& End, const TArray<int32>& Corridor, TArray<FVector>& OutPoints) const
+{
+    OutPoints.Empty();
+    if (Corridor.IsEmpty())
+    {
+        return false;
+    }
+
+    // 워커 스레드에서 동시에 호출되므로 스크래치는 스레드별로 둔다
+    thread_local TArray<FVector> PortalLefts;
+    thread_local TArray<FVector> PortalRights;
+    PortalLefts.Empty();
+    PortalRights.Empty();
+
+    PortalLefts.Add(Start);
+    PortalRights.Add(Start);
+    for (int32 i = 0; i + 1 < Corridor.Num(); ++i)
+    {
+        const FNavPolyLink* Link = FindLink(Corridor[i], Corridor[i + 1]);
+        if (!Link)
+        {
+            return false;
+        }
+        PortalLefts.Add(Link->PortalLeft);
+        PortalRights.Add(Link->PortalRight);
+    }
+    PortalLefts.Add(End);
+    PortalRights.Add(End);
+
+    // Simple Stupid Funnel: 꼭짓점(Apex)에서 본 왼쪽/오른쪽 경계를 좁혀 가다가 교차하면 반대쪽 점을 꺾임점으로 확정
+    FVector Apex = Start;
+    FVector Left = Start;
+    FVector Right = Start;
+    int32 ApexIndex = 0;
+    int32 LeftIndex = 0;
+    int32 RightIndex = 0;
+    OutPoints.Add(Start);
+
+    const int32 NumPortals = PortalLefts.Num();
+    for (int32 i = 1; i < NumPortals; ++i)
+    {
+        const FVector& PortalLeft = PortalLefts[i];
+        const FVector& PortalRight = PortalRights[i];
+
+        // 오른쪽 경계를 안쪽으로 좁힌다
+        if (TriArea2D(Apex, Right, PortalRight) >= 0.0f)
+        {
+            if (IsNearlyEqual2D(Apex, Right) || TriArea2D(Apex, Left, PortalRight) < 0.0f)
+            {
+                Right = PortalRight;
+                RightIndex = i;
+            }
+            else
+            {
+                // 왼쪽 경계를 넘어감: 왼쪽 점이 새 꼭짓점
+                Apex = Left;
+                ApexIndex = LeftIndex;
+                OutPoints.Add(Apex);
+                Left = Right = Apex;
+                LeftIndex = RightIndex = ApexIndex;
+                i = ApexIndex;
+                continue;
+            }
+        }
+
+        // 왼쪽 경계를 안쪽으로 좁힌다
+        if (TriArea2D(Apex, Left, PortalLeft) <= 0.0f)
+        {
+            if (IsNearlyEqual2D(Apex, Left) || TriArea2D(Apex, Right, PortalLeft) > 0.0f)
+            {
+                Left = PortalLeft;
+                LeftIndex = i;
+            }
+            else
+            {
+                Apex = Right;
+                ApexIndex = RightIndex;
+                OutPoints.Add(Apex);
+                Left = Right = Apex;
+                LeftIndex = RightIndex = ApexIndex;
+                i = ApexIndex;
+                continue;
+            }
+        }
+    }
+
+    if (!IsNearlyEqual2D(OutPoints.Last(), End))
+    {
+        OutPoints.Add(End);
+    }
+    else
+    {
+        OutPoints.Last() = End;
+    }
+    return true;
+}
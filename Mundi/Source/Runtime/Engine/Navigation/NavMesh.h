@@ -0,0 +1,150 @@
+﻿#pragma once
+
+/**
+ * 내비메시 빌드 설정 (단위: m)
+ * - 복셀(CellSize x CellHeight)로 월드 콜리전을 래스터화한 뒤 걸을 수 있는 바닥만 남긴다
+ * - 타일(TileSizeCells x TileSizeCells 셀) 단위로 빌드하고 캐시한다
+ */
+struct FNavMeshConfig
+{
+    float CellSize = 0.25f;
+    float CellHeight = 0.1f;
+    int32 TileSizeCells = 32;
+    int32 MaxPolyCells = 16;        // 폴리곤(셀 사각형) 한 변의 최대 셀 수
+
+    float AgentRadius = 0.4f;
+    float AgentHeight = 1.8f;
+    float AgentMaxClimb = 0.4f;     // 오를 수 있는 단차
+    float AgentMaxSlope = 45.0f;    // 걸을 수 있는 최대 경사 (도)
+
+    float GetTileWorldSize() const { return CellSize * static_cast<float>(TileSizeCells); }
+    int32 GetErodeCells() const { return static_cast<int32>(std::ceil(AgentRadius / CellSize)); }
+    // 침식이 타일 경계에서 잘리지 않도록 주변 셀까지 함께 래스터화한다
+    int32 GetBorderCells() const { return GetErodeCells() + 3; }
+    int32 GetClimbCells() const { return static_cast<int32>(std::floor(AgentMaxClimb / CellHeight)); }
+    int32 GetHeightCells() const { return static_cast<int32>(std::ceil(AgentHeight / CellHeight)); }
+
+    uint64 GetHash() const;
+};
+
+// 방향 인덱스: 0 = -X, 1 = +Y, 2 = +X, 3 = -Y
+namespace NavDirection
+{
+    constexpr int32 OffsetX[4] = { -1, 0, 1, 0 };
+    constexpr int32 OffsetY[4] = { 0, 1, 0, -1 };
+}
+
+constexpr int32 NAV_NO_FLOOR = std::numeric_limits<int32>::min();
+
+// 타일 코어 셀의 걷기 가능한 바닥 하나 (한 셀에 여러 층이 있을 수 있음)
+struct FNavTileSpan
+{
+    int32 Floor = 0;                        // 바닥 높이 (CellHeight 단위)
+    int32 Poly = INDEX_NONE;                // 타일 로컬 폴리곤
+    int32 NeighborFloor[4] = { NAV_NO_FLOOR, NAV_NO_FLOOR, NAV_NO_FLOOR, NAV_NO_FLOOR }; // 방향별 연결된 이웃 바닥 (타일 밖 포함)
+};
+
+// 같은 층에서 서로 연결된 셀들의 사각형 (타일 로컬 셀 좌표, 양 끝 포함)
+struct FNavTilePoly
+{
+    int32 MinX = 0;
+    int32 MinY = 0;
+    int32 MaxX = 0;
+    int32 MaxY = 0;
+    int32 MinFloor = 0;
+    int32 MaxFloor = 0;
+};
+
+// 타일 빌드 결과 (빌드 후 불변, 캐시에서 공유)
+struct FNavMeshTileData
+{
+    int32 TileX = 0;
+    int32 TileY = 0;
+    uint64 BuildHash = 0;                   // (타일 좌표, 입력 지오메트리, 설정) 해시
+
+    TArray<int32> CellSpanStart;            // 코어 셀별 Spans 시작 인덱스 (TileSize^2 + 1)
+    TArray<FNavTileSpan> Spans;
+    TArray<FNavTilePoly> Polys;
+};
+
+// 이웃 폴리곤으로 넘어가는 경계 구간 (이 폴리곤에서 이웃을 바라볼 때의 왼쪽/오른쪽)
+struct FNavPolyLink
+{
+    int32 Neighbor = INDEX_NONE;
+    FVector PortalLeft;
+    FVector PortalRight;
+};
+
+struct FNavPoly
+{
+    int32 Tile = INDEX_NONE;
+    int32 MinCellX = 0;                     // 전역 셀 좌표
+    int32 MinCellY = 0;
+    int32 MaxCellX = 0;
+    int32 MaxCellY = 0;
+    FVector Center;
+    int32 FirstLink = 0;
+    int32 NumLinks = 0;
+};
+
+/**
+ * 타일 기반 내비메시
+ * - 타일마다 셀 사각형 폴리곤을 갖고, 타일 경계를 넘는 연결은 SetTiles에서 전역으로 잇는다
+ * - 폴리곤/링크 인덱스는 SetTiles마다 새로 매겨지므로 Generation으로 이전 경로의 유효성을 판단한다
+ * - SetTiles 이후에는 읽기 전용이라 여러 워커가 동시에 조회할 수 있다
+ */
+class FNavMesh
+{
+public:
+    void SetTiles(const FNavMeshConfig& InConfig, TArray<std::shared_ptr<const FNavMeshTileData>>&& InTiles);
+    void Clear();
+
+    bool IsEmpty() const { return Polys.IsEmpty(); }
+    uint32 GetGeneration() const { return Generation; }
+    const FNavMeshConfig& GetConfig() const { return Config; }
+
+    int32 GetNumTiles() const { return Tiles.Num(); }
+    int32 GetNumPolys() const { return Polys.Num(); }
+    int32 GetNumLinks() const { return Links.Num(); }
+    const FNavPoly& GetPoly(int32 PolyIndex) const { return Polys[PolyIndex]; }
+    const FNavPolyLink& GetLink(int32 LinkIndex) const { return Links[LinkIndex]; }
+    const FNavPolyLink* FindLink(int32 FromPoly, int32 ToPoly) const;
+
+    /**
+     * @brief Position 주변에서 가장 가까운 폴리곤을 찾는다
+     * @param SearchRadius 수평 탐색 반경
+     * @param OutNearest 폴리곤 위로 투영한 위치 (바닥 높이)
+     * @return 폴리곤 인덱스, 없으면 INDEX_NONE
+     */
+    int32 FindNearestPoly(const FVector& Position, float SearchRadius, FVector* OutNearest = nullptr) const;
+
+    // 폴리곤 안에서 Position에 가장 가까운 점 (바닥 높이)
+    FVector ClampToPoly(int32 PolyIndex, const FVector& Position) const;
+
+    /**
+     * @brief 폴리곤 통로(Corridor)를 따라 가장 짧은 꺾임점 목록을 만든다 (Funnel 알고리즘)
+     * @return Corridor가 끊겨 있으면 false
+     */
+    bool FindStraightPath(const FVector& Start, const FVector& End, const TArray<int32>& Corridor, TArray<FVector>& OutPoints) const;
+
+private:
+    const FNavTileSpan* FindSpan(int32 CellX, int32 CellY, int32 Floor, int32 Tolerance, int32* OutTile = nullptr) const;
+    int32 FindTileIndex(int32 TileX, int32 TileY) const;
+    void BuildLinks(int32 TileIndex);
+
+    static uint64 MakeTileKey(int32 TileX, int32 TileY)
+    {
+        return (static_cast<uint64>(static_cast<uint32>(TileX)) << 32) | static_cast<uint32>(TileY);
+    }
+
+private:
+    FNavMeshConfig Config;
+    uint32 Generation = 0;
+
+    TArray<std::shared_ptr<const FNavMeshTileData>> Tiles;
+    TArray<int32> TilePolyBase;                 // 타일 로컬 폴리곤 -> 전역 인덱스 오프셋
+    TMap<uint64, int32> TileIndexByKey;
+
+    TArray<FNavPoly> Polys;
+    TArray<FNavPolyLink> Links;
+};
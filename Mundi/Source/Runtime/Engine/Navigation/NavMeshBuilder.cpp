@@ -0,0 +1,889 @@
+﻿#include "pch.h"
+#include "NavMeshBuilder.h"
+#include "Hash.h"
+#include "PlatformTime.h"
+#include "Source/Runtime/Core/Async/TaskPool.h"
+#include "Source/Runtime/Engine/Physics/PhysScene.h"
+
+namespace
+{
+    constexpr int32 MaxClipVerts = 12;
+    constexpr int32 MaxSpanHeight = 0x3fffffff;     // 위가 열린 구간의 천장 (뺄셈 오버플로 방지)
+    constexpr int32 MaxChamferDist = 0xffff;
+
+    int32 FloorToCell(float Value, float CellSize)
+    {
+        return static_cast<int32>(std::floor(Value / CellSize));
+    }
+
+    uint64 MakeTileKey(int32 TileX, int32 TileY)
+    {
+        return (static_cast<uint64>(static_cast<uint32>(TileX)) << 32) | static_cast<uint32>(TileY);
+    }
+
+    // Axis(0 = X, 1 = Y) 좌표가 Value 이상(bKeepGreater) 또는 이하인 부분만 남긴다 (Sutherland-Hodgman)
+    int32 ClipPolygon(const FVector* In, int32 NumIn, FVector* Out, int32 Axis, float Value, bool bKeepGreater)
+    {
+        const float Sign = bKeepGreater ? 1.0f : -1.0f;
+        int32 NumOut = 0;
+        for (int32 i = 0, j = NumIn - 1; i < NumIn; j = i, ++i)
+        {
+            const float Di = Sign * ((Axis == 0 ? In[i].X : In[i].Y) - Value);
+            const float Dj = Sign * ((Axis == 0 ? In[j].X : In[j].Y) - Value);
+            const bool bInsideI = Di >= 0.0f;
+            const bool bInsideJ = Dj >= 0.0f;
+            if (bInsideI != bInsideJ && NumOut < MaxClipVerts)
+            {
+                const float T = Dj / (Dj - Di);
+                Out[NumOut++] = In[j] + (In[i] - In[j]) * T;
+            }
+            if (bInsideI && NumOut < MaxClipVerts)
+            {
+                Out[NumOut++] = In[i];
+            }
+        }
+        return NumOut;
+    }
+
+    // 삼각형이 지나가는 셀마다 Z 범위를 구해 Emit(Column, SpanMin, SpanMax) 호출
+    template<typename FuncType>
+    void RasterizeTriangle(const FVector& A, const FVector& B, const FVector& C, int32 OriginX, int32 OriginY, int32 Width,
+        float CellSize, float CellHeight, FuncType&& Emit)
+    {
+        const int32 MinX = FloorToCell(std::min({ A.X, B.X, C.X }), CellSize) - OriginX;
+        const int32 MaxX = FloorToCell(std::max({ A.X, B.X, C.X }), CellSize) - OriginX;
+        const int32 MinY = FloorToCell(std::min({ A.Y, B.Y, C.Y }), CellSize) - OriginY;
+        const int32 MaxY = FloorToCell(std::max({ A.Y, B.Y, C.Y }), CellSize) - OriginY;
+        if (MaxX < 0 || MaxY < 0 || MinX >= Width || MinY >= Width)
+        {
+            return;
+        }
+
+        const FVector Triangle[3] = { A, B, C };
+        FVector Temp[MaxClipVerts];
+        FVector Row[MaxClipVerts];
+        FVector Cell[MaxClipVerts];
+
+        const int32 Y0 = std::max(MinY, 0);
+        const int32 Y1 = std::min(MaxY, Width - 1);
+        for (int32 Y = Y0; Y <= Y1; ++Y)
+        {
+            const float RowMin = (OriginY + Y) * CellSize;
+            int32 NumRow = ClipPolygon(Triangle, 3, Temp, 1, RowMin, true);
+            NumRow = NumRow >= 3 ? ClipPolygon(Temp, NumRow, Row, 1, RowMin + CellSize, false) : 0;
+            if (NumRow < 3)
+            {
+                continue;
+            }
+
+            float RowMinX = Row[0].X;
+            float RowMaxX = Row[0].X;
+            for (int32 i = 1; i < NumRow; ++i)
+            {
+                RowMinX = std::min(RowMinX, Row[i].X);
+                RowMaxX = std::max(RowMaxX, Row[i].X);
+            }
+
+            const int32 X0 = std::max(FloorToCell(RowMinX, CellSize) - OriginX, 0);
+            const int32 X1 = std::min(FloorToCell(RowMaxX, CellSize) - OriginX, Width - 1);
+            for (int32 X = X0; X <= X1; ++X)
+            {
+                const float ColMin = (OriginX + X) * CellSize;
+                int32 NumCell = ClipPolygon(Row, NumRow, Temp, 0, ColMin, true);
+                NumCell = NumCell >= 3 ? ClipPolygon(Temp, NumCell, Cell, 0, ColMin + CellSize, false) : 0;
+                if (NumCell < 3)
+                {
+                    continue;
+                }
+
+                float MinZ = Cell[0].Z;
+                float MaxZ = Cell[0].Z;
+                for (int32 i = 1; i < NumCell; ++i)
+                {
+                    MinZ = std::min(MinZ, Cell[i].Z);
+                    MaxZ = std::max(MaxZ, Cell[i].Z);
+                }
+
+                const int32 SpanMin = static_cast<int32>(std::floor(MinZ / CellHeight));
+                const int32 SpanMax = std::max(SpanMin + 1, static_cast<int32>(std::ceil(MaxZ / CellHeight)));
+                Emit(Y * Width + X, SpanMin, SpanMax);
+            }
+        }
+    }
+
+    // 셀 기둥별 고체 구간 (아래 -> 위 정렬된 연결 리스트)
+    struct FHeightSpan
+    {
+        int32 Min = 0;
+        int32 Max = 0;
+        int32 Next = INDEX_NONE;
+        bool bWalkable = false;
+    };
+
+    struct FHeightfield
+    {
+        int32 Width = 0;
+        TArray<int32> Heads;
+        TArray<FHeightSpan> Pool;
+        int32 FreeList = INDEX_NONE;
+
+        void Init(int32 InWidth)
+        {
+            Width = InWidth;
+            Heads.assign(Width * Width, INDEX_NONE);
+            Pool.Reserve(Width * Width * 2);
+        }
+
+        int32 Alloc()
+        {
+            if (FreeList != INDEX_NONE)
+            {
+                const int32 Index = FreeList;
+                FreeList = Pool[Index].Next;
+                return Index;
+            }
+            Pool.Add(FHeightSpan());
+            return Pool.Num() - 1;
+        }
+
+        void Free(int32 Index)
+        {
+            Pool[Index].Next = FreeList;
+            FreeList = Index;
+        }
+
+        // 겹치는 구간은 합치고, 윗면 높이 차이가 MergeThreshold 이내면 걷기 가능 여부도 합친다
+        void AddSpan(int32 Column, int32 Min, int32 Max, bool bWalkable, int32 MergeThreshold)
+        {
+            int32 Prev = INDEX_NONE;
+            int32 Cur = Heads[Column];
+            while (Cur != INDEX_NONE)
+            {
+                FHeightSpan& Span = Pool[Cur];
+                if (Span.Min > Max)
+                {
+                    break;
+                }
+                if (Span.Max < Min)
+                {
+                    Prev = Cur;
+                    Cur = Span.Next;
+                    continue;
+                }
+
+                Min = std::min(Min, Span.Min);
+                Max = std::max(Max, Span.Max);
+                if (std::abs(Max - Span.Max) <= MergeThreshold)
+                {
+                    bWalkable = bWalkable || Span.bWalkable;
+                }
+
+                const int32 Next = Span.Next;
+                Free(Cur);
+                if (Prev != INDEX_NONE)
+                {
+                    Pool[Prev].Next = Next;
+                }
+                else
+                {
+                    Heads[Column] = Next;
+                }
+                Cur = Next;
+            }
+
+            const int32 NewIndex = Alloc();
+            FHeightSpan& NewSpan = Pool[NewIndex];
+            NewSpan.Min = Min;
+            NewSpan.Max = Max;
+            NewSpan.bWalkable = bWalkable;
+            if (Prev != INDEX_NONE)
+            {
+                NewSpan.Next = Pool[Prev].Next;
+                Pool[Prev].Next = NewIndex;
+            }
+            else
+            {
+                NewSpan.Next = Heads[Column];
+                Heads[Column] = NewIndex;
+            }
+        }
+    };
+
+    // 고체 구간 위의 빈 공간 (바닥 ~ 천장)
+    struct FCompactSpan
+    {
+        int32 Floor = 0;
+        int32 Ceil = 0;
+        int32 Con[4] = { INDEX_NONE, INDEX_NONE, INDEX_NONE, INDEX_NONE };
+        int32 Dist = 0;
+        int32 Poly = INDEX_NONE;
+        bool bWalkable = true;
+    };
+
+    FVector ToVector(const PxVec3& V)
+    {
+        return FVector(V.x, V.y, V.z);
+    }
+}
+
+// ============================================================================
+// FNavGeometry
+// ============================================================================
+
+void FNavGeometry::Reset()
+{
+    Vertices.Empty();
+    Shapes.Empty();
+    OpenShape = INDEX_NONE;
+}
+
+void FNavGeometry::BeginShape(bool bConvex)
+{
+    FShape Shape;
+    Shape.FirstVertex = Vertices.Num();
+    Shape.bConvex = bConvex;
+    Shape.BoundsMin = FVector(FLT_MAX, FLT_MAX, FLT_MAX);
+    Shape.BoundsMax = FVector(-FLT_MAX, -FLT_MAX, -FLT_MAX);
+    Shapes.Add(Shape);
+    OpenShape = Shapes.Num() - 1;
+}
+
+void FNavGeometry::AddTriangle(const FVector& A, const FVector& B, const FVector& C)
+{
+    FShape& Shape = Shapes[OpenShape];
+    Vertices.Add(A);
+    Vertices.Add(B);
+    Vertices.Add(C);
+    Shape.BoundsMin = Shape.BoundsMin.ComponentMin(A).ComponentMin(B).ComponentMin(C);
+    Shape.BoundsMax = Shape.BoundsMax.ComponentMax(A).ComponentMax(B).ComponentMax(C);
+    ++Shape.NumTriangles;
+}
+
+void FNavGeometry::EndShape()
+{
+    FShape& Shape = Shapes[OpenShape];
+    OpenShape = INDEX_NONE;
+    if (Shape.NumTriangles == 0)
+    {
+        Shapes.pop_back();
+        return;
+    }
+
+    uint64 Hash = HashCombine(0, Shape.bConvex ? 1 : 0);
+    const uint32* Words = reinterpret_cast<const uint32*>(&Vertices[Shape.FirstVertex]);
+    const int32 NumWords = Shape.NumTriangles * 3 * static_cast<int32>(sizeof(FVector) / sizeof(uint32));
+    for (int32 i = 0; i < NumWords; ++i)
+    {
+        Hash = HashCombine(Hash, Words[i]);
+    }
+    Shape.Hash = Hash;
+}
+
+void FNavGeometry::AddBox(const FVector& Center, const FVector& HalfExtent, const FQuat& Rotation)
+{
+    FVector Corners[8];
+    for (int32 i = 0; i < 8; ++i)
+    {
+        const FVector Local(
+            (i & 1) ? HalfExtent.X : -HalfExtent.X,
+            (i & 2) ? HalfExtent.Y : -HalfExtent.Y,
+            (i & 4) ? HalfExtent.Z : -HalfExtent.Z);
+        Corners[i] = Center + Rotation.RotateVector(Local);
+    }
+
+    static constexpr int32 Faces[6][4] = {
+        { 0, 2, 6, 4 }, { 1, 5, 7, 3 },     // -X, +X
+        { 0, 4, 5, 1 }, { 2, 3, 7, 6 },     // -Y, +Y
+        { 0, 1, 3, 2 }, { 4, 6, 7, 5 }      // -Z, +Z
+    };
+
+    BeginShape(true);
+    for (const auto& Face : Faces)
+    {
+        AddTriangle(Corners[Face[0]], Corners[Face[1]], Corners[Face[2]]);
+        AddTriangle(Corners[Face[0]], Corners[Face[2]], Corners[Face[3]]);
+    }
+    EndShape();
+}
+
+// ============================================================================
+// FNavMeshBuilder
+// ============================================================================
+
+void FNavMeshBuilder::GatherStaticGeometry(FPhysScene* PhysScene, FNavGeometry& OutGeometry)
+{
+    OutGeometry.Reset();
+
+    PxScene* Scene = PhysScene ? PhysScene->GetScene() : nullptr;
+    if (!Scene)
+    {
+        return;
+    }
+
+    SCOPED_PHYSX_READ_LOCK(*Scene);
+
+    const PxU32 NumActors = Scene->getNbActors(PxActorTypeFlag::eRIGID_STATIC);
+    TArray<PxActor*> Actors;
+    Actors.SetNum(NumActors);
+    Scene->getActors(PxActorTypeFlag::eRIGID_STATIC, Actors.data(), NumActors);
+
+    TArray<PxShape*> Shapes;
+    for (PxActor* Actor : Actors)
+    {
+        PxRigidActor* RigidActor = Actor->is<PxRigidActor>();
+        if (!RigidActor)
+        {
+            continue;
+        }
+
+        Shapes.SetNum(RigidActor->getNbShapes());
+        RigidActor->getShapes(Shapes.data(), static_cast<PxU32>(Shapes.Num()));
+
+        for (PxShape* Shape : Shapes)
+        {
+            // 트리거는 지나갈 수 있으므로 장애물이 아님
+            if (Shape->getFlags().isSet(PxShapeFlag::eTRIGGER_SHAPE))
+            {
+                continue;
+            }
+
+            const PxTransform Pose = PxShapeExt::getGlobalPose(*Shape, *RigidActor);
+            switch (Shape->getGeometryType())
+            {
+            case PxGeometryType::eBOX:
+            {
+                PxBoxGeometry Box;
+                Shape->getBoxGeometry(Box);
+                OutGeometry.AddBox(ToVector(Pose.p), ToVector(Box.halfExtents), FQuat(Pose.q.x, Pose.q.y, Pose.q.z, Pose.q.w));
+                break;
+            }
+            case PxGeometryType::eSPHERE:
+            case PxGeometryType::eCAPSULE:
+            {
+                const PxBounds3 Bounds = PxShapeExt::getWorldBounds(*Shape, *RigidActor, 1.0f);
+                OutGeometry.AddBox(ToVector(Bounds.getCenter()), ToVector(Bounds.getExtents()), FQuat::Identity());
+                break;
+            }
+            case PxGeometryType::eCONVEXMESH:
+            {
+                PxConvexMeshGeometry Geom;
+                Shape->getConvexMeshGeometry(Geom);
+                const PxConvexMesh* Mesh = Geom.convexMesh;
+                if (!Mesh)
+                {
+                    break;
+                }
+
+                const PxMat33 Scale = Geom.scale.toMat33();
+                const PxVec3* MeshVertices = Mesh->getVertices();
+                const PxU8* IndexBuffer = Mesh->getIndexBuffer();
+                auto ToWorld = [&](PxU32 Index) { return ToVector(Pose.transform(Scale * MeshVertices[Index])); };
+
+                OutGeometry.BeginShape(true);
+                for (PxU32 PolyIndex = 0; PolyIndex < Mesh->getNbPolygons(); ++PolyIndex)
+                {
+                    PxHullPolygon Polygon;
+                    Mesh->getPolygonData(PolyIndex, Polygon);
+                    const FVector First = ToWorld(IndexBuffer[Polygon.mIndexBase]);
+                    for (PxU32 k = 1; k + 1 < Polygon.mNbVerts; ++k)
+                    {
+                        OutGeometry.AddTriangle(First, ToWorld(IndexBuffer[Polygon.mIndexBase + k]), ToWorld(IndexBuffer[Polygon.mIndexBase + k + 1]));
+                    }
+                }
+                OutGeometry.EndShape();
+                break;
+            }
+            case PxGeometryType::eTRIANGLEMESH:
+            {
+                PxTriangleMeshGeometry Geom;
+                Shape->getTriangleMeshGeometry(Geom);
+                const PxTriangleMesh* Mesh = Geom.triangleMesh;
+                if (!Mesh)
+                {
+                    break;
+                }
+
+                const PxMat33 Scale = Geom.scale.toMat33();
+                const PxVec3* MeshVertices = Mesh->getVertices();
+                const void* Triangles = Mesh->getTriangles();
+                const bool b16BitIndices = Mesh->getTriangleMeshFlags().isSet(PxTriangleMeshFlag::e16_BIT_INDICES);
+                auto GetIndex = [&](PxU32 i) -> PxU32
+                {
+                    return b16BitIndices ? static_cast<const PxU16*>(Triangles)[i] : static_cast<const PxU32*>(Triangles)[i];
+                };
+                auto ToWorld = [&](PxU32 Index) { return ToVector(Pose.transform(Scale * MeshVertices[Index])); };
+
+                OutGeometry.BeginShape(false);
+                for (PxU32 Tri = 0; Tri < Mesh->getNbTriangles(); ++Tri)
+                {
+                    OutGeometry.AddTriangle(ToWorld(GetIndex(Tri * 3)), ToWorld(GetIndex(Tri * 3 + 1)), ToWorld(GetIndex(Tri * 3 + 2)));
+                }
+                OutGeometry.EndShape();
+                break;
+            }
+            default:
+                // 무한 평면/높이필드는 지원하지 않음
+                break;
+            }
+        }
+    }
+}
+
+const FNavMeshBuildStats& FNavMeshBuilder::Build(const FNavMeshConfig& Config, const FNavGeometry& Geometry, FNavMesh& OutNavMesh)
+{
+    const uint64 StartCycles = FPlatformTime::Cycles64();
+
+    LastStats = FNavMeshBuildStats();
+    LastStats.NumShapes = Geometry.Shapes.Num();
+
+    struct FTileJob
+    {
+        int32 TileX = 0;
+        int32 TileY = 0;
+        TArray<int32> ShapeIndices;
+        uint64 Hash = 0;
+        std::shared_ptr<const FNavMeshTileData> Result;
+    };
+
+    // 셰이프를 (경계 영역 포함) 겹치는 타일에 나눠 담는다
+    const float TileWorldSize = Config.GetTileWorldSize();
+    const float BorderWorldSize = Config.GetBorderCells() * Config.CellSize;
+
+    TArray<FTileJob> Jobs;
+    TMap<uint64, int32> JobIndexByKey;
+    for (int32 ShapeIndex = 0; ShapeIndex < Geometry.Shapes.Num(); ++ShapeIndex)
+    {
+        const FNavGeometry::FShape& Shape = Geometry.Shapes[ShapeIndex];
+        const int32 TileX0 = FloorToCell(Shape.BoundsMin.X - BorderWorldSize, TileWorldSize);
+        const int32 TileY0 = FloorToCell(Shape.BoundsMin.Y - BorderWorldSize, TileWorldSize);
+        const int32 TileX1 = FloorToCell(Shape.BoundsMax.X + BorderWorldSize, TileWorldSize);
+        const int32 TileY1 = FloorToCell(Shape.BoundsMax.Y + BorderWorldSize, TileWorldSize);
+
+        for (int32 TileY = TileY0; TileY <= TileY1; ++TileY)
+        {
+            for (int32 TileX = TileX0; TileX <= TileX1; ++TileX)
+            {
+                const uint64 Key = MakeTileKey(TileX, TileY);
+                int32* JobIndex = JobIndexByKey.Find(Key);
+                if (!JobIndex)
+                {
+                    FTileJob Job;
+                    Job.TileX = TileX;
+                    Job.TileY = TileY;
+                    Jobs.push_back(std::move(Job));
+                    JobIndexByKey.Add(Key, Jobs.Num() - 1);
+                    JobIndex = JobIndexByKey.Find(Key);
+                }
+                Jobs[*JobIndex].ShapeIndices.Add(ShapeIndex);
+            }
+        }
+    }
+
+    // 캐시 키: 셰이프 해시 합(순서 무관) + 타일 좌표 + 설정
+    const uint64 ConfigHash = Config.GetHash();
+    TArray<int32> JobsToBuild;
+    for (int32 JobIndex = 0; JobIndex < Jobs.Num(); ++JobIndex)
+    {
+        FTileJob& Job = Jobs[JobIndex];
+        uint64 ShapeHashSum = 0;
+        for (int32 ShapeIndex : Job.ShapeIndices)
+        {
+            ShapeHashSum += HashCombine(Geometry.Shapes[ShapeIndex].Hash, 0);
+        }
+        Job.Hash = HashCombine(HashCombine(ConfigHash, MakeTileKey(Job.TileX, Job.TileY)), ShapeHashSum);
+
+        if (const std::shared_ptr<const FNavMeshTileData>* Cached = TileCache.Find(Job.Hash))
+        {
+            Job.Result = *Cached;
+            ++LastStats.CachedTiles;
+        }
+        else
+        {
+            JobsToBuild.Add(JobIndex);
+        }
+    }
+
+    FTaskPool::Get().ParallelFor(JobsToBuild.Num(), 1, [&](int32 Begin, int32 End)
+    {
+        for (int32 i = Begin; i < End; ++i)
+        {
+            FTileJob& Job = Jobs[JobsToBuild[i]];
+            std::shared_ptr<FNavMeshTileData> Tile = BuildTile(Config, Geometry, Job.ShapeIndices, Job.TileX, Job.TileY);
+            Tile->BuildHash = Job.Hash;
+            Job.Result = std::move(Tile);
+        }
+    });
+    LastStats.BuiltTiles = JobsToBuild.Num();
+
+    // 오래된 캐시가 너무 커지면 이번 빌드에서 쓴 타일만 남긴다
+    if (TileCache.Num() + JobsToBuild.Num() > MaxCachedTiles)
+    {
+        TileCache.Empty();
+    }
+
+    TArray<std::shared_ptr<const FNavMeshTileData>> Tiles;
+    Tiles.Reserve(Jobs.Num());
+    for (FTileJob& Job : Jobs)
+    {
+        TileCache[Job.Hash] = Job.Result;
+        if (!Job.Result->Polys.IsEmpty())
+        {
+            Tiles.Add(Job.Result);
+        }
+    }
+
+    OutNavMesh.SetTiles(Config, std::move(Tiles));
+
+    LastStats.NumTiles = OutNavMesh.GetNumTiles();
+    LastStats.NumPolys = OutNavMesh.GetNumPolys();
+    LastStats.NumLinks = OutNavMesh.GetNumLinks();
+    LastStats.BuildMs = FPlatformTime::ToMilliseconds(FPlatformTime::Cycles64() - StartCycles);
+    return LastStats;
+}
+
+std::shared_ptr<FNavMeshTileData> FNavMeshBuilder::BuildTile(const FNavMeshConfig& Config, const FNavGeometry& Geometry, const TArray<int32>& ShapeIndices, int32 TileX, int32 TileY)
+{
+    const int32 TileSize = Config.TileSizeCells;
+    const int32 Border = Config.GetBorderCells();
+    const int32 Width = TileSize + Border * 2;
+    const int32 NumColumns = Width * Width;
+    const int32 OriginX = TileX * TileSize - Border;
+    const int32 OriginY = TileY * TileSize - Border;
+    const float CellSize = Config.CellSize;
+    const float CellHeight = Config.CellHeight;
+    const int32 ClimbCells = Config.GetClimbCells();
+    const int32 HeightCells = Config.GetHeightCells();
+    const float WalkableNormalZ = std::cos(DegreesToRadians(Config.AgentMaxSlope));
+
+    // 1. 래스터화
+    FHeightfield Heightfield;
+    Heightfield.Init(Width);
+
+    TArray<int32> ConvexMin;
+    TArray<int32> ConvexMax;
+    TArray<uint8> ConvexTopWalkable;
+    TArray<int32> ConvexTouched;
+    ConvexMin.assign(NumColumns, std::numeric_limits<int32>::max());
+    ConvexMax.assign(NumColumns, std::numeric_limits<int32>::min());
+    ConvexTopWalkable.assign(NumColumns, 0);
+
+    for (int32 ShapeIndex : ShapeIndices)
+    {
+        const FNavGeometry::FShape& Shape = Geometry.Shapes[ShapeIndex];
+        for (int32 Tri = 0; Tri < Shape.NumTriangles; ++Tri)
+        {
+            const FVector& A = Geometry.Vertices[Shape.FirstVertex + Tri * 3];
+            const FVector& B = Geometry.Vertices[Shape.FirstVertex + Tri * 3 + 1];
+            const FVector& C = Geometry.Vertices[Shape.FirstVertex + Tri * 3 + 2];
+
+            const FVector Normal = FVector::Cross(B - A, C - A);
+            const float Length = Normal.Size();
+            const bool bWalkable = Length > KINDA_SMALL_NUMBER && std::fabs(Normal.Z) / Length >= WalkableNormalZ;
+
+            if (Shape.bConvex)
+            {
+                // Convex는 기둥마다 [최저, 최고]를 모았다가 하나의 꽉 찬 구간으로 넣는다
+                RasterizeTriangle(A, B, C, OriginX, OriginY, Width, CellSize, CellHeight, [&](int32 Column, int32 SpanMin, int32 SpanMax)
+                {
+                    if (ConvexMax[Column] == std::numeric_limits<int32>::min())
+                    {
+                        ConvexTouched.Add(Column);
+                    }
+                    ConvexMin[Column] = std::min(ConvexMin[Column], SpanMin);
+                    if (SpanMax > ConvexMax[Column])
+                    {
+                        ConvexMax[Column] = SpanMax;
+                        ConvexTopWalkable[Column] = bWalkable ? 1 : 0;
+                    }
+                    else if (SpanMax == ConvexMax[Column] && bWalkable)
+                    {
+                        ConvexTopWalkable[Column] = 1;
+                    }
+                });
+            }
+            else
+            {
+                RasterizeTriangle(A, B, C, OriginX, OriginY, Width, CellSize, CellHeight, [&](int32 Column, int32 SpanMin, int32 SpanMax)
+                {
+                    Heightfield.AddSpan(Column, SpanMin, SpanMax, bWalkable, ClimbCells);
+                });
+            }
+        }
+
+        if (Shape.bConvex)
+        {
+            for (int32 Column : ConvexTouched)
+            {
+                Heightfield.AddSpan(Column, ConvexMin[Column], ConvexMax[Column], ConvexTopWalkable[Column] != 0, ClimbCells);
+                ConvexMin[Column] = std::numeric_limits<int32>::max();
+                ConvexMax[Column] = std::numeric_limits<int32>::min();
+                ConvexTopWalkable[Column] = 0;
+            }
+            ConvexTouched.Empty();
+        }
+    }
+
+    // 2. 필터: 걷기 가능한 면 바로 위의 낮은 장애물(연석/계단)은 올라설 수 있고, 머리 위 공간이 부족하면 걸을 수 없다
+    for (int32 Column = 0; Column < NumColumns; ++Column)
+    {
+        bool bPrevWalkable = false;
+        int32 PrevMax = 0;
+        for (int32 Index = Heightfield.Heads[Column]; Index != INDEX_NONE; Index = Heightfield.Pool[Index].Next)
+        {
+            FHeightSpan& Span = Heightfield.Pool[Index];
+            const bool bWalkable = Span.bWalkable;
+            if (!bWalkable && bPrevWalkable && Span.Max - PrevMax <= ClimbCells)
+            {
+                Span.bWalkable = true;
+            }
+            bPrevWalkable = bWalkable;
+            PrevMax = Span.Max;
+        }
+
+        for (int32 Index = Heightfield.Heads[Column]; Index != INDEX_NONE; Index = Heightfield.Pool[Index].Next)
+        {
+            FHeightSpan& Span = Heightfield.Pool[Index];
+            const int32 Ceil = (Span.Next != INDEX_NONE) ? Heightfield.Pool[Span.Next].Min : MaxSpanHeight;
+            if (Ceil - Span.Max < HeightCells)
+            {
+                Span.bWalkable = false;
+            }
+        }
+    }
+
+    // 3. 걷기 가능한 바닥과 이웃 연결
+    TArray<int32> CellStart;
+    TArray<FCompactSpan> CompactSpans;
+    CellStart.SetNum(NumColumns + 1);
+    CompactSpans.Reserve(NumColumns);
+    for (int32 Column = 0; Column < NumColumns; ++Column)
+    {
+        CellStart[Column] = CompactSpans.Num();
+        for (int32 Index = Heightfield.Heads[Column]; Index != INDEX_NONE; Index = Heightfield.Pool[Index].Next)
+        {
+            const FHeightSpan& Span = Heightfield.Pool[Index];
+            if (Span.bWalkable)
+            {
+                FCompactSpan Compact;
+                Compact.Floor = Span.Max;
+                Compact.Ceil = (Span.Next != INDEX_NONE) ? Heightfield.Pool[Span.Next].Min : MaxSpanHeight;
+                CompactSpans.Add(Compact);
+            }
+        }
+    }
+    CellStart[NumColumns] = CompactSpans.Num();
+
+    for (int32 Y = 0; Y < Width; ++Y)
+    {
+        for (int32 X = 0; X < Width; ++X)
+        {
+            const int32 Column = Y * Width + X;
+            for (int32 i = CellStart[Column]; i < CellStart[Column + 1]; ++i)
+            {
+                FCompactSpan& Span = CompactSpans[i];
+                for (int32 Dir = 0; Dir < 4; ++Dir)
+                {
+                    const int32 NX = X + NavDirection::OffsetX[Dir];
+                    const int32 NY = Y + NavDirection::OffsetY[Dir];
+                    if (NX < 0 || NY < 0 || NX >= Width || NY >= Width)
+                    {
+                        continue;
+                    }
+
+                    const int32 NeighborColumn = NY * Width + NX;
+                    for (int32 j = CellStart[NeighborColumn]; j < CellStart[NeighborColumn + 1]; ++j)
+                    {
+                        const FCompactSpan& Other = CompactSpans[j];
+                        const int32 Bottom = std::max(Span.Floor, Other.Floor);
+                        const int32 Top = std::min(Span.Ceil, Other.Ceil);
+                        if (Top - Bottom >= HeightCells && std::abs(Other.Floor - Span.Floor) <= ClimbCells)
+                        {
+                            Span.Con[Dir] = j;
+                            break;
+                        }
+                    }
+                }
+            }
+        }
+    }
+
+    // 4. 에이전트 반경만큼 침식 (Chamfer 3-4 근사: 직선 2, 대각 3)
+    for (FCompactSpan& Span : CompactSpans)
+    {
+        const bool bBoundary = Span.Con[0] == INDEX_NONE || Span.Con[1] == INDEX_NONE || Span.Con[2] == INDEX_NONE || Span.Con[3] == INDEX_NONE;
+        Span.Dist = bBoundary ? 0 : MaxChamferDist;
+    }
+
+    auto Relax = [&](FCompactSpan& Span, int32 Dir, int32 DiagonalDir)
+    {
+        const int32 Neighbor = Span.Con[Dir];
+        if (Neighbor == INDEX_NONE)
+        {
+            return;
+        }
+        Span.Dist = std::min(Span.Dist, CompactSpans[Neighbor].Dist + 2);
+        const int32 Diagonal = CompactSpans[Neighbor].Con[DiagonalDir];
+        if (Diagonal != INDEX_NONE)
+        {
+            Span.Dist = std::min(Span.Dist, CompactSpans[Diagonal].Dist + 3);
+        }
+    };
+
+    for (int32 Y = 0; Y < Width; ++Y)
+    {
+        for (int32 X = 0; X < Width; ++X)
+        {
+            const int32 Column = Y * Width + X;
+            for (int32 i = CellStart[Column]; i < CellStart[Column + 1]; ++i)
+            {
+                Relax(CompactSpans[i], 0, 3);   // (-1, 0), (-1, -1)
+                Relax(CompactSpans[i], 3, 2);   // (0, -1), (1, -1)
+            }
+        }
+    }
+    for (int32 Y = Width - 1; Y >= 0; --Y)
+    {
+        for (int32 X = Width - 1; X >= 0; --X)
+        {
+            const int32 Column = Y * Width + X;
+            for (int32 i = CellStart[Column]; i < CellStart[Column + 1]; ++i)
+            {
+                Relax(CompactSpans[i], 2, 1);   // (1, 0), (1, 1)
+                Relax(CompactSpans[i], 1, 0);   // (0, 1), (-1, 1)
+            }
+        }
+    }
+
+    const int32 ErodeThreshold = Config.GetErodeCells() * 2;
+    for (FCompactSpan& Span : CompactSpans)
+    {
+        Span.bWalkable = Span.Dist >= ErodeThreshold;
+    }
+
+    // 5. 코어 영역에서 같은 층으로 이어진 셀을 사각형으로 병합
+    std::shared_ptr<FNavMeshTileData> Tile = std::make_shared<FNavMeshTileData>();
+    Tile->TileX = TileX;
+    Tile->TileY = TileY;
+
+    auto IsFree = [&](int32 Index)
+    {
+        return Index != INDEX_NONE && CompactSpans[Index].bWalkable && CompactSpans[Index].Poly == INDEX_NONE;
+    };
+
+    const int32 CoreMin = Border;
+    const int32 CoreMax = Border + TileSize - 1;
+    const int32 MaxPolyCells = std::max(1, Config.MaxPolyCells);
+    TArray<int32> RowSpans;
+    TArray<int32> NextRowSpans;
+
+    for (int32 Y = CoreMin; Y <= CoreMax; ++Y)
+    {
+        for (int32 X = CoreMin; X <= CoreMax; ++X)
+        {
+            const int32 Column = Y * Width + X;
+            for (int32 i = CellStart[Column]; i < CellStart[Column + 1]; ++i)
+            {
+                if (!IsFree(i))
+                {
+                    continue;
+                }
+
+                const int32 PolyIndex = Tile->Polys.Num();
+                FNavTilePoly Poly;
+                Poly.MinFloor = Poly.MaxFloor = CompactSpans[i].Floor;
+
+                // 가로로 늘린다
+                RowSpans.Empty();
+                RowSpans.Add(i);
+                int32 MaxX = X;
+                while (MaxX < CoreMax && MaxX - X + 1 < MaxPolyCells)
+                {
+                    const int32 Next = CompactSpans[RowSpans.Last()].Con[2];
+                    if (!IsFree(Next))
+                    {
+                        break;
+                    }
+                    RowSpans.Add(Next);
+                    ++MaxX;
+                }
+
+                auto AssignRow = [&](const TArray<int32>& Row)
+                {
+                    for (int32 Index : Row)
+                    {
+                        CompactSpans[Index].Poly = PolyIndex;
+                        Poly.MinFloor = std::min(Poly.MinFloor, CompactSpans[Index].Floor);
+                        Poly.MaxFloor = std::max(Poly.MaxFloor, CompactSpans[Index].Floor);
+                    }
+                };
+                AssignRow(RowSpans);
+
+                // 윗줄 전체가 이어지는 동안 세로로 늘린다
+                int32 MaxY = Y;
+                while (MaxY < CoreMax && MaxY - Y + 1 < MaxPolyCells)
+                {
+                    NextRowSpans.Empty();
+                    bool bRowValid = true;
+                    for (int32 k = 0; k < RowSpans.Num(); ++k)
+                    {
+                        const int32 Up = CompactSpans[RowSpans[k]].Con[1];
+                        if (!IsFree(Up) || (k > 0 && CompactSpans[NextRowSpans[k - 1]].Con[2] != Up))
+                        {
+                            bRowValid = false;
+                            break;
+                        }
+                        NextRowSpans.Add(Up);
+                    }
+                    if (!bRowValid)
+                    {
+                        break;
+                    }
+                    AssignRow(NextRowSpans);
+                    std::swap(RowSpans, NextRowSpans);
+                    ++MaxY;
+                }
+
+                Poly.MinX = X - Border;
+                Poly.MinY = Y - Border;
+                Poly.MaxX = MaxX - Border;
+                Poly.MaxY = MaxY - Border;
+                Tile->Polys.Add(Poly);
+            }
+        }
+    }
+
+    // 6. 코어 셀의 바닥만 내보낸다 (이웃 바닥 높이는 타일 경계를 넘는 링크에 사용)
+    Tile->CellSpanStart.SetNum(TileSize * TileSize + 1);
+    for (int32 LocalY = 0; LocalY < TileSize; ++LocalY)
+    {
+        for (int32 LocalX = 0; LocalX < TileSize; ++LocalX)
+        {
+            Tile->CellSpanStart[LocalY * TileSize + LocalX] = Tile->Spans.Num();
+            const int32 Column = (LocalY + Border) * Width + (LocalX + Border);
+            for (int32 i = CellStart[Column]; i < CellStart[Column + 1]; ++i)
+            {
+                const FCompactSpan& Span = CompactSpans[i];
+                if (!Span.bWalkable)
+                {
+                    continue;
+                }
+
+                FNavTileSpan TileSpan;
+                TileSpan.Floor = Span.Floor;
+                TileSpan.Poly = Span.Poly;
+                for (int32 Dir = 0; Dir < 4; ++Dir)
+                {
+                    const int32 Neighbor = Span.Con[Dir];
+                    if (Neighbor != INDEX_NONE && CompactSpans[Neighbor].bWalkable)
+                    {
+                        TileSpan.NeighborFloor[Dir] = CompactSpans[Neighbor].Floor;
+                    }
+                }
+                Tile->Spans.Add(TileSpan);
+            }
+        }
+    }
+    Tile->CellSpanStart[TileSize * TileSize] = Tile->Spans.Num();
+
+    return Tile;
+}
@@ -0,0 +1,79 @@
+﻿#pragma once
+#include "NavMesh.h"
+
+class FPhysScene;
+
+/**
+ * 내비메시 입력 지오메트리 (월드 좌표 삼각형 목록, 콜리전 셰이프 단위로 묶음)
+ * - Convex 셰이프는 셀 기둥마다 하나의 꽉 찬 구간으로 래스터화한다 (박스 내부 빈 공간을 바닥으로 잡지 않음)
+ * - 셰이프 해시는 정점 값으로 만들며, 타일 캐시 키에 들어간다
+ */
+struct FNavGeometry
+{
+    struct FShape
+    {
+        int32 FirstVertex = 0;
+        int32 NumTriangles = 0;
+        bool bConvex = false;
+        FVector BoundsMin;
+        FVector BoundsMax;
+        uint64 Hash = 0;
+    };
+
+    TArray<FVector> Vertices;   // 삼각형마다 정점 3개
+    TArray<FShape> Shapes;
+
+    void Reset();
+    void BeginShape(bool bConvex);
+    void AddTriangle(const FVector& A, const FVector& B, const FVector& C);
+    void EndShape();
+
+    void AddBox(const FVector& Center, const FVector& HalfExtent, const FQuat& Rotation);
+
+private:
+    int32 OpenShape = INDEX_NONE;
+};
+
+struct FNavMeshBuildStats
+{
+    int32 NumShapes = 0;
+    int32 NumTiles = 0;
+    int32 BuiltTiles = 0;       // 이번 빌드에서 새로 래스터화한 타일
+    int32 CachedTiles = 0;      // 캐시에서 재사용한 타일
+    int32 NumPolys = 0;
+    int32 NumLinks = 0;
+    double GatherMs = 0.0;
+    double BuildMs = 0.0;
+};
+
+/**
+ * 복셀화 기반 내비메시 빌더 (Recast 방식 단순화)
+ * 1. 타일 + 경계 영역의 삼각형을 높이필드(셀 기둥별 고체 구간)로 래스터화
+ * 2. 낮은 장애물 통과/머리 위 공간 부족 필터 후 걷기 가능한 바닥과 이웃 연결 생성
+ * 3. 에이전트 반경만큼 침식(Chamfer 거리)
+ * 4. 같은 층에서 연결된 셀을 탐욕적으로 사각형 폴리곤으로 병합
+ * - 타일은 (좌표, 겹치는 셰이프 해시, 설정) 해시로 캐시해서 바뀐 타일만 다시 빌드한다
+ * - 빌드할 타일은 FTaskPool 워커에 나눠서 병렬로 처리한다
+ */
+class FNavMeshBuilder
+{
+public:
+    // PhysX 씬의 Static 바디 콜리전을 삼각형으로 수집 (구/캡슐은 월드 AABB 박스로 근사, 무한 평면은 제외)
+    static void GatherStaticGeometry(FPhysScene* PhysScene, FNavGeometry& OutGeometry);
+
+    // 지오메트리가 바뀐 타일만 새로 빌드하고 OutNavMesh를 교체한다
+    const FNavMeshBuildStats& Build(const FNavMeshConfig& Config, const FNavGeometry& Geometry, FNavMesh& OutNavMesh);
+
+    void ClearCache() { TileCache.Empty(); }
+    int32 GetNumCachedTiles() const { return TileCache.Num(); }
+    const FNavMeshBuildStats& GetLastStats() const { return LastStats; }
+
+    static constexpr int32 MaxCachedTiles = 4096;
+
+private:
+    static std::shared_ptr<FNavMeshTileData> BuildTile(const FNavMeshConfig& Config, const FNavGeometry& Geometry, const TArray<int32>& ShapeIndices, int32 TileX, int32 TileY);
+
+private:
+    TMap<uint64, std::shared_ptr<const FNavMeshTileData>> TileCache;
+    FNavMeshBuildStats LastStats;
+};
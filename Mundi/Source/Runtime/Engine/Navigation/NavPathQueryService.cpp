@@ -0,0 +1,432 @@
+﻿#include "pch.h"
+#include "NavPathQueryService.h"
+#include "PlatformTime.h"
+#include "Source/Runtime/Core/Async/TaskPool.h"
+
+FNavPathQueryService::FNavPathQueryService(const FNavMesh& InNavMesh)
+    : NavMesh(InNavMesh)
+{
+}
+
+FNavPathQueryService::~FNavPathQueryService() = default;
+
+FNavPathHandle FNavPathQueryService::RequestPath(const FVector& Start, const FVector& End, const FNavPath* PreviousPath)
+{
+    FQuery Query;
+    Query.Id = ++NextId;
+    Query.Start = Start;
+    Query.End = End;
+    ++Stats.TotalRequests;
+
+    // 통로 재사용은 폴리곤 두 개만 찾으면 되므로 요청 시점에 바로 처리한다
+    if (bCorridorReuse && PreviousPath && TryReuseCorridor(*PreviousPath, Query))
+    {
+        Query.Status = ENavPathStatus::Succeeded;
+        ++Stats.TotalReused;
+    }
+    else
+    {
+        PendingQueue.Add(Query.Id);
+    }
+
+    const uint32 Id = Query.Id;
+    Queries.emplace(Id, std::move(Query));
+    return FNavPathHandle{ Id };
+}
+
+ENavPathStatus FNavPathQueryService::GetPathStatus(FNavPathHandle Handle) const
+{
+    const FQuery* Query = FindQuery(Handle.Id);
+    return Query ? Query->Status : ENavPathStatus::Invalid;
+}
+
+bool FNavPathQueryService::ConsumePath(FNavPathHandle Handle, FNavPath& OutPath)
+{
+    FQuery* Query = FindQuery(Handle.Id);
+    if (!Query || (Query->Status != ENavPathStatus::Succeeded && Query->Status != ENavPathStatus::Failed))
+    {
+        return false;
+    }
+
+    const bool bSucceeded = Query->Status == ENavPathStatus::Succeeded;
+    OutPath = std::move(Query->Result);
+    Queries.Remove(Handle.Id);
+    return bSucceeded;
+}
+
+void FNavPathQueryService::CancelPath(FNavPathHandle Handle)
+{
+    FQuery* Query = FindQuery(Handle.Id);
+    if (!Query)
+    {
+        return;
+    }
+
+    // 대기열/활성 목록의 Id는 다음 Tick에서 쿼리가 없으면 건너뛴다
+    ReleaseContext(*Query);
+    Queries.Remove(Handle.Id);
+}
+
+void FNavPathQueryService::Tick()
+{
+    const uint64 StartCycles = FPlatformTime::Cycles64();
+
+    // 1. 취소된 쿼리를 정리하고 빈 컨텍스트 수만큼 대기열에서 활성화
+    for (int32 i = 0; i < ActiveQueries.Num();)
+    {
+        if (!FindQuery(ActiveQueries[i]))
+        {
+            ActiveQueries.RemoveAtSwap(i);
+            continue;
+        }
+        ++i;
+    }
+
+    while (Contexts.Num() < MaxActiveQueries)
+    {
+        Contexts.push_back(std::make_unique<FSearchContext>());
+        FreeContexts.Add(Contexts.Num() - 1);
+    }
+
+    int32 NumActivated = 0;
+    while (NumActivated < PendingQueue.Num() && !FreeContexts.IsEmpty())
+    {
+        FQuery* Query = FindQuery(PendingQueue[NumActivated++]);
+        if (!Query || Query->Status != ENavPathStatus::Pending)
+        {
+            continue;
+        }
+
+        Query->ContextIndex = FreeContexts.Last();
+        FreeContexts.pop_back();
+        Query->Status = ENavPathStatus::InProgress;
+        Query->StartPoly = INDEX_NONE;
+        ActiveQueries.Add(Query->Id);
+    }
+    PendingQueue.erase(PendingQueue.begin(), PendingQueue.begin() + NumActivated);
+
+    // 2. 활성 쿼리를 워커에 나눠 정해진 확장 수만큼 진행 (내비메시는 읽기 전용, 컨텍스트는 쿼리마다 별도)
+    TickScratch.Empty();
+    for (uint32 Id : ActiveQueries)
+    {
+        TickScratch.Add(FindQuery(Id));
+    }
+
+    auto StepRange = [this](int32 Begin, int32 End)
+    {
+        for (int32 i = Begin; i < End; ++i)
+        {
+            FQuery& Query = *TickScratch[i];
+            FSearchContext& Context = *Contexts[Query.ContextIndex];
+            if (Query.StartPoly == INDEX_NONE)
+            {
+                BeginSearch(Query, Context);
+            }
+            if (Query.Status == ENavPathStatus::InProgress)
+            {
+                StepSearch(Query, Context);
+            }
+        }
+    };
+
+    if (bParallel)
+    {
+        FTaskPool::Get().ParallelFor(TickScratch.Num(), 1, StepRange);
+    }
+    else
+    {
+        StepRange(0, TickScratch.Num());
+    }
+
+    // 3. 끝난 쿼리의 컨텍스트 반납 및 통계
+    Stats.LastTickActive = TickScratch.Num();
+    Stats.LastTickCompleted = 0;
+    Stats.LastTickIterations = 0;
+    for (FQuery* Query : TickScratch)
+    {
+        Stats.LastTickIterations += Query->TickIterations;
+        if (Query->Status == ENavPathStatus::InProgress)
+        {
+            continue;
+        }
+
+        ++Stats.LastTickCompleted;
+        if (Query->Status == ENavPathStatus::Failed)
+        {
+            ++Stats.TotalFailed;
+        }
+        else
+        {
+            ++Stats.TotalSearched;
+            Stats.TotalPartial += Query->Result.bPartial ? 1 : 0;
+        }
+        ReleaseContext(*Query);
+    }
+
+    for (int32 i = 0; i < ActiveQueries.Num();)
+    {
+        const FQuery* Query = FindQuery(ActiveQueries[i]);
+        if (!Query || Query->Status != ENavPathStatus::InProgress)
+        {
+            ActiveQueries.RemoveAtSwap(i);
+            continue;
+        }
+        ++i;
+    }
+
+    Stats.PendingQueries = PendingQueue.Num();
+    Stats.LastTickMs = FPlatformTime::ToMilliseconds(FPlatformTime::Cycles64() - StartCycles);
+}
+
+void FNavPathQueryService::InvalidateAll()
+{
+    // 진행 중인 탐색은 폴리곤 인덱스가 바뀌었으므로 대기열 앞으로 되돌려 처음부터 다시 한다
+    TArray<uint32> Restarted;
+    for (uint32 Id : ActiveQueries)
+    {
+        if (FQuery* Query = FindQuery(Id))
+        {
+            ReleaseContext(*Query);
+            Query->Status = ENavPathStatus::Pending;
+            Restarted.Add(Id);
+        }
+    }
+    ActiveQueries.Empty();
+    PendingQueue.insert(PendingQueue.begin(), Restarted.begin(), Restarted.end());
+
+    // 폴리곤 수가 바뀌었을 수 있으므로 컨텍스트 배열은 다음 BeginSearch에서 다시 맞춘다
+    for (const std::unique_ptr<FSearchContext>& Context : Contexts)
+    {
+        Context->Stamp.Empty();
+    }
+}
+
+void FNavPathQueryService::Reset()
+{
+    Queries.Empty();
+    PendingQueue.Empty();
+    ActiveQueries.Empty();
+    FreeContexts.Empty();
+    Contexts.Empty();
+}
+
+bool FNavPathQueryService::TryReuseCorridor(const FNavPath& PreviousPath, FQuery& Query) const
+{
+    if (NavMesh.IsEmpty() || PreviousPath.bPartial || PreviousPath.Corridor.IsEmpty()
+        || PreviousPath.NavMeshGeneration != NavMesh.GetGeneration())
+    {
+        return false;
+    }
+
+    const int32 StartPoly = NavMesh.FindNearestPoly(Query.Start, PolySearchRadius, &Query.StartOnMesh);
+    const int32 EndPoly = NavMesh.FindNearestPoly(Query.End, PolySearchRadius, &Query.EndOnMesh);
+    if (StartPoly == INDEX_NONE || EndPoly == INDEX_NONE)
+    {
+        return false;
+    }
+
+    const TArray<int32>& Corridor = PreviousPath.Corridor;
+    const auto StartIt = std::find(Corridor.begin(), Corridor.end(), StartPoly);
+    if (StartIt == Corridor.end())
+    {
+        return false;
+    }
+
+    TArray<int32>& NewCorridor = Query.Result.Corridor;
+    const auto EndIt = std::find(StartIt, Corridor.end(), EndPoly);
+    if (EndIt != Corridor.end())
+    {
+        // 목표가 여전히 통로 안: 잘라서 사용
+        NewCorridor.assign(StartIt, EndIt + 1);
+    }
+    else if (NavMesh.FindLink(Corridor.Last(), EndPoly))
+    {
+        // 목표가 통로 끝 바로 옆 폴리곤으로 옮겨감: 한 칸 이어 붙임
+        NewCorridor.assign(StartIt, Corridor.end());
+        NewCorridor.Add(EndPoly);
+    }
+    else
+    {
+        return false;
+    }
+
+    Query.StartPoly = StartPoly;
+    Query.EndPoly = EndPoly;
+    if (!NavMesh.FindStraightPath(Query.StartOnMesh, Query.EndOnMesh, NewCorridor, Query.Result.Points))
+    {
+        Query.Result.Reset();
+        return false;
+    }
+    Query.Result.NavMeshGeneration = NavMesh.GetGeneration();
+    return true;
+}
+
+void FNavPathQueryService::BeginSearch(FQuery& Query, FSearchContext& Context) const
+{
+    Query.StartPoly = NavMesh.FindNearestPoly(Query.Start, PolySearchRadius, &Query.StartOnMesh);
+    Query.EndPoly = NavMesh.FindNearestPoly(Query.End, PolySearchRadius, &Query.EndOnMesh);
+    Query.TickIterations = 0;
+    if (Query.StartPoly == INDEX_NONE)
+    {
+        Query.Status = ENavPathStatus::Failed;
+        return;
+    }
+
+    // 목표가 메시 밖이면 목표 방향으로 가장 가까이 가는 부분 경로를 찾는다
+    if (Query.EndPoly == INDEX_NONE)
+    {
+        Query.EndOnMesh = Query.End;
+    }
+
+    const int32 NumPolys = NavMesh.GetNumPolys();
+    if (Context.Stamp.Num() != NumPolys)
+    {
+        Context.Stamp.assign(NumPolys, 0);
+        Context.bClosed.SetNum(NumPolys);
+        Context.Cost.SetNum(NumPolys);
+        Context.Parent.SetNum(NumPolys);
+        Context.Position.SetNum(NumPolys);
+        Context.CurrentStamp = 0;
+    }
+
+    ++Context.CurrentStamp;
+    Context.Open.Empty();
+
+    const int32 StartPoly = Query.StartPoly;
+    Context.Stamp[StartPoly] = Context.CurrentStamp;
+    Context.bClosed[StartPoly] = 0;
+    Context.Cost[StartPoly] = 0.0f;
+    Context.Parent[StartPoly] = INDEX_NONE;
+    Context.Position[StartPoly] = Query.StartOnMesh;
+
+    const float Heuristic = (Query.EndOnMesh - Query.StartOnMesh).Size();
+    Context.BestPoly = StartPoly;
+    Context.BestHeuristic = Heuristic;
+    Context.Open.Add({ Heuristic, 0.0f, StartPoly });
+}
+
+bool FNavPathQueryService::StepSearch(FQuery& Query, FSearchContext& Context) const
+{
+    const uint32 CurrentStamp = Context.CurrentStamp;
+    int32 Iterations = 0;
+
+    while (!Context.Open.IsEmpty() && Iterations < MaxIterationsPerQuery)
+    {
+        std::pop_heap(Context.Open.begin(), Context.Open.end());
+        const FOpenEntry Entry = Context.Open.Last();
+        Context.Open.pop_back();
+
+        // 더 싼 비용으로 다시 들어간 항목이 있으면 이전 항목은 무시 (지연 삭제)
+        const int32 Poly = Entry.Poly;
+        if (Context.bClosed[Poly] || Entry.Cost > Context.Cost[Poly])
+        {
+            continue;
+        }
+        Context.bClosed[Poly] = 1;
+        ++Iterations;
+
+        if (Poly == Query.EndPoly)
+        {
+            Query.TickIterations = Iterations;
+            FinishSearch(Query, Context, Poly, false);
+            return true;
+        }
+
+        const FVector& Position = Context.Position[Poly];
+        const float Heuristic = (Query.EndOnMesh - Position).Size();
+        if (Heuristic < Context.BestHeuristic)
+        {
+            Context.BestHeuristic = Heuristic;
+            Context.BestPoly = Poly;
+        }
+
+        const FNavPoly& NavPoly = NavMesh.GetPoly(Poly);
+        for (int32 LinkIndex = NavPoly.FirstLink; LinkIndex < NavPoly.FirstLink + NavPoly.NumLinks; ++LinkIndex)
+        {
+            const FNavPolyLink& Link = NavMesh.GetLink(LinkIndex);
+            const int32 Neighbor = Link.Neighbor;
+            const bool bVisited = Context.Stamp[Neighbor] == CurrentStamp;
+            if (bVisited && Context.bClosed[Neighbor])
+            {
+                continue;
+            }
+
+            // 노드 위치는 들어온 포털의 중점
+            const FVector PortalCenter = (Link.PortalLeft + Link.PortalRight) * 0.5f;
+            // 목표 폴리곤은 포털 -> 목표 지점 거리를 비용에 이미 넣었으므로 휴리스틱은 0
+            const bool bGoal = Neighbor == Query.EndPoly;
+            const float ToGoal = (Query.EndOnMesh - PortalCenter).Size();
+            float Cost = Context.Cost[Poly] + (PortalCenter - Position).Size();
+            if (bGoal)
+            {
+                Cost += ToGoal;
+            }
+
+            if (bVisited && Cost >= Context.Cost[Neighbor])
+            {
+                continue;
+            }
+
+            Context.Stamp[Neighbor] = CurrentStamp;
+            Context.bClosed[Neighbor] = 0;
+            Context.Cost[Neighbor] = Cost;
+            Context.Parent[Neighbor] = Poly;
+            Context.Position[Neighbor] = PortalCenter;
+
+            Context.Open.Add({ bGoal ? Cost : Cost + ToGoal, Cost, Neighbor });
+            std::push_heap(Context.Open.begin(), Context.Open.end());
+        }
+    }
+
+    Query.TickIterations = Iterations;
+    if (Context.Open.IsEmpty())
+    {
+        // 목표에 닿을 수 없음: 목표에 가장 가까웠던 폴리곤까지
+        FinishSearch(Query, Context, Context.BestPoly, true);
+        return true;
+    }
+    return false;
+}
+
+void FNavPathQueryService::FinishSearch(FQuery& Query, FSearchContext& Context, int32 LastPoly, bool bPartial) const
+{
+    FNavPath& Result = Query.Result;
+    Result.Reset();
+
+    for (int32 Poly = LastPoly; Poly != INDEX_NONE; Poly = Context.Parent[Poly])
+    {
+        Result.Corridor.Add(Poly);
+    }
+    std::reverse(Result.Corridor.begin(), Result.Corridor.end());
+
+    const FVector End = bPartial ? NavMesh.ClampToPoly(LastPoly, Query.EndOnMesh) : Query.EndOnMesh;
+    if (!NavMesh.FindStraightPath(Query.StartOnMesh, End, Result.Corridor, Result.Points))
+    {
+        Result.Reset();
+        Query.Status = ENavPathStatus::Failed;
+        return;
+    }
+
+    Result.bPartial = bPartial;
+    Result.NavMeshGeneration = NavMesh.GetGeneration();
+    Query.Status = ENavPathStatus::Succeeded;
+}
+
+void FNavPathQueryService::ReleaseContext(FQuery& Query)
+{
+    if (Query.ContextIndex != INDEX_NONE)
+    {
+        FreeContexts.Add(Query.ContextIndex);
+        Query.ContextIndex = INDEX_NONE;
+    }
+}
+
+FNavPathQueryService::FQuery* FNavPathQueryService::FindQuery(uint32 Id)
+{
+    return Queries.Find(Id);
+}
+
+const FNavPathQueryService::FQuery* FNavPathQueryService::FindQuery(uint32 Id) const
+{
+    return Queries.Find(Id);
+}
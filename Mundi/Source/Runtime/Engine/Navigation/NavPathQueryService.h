@@ -0,0 +1,146 @@
+﻿#pragma once
+#include "NavMesh.h"
+
+enum class ENavPathStatus : uint8
+{
+    Invalid,        // 없는 핸들 (이미 가져갔거나 취소됨)
+    Pending,        // 대기열에서 차례를 기다림
+    InProgress,     // 탐색 중 (여러 Tick에 나눠 진행)
+    Succeeded,
+    Failed
+};
+
+struct FNavPathHandle
+{
+    uint32 Id = 0;
+    explicit operator bool() const { return Id != 0; }
+};
+
+struct FNavPath
+{
+    TArray<FVector> Points;         // 시작점 포함 꺾임점
+    TArray<int32> Corridor;         // 지나가는 폴리곤 (다음 요청의 통로 재사용에 사용)
+    uint32 NavMeshGeneration = 0;
+    bool bPartial = false;          // 목표에 닿을 수 없어 가장 가까운 곳까지만 찾음
+
+    bool IsValid() const { return !Points.IsEmpty(); }
+    void Reset()
+    {
+        Points.Empty();
+        Corridor.Empty();
+        NavMeshGeneration = 0;
+        bPartial = false;
+    }
+};
+
+struct FNavPathQueryStats
+{
+    uint64 TotalRequests = 0;
+    uint64 TotalReused = 0;         // 이전 통로를 잘라 바로 끝낸 요청
+    uint64 TotalSearched = 0;       // A*로 끝낸 요청
+    uint64 TotalPartial = 0;
+    uint64 TotalFailed = 0;
+
+    int32 LastTickActive = 0;
+    int32 LastTickCompleted = 0;
+    int32 LastTickIterations = 0;
+    int32 PendingQueries = 0;
+    double LastTickMs = 0.0;
+};
+
+/**
+ * 비동기 경로 탐색 서비스
+ * - RequestPath는 핸들만 돌려주고, 실제 탐색은 Tick에서 활성 쿼리를 모아 FTaskPool 워커에 나눠 수행
+ * - 한 Tick에 쿼리마다 노드 확장 수를 제한해(Time slicing) 긴 경로도 프레임 시간을 크게 넘지 않는다
+ * - 이전 경로를 넘기면 시작/목표가 그 통로 안(또는 끝 바로 옆)일 때 탐색 없이 통로를 잘라 쓴다
+ * - 내비메시가 다시 빌드되면 InvalidateAll로 진행 중인 쿼리를 처음부터 다시 시작한다
+ */
+class FNavPathQueryService
+{
+public:
+    explicit FNavPathQueryService(const FNavMesh& InNavMesh);
+    ~FNavPathQueryService();
+
+    FNavPathHandle RequestPath(const FVector& Start, const FVector& End, const FNavPath* PreviousPath = nullptr);
+    ENavPathStatus GetPathStatus(FNavPathHandle Handle) const;
+
+    // 끝난 쿼리의 결과를 꺼내고 핸들을 해제한다 (Succeeded면 true)
+    bool ConsumePath(FNavPathHandle Handle, FNavPath& OutPath);
+    void CancelPath(FNavPathHandle Handle);
+
+    void Tick();
+    void InvalidateAll();
+    void Reset();
+
+    const FNavPathQueryStats& GetStats() const { return Stats; }
+
+public:
+    int32 MaxActiveQueries = 32;            // 동시에 탐색하는 쿼리 수 (탐색 컨텍스트 수)
+    int32 MaxIterationsPerQuery = 512;      // 쿼리당 Tick마다 확장하는 최대 노드 수
+    float PolySearchRadius = 2.0f;          // 시작/목표 위치에서 폴리곤을 찾는 반경
+    bool bParallel = true;
+    bool bCorridorReuse = true;
+
+private:
+    struct FOpenEntry
+    {
+        float TotalCost = 0.0f;
+        float Cost = 0.0f;
+        int32 Poly = INDEX_NONE;
+
+        // std::push_heap 용 (min-heap이 되도록 반대로 비교)
+        bool operator<(const FOpenEntry& Other) const { return TotalCost > Other.TotalCost; }
+    };
+
+    // 활성 쿼리 하나가 빌려 쓰는 A* 상태 (폴리곤 수 크기 배열, Stamp로 초기화 생략)
+    struct FSearchContext
+    {
+        TArray<uint32> Stamp;
+        TArray<uint8> bClosed;
+        TArray<float> Cost;
+        TArray<int32> Parent;
+        TArray<FVector> Position;
+        TArray<FOpenEntry> Open;
+        uint32 CurrentStamp = 0;
+        int32 BestPoly = INDEX_NONE;
+        float BestHeuristic = FLT_MAX;
+    };
+
+    struct FQuery
+    {
+        uint32 Id = 0;
+        FVector Start;
+        FVector End;
+        ENavPathStatus Status = ENavPathStatus::Pending;
+        int32 StartPoly = INDEX_NONE;
+        int32 EndPoly = INDEX_NONE;
+        FVector StartOnMesh;
+        FVector EndOnMesh;
+        int32 ContextIndex = INDEX_NONE;
+        int32 TickIterations = 0;
+        FNavPath Result;
+    };
+
+    bool TryReuseCorridor(const FNavPath& PreviousPath, FQuery& Query) const;
+    void BeginSearch(FQuery& Query, FSearchContext& Context) const;
+    bool StepSearch(FQuery& Query, FSearchContext& Context) const;
+    void FinishSearch(FQuery& Query, FSearchContext& Context, int32 LastPoly, bool bPartial) const;
+    void ReleaseContext(FQuery& Query);
+
+    FQuery* FindQuery(uint32 Id);
+    const FQuery* FindQuery(uint32 Id) const;
+
+private:
+    const FNavMesh& NavMesh;
+
+    TMap<uint32, FQuery> Queries;
+    TArray<uint32> PendingQueue;            // 요청 순서대로 활성화
+    TArray<uint32> ActiveQueries;
+    TArray<FQuery*> TickScratch;
+
+    TArray<std::unique_ptr<FSearchContext>> Contexts;
+    TArray<int32> FreeContexts;
+
+    uint32 NextId = 0;
+    FNavPathQueryStats Stats;
+};
@@ -0,0 +1,54 @@
+﻿#include "pch.h"
+#include "NavigationSystem.h"
+#include "PlatformTime.h"
+
+FNavigationSystem::FNavigationSystem()
+    : QueryService(NavMesh)
+{
+}
+
+FNavigationSystem::~FNavigationSystem() = default;
+
+void FNavigationSystem::Tick(FPhysScene* PhysScene)
+{
+    if (bRebuildRequested && PhysScene)
+    {
+        Rebuild(PhysScene);
+    }
+
+    QueryService.Tick();
+}
+
+void FNavigationSystem::Rebuild(FPhysScene* PhysScene)
+{
+    bRebuildRequested = false;
+
+    const uint64 GatherStart = FPlatformTime::Cycles64();
+    FNavMeshBuilder::GatherStaticGeometry(PhysScene, Geometry);
+    const double GatherMs = FPlatformTime::ToMilliseconds(FPlatformTime::Cycles64() - GatherStart);
+
+    FNavMeshBuildStats Stats = Builder.Build(Config, Geometry, NavMesh);
+    Stats.GatherMs = GatherMs;
+
+    // 폴리곤 인덱스가 바뀌었으므로 진행 중인 탐색은 처음부터 다시
+    QueryService.InvalidateAll();
+
+    UE_LOG("[Nav] Rebuilt: %d shapes, %d tiles (%d built, %d cached), %d polys, %d links, gather %.2fms, build %.2fms",
+        Stats.NumShapes, Stats.NumTiles, Stats.BuiltTiles, Stats.CachedTiles, Stats.NumPolys, Stats.NumLinks,
+        Stats.GatherMs, Stats.BuildMs);
+}
+
+void FNavigationSystem::LogStats() const
+{
+    const FNavMeshBuildStats& BuildStats = Builder.GetLastStats();
+    UE_LOG("[Nav] Mesh: gen %u, %d tiles, %d polys, %d links, %d cached tiles (last build %d built / %d reused, %.2fms)",
+        NavMesh.GetGeneration(), NavMesh.GetNumTiles(), NavMesh.GetNumPolys(), NavMesh.GetNumLinks(), Builder.GetNumCachedTiles(),
+        BuildStats.BuiltTiles, BuildStats.CachedTiles, BuildStats.BuildMs);
+
+    const FNavPathQueryStats& QueryStats = QueryService.GetStats();
+    UE_LOG("[Nav] Queries: %llu requested, %llu reused corridor, %llu searched (%llu partial), %llu failed",
+        QueryStats.TotalRequests, QueryStats.TotalReused, QueryStats.TotalSearched, QueryStats.TotalPartial, QueryStats.TotalFailed);
+    UE_LOG("[Nav] Last tick: %d active, %d completed, %d iterations, %d pending, %.3fms",
+        QueryStats.LastTickActive, QueryStats.LastTickCompleted, QueryStats.LastTickIterations, QueryStats.PendingQueries,
+        QueryStats.LastTickMs);
+}
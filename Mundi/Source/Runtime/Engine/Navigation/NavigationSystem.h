@@ -0,0 +1,45 @@
+﻿#pragma once
+#include "NavMeshBuilder.h"
+#include "NavPathQueryService.h"
+
+class FPhysScene;
+
+/**
+ * 월드 단위 내비게이션 (PIE 월드가 소유)
+ * - 첫 Tick 또는 RequestRebuild 이후 Static 콜리전에서 내비메시를 빌드 (바뀐 타일만 다시 빌드)
+ * - 경로 요청은 FNavPathQueryService로 넘겨 매 Tick 배치로 처리한다
+ */
+class FNavigationSystem
+{
+public:
+    FNavigationSystem();
+    ~FNavigationSystem();
+
+    void Tick(FPhysScene* PhysScene);
+
+    void RequestRebuild() { bRebuildRequested = true; }
+    void Rebuild(FPhysScene* PhysScene);
+
+    FNavPathHandle RequestPath(const FVector& Start, const FVector& End, const FNavPath* PreviousPath = nullptr)
+    {
+        return QueryService.RequestPath(Start, End, PreviousPath);
+    }
+    ENavPathStatus GetPathStatus(FNavPathHandle Handle) const { return QueryService.GetPathStatus(Handle); }
+    bool ConsumePath(FNavPathHandle Handle, FNavPath& OutPath) { return QueryService.ConsumePath(Handle, OutPath); }
+    void CancelPath(FNavPathHandle Handle) { QueryService.CancelPath(Handle); }
+
+    FNavMeshConfig& GetConfig() { return Config; }
+    const FNavMesh& GetNavMesh() const { return NavMesh; }
+    FNavPathQueryService& GetQueryService() { return QueryService; }
+    const FNavMeshBuilder& GetBuilder() const { return Builder; }
+
+    void LogStats() const;
+
+private:
+    FNavMeshConfig Config;
+    FNavMesh NavMesh;
+    FNavMeshBuilder Builder;
+    FNavPathQueryService QueryService;
+    FNavGeometry Geometry;              // 수집 버퍼 재사용
+    bool bRebuildRequested = true;
+};
@@ -8,6 +8,7 @@
 #include "BodySetup.h"
 #include "ObjectIterator.h"
 #include "StaticMesh.h"
+#include "Source/Runtime/Core/Async/TaskPool.h"
 #include <Windows.h>
 
 /**
@@ -1089,6 +1090,133 @@ bool FPhysScene::OverlapCapsuleWithMTD(
     return false;
 }
 
+int32 FPhysScene::OverlapBoxBatch(
+    const TArray<FBoxOverlapQuery>& Queries,
+    TArray<FOverlapHitResult>& OutHits,
+    int32 MaxHitsPerQuery) const
+{
+    OutHits.Empty();
+
+    const int32 NumQueries = Queries.Num();
+    if (!Scene || NumQueries == 0)
+    {
+        return 0;
+    }
+
+    constexpr int32 MaxTouches = 32;
+    const int32 SlotsPerQuery = FMath::Clamp(MaxHitsPerQuery, 1, MaxTouches);
+
+    OutHits.SetNum(NumQueries * SlotsPerQuery);
+    TArray<int32> HitCounts;
+    HitCounts.SetNum(NumQueries);
+
+    PxScene* QueryScene = Scene;
+    FTaskPool::Get().ParallelFor(NumQueries, 8, [&](int32 Begin, int32 End)
+    {
+        // 읽기 잠금은 공유 잠금이라 워커마다 잡아도 서로 막지 않는다
+        SCOPED_PHYSX_READ_LOCK(*QueryScene);
+
+        PxOverlapHit Touches[MaxTouches];
+        for (int32 QueryIndex = Begin; QueryIndex < End; ++QueryIndex)
+        {
+            const FBoxOverlapQuery& Query = Queries[QueryIndex];
+            HitCounts[QueryIndex] = 0;
+
+            const PxBoxGeometry BoxGeom(Query.HalfExtents.X, Query.HalfExtents.Y, Query.HalfExtents.Z);
+            const PxVec3 Center(Query.Center.X, Query.Center.Y, Query.Center.Z);
+            const PxTransform Pose(Center, PxQuat(Query.Rotation.X, Query.Rotation.Y, Query.Rotation.Z, Query.Rotation.W));
+
+            // 모든 겹침을 touch로 받아야 첫 blocking hit에서 멈추지 않는다
+            PxOverlapBuffer Buffer(Touches, MaxTouches);
+            FSweepQueryFilterCallback FilterCallback(Query.IgnoreActor);
+            PxQueryFilterData FilterData;
+            FilterData.flags = PxQueryFlag::eSTATIC | PxQueryFlag::eDYNAMIC | PxQueryFlag::ePREFILTER | PxQueryFlag::eNO_BLOCK;
+
+            if (!QueryScene->overlap(BoxGeom, Pose, Buffer, FilterData, &FilterCallback))
+            {
+                continue;
+            }
+
+            FOverlapHitResult* Slots = &OutHits[QueryIndex * SlotsPerQuery];
+            int32 NumSlots = 0;
+            const PxU32 NumTouches = Buffer.getNbAnyHits();
+            for (PxU32 TouchIndex = 0; TouchIndex < NumTouches && NumSlots < SlotsPerQuery; ++TouchIndex)
+            {
+                const PxOverlapHit& Touch = Buffer.getAnyHit(TouchIndex);
+                if (!Touch.actor || !Touch.shape)
+                {
+                    continue;
+                }
+
+                UPrimitiveComponent* HitComponent = nullptr;
+                if (FBodyInstance* BodyInst = static_cast<FBodyInstance*>(Touch.actor->userData))
+                {
+                    HitComponent = Cast<UPrimitiveComponent>(BodyInst->OwnerComponent);
+                }
+                AActor* HitActor = HitComponent ? HitComponent->GetOwner() : nullptr;
+
+                // 여러 shape로 된 액터는 한 번만
+                bool bDuplicate = false;
+                for (int32 i = 0; i < NumSlots && HitActor; ++i)
+                {
+                    if (Slots[i].HitActor == HitActor)
+                    {
+                        bDuplicate = true;
+                        break;
+                    }
+                }
+                if (bDuplicate)
+                {
+                    continue;
+                }
+
+                // 오버랩은 접촉점을 주지 않으므로 쿼리 중심에서 가장 가까운 상대 표면 점을 충돌 위치로 쓴다
+                const PxTransform ShapePose = PxShapeExt::getGlobalPose(*Touch.shape, *Touch.actor);
+                const PxGeometryHolder Geometry = Touch.shape->getGeometry();
+                PxVec3 ClosestPoint = ShapePose.p;
+                const PxGeometryType::Enum GeometryType = Geometry.getType();
+                if (GeometryType == PxGeometryType::eSPHERE || GeometryType == PxGeometryType::eCAPSULE
+                    || GeometryType == PxGeometryType::eBOX || GeometryType == PxGeometryType::eCONVEXMESH)
+                {
+                    if (PxGeometryQuery::pointDistance(Center, Geometry.any(), ShapePose, &ClosestPoint) <= 0.0f)
+                    {
+                        ClosestPoint = Center;  // 중심이 상대 안쪽
+                    }
+                }
+
+                FOverlapHitResult& Hit = Slots[NumSlots++];
+                Hit.QueryIndex = QueryIndex;
+                Hit.HitActor = HitActor;
+                Hit.HitComponent = HitComponent;
+                Hit.HitBody = Touch.actor;
+                Hit.ImpactPoint = FVector(ClosestPoint.x, ClosestPoint.y, ClosestPoint.z);
+
+                const PxVec3 ToCenter = Center - ClosestPoint;
+                const PxVec3 Normal = ToCenter.magnitudeSquared() > KINDA_SMALL_NUMBER ? ToCenter.getNormalized() : (Center - ShapePose.p).getNormalized();
+                Hit.ImpactNormal = FVector(Normal.x, Normal.y, Normal.z);
+            }
+            HitCounts[QueryIndex] = NumSlots;
+        }
+    });
+
+    // 쿼리 순서대로 압축 (앞쪽 슬롯부터 채우므로 덮어쓰기 전에 읽는다)
+    int32 NumHits = 0;
+    for (int32 QueryIndex = 0; QueryIndex < NumQueries; ++QueryIndex)
+    {
+        const int32 SlotBase = QueryIndex * SlotsPerQuery;
+        for (int32 i = 0; i < HitCounts[QueryIndex]; ++i)
+        {
+            if (NumHits != SlotBase + i)
+            {
+                OutHits[NumHits] = OutHits[SlotBase + i];
+            }
+            ++NumHits;
+        }
+    }
+    OutHits.SetNum(NumHits);
+    return NumHits;
+}
+
 // ===== Vehicle Surface Setup Functions =====
 
 void FPhysScene::SetupActorAsDrivableSurface(PxRigidActor* actor)
@@ -3,6 +3,8 @@
 #include "Delegates.h"
 
 struct FHitResult;
+class AActor;
+class UPrimitiveComponent;
 
 using namespace physx;
 using namespace DirectX;
@@ -122,6 +124,25 @@ private:
     static void ShutdownVehicleResources();
 };
 
+// ===== Batched Overlap Query =====
+struct FBoxOverlapQuery
+{
+    FVector Center;
+    FVector HalfExtents;
+    FQuat Rotation;
+    AActor* IgnoreActor = nullptr;
+};
+
+struct FOverlapHitResult
+{
+    int32 QueryIndex = -1;
+    AActor* HitActor = nullptr;
+    UPrimitiveComponent* HitComponent = nullptr;
+    const PxRigidActor* HitBody = nullptr;    // 컴포넌트가 없는 바디 식별용
+    FVector ImpactPoint;    // 쿼리 중심에서 가장 가까운 상대 shape 위의 점 (중심이 안쪽이면 중심)
+    FVector ImpactNormal;   // 상대 표면 -> 쿼리 중심 방향
+};
+
 class FPhysScene
 {
 public:
@@ -235,6 +256,18 @@ public:
         AActor* IgnoreActor = nullptr
     ) const;
 
+    /**
+     * @brief 박스 오버랩 여러 개를 워커 스레드에서 나눠 수행 (시뮬레이션 중이 아닐 때 호출)
+     * - 결과는 쿼리 순서대로 OutHits에 모이고, 한 쿼리 안에서 같은 액터는 한 번만 나온다
+     * - 쿼리마다 MaxHitsPerQuery(최대 32)개 슬롯에 쓰고 마지막에 압축하므로 워커 간 공유 쓰기가 없다
+     * @return 전체 히트 수
+     */
+    int32 OverlapBoxBatch(
+        const TArray<FBoxOverlapQuery>& Queries,
+        TArray<FOverlapHitResult>& OutHits,
+        int32 MaxHitsPerQuery = 16
+    ) const;
+
 private:
     // Per-Scene 리소스 (인스턴스별로 고유)
     PxScene*                Scene           = nullptr;
@@ -1,99 +1,437 @@
 ﻿#include "pch.h"
 #include "LuaComponentProxy.h"
+#include "PhysicalMaterial.h"
 
-TMap<UClass*, FBoundClassDesc> GBoundClasses;
+// Lua State(메인 스레드)별 클래스 바인딩, FBoundClassDesc 주소는 Proxy가 들고 있으므로 unique_ptr로 고정
+static TMap<lua_State*, TMap<UClass*, std::unique_ptr<FBoundClassDesc>>> GBoundClasses;
 
-void BuildBoundClass(UClass* Class)
+namespace
 {
-    if (!Class) return;
-    if (GBoundClasses.count(Class)) return;
+    float ReadNumberField(lua_State* L, int TableIndex, const char* Field, float Default)
+    {
+        lua_getfield(L, TableIndex, Field);
+        const float Value = lua_isnumber(L, -1) ? static_cast<float>(lua_tonumber(L, -1)) : Default;
+        lua_pop(L, 1);
+        return Value;
+    }
 
-    FBoundClassDesc Desc;
-    Desc.Class = Class;
+    void PushFString(lua_State* L, const FString& Value)
+    {
+        lua_pushlstring(L, Value.data(), Value.size());
+    }
 
-    for (auto& Property : Class->GetAllProperties())
+    bool ReadFString(lua_State* L, int Index, FString& OutValue)
     {
-        if (!Property.bIsEditAnywhere) continue;
+        if (lua_type(L, Index) != LUA_TSTRING) return false;
+        size_t Length = 0;
+        const char* Str = lua_tolstring(L, Index, &Length);
+        OutValue.assign(Str, Length);
+        return true;
+    }
 
-        FBoundProp BoundProp;
-        BoundProp.Property = &Property;
-        Desc.PropsByName.emplace(Property.Name, BoundProp);
+    // ---- 기본 타입 ----
+    int GetBool(lua_State* L, void* Instance, const FBoundProp& Prop)
+    {
+        lua_pushboolean(L, *Prop.GetValuePtr<bool>(Instance));
+        return 1;
     }
-    GBoundClasses.emplace(Class, std::move(Desc));
-}
 
-sol::object LuaComponentProxy::Index(sol::this_state LuaState, LuaComponentProxy& Self, const char* Key)
-{
-    if (!Self.Instance) return sol::nil;
-    sol::state_view LuaView(LuaState);
+    void SetBool(lua_State* L, int ValueIndex, void* Instance, const FBoundProp& Prop)
+    {
+        if (lua_type(L, ValueIndex) == LUA_TBOOLEAN)
+            *Prop.GetValuePtr<bool>(Instance) = lua_toboolean(L, ValueIndex) != 0;
+    }
+
+    // Int32 및 정수 기반 열거형 (PhysMaterialPreset, CombineMode, AggCollisionShapeType)
+    template<typename T>
+    int GetInteger(lua_State* L, void* Instance, const FBoundProp& Prop)
+    {
+        lua_pushinteger(L, static_cast<lua_Integer>(*Prop.GetValuePtr<T>(Instance)));
+        return 1;
+    }
+
+    template<typename T>
+    void SetInteger(lua_State* L, int ValueIndex, void* Instance, const FBoundProp& Prop)
+    {
+        if (lua_type(L, ValueIndex) == LUA_TNUMBER)
+            *Prop.GetValuePtr<T>(Instance) = static_cast<T>(static_cast<int32>(lua_tonumber(L, ValueIndex)));
+    }
 
-    BuildBoundClass(Self.Class);
+    int GetFloat(lua_State* L, void* Instance, const FBoundProp& Prop)
+    {
+        lua_pushnumber(L, *Prop.GetValuePtr<float>(Instance));
+        return 1;
+    }
 
+    void SetFloat(lua_State* L, int ValueIndex, void* Instance, const FBoundProp& Prop)
+    {
+        if (lua_type(L, ValueIndex) == LUA_TNUMBER)
+            *Prop.GetValuePtr<float>(Instance) = static_cast<float>(lua_tonumber(L, ValueIndex));
+    }
 
-    sol::table& FuncTable = FLuaBindRegistry::Get().EnsureTable(LuaView, Self.Class);
-    sol::object Func = (FuncTable.valid() ? FuncTable.raw_get<sol::object>(Key) : sol::object());
+    // FString, ScriptFile
+    int GetString(lua_State* L, void* Instance, const FBoundProp& Prop)
+    {
+        PushFString(L, *Prop.GetValuePtr<FString>(Instance));
+        return 1;
+    }
 
-    if (Func.valid() && Func.get_type() == sol::type::function)
-        return Func;
+    void SetString(lua_State* L, int ValueIndex, void* Instance, const FBoundProp& Prop)
+    {
+        ReadFString(L, ValueIndex, *Prop.GetValuePtr<FString>(Instance));
+    }
 
-    auto It = GBoundClasses.find(Self.Class);
-    if (It == GBoundClasses.end()) return sol::nil;
+    int GetName(lua_State* L, void* Instance, const FBoundProp& Prop)
+    {
+        PushFString(L, Prop.GetValuePtr<FName>(Instance)->ToString());
+        return 1;
+    }
 
-    auto ItProp = It->second.PropsByName.find(Key);
-    if (ItProp == It->second.PropsByName.end()) return sol::nil;
+    void SetName(lua_State* L, int ValueIndex, void* Instance, const FBoundProp& Prop)
+    {
+        FString Value;
+        if (ReadFString(L, ValueIndex, Value))
+            *Prop.GetValuePtr<FName>(Instance) = FName(Value);
+    }
 
-    const FProperty* Property = ItProp->second.Property;
-    switch (Property->Type)
+    // ---- 값 타입 (usertype 또는 테이블) ----
+    int GetVector(lua_State* L, void* Instance, const FBoundProp& Prop)
     {
-    case EPropertyType::Float:   return sol::make_object(LuaView, *Property->GetValuePtr<float>(Self.Instance));
-    case EPropertyType::Int32:   return sol::make_object(LuaView, *Property->GetValuePtr<int>(Self.Instance));
-    case EPropertyType::FString: return sol::make_object(LuaView, *Property->GetValuePtr<FString>(Self.Instance));
-    case EPropertyType::FVector: return sol::make_object(LuaView, *Property->GetValuePtr<FVector>(Self.Instance));
-    default: return sol::nil;
+        return sol::stack::push(L, *Prop.GetValuePtr<FVector>(Instance));
     }
-}
 
-void LuaComponentProxy::NewIndex(LuaComponentProxy& Self, const char* Key, sol::object Obj)
-{
-    auto IterateClass = GBoundClasses.find(Self.Class);
-    if (IterateClass == GBoundClasses.end()) return;
-
-    auto It = IterateClass->second.PropsByName.find(Key);
-    if (It == IterateClass->second.PropsByName.end()) return;
-
-    const FProperty* Property = It->second.Property;
-
-    switch (Property->Type)
-    {
-    case EPropertyType::Float:
-        if (Obj.get_type() == sol::type::number)
-            *Property->GetValuePtr<float>(Self.Instance) = static_cast<float>(Obj.as<double>());
-        break;
-    case EPropertyType::Int32:
-        if (Obj.get_type() == sol::type::number)
-            *Property->GetValuePtr<int>(Self.Instance) = static_cast<int>(Obj.as<double>());
-        break;
-    case EPropertyType::FString:
-        if (Obj.get_type() == sol::type::string)
-            *Property->GetValuePtr<FString>(Self.Instance) = Obj.as<FString>();
-        break;
-    case EPropertyType::FVector:
-        if (Obj.is<FVector>())
+    void SetVector(lua_State* L, int ValueIndex, void* Instance, const FBoundProp& Prop)
+    {
+        FVector* Value = Prop.GetValuePtr<FVector>(Instance);
+        if (sol::stack::check<FVector>(L, ValueIndex, sol::no_panic))
         {
-            *Property->GetValuePtr<FVector>(Self.Instance) = Obj.as<FVector>();
+            *Value = sol::stack::get<FVector>(L, ValueIndex);
         }
-        else if (Obj.get_type() == sol::type::table)
+        else if (lua_type(L, ValueIndex) == LUA_TTABLE)
         {
-            sol::table t = Obj.as<sol::table>();
-            FVector tmp{
-                static_cast<float>(t.get_or("X", 0.0)),
-                static_cast<float>(t.get_or("Y", 0.0)),
-                static_cast<float>(t.get_or("Z", 0.0))
-            };
-            *Property->GetValuePtr<FVector>(Self.Instance) = tmp;
+            *Value = FVector(
+                ReadNumberField(L, ValueIndex, "X", 0.0f),
+                ReadNumberField(L, ValueIndex, "Y", 0.0f),
+                ReadNumberField(L, ValueIndex, "Z", 0.0f));
         }
-        break;
-    default:
-        break;
     }
-}
\ No newline at end of file
+
+    int GetLinearColor(lua_State* L, void* Instance, const FBoundProp& Prop)
+    {
+        return sol::stack::push(L, *Prop.GetValuePtr<FLinearColor>(Instance));
+    }
+
+    void SetLinearColor(lua_State* L, int ValueIndex, void* Instance, const FBoundProp& Prop)
+    {
+        FLinearColor* Value = Prop.GetValuePtr<FLinearColor>(Instance);
+        if (sol::stack::check<FLinearColor>(L, ValueIndex, sol::no_panic))
+        {
+            *Value = sol::stack::get<FLinearColor>(L, ValueIndex);
+        }
+        else if (lua_type(L, ValueIndex) == LUA_TTABLE)
+        {
+            *Value = FLinearColor(
+                ReadNumberField(L, ValueIndex, "R", 0.0f),
+                ReadNumberField(L, ValueIndex, "G", 0.0f),
+                ReadNumberField(L, ValueIndex, "B", 0.0f),
+                ReadNumberField(L, ValueIndex, "A", 1.0f));
+        }
+    }
+
+    // Curve: float[4] <-> { a, b, c, d }
+    int GetCurve(lua_State* L, void* Instance, const FBoundProp& Prop)
+    {
+        const float* Value = Prop.GetValuePtr<float>(Instance);
+        lua_createtable(L, 4, 0);
+        for (int i = 0; i < 4; ++i)
+        {
+            lua_pushnumber(L, Value[i]);
+            lua_rawseti(L, -2, i + 1);
+        }
+        return 1;
+    }
+
+    void SetCurve(lua_State* L, int ValueIndex, void* Instance, const FBoundProp& Prop)
+    {
+        if (lua_type(L, ValueIndex) != LUA_TTABLE) return;
+
+        float* Value = Prop.GetValuePtr<float>(Instance);
+        for (int i = 0; i < 4; ++i)
+        {
+            lua_rawgeti(L, ValueIndex, i + 1);
+            if (lua_isnumber(L, -1))
+                Value[i] = static_cast<float>(lua_tonumber(L, -1));
+            lua_pop(L, 1);
+        }
+    }
+
+    // ---- 리소스 (직렬화와 동일하게 경로 문자열로 주고받음) ----
+    template<typename T>
+    int GetResource(lua_State* L, void* Instance, const FBoundProp& Prop)
+    {
+        T* Resource = *Prop.GetValuePtr<T*>(Instance);
+        if (Resource) PushFString(L, Resource->GetFilePath());
+        else          lua_pushnil(L);
+        return 1;
+    }
+
+    template<typename T>
+    void SetResource(lua_State* L, int ValueIndex, void* Instance, const FBoundProp& Prop)
+    {
+        T** Value = Prop.GetValuePtr<T*>(Instance);
+        FString Path;
+        if (lua_isnil(L, ValueIndex))
+        {
+            *Value = nullptr;
+        }
+        else if (ReadFString(L, ValueIndex, Path))
+        {
+            *Value = Path.empty() ? nullptr : UResourceManager::GetInstance().Load<T>(Path);
+        }
+    }
+
+    // ---- 포인터 (읽기 전용) ----
+    // ObjectPtr은 대상 클래스 정보가 없어 잘못된 타입 대입을 막을 수 없으므로 읽기만 허용
+    int GetObjectPtr(lua_State* L, void* Instance, const FBoundProp& Prop)
+    {
+        UObject* Object = *Prop.GetValuePtr<UObject*>(Instance);
+        if (!Object)
+        {
+            lua_pushnil(L);
+            return 1;
+        }
+
+        LuaComponentProxy Proxy;
+        Proxy.Instance = Object;
+        Proxy.Class = Object->GetClass();
+        Proxy.Binding = BuildBoundClass(sol::state_view(L), Proxy.Class);
+        return sol::stack::push(L, std::move(Proxy));
+    }
+
+    // SRV 등 Lua에서 해석할 수 없는 값은 주소만 넘겨 다른 바인딩 함수로 전달할 수 있게 한다
+    int GetRawPointer(lua_State* L, void* Instance, const FBoundProp& Prop)
+    {
+        lua_pushlightuserdata(L, *Prop.GetValuePtr<void*>(Instance));
+        return 1;
+    }
+
+    int GetStructAddress(lua_State* L, void* Instance, const FBoundProp& Prop)
+    {
+        lua_pushlightuserdata(L, Prop.GetValuePtr<void>(Instance));
+        return 1;
+    }
+
+    // ---- 배열 (테이블로 복사) ----
+    template<typename T>
+    void PushArrayElement(lua_State* L, const T& Value)
+    {
+        if constexpr (std::is_same_v<T, bool>)         lua_pushboolean(L, Value);
+        else if constexpr (std::is_same_v<T, int32>)   lua_pushinteger(L, Value);
+        else if constexpr (std::is_same_v<T, float>)   lua_pushnumber(L, Value);
+        else if constexpr (std::is_same_v<T, FString>) PushFString(L, Value);
+        else if constexpr (std::is_same_v<T, USound*>)
+        {
+            if (Value) PushFString(L, Value->GetFilePath());
+            else       lua_pushstring(L, "");
+        }
+    }
+
+    template<typename T>
+    void ReadArrayElement(lua_State* L, int Index, T& OutValue)
+    {
+        if constexpr (std::is_same_v<T, bool>)         OutValue = lua_toboolean(L, Index) != 0;
+        else if constexpr (std::is_same_v<T, int32>)   OutValue = static_cast<int32>(lua_tonumber(L, Index));
+        else if constexpr (std::is_same_v<T, float>)   OutValue = static_cast<float>(lua_tonumber(L, Index));
+        else if constexpr (std::is_same_v<T, FString>) ReadFString(L, Index, OutValue);
+        else if constexpr (std::is_same_v<T, USound*>)
+        {
+            FString Path;
+            ReadFString(L, Index, Path);
+            OutValue = Path.empty() ? nullptr : UResourceManager::GetInstance().Load<USound>(Path);
+        }
+    }
+
+    template<typename T>
+    int GetArray(lua_State* L, void* Instance, const FBoundProp& Prop)
+    {
+        const TArray<T>& Array = *Prop.GetValuePtr<TArray<T>>(Instance);
+        lua_createtable(L, Array.Num(), 0);
+        for (int32 i = 0; i < Array.Num(); ++i)
+        {
+            PushArrayElement<T>(L, Array[i]);
+            lua_rawseti(L, -2, i + 1);
+        }
+        return 1;
+    }
+
+    template<typename T>
+    void SetArray(lua_State* L, int ValueIndex, void* Instance, const FBoundProp& Prop)
+    {
+        if (lua_type(L, ValueIndex) != LUA_TTABLE) return;
+
+        TArray<T>& Array = *Prop.GetValuePtr<TArray<T>>(Instance);
+        const int32 Count = static_cast<int32>(lua_rawlen(L, ValueIndex));
+        Array.SetNum(Count);
+        for (int32 i = 0; i < Count; ++i)
+        {
+            lua_rawgeti(L, ValueIndex, i + 1);
+            ReadArrayElement<T>(L, -1, Array[i]);
+            lua_pop(L, 1);
+        }
+    }
+
+    void SelectArrayAccessor(FBoundProp& Prop)
+    {
+        switch (Prop.Property->InnerType)
+        {
+        case EPropertyType::Bool:    Prop.Getter = &GetArray<bool>;    Prop.Setter = &SetArray<bool>;    break;
+        case EPropertyType::Int32:   Prop.Getter = &GetArray<int32>;   Prop.Setter = &SetArray<int32>;   break;
+        case EPropertyType::Float:   Prop.Getter = &GetArray<float>;   Prop.Setter = &SetArray<float>;   break;
+        case EPropertyType::FString: Prop.Getter = &GetArray<FString>; Prop.Setter = &SetArray<FString>; break;
+        case EPropertyType::Sound:   Prop.Getter = &GetArray<USound*>; Prop.Setter = &SetArray<USound*>; break;
+        default: break;
+        }
+    }
+
+    // 프로퍼티 타입에 맞는 접근자 선택, 지원하지 않는 타입이면 false
+    bool SelectAccessor(FBoundProp& Prop)
+    {
+        switch (Prop.Property->Type)
+        {
+        case EPropertyType::Bool:                  Prop.Getter = &GetBool;        Prop.Setter = &SetBool;        break;
+        case EPropertyType::Int32:                 Prop.Getter = &GetInteger<int32>; Prop.Setter = &SetInteger<int32>; break;
+        case EPropertyType::PhysMaterialPreset:    Prop.Getter = &GetInteger<int32>; Prop.Setter = &SetInteger<int32>; break;
+        case EPropertyType::CombineMode:           Prop.Getter = &GetInteger<ECombineMode>; Prop.Setter = &SetInteger<ECombineMode>; break;
+        case EPropertyType::AggCollisionShapeType: Prop.Getter = &GetInteger<EAggCollisionShapeType>; Prop.Setter = &SetInteger<EAggCollisionShapeType>; break;
+        case EPropertyType::Float:                 Prop.Getter = &GetFloat;       Prop.Setter = &SetFloat;       break;
+        case EPropertyType::FString:
+        case EPropertyType::ScriptFile:            Prop.Getter = &GetString;      Prop.Setter = &SetString;      break;
+        case EPropertyType::FName:                 Prop.Getter = &GetName;        Prop.Setter = &SetName;        break;
+        case EPropertyType::FVector:               Prop.Getter = &GetVector;      Prop.Setter = &SetVector;      break;
+        case EPropertyType::FLinearColor:          Prop.Getter = &GetLinearColor; Prop.Setter = &SetLinearColor; break;
+        case EPropertyType::Curve:                 Prop.Getter = &GetCurve;       Prop.Setter = &SetCurve;       break;
+        case EPropertyType::Texture:               Prop.Getter = &GetResource<UTexture>;        Prop.Setter = &SetResource<UTexture>;        break;
+        case EPropertyType::StaticMesh:            Prop.Getter = &GetResource<UStaticMesh>;     Prop.Setter = &SetResource<UStaticMesh>;     break;
+        case EPropertyType::SkeletalMesh:          Prop.Getter = &GetResource<USkeletalMesh>;   Prop.Setter = &SetResource<USkeletalMesh>;   break;
+        case EPropertyType::Material:              Prop.Getter = &GetResource<UMaterial>;       Prop.Setter = &SetResource<UMaterial>;       break;
+        case EPropertyType::ParticleSystem:        Prop.Getter = &GetResource<UParticleSystem>; Prop.Setter = &SetResource<UParticleSystem>; break;
+        case EPropertyType::PhysicsAsset:          Prop.Getter = &GetResource<UPhysicsAsset>;   Prop.Setter = &SetResource<UPhysicsAsset>;   break;
+        case EPropertyType::Sound:                 Prop.Getter = &GetResource<USound>;          Prop.Setter = &SetResource<USound>;          break;
+        case EPropertyType::ObjectPtr:             Prop.Getter = &GetObjectPtr;     break;
+        case EPropertyType::SRV:                   Prop.Getter = &GetRawPointer;    break;
+        case EPropertyType::Struct:                Prop.Getter = &GetStructAddress; break;
+        case EPropertyType::Array:                 SelectArrayAccessor(Prop); break;
+        default: break;
+        }
+        return Prop.Getter != nullptr;
+    }
+}
+
+const FBoundClassDesc* BuildBoundClass(sol::state_view Lua, UClass* Class)
+{
+    if (!Class) return nullptr;
+
+    // 코루틴 스레드에서 불려도 같은 바인딩을 쓰도록 메인 스레드 기준으로 보관
+    lua_State* MainState = sol::main_thread(Lua.lua_state(), Lua.lua_state());
+    TMap<UClass*, std::unique_ptr<FBoundClassDesc>>& Classes = GBoundClasses[MainState];
+    if (auto It = Classes.find(Class); It != Classes.end())
+        return It->second.get();
+
+    auto Desc = std::make_unique<FBoundClassDesc>();
+    Desc->Class = Class;
+    Desc->Lookup = Lua.create_table();
+
+    // 메서드: 부모 -> 자식 순으로 빌더를 실행해 평탄화 (자식이 같은 이름을 덮어씀)
+    TArray<const UClass*> Chain;
+    for (const UClass* It = Class; It; It = It->Super)
+        Chain.Add(It);
+
+    const auto& Builders = FLuaBindRegistry::Get().GetBuilders();
+    for (int32 i = Chain.Num() - 1; i >= 0; --i)
+    {
+        if (auto ItB = Builders.find(Chain[i]); ItB != Builders.end())
+            ItB->second(Lua, Desc->Lookup);
+    }
+
+    // 프로퍼티: 접근자를 먼저 모두 만든 뒤(주소 고정) Lookup에 등록
+    const TArray<FProperty>& Properties = Class->GetAllProperties();
+    Desc->Props.Reserve(Properties.Num());
+    for (const FProperty& Property : Properties)
+    {
+        if (!Property.bIsEditAnywhere) continue;
+
+        FBoundProp BoundProp;
+        BoundProp.Property = &Property;
+        BoundProp.Offset = Property.Offset;
+        if (SelectAccessor(BoundProp))
+            Desc->Props.Add(BoundProp);
+    }
+
+    lua_State* L = Lua.lua_state();
+    Desc->Lookup.push(L);
+    for (FBoundProp& BoundProp : Desc->Props)
+    {
+        lua_getfield(L, -1, BoundProp.Property->Name);
+        const bool bHasMethod = !lua_isnil(L, -1);
+        lua_pop(L, 1);
+        if (bHasMethod) continue;
+
+        lua_pushlightuserdata(L, &BoundProp);
+        lua_setfield(L, -2, BoundProp.Property->Name);
+    }
+    lua_pop(L, 1);
+
+    const FBoundClassDesc* Result = Desc.get();
+    Classes.emplace(Class, std::move(Desc));
+    return Result;
+}
+
+void ResetBoundClasses(lua_State* L)
+{
+    GBoundClasses.Remove(sol::main_thread(L, L));
+}
+
+int LuaComponentProxy::Index(lua_State* L)
+{
+    LuaComponentProxy& Self = sol::stack::get<LuaComponentProxy&>(L, 1);
+    if (!Self.Instance || !Self.Binding)
+    {
+        lua_pushnil(L);
+        return 1;
+    }
+
+    // 키는 Lua가 이미 인터닝한 문자열이므로 FString 변환 없이 그대로 조회
+    Self.Binding->Lookup.push(L);
+    lua_pushvalue(L, 2);
+    lua_rawget(L, -2);
+
+    if (lua_type(L, -1) == LUA_TLIGHTUSERDATA)
+    {
+        const FBoundProp* Prop = static_cast<const FBoundProp*>(lua_touserdata(L, -1));
+        lua_pop(L, 2);
+        return Prop->Getter(L, Self.Instance, *Prop);
+    }
+
+    // 메서드 또는 nil
+    lua_remove(L, -2);
+    return 1;
+}
+
+int LuaComponentProxy::NewIndex(lua_State* L)
+{
+    LuaComponentProxy& Self = sol::stack::get<LuaComponentProxy&>(L, 1);
+    if (!Self.Instance || !Self.Binding) return 0;
+
+    Self.Binding->Lookup.push(L);
+    lua_pushvalue(L, 2);
+    lua_rawget(L, -2);
+
+    const FBoundProp* Prop = (lua_type(L, -1) == LUA_TLIGHTUSERDATA)
+        ? static_cast<const FBoundProp*>(lua_touserdata(L, -1))
+        : nullptr;
+    lua_pop(L, 2);
+
+    if (Prop && Prop->Setter)
+        Prop->Setter(L, 3, Self.Instance, *Prop);
+    return 0;
+}
@@ -5,26 +5,51 @@
 
 #include "LuaBindingRegistry.h"
 
+struct FBoundProp;
+
+// 타입별 접근자, 클래스 바인딩 생성 시 한 번만 선택된다
+using FBoundPropGetter = int  (*)(lua_State* L, void* Instance, const FBoundProp& Prop);                  // 값 하나를 push, 1 반환
+using FBoundPropSetter = void (*)(lua_State* L, int ValueIndex, void* Instance, const FBoundProp& Prop);
+
 struct FBoundProp
 {
-    const FProperty* Property = nullptr;  // TODO: editable/readonly flags... 
+    const FProperty* Property = nullptr;
+    size_t Offset = 0;
+    FBoundPropGetter Getter = nullptr;
+    FBoundPropSetter Setter = nullptr;    // nullptr이면 읽기 전용
+
+    template<typename T>
+    T* GetValuePtr(void* Instance) const
+    {
+        return reinterpret_cast<T*>(static_cast<uint8*>(Instance) + Offset);
+    }
 };
 
-struct FBoundClassDesc   // Property list per class
+/**
+ * 클래스별 Lua 바인딩 (Lua State마다 클래스당 한 번 생성)
+ * - Lookup: 키 -> 메서드(function) 또는 프로퍼티 접근자(lightuserdata, FBoundProp*)
+ *   메서드는 부모 -> 자식 순으로 평탄화해서 넣으므로 rawget 한 번으로 찾는다 (메서드가 프로퍼티보다 우선)
+ * - Props: 생성 후 크기가 고정되므로 Lookup이 가리키는 주소가 유지된다
+ */
+struct FBoundClassDesc
 {
     UClass* Class = nullptr;
-    TMap<FString, FBoundProp> PropsByName;
+    TArray<FBoundProp> Props;
+    sol::table Lookup;
 };
 
-extern TMap<UClass*, FBoundClassDesc> GBoundClasses;
+const FBoundClassDesc* BuildBoundClass(sol::state_view Lua, UClass* Class);
+void ResetBoundClasses(lua_State* L);   // lua_close 전에 호출
 
-void BuildBoundClass(UClass* Class);
+sol::object MakeCompProxy(sol::state_view SolState, void* Instance, UClass* Class);
 
 struct LuaComponentProxy
 {
     void* Instance = nullptr;
     UClass* Class = nullptr;
+    const FBoundClassDesc* Binding = nullptr;
 
-    static sol::object Index(sol::this_state LuaState, LuaComponentProxy& Self, const char* Key);
-    static void        NewIndex(LuaComponentProxy& Self, const char* Key, sol::object Obj);
+    // __index(Self, Key) / __newindex(Self, Key, Value), sol 변환을 거치지 않는 lua_CFunction
+    static int Index(lua_State* L);
+    static int NewIndex(lua_State* L);
 };
@@ -10,7 +10,15 @@ void FLuaCoroutineScheduler::ShutdownBeforeLuaClose()
 			Task.Co.abandon(); // Lua쪽 Coroutine 무력화 필수
 		}
 	}
-	Tasks.Empty(); 
+	Tasks.Empty();
+	TaskIndexById.Empty();
+	TaskIdsByOwner.Empty();
+	TimerHeap.Empty();
+	EventWaiters.Empty();
+	PredicateWaiters.Empty();
+	ReadyQueue.Empty();
+	ResumeScratch.Empty();
+	NumFinished = 0;
 }
 
 FLuaCoroutineScheduler::FLuaCoroutineScheduler()
@@ -25,9 +33,20 @@ FLuaCoroHandle FLuaCoroutineScheduler::Register(sol::thread&& Thread, sol::corou
 	Task.Co     = std::move(Co);
 	Task.Owner  = Owner;
 	Task.Id     = ++NextId;
+
+	const uint32 Id = Task.Id;
+	if (Owner)
+	{
+		Task.OwnerListIndex = TaskIdsByOwner[Owner].Add(Id);
+	}
+
+	TaskIndexById.Add(Id, Tasks.Num());
 	Tasks.push_back(std::move(Task));
-	
-	return FLuaCoroHandle{ Task.Id };
+
+	// 첫 resume은 다음 Process에서
+	ReadyQueue.Add({ Id, 0 });
+
+	return FLuaCoroHandle{ Id };
 }
 
 void FLuaCoroutineScheduler::Tick(double DeltaTime)
@@ -37,114 +56,296 @@ void FLuaCoroutineScheduler::Tick(double DeltaTime)
 	NowSeconds += Clamped;
 
 	Process(NowSeconds);
+	Compact();
 }
+
 void FLuaCoroutineScheduler::Process(double Now)
 {
-	for (auto& task : Tasks)
+	// Resume 도중 새 Task 등록/이벤트 트리거가 일어날 수 있으므로
+	// 이번 프레임에 재개할 목록을 먼저 확정한 뒤 Id로 다시 찾아서 재개한다
+	ResumeScratch.Empty();
+	std::swap(ResumeScratch, ReadyQueue);
+
+	// 시간 대기: 깨어날 시간이 지난 항목만 꺼낸다
+	while (!TimerHeap.IsEmpty() && TimerHeap[0].WakeTime <= Now)
+	{
+		std::pop_heap(TimerHeap.begin(), TimerHeap.end());
+		ResumeScratch.Add(TimerHeap.Last().Ref);
+		TimerHeap.pop_back();
+	}
+
+	// 조건 대기: 조건 대기 중인 Task만 평가
+	for (int32 i = 0; i < PredicateWaiters.Num();)
 	{
-		if (task.Finished)
+		const FCoroWaitRef Ref = PredicateWaiters[i];
+		FCoroTask* Task = FindWaitingTask(Ref, EWaitType::Predicate);
+		if (!Task)
+		{
+			PredicateWaiters.RemoveAtSwap(i);
 			continue;
+		}
 
-		// 조건 충족 여부
-		switch (task.WaitType)
+		// 평가 중 Tasks가 재할당될 수 있으므로 함수 참조를 복사해서 호출
+		sol::protected_function Predicate = Task->Predicate;
+		bool bSatisfied = true;
+		if (Predicate.valid())
 		{
-		case EWaitType::Time:
-			// UE_LOG("Now=%.3f Wake=%.3f", TotalTime, task.WakeTime);
-			if (task.WakeTime > Now) continue;
-			break;
-		case EWaitType::Predicate:
-			// 람다 함수가 있지만, 조건이 달성 안 됐을 때
-			if (task.Predicate && !task.Predicate()) continue; 
-			break;
-			// case EWaitType::Event: // Event "Trigger"는 Tick 함수 내에서 조건 확인하지 않음
+			sol::protected_function_result Result = Predicate();
+			bSatisfied = Result.valid() && Result.get<bool>();
 		}
 
-		// 조건 충족 시 resume 실행
-		sol::protected_function_result Result = task.Co();
-		if (!Result.valid())
+		if (bSatisfied)
 		{
-			sol::error Err = Result;
-			UE_LOG("[Lua][error] Coroutine error: %s\n", Err.what());
-			task.Finished = true;
+			ResumeScratch.Add(Ref);
+			PredicateWaiters.RemoveAtSwap(i);
 			continue;
 		}
-		
-		// 이후 yield가 다시 올 경우, 다음 조건 실행 = 재세팅
-		if (Result.status() == sol::call_status::yielded)
+		++i;
+	}
+
+	for (int32 i = 0; i < ResumeScratch.Num(); ++i)
+	{
+		ResumeTask(ResumeScratch[i], Now);
+	}
+	ResumeScratch.Empty();
+}
+
+void FLuaCoroutineScheduler::ResumeTask(const FCoroWaitRef& Ref, double Now)
+{
+	FCoroTask* Task = FindTask(Ref.Id);
+	if (!Task || Task->Finished || Task->WaitSerial != Ref.WaitSerial)
+	{
+		return;
+	}
+
+	Task->WaitType = EWaitType::None;
+	Task->Predicate = sol::nil;
+	++Task->WaitSerial;
+
+	// Resume 중 Register로 Tasks가 재할당될 수 있으므로 복사본으로 호출하고 이후 다시 찾는다
+	sol::coroutine Co = Task->Co;
+	const uint32 Id = Task->Id;
+	sol::protected_function_result Result = Co();
+
+	Task = FindTask(Id);
+	if (!Task || Task->Finished)
+	{
+		return; // Resume 도중 취소됨
+	}
+
+	if (!Result.valid())
+	{
+		sol::error Err = Result;
+		UE_LOG("[Lua][error] Coroutine error: %s\n", Err.what());
+		MarkFinished(*Task);
+		return;
+	}
+
+	// 이후 yield가 다시 올 경우, 다음 조건 실행 = 재세팅
+	if (Result.status() == sol::call_status::yielded)
+	{
+		ApplyYield(*Task, Result, Now);
+	}
+	else
+	{
+		// ok / runtime / file / memory 모두 종료
+		MarkFinished(*Task);
+	}
+}
+
+void FLuaCoroutineScheduler::ApplyYield(FCoroTask& Task, const sol::protected_function_result& Result, double Now)
+{
+	const FCoroWaitRef Ref{ Task.Id, Task.WaitSerial };
+
+	FString Tag;
+	if (Result.return_count() > 0 && Result.get_type(0) == sol::type::string)
+	{
+		Tag = Result.get<FString>(0); // 해당 Co의 첫번째 string 매개변수
+	}
+
+	if (Tag == "wait_time")
+	{
+		double Sec = Result.get<double>(1);
+		Task.WaitType = EWaitType::Time;
+		Task.WakeTime = Now + Sec;
+
+		TimerHeap.Add({ Task.WakeTime, Ref });
+		std::push_heap(TimerHeap.begin(), TimerHeap.end());
+	}
+	else if (Tag == "wait_predicate")
+	{
+		Task.WaitType = EWaitType::Predicate;
+		Task.Predicate = Result.get<sol::protected_function>(1);
+		PredicateWaiters.Add(Ref);
+	}
+	else if (Tag == "wait_event")
+	{
+		Task.WaitType = EWaitType::Event;
+		Task.EventName = Result.get<FString>(1);
+		EventWaiters[Task.EventName].Add(Ref);
+	}
+	else
+	{
+		// 태그 없는 yield는 다음 프레임에 다시 재개
+		Task.WaitType = EWaitType::None;
+		ReadyQueue.Add(Ref);
+	}
+}
+
+void FLuaCoroutineScheduler::MarkFinished(FCoroTask& Task)
+{
+	if (Task.Finished)
+	{
+		return;
+	}
+
+	// 이벤트는 트리거되지 않으면 영원히 남으므로 버킷에서 바로 뺀다 (시간/조건 대기는 지연 정리)
+	if (Task.WaitType == EWaitType::Event)
+	{
+		if (TArray<FCoroWaitRef>* Waiters = EventWaiters.Find(Task.EventName))
 		{
-			std::string Tag = Result.get<FString>(0); // 해당 Co의 첫번째 string 매개변수
-			if (Tag == "wait_time")
-			{
-				double Sec = Result.get<double>(1);
-				task.WaitType = EWaitType::Time;
-				task.WakeTime = Now + Sec;
-			}
-			else if (Tag == "wait_predicate")
+			for (int32 i = 0; i < Waiters->Num(); ++i)
 			{
-				sol::function Condition = Result.get<sol::function>(1); 
-				task.WaitType = EWaitType::Predicate;
-				task.Predicate = [Condition]()
+				if ((*Waiters)[i].Id == Task.Id)
 				{
-					sol::protected_function_result Result = Condition();
-					if (!Result.valid()) return false; 
-					return Result.get<bool>();
-				};
+					Waiters->RemoveAtSwap(i);
+					break;
+				}
 			}
-			else if (Tag == "wait_event")
+			if (Waiters->IsEmpty())
 			{
-				task.WaitType = EWaitType::Event;
-				task.EventName = Result.get<FString>(1);
-			}
-			else
-			{
-				task.WaitType = EWaitType::None;
+				EventWaiters.Remove(Task.EventName);
 			}
 		}
-		else if (Result.status() == sol::call_status::runtime)
-		{
-			task.Finished = true;
-		}
-		else if (Result.status() == sol::call_status::ok)
+	}
+
+	Task.Finished = true;
+	Task.WaitType = EWaitType::None;
+	Task.Predicate = sol::nil;
+	Task.Co = sol::coroutine(); // 참조 해제
+	Task.Thread = sol::thread();
+	++NumFinished;
+}
+
+void FLuaCoroutineScheduler::Compact()
+{
+	if (NumFinished == 0)
+	{
+		return;
+	}
+
+	for (int32 i = 0; i < Tasks.Num();)
+	{
+		FCoroTask& Task = Tasks[i];
+		if (!Task.Finished)
 		{
-			task.Finished = true;
+			++i;
+			continue;
 		}
-		else if (Result.status() == sol::call_status::file)
+
+		// 소유자 목록에서 swap-remove, 옮겨진 Task의 위치만 갱신 (선형 탐색 없음)
+		if (Task.Owner && Task.OwnerListIndex != -1)
 		{
-			task.Finished = true;
+			if (TArray<uint32>* OwnerTasks = TaskIdsByOwner.Find(Task.Owner))
+			{
+				const int32 OwnerIndex = Task.OwnerListIndex;
+				const int32 LastOwnerIndex = OwnerTasks->Num() - 1;
+				if (OwnerIndex != LastOwnerIndex)
+				{
+					const uint32 MovedId = (*OwnerTasks)[LastOwnerIndex];
+					(*OwnerTasks)[OwnerIndex] = MovedId;
+					if (FCoroTask* MovedTask = FindTask(MovedId))
+					{
+						MovedTask->OwnerListIndex = OwnerIndex;
+					}
+				}
+				OwnerTasks->pop_back();
+				if (OwnerTasks->IsEmpty())
+				{
+					TaskIdsByOwner.Remove(Task.Owner);
+				}
+			}
+			Task.OwnerListIndex = -1;
 		}
-		else if (Result.status() == sol::call_status::memory)
+		TaskIndexById.Remove(Task.Id);
+
+		// 마지막 Task를 빈 자리로 옮기고 인덱스 갱신 (핸들은 Id 기반이라 그대로 유효)
+		const int32 LastIndex = Tasks.Num() - 1;
+		if (i != LastIndex)
 		{
-			task.Finished = true;
+			Tasks[i] = std::move(Tasks[LastIndex]);
+			TaskIndexById[Tasks[i].Id] = i;
 		}
+		Tasks.pop_back();
 	}
+	NumFinished = 0;
 }
 
+FCoroTask* FLuaCoroutineScheduler::FindTask(uint32 Id)
+{
+	const int32* Index = TaskIndexById.Find(Id);
+	return Index ? &Tasks[*Index] : nullptr;
+}
+
+FCoroTask* FLuaCoroutineScheduler::FindWaitingTask(const FCoroWaitRef& Ref, EWaitType WaitType)
+{
+	FCoroTask* Task = FindTask(Ref.Id);
+	if (!Task || Task->Finished || Task->WaitType != WaitType || Task->WaitSerial != Ref.WaitSerial)
+	{
+		return nullptr;
+	}
+	return Task;
+}
+
+bool FLuaCoroutineScheduler::IsRunning(FLuaCoroHandle Handle) const
+{
+	const int32* Index = TaskIndexById.Find(Handle.Id);
+	return Index && !Tasks[*Index].Finished;
+}
 
 void FLuaCoroutineScheduler::AddCoroutine(sol::coroutine&& Co)
 {
-	Tasks.push_back({std::move(Co)});
+	Register(sol::thread(), std::move(Co), nullptr);
 }
 
 void FLuaCoroutineScheduler::TriggerEvent(const FString& EventName)
 {
-	for (auto& task : Tasks)
+	TArray<FCoroWaitRef>* Waiters = EventWaiters.Find(EventName);
+	if (!Waiters || Waiters->IsEmpty())
+	{
+		return;
+	}
+
+	// 재개 중 같은 이벤트를 다시 기다리거나 버킷이 추가될 수 있으므로 먼저 꺼내 둔다
+	TArray<FCoroWaitRef> Triggered = std::move(*Waiters);
+	EventWaiters.Remove(EventName);
+
+	for (const FCoroWaitRef& Ref : Triggered)
 	{
-		if (task.Finished) continue;
-		if (task.WaitType != EWaitType::Event) continue;
-		if (task.EventName == EventName)
+		if (FindWaitingTask(Ref, EWaitType::Event))
 		{
-			task.WaitType = EWaitType::None;
-			task.Co(); // resume
+			ResumeTask(Ref, NowSeconds);
 		}
 	}
 }
 
 void FLuaCoroutineScheduler::CancelByOwner(void* Owner)
 {
-	for (auto& Task : Tasks) {
-		if (Task.Owner == Owner && !Task.Finished) {
-			Task.Finished = true;
-			Task.Co = sol::coroutine(); // 참조 해제
+	TArray<uint32>* OwnerTasks = TaskIdsByOwner.Find(Owner);
+	if (!OwnerTasks)
+	{
+		return;
+	}
+
+	const TArray<uint32> Ids = std::move(*OwnerTasks);
+	TaskIdsByOwner.Remove(Owner);
+
+	for (uint32 Id : Ids)
+	{
+		if (FCoroTask* Task = FindTask(Id))
+		{
+			Task->OwnerListIndex = -1;	// 목록은 이미 제거됨, 같은 Owner로 새로 등록된 목록을 건드리지 않도록
+			MarkFinished(*Task);
 		}
 	}
 }
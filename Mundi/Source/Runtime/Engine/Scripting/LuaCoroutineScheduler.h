@@ -22,12 +22,41 @@ struct FCoroTask
     void* Owner = nullptr;          // ULuaScriptComponent*
     EWaitType WaitType  = EWaitType::None;
     double WakeTime = 0.0;			// wait_time(n초)
-    std::function<bool()> Predicate;// wait_until()
-    std::string EventName;			// wait_event("Test")
+    sol::protected_function Predicate;// wait_predicate()
+    FString EventName;				// wait_event("Test")
     bool Finished = false;
     uint32 Id = 0;
+    uint32 WaitSerial = 0;          // yield마다 증가, 대기열에 남은 이전 대기 항목 무효화용
+    int32 OwnerListIndex = -1;      // TaskIdsByOwner[Owner] 내 위치 (Compact에서 swap-remove)
 };
 
+// 대기열 항목, Task는 Id(핸들)로만 참조하고 WaitSerial로 유효성 확인
+struct FCoroWaitRef
+{
+    uint32 Id = 0;
+    uint32 WaitSerial = 0;
+};
+
+struct FCoroTimerEntry
+{
+    double WakeTime = 0.0;
+    FCoroWaitRef Ref;
+
+    // std::push_heap 용 (min-heap이 되도록 반대로 비교), 같은 시간이면 먼저 등록된 Task 우선
+    bool operator<(const FCoroTimerEntry& Other) const
+    {
+        if (WakeTime != Other.WakeTime) return WakeTime > Other.WakeTime;
+        return Ref.Id > Other.Ref.Id;
+    }
+};
+
+/**
+ * 코루틴 스케줄러
+ * - 시간 대기: WakeTime 기준 min-heap, 깨어날 Task만 꺼낸다
+ * - 이벤트 대기: 이벤트 이름별 버킷, TriggerEvent는 해당 버킷만 처리
+ * - 조건 대기: 조건 대기 중인 Task만 매 프레임 평가
+ * - 완료된 Task는 Tick 끝에 압축 제거, 핸들(Id)은 인덱스와 무관하게 유지된다
+ */
 class FLuaCoroutineScheduler
 {
 public:
@@ -35,21 +64,41 @@ public:
     ~FLuaCoroutineScheduler() = default;
 
     FLuaCoroHandle Register(sol::thread&& Thread, sol::coroutine&& Co, void* Owner);
-        
+
     void Tick(double DeltaTime);
     void AddCoroutine(sol::coroutine&& Co);
     void TriggerEvent(const FString& EventName);
-    
+
     void CancelByOwner(void* Owner);
     void ShutdownBeforeLuaClose();
-    
+
+    bool IsRunning(FLuaCoroHandle Handle) const;
+    int32 GetNumTasks() const { return Tasks.Num() - NumFinished; }
+
 private:
     void Process(double Now);
+    void ResumeTask(const FCoroWaitRef& Ref, double Now);
+    void ApplyYield(FCoroTask& Task, const sol::protected_function_result& Result, double Now);
+    void MarkFinished(FCoroTask& Task);
+    void Compact();
+
+    FCoroTask* FindTask(uint32 Id);
+    FCoroTask* FindWaitingTask(const FCoroWaitRef& Ref, EWaitType WaitType);
 
 private:
-    TArray<FCoroTask> Tasks;
+    TArray<FCoroTask> Tasks;                        // 밀집 배열 (완료 Task는 Compact에서 제거)
+    TMap<uint32, int32> TaskIndexById;              // 핸들 -> Tasks 인덱스
+    TMap<void*, TArray<uint32>> TaskIdsByOwner;
+
+    TArray<FCoroTimerEntry> TimerHeap;
+    TMap<FString, TArray<FCoroWaitRef>> EventWaiters;
+    TArray<FCoroWaitRef> PredicateWaiters;
+    TArray<FCoroWaitRef> ReadyQueue;                // 다음 Process에서 바로 재개 (등록 직후, 태그 없는 yield)
+    TArray<FCoroWaitRef> ResumeScratch;             // Process 내부 재개 목록 (할당 재사용)
+
     uint32 NextId = 0;
-    
+    int32 NumFinished = 0;
+
     double NowSeconds = 0.0;
     double MaxDeltaClamp = 0.1; // 한 프레임의 최대 반영시간, Debug으로 중단 시에도 시간이 가지 않게 방지
 };
@@ -15,13 +15,36 @@
 #include "CombatTypes.h"
 #include "SkeletalMeshComponent.h"
 #include "AnimInstance.h"
+#include "LuaScriptComponent.h"
+#include "LuaScriptProfiler.h"
+#include "PlatformTime.h"
 #include <tuple>
 
+// 스크립트 그룹 하나를 순회하는 Lua 측 디스패처
+// C++ -> Lua 보호 호출은 그룹당 한 번, 인스턴스별 에러 격리는 Lua의 pcall로 처리한다
+static const char* LuaTickDispatcherSource = R"(
+local pcall = pcall
+return function(Ticks, Deltas, Count, Errors)
+    local ErrorCount = 0
+    for i = 1, Count do
+        local Dt = Deltas[i]
+        if Dt then
+            local Ok, Err = pcall(Ticks[i], Dt)
+            if not Ok then
+                ErrorCount = ErrorCount + 1
+                Errors[ErrorCount] = tostring(Err)
+            end
+        end
+    end
+    return ErrorCount
+end
+)";
+
 sol::object MakeCompProxy(sol::state_view SolState, void* Instance, UClass* Class) {
-    BuildBoundClass(Class);
     LuaComponentProxy Proxy;
     Proxy.Instance = Instance;
     Proxy.Class = Class;
+    Proxy.Binding = BuildBoundClass(SolState, Class);
     return sol::make_object(SolState, std::move(Proxy));
 }
 
@@ -550,6 +573,20 @@ FLuaManager::FLuaManager()
         "A", &FLinearColor::A
     );
 
+    // wait_event로 대기 중인 코루틴 재개
+    // 사용법: TriggerEvent("EventName")
+    SharedLib.set_function("TriggerEvent", [this](const FString& EventName)
+        {
+            CoroutineSchedular.TriggerEvent(EventName);
+        });
+
+    // 고해상도 시간(초), 스크립트 구간 측정용 (os 라이브러리는 열지 않음)
+    // 사용법: local T0 = Clock() ... local Elapsed = Clock() - T0
+    SharedLib.set_function("Clock", []()
+        {
+            return static_cast<double>(FPlatformTime::Cycles64()) * FPlatformTime::GetSecondsPerCycle();
+        });
+
     RegisterComponentProxy(*Lua);
     ExposeGlobalFunctions();
     ExposeAllComponentsToLua();
@@ -558,6 +595,25 @@ FLuaManager::FLuaManager()
     sol::table MetaTableShared = Lua->create_table();
     MetaTableShared[sol::meta_function::index] = Lua->globals();
     SharedLib[sol::metatable_key]  = MetaTableShared;
+
+    // 스크립트 Tick 배치 디스패처
+    sol::load_result DispatcherChunk = Lua->load(LuaTickDispatcherSource, "=TickDispatcher");
+    if (DispatcherChunk.valid())
+    {
+        sol::protected_function DispatcherFactory = DispatcherChunk;
+        sol::protected_function_result Result = DispatcherFactory();
+        if (Result.valid())
+        {
+            TickDispatcher = Result.get<sol::protected_function>();
+        }
+    }
+    if (!TickDispatcher.valid())
+    {
+        UE_LOG("[Lua][error] failed to build tick dispatcher, falling back to per-component Tick\n");
+    }
+    TickErrors = Lua->create_table();
+
+    FLuaScriptProfiler::Get().Attach(Lua->lua_state());
 }
 
 FLuaManager::~FLuaManager()
@@ -566,6 +622,7 @@ FLuaManager::~FLuaManager()
     
     if (Lua)
     {
+        FLuaScriptProfiler::Get().Detach(Lua->lua_state());
         delete Lua;
         Lua = nullptr;
     }
@@ -584,6 +641,7 @@ sol::environment FLuaManager::CreateEnvironment()
 }
 
 void FLuaManager::RegisterComponentProxy(sol::state& Lua) {
+    // 프로퍼티/메서드 조회는 클래스 바인딩(FBoundClassDesc)의 Lookup 테이블 rawget 한 번으로 처리
     Lua.new_usertype<LuaComponentProxy>("Component",
         sol::meta_function::index,     &LuaComponentProxy::Index,
         sol::meta_function::new_index, &LuaComponentProxy::NewIndex
@@ -812,14 +870,189 @@ bool FLuaManager::LoadScriptInto(sol::environment& Env, const FString& Path) {
 
 void FLuaManager::Tick(double DeltaSeconds)
 {
+    FLuaScriptProfiler::Get().BeginFrame();
+
+    TickScripts(DeltaSeconds);
     CoroutineSchedular.Tick(DeltaSeconds);
 }
 
+bool FLuaManager::RegisterScriptTick(ULuaScriptComponent* Component, const FString& ScriptPath, const sol::protected_function& TickFunc)
+{
+    if (!Component || !TickFunc.valid() || !TickDispatcher.valid())
+    {
+        return false;
+    }
+
+    int32 GroupIndex = -1;
+    if (const int32* Found = TickGroupIndexByPath.Find(ScriptPath))
+    {
+        GroupIndex = *Found;
+    }
+    else
+    {
+        // 그룹은 제거하지 않으므로 인덱스가 고정된다 (디스패치 도중 추가돼도 안전)
+        GroupIndex = TickGroups.Emplace();
+        TickGroups[GroupIndex].ScriptPath = ScriptPath;
+        TickGroupIndexByPath.Add(ScriptPath, GroupIndex);
+    }
+
+    FLuaTickGroup& Group = TickGroups[GroupIndex];
+    Component->TickGroupIndex = GroupIndex;
+    Component->TickSlotIndex = Group.Components.Add(Component);
+    Group.TickFuncs.Add(TickFunc);
+    Group.bDirty = true;
+    return true;
+}
+
+void FLuaManager::UnregisterScriptTick(ULuaScriptComponent* Component)
+{
+    if (!Component || Component->TickGroupIndex < 0 || Component->TickGroupIndex >= TickGroups.Num())
+    {
+        return;
+    }
+
+    // 등록 시 기억한 (그룹, 슬롯)으로 바로 찾는다 (그룹이 비워진 뒤면 슬롯이 다를 수 있어 확인)
+    FLuaTickGroup& Group = TickGroups[Component->TickGroupIndex];
+    const int32 Index = Component->TickSlotIndex;
+    Component->TickGroupIndex = -1;
+    Component->TickSlotIndex = -1;
+    if (Index < 0 || Index >= Group.Components.Num() || Group.Components[Index] != Component)
+    {
+        return;
+    }
+
+    // 디스패치 도중일 수 있으므로 인덱스를 유지한 채 비우고, 진행 중인 루프도 건너뛰게 한다
+    Group.Components[Index] = nullptr;
+    Group.TickFuncs[Index] = sol::nil;
+    if (Group.DeltaTable.valid())
+    {
+        Group.DeltaTable.raw_set(Index + 1, false);
+    }
+    Group.bDirty = true;
+}
+
+void FLuaManager::RebuildTickGroup(FLuaTickGroup& Group)
+{
+    // nullptr 슬롯 압축
+    int32 WriteIndex = 0;
+    for (int32 ReadIndex = 0; ReadIndex < Group.Components.Num(); ++ReadIndex)
+    {
+        if (!Group.Components[ReadIndex])
+        {
+            continue;
+        }
+        if (WriteIndex != ReadIndex)
+        {
+            Group.Components[WriteIndex] = Group.Components[ReadIndex];
+            Group.TickFuncs[WriteIndex] = std::move(Group.TickFuncs[ReadIndex]);
+            Group.Components[WriteIndex]->TickSlotIndex = WriteIndex;
+        }
+        ++WriteIndex;
+    }
+    Group.Components.SetNum(WriteIndex);
+    Group.TickFuncs.SetNum(WriteIndex);
+
+    // 진행 중인 디스패치가 이전 테이블을 참조하고 있을 수 있으므로 새 테이블로 교체
+    Group.TickTable = Lua->create_table(WriteIndex, 0);
+    Group.DeltaTable = Lua->create_table(WriteIndex, 0);
+    for (int32 i = 0; i < WriteIndex; ++i)
+    {
+        Group.TickTable.raw_set(i + 1, Group.TickFuncs[i]);
+        Group.DeltaTable.raw_set(i + 1, false);
+    }
+    Group.bDirty = false;
+}
+
+void FLuaManager::TickScripts(double DeltaSeconds)
+{
+    TIME_PROFILE(Lua_ScriptTick)
+
+    if (!TickDispatcher.valid())
+    {
+        return;
+    }
+
+    FLuaScriptProfiler& Profiler = FLuaScriptProfiler::Get();
+
+    // Tick 도중 새 그룹이 추가될 수 있으므로 인덱스로 순회하고 호출 후에는 참조를 다시 얻는다
+    for (int32 GroupIndex = 0; GroupIndex < TickGroups.Num(); ++GroupIndex)
+    {
+        if (TickGroups[GroupIndex].bDirty)
+        {
+            RebuildTickGroup(TickGroups[GroupIndex]);
+        }
+
+        FLuaTickGroup& Group = TickGroups[GroupIndex];
+        const int32 Count = Group.Components.Num();
+        if (Count == 0)
+        {
+            continue;
+        }
+
+        // AActor::Tick 과 같은 조건으로 이번 프레임 델타 기록
+        uint32 NumTicking = 0;
+        for (int32 i = 0; i < Count; ++i)
+        {
+            ULuaScriptComponent* Component = Group.Components[i];
+            AActor* Owner = Component->GetOwner();
+            if (Owner && Owner->IsActorActive() && Owner->CanEverTick() && Component->IsComponentTickEnabled())
+            {
+                Group.DeltaTable.raw_set(i + 1, DeltaSeconds * Owner->GetCustomTimeDillation());
+                ++NumTicking;
+            }
+            else
+            {
+                Group.DeltaTable.raw_set(i + 1, false);
+            }
+        }
+
+        if (NumTicking == 0)
+        {
+            continue;
+        }
+
+        sol::table TickTable = Group.TickTable;
+        sol::table DeltaTable = Group.DeltaTable;
+
+        const uint64 StartCycles = FPlatformTime::Cycles64();
+        const uint64 StartAllocCount = Profiler.GetAllocCount();
+        const uint64 StartAllocBytes = Profiler.GetAllocBytes();
+
+        sol::protected_function_result Result = TickDispatcher(TickTable, DeltaTable, Count, TickErrors);
+
+        Profiler.AddDispatchCall();
+        Profiler.AddScriptSample(TickGroups[GroupIndex].ScriptPath, NumTicking,
+            FPlatformTime::Cycles64() - StartCycles,
+            Profiler.GetAllocCount() - StartAllocCount,
+            Profiler.GetAllocBytes() - StartAllocBytes);
+
+        if (!Result.valid())
+        {
+            sol::error Err = Result;
+            UE_LOG("[Lua][error] %s\n", Err.what());
+            continue;
+        }
+
+        const int32 ErrorCount = Result.get<int32>();
+        for (int32 ErrorIndex = 1; ErrorIndex <= ErrorCount; ++ErrorIndex)
+        {
+            const FString Message = TickErrors.raw_get_or<FString>(ErrorIndex, FString());
+            UE_LOG("[Lua][error] %s\n", Message.c_str());
+        }
+    }
+}
+
 void FLuaManager::ShutdownBeforeLuaClose()
 {
     CoroutineSchedular.ShutdownBeforeLuaClose();
+
+    TickGroups.Empty();
+    TickGroupIndexByPath.Empty();
+    TickErrors = sol::nil;
+    TickDispatcher = sol::nil;
     
     FLuaBindRegistry::Get().Reset();
+    ResetBoundClasses(Lua->lua_state());
     
     SharedLib = sol::nil;
 }
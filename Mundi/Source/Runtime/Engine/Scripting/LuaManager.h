@@ -5,6 +5,19 @@
 namespace sol { class state; }
 using state = sol::state;
 
+class ULuaScriptComponent;
+
+// 같은 스크립트 파일을 쓰는 컴포넌트 묶음, 프레임당 한 번의 보호 호출로 Tick을 디스패치한다
+struct FLuaTickGroup
+{
+    FString ScriptPath;
+    TArray<ULuaScriptComponent*> Components;         // 제거된 슬롯은 nullptr (재구성 시 압축)
+    TArray<sol::protected_function> TickFuncs;       // Components와 인덱스 일치
+    sol::table TickTable;                            // Lua 배열 1..N
+    sol::table DeltaTable;                           // Lua 배열 1..N, 이번 프레임 건너뛸 인스턴스는 false
+    bool bDirty = true;
+};
+
 class FLuaManager
 {
 public:
@@ -23,14 +36,28 @@ public:
     // Env 테이블에서 Name(함수 이름) 키를 조회해서 함수로 캐스팅
     static sol::protected_function GetFunc(sol::environment& Env, const char* Name);
     
-    void Tick(double DeltaSeconds);            // 내부에서 누적 TotalTime 관리
+    void Tick(double DeltaSeconds);            // 스크립트 Tick 디스패치 + 코루틴 (내부에서 누적 TotalTime 관리)
     void ShutdownBeforeLuaClose();             // 코루틴 abandon -> Tasks 비우기
     
+    // 스크립트 Tick 배치 등록 (ULuaScriptComponent BeginPlay/Cleanup에서 호출)
+    // 디스패처가 없으면 false -> 컴포넌트가 직접 Tick
+    bool RegisterScriptTick(ULuaScriptComponent* Component, const FString& ScriptPath, const sol::protected_function& TickFunc);
+    void UnregisterScriptTick(ULuaScriptComponent* Component);
+
     class FLuaCoroutineScheduler& GetScheduler() { return CoroutineSchedular; }
 
+private:
+    void TickScripts(double DeltaSeconds);
+    void RebuildTickGroup(FLuaTickGroup& Group);
+
 private:
     sol::state* Lua = nullptr;
     sol::table SharedLib;                         // 공용 유틸 테이블
 
+    sol::protected_function TickDispatcher;       // Lua 측 배치 디스패처 (그룹 내부 pcall 루프)
+    sol::table TickErrors;                        // 디스패처가 에러 메시지를 채우는 테이블
+    TArray<FLuaTickGroup> TickGroups;
+    TMap<FString, int32> TickGroupIndexByPath;
+
     FLuaCoroutineScheduler CoroutineSchedular;    // 씬 단위 Coroutine Manager
 };
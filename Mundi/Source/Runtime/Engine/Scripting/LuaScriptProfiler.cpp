@@ -0,0 +1,210 @@
+﻿#include "pch.h"
+#include "LuaScriptProfiler.h"
+#include "PlatformTime.h"
+
+FLuaScriptProfiler& FLuaScriptProfiler::Get()
+{
+	static FLuaScriptProfiler Instance;
+	return Instance;
+}
+
+void FLuaScriptProfiler::Attach(lua_State* L)
+{
+	if (!L || Shims.Contains(L))
+	{
+		return;
+	}
+
+	auto Shim = std::make_unique<FAllocatorShim>();
+	Shim->OriginalAlloc = lua_getallocf(L, &Shim->OriginalUserData);
+	lua_setallocf(L, &FLuaScriptProfiler::ProfilerAlloc, Shim.get());
+
+	ApplyHook(L);
+	Shims.emplace(L, std::move(Shim));
+}
+
+void FLuaScriptProfiler::Detach(lua_State* L)
+{
+	auto It = Shims.find(L);
+	if (It == Shims.end())
+	{
+		return;
+	}
+
+	lua_sethook(L, nullptr, 0, 0);
+	lua_setallocf(L, It->second->OriginalAlloc, It->second->OriginalUserData);
+	Shims.erase(It);
+	CallStacks.Empty();
+}
+
+void FLuaScriptProfiler::SetFunctionProfilingEnabled(bool bEnabled)
+{
+	if (bFunctionProfiling == bEnabled)
+	{
+		return;
+	}
+
+	bFunctionProfiling = bEnabled;
+	CallStacks.Empty();
+	CurrentFunctions.Empty();
+	LastFunctions.Empty();
+
+	for (auto& Pair : Shims)
+	{
+		ApplyHook(Pair.first);
+	}
+}
+
+void FLuaScriptProfiler::ApplyHook(lua_State* L) const
+{
+	// 이미 생성된 코루틴 스레드에는 적용되지 않고, 이후 생성되는 스레드는 Hook을 상속한다
+	if (bFunctionProfiling)
+	{
+		lua_sethook(L, &FLuaScriptProfiler::ProfilerHook, LUA_MASKCALL | LUA_MASKRET, 0);
+	}
+	else
+	{
+		lua_sethook(L, nullptr, 0, 0);
+	}
+}
+
+void FLuaScriptProfiler::BeginFrame()
+{
+	// 이전 프레임 결과 확정
+	LastScripts.Empty();
+	LastScripts.Reserve(CurrentScripts.Num());
+	LastTickedInstances = 0;
+	for (auto& Pair : CurrentScripts)
+	{
+		LastTickedInstances += Pair.second.InstanceCount;
+		LastScripts.Add(Pair.second);
+	}
+	LastScripts.Sort([](const FLuaScriptProfile& A, const FLuaScriptProfile& B) { return A.Milliseconds > B.Milliseconds; });
+	CurrentScripts.Empty();
+
+	LastFunctions.Empty();
+	for (auto& Pair : CurrentFunctions)
+	{
+		// 이름 캐시는 유지하고 카운터만 비운다
+		FLuaFunctionProfile& Profile = Pair.second;
+		if (Profile.CallCount > 0)
+		{
+			LastFunctions.Add(Profile);
+		}
+		Profile.CallCount = 0;
+		Profile.Milliseconds = 0.0;
+		Profile.AllocCount = 0;
+		Profile.AllocBytes = 0;
+	}
+	LastFunctions.Sort([](const FLuaFunctionProfile& A, const FLuaFunctionProfile& B) { return A.Milliseconds > B.Milliseconds; });
+
+	LastDispatchCalls = CurrentDispatchCalls;
+	CurrentDispatchCalls = 0;
+
+	LastFrameAllocCount = AllocCount - FrameStartAllocCount;
+	LastFrameAllocBytes = AllocBytes - FrameStartAllocBytes;
+	FrameStartAllocCount = AllocCount;
+	FrameStartAllocBytes = AllocBytes;
+}
+
+void FLuaScriptProfiler::AddScriptSample(const FString& ScriptPath, uint32 InstanceCount, uint64 Cycles, uint64 InAllocCount, uint64 InAllocBytes)
+{
+	FLuaScriptProfile& Profile = CurrentScripts[ScriptPath];
+	if (Profile.ScriptPath.empty())
+	{
+		Profile.ScriptPath = ScriptPath;
+	}
+	Profile.InstanceCount += InstanceCount;
+	Profile.Milliseconds += FPlatformTime::ToMilliseconds(Cycles);
+	Profile.AllocCount += InAllocCount;
+	Profile.AllocBytes += InAllocBytes;
+}
+
+void* FLuaScriptProfiler::ProfilerAlloc(void* UserData, void* Ptr, size_t OldSize, size_t NewSize)
+{
+	FAllocatorShim* Shim = static_cast<FAllocatorShim*>(UserData);
+	FLuaScriptProfiler& Profiler = Get();
+
+	// Ptr == nullptr 일 때 OldSize는 크기가 아니라 객체 타입이므로 무시
+	if (NewSize > 0)
+	{
+		if (!Ptr)
+		{
+			++Profiler.AllocCount;
+			Profiler.AllocBytes += NewSize;
+		}
+		else if (NewSize > OldSize)
+		{
+			++Profiler.AllocCount;
+			Profiler.AllocBytes += NewSize - OldSize;
+		}
+	}
+
+	return Shim->OriginalAlloc(Shim->OriginalUserData, Ptr, OldSize, NewSize);
+}
+
+void FLuaScriptProfiler::ProfilerHook(lua_State* L, lua_Debug* Ar)
+{
+	Get().OnHook(L, Ar);
+}
+
+void FLuaScriptProfiler::OnHook(lua_State* L, lua_Debug* Ar)
+{
+	const uint64 NowCycles = FPlatformTime::Cycles64();
+	TArray<FCallFrame>& Stack = CallStacks[L];
+
+	bool bTailCall = false;
+#ifdef LUA_HOOKTAILCALL
+	bTailCall = (Ar->event == LUA_HOOKTAILCALL);
+#endif
+
+	if (Ar->event == LUA_HOOKCALL || bTailCall)
+	{
+		if (!lua_getinfo(L, "f", Ar))
+		{
+			return;
+		}
+		const void* Function = lua_topointer(L, -1);
+		lua_pop(L, 1);
+
+		FLuaFunctionProfile& Profile = CurrentFunctions[Function];
+		if (Profile.Name.empty() && lua_getinfo(L, "Sn", Ar))
+		{
+			char Buffer[256];
+			sprintf_s(Buffer, sizeof(Buffer), "%s:%d %s", Ar->short_src, Ar->linedefined, Ar->name ? Ar->name : "?");
+			Profile.Name = Buffer;
+		}
+		++Profile.CallCount;
+
+		FCallFrame Frame;
+		Frame.Function = Function;
+		Frame.StartCycles = NowCycles;
+		Frame.StartAllocCount = AllocCount;
+		Frame.StartAllocBytes = AllocBytes;
+		Frame.bTailCall = bTailCall;
+		Stack.Add(Frame);
+	}
+	else if (Ar->event == LUA_HOOKRET)
+	{
+		// 꼬리 호출로 대체된 프레임은 Return 이벤트가 따로 오지 않으므로 함께 정리
+		while (!Stack.IsEmpty() && Stack.Last().bTailCall)
+		{
+			PopFrame(Stack, NowCycles);
+		}
+		if (!Stack.IsEmpty())
+		{
+			PopFrame(Stack, NowCycles);
+		}
+	}
+}
+
+void FLuaScriptProfiler::PopFrame(TArray<FCallFrame>& Stack, uint64 NowCycles)
+{
+	const FCallFrame Frame = Stack.Pop();
+	if (FLuaFunctionProfile* Profile = CurrentFunctions.Find(Frame.Function))
+	{
+		Profile->Milliseconds += FPlatformTime::ToMilliseconds(NowCycles - Frame.StartCycles);
+		Profile->AllocCount += AllocCount - Frame.StartAllocCount;
+		Profile->AllocBytes += AllocBytes - Frame.StartAllocBytes;
+	}
+}
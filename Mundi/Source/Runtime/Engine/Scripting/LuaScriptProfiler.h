@@ -0,0 +1,104 @@
+﻿#pragma once
+#include <sol/sol.hpp>
+
+// 스크립트 파일 단위 통계 (배치 Tick 디스패치 기준)
+struct FLuaScriptProfile
+{
+    FString ScriptPath;
+    uint32 InstanceCount = 0;
+    double Milliseconds = 0.0;
+    uint64 AllocCount = 0;
+    uint64 AllocBytes = 0;
+};
+
+// Lua 함수 단위 통계 (Call/Return Hook 기준, 하위 호출 포함 시간)
+struct FLuaFunctionProfile
+{
+    FString Name;                   // "Player.lua:42 Tick"
+    uint32 CallCount = 0;
+    double Milliseconds = 0.0;
+    uint64 AllocCount = 0;
+    uint64 AllocBytes = 0;
+};
+
+/**
+ * Lua 스크립트 프로파일러
+ * - 스크립트 단위: FLuaManager의 배치 Tick이 그룹마다 시간/할당을 보고
+ * - 함수 단위: lua_sethook(Call/Return)으로 측정, 오버헤드가 있으므로 켰을 때만 Hook 설치
+ * - 할당: lua_State의 할당자를 감싸 횟수/바이트를 센다 (항상 켜짐, 카운터 증가만 수행)
+ */
+class FLuaScriptProfiler
+{
+public:
+    static FLuaScriptProfiler& Get();
+
+    void Attach(lua_State* L);      // 할당자 래핑
+    void Detach(lua_State* L);      // 원래 할당자 복원 (lua_close 전에 호출)
+
+    void SetFunctionProfilingEnabled(bool bEnabled);
+    bool IsFunctionProfilingEnabled() const { return bFunctionProfiling; }
+
+    void BeginFrame();              // 지난 프레임 결과 확정 후 카운터 초기화 (배치 Tick 직전 호출)
+
+    void AddScriptSample(const FString& ScriptPath, uint32 InstanceCount, uint64 Cycles, uint64 AllocCount, uint64 AllocBytes);
+    void AddDispatchCall() { ++CurrentDispatchCalls; }
+
+    uint64 GetAllocCount() const { return AllocCount; }
+    uint64 GetAllocBytes() const { return AllocBytes; }
+
+    // 지난 프레임 결과 (시간 내림차순)
+    const TArray<FLuaScriptProfile>& GetScriptProfiles() const { return LastScripts; }
+    const TArray<FLuaFunctionProfile>& GetFunctionProfiles() const { return LastFunctions; }
+    uint32 GetDispatchCalls() const { return LastDispatchCalls; }
+    uint32 GetTickedInstances() const { return LastTickedInstances; }
+    uint64 GetFrameAllocCount() const { return LastFrameAllocCount; }
+    uint64 GetFrameAllocBytes() const { return LastFrameAllocBytes; }
+
+private:
+    FLuaScriptProfiler() = default;
+
+    struct FAllocatorShim
+    {
+        lua_Alloc OriginalAlloc = nullptr;
+        void* OriginalUserData = nullptr;
+    };
+
+    struct FCallFrame
+    {
+        const void* Function = nullptr;
+        uint64 StartCycles = 0;
+        uint64 StartAllocCount = 0;
+        uint64 StartAllocBytes = 0;
+        bool bTailCall = false;
+    };
+
+    static void* ProfilerAlloc(void* UserData, void* Ptr, size_t OldSize, size_t NewSize);
+    static void ProfilerHook(lua_State* L, lua_Debug* Ar);
+
+    void OnHook(lua_State* L, lua_Debug* Ar);
+    void ApplyHook(lua_State* L) const;
+    void PopFrame(TArray<FCallFrame>& Stack, uint64 NowCycles);
+
+private:
+    TMap<lua_State*, std::unique_ptr<FAllocatorShim>> Shims;
+    bool bFunctionProfiling = false;
+
+    // 할당 누적 카운터 (Lua는 단일 스레드에서만 돈다)
+    uint64 AllocCount = 0;
+    uint64 AllocBytes = 0;
+    uint64 FrameStartAllocCount = 0;
+    uint64 FrameStartAllocBytes = 0;
+
+    // 코루틴은 lua_State가 다르므로 스레드마다 호출 스택을 따로 둔다
+    TMap<lua_State*, TArray<FCallFrame>> CallStacks;
+    TMap<const void*, FLuaFunctionProfile> CurrentFunctions;
+    TMap<FString, FLuaScriptProfile> CurrentScripts;
+    uint32 CurrentDispatchCalls = 0;
+
+    TArray<FLuaScriptProfile> LastScripts;
+    TArray<FLuaFunctionProfile> LastFunctions;
+    uint32 LastDispatchCalls = 0;
+    uint32 LastTickedInstances = 0;
+    uint64 LastFrameAllocCount = 0;
+    uint64 LastFrameAllocBytes = 0;
+};
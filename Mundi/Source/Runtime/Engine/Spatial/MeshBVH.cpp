@@ -1,333 +1,477 @@
 ﻿#include "pch.h"
 #include "MeshBVH.h"
+#include <immintrin.h>
+
+namespace
+{
+	// SAH 비용: 노드 하나 방문 대비 삼각형 블록(4개) 판정 비용
+	constexpr float TraversalCost = 1.0f;
+	constexpr float BlockIntersectCost = 2.0f;
+
+	inline uint32 NumBlocksFor(uint32 TriangleCount)
+	{
+		return (TriangleCount + 3) / 4;
+	}
+
+	inline float HalfSurfaceArea(const FVector& Min, const FVector& Max)
+	{
+		const FVector Extent = Max - Min;
+		return Extent.X * Extent.Y + Extent.Y * Extent.Z + Extent.Z * Extent.X;
+	}
+
+	inline float SafeInverse(float Value)
+	{
+		// 축에 평행한 레이는 슬랩 경계에서 NaN이 나오지 않도록 큰 유한값으로 대체
+		return std::abs(Value) > 1e-8f ? 1.0f / Value : (Value < 0.0f ? -1e30f : 1e30f);
+	}
+
+	inline bool IntersectNode(const FMeshBVHNode& Node, const FVector& Origin, const FVector& InvDir, float MaxDistance, float& OutEnter)
+	{
+		const float X0 = (Node.Min[0] - Origin.X) * InvDir.X;
+		const float X1 = (Node.Max[0] - Origin.X) * InvDir.X;
+		const float Y0 = (Node.Min[1] - Origin.Y) * InvDir.Y;
+		const float Y1 = (Node.Max[1] - Origin.Y) * InvDir.Y;
+		const float Z0 = (Node.Min[2] - Origin.Z) * InvDir.Z;
+		const float Z1 = (Node.Max[2] - Origin.Z) * InvDir.Z;
+
+		const float Enter = std::max({ std::min(X0, X1), std::min(Y0, Y1), std::min(Z0, Z1) });
+		const float Exit = std::min({ std::max(X0, X1), std::max(Y0, Y1), std::max(Z0, Z1) });
+
+		OutEnter = Enter;
+		return Exit >= std::max(Enter, 0.0f) && Enter <= MaxDistance;
+	}
+}
 
 void FMeshBVH::Build(const TArray<FNormalVertex>& Vertices, const TArray<uint32>& Indices)
 {
-	TriIndices.Empty();
 	Nodes.Empty();
-	uint32 TriCount = Indices.Num() / 3;
-	if (TriCount == 0) return;
+	Blocks.Empty();
+	MaxDepth = 0;
+	NumTriangles = Indices.Num() / 3;
+	NumVertices = Vertices.Num();
+	if (NumTriangles == 0)
+	{
+		return;
+	}
 
-	TriIndices.Reserve(TriCount);
-	for (uint32 t = 0; t < TriCount; ++t)
-		TriIndices.Add(t);
+	// 삼각형별 AABB와 중심을 한 번만 계산해 둔다 (분할 중에는 정점 버퍼를 다시 읽지 않음)
+	BuildTriangles.SetNum(NumTriangles);
+	TriIndices.SetNum(NumTriangles);
+	for (uint32 TriangleID = 0; TriangleID < NumTriangles; ++TriangleID)
+	{
+		const FVector& A = Vertices[Indices[3 * TriangleID + 0]].pos;
+		const FVector& B = Vertices[Indices[3 * TriangleID + 1]].pos;
+		const FVector& C = Vertices[Indices[3 * TriangleID + 2]].pos;
+
+		FBuildTriangle& Triangle = BuildTriangles[TriangleID];
+		Triangle.Min = A.ComponentMin(B).ComponentMin(C);
+		Triangle.Max = A.ComponentMax(B).ComponentMax(C);
+		Triangle.Center = (A + B + C) / 3.0f;
+		TriIndices[TriangleID] = TriangleID;
+	}
+
+	BuildVertices = &Vertices;
+	BuildIndices = &Indices;
 
-	BuildRecursive(0, TriCount, Vertices, Indices);
+	Nodes.Reserve(NumTriangles * 2);
+	Blocks.Reserve(NumBlocksFor(NumTriangles) * 2);
+	Nodes.Add(FMeshBVHNode());
+	BuildNode(0, 0, NumTriangles, 0);
+
+	BuildVertices = nullptr;
+	BuildIndices = nullptr;
+	BuildTriangles.Empty();
+	BuildTriangles.shrink_to_fit();
+	TriIndices.Empty();
+	TriIndices.shrink_to_fit();
+	Nodes.shrink_to_fit();
+	Blocks.shrink_to_fit();
 }
 
-// 삼각형과 맞을 경우 , BVH를 따라 내려가면서 교차 가능성 있는 노드만 검사한다. 
-// Möller–Trumbore로 교차 체크 ! 
-bool FMeshBVH::IntersectRay(const FRay& InLocalRay,
-	const TArray<FNormalVertex>& InVertices,
-	const TArray<uint32>& InIndices,
-	float& OutHitDistance)
+void FMeshBVH::BuildNode(uint32 NodeIndex, uint32 Start, uint32 Count, uint32 Depth)
 {
-	if (Nodes.Num() == 0)
+	MaxDepth = std::max(MaxDepth, Depth);
+
+	// 노드 AABB와 삼각형 중심들의 AABB (빈 분할 기준)
+	const FBuildTriangle& First = BuildTriangles[TriIndices[Start]];
+	FAABB Bounds(First.Min, First.Max);
+	FAABB CenterBounds(First.Center, First.Center);
+	for (uint32 i = 1; i < Count; ++i)
 	{
-		return false;
+		const FBuildTriangle& Triangle = BuildTriangles[TriIndices[Start + i]];
+		Bounds.Min = Bounds.Min.ComponentMin(Triangle.Min);
+		Bounds.Max = Bounds.Max.ComponentMax(Triangle.Max);
+		CenterBounds.Min = CenterBounds.Min.ComponentMin(Triangle.Center);
+		CenterBounds.Max = CenterBounds.Max.ComponentMax(Triangle.Center);
 	}
 
-	float RootEntry, RootExit;
-	if (!Nodes[0].Bounds.IntersectsRay(InLocalRay, RootEntry, RootExit))
 	{
-		return false;
+		FMeshBVHNode& Node = Nodes[NodeIndex];
+		Node.Min[0] = Bounds.Min.X; Node.Min[1] = Bounds.Min.Y; Node.Min[2] = Bounds.Min.Z;
+		Node.Max[0] = Bounds.Max.X; Node.Max[1] = Bounds.Max.Y; Node.Max[2] = Bounds.Max.Z;
 	}
 
-	struct FHeapItem
+	// 블록 하나(4개 이하)면 분할해도 이득이 없고, 스택 깊이를 넘으면 그대로 리프로 둔다
+	if (Count <= 4 || Depth + 1 >= MaxTraversalDepth)
 	{
-		int NodeIndex;
-		float EntryDistance;
+		MakeLeaf(Nodes[NodeIndex], Start, Count);
+		return;
+	}
 
-		bool operator>(const FHeapItem& Other) const
-		{
-			return EntryDistance > Other.EntryDistance; // 최소 힙
-		}
-	};
+	int32 Axis = -1;
+	uint32 SplitBin = 0;
+	float SplitCost = FLT_MAX;
+	const bool bFoundSplit = FindSAHSplit(Start, Count, Bounds, CenterBounds, Axis, SplitBin, SplitCost);
 
-	std::priority_queue<FHeapItem, TArray<FHeapItem>, std::greater<FHeapItem>> Heap;
-	Heap.push({ 0, RootEntry });
+	const float LeafCost = static_cast<float>(NumBlocksFor(Count)) * BlockIntersectCost;
+	if ((!bFoundSplit || SplitCost >= LeafCost) && Count <= MaxLeafTriangles)
+	{
+		MakeLeaf(Nodes[NodeIndex], Start, Count);
+		return;
+	}
 
-	while (!Heap.empty())
+	uint32 LeftCount = 0;
+	if (bFoundSplit)
 	{
-		FHeapItem Current = Heap.top();
-		Heap.pop();
+		const float CenterMin = CenterBounds.Min[Axis];
+		const float BinScale = static_cast<float>(NumBins) / (CenterBounds.Max[Axis] - CenterBounds.Min[Axis]);
+		auto* Middle = std::partition(TriIndices.GetData() + Start, TriIndices.GetData() + Start + Count,
+			[&](uint32 TriangleID)
+			{
+				const uint32 Bin = std::min(NumBins - 1, static_cast<uint32>((BuildTriangles[TriangleID].Center[Axis] - CenterMin) * BinScale));
+				return Bin < SplitBin;
+			});
+		LeftCount = static_cast<uint32>(Middle - (TriIndices.GetData() + Start));
+	}
 
-		const FMeshBVHNode& Node = Nodes[Current.NodeIndex];
-		if (Node.IsLeaf())
+	// 중심이 모두 겹쳐 SAH 분할이 불가능하면 가장 긴 축 기준 중간값으로 나눈다
+	if (LeftCount == 0 || LeftCount == Count)
+	{
+		const FVector Extent = Bounds.Max - Bounds.Min;
+		Axis = (Extent.Y > Extent.X && Extent.Y >= Extent.Z) ? 1 : (Extent.Z > Extent.X ? 2 : 0);
+		LeftCount = Count / 2;
+		std::nth_element(TriIndices.begin() + Start, TriIndices.begin() + Start + LeftCount, TriIndices.begin() + Start + Count,
+			[&](uint32 A, uint32 B) { return BuildTriangles[A].Center[Axis] < BuildTriangles[B].Center[Axis]; });
+	}
+
+	// 두 자식은 연속으로 배치 (오른쪽 = LeftFirst + 1)
+	const uint32 LeftIndex = static_cast<uint32>(Nodes.Num());
+	Nodes.Add(FMeshBVHNode());
+	Nodes.Add(FMeshBVHNode());
+	Nodes[NodeIndex].LeftFirst = LeftIndex;
+	Nodes[NodeIndex].Count = 0;
+
+	BuildNode(LeftIndex, Start, LeftCount, Depth + 1);
+	BuildNode(LeftIndex + 1, Start + LeftCount, Count - LeftCount, Depth + 1);
+}
+
+// 축마다 중심 좌표를 NumBins개 구간으로 나누고, 구간 경계 중 SAH 비용이 가장 작은 곳을 찾는다
+bool FMeshBVH::FindSAHSplit(uint32 Start, uint32 Count, const FAABB& Bounds, const FAABB& CenterBounds, int32& OutAxis, uint32& OutSplitBin, float& OutCost) const
+{
+	struct FBin
+	{
+		FVector Min = FVector(FLT_MAX, FLT_MAX, FLT_MAX);
+		FVector Max = FVector(-FLT_MAX, -FLT_MAX, -FLT_MAX);
+		uint32 Count = 0;
+	};
+
+	const float ParentArea = HalfSurfaceArea(Bounds.Min, Bounds.Max);
+	if (ParentArea <= 0.0f)
+	{
+		return false;
+	}
+
+	bool bFound = false;
+	for (int32 Axis = 0; Axis < 3; ++Axis)
+	{
+		const float CenterMin = CenterBounds.Min[Axis];
+		const float CenterExtent = CenterBounds.Max[Axis] - CenterMin;
+		if (CenterExtent <= KINDA_SMALL_NUMBER)
 		{
-			for (uint32 TriOffset = 0; TriOffset < Node.Count; ++TriOffset)
-			{
-				const uint32 TriangleID = TriIndices[Node.Start + TriOffset];
-				const uint32 V0 = InIndices[3 * TriangleID + 0];
-				const uint32 V1 = InIndices[3 * TriangleID + 1];
-				const uint32 V2 = InIndices[3 * TriangleID + 2];
+			continue;
+		}
 
-				const FVector& A = InVertices[V0].pos;
-				const FVector& B = InVertices[V1].pos;
-				const FVector& C = InVertices[V2].pos;
+		FBin Bins[NumBins];
+		const float BinScale = static_cast<float>(NumBins) / CenterExtent;
+		for (uint32 i = 0; i < Count; ++i)
+		{
+			const FBuildTriangle& Triangle = BuildTriangles[TriIndices[Start + i]];
+			const uint32 BinIndex = std::min(NumBins - 1, static_cast<uint32>((Triangle.Center[Axis] - CenterMin) * BinScale));
+			FBin& Bin = Bins[BinIndex];
+			Bin.Min = Bin.Min.ComponentMin(Triangle.Min);
+			Bin.Max = Bin.Max.ComponentMax(Triangle.Max);
+			++Bin.Count;
+		}
 
-				float HitT = 0.0f;
-				if (IntersectRayTriangleMT(InLocalRay, A, B, C, HitT))
-				{
-					OutHitDistance = HitT;
-					return true; // 🚀 첫 번째 히트 → 바로 종료
-				}
-			}
+		// 왼쪽에서 누적한 면적/개수 (경계 i는 Bins[0..i) | Bins[i..NumBins))
+		float LeftArea[NumBins];
+		uint32 LeftCount[NumBins];
+		FVector AccumMin(FLT_MAX, FLT_MAX, FLT_MAX);
+		FVector AccumMax(-FLT_MAX, -FLT_MAX, -FLT_MAX);
+		uint32 AccumCount = 0;
+		for (uint32 i = 1; i < NumBins; ++i)
+		{
+			AccumMin = AccumMin.ComponentMin(Bins[i - 1].Min);
+			AccumMax = AccumMax.ComponentMax(Bins[i - 1].Max);
+			AccumCount += Bins[i - 1].Count;
+			LeftArea[i] = AccumCount > 0 ? HalfSurfaceArea(AccumMin, AccumMax) : 0.0f;
+			LeftCount[i] = AccumCount;
 		}
-		else
+
+		AccumMin = FVector(FLT_MAX, FLT_MAX, FLT_MAX);
+		AccumMax = FVector(-FLT_MAX, -FLT_MAX, -FLT_MAX);
+		AccumCount = 0;
+		for (uint32 i = NumBins - 1; i > 0; --i)
 		{
-			if (Node.Left >= 0)
+			AccumMin = AccumMin.ComponentMin(Bins[i].Min);
+			AccumMax = AccumMax.ComponentMax(Bins[i].Max);
+			AccumCount += Bins[i].Count;
+			if (AccumCount == 0 || LeftCount[i] == 0)
 			{
-				float ChildEntry, ChildExit;
-				if (Nodes[Node.Left].Bounds.IntersectsRay(InLocalRay, ChildEntry, ChildExit))
-				{
-					Heap.push({ Node.Left, ChildEntry });
-				}
+				continue;
 			}
-			if (Node.Right >= 0)
+
+			const float RightArea = HalfSurfaceArea(AccumMin, AccumMax);
+			const float Cost = TraversalCost + BlockIntersectCost *
+				(LeftArea[i] * static_cast<float>(NumBlocksFor(LeftCount[i])) + RightArea * static_cast<float>(NumBlocksFor(AccumCount))) / ParentArea;
+			if (Cost < OutCost)
 			{
-				float ChildEntry, ChildExit;
-				if (Nodes[Node.Right].Bounds.IntersectsRay(InLocalRay, ChildEntry, ChildExit))
-				{
-					Heap.push({ Node.Right, ChildEntry });
-				}
+				OutCost = Cost;
+				OutAxis = Axis;
+				OutSplitBin = i;
+				bFound = true;
 			}
 		}
 	}
-
-	return false;
-}
-//bool FMeshBVH::IntersectRay(const FRay& InLocalRay, const TArray<FNormalVertex>& InVertices, const TArray<uint32>& InIndices, float& OutHitDistance)
-//{
-//	if (Nodes.Num() == 0)
-//	{
-//		return false;
-//	}
-//
-//	TArray<FStackItem> NodeStack;
-//
-//	float RootEntryDistance, RootExitDistance;
-//	// 루트 노드가 안맞으면 바로 리턴 
-//	if (!Nodes[0].Bounds.RayAABB_IntersectT(InLocalRay, RootEntryDistance, RootExitDistance))
-//	{
-//		return false;
-//	}
-//	// 가장 늦게 나간 RootEntryDistance
-//	// 삼각형 리스트 인덱스 , 디스턴스 값 저장 
-//	NodeStack.Add({ 0, RootEntryDistance });
-//	bool bHasHit = false;
-//	float ClosestHitDistance = std::numeric_limits<float>::infinity();
-//
-//	// 깊이 우선 탐색 (DFS). 
-//	// 이미 더 가까운 교차가 있으면 멀리 있는 노드는 스킵.
-//	while (!NodeStack.IsEmpty())
-//	{
-//		const FStackItem CurrentItem = NodeStack.Pop();
-//		// 이미 가까운 교차가 있으면 무시 
-//		if (CurrentItem.EntryDistance > ClosestHitDistance)
-//		{
-//			continue;
-//		}
-//
-//		const FMeshBVHNode& CurrentNode = Nodes[CurrentItem.NodeIndex];
-//		if (CurrentNode.IsLeaf())
-//		{
-//			// 총 삼각형의 개수 만큼 돈다. 
-//			for (uint32 TriangleOffset = 0; TriangleOffset < CurrentNode.Count; ++TriangleOffset)
-//			{
-//				// 삼각형 배열에서 시작 위치 Start, TriangleOffset 삼각형의 총 개수만큼 돈다. 
-//				// 그쪽 영역의 삼각형이기 때문이다
-//				const uint32 TriangleID = TriIndices[CurrentNode.Start + TriangleOffset];
-//
-//				const uint32 VertexIndex0 = InIndices[3 * TriangleID + 0];
-//				const uint32 VertexIndex1 = InIndices[3 * TriangleID + 1];
-//				const uint32 VertexIndex2 = InIndices[3 * TriangleID + 2];
-//
-//				const FVector& VertexA = InVertices[VertexIndex0].pos;
-//				const FVector& VertexB = InVertices[VertexIndex1].pos;
-//				const FVector& VertexC = InVertices[VertexIndex2].pos;
-//
-//				float HitDistance = 0.0f;
-//				if (IntersectRayTriangleMT(InLocalRay, VertexA, VertexB, VertexC, HitDistance))
-//				{
-//					if (HitDistance < ClosestHitDistance)
-//					{
-//						ClosestHitDistance = HitDistance;
-//						bHasHit = true;
-//					}
-//				}
-//			}
-//			continue;
-//		}
-//
-//		// 내부 노드 → 자식 검사
-//		// 삼각형에 맞으면, 검사 영역에 넣어주고 맞지 않으면 넣어주지 않는다. 
-//		if (CurrentNode.Left >= 0)
-//		{
-//			float ChildEntry, ChildExit;
-//			if (Nodes[CurrentNode.Left].Bounds.RayAABB_IntersectT(InLocalRay, ChildEntry, ChildExit))
-//			{
-//				NodeStack.Add({ CurrentNode.Left, ChildEntry });
-//			}
-//		}
-//		if (CurrentNode.Right >= 0)
-//		{
-//			float ChildEntry, ChildExit;
-//			if (Nodes[CurrentNode.Right].Bounds.RayAABB_IntersectT(InLocalRay, ChildEntry, ChildExit))
-//			{
-//				NodeStack.Add({ CurrentNode.Right, ChildEntry });
-//			}
-//		}
-//	}
-//
-//	if (bHasHit)
-//	{
-//		OutHitDistance = ClosestHitDistance;
-//		return true;
-//	}
-//	return false;
-//}
-
-FAABB FMeshBVH::ComputeTriBounds(uint32 TriangleID, const TArray<FNormalVertex>& Vertices, const TArray<uint32>& Indices) const
-{
-	// TriangleID : 몇 번째 삼각형인지 (0번, 1번 , 2번)
-	uint32 VertexIndex0, VertexIndex1, VertexIndex2;
-
-	// 순차적으로 꺼내온다. 
-	VertexIndex0 = Indices[3 * TriangleID + 0];
-	VertexIndex1 = Indices[3 * TriangleID + 1];
-	VertexIndex2 = Indices[3 * TriangleID + 2];
-
-
-	// 실제 정점 좌표들을 가져온다. 
-	const FVector& VertexA = Vertices[VertexIndex0].pos;
-	const FVector& VertexB = Vertices[VertexIndex1].pos;
-	const FVector& VertexC = Vertices[VertexIndex2].pos;
-
-	// AABB 최소/최대 좌표 계산
-	FVector MinCorner(
-		std::min({ VertexA.X, VertexB.X, VertexC.X }),
-		std::min({ VertexA.Y, VertexB.Y, VertexC.Y }),
-		std::min({ VertexA.Z, VertexB.Z, VertexC.Z })
-	);
-
-	FVector MaxCorner(
-		std::max({ VertexA.X, VertexB.X, VertexC.X }),
-		std::max({ VertexA.Y, VertexB.Y, VertexC.Y }),
-		std::max({ VertexA.Z, VertexB.Z, VertexC.Z })
-	);
-
-	// 삼각형의 바운딩 박스 반환
-	return FAABB(MinCorner, MaxCorner);
+	return bFound;
 }
 
-FVector FMeshBVH::ComputeTriCenter(uint32 TriangleID, const TArray<FNormalVertex>& Vertices, const TArray<uint32>& Indices) const
+// 리프 삼각형을 SoA 블록으로 모은다. 빈 슬롯은 Edge가 0인 퇴화 삼각형이라 판정에서 항상 빠진다
+void FMeshBVH::MakeLeaf(FMeshBVHNode& Node, uint32 Start, uint32 Count)
 {
-	// 삼각형을 구성하는 세 개의 정점 인덱스
-	const uint32 VertexIndex0 = Indices[TriangleID * 3 + 0];
-	const uint32 VertexIndex1 = Indices[TriangleID * 3 + 1];
-	const uint32 VertexIndex2 = Indices[TriangleID * 3 + 2];
-
-	// 실제 좌표
-	const FVector& Position0 = Vertices[VertexIndex0].pos;
-	const FVector& Position1 = Vertices[VertexIndex1].pos;
-	const FVector& Position2 = Vertices[VertexIndex2].pos;
+	Node.LeftFirst = static_cast<uint32>(Blocks.Num());
+	Node.Count = Count;
 
-	// 중심점(무게중심) 계산
+	const TArray<FNormalVertex>& Vertices = *BuildVertices;
+	const TArray<uint32>& Indices = *BuildIndices;
 
-	const FVector TriangleCenter = (Position0 + Position1 + Position2) / 3.0f;
+	for (uint32 BlockStart = 0; BlockStart < Count; BlockStart += 4)
+	{
+		FMeshBVHTriangleBlock Block = {};
+		for (uint32 Lane = 0; Lane < 4; ++Lane)
+		{
+			if (BlockStart + Lane >= Count)
+			{
+				Block.TriangleIndex[Lane] = UINT32_MAX;
+				continue;
+			}
 
-	return TriangleCenter;
+			const uint32 TriangleID = TriIndices[Start + BlockStart + Lane];
+			const FVector& A = Vertices[Indices[3 * TriangleID + 0]].pos;
+			const FVector& B = Vertices[Indices[3 * TriangleID + 1]].pos;
+			const FVector& C = Vertices[Indices[3 * TriangleID + 2]].pos;
+			const FVector Edge1 = B - A;
+			const FVector Edge2 = C - A;
+
+			Block.V0X[Lane] = A.X;     Block.V0Y[Lane] = A.Y;     Block.V0Z[Lane] = A.Z;
+			Block.E1X[Lane] = Edge1.X; Block.E1Y[Lane] = Edge1.Y; Block.E1Z[Lane] = Edge1.Z;
+			Block.E2X[Lane] = Edge2.X; Block.E2Y[Lane] = Edge2.Y; Block.E2Z[Lane] = Edge2.Z;
+			Block.TriangleIndex[Lane] = TriangleID;
+		}
+		Blocks.Add(Block);
+	}
 }
 
-// 여러 삼각형을 한 번에 감싸는 AABB를 계산 
-FAABB FMeshBVH::ComputeBounds(uint32 Start, uint32 Count, const TArray<FNormalVertex>& Vertices, const TArray<uint32>& Indices) const
+// 가까운 자식부터 내려가고 먼 자식은 짧은 고정 스택에 넣는다.
+// 현재까지의 최근접 히트보다 먼 노드는 꺼낼 때 건너뛴다. 삼각형은 Möller–Trumbore를 4개씩 SSE로 판정한다
+bool FMeshBVH::IntersectRay(const FRay& InLocalRay, float& OutHitDistance, uint32* OutTriangleIndex) const
 {
-	// 첫 번째 삼각형 ID로 AABB 초기화 
-	FAABB Bounds = ComputeTriBounds(TriIndices[Start], Vertices, Indices);
-	// Start+1 ~ Start+Count-1 까지 모든 삼각형에 대해 반복 
-	// 가장 큰 MIN , MAX 찾아낸다. 
-	for (uint32 i = 1; i < Count; i++)
+	if (Nodes.IsEmpty())
 	{
-		FAABB TB = ComputeTriBounds(TriIndices[Start + i], Vertices, Indices);
-		Bounds.Min = Bounds.Min.ComponentMin(TB.Min);
-		Bounds.Max = Bounds.Max.ComponentMax(TB.Max);
+		return false;
 	}
-	return Bounds;
-}
 
-// BVH 트리 -> 재귀 구축 
-int FMeshBVH::BuildRecursive(uint32 Start, uint32 Count, const TArray<FNormalVertex>& Vertices, const TArray<uint32>& Indices)
-{
-	FMeshBVHNode Node;
-	Node.Start = Start;
-	Node.Count = Count;
+	const FVector& Origin = InLocalRay.Origin;
+	const FVector& Direction = InLocalRay.Direction;
+	const FVector InvDir(SafeInverse(Direction.X), SafeInverse(Direction.Y), SafeInverse(Direction.Z));
 
-	// 이 노드가 감싸는 AABB 계산
-	Node.Bounds = ComputeBounds(Start, Count, Vertices, Indices);
+	float ClosestDistance = FLT_MAX;
+	uint32 ClosestTriangle = UINT32_MAX;
 
-	// 현재 노드 인덱스 확보 & 추가 -> 자식으로 쪼갤 때 사용 
-	int NodeIndex = Nodes.Num();
-	Nodes.Add(Node);
-
-	// 리프 조건: 삼각형 개수가 LeafSize 이하
-	if (Count <= LeafSize)
+	float RootEnter;
+	if (!IntersectNode(Nodes[0], Origin, InvDir, ClosestDistance, RootEnter))
 	{
-		return NodeIndex;
+		return false;
 	}
 
-	// -------------------------------
-	// 분할 축 선택 (가장 긴 축)
-	// -------------------------------
-	FVector Extent = Node.Bounds.GetHalfExtent();
-	EAxis Axis = EAxis::X;
-
-	if (Extent.Y > Extent.X && Extent.Y >= Extent.Z)
-		Axis = EAxis::Y;
-	else if (Extent.Z > Extent.X && Extent.Z >= Extent.Y)
-		Axis = EAxis::Z;
-
-	// 중간 지점 -> 반으로 쪼갤 준비하기 
-	uint32 Mid = Start + Count / 2;
-
-	// -------------------------------
-	// 삼각형 중심 좌표 기준으로 분할
-	// -------------------------------
-	// 오른쪽 왼쪽으로 나누기 좋은 
-	// nth_element 가이드 
-	// nth_element(first, nth, last, comp)
-	// nth 위치에 "정렬했을 때 올 원소"를 제자리에 넣음
-	// 왼쪽 구간 [first, nth) 에는 그 원소보다 "작은 것들"만
-	// 오른쪽 구간 [nth+1, last) 에는 "큰 것들"만 놓음
-
-	// 선택된 Axis를 방향으로 왼쪽과 오른쪽으로 나눈다. 
-	// 전체를 정렬하지 않고, n번째 작은 원소를 찾아서 놓는다. 
-	std::nth_element(
-		TriIndices.begin() + Start, // 분할할 구간 시작
-		TriIndices.begin() + Mid, // 중간 값의 위치 
-		TriIndices.begin() + Start + Count, // 분할할 구간의 끝 
-		[&](uint32 A, uint32 B)			// 비교함수 
+	const __m128 OriginX = _mm_set1_ps(Origin.X);
+	const __m128 OriginY = _mm_set1_ps(Origin.Y);
+	const __m128 OriginZ = _mm_set1_ps(Origin.Z);
+	const __m128 DirX = _mm_set1_ps(Direction.X);
+	const __m128 DirY = _mm_set1_ps(Direction.Y);
+	const __m128 DirZ = _mm_set1_ps(Direction.Z);
+	const __m128 Epsilon = _mm_set1_ps(KINDA_SMALL_NUMBER);
+	const __m128 NegEpsilon = _mm_set1_ps(-KINDA_SMALL_NUMBER);
+	const __m128 OnePlusEpsilon = _mm_set1_ps(1.0f + KINDA_SMALL_NUMBER);
+	const __m128 SignMask = _mm_set1_ps(-0.0f);
+
+	struct FStackEntry
+	{
+		uint32 NodeIndex;
+		float EnterDistance;
+	};
+	FStackEntry Stack[MaxTraversalDepth];
+	int32 StackSize = 0;
+
+	uint32 NodeIndex = 0;
+	while (true)
+	{
+		const FMeshBVHNode& Node = Nodes[NodeIndex];
+		if (Node.IsLeaf())
 		{
-			FVector CenterA = ComputeTriCenter(A, Vertices, Indices);
-			FVector CenterB = ComputeTriCenter(B, Vertices, Indices);
+			const uint32 BlockEnd = Node.LeftFirst + NumBlocksFor(Node.Count);
+			for (uint32 BlockIndex = Node.LeftFirst; BlockIndex < BlockEnd; ++BlockIndex)
+			{
+				const FMeshBVHTriangleBlock& Block = Blocks[BlockIndex];
+				const __m128 E1X = _mm_load_ps(Block.E1X);
+				const __m128 E1Y = _mm_load_ps(Block.E1Y);
+				const __m128 E1Z = _mm_load_ps(Block.E1Z);
+				const __m128 E2X = _mm_load_ps(Block.E2X);
+				const __m128 E2Y = _mm_load_ps(Block.E2Y);
+				const __m128 E2Z = _mm_load_ps(Block.E2Z);
+
+				// P = Dir x Edge2, Det = Edge1 . P
+				const __m128 PX = _mm_sub_ps(_mm_mul_ps(DirY, E2Z), _mm_mul_ps(DirZ, E2Y));
+				const __m128 PY = _mm_sub_ps(_mm_mul_ps(DirZ, E2X), _mm_mul_ps(DirX, E2Z));
+				const __m128 PZ = _mm_sub_ps(_mm_mul_ps(DirX, E2Y), _mm_mul_ps(DirY, E2X));
+				const __m128 Det = _mm_add_ps(_mm_add_ps(_mm_mul_ps(E1X, PX), _mm_mul_ps(E1Y, PY)), _mm_mul_ps(E1Z, PZ));
+
+				// 평행(또는 빈 슬롯)이면 제외
+				__m128 Mask = _mm_cmpgt_ps(_mm_andnot_ps(SignMask, Det), Epsilon);
+				if (_mm_movemask_ps(Mask) == 0)
+				{
+					continue;
+				}
+				const __m128 InvDet = _mm_div_ps(_mm_set1_ps(1.0f), Det);
+
+				const __m128 TX = _mm_sub_ps(OriginX, _mm_load_ps(Block.V0X));
+				const __m128 TY = _mm_sub_ps(OriginY, _mm_load_ps(Block.V0Y));
+				const __m128 TZ = _mm_sub_ps(OriginZ, _mm_load_ps(Block.V0Z));
+
+				const __m128 U = _mm_mul_ps(_mm_add_ps(_mm_add_ps(_mm_mul_ps(TX, PX), _mm_mul_ps(TY, PY)), _mm_mul_ps(TZ, PZ)), InvDet);
+				Mask = _mm_and_ps(Mask, _mm_and_ps(_mm_cmpge_ps(U, NegEpsilon), _mm_cmple_ps(U, OnePlusEpsilon)));
+
+				// Q = T x Edge1
+				const __m128 QX = _mm_sub_ps(_mm_mul_ps(TY, E1Z), _mm_mul_ps(TZ, E1Y));
+				const __m128 QY = _mm_sub_ps(_mm_mul_ps(TZ, E1X), _mm_mul_ps(TX, E1Z));
+				const __m128 QZ = _mm_sub_ps(_mm_mul_ps(TX, E1Y), _mm_mul_ps(TY, E1X));
+
+				const __m128 V = _mm_mul_ps(_mm_add_ps(_mm_add_ps(_mm_mul_ps(DirX, QX), _mm_mul_ps(DirY, QY)), _mm_mul_ps(DirZ, QZ)), InvDet);
+				Mask = _mm_and_ps(Mask, _mm_and_ps(_mm_cmpge_ps(V, NegEpsilon), _mm_cmple_ps(_mm_add_ps(U, V), OnePlusEpsilon)));
+
+				const __m128 T = _mm_mul_ps(_mm_add_ps(_mm_add_ps(_mm_mul_ps(E2X, QX), _mm_mul_ps(E2Y, QY)), _mm_mul_ps(E2Z, QZ)), InvDet);
+				Mask = _mm_and_ps(Mask, _mm_and_ps(_mm_cmpgt_ps(T, Epsilon), _mm_cmplt_ps(T, _mm_set1_ps(ClosestDistance))));
 
-			switch (Axis)
+				const int32 HitBits = _mm_movemask_ps(Mask);
+				if (HitBits == 0)
+				{
+					continue;
+				}
+
+				alignas(16) float Distances[4];
+				_mm_store_ps(Distances, T);
+				for (int32 Lane = 0; Lane < 4; ++Lane)
+				{
+					if ((HitBits & (1 << Lane)) && Distances[Lane] < ClosestDistance)
+					{
+						ClosestDistance = Distances[Lane];
+						ClosestTriangle = Block.TriangleIndex[Lane];
+					}
+				}
+			}
+		}
+		else
+		{
+			const uint32 LeftIndex = Node.LeftFirst;
+			float LeftEnter, RightEnter;
+			const bool bHitLeft = IntersectNode(Nodes[LeftIndex], Origin, InvDir, ClosestDistance, LeftEnter);
+			const bool bHitRight = IntersectNode(Nodes[LeftIndex + 1], Origin, InvDir, ClosestDistance, RightEnter);
+
+			if (bHitLeft && bHitRight)
 			{
-			case EAxis::X: return CenterA.X < CenterB.X;
-			case EAxis::Y: return CenterA.Y < CenterB.Y;
-			case EAxis::Z: return CenterA.Z < CenterB.Z;
-			default:       return CenterA.X < CenterB.X;
+				// 가까운 쪽 먼저, 먼 쪽은 스택에
+				if (LeftEnter <= RightEnter)
+				{
+					Stack[StackSize++] = { LeftIndex + 1, RightEnter };
+					NodeIndex = LeftIndex;
+				}
+				else
+				{
+					Stack[StackSize++] = { LeftIndex, LeftEnter };
+					NodeIndex = LeftIndex + 1;
+				}
+				continue;
+			}
+			if (bHitLeft || bHitRight)
+			{
+				NodeIndex = bHitLeft ? LeftIndex : LeftIndex + 1;
+				continue;
 			}
-		});
+		}
 
-	// -------------------------------
-	// 내부 노드로 전환 & 자식 생성
-	// -------------------------------
-	// 자식 생성으로 본인 Count 초기화.
-	// Left, Right에 자식 달기 
-	Nodes[NodeIndex].Count = 0;
-	Nodes[NodeIndex].Left = BuildRecursive(Start, Mid - Start, Vertices, Indices);
-	Nodes[NodeIndex].Right = BuildRecursive(Mid, Start + Count - Mid, Vertices, Indices);
+		// 스택에서 아직 최근접 히트보다 가까운 노드를 꺼낸다
+		bool bHasNext = false;
+		while (StackSize > 0)
+		{
+			const FStackEntry& Entry = Stack[--StackSize];
+			if (Entry.EnterDistance <= ClosestDistance)
+			{
+				NodeIndex = Entry.NodeIndex;
+				bHasNext = true;
+				break;
+			}
+		}
+		if (!bHasNext)
+		{
+			break;
+		}
+	}
 
-	return NodeIndex;
+	if (ClosestTriangle == UINT32_MAX)
+	{
+		return false;
+	}
+
+	OutHitDistance = ClosestDistance;
+	if (OutTriangleIndex)
+	{
+		*OutTriangleIndex = ClosestTriangle;
+	}
+	return true;
+}
+
+FArchive& operator<<(FArchive& Ar, FMeshBVH& BVH)
+{
+	uint32 Version = FMeshBVH::CacheVersion;
+	Ar << Version;
+	if (Ar.IsLoading() && Version != FMeshBVH::CacheVersion)
+	{
+		throw std::runtime_error("BVH cache version mismatch.");
+	}
+
+	Ar << BVH.NumTriangles;
+	Ar << BVH.NumVertices;
+	Ar << BVH.MaxDepth;
+
+	if (Ar.IsSaving())
+	{
+		Serialization::WriteArray(Ar, BVH.Nodes);
+		Serialization::WriteArray(Ar, BVH.Blocks);
+	}
+	else if (Ar.IsLoading())
+	{
+		Serialization::ReadArray(Ar, BVH.Nodes);
+		Serialization::ReadArray(Ar, BVH.Blocks);
+	}
+	return Ar;
 }
@@ -1,47 +1,83 @@
 ﻿#pragma once
 #include "AABB.h"
 
+class FArchive;
+
+// 32바이트 평탄화 노드 (캐시 라인 하나에 두 개)
+// 내부 노드의 두 자식은 항상 연속으로 배치된다 (오른쪽 = LeftFirst + 1)
 struct FMeshBVHNode
 {
-	FAABB Bounds;     // 이 노드가 감싸는 AABB
-	int Left = -1;     // 왼쪽 자식 인덱스
-	int Right = -1;    // 오른쪽 자식 인덱스
-	uint32 Start = 0;  // TriIndices 배열에서 시작 위치
-	uint32 Count = 0;  // 리프 노드라면 포함된 삼각형 개수 
+	float Min[3];
+	uint32 LeftFirst = 0;	// 내부 노드: 왼쪽 자식 인덱스, 리프: 첫 삼각형 블록 인덱스
+	float Max[3];
+	uint32 Count = 0;		// 리프 노드라면 포함된 삼각형 개수 (0이면 내부 노드)
 
 	bool IsLeaf() const { return Count > 0; }
 };
+static_assert(sizeof(FMeshBVHNode) == 32, "FMeshBVHNode must stay 32 bytes");
 
-struct FStackItem
+// 삼각형 4개를 SoA로 미리 모아 둔 블록 (4-wide SIMD 교차 판정용)
+// 정점/인덱스 버퍼를 다시 읽지 않도록 V0와 두 Edge를 저장하고, 빈 슬롯은 퇴화 삼각형(Edge = 0)으로 채운다
+struct alignas(16) FMeshBVHTriangleBlock
 {
-	int32 NodeIndex;
-	float EntryDistance;
+	float V0X[4], V0Y[4], V0Z[4];
+	float E1X[4], E1Y[4], E1Z[4];
+	float E2X[4], E2Y[4], E2Z[4];
+	uint32 TriangleIndex[4];
 };
+
+/**
+ * 메시 단위 삼각형 BVH (피킹/데칼 투영/파티클 메시 충돌)
+ * - Binned SAH 빌드, 32바이트 노드, 짧은 고정 스택 순회 (가까운 자식 먼저, 최근접 히트로 가지치기)
+ * - 리프 삼각형은 SoA 블록으로 미리 모아 두고 SSE로 4개씩 판정한다
+ * - 빌드 결과는 메시 캐시 옆 .bvh.bin에 저장해 로드 시 다시 빌드하지 않는다 (UResourceManager::GetOrBuildMeshBVH)
+ */
 class FMeshBVH
 {
 public:
+	static constexpr uint32 CacheVersion = 1;
 
 	void Build(const TArray<FNormalVertex>& Vertices, const TArray<uint32>& Indices);
 
-	bool IntersectRay(const FRay& InLocalRay, const TArray<FNormalVertex>& InVertices, const TArray<uint32>& InIndices, float& OutHitDistance);
+	// 가장 가까운 교차 거리를 반환 (레이 방향 길이 기준), OutTriangleIndex는 원본 인덱스 버퍼 기준 삼각형 번호
+	bool IntersectRay(const FRay& InLocalRay, float& OutHitDistance, uint32* OutTriangleIndex = nullptr) const;
 
+	bool IsEmpty() const { return Nodes.IsEmpty(); }
+	uint32 GetNumTriangles() const { return NumTriangles; }
+	uint32 GetNumVertices() const { return NumVertices; }
+	int32 GetNumNodes() const { return Nodes.Num(); }
+	int32 GetNumBlocks() const { return Blocks.Num(); }
+	uint32 GetMaxDepth() const { return MaxDepth; }
 
-private:
-	// Helper 함수들
-	FAABB ComputeTriBounds(uint32 TriangleID, const TArray<FNormalVertex>& Vertices, const TArray<uint32>& Indices) const;
+	friend FArchive& operator<<(FArchive& Ar, FMeshBVH& BVH);
 
-	FVector ComputeTriCenter(uint32 TriangleID, const TArray<FNormalVertex>& Vertices, const TArray<uint32>& Indices) const;
-
-	FAABB ComputeBounds(uint32 Start, uint32 Count, const TArray<FNormalVertex>& Vertices, const TArray<uint32>& Indices) const;
+private:
+	struct FBuildTriangle
+	{
+		FVector Min;
+		FVector Max;
+		FVector Center;
+	};
 
-	int BuildRecursive(uint32 Start, uint32 Count, const TArray<FNormalVertex>& Vertices, const TArray<uint32>& Indices);
+	void BuildNode(uint32 NodeIndex, uint32 Start, uint32 Count, uint32 Depth);
+	bool FindSAHSplit(uint32 Start, uint32 Count, const FAABB& Bounds, const FAABB& CenterBounds, int32& OutAxis, uint32& OutSplitBin, float& OutCost) const;
+	void MakeLeaf(FMeshBVHNode& Node, uint32 Start, uint32 Count);
 
 private:
+	// 빌드 단계 임시 데이터 (빌드가 끝나면 비운다)
+	const TArray<FNormalVertex>* BuildVertices = nullptr;
+	const TArray<uint32>* BuildIndices = nullptr;
+	TArray<FBuildTriangle> BuildTriangles;
+	//삼각형 ID(번호) 목록 , 빌드 중 순서만 재배치하고 리프 블록을 채울 때 사용한다
+	TArray<uint32> TriIndices;
 
 	TArray<FMeshBVHNode> Nodes;
-	//삼각형 ID(번호) 목록 , 삼각형의 인덱스를 의미한다. 
-	//삼각형 순서만 재배치  , 정점 좌표와 인덱스 버퍼를 직접적으로 건들면 안되기 때문이다.
-	TArray<uint32> TriIndices;
-	const uint32 LeafSize = 4;
-};
+	TArray<FMeshBVHTriangleBlock> Blocks;
+	uint32 NumTriangles = 0;
+	uint32 NumVertices = 0;
+	uint32 MaxDepth = 0;
 
+	static constexpr uint32 NumBins = 16;
+	static constexpr uint32 MaxLeafTriangles = 8;		// SAH가 리프를 택해도 이보다 많으면 강제로 분할
+	static constexpr uint32 MaxTraversalDepth = 64;		// 순회 스택 크기 (빌드 깊이 제한)
+};
@@ -1,228 +1,581 @@
 ﻿#include "pch.h"
 #include "Occlusion.h"
-#include "Frustum.h"
+#include "PlatformTime.h"
+#include "Source/Runtime/Core/Async/TaskPool.h"
+#include <algorithm>
+#include <immintrin.h>
 
-// NDC Z가 [-1..1]인 프로젝션이면 아래 변환을 켜세요.
-// static inline float To01(float z_ndc) { return z_ndc * 0.5f + 0.5f; }
-static inline void Clamp01(float& v) { v = std::max(0.0f, std::min(1.0f, v)); }
+namespace
+{
+	// 오클루더 하나당 근평면 클리핑으로 삼각형이 최대 두 개로 나뉜다
+	constexpr int32 MaxTrianglesPerSource = 2;
+
+	// 근평면 (클립 공간 z = 0) 위의 교차점
+	inline FVector4 LerpClip(const FVector4& A, const FVector4& B)
+	{
+		const float T = A.Z / (A.Z - B.Z);
+		return FVector4(
+			A.X + (B.X - A.X) * T,
+			A.Y + (B.Y - A.Y) * T,
+			0.0f,
+			A.W + (B.W - A.W) * T);
+	}
+
+	inline __m128 LoadRow(const FMatrix& M, int32 Row)
+	{
+		return _mm_loadu_ps(M.M[Row]);
+	}
+}
+
+//====================================================================================
+// FOcclusionGrid
+//====================================================================================
+
+void FOcclusionGrid::Initialize(int InWidth, int InHeight)
+{
+	InWidth = std::max(1, InWidth);
+	InHeight = std::max(1, InHeight);
+	if (InWidth == Width && InHeight == Height && !Levels.IsEmpty())
+	{
+		return;
+	}
+
+	Width = InWidth;
+	Height = InHeight;
+	BufferWidth = (Width + TileWidth - 1) / TileWidth * TileWidth;
+	BufferHeight = (Height + TileHeight - 1) / TileHeight * TileHeight;
+
+	// 홀수 크기에서도 텍셀이 빠지지 않도록 올림으로 축소
+	Levels.Empty();
+	LevelWidths.Empty();
+	LevelHeights.Empty();
+	int32 W = BufferWidth, H = BufferHeight;
+	while (true)
+	{
+		Levels.Add(TArray<float>(size_t(W) * H, 1.0f));
+		LevelWidths.Add(W);
+		LevelHeights.Add(H);
+		if (W == 1 && H == 1)
+		{
+			break;
+		}
+		W = (W + 1) / 2;
+		H = (H + 1) / 2;
+	}
+}
 
-// 헬퍼: 뷰공간 Z → [0..1] 선형
-static inline float LinearizeZ01(float zView, float zNear, float zFar) {
-	// LH 기준, 카메라 앞 z가 + 방향일 때
-	float z = (zView - zNear) / (zFar - zNear);
-	return std::max(0.f, std::min(1.f, z));
+void FOcclusionGrid::Clear()
+{
+	std::fill(Levels[0].begin(), Levels[0].end(), 1.0f);
 }
 
-// FBound(Min/Max) → 8코너
-static inline void MakeAabbCornersMinMax(const FAABB& B, FVector Corners[8])
+void FOcclusionGrid::BuildHZB()
 {
-	const FVector& mn = B.Min;
-	const FVector& mx = B.Max;
-	Corners[0] = { mn.X, mn.Y, mn.Z };
-	Corners[1] = { mx.X, mn.Y, mn.Z };
-	Corners[2] = { mn.X, mx.Y, mn.Z };
-	Corners[3] = { mx.X, mx.Y, mn.Z };
-	Corners[4] = { mn.X, mn.Y, mx.Z };
-	Corners[5] = { mx.X, mn.Y, mx.Z };
-	Corners[6] = { mn.X, mx.Y, mx.Z };
-	Corners[7] = { mx.X, mx.Y, mx.Z };
+	for (int32 Level = 1; Level < Levels.Num(); ++Level)
+	{
+		const TArray<float>& Src = Levels[Level - 1];
+		TArray<float>& Dst = Levels[Level];
+		const int32 SW = LevelWidths[Level - 1], SH = LevelHeights[Level - 1];
+		const int32 DW = LevelWidths[Level], DH = LevelHeights[Level];
+
+		for (int32 y = 0; y < DH; ++y)
+		{
+			const float* Row0 = &Src[size_t(std::min(y * 2, SH - 1)) * SW];
+			const float* Row1 = &Src[size_t(std::min(y * 2 + 1, SH - 1)) * SW];
+			float* Out = &Dst[size_t(y) * DW];
+			for (int32 x = 0; x < DW; ++x)
+			{
+				const int32 X0 = std::min(x * 2, SW - 1);
+				const int32 X1 = std::min(x * 2 + 1, SW - 1);
+				Out[x] = std::max(std::max(Row0[X0], Row0[X1]), std::max(Row1[X0], Row1[X1]));
+			}
+		}
+	}
 }
 
-bool FOcclusionCullingManagerCPU::ComputeRectAndMinZ(
-	const FCandidateDrawable& D, int /*ViewW*/, int /*ViewH*/, FOcclusionRect& OutR)
+float FOcclusionGrid::SampleMaxRect(int32 MinPX, int32 MinPY, int32 MaxPX, int32 MaxPY) const
 {
-	FVector C[8];
-	MakeAabbCornersMinMax(D.Bound, C);
+	MinPX = std::max(0, MinPX); MinPY = std::max(0, MinPY);
+	MaxPX = std::min(BufferWidth - 1, MaxPX); MaxPY = std::min(BufferHeight - 1, MaxPY);
 
-	float MinX = +1e9f, MinY = +1e9f, MaxX = -1e9f, MaxY = -1e9f;
-	float MinZLin = +1e9f, MaxZLin = -1e9f; // ★ 선형 깊이(0..1)
+	// 2^Mip >= Extent / 2 → 한 축에 최대 3텍셀
+	const int32 Extent = std::max(MaxPX - MinPX + 1, MaxPY - MinPY + 1);
+	int32 Mip = 0;
+	while ((2 << Mip) < Extent)
+	{
+		++Mip;
+	}
+	Mip = std::min(Mip, Levels.Num() - 1);
 
-	int used = 0;
-	for (int i = 0; i < 8; i++)
+	const TArray<float>& L = Levels[Mip];
+	const int32 W = LevelWidths[Mip];
+	float MaxDepth = 0.0f;
+	for (int32 y = MinPY >> Mip; y <= (MaxPY >> Mip); ++y)
 	{
-		const float p[4] = { C[i].X, C[i].Y, C[i].Z, 1.0f };
+		const float* Row = &L[size_t(y) * W];
+		for (int32 x = MinPX >> Mip; x <= (MaxPX >> Mip); ++x)
+		{
+			MaxDepth = std::max(MaxDepth, Row[x]);
+		}
+	}
+	return MaxDepth;
+}
+
+//====================================================================================
+// FOcclusionCullingManagerCPU
+//====================================================================================
+
+void FOcclusionCullingManagerCPU::Shutdown()
+{
+	OccluderMeshes.Empty();
+	ClipVertices.Empty();
+	Triangles.Empty();
+	TileBins.Empty();
+}
 
-		// 1) 화면 사각형용: WVP → NDC
-		float c[4];
-		MulPointRow(p, D.WorldViewProj, c);
-		if (c[3] <= 0.0f) continue;
+const FOccluderMesh* FOcclusionCullingManagerCPU::GetOccluderMesh(const FStaticMesh* StaticMeshAsset)
+{
+	if (!StaticMeshAsset || StaticMeshAsset->Indices.Num() < 3)
+	{
+		return nullptr;
+	}
 
-		const float invW = 1.0f / c[3];
-		const float ndcX = c[0] * invW;  // -1..1
-		const float ndcY = c[1] * invW;  // -1..1
-		// const float ndcZ = c[2] * invW; // 깊이는 쓰지 않음
+	if (const FOccluderMesh* Found = OccluderMeshes.Find(StaticMeshAsset))
+	{
+		return Found;
+	}
 
-		const float u = 0.5f * (ndcX + 1.0f);
-		const float v = 0.5f * (ndcY + 1.0f);
+	// 노멀/UV 때문에 나뉜 정점을 위치 기준으로 합친다 (정렬 후 같은 위치끼리 묶기)
+	const TArray<FNormalVertex>& Vertices = StaticMeshAsset->Vertices;
+	TArray<uint32> Order;
+	Order.SetNum(Vertices.Num());
+	for (int32 i = 0; i < Vertices.Num(); ++i)
+	{
+		Order[i] = static_cast<uint32>(i);
+	}
+	Order.Sort([&Vertices](uint32 A, uint32 B)
+	{
+		const FVector& PA = Vertices[A].pos;
+		const FVector& PB = Vertices[B].pos;
+		if (PA.X != PB.X) return PA.X < PB.X;
+		if (PA.Y != PB.Y) return PA.Y < PB.Y;
+		return PA.Z < PB.Z;
+	});
+
+	FOccluderMesh& Mesh = OccluderMeshes[StaticMeshAsset];
+	TArray<uint32> Remap;
+	Remap.SetNum(Vertices.Num());
+	for (int32 i = 0; i < Order.Num(); ++i)
+	{
+		const FVector& Position = Vertices[Order[i]].pos;
+		const FVector* Last = Mesh.Positions.IsEmpty() ? nullptr : &Mesh.Positions.Last();
+		if (!Last || Last->X != Position.X || Last->Y != Position.Y || Last->Z != Position.Z)
+		{
+			Mesh.Positions.Add(Position);
+		}
+		Remap[Order[i]] = static_cast<uint32>(Mesh.Positions.Num() - 1);
+	}
 
-		MinX = std::min(MinX, u); MinY = std::min(MinY, v);
-		MaxX = std::max(MaxX, u); MaxY = std::max(MaxY, v);
+	const TArray<uint32>& Indices = StaticMeshAsset->Indices;
+	Mesh.Indices.Reserve(Indices.Num());
+	for (int32 i = 0; i + 2 < Indices.Num(); i += 3)
+	{
+		const uint32 I0 = Remap[Indices[i]];
+		const uint32 I1 = Remap[Indices[i + 1]];
+		const uint32 I2 = Remap[Indices[i + 2]];
+		if (I0 == I1 || I1 == I2 || I2 == I0)
+		{
+			continue;
+		}
+		Mesh.Indices.Add(I0);
+		Mesh.Indices.Add(I1);
+		Mesh.Indices.Add(I2);
+	}
+	return &Mesh;
+}
 
-		// 2) 깊이: WorldView로 뷰 공간 z → 선형 0..1
-		float v4[4];
-		MulPointRow(p, D.WorldView, v4);     // p_world * (World*View) == p_world * View (월드좌표니까 View만 와도 OK)
-		const float zView = v4[2];          // LH: +Z 앞
-		const float zLin01 = LinearizeZ01(zView, D.NearClip, D.FarClip);
+void FOcclusionCullingManagerCPU::SelectOccluders(TArray<FOccluderInstance>& InOutOccluders, int32 MaxCount)
+{
+	int32 NumKept = 0;
+	for (int32 i = 0; i < InOutOccluders.Num(); ++i)
+	{
+		const FOccluderInstance& Occluder = InOutOccluders[i];
+		if (Occluder.Mesh && Occluder.Mesh->GetNumTriangles() <= MaxOccluderTriangles && Occluder.ScreenSize >= MinOccluderScreenSize)
+		{
+			InOutOccluders[NumKept++] = Occluder;
+		}
+	}
+	InOutOccluders.SetNum(NumKept);
 
-		MinZLin = std::min(MinZLin, zLin01);
-		MaxZLin = std::max(MaxZLin, zLin01);
+	if (InOutOccluders.Num() > MaxCount)
+	{
+		std::nth_element(InOutOccluders.begin(), InOutOccluders.begin() + MaxCount, InOutOccluders.end(),
+			[](const FOccluderInstance& A, const FOccluderInstance& B) { return A.ScreenSize > B.ScreenSize; });
+		InOutOccluders.SetNum(MaxCount);
+	}
+}
 
-		used++;
+bool FOcclusionCullingManagerCPU::SetupTriangle(const FVector4& V0, const FVector4& V1, const FVector4& V2, FOcclusionTriangle& OutTriangle) const
+{
+	const float W = static_cast<float>(Grid.GetWidth());
+	const float H = static_cast<float>(Grid.GetHeight());
+
+	// NDC → 픽셀 (Y 아래 방향)
+	const float InvW0 = 1.0f / V0.W, InvW1 = 1.0f / V1.W, InvW2 = 1.0f / V2.W;
+	const float X0 = (V0.X * InvW0 * 0.5f + 0.5f) * W, Y0 = (0.5f - V0.Y * InvW0 * 0.5f) * H, Z0 = V0.Z * InvW0;
+	const float X1 = (V1.X * InvW1 * 0.5f + 0.5f) * W, Y1 = (0.5f - V1.Y * InvW1 * 0.5f) * H, Z1 = V1.Z * InvW1;
+	const float X2 = (V2.X * InvW2 * 0.5f + 0.5f) * W, Y2 = (0.5f - V2.Y * InvW2 * 0.5f) * H, Z2 = V2.Z * InvW2;
+
+	// 화면 기준 시계 방향(D3D 기본 앞면)만 남긴다
+	const float Area = (X1 - X0) * (Y2 - Y0) - (X2 - X0) * (Y1 - Y0);
+	if (!(Area > 0.0f))
+	{
+		return false;
 	}
 
-	if (used == 0) return false;
-	if (MaxX < 0 || MaxY < 0 || MinX > 1 || MinY > 1) return false;
+	const int32 MinX = std::max(0, static_cast<int32>(std::floor(std::min({ X0, X1, X2 }))));
+	const int32 MinY = std::max(0, static_cast<int32>(std::floor(std::min({ Y0, Y1, Y2 }))));
+	const int32 MaxX = std::min(Grid.GetBufferWidth() - 1, static_cast<int32>(std::ceil(std::max({ X0, X1, X2 }))));
+	const int32 MaxY = std::min(Grid.GetBufferHeight() - 1, static_cast<int32>(std::ceil(std::max({ Y0, Y1, Y2 }))));
+	if (MinX > MaxX || MinY > MaxY)
+	{
+		return false;
+	}
 
-	Clamp01(MinX); Clamp01(MinY); Clamp01(MaxX); Clamp01(MaxY);
-	Clamp01(MinZLin); Clamp01(MaxZLin);
+	// 에지 Vi→Vj는 나머지 정점 쪽이 양수, 픽셀 중심(+0.5)은 C에 미리 더해 둔다
+	const float PX[3] = { X0, X1, X2 };
+	const float PY[3] = { Y0, Y1, Y2 };
+	for (int32 Edge = 0; Edge < 3; ++Edge)
+	{
+		const int32 Next = (Edge + 1) % 3;
+		const float A = -(PY[Next] - PY[Edge]);
+		const float B = PX[Next] - PX[Edge];
+		OutTriangle.EdgeA[Edge] = A;
+		OutTriangle.EdgeB[Edge] = B;
+		OutTriangle.EdgeC[Edge] = -(A * PX[Edge] + B * PY[Edge]) + 0.5f * (A + B);
+	}
 
-	OutR.MinX = MinX; OutR.MinY = MinY; OutR.MaxX = MaxX; OutR.MaxY = MaxY;
-	OutR.MinZ = MinZLin;   // ★ 선형 깊이
-	OutR.MaxZ = MaxZLin;
-	OutR.ActorIndex = D.ActorIndex;
+	const float InvArea = 1.0f / Area;
+	OutTriangle.ZA = ((Z1 - Z0) * (Y2 - Y0) - (Z2 - Z0) * (Y1 - Y0)) * InvArea;
+	OutTriangle.ZB = ((Z2 - Z0) * (X1 - X0) - (Z1 - Z0) * (X2 - X0)) * InvArea;
+	OutTriangle.ZC = Z0 - OutTriangle.ZA * X0 - OutTriangle.ZB * Y0 + 0.5f * (OutTriangle.ZA + OutTriangle.ZB);
+	OutTriangle.MinZ = std::min({ Z0, Z1, Z2 });
+	OutTriangle.MinX = MinX;
+	OutTriangle.MinY = MinY;
+	OutTriangle.MaxX = MaxX;
+	OutTriangle.MaxY = MaxY;
 	return true;
 }
-void FOcclusionCullingManagerCPU::BuildOccluderDepth(
-	const TArray<FCandidateDrawable>& Occluders, int ViewW, int ViewH)
+
+int32 FOcclusionCullingManagerCPU::SetupOccluderTriangles(const FOccluderInstance& Occluder, FVector4* OutClipVertices, FOcclusionTriangle* OutTriangles) const
 {
-	Grid.Clear();
+	const FOccluderMesh& Mesh = *Occluder.Mesh;
+
+	// 행벡터: Clip = x * R0 + y * R1 + z * R2 + R3
+	const __m128 R0 = LoadRow(Occluder.WorldViewProj, 0);
+	const __m128 R1 = LoadRow(Occluder.WorldViewProj, 1);
+	const __m128 R2 = LoadRow(Occluder.WorldViewProj, 2);
+	const __m128 R3 = LoadRow(Occluder.WorldViewProj, 3);
+	for (int32 i = 0; i < Mesh.Positions.Num(); ++i)
+	{
+		const FVector& P = Mesh.Positions[i];
+		__m128 Clip = _mm_add_ps(_mm_mul_ps(_mm_set1_ps(P.X), R0), _mm_mul_ps(_mm_set1_ps(P.Y), R1));
+		Clip = _mm_add_ps(Clip, _mm_add_ps(_mm_mul_ps(_mm_set1_ps(P.Z), R2), R3));
+		_mm_store_ps(&OutClipVertices[i].X, Clip);
+	}
 
-	const int GW = Grid.GetWidth();
-	const int GH = Grid.GetHeight();
+	int32 NumTriangles = 0;
+	for (int32 i = 0; i + 2 < Mesh.Indices.Num(); i += 3)
+	{
+		const FVector4& V0 = OutClipVertices[Mesh.Indices[i]];
+		const FVector4& V1 = OutClipVertices[Mesh.Indices[i + 1]];
+		const FVector4& V2 = OutClipVertices[Mesh.Indices[i + 2]];
+
+		// 세 정점이 모두 같은 절두체 평면 밖이면 버린다
+		if ((V0.X > V0.W && V1.X > V1.W && V2.X > V2.W) || (V0.X < -V0.W && V1.X < -V1.W && V2.X < -V2.W) ||
+			(V0.Y > V0.W && V1.Y > V1.W && V2.Y > V2.W) || (V0.Y < -V0.W && V1.Y < -V1.W && V2.Y < -V2.W) ||
+			(V0.Z > V0.W && V1.Z > V1.W && V2.Z > V2.W) || (V0.Z < 0.0f && V1.Z < 0.0f && V2.Z < 0.0f))
+		{
+			continue;
+		}
 
-	// --- 튜닝 파라미터 ---
-	const float ErodeScale = 0.5f;     // 0.5배 축소
-	const int   Dilate = 1;        // 경계 1px 팽창
-	const int   MinPxEdge = 8;        // 너무 작은 사각형은 erosion 스킵
-	const float MaxCover = 0.6f;     // 화면의 60% 이상 덮으면 erosion 스킵
+		// 근평면(z >= 0) 클리핑, 앞쪽 정점 수에 따라 0~2개의 삼각형
+		const FVector4* In[3] = { &V0, &V1, &V2 };
+		FVector4 Polygon[4];
+		int32 NumPolygon = 0;
+		for (int32 Edge = 0; Edge < 3; ++Edge)
+		{
+			const FVector4& A = *In[Edge];
+			const FVector4& B = *In[(Edge + 1) % 3];
+			const bool bInsideA = A.Z >= 0.0f;
+			const bool bInsideB = B.Z >= 0.0f;
+			if (bInsideA)
+			{
+				Polygon[NumPolygon++] = A;
+			}
+			if (bInsideA != bInsideB)
+			{
+				Polygon[NumPolygon++] = LerpClip(A, B);
+			}
+		}
 
-	for (const auto& D : Occluders)
+		for (int32 Fan = 1; Fan + 1 < NumPolygon; ++Fan)
+		{
+			if (SetupTriangle(Polygon[0], Polygon[Fan], Polygon[Fan + 1], OutTriangles[NumTriangles]))
+			{
+				++NumTriangles;
+			}
+		}
+	}
+	return NumTriangles;
+}
+
+void FOcclusionCullingManagerCPU::BuildOccluderDepth(const TArray<FOccluderInstance>& Occluders)
+{
+	const uint64 StartCycles = FPlatformTime::Cycles64();
+
+	Grid.Clear();
+	Stats.NumOccluders = static_cast<uint32>(Occluders.Num());
+	Stats.NumOccluderTriangles = 0;
+
+	// --- 1. 오클루더별 작업 구간 배정 ---
+	const int32 NumOccluders = Occluders.Num();
+	VertexOffsets.SetNum(NumOccluders);
+	TriangleOffsets.SetNum(NumOccluders);
+	TriangleCounts.SetNum(NumOccluders);
+	int32 NumVertices = 0;
+	int32 MaxTriangles = 0;
+	for (int32 i = 0; i < NumOccluders; ++i)
 	{
-		FOcclusionRect R;
-		if (!ComputeRectAndMinZ(D, ViewW, ViewH, R))
-			continue;
+		VertexOffsets[i] = NumVertices;
+		TriangleOffsets[i] = MaxTriangles;
+		TriangleCounts[i] = 0;
+		if (Occluders[i].Mesh)
+		{
+			NumVertices += Occluders[i].Mesh->Positions.Num();
+			MaxTriangles += Occluders[i].Mesh->GetNumTriangles() * MaxTrianglesPerSource;
+		}
+	}
+	ClipVertices.SetNum(NumVertices);
+	Triangles.SetNum(MaxTriangles);
 
-		int minPX = (int)std::floor(R.MinX * GW);
-		int minPY = (int)std::floor(R.MinY * GH);
-		int maxPX = (int)std::ceil(R.MaxX * GW) - 1;
-		int maxPY = (int)std::ceil(R.MaxY * GH) - 1;
+	// --- 2. 변환 + 클리핑 + 셋업 (오클루더 단위 병렬) ---
+	FTaskPool::Get().ParallelFor(NumOccluders, 4, [this, &Occluders](int32 Begin, int32 End)
+	{
+		for (int32 i = Begin; i < End; ++i)
+		{
+			if (Occluders[i].Mesh)
+			{
+				TriangleCounts[i] = SetupOccluderTriangles(Occluders[i], ClipVertices.GetData() + VertexOffsets[i], Triangles.GetData() + TriangleOffsets[i]);
+			}
+		}
+	});
 
-		// --- 화면 사각형 erosion(오클루더 영향 완화) ---
-		int w = std::max(0, maxPX - minPX + 1);
-		int h = std::max(0, maxPY - minPY + 1);
-		const bool bigCover =
-			(w >= int(MaxCover * GW)) || (h >= int(MaxCover * GH));
-		if (ErodeScale < 1.0f && w >= MinPxEdge && h >= MinPxEdge && !bigCover)
+	// --- 3. 타일 비닝 (오클루더 순서대로 직렬) ---
+	const int32 NumTilesX = Grid.GetNumTilesX();
+	const int32 NumTiles = NumTilesX * Grid.GetNumTilesY();
+	TileBins.SetNum(NumTiles);
+	for (TArray<uint32>& Bin : TileBins)
+	{
+		Bin.Empty();
+	}
+	for (int32 i = 0; i < NumOccluders; ++i)
+	{
+		for (int32 t = 0; t < TriangleCounts[i]; ++t)
 		{
-			const float cx = 0.5f * float(minPX + maxPX);
-			const float cy = 0.5f * float(minPY + maxPY);
-			const float hw = 0.5f * float(w) * ErodeScale;
-			const float hh = 0.5f * float(h) * ErodeScale;
+			const uint32 TriangleIndex = static_cast<uint32>(TriangleOffsets[i] + t);
+			const FOcclusionTriangle& Tri = Triangles[TriangleIndex];
+			const int32 MinTileX = Tri.MinX / FOcclusionGrid::TileWidth;
+			const int32 MaxTileX = Tri.MaxX / FOcclusionGrid::TileWidth;
+			const int32 MinTileY = Tri.MinY / FOcclusionGrid::TileHeight;
+			const int32 MaxTileY = Tri.MaxY / FOcclusionGrid::TileHeight;
+			for (int32 TileY = MinTileY; TileY <= MaxTileY; ++TileY)
+			{
+				for (int32 TileX = MinTileX; TileX <= MaxTileX; ++TileX)
+				{
+					TileBins[TileY * NumTilesX + TileX].Add(TriangleIndex);
+				}
+			}
+		}
+		Stats.NumOccluderTriangles += static_cast<uint32>(TriangleCounts[i]);
+	}
 
-			minPX = int(std::floor(cx - hw));
-			maxPX = int(std::ceil(cx + hw));
-			minPY = int(std::floor(cy - hh));
-			maxPY = int(std::ceil(cy + hh));
+	// --- 4. 타일 래스터 (타일끼리는 픽셀이 겹치지 않으므로 잠금 없음) ---
+	FTaskPool::Get().ParallelFor(NumTiles, 2, [this](int32 Begin, int32 End)
+	{
+		for (int32 TileIndex = Begin; TileIndex < End; ++TileIndex)
+		{
+			RasterizeTile(TileIndex);
 		}
+	});
 
+	Stats.RasterMs = FPlatformTime::ToMilliseconds(FPlatformTime::Cycles64() - StartCycles);
+}
 
-		// 화면 경계 클램프
-		minPX = std::max(0, std::min(GW - 1, minPX));
-		minPY = std::max(0, std::min(GH - 1, minPY));
-		maxPX = std::max(0, std::min(GW - 1, maxPX));
-		maxPY = std::max(0, std::min(GH - 1, maxPY));
-		if (minPX > maxPX || minPY > maxPY) continue;
+void FOcclusionCullingManagerCPU::RasterizeTile(int32 TileIndex)
+{
+	const TArray<uint32>& Bin = TileBins[TileIndex];
+	if (Bin.IsEmpty())
+	{
+		return;
+	}
+
+	const int32 NumTilesX = Grid.GetNumTilesX();
+	const int32 TileMinX = (TileIndex % NumTilesX) * FOcclusionGrid::TileWidth;
+	const int32 TileMinY = (TileIndex / NumTilesX) * FOcclusionGrid::TileHeight;
+	const int32 TileMaxX = TileMinX + FOcclusionGrid::TileWidth - 1;
+	const int32 TileMaxY = TileMinY + FOcclusionGrid::TileHeight - 1;
+	const int32 Stride = Grid.GetBufferWidth();
+	float* Depth = Grid.GetDepthData();
+
+	const __m128 LaneOffset = _mm_setr_ps(0.0f, 1.0f, 2.0f, 3.0f);
+	const __m128 Zero = _mm_setzero_ps();
 
-		Grid.RasterizeRectDepthMin(minPX, minPY, maxPX, maxPY, R.MaxZ);
+	for (uint32 TriangleIndex : Bin)
+	{
+		const FOcclusionTriangle& Tri = Triangles[TriangleIndex];
+		const int32 MinX = std::max(Tri.MinX, TileMinX) & ~3;	// 4픽셀 정렬 (타일 폭이 4의 배수)
+		const int32 MaxX = std::min(Tri.MaxX, TileMaxX);
+		const int32 MinY = std::max(Tri.MinY, TileMinY);
+		const int32 MaxY = std::min(Tri.MaxY, TileMaxY);
+
+		const __m128 A0 = _mm_set1_ps(Tri.EdgeA[0]), A1 = _mm_set1_ps(Tri.EdgeA[1]), A2 = _mm_set1_ps(Tri.EdgeA[2]);
+		const __m128 StepE0 = _mm_set1_ps(Tri.EdgeA[0] * 4.0f);
+		const __m128 StepE1 = _mm_set1_ps(Tri.EdgeA[1] * 4.0f);
+		const __m128 StepE2 = _mm_set1_ps(Tri.EdgeA[2] * 4.0f);
+		const __m128 StepZ = _mm_set1_ps(Tri.ZA * 4.0f);
+		const __m128 MinZ = _mm_set1_ps(Tri.MinZ);
+		const __m128 StartX = _mm_add_ps(_mm_set1_ps(static_cast<float>(MinX)), LaneOffset);
+
+		for (int32 y = MinY; y <= MaxY; ++y)
+		{
+			const float FY = static_cast<float>(y);
+			__m128 E0 = _mm_add_ps(_mm_mul_ps(A0, StartX), _mm_set1_ps(Tri.EdgeB[0] * FY + Tri.EdgeC[0]));
+			__m128 E1 = _mm_add_ps(_mm_mul_ps(A1, StartX), _mm_set1_ps(Tri.EdgeB[1] * FY + Tri.EdgeC[1]));
+			__m128 E2 = _mm_add_ps(_mm_mul_ps(A2, StartX), _mm_set1_ps(Tri.EdgeB[2] * FY + Tri.EdgeC[2]));
+			__m128 Z = _mm_add_ps(_mm_mul_ps(_mm_set1_ps(Tri.ZA), StartX), _mm_set1_ps(Tri.ZB * FY + Tri.ZC));
+
+			float* Row = Depth + size_t(y) * Stride;
+			for (int32 x = MinX; x <= MaxX; x += 4)
+			{
+				const __m128 Inside = _mm_and_ps(_mm_and_ps(_mm_cmpge_ps(E0, Zero), _mm_cmpge_ps(E1, Zero)), _mm_cmpge_ps(E2, Zero));
+				if (_mm_movemask_ps(Inside) != 0)
+				{
+					const __m128 Old = _mm_loadu_ps(Row + x);
+					const __m128 New = _mm_min_ps(Old, _mm_max_ps(Z, MinZ));
+					_mm_storeu_ps(Row + x, _mm_or_ps(_mm_and_ps(Inside, New), _mm_andnot_ps(Inside, Old)));
+				}
+				E0 = _mm_add_ps(E0, StepE0);
+				E1 = _mm_add_ps(E1, StepE1);
+				E2 = _mm_add_ps(E2, StepE2);
+				Z = _mm_add_ps(Z, StepZ);
+			}
+		}
 	}
 }
 
-// 2) 후보 가시성 판정(HZB 샘플)
-void FOcclusionCullingManagerCPU::TestOcclusion(const TArray<FCandidateDrawable>& Candidates, int ViewW, int ViewH, TArray<uint8_t>& OutVisibleFlags)
+void FOcclusionCullingManagerCPU::BuildHZB()
 {
-	const float eps = 2e-3f;  // 1차 바이어스
-	const float eps2 = 2 * eps;  // 레벨0 재검증 바이어스(조금 더 큼)
-	// --- 크기 보장 ---
-	uint32_t maxId = 0;
-	for (auto& c : Candidates) maxId = std::max(maxId, c.ActorIndex);
-
-	if (OutVisibleFlags.size() <= maxId) OutVisibleFlags.resize(maxId + 1, 1);
-	if (VisibleStreak.size() <= maxId) VisibleStreak.resize(maxId + 1, 0);
-	if (OccludedStreak.size() <= maxId) OccludedStreak.resize(maxId + 1, 0);
-	if (LastState.size() <= maxId) LastState.resize(maxId + 1, 1); // 초기=보임
-
-	for (const auto& D : Candidates)
-	{
-		uint32_t id = D.ActorIndex;
-
-		FOcclusionRect R;
-		if (!ComputeRectAndMinZ(D, ViewW, ViewH, R))
-		{
-			// 화면 밖(또는 w<=0 코너만) → 가려짐으로 처리
-			OutVisibleFlags[id] = 0;
-			// streak 업데이트 (선택): occluded 누적
-			OccludedStreak[id] = std::min<uint8_t>(255, OccludedStreak[id] + 1);
-			VisibleStreak[id] = 0;
-			LastState[id] = 0;
-			continue;
-		}
+	const uint64 StartCycles = FPlatformTime::Cycles64();
+	Grid.BuildHZB();
+	Stats.HZBMs = FPlatformTime::ToMilliseconds(FPlatformTime::Cycles64() - StartCycles);
+}
 
-		const float rw = std::max(0.0f, R.MaxX - R.MinX);
-		const float rh = std::max(0.0f, R.MaxY - R.MinY);
-		const float pxW = rw * GetGrid().GetWidth();
-		const float pxH = rh * GetGrid().GetHeight();
+FOcclusionCullingManagerCPU::EOcclusionResult FOcclusionCullingManagerCPU::TestCandidate(const FCandidateDrawable& Candidate) const
+{
+	const FVector& Min = Candidate.Bound.Min;
+	const FVector& Max = Candidate.Bound.Max;
+	const FMatrix& M = Candidate.WorldViewProj;
+
+	// 8코너 = X축 항 2개 + Y축 항 2개 + (Z축 항 + 이동) 2개의 조합
+	const __m128 AxisX[2] = { _mm_mul_ps(_mm_set1_ps(Min.X), LoadRow(M, 0)), _mm_mul_ps(_mm_set1_ps(Max.X), LoadRow(M, 0)) };
+	const __m128 AxisY[2] = { _mm_mul_ps(_mm_set1_ps(Min.Y), LoadRow(M, 1)), _mm_mul_ps(_mm_set1_ps(Max.Y), LoadRow(M, 1)) };
+	const __m128 AxisZ[2] = {
+		_mm_add_ps(_mm_mul_ps(_mm_set1_ps(Min.Z), LoadRow(M, 2)), LoadRow(M, 3)),
+		_mm_add_ps(_mm_mul_ps(_mm_set1_ps(Max.Z), LoadRow(M, 2)), LoadRow(M, 3)) };
+
+	const float W = static_cast<float>(Grid.GetWidth());
+	const float H = static_cast<float>(Grid.GetHeight());
+	float MinSX = FLT_MAX, MinSY = FLT_MAX, MaxSX = -FLT_MAX, MaxSY = -FLT_MAX;
+	float NearestZ = FLT_MAX;
+	int32 NumBehindNear = 0;
+	for (int32 Corner = 0; Corner < 8; ++Corner)
+	{
+		alignas(16) float Clip[4];
+		_mm_store_ps(Clip, _mm_add_ps(_mm_add_ps(AxisX[Corner & 1], AxisY[(Corner >> 1) & 1]), AxisZ[Corner >> 2]));
 
-		// --- 작은 사각형 가드: 한 변이라도 2px 미만이면 컬링하지 않음 ---
-		if (std::min(pxW, pxH) < 2.0f)
+		if (Clip[2] < 0.0f)
 		{
-			OutVisibleFlags[id] = 1;
-			VisibleStreak[id] = std::min<uint8_t>(255, VisibleStreak[id] + 1);
-			OccludedStreak[id] = 0;
-			LastState[id] = 1;
+			++NumBehindNear;
 			continue;
 		}
 
-		// --- 보수적 mip 선택 ---
-		int mip = std::max(0, Grid.ChooseMip(rw, rh) - 1);
-		if (pxW < 48.0f || pxH < 48.0f)
-			mip = std::max(0, mip - 1);
+		const float InvW = 1.0f / Clip[3];
+		const float SX = (Clip[0] * InvW * 0.5f + 0.5f) * W;
+		const float SY = (0.5f - Clip[1] * InvW * 0.5f) * H;
+		MinSX = std::min(MinSX, SX); MaxSX = std::max(MaxSX, SX);
+		MinSY = std::min(MinSY, SY); MaxSY = std::max(MaxSY, SY);
+		NearestZ = std::min(NearestZ, Clip[2] * InvW);
+	}
 
+	// 전부 근평면 뒤면 화면 밖, 일부만 넘어가면 화면 사각형이 정의되지 않으므로 보임
+	if (NumBehindNear == 8)
+	{
+		return EOcclusionResult::Offscreen;
+	}
+	if (NumBehindNear > 0)
+	{
+		return EOcclusionResult::Visible;
+	}
 
-		// --- MAX HZB 적응형 샘플 ---
-		const float hzbMax = Grid.SampleMaxRectAdaptive(R.MinX, R.MinY, R.MaxX, R.MaxY, mip);
+	if (MaxSX < 0.0f || MaxSY < 0.0f || MinSX >= W || MinSY >= H || NearestZ > 1.0f)
+	{
+		return EOcclusionResult::Offscreen;
+	}
 
-		bool occluded = ((hzbMax + eps) <= R.MinZ);
+	// 걸치는 픽셀을 모두 포함하는 사각형
+	const int32 MinPX = std::max(0, static_cast<int32>(std::floor(MinSX)));
+	const int32 MinPY = std::max(0, static_cast<int32>(std::floor(MinSY)));
+	const int32 MaxPX = std::min(Grid.GetWidth() - 1, static_cast<int32>(std::floor(MaxSX)));
+	const int32 MaxPY = std::min(Grid.GetHeight() - 1, static_cast<int32>(std::floor(MaxSY)));
 
-		// --- 레벨0 정밀 재검증(occluded일 때만) ---
-		if (occluded)
-		{
-			if (!Grid.FullyOccludedAtLevel0(R.MinX, R.MinY, R.MaxX, R.MaxY, R.MinZ, eps2))
-				occluded = false;
-		}
+	const float HZBMax = Grid.SampleMaxRect(MinPX, MinPY, MaxPX, MaxPY);
+	return NearestZ > HZBMax ? EOcclusionResult::Occluded : EOcclusionResult::Visible;
+}
 
-		// --- 양방향 히스테리시스(2~3프레임 연속일 때만 상태 전환) ---
-		const int thresh = 2; // 2~3 추천
+void FOcclusionCullingManagerCPU::TestOcclusion(const TArray<FCandidateDrawable>& Candidates, TArray<uint8_t>& OutVisibleFlags)
+{
+	const uint64 StartCycles = FPlatformTime::Cycles64();
 
-		if (occluded)
-		{
-			OccludedStreak[id] = std::min<uint8_t>(255, OccludedStreak[id] + 1);
-			VisibleStreak[id] = 0;
+	uint32_t MaxId = 0;
+	for (const FCandidateDrawable& Candidate : Candidates)
+	{
+		MaxId = std::max(MaxId, Candidate.ActorIndex);
+	}
+	if (!Candidates.IsEmpty() && OutVisibleFlags.Num() <= static_cast<int32>(MaxId))
+	{
+		OutVisibleFlags.resize(MaxId + 1, 1);
+	}
 
-			// 직전이 보임이면, thresh 미만 동안은 보임 유지
-			if (LastState[id] == 1 && OccludedStreak[id] < thresh)
-				occluded = false;
-		}
-		else
+	CandidateResults.SetNum(Candidates.Num());
+	FTaskPool::Get().ParallelFor(Candidates.Num(), 64, [this, &Candidates, &OutVisibleFlags](int32 Begin, int32 End)
+	{
+		for (int32 i = Begin; i < End; ++i)
 		{
-			VisibleStreak[id] = std::min<uint8_t>(255, VisibleStreak[id] + 1);
-			OccludedStreak[id] = 0;
-
-			// 직전이 가려짐이면, thresh 미만 동안은 가려짐 유지
-			if (LastState[id] == 0 && VisibleStreak[id] < thresh)
-				occluded = true;
+			const EOcclusionResult Result = TestCandidate(Candidates[i]);
+			CandidateResults[i] = Result;
+			OutVisibleFlags[Candidates[i].ActorIndex] = (Result == EOcclusionResult::Visible) ? 1 : 0;
 		}
+	});
 
-		LastState[id] = occluded ? 0 : 1;
-		OutVisibleFlags[id] = occluded ? 0 : 1;
+	Stats.NumCandidates = static_cast<uint32>(Candidates.Num());
+	Stats.NumOccluded = 0;
+	Stats.NumOffscreen = 0;
+	for (EOcclusionResult Result : CandidateResults)
+	{
+		Stats.NumOccluded += (Result == EOcclusionResult::Occluded) ? 1 : 0;
+		Stats.NumOffscreen += (Result == EOcclusionResult::Offscreen) ? 1 : 0;
 	}
-}
\ No newline at end of file
+
+	Stats.TestMs = FPlatformTime::ToMilliseconds(FPlatformTime::Cycles64() - StartCycles);
+}
@@ -1,257 +1,155 @@
 ﻿#pragma once
+#include "AABB.h"
 
-struct FVector;
-struct FVector4;
-struct FMatrix; // row-major, p' = p * M 가정(네 컨벤션대로)
-struct FAABB; // AABB
+struct FStaticMesh;
 
+// 오클루전 후보 (오클루디), 월드 AABB를 투영해 HZB와 비교한다
 struct FCandidateDrawable
 {
-    uint32_t ActorIndex;   // VisibleFlags 인덱스
+    uint32_t ActorIndex;   // OutVisibleFlags 인덱스
     FAABB   Bound;        // 월드 AABB (Min/Max)
-    FMatrix  WorldViewProj;// 행벡터 기준 WVP
-    FMatrix  WorldView;    // ★ 추가: World-space * View  (여기서는 View만 주면 됨)
-    float    NearClip;        // ★ 추가
-    float    FarClip;         // ★ 추가
+    FMatrix  WorldViewProj;// 행벡터 기준 WVP (Bound가 월드 공간이므로 ViewProj)
 };
 
-// 교체 (MaxZ 추가)
-struct FOcclusionRect
+// 오클루더 전용 메시: 위치가 같은 정점을 합치고 퇴화 삼각형을 뺀 위치 + 인덱스
+struct FOccluderMesh
 {
-    float MinX, MinY, MaxX, MaxY; // [0..1]
-    float MinZ;                   // 가장 가까운
-    float MaxZ;                   // 가장 먼      <<--- 추가
-    uint32_t ActorIndex;
+    TArray<FVector> Positions;
+    TArray<uint32> Indices;
+
+    int32 GetNumTriangles() const { return Indices.Num() / 3; }
 };
 
-// 저해상도 깊이맵 + HZB(min) - CPU 전용
-class FOcclusionGrid
+// 이번 프레임에 래스터화할 오클루더 (메시 + 월드 * 뷰 * 프로젝션)
+struct FOccluderInstance
 {
-public:
-    void Initialize(int InWidth, int InHeight)
-    {
-        Width = InWidth; Height = InHeight;
-        // 교체: 1.0f (Far)
-        Depth.assign(size_t(Width * Height), 1.0f);
-        BuildLevels.clear();
-    }
-    void Clear()
-    {
-        // Clear 도 동일하게 1.0f로
-        std::fill(Depth.begin(), Depth.end(), 1.0f);
-        BuildLevels.clear();
-    }
-
-    /*
-        왜 R.MaxZ를 쓰는데 min 누적을 하나?
-
-        오클루더 AABB가 두껍거나 경계 근사 때문에 일부 픽셀이 원래보다 더 멀게 잡힐 수 있다.
-
-        레벨0은 per-pixel 가장 가까운 오클루더가 들어가야 하므로, 여러 오클루더가 겹칠 때 **min(current, MaxZ)**로 더 가까운 값으로만 낮춘다.
-
-        이렇게 해야 상위 레벨의 MAX 피라미드가 보수적이 됨(=오버컬링 방지).
-    */
-
-    void RasterizeRectDepthMin(int MinPX, int MinPY, int MaxPX, int MaxPY, float MaxZ)
-    {
-        MinPX = std::max(0, MinPX); MinPY = std::max(0, MinPY);
-        MaxPX = std::min(Width - 1, MaxPX); MaxPY = std::min(Height - 1, MaxPY);
-        for (int y = MinPY; y <= MaxPY; ++y)
-        {
-            float* Row = &Depth[size_t(y) * Width];
-            for (int x = MinPX; x <= MaxPX; ++x)
-            {
-                Row[x] = std::min(Row[x], MaxZ); // 가장 가까운 깊이로 갱신
-            }
-        }
-    }
-
-    void BuildHZB()
-    {
-        BuildLevels.clear();
-        BuildLevels.push_back(Depth); // level 0
-
-        int W = Width, H = Height;
-        while (W > 1 || H > 1)
-        {
-            int NW = std::max(1, W >> 1);
-            int NH = std::max(1, H >> 1);
-            TArray<float> Next(size_t(NW * NH), +FLT_MAX);
-
-            for (int y = 0; y < NH; ++y)
-                for (int x = 0; x < NW; ++x)
-                {
-                    int sx = x * 2, sy = y * 2;
-                    float a = SampleSafe(BuildLevels.back(), W, H, sx + 0, sy + 0);
-                    float b = SampleSafe(BuildLevels.back(), W, H, sx + 1, sy + 0);
-                    float c = SampleSafe(BuildLevels.back(), W, H, sx + 0, sy + 1);
-                    float d = SampleSafe(BuildLevels.back(), W, H, sx + 1, sy + 1);
-                    Next[size_t(y) * NW + x] = std::max(std::max(a, b), std::max(c, d));
-                }
-            BuildLevels.push_back(std::move(Next));
-            W = NW; H = NH;
-        }
-    }
-
-    int ChooseMip(float RectW01, float RectH01) const
-    {
-        float pxW = RectW01 * Width;
-        float pxH = RectH01 * Height;
-        float s = std::max(pxW, pxH);
-        int mip = int(std::floor(std::log2(std::max(1.0f, s))));
-        mip = std::max(0, std::min(mip, int(BuildLevels.size() - 1)));
-        return mip;
-    }
-
-    float SampleMaxRect(float MinX01, float MinY01, float MaxX01, float MaxY01, int Mip) const
-    {
-        const TArray<float>& L = BuildLevels[size_t(Mip)];
-        int W = std::max(1, Width >> Mip);
-        int H = std::max(1, Height >> Mip);
-
-        auto ToPx = [&](float u, float v)->std::pair<int, int> {
-            int x = int(u * W + 0.5f);
-            int y = int(v * H + 0.5f);
-            x = std::max(0, std::min(W - 1, x));
-            y = std::max(0, std::min(H - 1, y));
-            return { x,y };
-            };
-        auto Smp = [&](float u, float v)->float {
-            auto [x, y] = ToPx(u, v);
-            return L[size_t(y) * W + x];
-            };
+    const FOccluderMesh* Mesh = nullptr;
+    FMatrix WorldViewProj;
+    float ScreenSize = 0.0f;            // 월드 경계 반지름 / 거리 (오클루더 선택 기준)
+};
 
-        float cx = 0.5f * (MinX01 + MaxX01);
-        float cy = 0.5f * (MinY01 + MaxY01);
+// 화면 공간 삼각형 셋업 결과 (픽셀 단위, 픽셀 중심 보정 포함)
+// - 에지 함수 E(x, y) = A * x + B * y + C 가 세 개 모두 0 이상이면 안쪽
+// - 깊이 Z(x, y) = ZA * x + ZB * y + ZC (NDC 0..1, 1이 Far)
+struct FOcclusionTriangle
+{
+    float EdgeA[3], EdgeB[3], EdgeC[3];
+    float ZA, ZB, ZC;
+    float MinZ;                         // 보간 오차로 더 가까워지지 않도록 하한
+    int32 MinX, MinY, MaxX, MaxY;       // 버퍼 안으로 클램프된 픽셀 범위 (포함)
+};
 
-        float s0 = Smp(cx, cy);
-        float s1 = Smp(MinX01, MinY01);
-        float s2 = Smp(MaxX01, MinY01);
-        float s3 = Smp(MinX01, MaxY01);
-        float s4 = Smp(MaxX01, MaxY01);
+struct FOcclusionStats
+{
+    uint32 NumOccluders = 0;
+    uint32 NumOccluderTriangles = 0;    // 클리핑/백페이스 제거 후 실제로 비닝된 삼각형
+    uint32 NumCandidates = 0;
+    uint32 NumOccluded = 0;             // HZB에 가려진 후보
+    uint32 NumOffscreen = 0;            // 화면 밖 (절두체 밖) 후보
+    double RasterMs = 0.0;              // 변환 + 비닝 + 타일 래스터
+    double HZBMs = 0.0;
+    double TestMs = 0.0;
+};
 
-        return std::max(s0, std::max(s1, std::max(s2, std::max(s3, s4)))); // ★ MAX
-    }
-    // FOcclusionGrid 내부에 추가
-    float SampleMaxRectAdaptive(float MinX01, float MinY01, float MaxX01, float MaxY01, int Mip) const
-    {
-        const TArray<float>& L = BuildLevels[size_t(Mip)];
-        const int W = std::max(1, Width >> Mip);
-        const int H = std::max(1, Height >> Mip);
+// 저해상도 깊이 버퍼 + HZB(MAX) - CPU 전용
+// - 버퍼 폭/높이는 타일 배수로 올려 잡고, 크기가 바뀔 때만 다시 할당한다
+// - Levels[0]이 깊이 버퍼 자체이고, 상위 레벨은 2x2 최댓값 (가장 먼 깊이)
+class FOcclusionGrid
+{
+public:
+    static constexpr int32 TileWidth = 32;     // SIMD 4픽셀 단위로 나눠 떨어져야 함
+    static constexpr int32 TileHeight = 16;
 
-        auto ToPx = [&](float u, float v)->std::pair<int, int> {
-            int x = int(u * W + 0.5f);
-            int y = int(v * H + 0.5f);
-            x = std::max(0, std::min(W - 1, x));
-            y = std::max(0, std::min(H - 1, y));
-            return { x,y };
-            };
-        auto Smp = [&](float u, float v)->float {
-            auto [x, y] = ToPx(u, v);
-            return L[size_t(y) * W + x];
-            };
+    void Initialize(int InWidth, int InHeight);
 
-        // 샘플 밀도: 화면 픽셀 크기에 비례 (최대 5x5)
-        const int grid = ((MaxX01 - MinX01) * Width + (MaxY01 - MinY01) * Height > 80) ? 5 :
-            ((MaxX01 - MinX01) * Width + (MaxY01 - MinY01) * Height > 30) ? 4 : 3;
+    // 깊이 버퍼를 Far(1.0)로
+    void Clear();
 
-        float best = 0.0f; // MAX 피라미드이므로 최댓값을 모음
-        for (int j = 0; j < grid; j++)
-        {
-            float v = std::lerp(MinY01, MaxY01, (grid == 1) ? 0.5f : float(j) / (grid - 1));
-            for (int i = 0; i < grid; i++)
-            {
-                float u = std::lerp(MinX01, MaxX01, (grid == 1) ? 0.5f : float(i) / (grid - 1));
-                best = std::max(best, Smp(u, v));
-            }
-        }
-        return best;
-    }
-    // FOcclusionGrid 내부에 추가 (레벨0 정밀 검사)
-    bool FullyOccludedAtLevel0(float MinX01, float MinY01, float MaxX01, float MaxY01, float MinZ, float eps2) const
-    {
-        const TArray<float>& L0 = BuildLevels[0];
-        const int W = Width, H = Height;
+    // 미리 잡아 둔 레벨에 MAX 피라미드를 채운다
+    void BuildHZB();
 
-        int x0 = std::max(0, std::min(W - 1, int(MinX01 * W)));
-        int y0 = std::max(0, std::min(H - 1, int(MinY01 * H)));
-        int x1 = std::max(0, std::min(W - 1, int(MaxX01 * W)));
-        int y1 = std::max(0, std::min(H - 1, int(MaxY01 * H)));
+    // 픽셀 사각형(포함)을 완전히 덮는 HZB 텍셀들의 최댓값 (한 축에 최대 3텍셀이 되는 레벨 선택)
+    float SampleMaxRect(int32 MinPX, int32 MinPY, int32 MaxPX, int32 MaxPY) const;
 
-        // 너무 큰 박스는 샘플링 간격을 둠 (성능)
-        const int maxScan = 128 * 128; // 임계 픽셀수
-        int w = std::max(1, x1 - x0 + 1);
-        int h = std::max(1, y1 - y0 + 1);
-        int step = (w * h > maxScan) ? 2 : 1;
+    float* GetDepthData() { return Levels[0].data(); }
+    const float* GetDepthData() const { return Levels[0].data(); }
 
-        for (int y = y0; y <= y1; y += step)
-        {
-            const float* row = &L0[size_t(y) * W];
-            for (int x = x0; x <= x1; x += step)
-            {
-                float z = row[x];           // 레벨0의 MAX-기반 값(=멀리 기록한 것들의 min 축약 결과 아님!)
-                // 주의: 우리는 base에 'MaxZ를 min으로 누적'시켰고, HZB는 최대화했음.
-                // 레벨0에서도 보수성 유지: z + eps2 <= MinZ 일 때만 occluded 픽셀로 간주.
-                if (z + eps2 > MinZ)
-                    return false; // 한 픽셀이라도 덮여있지 않음 → 전체 가림 실패
-            }
-        }
-        return true; // 전부 덮임
-    }
     int GetWidth()  const { return Width; }
     int GetHeight() const { return Height; }
-
-
-private:
-    static float SampleSafe(const TArray<float>& L, int W, int H, int X, int Y)
-    {
-        X = std::max(0, std::min(W - 1, X));
-        Y = std::max(0, std::min(H - 1, Y));
-        return L[size_t(Y) * W + X];
-    }
+    int GetBufferWidth() const { return BufferWidth; }
+    int GetBufferHeight() const { return BufferHeight; }
+    int32 GetNumTilesX() const { return BufferWidth / TileWidth; }
+    int32 GetNumTilesY() const { return BufferHeight / TileHeight; }
+    int32 GetNumLevels() const { return Levels.Num(); }
 
 private:
-    int Width = 0, Height = 0;
-    TArray<float> Depth;                     // level 0
-    TArray<TArray<float>> BuildLevels;  // [0..N-1], min chain
-
-
+    int Width = 0, Height = 0;                  // 뷰 기준 해상도
+    int BufferWidth = 0, BufferHeight = 0;      // 타일 배수로 올린 크기
+    TArray<TArray<float>> Levels;               // [0] = 깊이, [1..] = MAX 축소
+    TArray<int32> LevelWidths;
+    TArray<int32> LevelHeights;
 };
 
 // CPU 오클루전 매니저
+// - 오클루더 변환/클리핑/삼각형 셋업은 오클루더 단위, 래스터는 타일 단위로 워커 스레드에 나눈다
+// - 후보 판정은 AABB 8코너를 SIMD로 투영하고, 가장 가까운 깊이가 HZB 최댓값보다 멀 때만 가림으로 본다
+//   (코너 하나라도 근평면 뒤면 보임, 오클루더는 백페이스를 버리므로 항상 보수적)
 class FOcclusionCullingManagerCPU
 {
 public:
+    static constexpr int32 MaxOccluders = 64;
+    static constexpr int32 MaxOccluderTriangles = 1024;    // 용접 후 삼각형 수가 이보다 많은 메시는 오클루더로 쓰지 않음
+    static constexpr float MinOccluderScreenSize = 0.1f;
+
     void Initialize(int GridW, int GridH) { Grid.Initialize(GridW, GridH); }
-    void Shutdown() {}
+    void Shutdown();
+
+    // 스태틱 메시 에셋 → 오클루더 메시 (처음 요청 시 한 번 만들어 캐시)
+    const FOccluderMesh* GetOccluderMesh(const FStaticMesh* StaticMeshAsset);
+
+    // 삼각형 예산/최소 화면 크기를 통과한 것 중 화면에서 큰 순으로 MaxCount개만 남긴다
+    static void SelectOccluders(TArray<FOccluderInstance>& InOutOccluders, int32 MaxCount = MaxOccluders);
 
-    // 1) 오클루더로 저해상도 Depth 채우기
-    void BuildOccluderDepth(const TArray<FCandidateDrawable>& Occluders, int ViewW, int ViewH);
+    // 1) 오클루더 삼각형으로 저해상도 Depth 채우기
+    void BuildOccluderDepth(const TArray<FOccluderInstance>& Occluders);
 
     // 2) CPU HZB
-    void BuildHZB() { Grid.BuildHZB(); }
+    void BuildHZB();
 
-    // 3) 후보 가시성 판정
-    void TestOcclusion(const TArray<FCandidateDrawable>& Candidates, int ViewW, int ViewH, TArray<uint8_t>& OutVisibleFlags);
+    // 3) 후보 가시성 판정 (OutVisibleFlags[ActorIndex] = 0이면 가려짐 또는 화면 밖)
+    void TestOcclusion(const TArray<FCandidateDrawable>& Candidates, TArray<uint8_t>& OutVisibleFlags);
 
     const FOcclusionGrid& GetGrid() const { return Grid; }
+    const FOcclusionStats& GetStats() const { return Stats; }
 
 private:
-    // AABB(Min/Max) → 화면 사각형 + MinZ (★이제 MinZ는 '선형 깊이 0..1')
-    static bool ComputeRectAndMinZ(const FCandidateDrawable& D, int ViewW, int ViewH, FOcclusionRect& OutRect);
-
-    // 행벡터: Out = In(1x4) * M(4x4)
-    static inline void MulPointRow(const float In[4], const FMatrix& M, float Out[4])
+    enum class EOcclusionResult : uint8
     {
-        Out[0] = In[0] * M.M[0][0] + In[1] * M.M[1][0] + In[2] * M.M[2][0] + In[3] * M.M[3][0];
-        Out[1] = In[0] * M.M[0][1] + In[1] * M.M[1][1] + In[2] * M.M[2][1] + In[3] * M.M[3][1];
-        Out[2] = In[0] * M.M[0][2] + In[1] * M.M[1][2] + In[2] * M.M[2][2] + In[3] * M.M[3][2];
-        Out[3] = In[0] * M.M[0][3] + In[1] * M.M[1][3] + In[2] * M.M[2][3] + In[3] * M.M[3][3];
-    }
+        Visible,
+        Occluded,
+        Offscreen
+    };
+
+    // 오클루더 하나를 클립 공간으로 변환하고 근평면 클리핑 + 백페이스 제거 후 삼각형 셋업
+    int32 SetupOccluderTriangles(const FOccluderInstance& Occluder, FVector4* ClipVertices, FOcclusionTriangle* OutTriangles) const;
+    bool SetupTriangle(const FVector4& V0, const FVector4& V1, const FVector4& V2, FOcclusionTriangle& OutTriangle) const;
+
+    void RasterizeTile(int32 TileIndex);
+
+    EOcclusionResult TestCandidate(const FCandidateDrawable& Candidate) const;
 
 private:
     FOcclusionGrid Grid;
-    TArray<uint8_t> VisibleStreak;   // 연속 보임 프레임 수
-    TArray<uint8_t> OccludedStreak;  // 연속 가림 프레임 수
-    TArray<uint8_t> LastState;       // 0=occluded, 1=visible
-};
\ No newline at end of file
+    TMap<const FStaticMesh*, FOccluderMesh> OccluderMeshes;
+
+    // 프레임마다 재사용하는 작업 버퍼 (오클루더마다 최대 개수만큼 구간을 미리 잡는다)
+    TArray<FVector4> ClipVertices;
+    TArray<FOcclusionTriangle> Triangles;
+    TArray<int32> VertexOffsets;
+    TArray<int32> TriangleOffsets;
+    TArray<int32> TriangleCounts;
+    TArray<TArray<uint32>> TileBins;            // 타일별 Triangles 인덱스 (오클루더 순서 유지)
+    TArray<EOcclusionResult> CandidateResults;
+
+    FOcclusionStats Stats;
+};
@@ -0,0 +1,134 @@
+﻿#include "pch.h"
+#include "CombatResolver.h"
+#include "HitboxComponent.h"
+#include "Actor.h"
+#include "PlatformTime.h"
+
+void FCombatResolver::RegisterHitbox(UHitboxComponent* Hitbox)
+{
+    if (!Hitbox || ActiveIndexByHitbox.Contains(Hitbox))
+    {
+        return;
+    }
+
+    ActiveIndexByHitbox.Add(Hitbox, ActiveHitboxes.Num());
+    ActiveHitboxes.Add(Hitbox);
+}
+
+void FCombatResolver::UnregisterHitbox(UHitboxComponent* Hitbox)
+{
+    const int32* Found = ActiveIndexByHitbox.Find(Hitbox);
+    if (!Found)
+    {
+        return;
+    }
+
+    const int32 Index = *Found;
+    ActiveIndexByHitbox.Remove(Hitbox);
+
+    const int32 LastIndex = ActiveHitboxes.Num() - 1;
+    if (Index != LastIndex)
+    {
+        ActiveHitboxes[Index] = ActiveHitboxes[LastIndex];
+        ActiveIndexByHitbox[ActiveHitboxes[Index]] = Index;
+    }
+    ActiveHitboxes.pop_back();
+}
+
+void FCombatResolver::Resolve(FPhysScene* PhysScene)
+{
+    LastStats = FCombatResolveStats();
+    if (!PhysScene || ActiveHitboxes.IsEmpty())
+    {
+        return;
+    }
+
+    const uint64 QueryStartCycles = FPlatformTime::Cycles64();
+
+    // 1. 활성 히트박스를 UUID(생성 순) 순으로 모아 쿼리 배치 구성
+    BatchHitboxes.Empty();
+    for (UHitboxComponent* Hitbox : ActiveHitboxes)
+    {
+        if (Hitbox->IsHitboxActive() && Hitbox->GetOwnerActor())
+        {
+            BatchHitboxes.Add(Hitbox);
+        }
+    }
+    std::sort(BatchHitboxes.begin(), BatchHitboxes.end(),
+        [](const UHitboxComponent* A, const UHitboxComponent* B) { return A->UUID < B->UUID; });
+
+    Queries.SetNum(BatchHitboxes.Num());
+    for (int32 i = 0; i < BatchHitboxes.Num(); ++i)
+    {
+        const UHitboxComponent* Hitbox = BatchHitboxes[i];
+        FBoxOverlapQuery& Query = Queries[i];
+        Query.Center = Hitbox->GetWorldLocation();
+        Query.HalfExtents = Hitbox->BoxExtent;
+        Query.Rotation = Hitbox->GetWorldRotation();
+        Query.IgnoreActor = Hitbox->GetOwnerActor();
+    }
+    LastStats.NumHitboxes = BatchHitboxes.Num();
+
+    // 2. 병렬 오버랩 질의 (결과는 쿼리 순서)
+    LastStats.NumOverlaps = PhysScene->OverlapBoxBatch(Queries, Overlaps);
+
+    // 3. 피해자 필터 + 중복 제거
+    PendingHits.Empty();
+    FramePairs.Empty();
+    for (const FOverlapHitResult& Overlap : Overlaps)
+    {
+        UHitboxComponent* Hitbox = BatchHitboxes[Overlap.QueryIndex];
+        AActor* Victim = Overlap.HitActor;
+        if (!Victim || !Hitbox->CanTarget(Victim))
+        {
+            continue;
+        }
+        ++LastStats.NumCandidates;
+
+        // 같은 공격자의 히트박스 여러 개가 한 프레임에 같은 피해자를 잡아도 한 번만
+        const uint64 PairKey = MakePairKey(Hitbox->GetOwnerActor()->UUID, Victim->UUID);
+        if (Hitbox->HasAlreadyHit(Victim) || FramePairs.Contains(PairKey))
+        {
+            ++LastStats.NumDuplicates;
+            continue;
+        }
+        FramePairs.Add(PairKey);
+
+        FPendingHit& Pending = PendingHits.emplace_back();
+        Pending.Hitbox = Hitbox;
+        Pending.Victim = Victim;
+        Pending.HitboxId = Hitbox->UUID;
+        Pending.VictimId = Victim->UUID;
+        Pending.HitPosition = Overlap.ImpactPoint;
+        Pending.HitNormal = Overlap.ImpactNormal;
+    }
+
+    const uint64 ApplyStartCycles = FPlatformTime::Cycles64();
+    LastStats.QueryMs = FPlatformTime::ToMilliseconds(ApplyStartCycles - QueryStartCycles);
+
+    // 4. 결정적 순서로 데미지 적용 ((히트박스 UUID, 피해자 UUID) 순, 같은 쌍은 FramePairs로 이미 한 번만 들어옴)
+    std::stable_sort(PendingHits.begin(), PendingHits.end(), [](const FPendingHit& A, const FPendingHit& B)
+    {
+        if (A.HitboxId != B.HitboxId)
+        {
+            return A.HitboxId < B.HitboxId;
+        }
+        return A.VictimId < B.VictimId;
+    });
+
+    for (const FPendingHit& Pending : PendingHits)
+    {
+        // 앞선 히트의 반응(패리 경직 등)으로 공격이 끊겼으면 건너뜀
+        if (!Pending.Hitbox->IsHitboxActive())
+        {
+            continue;
+        }
+
+        if (Pending.Hitbox->ApplyResolvedHit(Pending.Victim, Pending.HitPosition, Pending.HitNormal))
+        {
+            ++LastStats.NumAppliedHits;
+        }
+    }
+
+    LastStats.ApplyMs = FPlatformTime::ToMilliseconds(FPlatformTime::Cycles64() - ApplyStartCycles);
+}
@@ -0,0 +1,71 @@
+﻿#pragma once
+
+#include "Source/Runtime/Engine/Physics/PhysScene.h"
+
+class UHitboxComponent;
+class AActor;
+
+// ============================================================================
+// 전투 판정 프레임 통계
+// ============================================================================
+struct FCombatResolveStats
+{
+    int32 NumHitboxes = 0;      // 이번 프레임 배치에 들어간 활성 히트박스
+    int32 NumOverlaps = 0;      // 오버랩 쿼리 결과 (쿼리당 액터 중복 제거 후)
+    int32 NumCandidates = 0;    // 피해자 클래스/소유자 필터 통과
+    int32 NumDuplicates = 0;    // 같은 공격자-피해자 쌍이거나 이번 공격에 이미 맞음
+    int32 NumAppliedHits = 0;
+    double QueryMs = 0.0;
+    double ApplyMs = 0.0;
+};
+
+// ============================================================================
+// FCombatResolver - 월드 단위 히트박스 판정 단계 (PIE 월드가 소유)
+// ============================================================================
+// - 활성 히트박스는 EnableHitbox/DisableHitbox에서 등록/해제된다
+// - UWorld::Tick이 트랜스폼 확정 후(물리 스텝 전) Resolve를 한 번 호출한다
+//   1. 활성 히트박스를 UUID 순으로 모아 박스 오버랩 배치를 만든다
+//   2. FPhysScene::OverlapBoxBatch로 워커 스레드에서 나눠 질의한다
+//   3. 공격자-피해자 쌍을 해시 집합으로 중복 제거하고 (히트박스 UUID, 피해자 UUID) 순으로
+//      데미지를 적용한다 (스레드 수와 무관하게 같은 순서)
+// ============================================================================
+class FCombatResolver
+{
+public:
+    void RegisterHitbox(UHitboxComponent* Hitbox);
+    void UnregisterHitbox(UHitboxComponent* Hitbox);
+    int32 GetNumActiveHitboxes() const { return ActiveHitboxes.Num(); }
+
+    void Resolve(FPhysScene* PhysScene);
+
+    const FCombatResolveStats& GetLastStats() const { return LastStats; }
+
+    /** 공격자-피해자 쌍 키 (프레임 중복 제거용) */
+    static uint64 MakePairKey(uint32 AttackerId, uint32 VictimId)
+    {
+        return (static_cast<uint64>(AttackerId) << 32) | VictimId;
+    }
+
+private:
+    struct FPendingHit
+    {
+        UHitboxComponent* Hitbox = nullptr;
+        AActor* Victim = nullptr;
+        uint32 HitboxId = 0;
+        uint32 VictimId = 0;
+        FVector HitPosition;
+        FVector HitNormal;
+    };
+
+    TArray<UHitboxComponent*> ActiveHitboxes;       // 등록 순서 무관 (해제 시 마지막 원소와 교체)
+    TMap<UHitboxComponent*, int32> ActiveIndexByHitbox;
+
+    // 프레임 간 재사용 (할당 최소화)
+    TArray<UHitboxComponent*> BatchHitboxes;
+    TArray<FBoxOverlapQuery> Queries;
+    TArray<FOverlapHitResult> Overlaps;
+    TArray<FPendingHit> PendingHits;
+    TSet<uint64> FramePairs;
+
+    FCombatResolveStats LastStats;
+};
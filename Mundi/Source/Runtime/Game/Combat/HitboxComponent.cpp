@@ -3,7 +3,7 @@
 #include "Actor.h"
 #include "World.h"
 #include "Collision.h"
-#include "Source/Runtime/Engine/Physics/PhysScene.h"
+#include "CombatResolver.h"
 #include "Source/Runtime/Game/Player/PlayerCharacter.h"
 #include "Renderer.h"
 #include "RenderSettings.h"
@@ -15,7 +15,7 @@ UHitboxComponent::UHitboxComponent()
 {
     bCanEverTick = true;
     bTickEnabled = true;
-    bGenerateOverlapEvents = false;  // SweepBox 사용하므로 오버랩 이벤트 불필요
+    bGenerateOverlapEvents = false;  // FCombatResolver의 배치 오버랩 사용하므로 오버랩 이벤트 불필요
 
     // 기본적으로 비활성화 상태로 시작
     bIsActive = false;
@@ -23,6 +23,7 @@ UHitboxComponent::UHitboxComponent()
     // 기본 히트박스 크기
     BoxExtent = FVector(0.5f, 0.5f, 0.5f);  // 미터 단위 (50cm)
 
+    VictimClass = APlayerCharacter::StaticClass();
 
 }
 
@@ -69,9 +70,13 @@ void UHitboxComponent::TickComponent(float DeltaTime)
             return;
         }
     }
+}
 
-    // SweepBox로 충돌 감지
-    PerformSweepCheck();
+void UHitboxComponent::OnUnregister()
+{
+    DisableHitbox();
+
+    Super::OnUnregister();
 }
 
 // ============================================================================
@@ -106,12 +111,29 @@ void UHitboxComponent::EnableHitbox(const FDamageInfo& InDamageInfo, float InDur
     // 충돌 활성화
     SetActive(true);
     SetGenerateOverlapEvents(true);
+
+    // 월드 전투 판정에 등록
+    if (UWorld* World = GetWorld())
+    {
+        if (FCombatResolver* Resolver = World->GetCombatResolver())
+        {
+            Resolver->RegisterHitbox(this);
+        }
+    }
 }
 
 void UHitboxComponent::DisableHitbox()
 {
     bIsActive = false;
 
+    if (UWorld* World = GetWorld())
+    {
+        if (FCombatResolver* Resolver = World->GetCombatResolver())
+        {
+            Resolver->UnregisterHitbox(this);
+        }
+    }
+
     // 충돌 비활성화 (선택적)
     // SetActive(false);
     // SetGenerateOverlapEvents(false);
@@ -133,12 +155,21 @@ bool UHitboxComponent::HasAlreadyHit(AActor* Actor) const
 
 void UHitboxComponent::AddHitActor(AActor* Actor)
 {
-    if (Actor && !HasAlreadyHit(Actor))
+    if (Actor)
     {
         HitActors.Add(Actor);
     }
 }
 
+bool UHitboxComponent::CanTarget(AActor* Actor) const
+{
+    if (!Actor || Actor == OwnerActor)
+    {
+        return false;
+    }
+    return !VictimClass || Actor->IsA(VictimClass);
+}
+
 // ============================================================================
 // 충돌 처리
 // ============================================================================
@@ -303,69 +334,29 @@ FCombatHitResult UHitboxComponent::ProcessHit(AActor* TargetActor, IDamageable*
 }
 
 // ============================================================================
-// SweepBox 충돌 감지
+// 배치 판정 결과 적용
 // ============================================================================
 
-void UHitboxComponent::PerformSweepCheck()
+bool UHitboxComponent::ApplyResolvedHit(AActor* Victim, const FVector& HitPosition, const FVector& HitNormal)
 {
-    if (!OwnerActor)
+    if (!bIsActive || !CanTarget(Victim) || HasAlreadyHit(Victim))
     {
-        return;
+        return false;
     }
 
-    UWorld* World = GetWorld();
-    if (!World)
-    {
-        return;
-    }
-
-    FPhysScene* PhysScene = World->GetPhysScene();
-    if (!PhysScene)
-    {
-        return;
-    }
+    // 디버그용 - 히트 정보 저장
+    FDebugHitInfo HitInfo;
+    HitInfo.Position = HitPosition;
+    HitInfo.Normal = HitNormal;
+    HitInfo.RemainingTime = 3.0f;  // 3초 동안 표시
+    DebugHitInfos.Add(HitInfo);
 
-    // 히트박스 위치와 회전
-    FVector BoxCenter = GetWorldLocation();
-    FQuat BoxRotation = GetWorldRotation();
-
-    // Sweep 방향 (약간 앞으로) - 최소 거리로 현재 위치에서 충돌 체크
-    FVector SweepDirection = OwnerActor->GetActorForward();
-    float SweepDistance = 0.01f;  // 1cm
-    FVector SweepEnd = BoxCenter + SweepDirection * SweepDistance;
-
-    // SweepBox 실행
-    FHitResult HitResult;
-    bool bHit = PhysScene->SweepBox(
-        BoxCenter,
-        SweepEnd,
-        BoxExtent,
-        BoxRotation,
-        HitResult,
-        OwnerActor  // 자기 자신 무시
-    );
-
-    if (bHit && HitResult.HitActor)
+    // 충돌 위치에 StaticMeshActor 스폰
+    // 히트박스(칼) 위치와 피해자 위치 사이, 피해자 몸쪽에 스폰
+    if (UWorld* World = GetWorld())
     {
-        // 플레이어만 충돌 처리
-        APlayerCharacter* Player = Cast<APlayerCharacter>(HitResult.HitActor);
-        if (!Player)
-        {
-            return;
-        }
-
-        // 디버그용 - 히트 정보 저장
-
-            FDebugHitInfo HitInfo;
-            HitInfo.Position = HitResult.ImpactPoint;
-            HitInfo.Normal = HitResult.ImpactNormal;
-            HitInfo.RemainingTime = 3.0f;  // 3초 동안 표시
-            DebugHitInfos.Add(HitInfo);
-
-        // 충돌 위치에 StaticMeshActor 스폰
-        // 히트박스(칼) 위치와 피해자(플레이어) 위치 사이, 피해자 몸쪽에 스폰
-        FVector HitboxPos = BoxCenter;  // 히트박스(칼) 위치
-        FVector VictimPos = Player->GetActorLocation();  // 피해자 위치
+        FVector HitboxPos = GetWorldLocation();  // 히트박스(칼) 위치
+        FVector VictimPos = Victim->GetActorLocation();  // 피해자 위치
 
         // 히트박스에서 피해자 방향으로 피해자 몸쪽에 스폰 (피해자 위치의 80% 지점)
         FVector SpawnLocation = FVector::Lerp(HitboxPos, VictimPos, 0.8f);
@@ -378,10 +369,11 @@ void UHitboxComponent::PerformSweepCheck()
             HitMarker->GetStaticMeshComponent()->SetStaticMesh(GDataDir + "/Model/Sphere8.obj");
             HitMarker->SetActorScale(FVector(0.1f, 0.1f, 0.1f));  // 작은 구체로 표시
         }
-
-        // 정확한 충돌 위치와 법선으로 처리
-        OnOverlapDetected(HitResult.HitActor, HitResult.ImpactPoint, HitResult.ImpactNormal);
     }
+
+    // 충돌 위치와 법선으로 처리 (IDamageable이 아니거나 피격 불가면 기록되지 않음)
+    OnOverlapDetected(Victim, HitPosition, HitNormal);
+    return HasAlreadyHit(Victim);
 }
 
 // ============================================================================
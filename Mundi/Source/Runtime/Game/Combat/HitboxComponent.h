@@ -13,6 +13,9 @@
 //   1. 무기나 캐릭터에 붙이기
 //   2. 애님 노티파이에서 EnableHitbox() / DisableHitbox() 호출
 //   3. 충돌 시 자동으로 TakeDamage 호출
+//
+// 충돌 감지는 월드의 FCombatResolver가 활성 히트박스를 모아 한 번에 수행하고
+// ApplyResolvedHit로 결과를 돌려준다 (히트박스별 Sweep 없음)
 // ============================================================================
 UCLASS(DisplayName = "UHitboxComponent", Description = "캐릭터간 히트 컴포넌트 ")
 class UHitboxComponent : public UBoxComponent
@@ -28,6 +31,7 @@ public:
     // ========================================================================
     virtual void BeginPlay() override;
     virtual void TickComponent(float DeltaTime) override;
+    virtual void OnUnregister() override;
 
     // ========================================================================
     // 디버그 렌더링
@@ -81,6 +85,24 @@ public:
 
     /** 히트박스 소유자 (자신은 맞지 않도록) */
     void SetOwnerActor(AActor* InOwner) { OwnerActor = InOwner; }
+    AActor* GetOwnerActor() const { return OwnerActor; }
+
+    /** 피격 대상 클래스 (기본: APlayerCharacter) */
+    void SetVictimClass(UClass* InVictimClass) { VictimClass = InVictimClass; }
+    UClass* GetVictimClass() const { return VictimClass; }
+
+    /** 소유자가 아니고 피격 대상 클래스인지 */
+    bool CanTarget(AActor* Actor) const;
+
+    // ========================================================================
+    // 전투 판정 (FCombatResolver에서 호출)
+    // ========================================================================
+
+    /**
+     * 배치 오버랩으로 찾은 히트를 적용합니다.
+     * @return 새로 맞은 액터면 true
+     */
+    bool ApplyResolvedHit(AActor* Victim, const FVector& HitPosition, const FVector& HitNormal);
 
   
 
@@ -116,17 +138,15 @@ protected:
      */
     FCombatHitResult ProcessHit(AActor* TargetActor, IDamageable* Target, const FVector& HitPosition, const FVector& HitNormal);
 
-    /**
-     * PhysX SweepBox로 충돌 감지를 수행합니다.
-     */
-    void PerformSweepCheck();
-
 private:
     // 현재 공격 정보
     FDamageInfo CurrentDamageInfo;
 
     // 이번 공격에서 이미 맞은 액터들
-    TArray<AActor*> HitActors;
+    TSet<AActor*> HitActors;
+
+    // 피격 대상 클래스
+    UClass* VictimClass = nullptr;
 
     // 상태
     UPROPERTY(EditAnywhere, Category = "Hitbox")
@@ -211,14 +211,16 @@ TArray<AActor*> UTargetingComponent::FindPotentialTargets() const
     EnsureOwnerPawn();
     if (!World || !OwnerPawn) return ValidTargets;
 
-    // Find all enemies in the world
-    TArray<AEnemyBase*> Enemies = World->FindActors<AEnemyBase>();
+    // Only enemies inside the lock-on cone, gathered from the pawn spatial hash
+    TArray<AActor*> Candidates;
+    World->GetPawnSpatialHash().QueryCone(OwnerPawn->GetActorLocation(), GetCameraForward(), MaxLockOnRange, MaxLockOnAngle,
+        Candidates, AEnemyBase::StaticClass());
 
-    for (AEnemyBase* Enemy : Enemies)
+    for (AActor* Candidate : Candidates)
     {
-        if (IsValidTarget(Enemy))
+        if (IsValidTarget(Candidate))
         {
-            ValidTargets.Add(Enemy);
+            ValidTargets.Add(Candidate);
         }
     }
 
@@ -286,14 +288,7 @@ bool UTargetingComponent::IsValidTarget(AActor* Target) const
         ToTarget.Normalize();
 
         // Get camera forward from PlayerController's ControlRotation
-        FVector CameraForward = FVector(1, 0, 0);  // Default forward
-        if (APlayerController* PC = Cast<APlayerController>(GetOwner()))
-        {
-            FQuat ControlRot = PC->GetControlRotation();
-            CameraForward = ControlRot.RotateVector(FVector(1, 0, 0));
-        }
-        CameraForward.Z = 0;
-        CameraForward.Normalize();
+        const FVector CameraForward = GetCameraForward();
 
         float Dot = FVector::Dot(CameraForward, ToTarget);
         float Angle = std::acos(FMath::Clamp(Dot, -1.0f, 1.0f)) * (180.0f / PI);
@@ -353,14 +348,7 @@ float UTargetingComponent::ScoreTarget(AActor* Target) const
     ToTarget.Normalize();
 
     // Get camera forward from PlayerController's ControlRotation
-    FVector CameraForward = FVector(1, 0, 0);  // Default forward
-    if (APlayerController* PC = Cast<APlayerController>(GetOwner()))
-    {
-        FQuat ControlRot = PC->GetControlRotation();
-        CameraForward = ControlRot.RotateVector(FVector(1, 0, 0));
-    }
-    CameraForward.Z = 0;
-    CameraForward.Normalize();
+    const FVector CameraForward = GetCameraForward();
 
     float Dot = FVector::Dot(CameraForward, ToTarget);
     float Angle = std::acos(FMath::Clamp(Dot, -1.0f, 1.0f)) * (180.0f / PI);
@@ -388,6 +376,19 @@ bool UTargetingComponent::HasLineOfSight(AActor* Target) const
     return true;
 }
 
+FVector UTargetingComponent::GetCameraForward() const
+{
+    FVector CameraForward = FVector(1, 0, 0);  // Default forward
+    if (APlayerController* PC = Cast<APlayerController>(GetOwner()))
+    {
+        FQuat ControlRot = PC->GetControlRotation();
+        CameraForward = ControlRot.RotateVector(FVector(1, 0, 0));
+    }
+    CameraForward.Z = 0;
+    CameraForward.Normalize();
+    return CameraForward;
+}
+
 void UTargetingComponent::EnsureOwnerPawn() const
 {
     if (OwnerPawn) return;
@@ -119,4 +119,7 @@ private:
 
     /** Ensure OwnerPawn is valid (lazy initialization) */
     void EnsureOwnerPawn() const;
+
+    /** Horizontal camera forward from the owning PlayerController's ControlRotation */
+    FVector GetCameraForward() const;
 };
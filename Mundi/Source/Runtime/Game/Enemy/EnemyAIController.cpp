@@ -334,17 +334,29 @@ bool AEnemyAIController::TryDetectPlayer()
         return false;
     }
 
-    // 플레이어 찾기
-    APlayerController* PC = World->FindActor<APlayerController>();
-    if (!PC || !PC->GetPawn())
+    // 감지 범위 안의 폰만 격자 해시에서 조회해 플레이어가 조종하는 가장 가까운 폰을 찾는다
+    TArray<AActor*> NearbyPawns;
+    World->GetPawnSpatialHash().QueryRadius(Pawn->GetActorLocation(), DetectionRange, NearbyPawns);
+
+    APawn* PlayerPawn = nullptr;
+    float BestDistance = FLT_MAX;
+    for (AActor* Actor : NearbyPawns)
     {
-        return false;
-    }
+        APawn* Candidate = static_cast<APawn*>(Actor);  // 격자 해시는 폰만 담는다
+        if (Candidate == Pawn || !Cast<APlayerController>(Candidate->GetController()))
+        {
+            continue;
+        }
 
-    APawn* PlayerPawn = PC->GetPawn();
-    float Distance = GetDistanceToActor(PlayerPawn);
+        const float Distance = GetDistanceToActor(Candidate);
+        if (Distance < BestDistance)
+        {
+            BestDistance = Distance;
+            PlayerPawn = Candidate;
+        }
+    }
 
-    if (Distance <= DetectionRange)
+    if (PlayerPawn)
     {
         TargetActor = PlayerPawn;
         return true;
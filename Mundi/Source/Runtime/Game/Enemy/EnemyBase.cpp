@@ -8,6 +8,7 @@
 #include "PlayerController.h"
 #include "GameModeBase.h"
 #include "GameState.h"
+#include "Source/Runtime/Engine/AI/AIDecisionScheduler.h"
 
 
 
@@ -66,6 +67,11 @@ void AEnemyBase::BeginPlay()
         {
             AIController->Possess(this);
         }
+
+        if (FAIDecisionScheduler* Scheduler = World->GetAIDecisionScheduler())
+        {
+            Scheduler->RegisterAgent(this);
+        }
     }
 }
 
@@ -85,10 +91,32 @@ void AEnemyBase::Tick(float DeltaSeconds)
         }
     }
 
-    if (AIState != EEnemyAIState::Dead)
+    if (AIState == EEnemyAIState::Dead)
+    {
+        return;
+    }
+
+    // 감지/상태 전환은 스케줄러가 허가한 프레임에만 (예산 초과 시 다음 프레임으로 밀림)
+    UWorld* World = GetWorld();
+    FAIDecisionScheduler* Scheduler = World ? World->GetAIDecisionScheduler() : nullptr;
+    float DecisionDeltaTime = DeltaSeconds;
+    if (!Scheduler)
     {
         UpdateAI(DeltaSeconds);
     }
+    else if (Scheduler->TryBeginDecision(this, DeltaSeconds, DecisionDeltaTime))
+    {
+        UpdateAI(DecisionDeltaTime);
+        Scheduler->EndDecision();
+    }
+
+    // 조향과 쿨타임은 결정 사이에도 매 프레임
+    UpdateSteering(DeltaSeconds);
+
+    if (AttackTimer > 0.f)
+    {
+        AttackTimer -= DeltaSeconds;
+    }
 }
 
 // ============================================================================
@@ -114,11 +142,15 @@ void AEnemyBase::UpdateAI(float DeltaTime)
     default:
         break;
     }
+}
 
-    // 공격 쿨타임 업데이트
-    if (AttackTimer > 0.f)
+void AEnemyBase::UpdateSteering(float DeltaTime)
+{
+    // 추적 중에만 타겟 방향으로 이동 (공격/경직 중에는 제자리)
+    if (AIState == EEnemyAIState::Chase && TargetActor)
     {
-        AttackTimer -= DeltaTime;
+        LookAtTarget(DeltaTime);
+        MoveToTarget(DeltaTime);
     }
 }
 
@@ -133,6 +165,12 @@ void AEnemyBase::SetAIState(EEnemyAIState NewState)
     AIState = NewState;
 
     // 상태 전환 시 처리
+    if (OldState == EEnemyAIState::Chase && AIController)
+    {
+        // 추적이 끝나면 남은 경로 추종 중지 (공격/경직 중에는 제자리)
+        AIController->StopMovement();
+    }
+
     if (OldState == EEnemyAIState::Attack)
     {
         bIsAttacking = false;
@@ -175,9 +213,7 @@ void AEnemyBase::UpdateChase(float DeltaTime)
         return;
     }
 
-    // 타겟 방향으로 이동
-    LookAtTarget(DeltaTime);
-    MoveToTarget(DeltaTime);
+    // 타겟 방향 이동은 UpdateSteering에서 매 프레임
 }
 
 void AEnemyBase::UpdateAttack(float DeltaTime)
@@ -270,14 +306,26 @@ void AEnemyBase::MoveToTarget(float DeltaTime)
     float Distance = Direction.Size();
 
     // 공격 범위보다 가까우면 이동 안 함
-    if (Distance <= AttackRange * 0.8f)
+    const float AcceptanceRadius = AttackRange * 0.8f;
+    if (Distance <= AcceptanceRadius)
+    {
+        if (AIController && AIController->IsMoving())
+        {
+            AIController->StopMovement();
+        }
+        return;
+    }
+
+    // 내비메시 경로 추종 (목표가 RepathDistance 이상 움직일 때만 다시 요청, 이동은 CharacterMovement가 처리)
+    if (AIController)
     {
+        AIController->MoveToActor(TargetActor, AcceptanceRadius);
         return;
     }
 
-    Direction = Direction.GetNormalized();
-    FVector NewLocation = GetActorLocation() + Direction * MoveSpeed * DeltaTime;
-    SetActorLocation(NewLocation);
+    // 컨트롤러가 없으면 타겟 방향 직선 입력
+    Direction.Z = 0.f;
+    AddMovementInput(Direction.GetNormalized());
 }
 
 // ============================================================================
@@ -382,6 +430,12 @@ void AEnemyBase::OnHitReaction(EHitReaction Reaction, const FDamageInfo& DamageI
         AIController->EnterStagger(DamageInfo.StaggerDuration);
     }
 
+    // 경직 종료 판정이 결정 주기만큼 늦지 않도록 다음 프레임 결정 요청
+    if (FAIDecisionScheduler* Scheduler = GetWorld() ? GetWorld()->GetAIDecisionScheduler() : nullptr)
+    {
+        Scheduler->RequestDecision(this);
+    }
+
     // TODO: 피격 애니메이션 재생
 
     // 넉백
@@ -403,6 +457,12 @@ void AEnemyBase::OnDeath()
         AIController->OnPawnDeath();
     }
 
+    // 더 이상 결정하지 않으므로 스케줄러 예산에서 제외
+    if (FAIDecisionScheduler* Scheduler = GetWorld() ? GetWorld()->GetAIDecisionScheduler() : nullptr)
+    {
+        Scheduler->UnregisterAgent(this);
+    }
+
     // TODO: 사망 애니메이션/래그돌
     // TODO: 일정 시간 후 Destroy
 }
@@ -463,6 +523,12 @@ void AEnemyBase::NotifyAttackFinished()
     {
         AIController->OnAttackFinished();
     }
+
+    // 공격 후 다음 행동을 바로 고르도록 결정 요청
+    if (FAIDecisionScheduler* Scheduler = GetWorld() ? GetWorld()->GetAIDecisionScheduler() : nullptr)
+    {
+        Scheduler->RequestDecision(this);
+    }
 }
 
 // ============================================================================
@@ -88,7 +88,10 @@ protected:
     // ========================================================================
     // AI 로직
     // ========================================================================
+    /** 감지/상태 전환 (AI 결정 스케줄러가 허가한 프레임에만, 직전 결정 이후 누적 시간으로 호출) */
     virtual void UpdateAI(float DeltaTime);
+    /** 현재 상태의 이동/회전 조향 (결정 사이에도 매 프레임) */
+    virtual void UpdateSteering(float DeltaTime);
     virtual void SetAIState(EEnemyAIState NewState);
 
     // 상태별 업데이트
@@ -255,6 +255,10 @@ struct FTileCullingBufferType
     uint32 bUseTileCulling;   // 타일 컬링 활성화 여부 (0=비활성화, 1=활성화)
     uint32 ViewportStartX;    // 뷰포트 시작 X 좌표
     uint32 ViewportStartY;    // 뷰포트 시작 Y 좌표
+    uint32 ClusterSliceCount; // 깊이 슬라이스 수 (0=2D 타일)
+    uint32 LightListStride;   // 타일(클러스터)당 인덱스 버퍼 간격
+    float ClusterDepthScale;  // Slice = floor(log2(ViewZ) * Scale + Bias)
+    float ClusterDepthBias;
     uint32 Padding[2];
 };
 
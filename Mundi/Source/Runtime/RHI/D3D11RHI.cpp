@@ -7,6 +7,18 @@ void D3D11RHI::Initialize(HWND hWindow)
 {
     // 이곳에서 Device, DeviceContext, viewport, swapchain를 초기화한다
     CreateDeviceAndSwapChain(hWindow);
+    CreateDeviceResources();
+}
+
+void D3D11RHI::InitializeNull(UINT InWidth, UINT InHeight)
+{
+    bNullRHI = true;
+    CreateNullDevice(InWidth, InHeight);
+    CreateDeviceResources();
+}
+
+void D3D11RHI::CreateDeviceResources()
+{
     CreateFrameBuffer();
     CreateIdBuffer();
     CreateDOFResources();  // DOF 렌더 타겟 생성
@@ -19,7 +31,7 @@ void D3D11RHI::Initialize(HWND hWindow)
 	CreateSamplerState();
     UResourceManager::GetInstance().Initialize(Device,DeviceContext);
 
-    // Initialize Direct2D overlays after device/swapchain ready
+    // Initialize Direct2D overlays after device/swapchain ready (Null RHI는 스왑체인이 없어 비활성)
     UStatsOverlayD2D::Get().Initialize(Device, DeviceContext, SwapChain);
     UGameOverlayD2D::Get().Initialize(Device, DeviceContext, SwapChain);
 }
@@ -546,7 +558,10 @@ void D3D11RHI::Present()
     // Draw any Direct2D overlays before present
     UGameOverlayD2D::Get().Draw();
     UStatsOverlayD2D::Get().Draw();
-    SwapChain->Present(0, 0); // vsync on
+    if (SwapChain)
+    {
+        SwapChain->Present(0, 0); // vsync on
+    }
 }
 
 void D3D11RHI::CreateDeviceAndSwapChain(HWND hWindow)
@@ -583,13 +598,58 @@ void D3D11RHI::CreateDeviceAndSwapChain(HWND hWindow)
     ViewportInfo = { 0.0f, 0.0f, (float)swapchaindesc.BufferDesc.Width, (float)swapchaindesc.BufferDesc.Height, 0.0f, 1.0f };
 }
 
+void D3D11RHI::CreateNullDevice(UINT InWidth, UINT InHeight)
+{
+    D3D_FEATURE_LEVEL featurelevels[] = { D3D_FEATURE_LEVEL_11_0 };
+
+    // NULL 드라이버는 SDK Layers가 설치된 환경에서만 생성되므로 실패하면 WARP(소프트웨어)로 대체
+    const D3D_DRIVER_TYPE DriverTypes[] = { D3D_DRIVER_TYPE_NULL, D3D_DRIVER_TYPE_WARP };
+    HRESULT hr = E_FAIL;
+    for (D3D_DRIVER_TYPE DriverType : DriverTypes)
+    {
+        hr = D3D11CreateDevice(nullptr, DriverType, nullptr, 0,
+            featurelevels, ARRAYSIZE(featurelevels), D3D11_SDK_VERSION,
+            &Device, nullptr, &DeviceContext);
+        if (SUCCEEDED(hr))
+        {
+            UE_LOG("Null RHI: %s device", DriverType == D3D_DRIVER_TYPE_NULL ? "NULL" : "WARP");
+            break;
+        }
+    }
+    if (FAILED(hr))
+    {
+        UE_LOG("[error] Null RHI: D3D11CreateDevice failed (0x%08X)", static_cast<uint32>(hr));
+        return;
+    }
+
+    NullBackBufferWidth = std::max(1u, InWidth);
+    NullBackBufferHeight = std::max(1u, InHeight);
+    ViewportInfo = { 0.0f, 0.0f, (float)NullBackBufferWidth, (float)NullBackBufferHeight, 0.0f, 1.0f };
+}
+
 void D3D11RHI::CreateFrameBuffer()
 {
-    DXGI_SWAP_CHAIN_DESC swapDesc;
-    SwapChain->GetDesc(&swapDesc);
+    const UINT BackBufferWidth = GetSwapChainWidth();
+    const UINT BackBufferHeight = GetSwapChainHeight();
 
-    // 백 버퍼 가져오기
-    SwapChain->GetBuffer(0, __uuidof(ID3D11Texture2D), (void**)&FrameBuffer);
+    // 백 버퍼 가져오기 (Null RHI는 스왑체인 버퍼와 같은 포맷의 오프스크린 텍스처)
+    if (SwapChain)
+    {
+        SwapChain->GetBuffer(0, __uuidof(ID3D11Texture2D), (void**)&FrameBuffer);
+    }
+    else
+    {
+        D3D11_TEXTURE2D_DESC BackBufferDesc = {};
+        BackBufferDesc.Width = BackBufferWidth;
+        BackBufferDesc.Height = BackBufferHeight;
+        BackBufferDesc.MipLevels = 1;
+        BackBufferDesc.ArraySize = 1;
+        BackBufferDesc.Format = DXGI_FORMAT_B8G8R8A8_TYPELESS;
+        BackBufferDesc.SampleDesc.Count = 1;
+        BackBufferDesc.Usage = D3D11_USAGE_DEFAULT;
+        BackBufferDesc.BindFlags = D3D11_BIND_RENDER_TARGET;
+        Device->CreateTexture2D(&BackBufferDesc, nullptr, &FrameBuffer);
+    }
 
     // 렌더 타겟 뷰 생성
     D3D11_RENDER_TARGET_VIEW_DESC framebufferRTVdesc = {};
@@ -602,8 +662,8 @@ void D3D11RHI::CreateFrameBuffer()
     // 핑퐁(ping-pong) 버퍼 텍스처 생성 (SRV 지원)
     // =====================================
     D3D11_TEXTURE2D_DESC SceneDesc = {};
-    SceneDesc.Width = swapDesc.BufferDesc.Width;
-    SceneDesc.Height = swapDesc.BufferDesc.Height;
+    SceneDesc.Width = BackBufferWidth;
+    SceneDesc.Height = BackBufferHeight;
     SceneDesc.MipLevels = 1;
     SceneDesc.ArraySize = 1;
     SceneDesc.Format = DXGI_FORMAT_B8G8R8A8_TYPELESS;
@@ -653,8 +713,8 @@ void D3D11RHI::CreateFrameBuffer()
     // =====================================
 
     D3D11_TEXTURE2D_DESC depthDesc = {};
-    depthDesc.Width = swapDesc.BufferDesc.Width;
-    depthDesc.Height = swapDesc.BufferDesc.Height;
+    depthDesc.Width = BackBufferWidth;
+    depthDesc.Height = BackBufferHeight;
     depthDesc.MipLevels = 1;
     depthDesc.ArraySize = 1;
     depthDesc.Format = DXGI_FORMAT_R24G8_TYPELESS; // Typeless 포맷으로 변경
@@ -686,15 +746,12 @@ void D3D11RHI::CreateFrameBuffer()
 void D3D11RHI::CreateIdBuffer()
 {
 
-    DXGI_SWAP_CHAIN_DESC SwapDesc;
-    SwapChain->GetDesc(&SwapDesc);
-
     D3D11_TEXTURE2D_DESC TextureDesc{};
     TextureDesc.Format = DXGI_FORMAT_R32_UINT;
     TextureDesc.CPUAccessFlags = 0;
     TextureDesc.Usage = D3D11_USAGE_DEFAULT;
-    TextureDesc.Width = SwapDesc.BufferDesc.Width;
-    TextureDesc.Height = SwapDesc.BufferDesc.Height;
+    TextureDesc.Width = GetSwapChainWidth();
+    TextureDesc.Height = GetSwapChainHeight();
     TextureDesc.MipLevels = 1;
     TextureDesc.ArraySize = 1;
     TextureDesc.SampleDesc.Count = 1;
@@ -726,12 +783,9 @@ void D3D11RHI::CreateIdBuffer()
 
 void D3D11RHI::CreateDOFResources()
 {
-    DXGI_SWAP_CHAIN_DESC swapDesc;
-    SwapChain->GetDesc(&swapDesc);
-
     // 1/2 해상도 계산 (품질 향상)
-    UINT halfWidth = swapDesc.BufferDesc.Width / 2;
-    UINT halfHeight = swapDesc.BufferDesc.Height / 2;
+    UINT halfWidth = GetSwapChainWidth() / 2;
+    UINT halfHeight = GetSwapChainHeight() / 2;
 
     // DOF 텍스처 Description (고정밀도 Float)
     D3D11_TEXTURE2D_DESC DOFDesc = {};
@@ -791,16 +845,13 @@ void D3D11RHI::CreateBloomResources()
 {
     ReleaseBloomResources();
 
-    if (!Device || !SwapChain)
+    if (!Device || (!SwapChain && !bNullRHI))
     {
         return;
     }
 
-    DXGI_SWAP_CHAIN_DESC swapDesc = {};
-    SwapChain->GetDesc(&swapDesc);
-
-    UINT bloomWidth = std::max(1u, swapDesc.BufferDesc.Width / 2);
-    UINT bloomHeight = std::max(1u, swapDesc.BufferDesc.Height / 2);
+    UINT bloomWidth = std::max(1u, GetSwapChainWidth() / 2);
+    UINT bloomHeight = std::max(1u, GetSwapChainHeight() / 2);
 
     D3D11_TEXTURE2D_DESC desc = {};
     desc.Width = bloomWidth;
@@ -1362,6 +1413,10 @@ void D3D11RHI::SetViewport(UINT width, UINT height)
 
 UINT D3D11RHI::GetSwapChainWidth() const
 {
+    if (!SwapChain)
+    {
+        return NullBackBufferWidth;
+    }
     DXGI_SWAP_CHAIN_DESC desc;
     SwapChain->GetDesc(&desc);
     return desc.BufferDesc.Width;
@@ -1369,6 +1424,10 @@ UINT D3D11RHI::GetSwapChainWidth() const
 
 UINT D3D11RHI::GetSwapChainHeight() const
 {
+    if (!SwapChain)
+    {
+        return NullBackBufferHeight;
+    }
     DXGI_SWAP_CHAIN_DESC desc;
     SwapChain->GetDesc(&desc);
     return desc.BufferDesc.Height;
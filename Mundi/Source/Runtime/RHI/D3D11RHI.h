@@ -55,6 +55,11 @@ public:
 public:
 	void Initialize(HWND hWindow);
 
+	// 스왑체인 없이 NULL 드라이버 디바이스로 초기화 (생성/드로우 호출은 받지만 GPU 작업은 하지 않음)
+	// CPU 프레임 비용 측정용, NULL 드라이버가 없으면 WARP로 대체
+	void InitializeNull(UINT InWidth, UINT InHeight);
+	bool IsNullRHI() const { return bNullRHI; }
+
 	void Release();
 
 
@@ -238,6 +243,8 @@ public:
 
 private:
 	void CreateDeviceAndSwapChain(HWND hWindow); // 여기서 디바이스, 디바이스 컨택스트, 스왑체인, 뷰포트를 초기화한다
+	void CreateNullDevice(UINT InWidth, UINT InHeight);
+	void CreateDeviceResources();
 	void CreateFrameBuffer();
 	void CreateIdBuffer();
 	void CreateDOFResources();  // DOF 렌더 타겟 생성
@@ -339,6 +346,11 @@ private:
 	UShader* PreShader = nullptr; // Shaders, Inputlayout
 
 	bool bReleased = false; // Prevent double Release() calls
+
+	// Null RHI: 스왑체인 대신 오프스크린 백 버퍼를 쓴다
+	bool bNullRHI = false;
+	UINT NullBackBufferWidth = 0;
+	UINT NullBackBufferHeight = 0;
 };
 
 
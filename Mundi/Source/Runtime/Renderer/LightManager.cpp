@@ -29,6 +29,7 @@ void FLightManager::Initialize(D3D11RHI* RHIDevice, uint32 InShadowAtlasSize2D,
 	ShadowAtlasSize2D = InShadowAtlasSize2D;
 	AtlasSizeCube = InAtlasSizeCube;
 	CubeArrayCount = InCubeArrayCount;
+	ShadowAtlasAllocator2D.Initialize(ShadowAtlasSize2D);
 
 	// --- 1. Structured Buffers (t17, t18) ---
 	if (!PointLightBuffer)
@@ -475,6 +476,9 @@ void FLightManager::ClearAllDepthStencilView(D3D11RHI* RHIDevice)
 			RHIDevice->GetDeviceContext()->ClearDepthStencilView(faceDSV, D3D11_CLEAR_DEPTH | D3D11_CLEAR_STENCIL, 1.0f, 0);
 		}
 	}
+
+	// 아틀라스 내용이 지워졌으므로 캐시된 섀도우 영역은 다시 그려야 한다
+	ShadowAtlasAllocator2D.InvalidateContents();
 	
 	// 비워진 리소스를 다시 할당 시키려고
 	bHaveToUpdate = true;
@@ -531,45 +535,24 @@ bool FLightManager::GetCachedShadowCubeSliceIndex(ULightComponent* Light, int32&
 	return true;
 }
 
-// 단순한 아틀라스 로직
-void FLightManager::AllocateAtlasRegions2D(TArray<FShadowRenderRequest>& InOutRequests2D)
+void FLightManager::AllocateAtlasRegions2D(TArray<FShadowRenderRequest>& InOutRequests2D, const FVector& ViewLocation)
 {
-	// 요청 정렬 (가장 큰 것부터)
-	InOutRequests2D.Sort(std::greater<FShadowRenderRequest>());
-
-	// 동적 패킹(Shelf Algorithm)
-	uint32 CurrentAtlasX = 0;
-	uint32 CurrentAtlasY = 0;
-	uint32 CurrentShelfMaxHeight = 0;
-
-	for (FShadowRenderRequest& Request : InOutRequests2D)
+	// 화면 중요도: 라이트 반경이 카메라에서 차지하는 크기에 비례 (Directional은 항상 최우선)
+	ShadowRequestImportance.SetNum(InOutRequests2D.Num());
+	for (int32 i = 0; i < InOutRequests2D.Num(); ++i)
 	{
-		if (CurrentAtlasX + Request.Size > ShadowAtlasSize2D)
-		{
-			CurrentAtlasY += CurrentShelfMaxHeight;
-			CurrentAtlasX = 0;
-			CurrentShelfMaxHeight = 0;
-		}
-		if (CurrentAtlasY + Request.Size > ShadowAtlasSize2D)
+		const FShadowRenderRequest& Request = InOutRequests2D[i];
+		if (Cast<UDirectionalLightComponent>(Request.LightOwner))
 		{
-			Request.Size = 0; // 꽉 참 (렌더링 실패)
-			//UE_LOG("그림자 맵 아틀라스가 가득차서 더 이상 그림자를 추가할 수 없습니다.");
+			ShadowRequestImportance[i] = FLT_MAX;
 			continue;
 		}
 
-		Request.AtlasViewportOffset = FVector2D((float)CurrentAtlasX, (float)CurrentAtlasY);
-
-		// Pass 2 데이터 (UV) 저장
-		Request.AtlasScaleOffset = FVector4(
-			Request.Size / (float)ShadowAtlasSize2D,    // ScaleX
-			Request.Size / (float)ShadowAtlasSize2D,    // ScaleY
-			CurrentAtlasX / (float)ShadowAtlasSize2D,   // OffsetX
-			CurrentAtlasY / (float)ShadowAtlasSize2D    // OffsetY
-		);
-
-		CurrentAtlasX += Request.Size;
-		CurrentShelfMaxHeight = FMath::Max(CurrentShelfMaxHeight, Request.Size);
+		const float Distance = FVector::Distance(Request.WorldLocation, ViewLocation);
+		ShadowRequestImportance[i] = Request.Radius / FMath::Max(Distance - Request.Radius, 1.0f);
 	}
+
+	ShadowAtlasAllocator2D.Allocate(InOutRequests2D, ShadowRequestImportance);
 }
 
 void FLightManager::AllocateAtlasCubeSlices(TArray<FShadowRenderRequest>& InOutRequestsCube)
@@ -657,6 +640,7 @@ void FLightManager::ClearAllLightList()
 
 	ShadowDataCache2D.clear();
 	ShadowDataCacheCube.clear();
+	ShadowAtlasAllocator2D.Reset();
 }
 
 template<typename T>
@@ -741,6 +725,7 @@ void FLightManager::DeRegisterLight<UDirectionalLightComponent>(UDirectionalLigh
 	bHaveToUpdate = true;
 
 	ShadowDataCache2D.Remove(LightComponent);
+	ShadowAtlasAllocator2D.ReleaseLight(LightComponent);
 }
 template<>
 void FLightManager::DeRegisterLight<UPointLightComponent>(UPointLightComponent* LightComponent)
@@ -772,6 +757,7 @@ void FLightManager::DeRegisterLight<USpotLightComponent>(USpotLightComponent* Li
 	bHaveToUpdate = true;
 
 	ShadowDataCache2D.Remove(LightComponent);
+	ShadowAtlasAllocator2D.ReleaseLight(LightComponent);
 }
 
 
@@ -1,4 +1,5 @@
 ﻿#pragma once
+#include "ShadowAtlasAllocator.h"
 #define CASCADED_MAX 8
 
 class UAmbientLightComponent;
@@ -34,12 +35,12 @@ struct FShadowMapData // 112 bytes
 
 struct FShadowRenderRequest
 {
-    ULightComponent* LightOwner;
+    ULightComponent* LightOwner = nullptr;
     FMatrix ViewMatrix;
     FMatrix ProjectionMatrix;
     FVector WorldLocation;
-    float Radius;
-    uint32 Size;
+    float Radius = 0.0f; // Directional은 사용하지 않음
+    uint32 Size = 0;
     int32 SubViewIndex; // Point(0~5), CSM(0~N), Spot(0)
     int32 AssignedSliceIndex = -1; // Cube Atlas Slice Index
 
@@ -155,7 +156,9 @@ public:
     void ClearAllDepthStencilView(D3D11RHI* RHIDevice);
     ID3D11RenderTargetView* GetVSMShadowAtlasRTV2D() const { return VSMShadowAtlasRTV2D; }
 
-    void AllocateAtlasRegions2D(TArray<FShadowRenderRequest>& InOutRequests2D);
+    // ViewLocation 기준 화면 중요도로 아틀라스 티어를 정함, 바뀌지 않은 라이트는 이전 영역을 그대로 유지
+    void AllocateAtlasRegions2D(TArray<FShadowRenderRequest>& InOutRequests2D, const FVector& ViewLocation);
+    FShadowAtlasAllocator& GetShadowAtlasAllocator2D() { return ShadowAtlasAllocator2D; }
     void AllocateAtlasCubeSlices(TArray<FShadowRenderRequest>& InOutRequestsCube);
 
     TArray<UAmbientLightComponent*> GetAmbientLightList() { return AmbientLightList; }
@@ -187,6 +190,8 @@ private:
     ID3D11DepthStencilView* ShadowAtlasDSV2D = nullptr;
     ID3D11ShaderResourceView* ShadowAtlasSRV2D = nullptr; // t9
     uint32 ShadowAtlasSize2D = 8192;
+    FShadowAtlasAllocator ShadowAtlasAllocator2D;
+    TArray<float> ShadowRequestImportance; // AllocateAtlasRegions2D 임시 버퍼
 
     // Atlas 2: 큐브맵 아틀라스 (Point Light용)
     ID3D11Texture2D* ShadowAtlasTextureCube = nullptr; // TextureCubeArray 리소스
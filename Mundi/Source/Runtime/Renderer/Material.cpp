@@ -35,6 +35,7 @@ bool UMaterial::Load(const FString& InFilePath, ID3D11Device* InDevice)
 	{
 		throw std::runtime_error(".dds나 .hlsl만 입력해주세요. 현재 입력 파일명 : " + InFilePath);
 	}
+	MarkShaderBindingChanged();
 	return true;
 }
 
@@ -56,6 +57,7 @@ void UMaterial::Serialize(const bool bInIsLoading, JSON& InOutHandle)
 void UMaterial::SetShader(UShader* InShaderResource)
 {
 	Shader = InShaderResource;
+	MarkShaderBindingChanged();
 }
 
 void UMaterial::SetShaderByName(const FString& InShaderName)
@@ -81,6 +83,7 @@ void UMaterial::SetShaderMacros(const TArray<FShaderMacro>& InShaderMacro)
 	}
 
 	ShaderMacros = InShaderMacro;
+	MarkShaderBindingChanged();
 }
 
 UTexture* UMaterial::GetTexture(EMaterialTextureSlot Slot) const
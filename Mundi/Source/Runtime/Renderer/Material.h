@@ -26,6 +26,15 @@ public:
 	virtual bool HasTexture(EMaterialTextureSlot Slot) const = 0;
 	virtual const FMaterialInfo& GetMaterialInfo() const = 0;
 	virtual const TArray<FShaderMacro> GetShaderMacros() const = 0;
+
+	// 셰이더/매크로가 바뀔 때마다 증가 (컴포넌트에 캐시된 드로우 커맨드 무효화 기준)
+	static uint32 GetShaderBindingGeneration() { return ShaderBindingGeneration; }
+
+protected:
+	static void MarkShaderBindingChanged() { ++ShaderBindingGeneration; }
+
+private:
+	inline static uint32 ShaderBindingGeneration = 0;
 };
 
 
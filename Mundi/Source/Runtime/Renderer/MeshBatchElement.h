@@ -89,6 +89,13 @@ struct FMeshBatchElement
 	uint32 InstanceCount = 0;
 	uint32 InstanceStart = 0;
 
+	// --- 5. 자동 인스턴싱 (스태틱 메시) ---
+	// 같은 키의 배치가 연속되면 FMeshInstancingBuilder가 이 변형(USE_INSTANCING)으로 합쳐서 그린다
+	// nullptr이면 합치지 않는다
+	ID3D11VertexShader* InstancedVertexShader = nullptr;
+	ID3D11PixelShader* InstancedPixelShader = nullptr;
+	ID3D11InputLayout* InstancedInputLayout = nullptr;
+
 	// --- 기본 생성자 ---
 	FMeshBatchElement() = default;
 
@@ -0,0 +1,181 @@
+﻿#include "pch.h"
+#include "MeshBatchSort.h"
+#include "MeshBatchElement.h"
+
+namespace
+{
+	constexpr uint32 VertexShaderBits = 8;
+	constexpr uint32 PixelShaderBits = 8;
+	constexpr uint32 MaterialBits = 12;
+	constexpr uint32 TranslucentMaterialBits = 16;
+	constexpr uint32 VertexBufferBits = 12;
+	constexpr uint32 IndexBufferBits = 6;		// 인덱스 버퍼는 대부분 정점 버퍼와 1:1이라 상위 필드가 이미 구분
+	constexpr uint32 SectionBits = 10;
+	constexpr uint32 DepthBits = 24;
+
+	// 발급한 Id가 이 수를 넘으면 테이블을 비운다 (사라진 포인터가 계속 쌓이는 것 방지)
+	constexpr uint32 IdResetThreshold = 1u << 12;
+
+	uint64 MakePriority(const FMeshBatchElement& Batch)
+	{
+		// -1(지정 안 함) -> 0, 그 외는 1부터
+		const int32 Priority = std::clamp(Batch.SortPriority + 1, 0, 255);
+		return static_cast<uint64>(Priority);
+	}
+
+	// CanMerge가 비교하는 드로우 범위를 하나의 값으로 (0은 Id 테이블의 "없음"이므로 피한다)
+	uint64 MakeSectionKey(const FMeshBatchElement& Batch)
+	{
+		const uint64 Range = (static_cast<uint64>(Batch.StartIndex) << 32) | Batch.IndexCount;
+		return (Range ^ (static_cast<uint64>(Batch.BaseVertexIndex) * 0x9E3779B97F4A7C15ull)) | 1ull << 63;
+	}
+
+	uint64 ClampId(uint32 Id, uint32 Bits)
+	{
+		const uint32 MaxValue = (1u << Bits) - 1;
+		return static_cast<uint64>(Id < MaxValue ? Id : MaxValue);
+	}
+}
+
+FMeshBatchSorter& FMeshBatchSorter::Get()
+{
+	static FMeshBatchSorter Instance;
+	return Instance;
+}
+
+uint32 FMeshBatchSorter::FIdTable::Get(uint64 Key)
+{
+	if (Key == LastKey && Key)
+	{
+		return LastId;
+	}
+
+	uint32 Id = 0;
+	if (Key)
+	{
+		if (const uint32* Found = Ids.Find(Key))
+		{
+			Id = *Found;
+		}
+		else
+		{
+			// 0은 nullptr 전용
+			Id = ++MaxId;
+			Ids.Add(Key, Id);
+		}
+	}
+
+	LastKey = Key;
+	LastId = Id;
+	return Id;
+}
+
+uint64 FMeshBatchSorter::MakeStateKey(const FMeshBatchElement& Batch)
+{
+	uint64 Key = MakePriority(Batch);
+	Key = (Key << VertexShaderBits) | ClampId(VertexShaderIds.Get(Batch.VertexShader), VertexShaderBits);
+	Key = (Key << PixelShaderBits) | ClampId(PixelShaderIds.Get(Batch.PixelShader), PixelShaderBits);
+	Key = (Key << MaterialBits) | ClampId(MaterialIds.Get(Batch.Material), MaterialBits);
+	Key = (Key << VertexBufferBits) | ClampId(VertexBufferIds.Get(Batch.VertexBuffer), VertexBufferBits);
+	Key = (Key << IndexBufferBits) | ClampId(IndexBufferIds.Get(Batch.IndexBuffer), IndexBufferBits);
+	Key = (Key << SectionBits) | ClampId(SectionIds.Get(MakeSectionKey(Batch)), SectionBits);
+	return Key;
+}
+
+uint64 FMeshBatchSorter::MakeBackToFrontKey(const FMeshBatchElement& Batch, const FVector& ViewLocation)
+{
+	// 양수 float의 비트 패턴은 크기 순서와 같으므로 상위 비트만 잘라 깊이 구간으로 쓴다
+	const FVector Location(Batch.WorldMatrix.M[3][0], Batch.WorldMatrix.M[3][1], Batch.WorldMatrix.M[3][2]);
+	const float DistSquared = (Location - ViewLocation).SizeSquared();
+	uint32 DistanceBits;
+	std::memcpy(&DistanceBits, &DistSquared, sizeof(DistanceBits));
+	const uint64 Depth = ((1u << DepthBits) - 1) - (DistanceBits >> (32 - DepthBits));
+
+	uint64 Key = MakePriority(Batch);
+	Key = (Key << DepthBits) | Depth;
+	Key = (Key << VertexShaderBits) | ClampId(VertexShaderIds.Get(Batch.VertexShader), VertexShaderBits);
+	Key = (Key << PixelShaderBits) | ClampId(PixelShaderIds.Get(Batch.PixelShader), PixelShaderBits);
+	Key = (Key << TranslucentMaterialBits) | ClampId(MaterialIds.Get(Batch.Material), TranslucentMaterialBits);
+	return Key;
+}
+
+void FMeshBatchSorter::Sort(const TArray<FMeshBatchElement>& Batches, EMeshBatchSortMode Mode, const FVector& ViewLocation, TArray<uint32>& OutOrder)
+{
+	const int32 NumBatches = Batches.Num();
+	OutOrder.SetNum(NumBatches);
+	Keys.SetNum(NumBatches);
+
+	// 비트 폭을 넘친 Id는 최댓값으로 묶여 정렬만 덜 촘촘해진다
+	for (FIdTable* Table : { &VertexShaderIds, &PixelShaderIds, &MaterialIds, &VertexBufferIds, &IndexBufferIds, &SectionIds })
+	{
+		if (Table->MaxId >= IdResetThreshold)
+		{
+			Table->Ids.Empty();
+			Table->MaxId = 0;
+		}
+		Table->LastKey = 0;
+	}
+
+	for (int32 i = 0; i < NumBatches; ++i)
+	{
+		OutOrder[i] = static_cast<uint32>(i);
+		Keys[i] = (Mode == EMeshBatchSortMode::BackToFront)
+			? MakeBackToFrontKey(Batches[i], ViewLocation)
+			: MakeStateKey(Batches[i]);
+	}
+
+	if (NumBatches > 1)
+	{
+		RadixSort(OutOrder);
+	}
+}
+
+void FMeshBatchSorter::RadixSort(TArray<uint32>& InOutOrder)
+{
+	// LSD 기수 정렬 (8비트 x 8패스, 안정 정렬). 모든 키가 같은 바이트를 가진 패스는 건너뛴다
+	constexpr int32 NumPasses = 8;
+	constexpr int32 NumBuckets = 256;
+	const int32 Num = Keys.Num();
+
+	uint32 Histograms[NumPasses][NumBuckets] = {};
+	for (int32 i = 0; i < Num; ++i)
+	{
+		const uint64 Key = Keys[i];
+		for (int32 Pass = 0; Pass < NumPasses; ++Pass)
+		{
+			++Histograms[Pass][(Key >> (Pass * 8)) & 0xFF];
+		}
+	}
+
+	KeysScratch.SetNum(Num);
+	OrderScratch.SetNum(Num);
+
+	for (int32 Pass = 0; Pass < NumPasses; ++Pass)
+	{
+		uint32* Histogram = Histograms[Pass];
+		const uint32 FirstByte = (Keys[0] >> (Pass * 8)) & 0xFF;
+		if (Histogram[FirstByte] == static_cast<uint32>(Num))
+		{
+			continue;
+		}
+
+		uint32 Offset = 0;
+		for (int32 Bucket = 0; Bucket < NumBuckets; ++Bucket)
+		{
+			const uint32 Count = Histogram[Bucket];
+			Histogram[Bucket] = Offset;
+			Offset += Count;
+		}
+
+		for (int32 i = 0; i < Num; ++i)
+		{
+			const uint64 Key = Keys[i];
+			const uint32 Dest = Histogram[(Key >> (Pass * 8)) & 0xFF]++;
+			KeysScratch[Dest] = Key;
+			OrderScratch[Dest] = InOutOrder[i];
+		}
+
+		std::swap(Keys, KeysScratch);
+		std::swap(InOutOrder, OrderScratch);
+	}
+}
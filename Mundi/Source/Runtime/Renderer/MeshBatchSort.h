@@ -0,0 +1,63 @@
+﻿#pragma once
+
+struct FMeshBatchElement;
+
+enum class EMeshBatchSortMode : uint8
+{
+	State,			// 불투명/데칼: 셰이더 -> 머티리얼 -> 버퍼 순으로 묶어 상태 변경 최소화
+	BackToFront,	// 반투명: 먼 것부터 그리고, 같은 깊이 구간에서는 상태 순
+};
+
+/**
+ * FMeshBatchElement 정렬기
+ * - 배치마다 64비트 키를 만들고 (배치, 키) 인덱스 배열만 기수 정렬한다 (큰 구조체는 이동하지 않음)
+ * - 셰이더/머티리얼/버퍼 포인터는 작은 정수 Id로 바꿔 키에 넣는다
+ *   Id는 프레임 사이에 유지되며, 비트 폭을 넘으면 테이블을 비우고 다시 발급한다
+ *
+ * 키 레이아웃 (상위 비트부터)
+ * - State       : Priority 8 | VS 8 | PS 8 | Material 12 | VertexBuffer 12 | IndexBuffer 6 | Section 10
+ *   (Section: StartIndex/IndexCount/BaseVertexIndex 조합, 멀티 섹션 메시의 같은 섹션끼리 이어지게 해 인스턴싱 병합)
+ * - BackToFront : Priority 8 | Depth 24 (먼 것이 작음) | VS 8 | PS 8 | Material 16
+ * Priority는 SortPriority + 1 (지정 안 함 = 0)
+ */
+class FMeshBatchSorter
+{
+public:
+	static FMeshBatchSorter& Get();
+
+	// OutOrder에 그릴 순서대로 배치 인덱스를 채운다
+	void Sort(const TArray<FMeshBatchElement>& Batches, EMeshBatchSortMode Mode, const FVector& ViewLocation, TArray<uint32>& OutOrder);
+
+private:
+	FMeshBatchSorter() = default;
+
+	// 포인터(또는 64비트 값) -> 작은 정수 Id (연속된 배치가 같은 값을 쓰는 경우가 많아 직전 값을 먼저 비교)
+	struct FIdTable
+	{
+		TMap<uint64, uint32> Ids;
+		uint64 LastKey = 0;
+		uint32 LastId = 0;
+		uint32 MaxId = 0;
+
+		uint32 Get(uint64 Key);
+		uint32 Get(const void* Ptr) { return Get(static_cast<uint64>(reinterpret_cast<uintptr_t>(Ptr))); }
+	};
+
+	uint64 MakeStateKey(const FMeshBatchElement& Batch);
+	uint64 MakeBackToFrontKey(const FMeshBatchElement& Batch, const FVector& ViewLocation);
+
+	void RadixSort(TArray<uint32>& InOutOrder);
+
+private:
+	FIdTable VertexShaderIds;
+	FIdTable PixelShaderIds;
+	FIdTable MaterialIds;
+	FIdTable VertexBufferIds;
+	FIdTable IndexBufferIds;
+	FIdTable SectionIds;
+
+	// 정렬용 작업 버퍼 (할당 재사용)
+	TArray<uint64> Keys;
+	TArray<uint64> KeysScratch;
+	TArray<uint32> OrderScratch;
+};
@@ -0,0 +1,62 @@
+#pragma once
+#include "UEContainer.h"
+
+// 메시 드로우 커맨드 캐시 통계
+// CollectMeshBatches가 캐시를 재사용했는지, 다시 빌드했는지 섹션 단위로 센다 (오버레이 출력 주기마다 리셋)
+// DrawMeshBatches의 Draw 호출 수와 자동 인스턴싱 결과도 함께 센다
+struct FMeshDrawCommandStats
+{
+	uint32 CachedCommands = 0;	// 캐시에서 그대로 재사용한 섹션 수
+	uint32 BuiltCommands = 0;	// 셰이더 Variant 조회부터 다시 빌드한 섹션 수
+
+	uint32 DrawCalls = 0;		// DrawMeshBatches가 실제로 제출한 Draw 호출 수
+	uint32 InstancedDraws = 0;	// 자동 인스턴싱으로 합쳐진 Draw 수
+	uint32 MergedInstances = 0;	// 그 Draw들에 들어간 배치 수
+
+	void Reset()
+	{
+		CachedCommands = 0;
+		BuiltCommands = 0;
+		DrawCalls = 0;
+		InstancedDraws = 0;
+		MergedInstances = 0;
+	}
+};
+
+// 메시 드로우 커맨드 통계 전역 매니저 (싱글톤)
+class FMeshDrawCommandStatManager
+{
+public:
+	static FMeshDrawCommandStatManager& GetInstance()
+	{
+		static FMeshDrawCommandStatManager Instance;
+		return Instance;
+	}
+
+	void AddCachedCommands(uint32 Count) { CurrentStats.CachedCommands += Count; }
+	void AddBuiltCommands(uint32 Count) { CurrentStats.BuiltCommands += Count; }
+	void AddDrawCalls(uint32 Count) { CurrentStats.DrawCalls += Count; }
+	void AddInstancedDraws(uint32 Draws, uint32 Instances)
+	{
+		CurrentStats.InstancedDraws += Draws;
+		CurrentStats.MergedInstances += Instances;
+	}
+
+	const FMeshDrawCommandStats& GetStats() const
+	{
+		return CurrentStats;
+	}
+
+	void ResetStats()
+	{
+		CurrentStats.Reset();
+	}
+
+private:
+	FMeshDrawCommandStatManager() = default;
+	~FMeshDrawCommandStatManager() = default;
+	FMeshDrawCommandStatManager(const FMeshDrawCommandStatManager&) = delete;
+	FMeshDrawCommandStatManager& operator=(const FMeshDrawCommandStatManager&) = delete;
+
+	FMeshDrawCommandStats CurrentStats;
+};
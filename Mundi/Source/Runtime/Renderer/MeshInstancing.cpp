@@ -0,0 +1,188 @@
+﻿#include "pch.h"
+#include "MeshInstancing.h"
+#include "MeshBatchElement.h"
+#include "MeshDrawCommandStats.h"
+#include "D3D11RHI.h"
+
+FMeshInstancingBuilder::~FMeshInstancingBuilder()
+{
+	Release();
+}
+
+void FMeshInstancingBuilder::Release()
+{
+	if (InstanceBuffer)
+	{
+		InstanceBuffer->Release();
+		InstanceBuffer = nullptr;
+	}
+	InstanceCapacity = 0;
+}
+
+void FMeshInstancingBuilder::AppendInstanceInputLayout(TArray<D3D11_INPUT_ELEMENT_DESC>& InOutLayout)
+{
+	InOutLayout.Add({ "INSTANCE_WORLD", 0, DXGI_FORMAT_R32G32B32A32_FLOAT, 1, 0,  D3D11_INPUT_PER_INSTANCE_DATA, 1 });
+	InOutLayout.Add({ "INSTANCE_WORLD", 1, DXGI_FORMAT_R32G32B32A32_FLOAT, 1, 16, D3D11_INPUT_PER_INSTANCE_DATA, 1 });
+	InOutLayout.Add({ "INSTANCE_WORLD", 2, DXGI_FORMAT_R32G32B32A32_FLOAT, 1, 32, D3D11_INPUT_PER_INSTANCE_DATA, 1 });
+	InOutLayout.Add({ "INSTANCE_WORLD", 3, DXGI_FORMAT_R32G32B32A32_FLOAT, 1, 48, D3D11_INPUT_PER_INSTANCE_DATA, 1 });
+
+	InOutLayout.Add({ "INSTANCE_INVWORLD", 0, DXGI_FORMAT_R32G32B32A32_FLOAT, 1, 64,  D3D11_INPUT_PER_INSTANCE_DATA, 1 });
+	InOutLayout.Add({ "INSTANCE_INVWORLD", 1, DXGI_FORMAT_R32G32B32A32_FLOAT, 1, 80,  D3D11_INPUT_PER_INSTANCE_DATA, 1 });
+	InOutLayout.Add({ "INSTANCE_INVWORLD", 2, DXGI_FORMAT_R32G32B32A32_FLOAT, 1, 96,  D3D11_INPUT_PER_INSTANCE_DATA, 1 });
+	InOutLayout.Add({ "INSTANCE_INVWORLD", 3, DXGI_FORMAT_R32G32B32A32_FLOAT, 1, 112, D3D11_INPUT_PER_INSTANCE_DATA, 1 });
+
+	InOutLayout.Add({ "INSTANCE_COLOR", 0, DXGI_FORMAT_R32G32B32A32_FLOAT, 1, 128, D3D11_INPUT_PER_INSTANCE_DATA, 1 });
+	InOutLayout.Add({ "INSTANCE_ID", 0, DXGI_FORMAT_R32_UINT, 1, 144, D3D11_INPUT_PER_INSTANCE_DATA, 1 });
+}
+
+bool FMeshInstancingBuilder::IsInstanceable(const FMeshBatchElement& Batch)
+{
+	// 인스턴스별로 달라질 수 있는 바인딩(스키닝, 인스턴스 텍스처, SubUV)이 있으면 합치지 않는다
+	return Batch.InstancedVertexShader
+		&& Batch.InstancedPixelShader
+		&& !Batch.bInstancedDraw
+		&& !Batch.GPUSkinMatrixSRV
+		&& !Batch.InstanceShaderResourceView
+		&& Batch.SubImages_Horizontal <= 1
+		&& Batch.SubImages_Vertical <= 1
+		&& Batch.ScreenAlignment == EScreenAlignment::None;
+}
+
+bool FMeshInstancingBuilder::CanMerge(const FMeshBatchElement& Head, const FMeshBatchElement& Other)
+{
+	return Head.InstancedVertexShader == Other.InstancedVertexShader
+		&& Head.InstancedPixelShader == Other.InstancedPixelShader
+		&& Head.Material == Other.Material
+		&& Head.VertexBuffer == Other.VertexBuffer
+		&& Head.IndexBuffer == Other.IndexBuffer
+		&& Head.IndexCount == Other.IndexCount
+		&& Head.StartIndex == Other.StartIndex
+		&& Head.BaseVertexIndex == Other.BaseVertexIndex
+		&& Head.VertexStride == Other.VertexStride
+		&& Head.PrimitiveTopology == Other.PrimitiveTopology
+		&& Head.SortPriority == Other.SortPriority
+		&& IsInstanceable(Other);
+}
+
+void FMeshInstancingBuilder::MergeInstancedRuns(D3D11RHI* RHIDevice, TArray<FMeshBatchElement>& InOutBatches, TArray<uint32>& InOutDrawOrder)
+{
+	const int32 NumDraws = InOutDrawOrder.Num();
+	if (NumDraws < static_cast<int32>(MinInstanceCount))
+	{
+		return;
+	}
+
+	Instances.Empty();
+	MergedBatches.Empty();
+	MergedOrder.Empty();
+	MergedOrder.Reserve(NumDraws);
+
+	// 합친 배치는 루프가 끝난 뒤 InOutBatches 뒤에 붙인다 (루프 중에 추가하면 참조가 무효화됨)
+	const uint32 MergedBaseIndex = static_cast<uint32>(InOutBatches.Num());
+	uint32 NumMergedInstances = 0;
+
+	int32 DrawIndex = 0;
+	while (DrawIndex < NumDraws)
+	{
+		const FMeshBatchElement& Head = InOutBatches[InOutDrawOrder[DrawIndex]];
+
+		int32 RunEnd = DrawIndex + 1;
+		if (IsInstanceable(Head))
+		{
+			while (RunEnd < NumDraws && CanMerge(Head, InOutBatches[InOutDrawOrder[RunEnd]]))
+			{
+				++RunEnd;
+			}
+		}
+
+		const uint32 RunLength = static_cast<uint32>(RunEnd - DrawIndex);
+		if (RunLength < MinInstanceCount)
+		{
+			for (int32 i = DrawIndex; i < RunEnd; ++i)
+			{
+				MergedOrder.Add(InOutDrawOrder[i]);
+			}
+			DrawIndex = RunEnd;
+			continue;
+		}
+
+		FMeshBatchElement& Merged = MergedBatches.emplace_back(Head);
+		Merged.VertexShader = Head.InstancedVertexShader;
+		Merged.PixelShader = Head.InstancedPixelShader;
+		Merged.InputLayout = Head.InstancedInputLayout;
+		Merged.bInstancedDraw = true;
+		Merged.InstanceStride = sizeof(FMeshInstanceData);
+		Merged.InstanceStart = static_cast<uint32>(Instances.Num());
+		Merged.InstanceCount = RunLength;
+
+		for (int32 i = DrawIndex; i < RunEnd; ++i)
+		{
+			const FMeshBatchElement& Batch = InOutBatches[InOutDrawOrder[i]];
+			FMeshInstanceData& Instance = Instances.emplace_back();
+			Instance.WorldMatrix = Batch.WorldMatrix;
+			Instance.WorldInverseTranspose = Batch.WorldMatrix.InverseAffine().Transpose();
+			Instance.Color = Batch.InstanceColor;
+			Instance.ObjectID = Batch.ObjectID;
+		}
+
+		MergedOrder.Add(MergedBaseIndex + static_cast<uint32>(MergedBatches.Num() - 1));
+		NumMergedInstances += RunLength;
+		DrawIndex = RunEnd;
+	}
+
+	if (MergedBatches.IsEmpty())
+	{
+		return;
+	}
+
+	// 업로드에 실패하면 원래 순서 그대로 개별 드로우
+	if (!UploadInstances(RHIDevice))
+	{
+		return;
+	}
+
+	for (FMeshBatchElement& Merged : MergedBatches)
+	{
+		Merged.InstanceVertexBuffer = InstanceBuffer;
+	}
+	InOutBatches.Append(MergedBatches);
+	std::swap(InOutDrawOrder, MergedOrder);
+
+	FMeshDrawCommandStatManager::GetInstance().AddInstancedDraws(static_cast<uint32>(MergedBatches.Num()), NumMergedInstances);
+}
+
+bool FMeshInstancingBuilder::UploadInstances(D3D11RHI* RHIDevice)
+{
+	const uint32 NumInstances = static_cast<uint32>(Instances.Num());
+
+	if (!InstanceBuffer || InstanceCapacity < NumInstances)
+	{
+		Release();
+
+		// 씬이 커질 때마다 다시 만들지 않도록 여유 있게 확보
+		const uint32 NewCapacity = std::max<uint32>(NumInstances + NumInstances / 2, 256);
+
+		D3D11_BUFFER_DESC Desc = {};
+		Desc.ByteWidth = sizeof(FMeshInstanceData) * NewCapacity;
+		Desc.Usage = D3D11_USAGE_DYNAMIC;
+		Desc.BindFlags = D3D11_BIND_VERTEX_BUFFER;
+		Desc.CPUAccessFlags = D3D11_CPU_ACCESS_WRITE;
+
+		if (FAILED(RHIDevice->GetDevice()->CreateBuffer(&Desc, nullptr, &InstanceBuffer)))
+		{
+			UE_LOG("FMeshInstancingBuilder: 인스턴스 버퍼 생성 실패 (%u instances)", NewCapacity);
+			InstanceBuffer = nullptr;
+			return false;
+		}
+		InstanceCapacity = NewCapacity;
+	}
+
+	D3D11_MAPPED_SUBRESOURCE Mapped = {};
+	if (FAILED(RHIDevice->GetDeviceContext()->Map(InstanceBuffer, 0, D3D11_MAP_WRITE_DISCARD, 0, &Mapped)))
+	{
+		return false;
+	}
+	memcpy(Mapped.pData, Instances.data(), sizeof(FMeshInstanceData) * NumInstances);
+	RHIDevice->GetDeviceContext()->Unmap(InstanceBuffer, 0);
+	return true;
+}
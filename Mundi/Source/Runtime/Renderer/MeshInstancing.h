@@ -0,0 +1,53 @@
+﻿#pragma once
+
+struct FMeshBatchElement;
+class D3D11RHI;
+
+// 자동 인스턴싱 인스턴스 버퍼 한 항목 (UberLit.hlsl USE_INSTANCING 입력과 일치, 160 bytes)
+struct FMeshInstanceData
+{
+	FMatrix WorldMatrix;
+	FMatrix WorldInverseTranspose;
+	FLinearColor Color;
+	uint32 ObjectID = 0;
+	uint32 Padding[3] = {};
+};
+
+/**
+ * 스태틱 메시 자동 인스턴싱
+ * - 정렬된 그리기 순서에서 같은 메시 섹션/머티리얼/셰이더 배치가 연속되면 인스턴스 드로우 하나로 합친다
+ * - 합칠 수 있는 배치는 수집 단계에서 InstancedVertexShader(USE_INSTANCING 변형)가 채워진 배치뿐이다
+ * - 월드 행렬/색상/ObjectID는 동적 인스턴스 버퍼(슬롯 1)로 올리고, 피킹은 인스턴스별 ObjectID로 그대로 동작한다
+ */
+class FMeshInstancingBuilder
+{
+public:
+	FMeshInstancingBuilder() = default;
+	~FMeshInstancingBuilder();
+
+	// 합친 배치는 InOutBatches 뒤에 추가되고, InOutDrawOrder는 합친 결과 순서로 교체된다
+	void MergeInstancedRuns(D3D11RHI* RHIDevice, TArray<FMeshBatchElement>& InOutBatches, TArray<uint32>& InOutDrawOrder);
+
+	void Release();
+
+	// USE_INSTANCING 변형의 인스턴스 입력 (입력 슬롯 1), UShader::CreateInputLayout에서 사용
+	static void AppendInstanceInputLayout(TArray<D3D11_INPUT_ELEMENT_DESC>& InOutLayout);
+
+private:
+	static bool IsInstanceable(const FMeshBatchElement& Batch);
+	static bool CanMerge(const FMeshBatchElement& Head, const FMeshBatchElement& Other);
+
+	bool UploadInstances(D3D11RHI* RHIDevice);
+
+private:
+	// 이보다 짧은 연속 구간은 합치지 않고 기존 경로로 그린다
+	static constexpr uint32 MinInstanceCount = 2;
+
+	ID3D11Buffer* InstanceBuffer = nullptr;
+	uint32 InstanceCapacity = 0;
+
+	// 프레임마다 재사용하는 임시 버퍼
+	TArray<FMeshInstanceData> Instances;
+	TArray<FMeshBatchElement> MergedBatches;
+	TArray<uint32> MergedOrder;
+};
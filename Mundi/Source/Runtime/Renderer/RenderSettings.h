@@ -36,6 +36,10 @@ public:
     void SetTileSize(uint32 Value) { TileSize = Value; }
     uint32 GetTileSize() const { return TileSize; }
 
+    // 클러스터(froxel) 컬링 깊이 슬라이스 수 (0 = 2D 타일)
+    void SetClusterSliceCount(uint32 Value) { ClusterSliceCount = Value; }
+    uint32 GetClusterSliceCount() const { return ClusterSliceCount; }
+
     // 그림자 안티 에일리어싱
     void SetShadowAATechnique(EShadowAATechnique In) { ShadowAATechnique = In; }
     EShadowAATechnique GetShadowAATechnique() const { return ShadowAATechnique; }
@@ -52,6 +56,7 @@ private:
 
     // Tile-based light culling
     uint32 TileSize = 16;                   // 타일 크기 (픽셀, 기본값: 16)
+    uint32 ClusterSliceCount = 0;           // 깊이 슬라이스 수 (0: 끔)
 
     // 그림자 안티 에일리어싱
     EShadowAATechnique ShadowAATechnique = EShadowAATechnique::PCF; // 기본값 PCF
@@ -1,6 +1,9 @@
 ﻿#pragma once
 #include "RHIDevice.h"
 #include "LineDynamicMesh.h"
+#include "MeshInstancing.h"
+#include "TileLightCuller.h"
+#include "Occlusion.h"
 
 class UStaticMeshComponent;
 class UTextRenderComponent;
@@ -46,6 +49,15 @@ public:
 
 	D3D11RHI* GetRHIDevice() { return RHIDevice; }
 
+	// 자동 인스턴싱 (인스턴스 버퍼는 프레임 사이에 재사용)
+	FMeshInstancingBuilder& GetMeshInstancing() { return MeshInstancing; }
+
+	// 타일 라이트 컬러 (라이트 인덱스 버퍼와 작업 버퍼를 프레임 사이에 재사용)
+	FTileLightCuller& GetTileLightCuller() { return TileLightCuller; }
+
+	// CPU 오클루전 컬링 (깊이/HZB/작업 버퍼와 오클루더 메시 캐시를 프레임 사이에 재사용)
+	FOcclusionCullingManagerCPU& GetOcclusionCuller() { return OcclusionCuller; }
+
 	void SetCurrentCamera(ACameraActor* InCamera) { CurrentCamera = InCamera; }
 	ACameraActor* GetCurrentCamera() const { return CurrentCamera; }
 
@@ -66,6 +78,10 @@ private:
 
 	void InitializeLineBatch();
 
+	FMeshInstancingBuilder MeshInstancing;
+	FTileLightCuller TileLightCuller;
+	FOcclusionCullingManagerCPU OcclusionCuller;
+
 	// 이전 drawCall에서 이미 썼던 RnderState면, 다시 Set 하지 않기 위해 만든 변수들
 	EViewMode PreViewModeIndex = EViewMode::VMI_Wireframe; // RSSetState, UpdateColorConstantBuffers
 	//UMaterial* PreUMaterial = nullptr; // SRV, UpdatePixelConstantBuffers
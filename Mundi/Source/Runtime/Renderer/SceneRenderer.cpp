@@ -20,6 +20,7 @@
 #include "BVHierarchy.h"
 #include "SelectionManager.h"
 #include "StaticMeshComponent.h"
+#include "StaticMesh.h"
 #include "DecalStatManager.h"
 #include "BillboardComponent.h"
 #include "TextRenderComponent.h"
@@ -45,11 +46,15 @@
 #include "LineComponent.h"
 #include "LightStats.h"
 #include "ShadowStats.h"
+#include "Hash.h"
 #include "PlatformTime.h"
 #include "PostProcessing/VignettePass.h"
 #include "Source/Editor/FBX/FbxLoader.h"
 #include "SkinnedMeshComponent.h"
 #include "SkinningStats.h"
+#include "MeshBatchSort.h"
+#include "MeshInstancing.h"
+#include "MeshDrawCommandStats.h"
 #include "StatsOverlayD2D.h"
 #include "Source/Runtime/Engine/Particle/ParticleStats.h"
 
@@ -59,12 +64,12 @@ FSceneRenderer::FSceneRenderer(UWorld* InWorld, FSceneView* InView, URenderer* I
 	, OwnerRenderer(InOwnerRenderer)
 	, RHIDevice(InOwnerRenderer->GetRHIDevice())
 {
-	//OcclusionCPU = std::make_unique<FOcclusionCullingManagerCPU>();
+	OcclusionCuller = &OwnerRenderer->GetOcclusionCuller();
 
-	// 타일 라이트 컬러 초기화
-	TileLightCuller = std::make_unique<FTileLightCuller>();
-	uint32 TileSize = World->GetRenderSettings().GetTileSize();
-	TileLightCuller->Initialize(RHIDevice, TileSize);
+	// 타일 라이트 컬러 설정 (설정 변경은 다음 프레임에 반영)
+	TileLightCuller = &OwnerRenderer->GetTileLightCuller();
+	const URenderSettings& RenderSettings = World->GetRenderSettings();
+	TileLightCuller->Initialize(RHIDevice, RenderSettings.GetTileSize(), RenderSettings.GetClusterSliceCount());
 
 	// 라인 수집 시작
 	OwnerRenderer->BeginLineBatch();
@@ -92,6 +97,8 @@ void FSceneRenderer::Render()
     // (Background is cleared per-path when binding scene color)
     // 렌더링할 대상 수집 (Cull + Gather)
     GatherVisibleProxies();
+	// 가려진 메시는 불투명 패스에서만 뺀다 (섀도우 캐스터는 그대로)
+	PerformOcclusionCulling();
 
 	TIME_PROFILE(ShadowMapPass)
 	RenderShadowMaps();
@@ -248,14 +255,19 @@ void FSceneRenderer::RenderShadowMaps()
 	if (!LightManager) return;
 
 	// 2. 그림자 캐스터(Caster) 메시 수집
+	// 메인 패스와 같은 View를 쓰므로 컴포넌트에 캐시된 드로우 커맨드를 그대로 재사용한다
 	TArray<FMeshBatchElement> ShadowMeshBatches;
+	TArray<UMeshComponent*> ShadowCasters; // 섀도우 캐시 유효성 판단용
+	TIME_PROFILE(MeshBatchCollect)
 	for (UMeshComponent* MeshComponent : Proxies.Meshes)
 	{
 		if (MeshComponent && MeshComponent->IsCastShadows() && MeshComponent->IsVisible())
 		{
 			MeshComponent->CollectMeshBatches(ShadowMeshBatches, View);
+			ShadowCasters.Add(MeshComponent);
 		}
 	}
+	TIME_PROFILE_END(MeshBatchCollect)
 
 	// NOTE: 카메라 오버라이드 기능을 항상 활성화 하기 위해서 그림자를 그릴 곳이 없어도 함수 실행
 	//if (ShadowMeshBatches.IsEmpty()) return;
@@ -333,7 +345,7 @@ void FSceneRenderer::RenderShadowMaps()
 	}
 
 	// 2D 아틀라스 할당
-	LightManager->AllocateAtlasRegions2D(Requests2D);
+	LightManager->AllocateAtlasRegions2D(Requests2D, View->ViewLocation);
 	// 2.2. 큐브맵 슬라이스 할당 (Allocate only)
 	LightManager->AllocateAtlasCubeSlices(RequestsCube); // FLightManager가 RequestsCube의 AssignedSliceIndex와 Size 업데이트
 
@@ -348,7 +360,6 @@ void FSceneRenderer::RenderShadowMaps()
 			ID3D11ShaderResourceView* NullSRV[2] = { nullptr, nullptr };
 			RHIDevice->GetDeviceContext()->PSSetShaderResources(9, 2, NullSRV);
 			
-			float ClearColor[] = {1.0f, 1.0f, 0.0f, 0.0f};
 			EShadowAATechnique ShadowAAType = World->GetRenderSettings().GetShadowAATechnique();
 			switch (ShadowAAType)
 			{
@@ -356,29 +367,75 @@ void FSceneRenderer::RenderShadowMaps()
 				RHIDevice->OMSetCustomRenderTargets(0, nullptr, AtlasDSV2D);
 				break;
 			case EShadowAATechnique::VSM:
-				{
-					RHIDevice->OMSetCustomRenderTargets(1, &VSMAtlasRTV2D, AtlasDSV2D);
-					RHIDevice->GetDeviceContext()->ClearRenderTargetView(VSMAtlasRTV2D, ClearColor);
-					break;
-				}				
+				RHIDevice->OMSetCustomRenderTargets(1, &VSMAtlasRTV2D, AtlasDSV2D);
+				break;
 			default:
 				RHIDevice->OMSetCustomRenderTargets(0, nullptr, AtlasDSV2D);
 				break;
 			}
 
-			RHIDevice->GetDeviceContext()->ClearDepthStencilView(AtlasDSV2D, D3D11_CLEAR_DEPTH | D3D11_CLEAR_STENCIL, 1, 0);
+			// 아틀라스 전체를 지우지 않고, 내용이 바뀐 영역만 지우고 다시 그린다
+			FShadowAtlasAllocator& AtlasAllocator = LightManager->GetShadowAtlasAllocator2D();
+			// 캐스터 바운드는 프레임당 한 번만 구하고, 스태틱 캐스터 전체 상태가 그대로인 영역은 O(1)로 재사용
+			FShadowCasterSet CasterSet;
+			GatherShadowCasters(ShadowCasters, CasterSet);
+
+			TArray<uint64> ContentHashes;
+			TArray<uint64> SceneKeys;
+			TArray<uint8> RegionStates; // 0: 그리지 않음, 1: 다시 그림(캐시 가능), 2: 다시 그림(캐시 불가)
+			ContentHashes.SetNum(Requests2D.Num());
+			SceneKeys.SetNum(Requests2D.Num());
+			RegionStates.SetNum(Requests2D.Num());
+			for (int32 i = 0; i < Requests2D.Num(); ++i)
+			{
+				ContentHashes[i] = 0;
+				SceneKeys[i] = 0;
+				RegionStates[i] = 0;
+				if (Requests2D[i].Size == 0)
+				{
+					continue;
+				}
+
+				const bool bCacheable = !HasDynamicShadowCasterInView(Requests2D[i], CasterSet);
+				const uint64 LightHash = ComputeShadowLightHash(Requests2D[i], ShadowAAType);
+				SceneKeys[i] = HashCombine(LightHash, CasterSet.StaticStateHash);
+				if (bCacheable && AtlasAllocator.IsSceneKeyValid(Requests2D[i], SceneKeys[i]))
+				{
+					AtlasAllocator.AddCachedRegion();
+					continue;
+				}
+
+				// 어딘가의 스태틱 캐스터가 바뀌었으면 이 라이트 클립 공간 안 캐스터만으로 다시 비교
+				ContentHashes[i] = ComputeShadowContentHash(Requests2D[i], LightHash, CasterSet);
+				if (bCacheable && AtlasAllocator.IsContentValid(Requests2D[i], ContentHashes[i]))
+				{
+					AtlasAllocator.UpdateSceneKey(Requests2D[i], SceneKeys[i]);
+					AtlasAllocator.AddCachedRegion();
+					continue;
+				}
+				RegionStates[i] = bCacheable ? 1 : 2;
+
+				D3D11_VIEWPORT ClearVP = { Requests2D[i].AtlasViewportOffset.X, Requests2D[i].AtlasViewportOffset.Y, static_cast<FLOAT>(Requests2D[i].Size), static_cast<FLOAT>(Requests2D[i].Size), 0.0f, 1.0f };
+				RHIDevice->GetDeviceContext()->RSSetViewports(1, &ClearVP);
+				ClearShadowAtlasRegion(ShadowAAType);
+			}
 
 			RHIDevice->RSSetState(ERasterizerMode::Shadows);
 			RHIDevice->OMSetDepthStencilState(EComparisonFunc::LessEqual);
 
-			for (FShadowRenderRequest& Request : Requests2D)
+			for (int32 i = 0; i < Requests2D.Num(); ++i)
 			{
-				// 뷰포트 설정
-				D3D11_VIEWPORT ShadowVP = { Request.AtlasViewportOffset.X, Request.AtlasViewportOffset.Y, static_cast<FLOAT>(Request.Size), static_cast<FLOAT>(Request.Size), 0.0f, 1.0f };
-				RHIDevice->GetDeviceContext()->RSSetViewports(1, &ShadowVP);
+				FShadowRenderRequest& Request = Requests2D[i];
+				if (RegionStates[i] != 0)
+				{
+					// 뷰포트 설정
+					D3D11_VIEWPORT ShadowVP = { Request.AtlasViewportOffset.X, Request.AtlasViewportOffset.Y, static_cast<FLOAT>(Request.Size), static_cast<FLOAT>(Request.Size), 0.0f, 1.0f };
+					RHIDevice->GetDeviceContext()->RSSetViewports(1, &ShadowVP);
 
-				// 뎁스 패스 렌더링
-				RenderShadowDepthPass(Request, ShadowMeshBatches);
+					// 뎁스 패스 렌더링
+					RenderShadowDepthPass(Request, ShadowMeshBatches);
+					AtlasAllocator.MarkContentRendered(Request, ContentHashes[i], SceneKeys[i], RegionStates[i] == 1);
+				}
 
 				FShadowMapData Data;
 				if (Request.Size > 0) // 렌더링 성공
@@ -456,6 +513,145 @@ void FSceneRenderer::RenderShadowMaps()
 	RHIDevice->SetAndUpdateConstantBuffer(ViewProjBufferType(OriginViewProjBuffer));
 }
 
+void FSceneRenderer::ClearShadowAtlasRegion(EShadowAATechnique ShadowAAType)
+{
+	UShader* ClearShader = UResourceManager::GetInstance().Load<UShader>("Shaders/Shadows/ShadowRegionClear.hlsl");
+	if (!ClearShader || !ClearShader->GetVertexShader()) return;
+
+	RHIDevice->PrepareShader(ClearShader);
+	if (ShadowAAType != EShadowAATechnique::VSM)
+	{
+		RHIDevice->GetDeviceContext()->PSSetShader(nullptr, nullptr, 0);
+	}
+
+	// 깊이 1.0을 항상 기록 (GreaterEqual + 쓰기)
+	RHIDevice->RSSetState(ERasterizerMode::Solid_NoCull);
+	RHIDevice->OMSetDepthStencilState(EComparisonFunc::GreaterEqual);
+	RHIDevice->DrawFullScreenQuad();
+}
+
+namespace
+{
+	// AABB 8개 꼭짓점이 모두 같은 클립 평면 밖이면 false
+	bool IsShadowCasterInView(const FShadowCasterInfo& Info, const FMatrix& ViewProj)
+	{
+		if (!Info.bHasBounds)
+		{
+			return true;
+		}
+
+		uint32 OutsideMask = 0x3F;
+		for (int32 Corner = 0; Corner < 8 && OutsideMask; ++Corner)
+		{
+			const FVector4 Position(
+				(Corner & 1) ? Info.Bounds.Max.X : Info.Bounds.Min.X,
+				(Corner & 2) ? Info.Bounds.Max.Y : Info.Bounds.Min.Y,
+				(Corner & 4) ? Info.Bounds.Max.Z : Info.Bounds.Min.Z,
+				1.0f);
+			const FVector4 Clip = Position * ViewProj;
+
+			uint32 CornerMask = 0;
+			CornerMask |= (Clip.X < -Clip.W) ? 0x01 : 0;
+			CornerMask |= (Clip.X > Clip.W) ? 0x02 : 0;
+			CornerMask |= (Clip.Y < -Clip.W) ? 0x04 : 0;
+			CornerMask |= (Clip.Y > Clip.W) ? 0x08 : 0;
+			CornerMask |= (Clip.Z < 0.0f) ? 0x10 : 0;
+			CornerMask |= (Clip.Z > Clip.W) ? 0x20 : 0;
+			OutsideMask &= CornerMask;
+		}
+		return OutsideMask == 0;
+	}
+
+	uint64 HashStaticCaster(uint64 Hash, const UStaticMeshComponent* StaticMeshComponent)
+	{
+		Hash = HashCombine(Hash, reinterpret_cast<uint64>(StaticMeshComponent));
+		Hash = HashCombine(Hash, StaticMeshComponent->GetTransformGeneration());
+		return HashCombine(Hash, reinterpret_cast<uint64>(StaticMeshComponent->GetStaticMesh()));
+	}
+}
+
+void FSceneRenderer::GatherShadowCasters(const TArray<UMeshComponent*>& InShadowCasters, FShadowCasterSet& OutCasters) const
+{
+	OutCasters.StaticCasters.Empty();
+	OutCasters.DynamicCasters.Empty();
+	OutCasters.StaticStateHash = 0;
+
+	for (UMeshComponent* Caster : InShadowCasters)
+	{
+		// GetWorldAABB가 월드 트랜스폼 캐시를 갱신하므로 세대 값은 그 뒤에 읽는다
+		const UStaticMeshComponent* StaticMeshComponent = Cast<UStaticMeshComponent>(Caster);
+
+		FShadowCasterInfo Info;
+		Info.Caster = Caster;
+		Info.Bounds = Caster->GetWorldAABB();
+		// 바운드를 제공하지 않는 캐스터(기본 FAABB)는 항상 겹친다고 본다
+		Info.bHasBounds = Info.Bounds.IsValid() && (StaticMeshComponent ||
+			Info.Bounds.Min.X != Info.Bounds.Max.X || Info.Bounds.Min.Y != Info.Bounds.Max.Y || Info.Bounds.Min.Z != Info.Bounds.Max.Z);
+
+		// 스키닝 등 트랜스폼 변화 없이 모양이 바뀔 수 있는 캐스터는 동적으로 분류
+		if (!StaticMeshComponent)
+		{
+			OutCasters.DynamicCasters.Add(Info);
+			continue;
+		}
+
+		OutCasters.StaticCasters.Add(Info);
+		OutCasters.StaticStateHash = HashStaticCaster(OutCasters.StaticStateHash, StaticMeshComponent);
+	}
+}
+
+uint64 FSceneRenderer::ComputeShadowLightHash(const FShadowRenderRequest& ShadowRequest, EShadowAATechnique ShadowAAType) const
+{
+	uint64 Hash = HashCombine(static_cast<uint64>(ShadowAAType), ShadowRequest.Size);
+	auto HashFloats = [&Hash](const float* Values, int32 Count)
+	{
+		for (int32 i = 0; i < Count; ++i)
+		{
+			uint32 Bits;
+			memcpy(&Bits, &Values[i], sizeof(Bits));
+			Hash = HashCombine(Hash, Bits);
+		}
+	};
+	HashFloats(&ShadowRequest.ViewMatrix.M[0][0], 16);
+	HashFloats(&ShadowRequest.ProjectionMatrix.M[0][0], 16);
+	HashFloats(&ShadowRequest.WorldLocation.X, 3);	// VSM 깊이 계산에 사용
+	HashFloats(&ShadowRequest.Radius, 1);
+	return Hash;
+}
+
+uint64 FSceneRenderer::ComputeShadowContentHash(const FShadowRenderRequest& ShadowRequest, uint64 LightHash, const FShadowCasterSet& Casters) const
+{
+	// 라이트 클립 공간과 겹치는 스태틱 캐스터만 반영
+	uint64 Hash = LightHash;
+	const FMatrix ViewProj = ShadowRequest.ViewMatrix * ShadowRequest.ProjectionMatrix;
+	for (const FShadowCasterInfo& Info : Casters.StaticCasters)
+	{
+		if (IsShadowCasterInView(Info, ViewProj))
+		{
+			Hash = HashStaticCaster(Hash, static_cast<const UStaticMeshComponent*>(Info.Caster));
+		}
+	}
+	return Hash;
+}
+
+bool FSceneRenderer::HasDynamicShadowCasterInView(const FShadowRenderRequest& ShadowRequest, const FShadowCasterSet& Casters) const
+{
+	if (Casters.DynamicCasters.IsEmpty())
+	{
+		return false;
+	}
+
+	const FMatrix ViewProj = ShadowRequest.ViewMatrix * ShadowRequest.ProjectionMatrix;
+	for (const FShadowCasterInfo& Info : Casters.DynamicCasters)
+	{
+		if (IsShadowCasterInView(Info, ViewProj))
+		{
+			return true;
+		}
+	}
+	return false;
+}
+
 void FSceneRenderer::RenderShadowDepthPass(FShadowRenderRequest& ShadowRequest, const TArray<FMeshBatchElement>& InShadowBatches)
 {
 	// 1. 뎁스 전용 셰이더 로드
@@ -854,6 +1050,13 @@ void FSceneRenderer::GatherVisibleProxies()
 		ShadowStats.ShadowCubeArrayCount = LightManager->GetShadowCubeArrayCount();
 		ShadowStats.Calculate2DAtlasMemory();
 		ShadowStats.CalculateCubeAtlasMemory();
+
+		const FShadowAtlasFrameStats& AtlasStats = LightManager->GetShadowAtlasAllocator2D().GetFrameStats();
+		ShadowStats.ShadowAtlasRegions = AtlasStats.NumRegions;
+		ShadowStats.ShadowAtlasDemotedRegions = AtlasStats.NumDemoted;
+		ShadowStats.ShadowAtlasDroppedRegions = AtlasStats.NumDropped;
+		ShadowStats.ShadowAtlasRenderedRegions = AtlasStats.NumRendered;
+		ShadowStats.ShadowAtlasCachedRegions = AtlasStats.NumCached;
 	}
 
 	UPDATE_SKINNING_STATS(Proxies.Meshes)
@@ -865,6 +1068,74 @@ void FSceneRenderer::GatherVisibleProxies()
 	FShadowStatManager::GetInstance().UpdateStats(ShadowStats);
 }
 
+void FSceneRenderer::PerformOcclusionCulling()
+{
+	VisibleMeshes = Proxies.Meshes;
+	if (!OcclusionCuller || Proxies.Meshes.IsEmpty() ||
+		!World->GetRenderSettings().IsShowFlagEnabled(EEngineShowFlags::SF_OcclusionCulling))
+	{
+		return;
+	}
+
+	constexpr int32 GridWidth = 512;	// CPU 깊이 버퍼 폭 (높이는 뷰 비율)
+
+	TIME_PROFILE(OcclusionCulling)
+	const int32 ViewWidth = std::max(1, static_cast<int32>(View->ViewRect.Width()));
+	const int32 ViewHeight = std::max(1, static_cast<int32>(View->ViewRect.Height()));
+	OcclusionCuller->Initialize(GridWidth, std::max(1, GridWidth * ViewHeight / ViewWidth));
+
+	const FMatrix ViewProj = View->ViewMatrix * View->ProjectionMatrix;
+
+	// 후보/오클루더 수집 (GetWorldAABB가 트랜스폼을 갱신하므로 직렬), 후보 인덱스 = Proxies.Meshes 인덱스
+	TArray<FCandidateDrawable> Candidates;
+	TArray<FOccluderInstance> Occluders;
+	Candidates.Reserve(Proxies.Meshes.Num());
+	for (int32 i = 0; i < Proxies.Meshes.Num(); ++i)
+	{
+		// 스키닝 메시는 포즈에 따라 경계가 달라지므로 항상 보임으로 둔다
+		const UStaticMeshComponent* StaticMeshComponent = Cast<UStaticMeshComponent>(Proxies.Meshes[i]);
+		UStaticMesh* StaticMesh = StaticMeshComponent ? StaticMeshComponent->GetStaticMesh() : nullptr;
+		if (!StaticMesh)
+		{
+			continue;
+		}
+
+		FCandidateDrawable Candidate;
+		Candidate.ActorIndex = static_cast<uint32>(i);
+		Candidate.Bound = StaticMeshComponent->GetWorldAABB();
+		Candidate.WorldViewProj = ViewProj;
+		if (!Candidate.Bound.IsValid())
+		{
+			continue;
+		}
+		Candidates.Add(Candidate);
+
+		FOccluderInstance Occluder;
+		Occluder.Mesh = OcclusionCuller->GetOccluderMesh(StaticMesh->GetStaticMeshAsset());
+		Occluder.WorldViewProj = StaticMeshComponent->GetWorldMatrix() * ViewProj;
+		const float Radius = (Candidate.Bound.Max - Candidate.Bound.Min).Size() * 0.5f;
+		Occluder.ScreenSize = Radius / std::max(FVector::Distance(Candidate.Bound.GetCenter(), View->ViewLocation), View->NearClip);
+		Occluders.Add(Occluder);
+	}
+	FOcclusionCullingManagerCPU::SelectOccluders(Occluders);
+
+	OcclusionCuller->BuildOccluderDepth(Occluders);
+	OcclusionCuller->BuildHZB();
+
+	TArray<uint8_t> VisibleFlags(Proxies.Meshes.Num(), 1);
+	OcclusionCuller->TestOcclusion(Candidates, VisibleFlags);
+
+	VisibleMeshes.Empty();
+	for (int32 i = 0; i < Proxies.Meshes.Num(); ++i)
+	{
+		if (VisibleFlags[i])
+		{
+			VisibleMeshes.Add(Proxies.Meshes[i]);
+		}
+	}
+	TIME_PROFILE_END(OcclusionCulling)
+}
+
 void FSceneRenderer::PerformTileLightCulling()
 {
 	if (!TileLightCuller)
@@ -910,6 +1181,10 @@ void FSceneRenderer::PerformTileLightCulling()
 	TileCullingBuffer.bUseTileCulling = bTileCullingEnabled ? 1 : 0;  // ShowFlag에 따라 설정
 	TileCullingBuffer.ViewportStartX = View->ViewRect.MinX;  // ShowFlag에 따라 설정
 	TileCullingBuffer.ViewportStartY = View->ViewRect.MinY;  // ShowFlag에 따라 설정
+	TileCullingBuffer.ClusterSliceCount = TileLightCuller->GetClusterSliceCount();
+	TileCullingBuffer.LightListStride = TileLightCuller->GetLightListStride();
+	TileCullingBuffer.ClusterDepthScale = TileLightCuller->GetClusterDepthScale();
+	TileCullingBuffer.ClusterDepthBias = TileLightCuller->GetClusterDepthBias();
 
 	RHIDevice->SetAndUpdateConstantBuffer(TileCullingBuffer);
 
@@ -948,10 +1223,12 @@ void FSceneRenderer::RenderOpaquePass(EViewMode InRenderViewMode)
 {
 	// --- 1. 수집 (Collect) ---
 	MeshBatchElements.Empty();
-	for (UMeshComponent* MeshComponent : Proxies.Meshes)
+	TIME_PROFILE(MeshBatchCollect)
+	for (UMeshComponent* MeshComponent : VisibleMeshes)
 	{
 		MeshComponent->CollectMeshBatches(MeshBatchElements, View);
 	}
+	TIME_PROFILE_END(MeshBatchCollect)
 
 	// Collect normal billboards (not always-on-top)
 	for (UBillboardComponent* BillboardComponent : Proxies.Billboards)
@@ -968,13 +1245,19 @@ void FSceneRenderer::RenderOpaquePass(EViewMode InRenderViewMode)
 		//TextRenderComponent->CollectMeshBatches(MeshBatchElements, View);
 	}
 
-	// --- 2. 정렬 (Sort) ---
-	MeshBatchElements.Sort();
+	// --- 2. 정렬 (Sort) --- 배치는 그대로 두고 64비트 키로 인덱스만 정렬
+	FMeshBatchSorter::Get().Sort(MeshBatchElements, EMeshBatchSortMode::State, View->ViewLocation, MeshBatchDrawOrder);
+
+	// --- 2.5 자동 인스턴싱 --- 정렬 후 연속된 같은 메시/머티리얼 배치를 인스턴스 드로우로 합친다
+	if (World->GetRenderSettings().IsShowFlagEnabled(EEngineShowFlags::SF_AutoInstancing))
+	{
+		OwnerRenderer->GetMeshInstancing().MergeInstancedRuns(RHIDevice, MeshBatchElements, MeshBatchDrawOrder);
+	}
 
 	// --- 3. 그리기 (Draw) ---
 	{
 		GPU_TIME_PROFILE("GPUSkinning")
-		DrawMeshBatches(MeshBatchElements, true);
+		DrawMeshBatches(MeshBatchElements, true, &MeshBatchDrawOrder);
 	}
 
 	// --- 4. Always-on-top billboards (depth test disabled) ---
@@ -1069,28 +1352,32 @@ void FSceneRenderer::RenderParticlePass()
 	FParticleStatManager::GetInstance().AddDrawCalls(OpaqueParticleBatches.Num());
 	FParticleStatManager::GetInstance().AddDrawCalls(AdditiveParticleBatches.Num());
 
-	OpaqueParticleBatches.Sort();
+	FMeshBatchSorter& Sorter = FMeshBatchSorter::Get();
+
 	if (!OpaqueParticleBatches.IsEmpty())
 	{
+		Sorter.Sort(OpaqueParticleBatches, EMeshBatchSortMode::State, View->ViewLocation, MeshBatchDrawOrder);
 		RHIDevice->OMSetDepthStencilState(EComparisonFunc::LessEqual);
 		RHIDevice->OMSetBlendState(EMaterialBlendMode::Opaque);
-		DrawMeshBatches(OpaqueParticleBatches, true);
+		DrawMeshBatches(OpaqueParticleBatches, true, &MeshBatchDrawOrder);
 	}
 
-	TranslucentParticleBatches.Sort();
+	// 반투명은 같은 SortPriority 안에서 먼 이미터부터
 	if (!TranslucentParticleBatches.IsEmpty())
 	{
+		Sorter.Sort(TranslucentParticleBatches, EMeshBatchSortMode::BackToFront, View->ViewLocation, MeshBatchDrawOrder);
 		RHIDevice->OMSetDepthStencilState(EComparisonFunc::LessEqualReadOnly);
 		RHIDevice->OMSetBlendState(EMaterialBlendMode::Translucent);
-		DrawMeshBatches(TranslucentParticleBatches, true);
+		DrawMeshBatches(TranslucentParticleBatches, true, &MeshBatchDrawOrder);
 	}
 
-	AdditiveParticleBatches.Sort();
+	// Additive는 순서와 무관하므로 상태 순
 	if (!AdditiveParticleBatches.IsEmpty())
 	{
+		Sorter.Sort(AdditiveParticleBatches, EMeshBatchSortMode::State, View->ViewLocation, MeshBatchDrawOrder);
 		RHIDevice->OMSetDepthStencilState(EComparisonFunc::LessEqualReadOnly);
 		RHIDevice->OMSetBlendState(EMaterialBlendMode::Additive);
-		DrawMeshBatches(AdditiveParticleBatches, true);
+		DrawMeshBatches(AdditiveParticleBatches, true, &MeshBatchDrawOrder);
 	}
 
 	// Renderer 복구
@@ -1194,7 +1481,9 @@ void FSceneRenderer::RenderDecalPass()
 			BatchElement.PixelShader = ShaderVariant->PixelShader;
 			BatchElement.VertexStride = sizeof(FVertexDynamic);
 		}
-		DrawMeshBatches(MeshBatchElements, true);
+		// 셰이더/머티리얼이 모두 같으므로 사실상 버퍼 순으로 묶인다
+		FMeshBatchSorter::Get().Sort(MeshBatchElements, EMeshBatchSortMode::State, View->ViewLocation, MeshBatchDrawOrder);
+		DrawMeshBatches(MeshBatchElements, true, &MeshBatchDrawOrder);
 
 		// --- 데칼 렌더 시간 측정 종료 및 결과 저장 ---
 		auto CpuTimeEnd = std::chrono::high_resolution_clock::now();
@@ -1504,9 +1793,11 @@ void FSceneRenderer::RenderFinalOverlayLines()
 }
 
 // 수집한 Batch 그리기
-void FSceneRenderer::DrawMeshBatches(TArray<FMeshBatchElement>& InMeshBatches, bool bClearListAfterDraw)
+void FSceneRenderer::DrawMeshBatches(TArray<FMeshBatchElement>& InMeshBatches, bool bClearListAfterDraw, const TArray<uint32>* InDrawOrder)
 {
 	if (InMeshBatches.IsEmpty()) return;
+
+	TIME_PROFILE(MeshBatchSubmit)
 	constexpr UINT ParticleInstanceDataSlot = 14;
 
 	// RHI 상태 초기 설정 (Opaque Pass 기본값)
@@ -1527,6 +1818,7 @@ void FSceneRenderer::DrawMeshBatches(TArray<FMeshBatchElement>& InMeshBatches, b
 	ID3D11ShaderResourceView* CurrentInstanceSRV = nullptr; // [추가] Instance SRV 캐시
 	ID3D11Buffer* CurrentVertexBuffer = nullptr;
 	ID3D11Buffer* CurrentIndexBuffer = nullptr;
+	ID3D11Buffer* CurrentInstanceBuffer = nullptr;	// 인스턴스 드로우가 아니면 nullptr
 	UINT CurrentVertexStride = 0;
 	D3D11_PRIMITIVE_TOPOLOGY CurrentTopology = D3D11_PRIMITIVE_TOPOLOGY_UNDEFINED;
 	// GPU 스키닝
@@ -1541,9 +1833,13 @@ void FSceneRenderer::DrawMeshBatches(TArray<FMeshBatchElement>& InMeshBatches, b
 	ID3D11SamplerState* ShadowSampler = RHIDevice->GetSamplerState(RHI_Sampler_Index::Shadow);
 	ID3D11SamplerState* VSMSampler = RHIDevice->GetSamplerState(RHI_Sampler_Index::VSM);
 
-	// 정렬된 리스트 순회
-	for (const FMeshBatchElement& Batch : InMeshBatches)
+	// 정렬된 리스트 순회 (자동 인스턴싱 후에는 순서 배열이 배치 수보다 짧을 수 있다)
+	const int32 NumDraws = InDrawOrder ? InDrawOrder->Num() : InMeshBatches.Num();
+	uint32 NumDrawCalls = 0;
+	for (int32 DrawIndex = 0; DrawIndex < NumDraws; ++DrawIndex)
 	{
+		const FMeshBatchElement& Batch = InDrawOrder ? InMeshBatches[(*InDrawOrder)[DrawIndex]] : InMeshBatches[DrawIndex];
+
 		// --- 필수 요소 유효성 검사 ---
 		const bool bMissingShaders = (!Batch.VertexShader || !Batch.PixelShader);
 		const bool bNeedsGeometryBuffers = (!Batch.VertexBuffer || !Batch.IndexBuffer || Batch.VertexStride == 0) ||
@@ -1665,17 +1961,20 @@ void FSceneRenderer::DrawMeshBatches(TArray<FMeshBatchElement>& InMeshBatches, b
 		}
 
 		// 3. IA (Input Assembler) 상태 변경
+		ID3D11Buffer* BatchInstanceBuffer = Batch.bInstancedDraw ? Batch.InstanceVertexBuffer : nullptr;
 		if (Batch.VertexBuffer != CurrentVertexBuffer ||
 			Batch.IndexBuffer != CurrentIndexBuffer ||
+			BatchInstanceBuffer != CurrentInstanceBuffer ||
 			Batch.VertexStride != CurrentVertexStride ||
 			Batch.PrimitiveTopology != CurrentTopology)
 		{
 			if (Batch.bInstancedDraw)
 			{
 				// 두 개의 VB: 0 = mesh, 1 = instance
+				// InstanceStart는 Draw의 StartInstanceLocation으로만 적용한다 (오프셋까지 주면 두 번 더해짐)
 				ID3D11Buffer* vbs[2] = { Batch.VertexBuffer, Batch.InstanceVertexBuffer };
 				UINT strides[2] = { Batch.VertexStride, Batch.InstanceStride };
-				UINT offsets[2] = { 0, Batch.InstanceStart * Batch.InstanceStride }; // InstanceStart 오프셋
+				UINT offsets[2] = { 0, 0 };
 
 				RHIDevice->GetDeviceContext()->IASetVertexBuffers(0, 2, vbs, strides, offsets);
 
@@ -1697,6 +1996,7 @@ void FSceneRenderer::DrawMeshBatches(TArray<FMeshBatchElement>& InMeshBatches, b
 			// 현재 IA 상태 캐싱
 			CurrentVertexBuffer = Batch.VertexBuffer;
 			CurrentIndexBuffer = Batch.IndexBuffer;
+			CurrentInstanceBuffer = BatchInstanceBuffer;
 			CurrentVertexStride = Batch.VertexStride;
 			CurrentTopology = Batch.PrimitiveTopology;
 		}
@@ -1752,7 +2052,9 @@ void FSceneRenderer::DrawMeshBatches(TArray<FMeshBatchElement>& InMeshBatches, b
 		{
 			RHIDevice->GetDeviceContext()->DrawIndexed(Batch.IndexCount, Batch.StartIndex, Batch.BaseVertexIndex);
 		}
+		++NumDrawCalls;
 	}
+	FMeshDrawCommandStatManager::GetInstance().AddDrawCalls(NumDrawCalls);
 
 	// 루프 종료 후 리스트 비우기 (옵션)
 	if (bClearListAfterDraw)
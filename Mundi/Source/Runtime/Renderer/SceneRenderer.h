@@ -1,5 +1,6 @@
 ﻿#pragma once
 #include "Frustum.h"
+#include "AABB.h"
 
 // TODO : Post Processing 떼어내기, 전방선언으로라든지... 결국 안 하는군 ㅎㅎ
 #include "PostProcessing/FadeInOutPass.h"
@@ -30,6 +31,7 @@ class UTextRenderComponent;
 class UGizmoArrowComponent;
 class FSceneView;
 class FTileLightCuller;
+class FOcclusionCullingManagerCPU;
 class ULineComponent;
 class UParticleSystemComponent;
 
@@ -68,6 +70,21 @@ struct FSceneGlobals
 	TArray<UHeightFogComponent*> Fogs;	// 첫 번째로 찾은 Fog를 사용함
 };
 
+// 섀도우 캐시 판단용 캐스터 정보 (프레임당 한 번 수집, 모든 섀도우 요청이 공유)
+struct FShadowCasterInfo
+{
+	const UMeshComponent* Caster = nullptr;
+	FAABB Bounds;
+	bool bHasBounds = false;	// false면 모든 라이트 뷰와 겹친다고 본다
+};
+
+struct FShadowCasterSet
+{
+	TArray<FShadowCasterInfo> StaticCasters;	// 스태틱 메시 (트랜스폼 세대 + 메시로 내용이 정해짐)
+	TArray<FShadowCasterInfo> DynamicCasters;	// 스키닝 등, 라이트 뷰와 겹치면 그 영역은 캐시 불가
+	uint64 StaticStateHash = 0;					// 전체 스태틱 캐스터 상태, 바뀌지 않았으면 영역 검사는 O(1)
+};
+
 /**
  * @class FSceneRenderer
  * @brief 한 프레임의 특정 뷰(View)에 대한 씬 렌더링을 총괄하는 임시(transient) 클래스.
@@ -89,6 +106,16 @@ private:
 
 	void RenderShadowMaps();
 	void RenderShadowDepthPass(FShadowRenderRequest& ShadowRequest, const TArray<FMeshBatchElement>& InShadowBatches);
+	/** @brief 현재 뷰포트(아틀라스 영역 하나)만 깊이 1.0 / VSM 초기값으로 지웁니다. */
+	void ClearShadowAtlasRegion(EShadowAATechnique ShadowAAType);
+	/** @brief 캐스터 바운드와 스태틱 캐스터 전체 상태 해시를 한 번에 수집합니다. */
+	void GatherShadowCasters(const TArray<UMeshComponent*>& InShadowCasters, FShadowCasterSet& OutCasters) const;
+	/** @brief 섀도우 영역의 라이트 쪽 해시 (AA 방식, 크기, 라이트 행렬) */
+	uint64 ComputeShadowLightHash(const FShadowRenderRequest& ShadowRequest, EShadowAATechnique ShadowAAType) const;
+	/** @brief 섀도우 영역의 내용 해시 (라이트 해시 + 라이트 클립 공간 안 스태틱 캐스터의 트랜스폼/메시) */
+	uint64 ComputeShadowContentHash(const FShadowRenderRequest& ShadowRequest, uint64 LightHash, const FShadowCasterSet& Casters) const;
+	/** @brief 라이트 클립 공간 안에 스키닝 등 동적 캐스터가 있는지 (있으면 캐시 불가) */
+	bool HasDynamicShadowCasterInView(const FShadowRenderRequest& ShadowRequest, const FShadowCasterSet& Casters) const;
 
 	/** @brief 렌더링에 필요한 포인터들이 유효한지 확인합니다. */
 	bool IsValid() const;
@@ -102,13 +129,17 @@ private:
 	/** @brief 씬을 순회하며 컬링을 통과한 모든 렌더링 대상을 수집합니다. */
 	void GatherVisibleProxies();
 
+	/** @brief 오클루더 삼각형으로 CPU 깊이/HZB를 만들고, 가려진 스태틱 메시를 불투명 패스 목록(VisibleMeshes)에서 뺍니다. */
+	void PerformOcclusionCulling();
+
 	/** @brief 타일 기반 라이트 컬링을 수행하고 Structured Buffer를 업데이트합니다. */
 	void PerformTileLightCulling();
 
 	/** @brief 불투명(Opaque) 객체들을 렌더링하는 패스입니다. */
 	void RenderOpaquePass(EViewMode InRenderViewMode);
 
-	void DrawMeshBatches(TArray<FMeshBatchElement>& InMeshBatches, bool bClearListAfterDraw);
+	// InDrawOrder가 있으면 그 인덱스 순서대로 그린다 (FMeshBatchSorter 결과)
+	void DrawMeshBatches(TArray<FMeshBatchElement>& InMeshBatches, bool bClearListAfterDraw, const TArray<uint32>* InDrawOrder = nullptr);
 
 	void RenderParticlePass();
 	void RenderDecalPass();
@@ -140,6 +171,9 @@ private:
 	// 수집된 렌더링 대상 목록
 	FVisibleRenderProxySet Proxies;
 
+	// 오클루전 컬링을 통과한 메시 (불투명 패스용, 섀도우 캐스터는 Proxies.Meshes를 그대로 쓴다)
+	TArray<UMeshComponent*> VisibleMeshes;
+
 	// 씬 지역 설정
 	FSceneLocals SceneLocals;
 
@@ -151,9 +185,13 @@ private:
 
 	// 각 패스에서 수집된 드로우 콜 정보 리스트
 	TArray<FMeshBatchElement> MeshBatchElements;
+	TArray<uint32> MeshBatchDrawOrder;	// 정렬된 그리기 순서 (MeshBatchElements 등의 인덱스)
+
+	// 타일 기반 라이트 컬링 시스템 (URenderer 소유, 버퍼 재사용)
+	FTileLightCuller* TileLightCuller = nullptr;
 
-	// 타일 기반 라이트 컬링 시스템 (매 프레임 생성되고 소멸되어서 스마트 포인터로 설정)
-	std::unique_ptr<FTileLightCuller> TileLightCuller;
+	// CPU 오클루전 컬링 (URenderer 소유, 버퍼/오클루더 메시 캐시 재사용)
+	FOcclusionCullingManagerCPU* OcclusionCuller = nullptr;
 
 	// TODO : 자동으로 등록되게 바꾸기!, bloom 빼고 다 stateless해서 걔네는 static(etc..) 등 하이브리도 구조로 바꾸기
 	// PostProcessing
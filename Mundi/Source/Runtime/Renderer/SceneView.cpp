@@ -3,6 +3,7 @@
 #include "CameraActor.h"
 #include "FViewport.h"
 #include "Frustum.h"
+#include "Shader.h"
 
 FSceneView::FSceneView(FMinimalViewInfo* InMinimalViewInfo, URenderSettings* InRenderSettings)
 	: RenderSettings(InRenderSettings)
@@ -41,6 +42,7 @@ FSceneView::FSceneView(FMinimalViewInfo* InMinimalViewInfo, URenderSettings* InR
 	);
 
 	ViewShaderMacros = CreateViewShaderMacros();
+	ViewShaderKey = UShader::GenerateShaderKey(ViewShaderMacros);
 }
 
 FSceneView::FSceneView(UCameraComponent* InCamera, FViewport* InViewport, URenderSettings* InRenderSettings)
@@ -78,13 +80,22 @@ FSceneView::FSceneView(UCameraComponent* InCamera, FViewport* InViewport, URende
 	ProjectionMode = InCamera->GetProjectionMode();
 
 	ViewShaderMacros = CreateViewShaderMacros();
+	ViewShaderKey = UShader::GenerateShaderKey(ViewShaderMacros);
 }
 
 TArray<FShaderMacro> FSceneView::CreateViewShaderMacros()
+{
+	return MakeViewShaderMacros(
+		RenderSettings->GetViewMode(),
+		RenderSettings->IsShowFlagEnabled(EEngineShowFlags::SF_ShadowAntiAliasing),
+		RenderSettings->GetShadowAATechnique());
+}
+
+TArray<FShaderMacro> FSceneView::MakeViewShaderMacros(EViewMode InViewMode, bool bShadowAntiAliasing, EShadowAATechnique InTechnique)
 {
 	TArray<FShaderMacro> ShaderMacros;
 
-	switch (RenderSettings->GetViewMode())
+	switch (InViewMode)
 	{
 	case EViewMode::VMI_Lit_Phong:
 		ShaderMacros.push_back(FShaderMacro{ "LIGHTING_MODEL_PHONG", "1" });
@@ -107,14 +118,13 @@ TArray<FShaderMacro> FSceneView::CreateViewShaderMacros()
 	}
 
 	// 그림자 AA 설정
-	if (RenderSettings->IsShowFlagEnabled(EEngineShowFlags::SF_ShadowAntiAliasing))
+	if (bShadowAntiAliasing)
 	{
-		EShadowAATechnique Technique = RenderSettings->GetShadowAATechnique();
-		if (Technique == EShadowAATechnique::PCF)
+		if (InTechnique == EShadowAATechnique::PCF)
 		{
 			ShaderMacros.Add(FShaderMacro("SHADOW_AA_TECHNIQUE", "1")); // 1 = PCF
 		}
-		else if (Technique == EShadowAATechnique::VSM)
+		else if (InTechnique == EShadowAATechnique::VSM)
 		{
 			ShaderMacros.Add(FShaderMacro("SHADOW_AA_TECHNIQUE", "2")); // 2 = VSM
 		}
@@ -126,3 +136,22 @@ TArray<FShaderMacro> FSceneView::CreateViewShaderMacros()
 
 	return ShaderMacros;
 }
+
+TArray<TArray<FShaderMacro>> FSceneView::GetAllViewShaderMacroSets()
+{
+	// 셰이더 Variant를 바꾸는 뷰 모드만 (Wireframe/SceneDepth는 별도 셰이더 또는 래스터 상태로 처리)
+	static const EViewMode ViewModes[] =
+	{
+		EViewMode::VMI_Lit_Phong, EViewMode::VMI_Lit_Gouraud, EViewMode::VMI_Lit_Lambert,
+		EViewMode::VMI_Unlit, EViewMode::VMI_WorldNormal
+	};
+
+	TArray<TArray<FShaderMacro>> MacroSets;
+	for (EViewMode ViewMode : ViewModes)
+	{
+		MacroSets.Add(MakeViewShaderMacros(ViewMode, false, EShadowAATechnique::PCF));
+		MacroSets.Add(MakeViewShaderMacros(ViewMode, true, EShadowAATechnique::PCF));
+		MacroSets.Add(MakeViewShaderMacros(ViewMode, true, EShadowAATechnique::VSM));
+	}
+	return MacroSets;
+}
@@ -49,6 +49,10 @@ public:
     FSceneView(FMinimalViewInfo* InMinimalViewInfo, URenderSettings* InRenderSettings);
     FSceneView(UCameraComponent* InCamera, FViewport* InViewport, URenderSettings* InRenderSettings);
 
+    // 뷰 모드/그림자 AA 설정에 대응하는 뷰 매크로 (셰이더 사전 컴파일에서도 같은 조합을 쓰도록 공유)
+    static TArray<FShaderMacro> MakeViewShaderMacros(EViewMode InViewMode, bool bShadowAntiAliasing, EShadowAATechnique InTechnique);
+    static TArray<TArray<FShaderMacro>> GetAllViewShaderMacroSets();
+
 private:
     TArray<FShaderMacro> CreateViewShaderMacros();
 
@@ -68,6 +72,7 @@ public:
     // 렌더링 설정
     ECameraProjectionMode ProjectionMode = ECameraProjectionMode::Perspective;
     TArray<FShaderMacro> ViewShaderMacros;
+    uint64 ViewShaderKey = 0;   // ViewShaderMacros의 UShader::GenerateShaderKey (뷰 모드별 캐시 키)
     float NearClip = 0.0f;
     float FarClip = 0.0f;
     float FieldOfView = 0.0f;
@@ -1,54 +1,27 @@
 ﻿#include "pch.h"
 #include "Shader.h"
 #include "Hash.h"
+#include "MeshInstancing.h"
+#include "ShaderCompiler.h"
 
 IMPLEMENT_CLASS(UShader)
 
-// 컴파일 로직을 처리하는 비공개 헬퍼 함수
-static bool CompileShaderInternal(
-	const FWideString& InFilePath,
-	const char* InEntryPoint,
-	const char* InTarget,
-	UINT InCompileFlags,
-	const D3D_SHADER_MACRO* InDefines,
-	ID3DBlob** OutBlob
-)
+namespace
 {
-	ID3DBlob* ErrorBlob = nullptr;
-	HRESULT Hr = D3DCompileFromFile(
-		InFilePath.c_str(),
-		InDefines,
-		D3D_COMPILE_STANDARD_FILE_INCLUDE,
-		InEntryPoint,
-		InTarget,
-		InCompileFlags,
-		0,
-		OutBlob,
-		&ErrorBlob
-	);
-
-	if (FAILED(Hr))
-	{
-		if (ErrorBlob)
-		{
-			char* Msg = (char*)ErrorBlob->GetBufferPointer();
-
-			// wstring을 UTF-8로 안전하게 변환 (한글 경로 지원)
-			FString NarrowPath = WideToUTF8(InFilePath);
-
-			UE_LOG("[error] Shader '%s' compile error: %s", NarrowPath.c_str(), Msg);
-			ErrorBlob->Release();
-		}
-		if (*OutBlob) { (*OutBlob)->Release(); }
-		return false;
+	bool EndsWithNoCase(const FString& Str, const FString& Suffix)
+	{
+		if (Str.size() < Suffix.size()) return false;
+		return std::equal(Suffix.rbegin(), Suffix.rend(), Str.rbegin(),
+			[](char a, char b) { return static_cast<char>(::tolower(a)) == static_cast<char>(::tolower(b)); });
 	}
 
-	if (ErrorBlob) { ErrorBlob->Release(); }
-	return true;
+	// 입력 레이아웃을 바꾸는 매크로 (대체 Variant는 이 매크로들이 같아야 한다)
+	const char* const LayoutAffectingMacros[] = { "USE_INSTANCING", "USE_GPU_SKINNING" };
 }
 
 UShader::~UShader()
 {
+	FShaderCompileManager::Get().CancelJobs(this);
 	ReleaseResources();
 }
 
@@ -133,21 +106,23 @@ bool UShader::Load(const FString& InShaderPath, ID3D11Device* InDevice, const TA
 
 	// 2. 실제 컴파일/가져오기 로직은 GetOrCompileShaderVariant에 위임
 	// (이 함수는 InMacros에 대한 Variant가 맵에 없으면 컴파일하고 추가함)
-	GetOrCompileShaderVariant(InMacros);
+	// 로드/핫 리로드 시점의 요청은 바로 결과가 필요하므로 동기 컴파일
+	GetOrCompileShaderVariant(InMacros, false);
 	return true;
 }
 
 /**
  * @brief 외부(예: UMaterial)에서 특정 매크로 조합의 Variant를 요청할 때 사용합니다.
- * 1. 이 셰이더 객체(ActualFilePath)에 대해 해당 매크로 Variant가 이미 컴파일되었는지 확인합니다.
- * 2. 컴파일되지 않았다면, 즉시 컴파일하고 맵에 추가합니다.
- * 3. FShaderVariant*를 반환합니다. (컴파일 실패 시 nullptr)
+ * 1. 이 셰이더 객체(ActualFilePath)에 대해 해당 매크로 Variant가 이미 만들어졌는지 확인합니다.
+ * 2. 디스크 바이트코드 캐시에 있으면 바로 셰이더 객체를 만들어 맵에 추가합니다.
+ * 3. 없으면 백그라운드 컴파일을 제출하고, 완료될 때까지 입력 레이아웃이 같은 다른 Variant를 대신 반환합니다.
+ *    (대신할 Variant가 없거나 bAllowAsync가 false면 동기 컴파일)
  *
- * @param InDevice D3D 디바이스
  * @param InMacros 컴파일(또는 검색)할 매크로 배열
- * @return FShaderVariant 포인터 (성공 시) 또는 nullptr (실패 시)
+ * @param bAllowAsync 백그라운드 컴파일 허용 여부
+ * @return FShaderVariant 포인터 (성공 시) 또는 nullptr (실패 시, 또는 대체 Variant 없이 컴파일 중일 때)
  */
-FShaderVariant* UShader::GetOrCompileShaderVariant(const TArray<FShaderMacro>& InMacros)
+FShaderVariant* UShader::GetOrCompileShaderVariant(const TArray<FShaderMacro>& InMacros, bool bAllowAsync)
 {
 	ID3D11Device* InDevice = GEngine.GetRHIDevice()->GetDevice();
 
@@ -167,31 +142,52 @@ FShaderVariant* UShader::GetOrCompileShaderVariant(const TArray<FShaderMacro>& I
 		return Found; // 찾았으면 즉시 반환
 	}
 
-	// 3. 맵에 없음 -> 새로 컴파일
-	FShaderVariant NewShaderVariant;
-	bool bSuccess = CompileVariantInternal(InDevice, FilePath, InMacros, NewShaderVariant);
+	// 백그라운드 컴파일 중이거나 실패한 조합은 대체 Variant로
+	if (PendingVariantKeys.Contains(Key) || FailedVariantKeys.Contains(Key))
+	{
+		return FindFallbackVariant(InMacros);
+	}
+
+	// 3. 디스크 캐시 -> 백그라운드 컴파일 -> 동기 컴파일 순으로 시도
+	TArray<FShaderStageCompile> Stages;
+	BuildStageCompiles(FilePath, InMacros, Stages);
+
+	FShaderCompileManager& Compiler = FShaderCompileManager::Get();
+	if (!Compiler.LoadFromCache(Stages))
+	{
+		if (bAllowAsync && Compiler.IsAsyncCompileEnabled())
+		{
+			// 인스턴싱 Variant는 없어도 인스턴싱만 꺼지므로 대체 없이 기다릴 수 있다
+			FShaderVariant* Fallback = FindFallbackVariant(InMacros);
+			if (Fallback || HasMacro(InMacros, "USE_INSTANCING"))
+			{
+				PendingVariantKeys.Add(Key);
+				Compiler.SubmitAsync(this, std::move(Stages),
+					[this, Key, Macros = InMacros](TArray<FShaderStageCompile>& InStages)
+					{
+						OnAsyncVariantCompiled(Key, Macros, InStages);
+					});
+				return Fallback;
+			}
+		}
+		Compiler.CompileSync(Stages);
+	}
 
-	if (bSuccess)
+	FShaderVariant NewShaderVariant;
+	if (CreateVariantFromStages(InDevice, FilePath, InMacros, Stages, NewShaderVariant))
 	{
 		// 4. 맵에 추가하고, 새로 추가된 항목의 포인터(주소)를 반환
-		// TMap::Add()는 추가된 FShaderVariant의 레퍼런스를 포함하는 TPair를 반환합니다.
-		// .Value의 주소를 가져옵니다.
 		ShaderVariantMap.Add(Key, NewShaderVariant);
 		return &ShaderVariantMap[Key];
 	}
 
 	// 5. 컴파일 실패
 	UE_LOG("[error] GetOrCompileShaderVariant: Failed to compile '%s' variant for key '%s'", GetFilePath().c_str(), GenerateMacrosToString(InMacros).c_str());
-
-	// 컴파일에 실패했더라도, 향후 동일한 요청이 왔을 때
-	// 다시 컴파일을 시도하지 않도록 '비어있는' Variant를 맵에 추가할 수 있습니다.
-	// ShaderVariantMap.Add(Key, NewShaderVariant); // (선택적)
-
 	return nullptr;
 }
 
 /**
- * @brief [신규] 실제 컴파일 로직을 수행하는 private 헬퍼 함수입니다.
+ * @brief 실제 컴파일 로직을 수행하는 헬퍼 함수입니다. (디스크 캐시 확인 후 동기 컴파일)
  * @param InDevice D3D 디바이스
  * @param InShaderPath 컴파일할 .hlsl 파일 경로 (ActualFilePath)
  * @param InMacros 컴파일에 사용할 매크로
@@ -200,20 +196,20 @@ FShaderVariant* UShader::GetOrCompileShaderVariant(const TArray<FShaderMacro>& I
  */
 bool UShader::CompileVariantInternal(ID3D11Device* InDevice, const FString& InShaderPath, const TArray<FShaderMacro>& InMacros, FShaderVariant& OutVariant)
 {
-	OutVariant.SourceMacros = InMacros;
-	
-	FWideString WFilePath = UTF8ToWide(InShaderPath);
+	TArray<FShaderStageCompile> Stages;
+	BuildStageCompiles(InShaderPath, InMacros, Stages);
+	FShaderCompileManager::Get().CompileSync(Stages);
+	return CreateVariantFromStages(InDevice, InShaderPath, InMacros, Stages, OutVariant);
+}
 
-	// --- 1. D3D_SHADER_MACRO* 형태로 변환 ---
-	TArray<D3D_SHADER_MACRO> Defines;
-	TArray<TPair<FString, FString>> MacroStrings; // 포인터 유효성 유지를 위한 저장소
-	MacroStrings.reserve(InMacros.Num());
+void UShader::BuildStageCompiles(const FString& InShaderPath, const TArray<FShaderMacro>& InMacros, TArray<FShaderStageCompile>& OutStages)
+{
+	// --- 1. 매크로를 이름 순으로 정렬, 중복 제거 (디스크 캐시 키가 실행마다 같아야 하므로 문자열 기준) ---
+	std::map<FString, FString> SortedDefines;
 	for (const FShaderMacro& Macro : InMacros)
 	{
-		MacroStrings.emplace_back(Macro.Name.ToString(), Macro.Definition.ToString());
-		Defines.push_back({ MacroStrings.back().first.c_str(), MacroStrings.back().second.c_str() });
+		SortedDefines[Macro.Name.ToString()] = Macro.Definition.ToString();
 	}
-	Defines.push_back({ NULL, NULL }); // 배열의 끝을 알리는 NULL 터미네이터
 
 	// --- 2. 컴파일 플래그 설정 ---
 	UINT CompileFlags = 0;
@@ -221,71 +217,194 @@ bool UShader::CompileVariantInternal(ID3D11Device* InDevice, const FString& InSh
 	CompileFlags = D3DCOMPILE_DEBUG | D3DCOMPILE_SKIP_OPTIMIZATION;
 #endif
 
-	auto EndsWith = [](const FString& str, const FString& suffix)
-		{
-			if (str.size() < suffix.size()) return false;
-			return std::equal(suffix.rbegin(), suffix.rend(), str.rbegin(),
-				[](char a, char b) { return static_cast<char>(::tolower(a)) == static_cast<char>(::tolower(b)); });
-		};
-
-	HRESULT Hr;
-	bool bVsCompiled = false;
-	bool bPsCompiled = false;
-	bool bCsCompiled = false;
+	// --- 3. 파일 이름 접미사로 스테이지 결정 ---
+	struct FStageDesc { const char* EntryPoint; const char* Target; };
+	TArray<FStageDesc> StageDescs;
+	if (EndsWithNoCase(InShaderPath, "_VS.hlsl"))
+	{
+		StageDescs.Add({ "mainVS", "vs_5_0" });
+	}
+	else if (EndsWithNoCase(InShaderPath, "_PS.hlsl"))
+	{
+		StageDescs.Add({ "mainPS", "ps_5_0" });
+	}
+	else if (EndsWithNoCase(InShaderPath, "_CS.hlsl"))
+	{
+		StageDescs.Add({ "mainCS", "cs_5_0" });
+	}
+	else // (VS + PS)
+	{
+		StageDescs.Add({ "mainVS", "vs_5_0" });
+		StageDescs.Add({ "mainPS", "ps_5_0" });
+	}
 
-	// --- 3. 컴파일 결과를 OutVariant에 저장 ---
-	if (EndsWith(InShaderPath, "_VS.hlsl"))
+	FShaderBytecodeCache& Cache = FShaderCompileManager::Get().GetCache();
+	OutStages.Reserve(StageDescs.Num());
+	for (const FStageDesc& Desc : StageDescs)
 	{
-		bVsCompiled = CompileShaderInternal(WFilePath, "mainVS", "vs_5_0", CompileFlags, Defines.data(), &OutVariant.VSBlob);
-		if (bVsCompiled)
+		FShaderStageCompile& Stage = OutStages.emplace_back();
+		Stage.Input.SourcePath = InShaderPath;
+		Stage.Input.EntryPoint = Desc.EntryPoint;
+		Stage.Input.Target = Desc.Target;
+		Stage.Input.CompileFlags = CompileFlags;
+		Stage.Input.Defines.Reserve(static_cast<int32>(SortedDefines.size()));
+		for (const auto& Define : SortedDefines)
 		{
-			Hr = InDevice->CreateVertexShader(OutVariant.VSBlob->GetBufferPointer(), OutVariant.VSBlob->GetBufferSize(), nullptr, &OutVariant.VertexShader);
-			assert(SUCCEEDED(Hr));
-			CreateInputLayout(InDevice, InShaderPath, OutVariant); // OutVariant 전달
+			Stage.Input.Defines.emplace_back(Define.first, Define.second);
 		}
+		Stage.CacheKey = Cache.MakeKey(Stage.Input, IncludedFiles);
 	}
-	else if (EndsWith(InShaderPath, "_PS.hlsl"))
+}
+
+bool UShader::CreateVariantFromStages(ID3D11Device* InDevice, const FString& InShaderPath, const TArray<FShaderMacro>& InMacros, const TArray<FShaderStageCompile>& InStages, FShaderVariant& OutVariant)
+{
+	OutVariant.SourceMacros = InMacros;
+
+	bool bAnyCreated = false;
+	for (const FShaderStageCompile& Stage : InStages)
 	{
-		bPsCompiled = CompileShaderInternal(WFilePath, "mainPS", "ps_5_0", CompileFlags, Defines.data(), &OutVariant.PSBlob);
-		if (bPsCompiled)
+		if (!Stage.bSucceeded || Stage.Bytecode.IsEmpty())
 		{
-			Hr = InDevice->CreatePixelShader(OutVariant.PSBlob->GetBufferPointer(), OutVariant.PSBlob->GetBufferSize(), nullptr, &OutVariant.PixelShader);
-			assert(SUCCEEDED(Hr));
+			continue;
 		}
-	}
-	else if (EndsWith(InShaderPath, "_CS.hlsl"))
-	{
-		// Compute Shader 컴파일
-		bCsCompiled = CompileShaderInternal(WFilePath, "mainCS", "cs_5_0", CompileFlags, Defines.data(), &OutVariant.CSBlob);
-		if (bCsCompiled)
+
+		ID3DBlob* Blob = nullptr;
+		if (FAILED(D3DCreateBlob(Stage.Bytecode.size(), &Blob)))
 		{
-			Hr = InDevice->CreateComputeShader(OutVariant.CSBlob->GetBufferPointer(), OutVariant.CSBlob->GetBufferSize(), nullptr, &OutVariant.ComputeShader);
+			continue;
+		}
+		memcpy(Blob->GetBufferPointer(), Stage.Bytecode.GetData(), Stage.Bytecode.size());
+
+		HRESULT Hr;
+		switch (Stage.Input.Target[0])
+		{
+		case 'v':
+			OutVariant.VSBlob = Blob;
+			Hr = InDevice->CreateVertexShader(Blob->GetBufferPointer(), Blob->GetBufferSize(), nullptr, &OutVariant.VertexShader);
+			assert(SUCCEEDED(Hr));
+			CreateInputLayout(InDevice, InShaderPath, OutVariant);
+			break;
+		case 'p':
+			OutVariant.PSBlob = Blob;
+			Hr = InDevice->CreatePixelShader(Blob->GetBufferPointer(), Blob->GetBufferSize(), nullptr, &OutVariant.PixelShader);
 			assert(SUCCEEDED(Hr));
+			break;
+		case 'c':
+			OutVariant.CSBlob = Blob;
+			Hr = InDevice->CreateComputeShader(Blob->GetBufferPointer(), Blob->GetBufferSize(), nullptr, &OutVariant.ComputeShader);
+			assert(SUCCEEDED(Hr));
+			break;
+		default:
+			Blob->Release();
+			continue;
 		}
+		bAnyCreated = true;
 	}
-	else // (VS + PS)
+
+	// VS, PS, CS 중 하나라도 성공 시
+	return bAnyCreated;
+}
+
+// 입력 레이아웃을 바꾸는 매크로가 같은 Variant 중 요청과 겹치는 매크로가 가장 많은 것
+FShaderVariant* UShader::FindFallbackVariant(const TArray<FShaderMacro>& InMacros)
+{
+	FShaderVariant* Best = nullptr;
+	int32 BestScore = -1;
+	for (auto& Pair : ShaderVariantMap)
 	{
-		bVsCompiled = CompileShaderInternal(WFilePath, "mainVS", "vs_5_0", CompileFlags, Defines.data(), &OutVariant.VSBlob);
-		bPsCompiled = CompileShaderInternal(WFilePath, "mainPS", "ps_5_0", CompileFlags, Defines.data(), &OutVariant.PSBlob);
+		FShaderVariant& Variant = Pair.second;
 
-		if (bVsCompiled)
+		bool bLayoutMatches = true;
+		for (const char* MacroName : LayoutAffectingMacros)
 		{
-			Hr = InDevice->CreateVertexShader(OutVariant.VSBlob->GetBufferPointer(), OutVariant.VSBlob->GetBufferSize(), nullptr, &OutVariant.VertexShader);
-			assert(SUCCEEDED(Hr));
-			CreateInputLayout(InDevice, InShaderPath, OutVariant);
+			if (HasMacro(Variant.SourceMacros, MacroName) != HasMacro(InMacros, MacroName))
+			{
+				bLayoutMatches = false;
+				break;
+			}
 		}
-		if (bPsCompiled)
+		if (!bLayoutMatches)
 		{
-			Hr = InDevice->CreatePixelShader(OutVariant.PSBlob->GetBufferPointer(), OutVariant.PSBlob->GetBufferSize(), nullptr, &OutVariant.PixelShader);
-			assert(SUCCEEDED(Hr));
+			continue;
+		}
+
+		int32 Score = 0;
+		for (const FShaderMacro& Macro : InMacros)
+		{
+			if (std::find(Variant.SourceMacros.begin(), Variant.SourceMacros.end(), Macro) != Variant.SourceMacros.end())
+			{
+				++Score;
+			}
+		}
+		if (Score > BestScore)
+		{
+			BestScore = Score;
+			Best = &Variant;
 		}
 	}
+	return Best;
+}
+
+void UShader::OnAsyncVariantCompiled(uint64 Key, const TArray<FShaderMacro>& InMacros, TArray<FShaderStageCompile>& InStages)
+{
+	PendingVariantKeys.Remove(Key);
+	if (ShaderVariantMap.Find(Key))
+	{
+		return;
+	}
 
-	// 4. 핫 리로드용 매크로 저장
-	//OutVariant.SourceMacros = InMacros;
+	FShaderVariant NewShaderVariant;
+	if (!CreateVariantFromStages(GEngine.GetRHIDevice()->GetDevice(), FilePath, InMacros, InStages, NewShaderVariant))
+	{
+		UE_LOG("[error] Background compile failed: '%s' variant '%s' (fallback variant stays in use)", GetFilePath().c_str(), GenerateMacrosToString(InMacros).c_str());
+		FailedVariantKeys.Add(Key);
+		return;
+	}
+
+	ShaderVariantMap.Add(Key, NewShaderVariant);
 
-	// 5. 컴파일 성공 여부 반환 (VS, PS, CS 중 하나라도 성공 시)
-	return bVsCompiled || bPsCompiled || bCsCompiled;
+	// 대체 Variant 포인터를 캐시한 드로우 커맨드가 다시 만들어지도록
+	++VariantGeneration;
+}
+
+int32 UShader::PrecompileVariants(const TArray<TArray<FShaderMacro>>& InMacroSets)
+{
+	if (FilePath.empty())
+	{
+		return 0;
+	}
+
+	FShaderCompileManager& Compiler = FShaderCompileManager::Get();
+	TSet<uint64> SubmittedKeys;
+	int32 NumSubmitted = 0;
+	for (const TArray<FShaderMacro>& Macros : InMacroSets)
+	{
+		const uint64 Key = GenerateShaderKey(Macros);
+		if (ShaderVariantMap.Find(Key) || PendingVariantKeys.Contains(Key) || SubmittedKeys.Contains(Key))
+		{
+			continue;
+		}
+		SubmittedKeys.Add(Key);
+
+		TArray<FShaderStageCompile> Stages;
+		BuildStageCompiles(FilePath, Macros, Stages);
+		if (Compiler.IsCached(Stages))
+		{
+			continue;
+		}
+
+		// Owner 없이 제출 -> 결과는 디스크 캐시에만 남는다
+		if (Compiler.IsAsyncCompileEnabled())
+		{
+			Compiler.SubmitAsync(nullptr, std::move(Stages), nullptr);
+		}
+		else
+		{
+			Compiler.CompileSync(Stages);
+		}
+		++NumSubmitted;
+	}
+	return NumSubmitted;
 }
 
 //FShaderVariant* UShader::GetShaderVariant(const TArray<FShaderMacro>& InMacros)
@@ -343,6 +462,11 @@ void UShader::CreateInputLayout(ID3D11Device* Device, const FString& InShaderPat
 		descArray.Add({"BLENDINDICES", 0, DXGI_FORMAT_R32G32B32A32_UINT, 0, D3D11_APPEND_ALIGNED_ELEMENT, D3D11_INPUT_PER_VERTEX_DATA, 0});
 		descArray.Add({"BLENDWEIGHT", 0, DXGI_FORMAT_R32G32B32A32_FLOAT, 0, D3D11_APPEND_ALIGNED_ELEMENT, D3D11_INPUT_PER_VERTEX_DATA, 0});
 	}
+
+	if (HasMacro(InOutVariant.SourceMacros, "USE_INSTANCING"))
+	{
+		FMeshInstancingBuilder::AppendInstanceInputLayout(descArray);
+	}
 	
 	const D3D11_INPUT_ELEMENT_DESC* layout = descArray.data();
 	uint32 layoutCount = static_cast<uint32>(descArray.size());
@@ -443,9 +567,15 @@ bool UShader::Reload(ID3D11Device* InDevice)
 
 	UE_LOG("Hot Reloading Shader File: %s (%d variants)", FilePath.c_str(), ShaderVariantMap.Num());
 
+	// 이전 소스로 진행 중인 백그라운드 컴파일 결과는 버린다
+	FShaderCompileManager::Get().CancelJobs(this);
+	PendingVariantKeys.Empty();
+	FailedVariantKeys.Empty();
+
 	// 2. [백업] 현재 맵을 Old 맵으로 이동시킵니다.
 	// (ShaderVariantMap은 이제 비어있습니다)
 	TMap<uint64, FShaderVariant> OldShaderVariantMap = std::move(ShaderVariantMap);
+	++VariantGeneration;
 
 	bool bAllReloadsSuccessful = true;
 
@@ -543,6 +673,7 @@ void UShader::ParseIncludeFiles(const FString& ShaderPath)
 {
 	// 이미 파싱된 파일 목록 초기화
 	IncludedFiles.clear();
+	bSupportsInstancing = false;
 
 	// 파싱할 파일 큐
 	TArray<FString> FilesToParse;
@@ -591,6 +722,11 @@ void UShader::ParseIncludeFiles(const FString& ShaderPath)
 			}
 			Line = Line.substr(FirstNonSpace);
 
+			if (CurrentFile == ShaderPath && Line.find("USE_INSTANCING") != FString::npos)
+			{
+				bSupportsInstancing = true;
+			}
+
 			// #include 지시문 찾기
 			if (Line.compare(0, 8, "#include") == 0)
 			{
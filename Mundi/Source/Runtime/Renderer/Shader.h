@@ -2,6 +2,8 @@
 #include "ResourceBase.h"
 #include <filesystem>
 
+struct FShaderStageCompile;
+
 struct FShaderMacro
 {
 	FName Name;
@@ -51,7 +53,9 @@ public:
 
 	bool Load(const FString& ShaderPath, ID3D11Device* InDevice, const TArray<FShaderMacro>& InMacros = TArray<FShaderMacro>());
 
-	FShaderVariant* GetOrCompileShaderVariant(const TArray<FShaderMacro>& InMacros = TArray<FShaderMacro>());
+	// 디스크 캐시에 없으면 백그라운드로 컴파일하고, 준비될 때까지 입력 레이아웃이 같은 다른 Variant를 대신 반환한다
+	// (대신할 Variant가 없거나 bAllowAsync가 false면 동기 컴파일)
+	FShaderVariant* GetOrCompileShaderVariant(const TArray<FShaderMacro>& InMacros = TArray<FShaderMacro>(), bool bAllowAsync = true);
 	bool CompileVariantInternal(ID3D11Device* InDevice, const FString& InShaderPath, const TArray<FShaderMacro>& InMacros, FShaderVariant& OutVariant);
 	//FShaderVariant* GetShaderVariant(const TArray<FShaderMacro>& InMacros = TArray<FShaderMacro>());
 	ID3D11InputLayout* GetInputLayout(const TArray<FShaderMacro>& InMacros = TArray<FShaderMacro>());
@@ -65,21 +69,43 @@ public:
 	//const TArray<FShaderMacro>& GetMacros() const { return Macros; }
 
 	static bool HasMacro(const TArray<FShaderMacro>& InMacros, const FString& InMacroName);
+
+	// 디스크 캐시에 없는 매크로 조합만 백그라운드로 컴파일해 캐시를 채운다 (Variant는 만들지 않음), 제출한 개수 반환
+	int32 PrecompileVariants(const TArray<TArray<FShaderMacro>>& InMacroSets);
+	bool HasPendingVariants() const { return !PendingVariantKeys.IsEmpty(); }
+
+	// 소스에 USE_INSTANCING 분기가 있는 셰이더만 자동 인스턴싱 변형을 만든다
+	bool SupportsInstancing() const { return bSupportsInstancing; }
+
+	// 핫 리로드로 Variant가 교체될 때마다 증가 (FShaderVariant의 셰이더 포인터를 캐시한 쪽의 무효화 기준)
+	static uint32 GetVariantGeneration() { return VariantGeneration; }
 	
 protected:
 	virtual ~UShader();
 
 private:
 	TMap<uint64, FShaderVariant> ShaderVariantMap;
+	inline static uint32 VariantGeneration = 0;
 
 	// Store included files (e.g., "Shaders/Common/LightingCommon.hlsl")
 	// Used for hot reload - if any included file changes, reload this shader
 	TArray<FString> IncludedFiles;
 	TMap<FString, std::filesystem::file_time_type> IncludedFileTimestamps;
 
+	bool bSupportsInstancing = false;	// ParseIncludeFiles에서 메인 파일을 읽을 때 갱신
+
 	void CreateInputLayout(ID3D11Device* Device, const FString& InShaderPath, FShaderVariant& InOutVariant);
 	void ReleaseResources();
 
+	// 스테이지별 컴파일 입력과 디스크 캐시 키 생성
+	void BuildStageCompiles(const FString& InShaderPath, const TArray<FShaderMacro>& InMacros, TArray<FShaderStageCompile>& OutStages);
+	bool CreateVariantFromStages(ID3D11Device* InDevice, const FString& InShaderPath, const TArray<FShaderMacro>& InMacros, const TArray<FShaderStageCompile>& InStages, FShaderVariant& OutVariant);
+	FShaderVariant* FindFallbackVariant(const TArray<FShaderMacro>& InMacros);
+	void OnAsyncVariantCompiled(uint64 Key, const TArray<FShaderMacro>& InMacros, TArray<FShaderStageCompile>& InStages);
+
+	TSet<uint64> PendingVariantKeys;	// 백그라운드 컴파일 중
+	TSet<uint64> FailedVariantKeys;		// 백그라운드 컴파일 실패 (핫 리로드 전까지 다시 제출하지 않음)
+
 	// Include 파일 파싱 및 추적
 	void ParseIncludeFiles(const FString& ShaderPath);
 	void UpdateIncludeTimestamps();
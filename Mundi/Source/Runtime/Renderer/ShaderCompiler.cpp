@@ -0,0 +1,519 @@
+﻿#include "pch.h"
+#include "ShaderCompiler.h"
+#include "PlatformTime.h"
+#include "Source/Runtime/Core/Misc/WindowsBinReader.h"
+#include "Source/Runtime/Core/Misc/WindowsBinWriter.h"
+
+namespace
+{
+	constexpr uint32 ShaderCacheMagic = 0x4353484D; // "MHSC"
+	constexpr uint64 FNVPrime = 0x100000001b3ull;
+
+	inline uint64 HashString(const FString& Str, uint64 Seed)
+	{
+		// 길이를 먼저 섞어 "ab"+"c"와 "a"+"bc"가 같은 해시가 되지 않게 한다
+		const uint64 Length = Str.size();
+		Seed = FShaderBytecodeCache::HashBytes(&Length, sizeof(Length), Seed);
+		return FShaderBytecodeCache::HashBytes(Str.data(), Str.size(), Seed);
+	}
+}
+
+// ======================== FD3DShaderCompileBackend ============================
+
+bool FD3DShaderCompileBackend::Compile(const FShaderCompileInput& Input, FShaderCompileOutput& Output)
+{
+	TArray<D3D_SHADER_MACRO> Defines;
+	Defines.Reserve(Input.Defines.Num() + 1);
+	for (const TPair<FString, FString>& Define : Input.Defines)
+	{
+		Defines.push_back({ Define.first.c_str(), Define.second.c_str() });
+	}
+	Defines.push_back({ NULL, NULL });
+
+	const FWideString WFilePath = UTF8ToWide(Input.SourcePath);
+	ID3DBlob* CodeBlob = nullptr;
+	ID3DBlob* ErrorBlob = nullptr;
+	const HRESULT Hr = D3DCompileFromFile(
+		WFilePath.c_str(),
+		Defines.data(),
+		D3D_COMPILE_STANDARD_FILE_INCLUDE,
+		Input.EntryPoint.c_str(),
+		Input.Target.c_str(),
+		Input.CompileFlags,
+		0,
+		&CodeBlob,
+		&ErrorBlob);
+
+	if (ErrorBlob)
+	{
+		Output.Errors.assign(static_cast<const char*>(ErrorBlob->GetBufferPointer()), ErrorBlob->GetBufferSize());
+		ErrorBlob->Release();
+	}
+
+	if (FAILED(Hr) || !CodeBlob)
+	{
+		if (CodeBlob) { CodeBlob->Release(); }
+		return false;
+	}
+
+	const uint8* Code = static_cast<const uint8*>(CodeBlob->GetBufferPointer());
+	Output.Bytecode.assign(Code, Code + CodeBlob->GetBufferSize());
+	CodeBlob->Release();
+	return true;
+}
+
+// ======================== FShaderBytecodeCache ============================
+
+FShaderBytecodeCache::FShaderBytecodeCache(const FString& InCacheDir)
+	: CacheDir(InCacheDir)
+{
+	std::error_code Error;
+	std::filesystem::create_directories(CacheDir, Error);
+}
+
+uint64 FShaderBytecodeCache::HashBytes(const void* Data, size_t Size, uint64 Seed)
+{
+	// FNV-1a 64 (실행마다 같은 값이어야 하므로 FName 인덱스 기반 해시는 쓰지 않는다)
+	const uint8* Bytes = static_cast<const uint8*>(Data);
+	uint64 Hash = Seed;
+	for (size_t i = 0; i < Size; ++i)
+	{
+		Hash ^= Bytes[i];
+		Hash *= FNVPrime;
+	}
+	return Hash;
+}
+
+uint64 FShaderBytecodeCache::GetFileHash(const FString& FilePath)
+{
+	std::error_code Error;
+	const auto WriteTime = std::filesystem::last_write_time(FilePath, Error);
+	if (Error)
+	{
+		return 0;
+	}
+
+	if (const FFileHashEntry* Found = FileHashes.Find(FilePath))
+	{
+		if (Found->WriteTime == WriteTime)
+		{
+			return Found->Hash;
+		}
+	}
+
+	std::ifstream File(FilePath, std::ios::binary);
+	if (!File.is_open())
+	{
+		return 0;
+	}
+	const FString Contents((std::istreambuf_iterator<char>(File)), std::istreambuf_iterator<char>());
+
+	FFileHashEntry Entry;
+	Entry.WriteTime = WriteTime;
+	Entry.Hash = HashBytes(Contents.data(), Contents.size());
+	FileHashes[FilePath] = Entry;
+	return Entry.Hash;
+}
+
+uint64 FShaderBytecodeCache::MakeKey(const FShaderCompileInput& Input, const TArray<FString>& IncludeFiles)
+{
+	uint64 Key = HashBytes(&CacheVersion, sizeof(CacheVersion));
+
+	const uint64 SourceHash = GetFileHash(Input.SourcePath);
+	Key = HashBytes(&SourceHash, sizeof(SourceHash), Key);
+
+	// Include 순서는 파싱 순서에 따라 달라질 수 있으므로 정렬
+	TArray<FString> SortedIncludes = IncludeFiles;
+	std::sort(SortedIncludes.begin(), SortedIncludes.end());
+	for (const FString& IncludeFile : SortedIncludes)
+	{
+		const uint64 IncludeHash = GetFileHash(IncludeFile);
+		Key = HashString(IncludeFile, Key);
+		Key = HashBytes(&IncludeHash, sizeof(IncludeHash), Key);
+	}
+
+	Key = HashString(Input.EntryPoint, Key);
+	Key = HashString(Input.Target, Key);
+	Key = HashBytes(&Input.CompileFlags, sizeof(Input.CompileFlags), Key);
+	for (const TPair<FString, FString>& Define : Input.Defines)
+	{
+		Key = HashString(Define.first, Key);
+		Key = HashString(Define.second, Key);
+	}
+	return Key;
+}
+
+FString FShaderBytecodeCache::GetCacheFilePath(uint64 Key, const FShaderCompileInput& Input) const
+{
+	char KeyString[17];
+	sprintf_s(KeyString, sizeof(KeyString), "%016llx", static_cast<unsigned long long>(Key));
+	const FString Stem = std::filesystem::path(Input.SourcePath).stem().string();
+	return CacheDir + "/" + Stem + "_" + Input.EntryPoint + "_" + KeyString + ".cso";
+}
+
+bool FShaderBytecodeCache::Contains(uint64 Key, const FShaderCompileInput& Input) const
+{
+	std::error_code Error;
+	return std::filesystem::exists(GetCacheFilePath(Key, Input), Error);
+}
+
+bool FShaderBytecodeCache::Load(uint64 Key, const FShaderCompileInput& Input, TArray<uint8>& OutBytecode) const
+{
+	const FString CachePath = GetCacheFilePath(Key, Input);
+	std::error_code Error;
+	if (!std::filesystem::exists(CachePath, Error))
+	{
+		return false;
+	}
+
+	try
+	{
+		FWindowsBinReader Reader(CachePath);
+		if (!Reader.IsOpen())
+		{
+			return false;
+		}
+
+		uint32 Magic = 0;
+		uint32 Version = 0;
+		uint64 StoredKey = 0;
+		Reader << Magic;
+		Reader << Version;
+		Reader << StoredKey;
+		if (Magic != ShaderCacheMagic || Version != CacheVersion || StoredKey != Key)
+		{
+			return false;
+		}
+
+		Serialization::ReadArray(Reader, OutBytecode);
+		Reader.Close();
+		return !OutBytecode.IsEmpty();
+	}
+	catch (const std::exception&)
+	{
+		// 손상된 캐시는 다시 컴파일해서 덮어쓴다 (워커에서도 불리므로 로그는 남기지 않음)
+		return false;
+	}
+}
+
+void FShaderBytecodeCache::Store(uint64 Key, const FShaderCompileInput& Input, const TArray<uint8>& Bytecode) const
+{
+	const FString CachePath = GetCacheFilePath(Key, Input);
+
+	// 같은 키를 여러 워커가 동시에 쓸 수 있으므로 스레드별 임시 파일에 쓰고 교체한다
+	const size_t ThreadHash = std::hash<std::thread::id>()(std::this_thread::get_id());
+	const FString TempPath = CachePath + "." + std::to_string(ThreadHash) + ".tmp";
+	{
+		FWindowsBinWriter Writer(TempPath);
+		uint32 Magic = ShaderCacheMagic;
+		uint32 Version = CacheVersion;
+		uint64 StoredKey = Key;
+		Writer << Magic;
+		Writer << Version;
+		Writer << StoredKey;
+		Serialization::WriteArray(Writer, Bytecode);
+		Writer.Close();
+	}
+
+	std::error_code Error;
+	std::filesystem::rename(TempPath, CachePath, Error);
+	if (Error)
+	{
+		std::filesystem::remove(TempPath, Error);
+	}
+}
+
+// ======================== FShaderCompileManager ============================
+
+FShaderCompileManager& FShaderCompileManager::Get()
+{
+	static FD3DShaderCompileBackend D3DBackend;
+	const int32 NumWorkers = std::clamp(static_cast<int32>(std::thread::hardware_concurrency()) / 2, 1, 4);
+	static FShaderCompileManager Instance(&D3DBackend, GCacheDir + "/Shaders", NumWorkers);
+	return Instance;
+}
+
+FShaderCompileManager::FShaderCompileManager(IShaderCompileBackend* InBackend, const FString& InCacheDir, int32 InNumWorkers)
+	: Backend(InBackend)
+	, Cache(InCacheDir)
+{
+	for (int32 i = 0; i < InNumWorkers; ++i)
+	{
+		Workers.emplace_back(&FShaderCompileManager::WorkerLoop, this);
+	}
+}
+
+FShaderCompileManager::~FShaderCompileManager()
+{
+	Shutdown();
+}
+
+void FShaderCompileManager::Shutdown()
+{
+	{
+		std::lock_guard<std::mutex> Lock(QueueMutex);
+		if (bStopping)
+		{
+			return;
+		}
+		bStopping = true;
+
+		// 아직 시작하지 않은 작업은 버리고, 실행 중인 작업만 끝낸다
+		NumPendingJobs -= static_cast<int32>(PendingQueue.size());
+		PendingQueue.clear();
+	}
+	QueueCondition.notify_all();
+
+	for (std::thread& Worker : Workers)
+	{
+		if (Worker.joinable())
+		{
+			Worker.join();
+		}
+	}
+	Workers.clear();
+
+	std::lock_guard<std::mutex> Lock(QueueMutex);
+	NumPendingJobs -= FinishedJobs.Num();
+	FinishedJobs.Empty();
+}
+
+bool FShaderCompileManager::IsCached(const TArray<FShaderStageCompile>& Stages) const
+{
+	for (const FShaderStageCompile& Stage : Stages)
+	{
+		if (!Cache.Contains(Stage.CacheKey, Stage.Input))
+		{
+			return false;
+		}
+	}
+	return !Stages.IsEmpty();
+}
+
+bool FShaderCompileManager::LoadFromCache(TArray<FShaderStageCompile>& Stages)
+{
+	for (FShaderStageCompile& Stage : Stages)
+	{
+		if (!Stage.bSucceeded)
+		{
+			Stage.bSucceeded = Stage.bFromCache = Cache.Load(Stage.CacheKey, Stage.Input, Stage.Bytecode);
+		}
+		if (!Stage.bSucceeded)
+		{
+			return false;
+		}
+	}
+
+	std::lock_guard<std::mutex> Lock(StatsMutex);
+	Stats.NumCacheHits += Stages.Num();
+	return !Stages.IsEmpty();
+}
+
+bool FShaderCompileManager::CompileSync(TArray<FShaderStageCompile>& Stages)
+{
+	bool bAllSucceeded = true;
+	for (FShaderStageCompile& Stage : Stages)
+	{
+		if (!Stage.bSucceeded)
+		{
+			CompileStage(Stage);
+		}
+		bAllSucceeded &= Stage.bSucceeded;
+	}
+	LogFailedStages(Stages);
+	return bAllSucceeded;
+}
+
+void FShaderCompileManager::CompileStage(FShaderStageCompile& Stage)
+{
+	if (Cache.Load(Stage.CacheKey, Stage.Input, Stage.Bytecode))
+	{
+		Stage.bSucceeded = Stage.bFromCache = true;
+		std::lock_guard<std::mutex> Lock(StatsMutex);
+		++Stats.NumCacheHits;
+		return;
+	}
+
+	const uint64 StartCycles = FPlatformTime::Cycles64();
+	FShaderCompileOutput Output;
+	Stage.bSucceeded = Backend && Backend->Compile(Stage.Input, Output);
+	const double ElapsedMs = FPlatformTime::ToMilliseconds(FPlatformTime::Cycles64() - StartCycles);
+
+	if (Stage.bSucceeded)
+	{
+		Stage.Bytecode = std::move(Output.Bytecode);
+		Cache.Store(Stage.CacheKey, Stage.Input, Stage.Bytecode);
+	}
+	else
+	{
+		Stage.Errors = std::move(Output.Errors);
+	}
+
+	std::lock_guard<std::mutex> Lock(StatsMutex);
+	Stats.CompileMs += ElapsedMs;
+	if (Stage.bSucceeded)
+	{
+		++Stats.NumCompiled;
+	}
+	else
+	{
+		++Stats.NumFailed;
+	}
+}
+
+void FShaderCompileManager::LogFailedStages(const TArray<FShaderStageCompile>& Stages)
+{
+	for (const FShaderStageCompile& Stage : Stages)
+	{
+		if (!Stage.bSucceeded)
+		{
+			UE_LOG("[error] Shader '%s' (%s) compile error: %s", Stage.Input.SourcePath.c_str(), Stage.Input.EntryPoint.c_str(), Stage.Errors.c_str());
+		}
+	}
+}
+
+void FShaderCompileManager::SubmitAsync(const void* Owner, TArray<FShaderStageCompile>&& Stages, FFinishedCallback&& OnFinished)
+{
+	auto Job = std::make_unique<FJob>();
+	Job->Owner = Owner;
+	Job->Stages = std::move(Stages);
+	Job->OnFinished = std::move(OnFinished);
+
+	{
+		std::lock_guard<std::mutex> Lock(QueueMutex);
+		if (bStopping)
+		{
+			return;
+		}
+		PendingQueue.push_back(std::move(Job));
+		++NumPendingJobs;
+	}
+	{
+		std::lock_guard<std::mutex> Lock(StatsMutex);
+		++Stats.NumAsyncSubmitted;
+	}
+	QueueCondition.notify_one();
+}
+
+void FShaderCompileManager::WorkerLoop()
+{
+	FCPUProfiler::SetCurrentThreadName("ShaderCompile Worker");
+
+	while (true)
+	{
+		std::unique_ptr<FJob> Job;
+		{
+			std::unique_lock<std::mutex> Lock(QueueMutex);
+			QueueCondition.wait(Lock, [this]() { return bStopping || !PendingQueue.empty(); });
+			if (PendingQueue.empty())
+			{
+				return; // bStopping
+			}
+			Job = std::move(PendingQueue.front());
+			PendingQueue.pop_front();
+			RunningJobs.Add(Job.get());
+		}
+
+		for (FShaderStageCompile& Stage : Job->Stages)
+		{
+			if (!Stage.bSucceeded)
+			{
+				CompileStage(Stage);
+			}
+		}
+
+		{
+			std::lock_guard<std::mutex> Lock(QueueMutex);
+			RunningJobs.erase(std::find(RunningJobs.begin(), RunningJobs.end(), Job.get()));
+			FinishedJobs.Add(std::move(Job));
+		}
+		IdleCondition.notify_all();
+	}
+}
+
+void FShaderCompileManager::ProcessFinishedJobs()
+{
+	TArray<std::unique_ptr<FJob>> Finished;
+	{
+		std::lock_guard<std::mutex> Lock(QueueMutex);
+		if (FinishedJobs.IsEmpty())
+		{
+			return;
+		}
+		Finished = std::move(FinishedJobs);
+		FinishedJobs.Empty();
+	}
+
+	for (std::unique_ptr<FJob>& Job : Finished)
+	{
+		LogFailedStages(Job->Stages);
+		if (Job->Owner && Job->OnFinished)
+		{
+			Job->OnFinished(Job->Stages);
+		}
+		--NumPendingJobs;
+	}
+
+	std::lock_guard<std::mutex> Lock(StatsMutex);
+	Stats.NumAsyncFinished += Finished.Num();
+}
+
+void FShaderCompileManager::CancelJobs(const void* Owner)
+{
+	if (!Owner)
+	{
+		return;
+	}
+
+	std::lock_guard<std::mutex> Lock(QueueMutex);
+	for (auto It = PendingQueue.begin(); It != PendingQueue.end();)
+	{
+		if ((*It)->Owner == Owner)
+		{
+			It = PendingQueue.erase(It);
+			--NumPendingJobs;
+		}
+		else
+		{
+			++It;
+		}
+	}
+
+	// 실행 중/완료 대기 작업은 결과를 캐시에만 남기고 콜백은 버린다
+	for (FJob* Job : RunningJobs)
+	{
+		if (Job->Owner == Owner)
+		{
+			Job->Owner = nullptr;
+		}
+	}
+	for (std::unique_ptr<FJob>& Job : FinishedJobs)
+	{
+		if (Job->Owner == Owner)
+		{
+			Job->Owner = nullptr;
+		}
+	}
+}
+
+void FShaderCompileManager::WaitForAll()
+{
+	if (!Workers.empty())
+	{
+		std::unique_lock<std::mutex> Lock(QueueMutex);
+		IdleCondition.wait(Lock, [this]() { return PendingQueue.empty() && RunningJobs.IsEmpty(); });
+	}
+	ProcessFinishedJobs();
+}
+
+FShaderCompileStats FShaderCompileManager::GetStats() const
+{
+	std::lock_guard<std::mutex> Lock(StatsMutex);
+	return Stats;
+}
+
+void FShaderCompileManager::ResetStats()
+{
+	std::lock_guard<std::mutex> Lock(StatsMutex);
+	Stats = FShaderCompileStats();
+}
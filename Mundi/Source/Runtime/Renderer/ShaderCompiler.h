@@ -0,0 +1,175 @@
+﻿#pragma once
+#include <atomic>
+#include <condition_variable>
+#include <deque>
+#include <functional>
+#include <mutex>
+#include <thread>
+
+// 셰이더 스테이지 하나의 컴파일 입력 (Defines는 이름 순으로 정렬, 중복 제거된 상태)
+struct FShaderCompileInput
+{
+	FString SourcePath;
+	FString EntryPoint;		// "mainVS"
+	FString Target;			// "vs_5_0"
+	uint32 CompileFlags = 0;
+	TArray<TPair<FString, FString>> Defines;
+};
+
+struct FShaderCompileOutput
+{
+	TArray<uint8> Bytecode;
+	FString Errors;
+};
+
+/**
+ * 컴파일러 백엔드 (기본은 D3DCompileFromFile)
+ * - 워커 스레드에서 동시에 호출되므로 상태를 갖지 않아야 한다
+ * - 캐시/스케줄러 검증 시 스텁 백엔드로 교체할 수 있다
+ */
+class IShaderCompileBackend
+{
+public:
+	virtual ~IShaderCompileBackend() = default;
+	virtual bool Compile(const FShaderCompileInput& Input, FShaderCompileOutput& Output) = 0;
+};
+
+class FD3DShaderCompileBackend : public IShaderCompileBackend
+{
+public:
+	bool Compile(const FShaderCompileInput& Input, FShaderCompileOutput& Output) override;
+};
+
+// 컴파일 작업의 스테이지 하나 (입력 + 디스크 캐시 키 + 결과)
+struct FShaderStageCompile
+{
+	FShaderCompileInput Input;
+	uint64 CacheKey = 0;
+	TArray<uint8> Bytecode;
+	FString Errors;			// 실패 시 컴파일러 메시지 (로그는 메인 스레드에서 출력)
+	bool bSucceeded = false;
+	bool bFromCache = false;
+};
+
+/**
+ * 디스크 바이트코드 캐시 (GCacheDir/Shaders)
+ * - 키: 소스 내용 해시 + Include 파일 내용 해시 + 정렬된 매크로 + 엔트리/타겟/플래그
+ * - 파일 해시는 타임스탬프가 같으면 다시 읽지 않는다 (MakeKey/GetFileHash는 메인 스레드 전용)
+ * - Load/Store/Contains는 워커에서도 호출된다 (임시 파일에 쓰고 이름을 바꿔 반쯤 쓰인 파일을 읽지 않게 함)
+ */
+class FShaderBytecodeCache
+{
+public:
+	static constexpr uint32 CacheVersion = 1;
+
+	explicit FShaderBytecodeCache(const FString& InCacheDir);
+
+	uint64 MakeKey(const FShaderCompileInput& Input, const TArray<FString>& IncludeFiles);
+	uint64 GetFileHash(const FString& FilePath);
+
+	bool Contains(uint64 Key, const FShaderCompileInput& Input) const;
+	bool Load(uint64 Key, const FShaderCompileInput& Input, TArray<uint8>& OutBytecode) const;
+	void Store(uint64 Key, const FShaderCompileInput& Input, const TArray<uint8>& Bytecode) const;
+
+	const FString& GetCacheDir() const { return CacheDir; }
+
+	static uint64 HashBytes(const void* Data, size_t Size, uint64 Seed = 0xcbf29ce484222325ull);
+
+private:
+	FString GetCacheFilePath(uint64 Key, const FShaderCompileInput& Input) const;
+
+	struct FFileHashEntry
+	{
+		std::filesystem::file_time_type WriteTime;
+		uint64 Hash = 0;
+	};
+
+	FString CacheDir;
+	TMap<FString, FFileHashEntry> FileHashes;
+};
+
+struct FShaderCompileStats
+{
+	uint32 NumCacheHits = 0;
+	uint32 NumCompiled = 0;
+	uint32 NumFailed = 0;
+	uint32 NumAsyncSubmitted = 0;
+	uint32 NumAsyncFinished = 0;
+	double CompileMs = 0.0;			// 백엔드 컴파일 누적 (워커 포함)
+};
+
+/**
+ * 셰이더 컴파일 매니저
+ * - 캐시 조회와 동기 컴파일 (CompileSync)
+ * - 백그라운드 워커 풀 컴파일 (SubmitAsync), 완료 콜백은 ProcessFinishedJobs에서 메인 스레드로 전달
+ * - Owner 단위 취소 (셰이더 파괴/핫 리로드)
+ * - 엔진은 Get()을 쓰고, 검증용으로 스텁 백엔드와 별도 캐시 폴더를 가진 인스턴스를 따로 만들 수 있다
+ */
+class FShaderCompileManager
+{
+public:
+	using FFinishedCallback = std::function<void(TArray<FShaderStageCompile>& Stages)>;
+
+	static FShaderCompileManager& Get();
+
+	FShaderCompileManager(IShaderCompileBackend* InBackend, const FString& InCacheDir, int32 InNumWorkers);
+	~FShaderCompileManager();
+	FShaderCompileManager(const FShaderCompileManager&) = delete;
+	FShaderCompileManager& operator=(const FShaderCompileManager&) = delete;
+
+	FShaderBytecodeCache& GetCache() { return Cache; }
+
+	// 모든 스테이지가 디스크 캐시에 있으면 채우고 true
+	bool LoadFromCache(TArray<FShaderStageCompile>& Stages);
+	bool IsCached(const TArray<FShaderStageCompile>& Stages) const;
+
+	// 캐시에 없는 스테이지만 컴파일하고 캐시에 저장, 모든 스테이지가 성공하면 true
+	bool CompileSync(TArray<FShaderStageCompile>& Stages);
+
+	// 백그라운드 컴파일, OnFinished는 ProcessFinishedJobs(메인 스레드)에서 호출된다
+	void SubmitAsync(const void* Owner, TArray<FShaderStageCompile>&& Stages, FFinishedCallback&& OnFinished);
+	void ProcessFinishedJobs();
+	void CancelJobs(const void* Owner);
+	void WaitForAll();
+
+	int32 GetNumPendingJobs() const { return NumPendingJobs.load(); }
+	int32 GetNumWorkers() const { return static_cast<int32>(Workers.size()); }
+
+	void SetAsyncCompileEnabled(bool bEnabled) { bAsyncCompileEnabled = bEnabled; }
+	bool IsAsyncCompileEnabled() const { return bAsyncCompileEnabled && !Workers.empty(); }
+
+	FShaderCompileStats GetStats() const;
+	void ResetStats();
+
+	void Shutdown();
+
+private:
+	struct FJob
+	{
+		const void* Owner = nullptr;		// nullptr이면 취소됨 (결과는 캐시에만 남는다)
+		TArray<FShaderStageCompile> Stages;
+		FFinishedCallback OnFinished;
+	};
+
+	void WorkerLoop();
+	void CompileStage(FShaderStageCompile& Stage);
+	static void LogFailedStages(const TArray<FShaderStageCompile>& Stages);
+
+private:
+	IShaderCompileBackend* Backend = nullptr;
+	FShaderBytecodeCache Cache;
+	bool bAsyncCompileEnabled = true;
+
+	std::vector<std::thread> Workers;
+	mutable std::mutex QueueMutex;
+	std::condition_variable QueueCondition;
+	std::condition_variable IdleCondition;
+	std::deque<std::unique_ptr<FJob>> PendingQueue;		// QueueMutex
+	TArray<FJob*> RunningJobs;							// QueueMutex (취소 표시용)
+	TArray<std::unique_ptr<FJob>> FinishedJobs;			// QueueMutex
+	std::atomic<int32> NumPendingJobs{ 0 };				// 큐 + 실행 중 + 완료 대기
+	bool bStopping = false;
+
+	mutable std::mutex StatsMutex;
+	FShaderCompileStats Stats;
+};
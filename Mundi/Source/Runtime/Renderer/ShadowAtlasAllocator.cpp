@@ -0,0 +1,436 @@
+﻿#include "pch.h"
+#include "ShadowAtlasAllocator.h"
+#include "LightManager.h"
+#include <algorithm>
+
+void FShadowAtlasAllocator::Initialize(uint32 InAtlasSize, uint32 InMinTileSize)
+{
+	AtlasSize = InAtlasSize;
+	MinTileSize = FMath::Max(1u, InMinTileSize);
+	Reset();
+}
+
+void FShadowAtlasAllocator::Reset()
+{
+	Allocations.Empty();
+	ResetFreeRects();
+}
+
+void FShadowAtlasAllocator::ResetFreeRects()
+{
+	FreeRects.Empty();
+	if (AtlasSize > 0)
+	{
+		FreeRects.Add({ 0, 0, AtlasSize, AtlasSize });
+	}
+}
+
+uint32 FShadowAtlasAllocator::GetTierSize(uint32 RequestedSize, uint32 Tier) const
+{
+	if (RequestedSize == 0 || AtlasSize == 0)
+	{
+		return 0;
+	}
+
+	// 티어마다 절반, 단 처음부터 MinTileSize보다 작은 요청은 그 크기 아래로 내리지 않는다
+	const uint32 Clamped = FMath::Min(RequestedSize, AtlasSize);
+	const uint32 Floor = FMath::Min(MinTileSize, Clamped);
+	const uint32 Shifted = Tier < 32 ? (Clamped >> Tier) : 0;
+	return FMath::Max(Shifted, Floor);
+}
+
+void FShadowAtlasAllocator::Allocate(TArray<FShadowRenderRequest>& InOutRequests, const TArray<float>& InImportance)
+{
+	LastFrameStats = FrameStats;
+	FrameStats = FShadowAtlasFrameStats();
+
+	const int32 Num = InOutRequests.Num();
+	if (AtlasSize == 0)
+	{
+		for (FShadowRenderRequest& Request : InOutRequests)
+		{
+			Request.Size = 0;
+		}
+		FrameStats.NumDropped = Num;
+		return;
+	}
+
+	// 1. 중요도 내림차순 (같으면 요청 순서 유지: CSM은 가까운 캐스케이드가 먼저)
+	Order.SetNum(Num);
+	for (int32 i = 0; i < Num; ++i)
+	{
+		Order[i] = i;
+	}
+	std::stable_sort(Order.begin(), Order.end(), [&InImportance](uint32 A, uint32 B)
+	{
+		const float ImportanceA = A < (uint32)InImportance.Num() ? InImportance[A] : 0.0f;
+		const float ImportanceB = B < (uint32)InImportance.Num() ? InImportance[B] : 0.0f;
+		return ImportanceA > ImportanceB;
+	});
+
+	// 2. 총면적이 아틀라스를 넘으면 덜 중요한 요청부터 한 티어씩 내린다
+	Tiers.SetNum(Num);
+	uint64 TotalArea = 0;
+	for (int32 i = 0; i < Num; ++i)
+	{
+		Tiers[i] = 0;
+		const uint64 Size = GetTierSize(InOutRequests[i].Size, 0);
+		TotalArea += Size * Size;
+	}
+
+	const uint64 Budget = (uint64)AtlasSize * AtlasSize;
+	while (TotalArea > Budget)
+	{
+		bool bDemoted = false;
+		for (int32 i = Num - 1; i >= 0 && TotalArea > Budget; --i)
+		{
+			const uint32 Index = Order[i];
+			const uint64 Current = GetTierSize(InOutRequests[Index].Size, Tiers[Index]);
+			const uint64 Next = GetTierSize(InOutRequests[Index].Size, Tiers[Index] + 1);
+			if (Next < Current)
+			{
+				TotalArea -= Current * Current - Next * Next;
+				++Tiers[Index];
+				bDemoted = true;
+			}
+		}
+		if (!bDemoted)
+		{
+			break; // 모두 최소 티어, 나머지는 배치 단계에서 판단
+		}
+	}
+
+	// 3. 크기가 그대로인 기존 할당은 유지, 나머지는 새로 배치할 목록으로
+	for (FShadowAtlasAllocation& Allocation : Allocations)
+	{
+		Allocation.bUsedThisFrame = false;
+	}
+
+	Pending.Empty();
+	for (int32 i = 0; i < Num; ++i)
+	{
+		const uint32 Index = Order[i];
+		const FShadowRenderRequest& Request = InOutRequests[Index];
+		const uint32 Size = GetTierSize(Request.Size, Tiers[Index]);
+		if (Size == 0)
+		{
+			continue;
+		}
+
+		const int32 Found = FindAllocation(Request.LightOwner, Request.SubViewIndex);
+		if (Found >= 0 && Allocations[Found].Size == Size && !Allocations[Found].bUsedThisFrame)
+		{
+			Allocations[Found].bUsedThisFrame = true;
+			continue;
+		}
+		Pending.Add(Index);
+	}
+
+	// 이번 프레임에 쓰이지 않는 할당(사라진 라이트, 크기가 바뀐 영역) 반환
+	bool bFreed = false;
+	for (int32 i = Allocations.Num() - 1; i >= 0; --i)
+	{
+		if (!Allocations[i].bUsedThisFrame)
+		{
+			FreeRects.Add({ Allocations[i].X, Allocations[i].Y, Allocations[i].Size, Allocations[i].Size });
+			Allocations.RemoveAtSwap(i);
+			bFreed = true;
+		}
+	}
+	if (bFreed)
+	{
+		MergeFreeRects();
+	}
+
+	// 4. 새 영역 배치 (큰 것부터), 조각화로 실패하면 전체 재배치
+	std::stable_sort(Pending.begin(), Pending.end(), [this, &InOutRequests](uint32 A, uint32 B)
+	{
+		return GetTierSize(InOutRequests[A].Size, Tiers[A]) > GetTierSize(InOutRequests[B].Size, Tiers[B]);
+	});
+
+	bool bNeedRepack = false;
+	for (uint32 Index : Pending)
+	{
+		const FShadowRenderRequest& Request = InOutRequests[Index];
+
+		FShadowAtlasAllocation Allocation;
+		Allocation.Light = Request.LightOwner;
+		Allocation.SubViewIndex = Request.SubViewIndex;
+		Allocation.Size = GetTierSize(Request.Size, Tiers[Index]);
+		Allocation.bUsedThisFrame = true;
+		if (!InsertRect(Allocation.Size, Allocation.X, Allocation.Y))
+		{
+			bNeedRepack = true;
+			break;
+		}
+		Allocations.Add(Allocation);
+		++FrameStats.NumReallocated;
+	}
+
+	if (bNeedRepack)
+	{
+		Repack(InOutRequests, Tiers);
+	}
+
+	// 5. 결과 기록
+	for (int32 i = 0; i < Num; ++i)
+	{
+		FShadowRenderRequest& Request = InOutRequests[i];
+		const uint32 RequestedSize = GetTierSize(Request.Size, 0);
+		if (RequestedSize == 0)
+		{
+			Request.Size = 0;
+			continue;
+		}
+
+		const int32 Found = FindAllocation(Request.LightOwner, Request.SubViewIndex);
+		if (Found < 0)
+		{
+			Request.Size = 0; // 최소 티어로도 자리가 없음
+			++FrameStats.NumDropped;
+			continue;
+		}
+
+		if (Allocations[Found].Size < RequestedSize)
+		{
+			++FrameStats.NumDemoted;
+		}
+		WriteRequest(Request, Allocations[Found]);
+		++FrameStats.NumRegions;
+	}
+}
+
+void FShadowAtlasAllocator::Repack(TArray<FShadowRenderRequest>& InOutRequests, TArray<uint32>& InOutTiers)
+{
+	++FrameStats.NumFullRepacks;
+	Allocations.Empty();
+	ResetFreeRects();
+
+	// Order는 중요도 순이므로 안정 정렬하면 같은 크기 안에서는 중요한 요청이 먼저 자리를 잡는다
+	Pending.Empty();
+	for (uint32 Index : Order)
+	{
+		if (GetTierSize(InOutRequests[Index].Size, InOutTiers[Index]) > 0)
+		{
+			Pending.Add(Index);
+		}
+	}
+	std::stable_sort(Pending.begin(), Pending.end(), [this, &InOutRequests, &InOutTiers](uint32 A, uint32 B)
+	{
+		return GetTierSize(InOutRequests[A].Size, InOutTiers[A]) > GetTierSize(InOutRequests[B].Size, InOutTiers[B]);
+	});
+
+	FrameStats.NumReallocated = 0;
+	for (uint32 Index : Pending)
+	{
+		const FShadowRenderRequest& Request = InOutRequests[Index];
+
+		FShadowAtlasAllocation Allocation;
+		Allocation.Light = Request.LightOwner;
+		Allocation.SubViewIndex = Request.SubViewIndex;
+		Allocation.bUsedThisFrame = true;
+
+		// 들어가지 않으면 더 작은 티어로 재시도, 최소 티어에서도 실패하면 이 요청만 제외
+		for (;;)
+		{
+			Allocation.Size = GetTierSize(Request.Size, InOutTiers[Index]);
+			if (InsertRect(Allocation.Size, Allocation.X, Allocation.Y))
+			{
+				Allocations.Add(Allocation);
+				++FrameStats.NumReallocated;
+				break;
+			}
+			if (GetTierSize(Request.Size, InOutTiers[Index] + 1) >= Allocation.Size)
+			{
+				break;
+			}
+			++InOutTiers[Index];
+		}
+	}
+}
+
+bool FShadowAtlasAllocator::InsertRect(uint32 Size, uint32& OutX, uint32& OutY)
+{
+	// Best Area Fit: 남는 면적이 가장 작은 빈 사각형 선택
+	int32 BestIndex = -1;
+	uint64 BestLeftover = UINT64_MAX;
+	for (int32 i = 0; i < FreeRects.Num(); ++i)
+	{
+		const FFreeRect& Rect = FreeRects[i];
+		if (Rect.W < Size || Rect.H < Size)
+		{
+			continue;
+		}
+		const uint64 Leftover = (uint64)Rect.W * Rect.H - (uint64)Size * Size;
+		if (Leftover < BestLeftover)
+		{
+			BestLeftover = Leftover;
+			BestIndex = i;
+		}
+	}
+
+	if (BestIndex < 0)
+	{
+		return false;
+	}
+
+	const FFreeRect Rect = FreeRects[BestIndex];
+	FreeRects.RemoveAtSwap(BestIndex);
+	OutX = Rect.X;
+	OutY = Rect.Y;
+
+	// 남은 축 중 짧은 쪽을 기준으로 잘라 긴 조각을 최대한 크게 남긴다
+	const uint32 RightW = Rect.W - Size;
+	const uint32 BottomH = Rect.H - Size;
+	FFreeRect Right;
+	FFreeRect Bottom;
+	if (RightW < BottomH)
+	{
+		Right = { Rect.X + Size, Rect.Y, RightW, Size };
+		Bottom = { Rect.X, Rect.Y + Size, Rect.W, BottomH };
+	}
+	else
+	{
+		Right = { Rect.X + Size, Rect.Y, RightW, Rect.H };
+		Bottom = { Rect.X, Rect.Y + Size, Size, BottomH };
+	}
+
+	if (Right.W > 0 && Right.H > 0)
+	{
+		FreeRects.Add(Right);
+	}
+	if (Bottom.W > 0 && Bottom.H > 0)
+	{
+		FreeRects.Add(Bottom);
+	}
+	return true;
+}
+
+void FShadowAtlasAllocator::FreeRect(uint32 X, uint32 Y, uint32 Size)
+{
+	FreeRects.Add({ X, Y, Size, Size });
+	MergeFreeRects();
+}
+
+void FShadowAtlasAllocator::MergeFreeRects()
+{
+	// 한 변을 온전히 공유하는 빈 사각형끼리 합친다 (더 이상 합칠 게 없을 때까지)
+	bool bMerged = true;
+	while (bMerged)
+	{
+		bMerged = false;
+		for (int32 i = 0; i < FreeRects.Num() && !bMerged; ++i)
+		{
+			for (int32 j = i + 1; j < FreeRects.Num(); ++j)
+			{
+				FFreeRect& A = FreeRects[i];
+				const FFreeRect& B = FreeRects[j];
+
+				if (A.Y == B.Y && A.H == B.H && (A.X + A.W == B.X || B.X + B.W == A.X))
+				{
+					A.X = FMath::Min(A.X, B.X);
+					A.W += B.W;
+				}
+				else if (A.X == B.X && A.W == B.W && (A.Y + A.H == B.Y || B.Y + B.H == A.Y))
+				{
+					A.Y = FMath::Min(A.Y, B.Y);
+					A.H += B.H;
+				}
+				else
+				{
+					continue;
+				}
+
+				FreeRects.RemoveAtSwap(j);
+				bMerged = true;
+				break;
+			}
+		}
+	}
+}
+
+void FShadowAtlasAllocator::InvalidateContents()
+{
+	for (FShadowAtlasAllocation& Allocation : Allocations)
+	{
+		Allocation.bContentValid = false;
+	}
+}
+
+void FShadowAtlasAllocator::ReleaseLight(ULightComponent* Light)
+{
+	for (int32 i = Allocations.Num() - 1; i >= 0; --i)
+	{
+		if (Allocations[i].Light == Light)
+		{
+			FreeRect(Allocations[i].X, Allocations[i].Y, Allocations[i].Size);
+			Allocations.RemoveAtSwap(i);
+		}
+	}
+}
+
+bool FShadowAtlasAllocator::IsSceneKeyValid(const FShadowRenderRequest& Request, uint64 SceneKey) const
+{
+	const FShadowAtlasAllocation* Allocation = FindAllocation(Request);
+	return Allocation && Allocation->bContentValid && Allocation->SceneKey == SceneKey;
+}
+
+bool FShadowAtlasAllocator::IsContentValid(const FShadowRenderRequest& Request, uint64 ContentHash) const
+{
+	const FShadowAtlasAllocation* Allocation = FindAllocation(Request);
+	return Allocation && Allocation->bContentValid && Allocation->ContentHash == ContentHash;
+}
+
+void FShadowAtlasAllocator::UpdateSceneKey(const FShadowRenderRequest& Request, uint64 SceneKey)
+{
+	const int32 Found = FindAllocation(Request.LightOwner, Request.SubViewIndex);
+	if (Found >= 0)
+	{
+		Allocations[Found].SceneKey = SceneKey;
+	}
+}
+
+void FShadowAtlasAllocator::MarkContentRendered(const FShadowRenderRequest& Request, uint64 ContentHash, uint64 SceneKey, bool bCacheable)
+{
+	++FrameStats.NumRendered;
+
+	const int32 Found = FindAllocation(Request.LightOwner, Request.SubViewIndex);
+	if (Found >= 0)
+	{
+		Allocations[Found].ContentHash = ContentHash;
+		Allocations[Found].SceneKey = SceneKey;
+		Allocations[Found].bContentValid = bCacheable;
+	}
+}
+
+int32 FShadowAtlasAllocator::FindAllocation(const ULightComponent* Light, int32 SubViewIndex) const
+{
+	for (int32 i = 0; i < Allocations.Num(); ++i)
+	{
+		if (Allocations[i].Light == Light && Allocations[i].SubViewIndex == SubViewIndex)
+		{
+			return i;
+		}
+	}
+	return -1;
+}
+
+const FShadowAtlasAllocation* FShadowAtlasAllocator::FindAllocation(const FShadowRenderRequest& Request) const
+{
+	const int32 Found = FindAllocation(Request.LightOwner, Request.SubViewIndex);
+	return (Found >= 0 && Allocations[Found].Size == Request.Size) ? &Allocations[Found] : nullptr;
+}
+
+void FShadowAtlasAllocator::WriteRequest(FShadowRenderRequest& Request, const FShadowAtlasAllocation& Allocation) const
+{
+	Request.Size = Allocation.Size;
+	Request.AtlasViewportOffset = FVector2D((float)Allocation.X, (float)Allocation.Y);
+
+	// Pass 2 데이터 (UV) 저장
+	Request.AtlasScaleOffset = FVector4(
+		Allocation.Size / (float)AtlasSize,    // ScaleX
+		Allocation.Size / (float)AtlasSize,    // ScaleY
+		Allocation.X / (float)AtlasSize,       // OffsetX
+		Allocation.Y / (float)AtlasSize        // OffsetY
+	);
+}
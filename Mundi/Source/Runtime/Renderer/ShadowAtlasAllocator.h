@@ -0,0 +1,104 @@
+﻿#pragma once
+
+class ULightComponent;
+struct FShadowRenderRequest;
+
+// 아틀라스에 배치된 섀도우 맵 영역 하나 (라이트 + SubViewIndex 단위로 프레임 간 유지)
+struct FShadowAtlasAllocation
+{
+	ULightComponent* Light = nullptr;
+	int32 SubViewIndex = 0;
+	uint32 X = 0;
+	uint32 Y = 0;
+	uint32 Size = 0;
+
+	// 영역에 마지막으로 그린 내용의 해시 (라이트 행렬 + 프러스텀 안 캐스터), bContentValid일 때만 의미 있음
+	uint64 ContentHash = 0;
+	uint64 SceneKey = 0;			// 라이트 해시 + 전체 스태틱 캐스터 상태 (같으면 내용 해시를 다시 구하지 않음)
+	bool bContentValid = false;
+	bool bUsedThisFrame = false;
+};
+
+// 지난 프레임 할당 결과 (통계 표시용)
+struct FShadowAtlasFrameStats
+{
+	uint32 NumRegions = 0;
+	uint32 NumReallocated = 0;		// 새로 배치되었거나 위치/크기가 바뀐 영역
+	uint32 NumDemoted = 0;			// 요청보다 작은 티어로 내려간 영역
+	uint32 NumDropped = 0;			// 최소 티어로도 자리가 없어 그림자를 끈 영역
+	uint32 NumCached = 0;			// 캐시를 재사용해 다시 그리지 않은 영역
+	uint32 NumRendered = 0;
+	uint32 NumFullRepacks = 0;
+};
+
+/**
+ * 2D 섀도우 아틀라스 할당기 (Guillotine)
+ * - 할당은 (라이트, SubViewIndex) 키로 유지되며 요청 크기(티어)가 그대로면 위치도 그대로 남는다
+ * - 요청 총면적이 아틀라스를 넘으면 중요도가 낮은 요청부터 절반 크기 티어로 내린다 (최소 MinTileSize)
+ * - 빈 공간이 조각나 배치에 실패하면 그 프레임에 한 번 전체를 다시 배치한다
+ * - 영역마다 마지막으로 그린 내용의 해시를 기억해서, 바뀌지 않은 영역은 다시 그리지 않게 한다
+ */
+class FShadowAtlasAllocator
+{
+public:
+	void Initialize(uint32 InAtlasSize, uint32 InMinTileSize = 128);
+	void Reset();
+
+	// InOutRequests의 Size/AtlasViewportOffset/AtlasScaleOffset을 채운다 (자리가 없으면 Size = 0)
+	// InImportance는 요청과 같은 순서, 클수록 큰 티어를 유지한다
+	void Allocate(TArray<FShadowRenderRequest>& InOutRequests, const TArray<float>& InImportance);
+
+	// 아틀라스 내용이 외부에서 지워졌을 때 (배치는 유지, 모든 영역을 다시 그리게 함)
+	void InvalidateContents();
+	void ReleaseLight(ULightComponent* Light);
+
+	// 씬 키가 같으면 내용도 같다 (O(1) 검사)
+	bool IsSceneKeyValid(const FShadowRenderRequest& Request, uint64 SceneKey) const;
+	bool IsContentValid(const FShadowRenderRequest& Request, uint64 ContentHash) const;
+	// 씬 키는 바뀌었지만 내용 해시가 같을 때 (영역 밖 캐스터만 바뀜) 새 씬 키를 기억
+	void UpdateSceneKey(const FShadowRenderRequest& Request, uint64 SceneKey);
+	// bCacheable == false면 (스키닝 캐스터 등) 다음 프레임에도 다시 그린다
+	void MarkContentRendered(const FShadowRenderRequest& Request, uint64 ContentHash, uint64 SceneKey, bool bCacheable);
+	void AddCachedRegion() { ++FrameStats.NumCached; }
+
+	const FShadowAtlasFrameStats& GetFrameStats() const { return LastFrameStats; }
+
+private:
+	struct FFreeRect
+	{
+		uint32 X = 0;
+		uint32 Y = 0;
+		uint32 W = 0;
+		uint32 H = 0;
+	};
+
+	uint32 GetTierSize(uint32 RequestedSize, uint32 Tier) const;
+
+	bool InsertRect(uint32 Size, uint32& OutX, uint32& OutY);
+	void FreeRect(uint32 X, uint32 Y, uint32 Size);
+	void MergeFreeRects();
+	void ResetFreeRects();
+
+	int32 FindAllocation(const ULightComponent* Light, int32 SubViewIndex) const;
+	const FShadowAtlasAllocation* FindAllocation(const FShadowRenderRequest& Request) const;
+
+	// 모든 할당을 버리고 큰 것부터 다시 배치, 들어가지 않으면 티어를 더 내린다
+	void Repack(TArray<FShadowRenderRequest>& InOutRequests, TArray<uint32>& InOutTiers);
+
+	void WriteRequest(FShadowRenderRequest& Request, const FShadowAtlasAllocation& Allocation) const;
+
+private:
+	uint32 AtlasSize = 0;
+	uint32 MinTileSize = 128;
+
+	TArray<FShadowAtlasAllocation> Allocations;
+	TArray<FFreeRect> FreeRects;
+
+	// 프레임마다 재사용하는 임시 버퍼
+	TArray<uint32> Order;
+	TArray<uint32> Tiers;
+	TArray<uint32> Pending;
+
+	FShadowAtlasFrameStats FrameStats;
+	FShadowAtlasFrameStats LastFrameStats;
+};
@@ -16,6 +16,13 @@ struct FShadowStats
 	uint32 ShadowAtlasCubeSize = 0;       // 큐브맵 아틀라스 해상도 (Point Light용)
 	uint32 ShadowCubeArrayCount = 0;      // 큐브맵 배열 개수
 
+	// 2D 아틀라스 영역 (지난 프레임 할당 결과)
+	uint32 ShadowAtlasRegions = 0;
+	uint32 ShadowAtlasDemotedRegions = 0;   // 요청보다 작은 티어로 내려간 영역
+	uint32 ShadowAtlasDroppedRegions = 0;   // 자리가 없어 그림자를 끈 영역
+	uint32 ShadowAtlasRenderedRegions = 0;
+	uint32 ShadowAtlasCachedRegions = 0;    // 내용이 그대로라 다시 그리지 않은 영역
+
 	// 메모리 사용량 (MB)
 	float ShadowAtlas2DMemoryMB = 0.0f;
 	float ShadowAtlasCubeMemoryMB = 0.0f;
@@ -31,6 +38,11 @@ struct FShadowStats
 		ShadowAtlas2DSize = 0;
 		ShadowAtlasCubeSize = 0;
 		ShadowCubeArrayCount = 0;
+		ShadowAtlasRegions = 0;
+		ShadowAtlasDemotedRegions = 0;
+		ShadowAtlasDroppedRegions = 0;
+		ShadowAtlasRenderedRegions = 0;
+		ShadowAtlasCachedRegions = 0;
 		ShadowAtlas2DMemoryMB = 0.0f;
 		ShadowAtlasCubeMemoryMB = 0.0f;
 		TotalShadowMemoryMB = 0.0f;
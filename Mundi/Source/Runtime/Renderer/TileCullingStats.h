@@ -9,6 +9,7 @@ struct FTileCullingStats
 	uint32 TileCountX = 0;
 	uint32 TileCountY = 0;
 	uint32 TotalTileCount = 0;
+	uint32 ClusterSliceCount = 0;   // 0이면 2D 타일, 아니면 깊이 슬라이스 수
 
 	// 라이트 개수
 	uint32 TotalPointLights = 0;
@@ -27,6 +28,7 @@ struct FTileCullingStats
 
 	// 성능 메트릭
 	float ComputeShaderTimeMS = 0.0f;
+	float CullTimeMS = 0.0f;         // CPU 컬링 시간 (업로드 제외)
 	uint32 LightIndexBufferSizeBytes = 0;
 
 	// 시각화 모드
@@ -47,6 +49,7 @@ struct FTileCullingStats
 		TileCountX = 0;
 		TileCountY = 0;
 		TotalTileCount = 0;
+		ClusterSliceCount = 0;
 		TotalPointLights = 0;
 		TotalSpotLights = 0;
 		TotalLights = 0;
@@ -57,6 +60,7 @@ struct FTileCullingStats
 		TotalLightTests = 0;
 		TotalLightsPassed = 0;
 		ComputeShaderTimeMS = 0.0f;
+		CullTimeMS = 0.0f;
 		LightIndexBufferSizeBytes = 0;
 	}
 
@@ -66,9 +70,11 @@ struct FTileCullingStats
 		TotalLights = TotalPointLights + TotalSpotLights;
 		TotalTileCount = TileCountX * TileCountY;
 
-		if (TotalTileCount > 0)
+		// 클러스터 모드에서는 클러스터당 평균
+		const uint32 TotalClusterCount = TotalTileCount * (ClusterSliceCount > 0 ? ClusterSliceCount : 1);
+		if (TotalClusterCount > 0)
 		{
-			AvgLightsPerTile = static_cast<float>(TotalLightsPassed) / static_cast<float>(TotalTileCount);
+			AvgLightsPerTile = static_cast<float>(TotalLightsPassed) / static_cast<float>(TotalClusterCount);
 		}
 
 		if (TotalLightTests > 0)
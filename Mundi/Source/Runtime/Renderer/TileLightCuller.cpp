@@ -1,15 +1,38 @@
 ﻿#include "pch.h"
 #include "TileLightCuller.h"
+#include "PlatformTime.h"
+#include "Source/Runtime/Core/Async/TaskPool.h"
 #include <algorithm>
 
+namespace
+{
+	// 라이트 4개에 대해 (평면 거리 >= -Radius) 마스크, 구가 평면 바깥에 완전히 있지 않으면 통과
+	inline __m128 SpheresNotOutside(float NX, float NY, float NZ, float Distance, __m128 X, __m128 Y, __m128 Z, __m128 NegRadius)
+	{
+		__m128 Dist = _mm_add_ps(_mm_mul_ps(_mm_set1_ps(NX), X), _mm_mul_ps(_mm_set1_ps(NY), Y));
+		Dist = _mm_add_ps(Dist, _mm_mul_ps(_mm_set1_ps(NZ), Z));
+		Dist = _mm_add_ps(Dist, _mm_set1_ps(Distance));
+		return _mm_cmpge_ps(Dist, NegRadius);
+	}
+
+	constexpr int32 EmptyRangeMin = INT32_MAX;
+	constexpr int32 EmptyRangeMax = -1;
+}
+
 FTileLightCuller::FTileLightCuller()
 	: RHI(nullptr)
 	, TileSize(16)
 	, TileCountX(0)
 	, TileCountY(0)
 	, TotalTileCount(0)
+	, ClusterSliceCount(0)
+	, ClusterDepthScale(0.0f)
+	, ClusterDepthBias(0.0f)
+	, NearPlaneView{}
+	, FarPlaneView{}
 	, LightIndexBuffer(nullptr)
 	, LightIndexBufferSRV(nullptr)
+	, LightIndexBufferCapacity(0)
 {
 }
 
@@ -18,12 +41,13 @@ FTileLightCuller::~FTileLightCuller()
 	Release();
 }
 
-void FTileLightCuller::Initialize(D3D11RHI* InRHI, UINT InTileSize)
+void FTileLightCuller::Initialize(D3D11RHI* InRHI, UINT InTileSize, UINT InClusterSliceCount)
 {
 	RHI = InRHI;
-	TileSize = InTileSize;
+	TileSize = std::max(1u, InTileSize);
+	ClusterSliceCount = InClusterSliceCount;
 
-	// 초기화는 CullLights에서 뷰포트 크기를 알게 되면 수행
+	// 그리드 크기는 CullLights에서 뷰포트 크기를 알게 되면 계산
 }
 
 void FTileLightCuller::CullLights(
@@ -35,6 +59,14 @@ void FTileLightCuller::CullLights(
 	float FarPlane,
 	UINT ViewportWidth,
 	UINT ViewportHeight)
+{
+	BuildLightLists(PointLights, SpotLights, ViewMatrix, ProjMatrix, NearPlane, FarPlane, ViewportWidth, ViewportHeight);
+
+	// GPU 버퍼 생성 또는 업데이트
+	UploadLightLists();
+}
+
+void FTileLightCuller::SetupGrid(UINT ViewportWidth, UINT ViewportHeight, int32 NumPointLights, int32 NumSpotLights)
 {
 	// 타일 그리드 계산
 	TileCountX = (ViewportWidth + TileSize - 1) / TileSize;
@@ -46,16 +78,352 @@ void FTileLightCuller::CullLights(
 	Stats.TileCountX = TileCountX;
 	Stats.TileCountY = TileCountY;
 	Stats.TotalTileCount = TotalTileCount;
-	Stats.TotalPointLights = PointLights.Num();
-	Stats.TotalSpotLights = SpotLights.Num();
-	Stats.TotalLights = PointLights.Num() + SpotLights.Num();
-
-	// 타일 라이트 인덱스 버퍼 크기 재조정
-	UINT RequiredSize = TotalTileCount * MaxLightsPerTile;
+	Stats.ClusterSliceCount = ClusterSliceCount;
+	Stats.TotalPointLights = NumPointLights;
+	Stats.TotalSpotLights = NumSpotLights;
+	Stats.TotalLights = NumPointLights + NumSpotLights;
+	Stats.LightIndexBufferSizeBytes = LightIndexBufferCapacity * sizeof(uint32);
+
+	// 타일(클러스터) 라이트 인덱스 버퍼 크기 재조정
+	const UINT RequiredSize = GetClusterCount() * GetLightListStride();
 	if (TileLightIndices.Num() != RequiredSize)
 	{
 		TileLightIndices.SetNum(RequiredSize);
 	}
+}
+
+void FTileLightCuller::SetupClusterDepth(float NearPlane, float FarPlane)
+{
+	ClusterDepthScale = 0.0f;
+	ClusterDepthBias = 0.0f;
+	if (ClusterSliceCount == 0)
+	{
+		return;
+	}
+
+	// 로그 분할: Slice = N * log2(Z / Near) / log2(Far / Near)
+	const float SafeNear = std::max(NearPlane, 0.001f);
+	const float SafeFar = std::max(FarPlane, SafeNear * 1.01f);
+	const float LogRange = std::log2(SafeFar / SafeNear);
+	ClusterDepthScale = static_cast<float>(ClusterSliceCount) / LogRange;
+	ClusterDepthBias = -static_cast<float>(ClusterSliceCount) * std::log2(SafeNear) / LogRange;
+}
+
+int32 FTileLightCuller::GetDepthSlice(float ViewZ) const
+{
+	// 셰이더의 CalculateClusterIndex와 같은 식
+	if (ViewZ <= 0.0f)
+	{
+		return 0;
+	}
+	const int32 Slice = static_cast<int32>(std::floor(std::log2(ViewZ) * ClusterDepthScale + ClusterDepthBias));
+	return std::clamp(Slice, 0, static_cast<int32>(ClusterSliceCount) - 1);
+}
+
+void FTileLightCuller::BuildLightLists(
+	const TArray<FPointLightInfo>& PointLights,
+	const TArray<FSpotLightInfo>& SpotLights,
+	const FMatrix& ViewMatrix,
+	const FMatrix& ProjMatrix,
+	float NearPlane,
+	float FarPlane,
+	UINT ViewportWidth,
+	UINT ViewportHeight)
+{
+	const uint64 StartCycles = FPlatformTime::Cycles64();
+
+	SetupGrid(ViewportWidth, ViewportHeight, PointLights.Num(), SpotLights.Num());
+	if (TotalTileCount == 0)
+	{
+		return;
+	}
+
+	SetupClusterDepth(NearPlane, FarPlane);
+	BuildViewSpaceLights(PointLights, SpotLights, ViewMatrix);
+	BuildTilePlanes(ProjMatrix, ViewportWidth, ViewportHeight);
+	ComputeLightTileBounds();
+	FillLightLists(PointLights.Num());
+
+	// 컬링 효율성 계산
+	Stats.CalculateStats();
+	Stats.CullTimeMS = static_cast<float>(FPlatformTime::ToMilliseconds(FPlatformTime::Cycles64() - StartCycles));
+}
+
+void FTileLightCuller::BuildViewSpaceLights(const TArray<FPointLightInfo>& PointLights, const TArray<FSpotLightInfo>& SpotLights, const FMatrix& ViewMatrix)
+{
+	// SoA로 저장, SIMD 로드를 위해 4의 배수로 패딩
+	const int32 NumLights = PointLights.Num() + SpotLights.Num();
+	const int32 PaddedCount = (NumLights + 3) & ~3;
+	LightViewX.SetNum(PaddedCount);
+	LightViewY.SetNum(PaddedCount);
+	LightViewZ.SetNum(PaddedCount);
+	LightNegRadius.SetNum(PaddedCount);
+
+	auto StoreLight = [this, &ViewMatrix](int32 Index, const FVector& WorldPosition, float Radius)
+	{
+		const FVector ViewPosition = ViewMatrix.TransformPosition(WorldPosition);
+		LightViewX[Index] = ViewPosition.X;
+		LightViewY[Index] = ViewPosition.Y;
+		LightViewZ[Index] = ViewPosition.Z;
+		LightNegRadius[Index] = -Radius;
+	};
+
+	// Spot Light도 기존과 같이 구체로 근사
+	for (int32 i = 0; i < PointLights.Num(); ++i)
+	{
+		StoreLight(i, PointLights[i].Position, PointLights[i].AttenuationRadius);
+	}
+	for (int32 i = 0; i < SpotLights.Num(); ++i)
+	{
+		StoreLight(PointLights.Num() + i, SpotLights[i].Position, SpotLights[i].AttenuationRadius);
+	}
+	for (int32 i = NumLights; i < PaddedCount; ++i)
+	{
+		LightViewX[i] = LightViewY[i] = LightViewZ[i] = 0.0f;
+		LightNegRadius[i] = FLT_MAX;
+	}
+}
+
+void FTileLightCuller::BuildTilePlanes(const FMatrix& ProjMatrix, UINT ViewportWidth, UINT ViewportHeight)
+{
+	// 직교 투영에는 InversePerspectiveProjection이 맞지 않으므로 전용 역행렬 사용
+	const bool bOrthographic = ProjMatrix.M[3][3] == 1.0f;
+	const FMatrix InvProj = bOrthographic ? ProjMatrix.InverseOrthographicProjection() : ProjMatrix.InversePerspectiveProjection();
+
+	auto Unproject = [&InvProj](float NdcX, float NdcY, float NdcZ)
+	{
+		FVector4 ViewPos = FVector4(NdcX, NdcY, NdcZ, 1.0f) * InvProj;
+		ViewPos /= ViewPos.W;
+		return FVector(ViewPos.X, ViewPos.Y, ViewPos.Z);
+	};
+
+	// CreateTileFrustum과 같은 코너 순서로 평면 생성 (외향 법선 부호 규약 동일)
+	auto MakePlane = [](const FVector& A, const FVector& B, const FVector& C)
+	{
+		const FVector Normal = FVector::Cross(B - A, C - A).GetSafeNormal();
+		return FCullPlane{ Normal.X, Normal.Y, Normal.Z, -FVector::Dot(Normal, A) };
+	};
+
+	// 타일 경계의 NDC x 또는 y가 같은 점들은 한 평면 위에 있으므로
+	// 열 평면은 행과 무관하고 행 평면은 열과 무관하다 -> (열 + 행) 개만 만든다
+	const float Width = static_cast<float>(ViewportWidth);
+	const float Height = static_cast<float>(ViewportHeight);
+
+	ColumnMinPlanes.SetNum(TileCountX);
+	ColumnMaxPlanes.SetNum(TileCountX);
+	for (UINT TileX = 0; TileX < TileCountX; ++TileX)
+	{
+		const float NDC_MinX = (static_cast<float>(TileX * TileSize) / Width) * 2.0f - 1.0f;
+		const float NDC_MaxX = (static_cast<float>((TileX + 1) * TileSize) / Width) * 2.0f - 1.0f;
+		ColumnMinPlanes[TileX] = MakePlane(Unproject(NDC_MinX, -1.0f, 0.0f), Unproject(NDC_MinX, 1.0f, 0.0f), Unproject(NDC_MinX, 1.0f, 1.0f));
+		ColumnMaxPlanes[TileX] = MakePlane(Unproject(NDC_MaxX, -1.0f, 0.0f), Unproject(NDC_MaxX, -1.0f, 1.0f), Unproject(NDC_MaxX, 1.0f, 1.0f));
+	}
+
+	RowMinPlanes.SetNum(TileCountY);
+	RowMaxPlanes.SetNum(TileCountY);
+	for (UINT TileY = 0; TileY < TileCountY; ++TileY)
+	{
+		const float NDC_MinY = 1.0f - (static_cast<float>((TileY + 1) * TileSize) / Height) * 2.0f; // Y축 반전
+		const float NDC_MaxY = 1.0f - (static_cast<float>(TileY * TileSize) / Height) * 2.0f;
+		RowMinPlanes[TileY] = MakePlane(Unproject(1.0f, NDC_MaxY, 0.0f), Unproject(-1.0f, NDC_MaxY, 0.0f), Unproject(-1.0f, NDC_MaxY, 1.0f));
+		RowMaxPlanes[TileY] = MakePlane(Unproject(-1.0f, NDC_MinY, 0.0f), Unproject(1.0f, NDC_MinY, 0.0f), Unproject(1.0f, NDC_MinY, 1.0f));
+	}
+
+	NearPlaneView = MakePlane(Unproject(-1.0f, -1.0f, 0.0f), Unproject(1.0f, -1.0f, 0.0f), Unproject(1.0f, 1.0f, 0.0f));
+	FarPlaneView = MakePlane(Unproject(-1.0f, -1.0f, 1.0f), Unproject(1.0f, 1.0f, 1.0f), Unproject(1.0f, -1.0f, 1.0f));
+}
+
+void FTileLightCuller::ComputeAxisRange(
+	const TArray<FCullPlane>& MinPlanes,
+	const TArray<FCullPlane>& MaxPlanes,
+	const float* X, const float* Y, const float* Z, const float* NegRadius,
+	int32 OutMin[4], int32 OutMax[4])
+{
+	const __m128 PX = _mm_loadu_ps(X);
+	const __m128 PY = _mm_loadu_ps(Y);
+	const __m128 PZ = _mm_loadu_ps(Z);
+	const __m128 NegR = _mm_loadu_ps(NegRadius);
+
+	for (int32 Lane = 0; Lane < 4; ++Lane)
+	{
+		OutMin[Lane] = EmptyRangeMin;
+		OutMax[Lane] = EmptyRangeMax;
+	}
+
+	for (int32 i = 0; i < MinPlanes.Num(); ++i)
+	{
+		const FCullPlane& MinPlane = MinPlanes[i];
+		const FCullPlane& MaxPlane = MaxPlanes[i];
+		const __m128 MinPass = SpheresNotOutside(MinPlane.NX, MinPlane.NY, MinPlane.NZ, MinPlane.Distance, PX, PY, PZ, NegR);
+		const __m128 MaxPass = SpheresNotOutside(MaxPlane.NX, MaxPlane.NY, MaxPlane.NZ, MaxPlane.Distance, PX, PY, PZ, NegR);
+		const int32 Mask = _mm_movemask_ps(_mm_and_ps(MinPass, MaxPass));
+		if (Mask == 0)
+		{
+			continue;
+		}
+
+		for (int32 Lane = 0; Lane < 4; ++Lane)
+		{
+			if (Mask & (1 << Lane))
+			{
+				OutMin[Lane] = std::min(OutMin[Lane], i);
+				OutMax[Lane] = i;
+			}
+		}
+	}
+}
+
+void FTileLightCuller::ComputeLightTileBounds()
+{
+	// 라이트마다 통과하는 첫/마지막 열과 행을 구해 화면 공간 타일 범위로 사용
+	// (통과 열 사이가 비는 경우도 범위에 포함하므로 기존 방식보다 같거나 보수적)
+	const int32 NumLights = static_cast<int32>(Stats.TotalLights);
+	const int32 NumGroups = (NumLights + 3) / 4;
+	LightBounds.SetNum(NumLights);
+
+	FTaskPool::Get().ParallelFor(NumGroups, 16, [this, NumLights](int32 Begin, int32 End)
+	{
+		for (int32 Group = Begin; Group < End; ++Group)
+		{
+			const int32 First = Group * 4;
+			int32 MinX[4], MaxX[4], MinY[4], MaxY[4];
+			ComputeAxisRange(ColumnMinPlanes, ColumnMaxPlanes, &LightViewX[First], &LightViewY[First], &LightViewZ[First], &LightNegRadius[First], MinX, MaxX);
+			ComputeAxisRange(RowMinPlanes, RowMaxPlanes, &LightViewX[First], &LightViewY[First], &LightViewZ[First], &LightNegRadius[First], MinY, MaxY);
+
+			const int32 LaneCount = std::min(4, NumLights - First);
+			for (int32 Lane = 0; Lane < LaneCount; ++Lane)
+			{
+				const int32 Light = First + Lane;
+				const float X = LightViewX[Light];
+				const float Y = LightViewY[Light];
+				const float Z = LightViewZ[Light];
+				const float NegRadius = LightNegRadius[Light];
+
+				FLightTileBounds& Bounds = LightBounds[Light];
+				Bounds = { MinX[Lane], MaxX[Lane], MinY[Lane], MaxY[Lane], 0, 0 };
+
+				// Near/Far 평면은 모든 타일이 공유
+				const float NearDist = NearPlaneView.NX * X + NearPlaneView.NY * Y + NearPlaneView.NZ * Z + NearPlaneView.Distance;
+				const float FarDist = FarPlaneView.NX * X + FarPlaneView.NY * Y + FarPlaneView.NZ * Z + FarPlaneView.Distance;
+				if (NearDist < NegRadius || FarDist < NegRadius)
+				{
+					Bounds.MinY = EmptyRangeMin;
+					Bounds.MaxY = EmptyRangeMax;
+					continue;
+				}
+
+				if (ClusterSliceCount > 0)
+				{
+					Bounds.MinSlice = GetDepthSlice(Z + NegRadius);
+					Bounds.MaxSlice = GetDepthSlice(Z - NegRadius);
+				}
+			}
+		}
+	});
+}
+
+void FTileLightCuller::FillLightLists(int32 NumPointLights)
+{
+	// 작업 단위 = (슬라이스, 타일 행), 작업끼리 쓰는 구간이 겹치지 않는다
+	// 클러스터 인덱스 = Slice * TotalTileCount + TileY * TileCountX + TileX = Job * TileCountX + TileX
+	const int32 NumSlices = static_cast<int32>(std::max(1u, ClusterSliceCount));
+	const int32 NumRows = static_cast<int32>(TileCountY);
+	const int32 NumColumns = static_cast<int32>(TileCountX);
+	const int32 NumJobs = NumSlices * NumRows;
+	const int32 NumLights = LightBounds.Num();
+	const uint32 Stride = GetLightListStride();
+
+	JobLightSum.SetNum(NumJobs);
+	JobMinLights.SetNum(NumJobs);
+	JobMaxLights.SetNum(NumJobs);
+
+	FTaskPool::Get().ParallelFor(NumJobs, 4, [&](int32 Begin, int32 End)
+	{
+		for (int32 Job = Begin; Job < End; ++Job)
+		{
+			const int32 Slice = Job / NumRows;
+			const int32 Row = Job % NumRows;
+			uint32* RowData = TileLightIndices.GetData() + static_cast<size_t>(Job) * NumColumns * Stride;
+
+			for (int32 Column = 0; Column < NumColumns; ++Column)
+			{
+				RowData[Column * Stride] = 0;
+			}
+
+			// 라이트 순서대로 추가 (Point 먼저, 이후 Spot - 기존 결과와 같은 순서)
+			for (int32 Light = 0; Light < NumLights; ++Light)
+			{
+				const FLightTileBounds& Bounds = LightBounds[Light];
+				if (Row < Bounds.MinY || Row > Bounds.MaxY || Slice < Bounds.MinSlice || Slice > Bounds.MaxSlice)
+				{
+					continue;
+				}
+
+				// 상위 16비트: 타입(0=Point, 1=Spot), 하위 16비트: 인덱스
+				const uint32 PackedIndex = Light < NumPointLights
+					? static_cast<uint32>(Light)
+					: ((1u << 16) | static_cast<uint32>(Light - NumPointLights));
+
+				for (int32 Column = Bounds.MinX; Column <= Bounds.MaxX; ++Column)
+				{
+					uint32* Cell = RowData + Column * Stride;
+					if (Cell[0] < Stride - 1)
+					{
+						Cell[1 + Cell[0]] = PackedIndex;
+						++Cell[0];
+					}
+				}
+			}
+
+			uint32 Sum = 0;
+			uint32 MinCount = UINT_MAX;
+			uint32 MaxCount = 0;
+			for (int32 Column = 0; Column < NumColumns; ++Column)
+			{
+				const uint32 Count = RowData[Column * Stride];
+				Sum += Count;
+				MinCount = std::min(MinCount, Count);
+				MaxCount = std::max(MaxCount, Count);
+			}
+			JobLightSum[Job] = Sum;
+			JobMinLights[Job] = MinCount;
+			JobMaxLights[Job] = MaxCount;
+		}
+	});
+
+	Stats.MinLightsPerTile = UINT_MAX;
+	Stats.MaxLightsPerTile = 0;
+	for (int32 Job = 0; Job < NumJobs; ++Job)
+	{
+		Stats.TotalLightsPassed += JobLightSum[Job];
+		Stats.MinLightsPerTile = std::min(Stats.MinLightsPerTile, JobMinLights[Job]);
+		Stats.MaxLightsPerTile = std::max(Stats.MaxLightsPerTile, JobMaxLights[Job]);
+	}
+
+	// 기존 방식과 같은 기준 (클러스터 x 라이트 조합 수)
+	Stats.TotalLightTests = GetClusterCount() * static_cast<uint32>(NumLights);
+}
+
+void FTileLightCuller::BuildLightListsReference(
+	const TArray<FPointLightInfo>& PointLights,
+	const TArray<FSpotLightInfo>& SpotLights,
+	const FMatrix& ViewMatrix,
+	const FMatrix& ProjMatrix,
+	float NearPlane,
+	float FarPlane,
+	UINT ViewportWidth,
+	UINT ViewportHeight)
+{
+	if (ClusterSliceCount > 0)
+	{
+		UE_LOG("FTileLightCuller: Reference culling supports 2D tiles only\n");
+		return;
+	}
+
+	const uint64 StartCycles = FPlatformTime::Cycles64();
+
+	SetupGrid(ViewportWidth, ViewportHeight, PointLights.Num(), SpotLights.Num());
+	const UINT RequiredSize = TotalTileCount * MaxLightsPerTile;
 
 	// 버퍼 초기화 (모든 타일의 라이트 개수를 0으로)
 	memset(TileLightIndices.GetData(), 0, RequiredSize * sizeof(uint32));
@@ -66,7 +434,6 @@ void FTileLightCuller::CullLights(
 	// 각 타일에 대해 컬링 수행
 	Stats.MinLightsPerTile = UINT_MAX;
 	Stats.MaxLightsPerTile = 0;
-	uint32 TotalLightsAcrossAllTiles = 0;
 
 	for (UINT TileY = 0; TileY < TileCountY; ++TileY)
 	{
@@ -76,7 +443,7 @@ void FTileLightCuller::CullLights(
 			UINT TileDataOffset = TileIndex * MaxLightsPerTile;
 
 			// 타일 프러스텀 생성
-			FFrustum Frustum = CreateTileFrustum(TileX, TileY, InvViewProj, NearPlane, FarPlane);
+			FFrustum Frustum = CreateTileFrustum(TileX, TileY, InvViewProj, static_cast<float>(ViewportWidth), static_cast<float>(ViewportHeight));
 
 			uint32 LightCount = 0;
 
@@ -114,55 +481,20 @@ void FTileLightCuller::CullLights(
 			// 통계 업데이트
 			Stats.MinLightsPerTile = FMath::Min(Stats.MinLightsPerTile, LightCount);
 			Stats.MaxLightsPerTile = FMath::Max(Stats.MaxLightsPerTile, LightCount);
-			TotalLightsAcrossAllTiles += LightCount;
 		}
 	}
 
-	// 평균 계산
-	if (TotalTileCount > 0)
-	{
-		Stats.AvgLightsPerTile = static_cast<float>(TotalLightsAcrossAllTiles) / static_cast<float>(TotalTileCount);
-	}
-
 	// 컬링 효율성 계산
 	Stats.CalculateStats();
-
-	// GPU 버퍼 생성 또는 업데이트
-	if (!LightIndexBuffer)
-	{
-		// 버퍼 생성
-		HRESULT hr = RHI->CreateStructuredBuffer(
-			sizeof(uint32),
-			RequiredSize,
-			TileLightIndices.GetData(),
-			&LightIndexBuffer
-		);
-
-		if (SUCCEEDED(hr))
-		{
-			// SRV 생성
-			RHI->CreateStructuredBufferSRV(LightIndexBuffer, &LightIndexBufferSRV);
-		}
-
-		Stats.LightIndexBufferSizeBytes = RequiredSize * sizeof(uint32);
-	}
-	else
-	{
-		// 기존 버퍼 업데이트
-		RHI->UpdateStructuredBuffer(
-			LightIndexBuffer,
-			TileLightIndices.GetData(),
-			RequiredSize * sizeof(uint32)
-		);
-	}
+	Stats.CullTimeMS = static_cast<float>(FPlatformTime::ToMilliseconds(FPlatformTime::Cycles64() - StartCycles));
 }
 
 FFrustum FTileLightCuller::CreateTileFrustum(
 	UINT TileX,
 	UINT TileY,
 	const FMatrix& InvViewProj,
-	float NearPlane,
-	float FarPlane)
+	float ViewportWidth,
+	float ViewportHeight)
 {
 	FFrustum Frustum;
 
@@ -175,10 +507,6 @@ FFrustum FTileLightCuller::CreateTileFrustum(
 	float TileMinY = static_cast<float>(TileY * TileSize);
 	float TileMaxY = static_cast<float>((TileY + 1) * TileSize);
 
-	// 뷰포트 크기
-	float ViewportWidth = static_cast<float>(TileCountX * TileSize);
-	float ViewportHeight = static_cast<float>(TileCountY * TileSize);
-
 	// Screen Space -> NDC
 	float NDC_MinX = (TileMinX / ViewportWidth) * 2.0f - 1.0f;
 	float NDC_MaxX = (TileMaxX / ViewportWidth) * 2.0f - 1.0f;
@@ -401,6 +729,57 @@ ID3D11ShaderResourceView* FTileLightCuller::GetLightIndexBufferSRV()
 	return LightIndexBufferSRV;
 }
 
+void FTileLightCuller::UploadLightLists()
+{
+	const UINT RequiredSize = static_cast<UINT>(TileLightIndices.Num());
+	if (!RHI || RequiredSize == 0)
+	{
+		return;
+	}
+
+	// 용량이 부족할 때만 재생성 (뷰포트 크기가 달라도 큰 쪽 버퍼를 재사용)
+	if (LightIndexBuffer && LightIndexBufferCapacity < RequiredSize)
+	{
+		if (LightIndexBufferSRV)
+		{
+			LightIndexBufferSRV->Release();
+			LightIndexBufferSRV = nullptr;
+		}
+		LightIndexBuffer->Release();
+		LightIndexBuffer = nullptr;
+		LightIndexBufferCapacity = 0;
+	}
+
+	if (!LightIndexBuffer)
+	{
+		// 버퍼 생성
+		HRESULT hr = RHI->CreateStructuredBuffer(
+			sizeof(uint32),
+			RequiredSize,
+			TileLightIndices.GetData(),
+			&LightIndexBuffer
+		);
+
+		if (SUCCEEDED(hr))
+		{
+			// SRV 생성
+			RHI->CreateStructuredBufferSRV(LightIndexBuffer, &LightIndexBufferSRV);
+			LightIndexBufferCapacity = RequiredSize;
+		}
+	}
+	else
+	{
+		// 기존 버퍼 업데이트 (사용하는 앞부분만)
+		RHI->UpdateStructuredBuffer(
+			LightIndexBuffer,
+			TileLightIndices.GetData(),
+			RequiredSize * sizeof(uint32)
+		);
+	}
+
+	Stats.LightIndexBufferSizeBytes = LightIndexBufferCapacity * sizeof(uint32);
+}
+
 void FTileLightCuller::Release()
 {
 	if (LightIndexBufferSRV)
@@ -414,6 +793,7 @@ void FTileLightCuller::Release()
 		LightIndexBuffer->Release();
 		LightIndexBuffer = nullptr;
 	}
+	LightIndexBufferCapacity = 0;
 
 	TileLightIndices.Empty();
 }
@@ -5,17 +5,19 @@
 #include "Frustum.h"
 
 // 타일 기반 라이트 컬링을 CPU에서 수행하는 클래스
-// Conservative(near, far) frustum 방식으로 각 타일에 영향을 주는 라이트를 계산
+// - 라이트를 뷰 공간으로 한 번 변환한 뒤, 타일 열/행 경계 평면과 SIMD로 검사해 라이트마다 타일 범위를 구한다
+// - 라이트 목록 작성은 타일 행 단위로 워커 스레드에 나눠 수행 (라이트 순서는 유지)
+// - ClusterSliceCount > 0이면 뷰 깊이를 로그 스케일로 나눈 클러스터(froxel) 단위로 목록을 만든다
 class FTileLightCuller
 {
 public:
 	FTileLightCuller();
 	~FTileLightCuller();
 
-	// 초기화 (Structured Buffer 생성)
-	void Initialize(D3D11RHI* InRHI, UINT InTileSize = 16);
+	// 초기화 (ClusterSliceCount = 0이면 2D 타일 모드)
+	void Initialize(D3D11RHI* InRHI, UINT InTileSize = 16, UINT InClusterSliceCount = 0);
 
-	// 타일 컬링 수행 (매 프레임 호출)
+	// 타일 컬링 수행 후 Structured Buffer 업로드 (매 프레임 호출)
 	void CullLights(
 		const TArray<FPointLightInfo>& PointLights,
 		const TArray<FSpotLightInfo>& SpotLights,
@@ -27,9 +29,43 @@ public:
 		UINT ViewportHeight
 	);
 
+	// CPU 라이트 목록만 생성 (GPU 업로드 없음)
+	void BuildLightLists(
+		const TArray<FPointLightInfo>& PointLights,
+		const TArray<FSpotLightInfo>& SpotLights,
+		const FMatrix& ViewMatrix,
+		const FMatrix& ProjMatrix,
+		float NearPlane,
+		float FarPlane,
+		UINT ViewportWidth,
+		UINT ViewportHeight
+	);
+
+	// 이전 방식: 타일마다 월드 공간 프러스텀을 만들어 모든 라이트를 직렬로 검사 (벤치마크 비교 기준, 2D 타일 모드만)
+	void BuildLightListsReference(
+		const TArray<FPointLightInfo>& PointLights,
+		const TArray<FSpotLightInfo>& SpotLights,
+		const FMatrix& ViewMatrix,
+		const FMatrix& ProjMatrix,
+		float NearPlane,
+		float FarPlane,
+		UINT ViewportWidth,
+		UINT ViewportHeight
+	);
+
 	// 컬링 결과를 Structured Buffer에 업데이트하고 SRV 반환
 	ID3D11ShaderResourceView* GetLightIndexBufferSRV();
 
+	// CPU 결과 ([Cluster * Stride] = 개수, 이후 (타입 << 16) | 인덱스)
+	const TArray<uint32>& GetLightIndices() const { return TileLightIndices; }
+	UINT GetLightListStride() const { return ClusterSliceCount > 0 ? MaxLightsPerCluster : MaxLightsPerTile; }
+	UINT GetClusterSliceCount() const { return ClusterSliceCount; }
+	UINT GetClusterCount() const { return TotalTileCount * std::max(1u, ClusterSliceCount); }
+
+	// 슬라이스 = floor(log2(ViewZ) * Scale + Bias)
+	float GetClusterDepthScale() const { return ClusterDepthScale; }
+	float GetClusterDepthBias() const { return ClusterDepthBias; }
+
 	// 통계 정보 반환
 	const FTileCullingStats& GetStats() const { return Stats; }
 
@@ -37,13 +73,44 @@ public:
 	void Release();
 
 private:
+	// 뷰 공간 평면 (Normal · P + Distance = 0, 법선은 타일 안쪽)
+	struct FCullPlane
+	{
+		float NX, NY, NZ, Distance;
+	};
+
+	// 라이트가 걸치는 타일/슬라이스 범위 (Min > Max면 화면 밖)
+	struct FLightTileBounds
+	{
+		int32 MinX, MaxX;
+		int32 MinY, MaxY;
+		int32 MinSlice, MaxSlice;
+	};
+
+	void SetupGrid(UINT ViewportWidth, UINT ViewportHeight, int32 NumPointLights, int32 NumSpotLights);
+	void SetupClusterDepth(float NearPlane, float FarPlane);
+	void BuildViewSpaceLights(const TArray<FPointLightInfo>& PointLights, const TArray<FSpotLightInfo>& SpotLights, const FMatrix& ViewMatrix);
+	void BuildTilePlanes(const FMatrix& ProjMatrix, UINT ViewportWidth, UINT ViewportHeight);
+	void ComputeLightTileBounds();
+	void FillLightLists(int32 NumPointLights);
+	int32 GetDepthSlice(float ViewZ) const;
+
+	// 한 축(열 또는 행)의 경계 평면들에 대해 라이트 4개가 통과하는 범위를 구한다
+	static void ComputeAxisRange(
+		const TArray<FCullPlane>& MinPlanes,
+		const TArray<FCullPlane>& MaxPlanes,
+		const float* X, const float* Y, const float* Z, const float* NegRadius,
+		int32 OutMin[4], int32 OutMax[4]);
+
+	void UploadLightLists();
+
 	// 타일 프러스텀 생성 (Conservative near/far 방식)
 	FFrustum CreateTileFrustum(
 		UINT TileX,
 		UINT TileY,
 		const FMatrix& InvViewProj,
-		float NearPlane,
-		float FarPlane
+		float ViewportWidth,
+		float ViewportHeight
 	);
 
 	// 라이트가 타일 프러스텀과 교차하는지 테스트
@@ -71,17 +138,42 @@ private:
 	UINT TileCountY;        // 세로 타일 개수
 	UINT TotalTileCount;    // 전체 타일 개수
 
+	// 클러스터 설정 (0이면 2D 타일)
+	UINT ClusterSliceCount;
+	float ClusterDepthScale;
+	float ClusterDepthBias;
+
 	// 타일당 최대 라이트 개수 (보수적으로 설정)
 	static constexpr UINT MaxLightsPerTile = 256;
 
+	// 클러스터당 최대 라이트 개수 (클러스터 수가 슬라이스 배로 늘어나므로 작게 잡는다)
+	static constexpr UINT MaxLightsPerCluster = 32;
+
 	// 타일별 라이트 인덱스 저장
 	// [TileIndex * MaxLightsPerTile] 위치에 라이트 개수 저장
 	// [TileIndex * MaxLightsPerTile + 1 ~ ...] 위치에 라이트 인덱스 저장
 	TArray<uint32> TileLightIndices;
 
-	// GPU 리소스
+	// 프레임마다 재사용하는 작업 버퍼
+	TArray<float> LightViewX;
+	TArray<float> LightViewY;
+	TArray<float> LightViewZ;
+	TArray<float> LightNegRadius;		// -Radius (패딩 레인은 FLT_MAX로 항상 실패)
+	TArray<FLightTileBounds> LightBounds;
+	TArray<FCullPlane> ColumnMinPlanes;	// 열 c의 Left 평면
+	TArray<FCullPlane> ColumnMaxPlanes;	// 열 c의 Right 평면
+	TArray<FCullPlane> RowMinPlanes;	// 행 r의 Top 평면 (화면 위쪽이 행 0)
+	TArray<FCullPlane> RowMaxPlanes;	// 행 r의 Bottom 평면
+	FCullPlane NearPlaneView;
+	FCullPlane FarPlaneView;
+	TArray<uint32> JobLightSum;
+	TArray<uint32> JobMinLights;
+	TArray<uint32> JobMaxLights;
+
+	// GPU 리소스 (용량은 늘어나기만 하고 필요한 만큼만 업로드)
 	ID3D11Buffer* LightIndexBuffer;
 	ID3D11ShaderResourceView* LightIndexBufferSRV;
+	UINT LightIndexBufferCapacity;
 
 	// 통계
 	FTileCullingStats Stats;
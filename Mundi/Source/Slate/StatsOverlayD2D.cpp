@@ -15,6 +15,10 @@
 #include "ShadowStats.h"
 #include "SkinningStats.h"
 #include "Source/Runtime/Engine/Particle/ParticleStats.h"
+#include "LuaScriptProfiler.h"
+#include "MeshDrawCommandStats.h"
+#include "Source/Runtime/Engine/Animation/AnimUpdateRateStats.h"
+#include "Source/Runtime/Engine/AI/AIStats.h"
 
 #pragma comment(lib, "d2d1")
 #pragma comment(lib, "dwrite")
@@ -94,6 +98,13 @@ void UStatsOverlayD2D::Initialize(ID3D11Device* InDevice, ID3D11DeviceContext* I
 	EnsureInitialized();
 }
 
+void UStatsOverlayD2D::SetShowScript(bool b)
+{
+	bShowScript = b;
+	// 함수 단위 Hook은 오버헤드가 있으므로 패널이 켜져 있을 때만 설치
+	FLuaScriptProfiler::Get().SetFunctionProfilingEnabled(b);
+}
+
 void UStatsOverlayD2D::Shutdown()
 {
 	ReleaseD2DResources();
@@ -174,7 +185,7 @@ static void DrawTextBlock(
 
 void UStatsOverlayD2D::Draw()
 {
-	if (!bInitialized || (!bShowFPS && !bShowMemory && !bShowPicking && !bShowDecal && !bShowTileCulling && !bShowLights && !bShowShadow && !bShowSkinning) || !SwapChain)
+	if (!bInitialized || (!bShowFPS && !bShowMemory && !bShowPicking && !bShowDecal && !bShowTileCulling && !bShowLights && !bShowShadow && !bShowSkinning && !bShowParticle && !bShowScript && !bShowMeshDraw && !bShowProfiler && !bShowAnimation && !bShowAI) || !SwapChain)
 	{
 		return;
 	}
@@ -290,10 +301,11 @@ void UStatsOverlayD2D::Draw()
 		const FTileCullingStats& TileStats = FTileCullingStatManager::GetInstance().GetStats();
 
 		wchar_t Buf[512];
-		swprintf_s(Buf, L"[Tile Culling Stats]\nTiles: %u x %u (%u)\nLights: %u (P:%u S:%u)\nMin/Avg/Max: %u / %.1f / %u\nCulling Eff: %.1f%%\nBuffer: %u KB",
+		swprintf_s(Buf, L"[Tile Culling Stats]\nTiles: %u x %u (%u) Slices: %u\nLights: %u (P:%u S:%u)\nMin/Avg/Max: %u / %.1f / %u\nCulling Eff: %.1f%%\nCPU Cull: %.3f ms\nBuffer: %u KB",
 			TileStats.TileCountX,
 			TileStats.TileCountY,
 			TileStats.TotalTileCount,
+			TileStats.ClusterSliceCount,
 			TileStats.TotalLights,
 			TileStats.TotalPointLights,
 			TileStats.TotalSpotLights,
@@ -301,9 +313,10 @@ void UStatsOverlayD2D::Draw()
 			TileStats.AvgLightsPerTile,
 			TileStats.MaxLightsPerTile,
 			TileStats.CullingEfficiency,
+			TileStats.CullTimeMS,
 			TileStats.LightIndexBufferSizeBytes / 1024);
 
-		const float tilePanelHeight = 160.0f;
+		const float tilePanelHeight = 180.0f;
 		D2D1_RECT_F rc = D2D1::RectF(Margin, NextY, Margin + PanelWidth, NextY + tilePanelHeight);
 		DrawTextBlock(D2DContext, TextFormat, Buf, rc, BrushBlack, BrushCyan);
 
@@ -334,7 +347,7 @@ void UStatsOverlayD2D::Draw()
 		const FShadowStats& ShadowStats = FShadowStatManager::GetInstance().GetStats();
 
 		wchar_t Buf[512];
-		swprintf_s(Buf, L"[Shadow Stats]\nShadow Lights: %u\n  Point: %u\n  Spot: %u\n  Directional: %u\n\nAtlas 2D: %u x %u (%.1f MB)\nAtlas Cube: %u x %u x %u (%.1f MB)\n\nTotal Memory: %.1f MB",
+		swprintf_s(Buf, L"[Shadow Stats]\nShadow Lights: %u\n  Point: %u\n  Spot: %u\n  Directional: %u\n\nAtlas 2D: %u x %u (%.1f MB)\nAtlas Cube: %u x %u x %u (%.1f MB)\n\nAtlas Regions: %u (Demoted: %u, Dropped: %u)\n  Rendered: %u / Cached: %u\n\nTotal Memory: %.1f MB",
 			ShadowStats.TotalShadowCastingLights,
 			ShadowStats.ShadowCastingPointLights,
 			ShadowStats.ShadowCastingSpotLights,
@@ -346,16 +359,21 @@ void UStatsOverlayD2D::Draw()
 			ShadowStats.ShadowAtlasCubeSize,
 			ShadowStats.ShadowCubeArrayCount,
 			ShadowStats.ShadowAtlasCubeMemoryMB,
+			ShadowStats.ShadowAtlasRegions,
+			ShadowStats.ShadowAtlasDemotedRegions,
+			ShadowStats.ShadowAtlasDroppedRegions,
+			ShadowStats.ShadowAtlasRenderedRegions,
+			ShadowStats.ShadowAtlasCachedRegions,
 			ShadowStats.TotalShadowMemoryMB);
 
-		const float shadowPanelHeight = 260.0f;
+		const float shadowPanelHeight = 310.0f;
 		D2D1_RECT_F rc = D2D1::RectF(Margin, NextY, Margin + PanelWidth, NextY + shadowPanelHeight);
 		DrawTextBlock(D2DContext, TextFormat, Buf, rc, BrushBlack, BrushDeepPink);
 
 		NextY += shadowPanelHeight + Space;
 
 		rc = D2D1::RectF(Margin, NextY, Margin + PanelWidth, NextY + 40);
-		DrawTextBlock(D2DContext, TextFormat, FScopeCycleCounter::GetTimeProfile("ShadowMapPass").GetConstWChar_tWithKey("ShadowMapPass"), rc, BrushBlack, BrushDeepPink);
+		DrawTextBlock(D2DContext, TextFormat, FCPUProfiler::Get().GetLastFrameProfile("ShadowMapPass").GetConstWChar_tWithKey("ShadowMapPass"), rc, BrushBlack, BrushDeepPink);
 
 		NextY += shadowPanelHeight + Space;
 	}
@@ -365,10 +383,10 @@ void UStatsOverlayD2D::Draw()
 		// GPU 스키닝
 		double GPUSkinning = GET_GPU_STAT("GPUSkinning")
 		// CPU 스키닝
-		double CPUSkinning = FScopeCycleCounter::GetTimeProfile("CPUSkinning").GetTime();
-		double VertexBuffer = FScopeCycleCounter::GetTimeProfile("VertexBuffer").GetTime();
-		double StructuredBuffer = FScopeCycleCounter::GetTimeProfile("StructuredBuffer").GetTime();
-		double SkeletalAABB = FScopeCycleCounter::GetTimeProfile("SkeletalAABB").GetTime();
+		double CPUSkinning = FCPUProfiler::Get().GetLastFrameProfile("CPUSkinning").GetTime();
+		double VertexBuffer = FCPUProfiler::Get().GetLastFrameProfile("VertexBuffer").GetTime();
+		double StructuredBuffer = FCPUProfiler::Get().GetLastFrameProfile("StructuredBuffer").GetTime();
+		double SkeletalAABB = FCPUProfiler::Get().GetLastFrameProfile("SkeletalAABB").GetTime();
 
 		const FSkinningStats& SkinningStats = FSkinningStatManager::GetInstance().GetStats();
 		FWideString AllSkinningType = UTF8ToWide(SkinningStats.SkinningType);		
@@ -403,8 +421,8 @@ void UStatsOverlayD2D::Draw()
 	{		
 		const FParticleStats& ParticleStats = FParticleStatManager::GetInstance().GetStats();
     
-		double SimulationTime = FScopeCycleCounter::GetTimeProfile("Particle_Simulation").GetTime();
-		double CollectBatchesTime = FScopeCycleCounter::GetTimeProfile("Particle_CollectBatches").GetTime();
+		double SimulationTime = FCPUProfiler::Get().GetLastFrameProfile("Particle_Simulation").GetTime();
+		double CollectBatchesTime = FCPUProfiler::Get().GetLastFrameProfile("Particle_CollectBatches").GetTime();
 		double GPUDrawTime = FGPUProfiler::GetInstance().GetStat("Particle_Draw");
 
 		wchar_t Buf[512];
@@ -430,11 +448,231 @@ void UStatsOverlayD2D::Draw()
 		DrawTextBlock(D2DContext, TextFormat, Buf, rc, BrushBlack, BrushCyan);
 		NextY += ParticlePanelHeight + Space;		
 	}
+
+	if (bShowScript)
+	{
+		const FLuaScriptProfiler& Profiler = FLuaScriptProfiler::Get();
+		const TArray<FLuaScriptProfile>& Scripts = Profiler.GetScriptProfiles();
+		const TArray<FLuaFunctionProfile>& Functions = Profiler.GetFunctionProfiles();
+		constexpr int32 MaxRows = 5;
+
+		wchar_t Line[256];
+		FWideString Text;
+		int32 LineCount = 0;
+		auto AppendLine = [&Text, &LineCount](const wchar_t* InLine)
+		{
+			Text += InLine;
+			Text += L"\n";
+			++LineCount;
+		};
+
+		AppendLine(L"[Lua Script Stats]");
+		swprintf_s(Line, L" Scripts : %d  Instances : %u", Scripts.Num(), Profiler.GetTickedInstances());
+		AppendLine(Line);
+		swprintf_s(Line, L" Dispatch Calls : %u", Profiler.GetDispatchCalls());
+		AppendLine(Line);
+		swprintf_s(Line, L" Tick Phase : %.3f ms", FCPUProfiler::Get().GetLastFrameProfile("Lua_ScriptTick").GetTime());
+		AppendLine(Line);
+		swprintf_s(Line, L" Allocs/Frame : %llu (%.1f KB)", Profiler.GetFrameAllocCount(), Profiler.GetFrameAllocBytes() / 1024.0);
+		AppendLine(Line);
+
+		AppendLine(L"[Scripts] ms / allocs");
+		for (int32 i = 0; i < Scripts.Num() && i < MaxRows; ++i)
+		{
+			const FWideString Name = UTF8ToWide(std::filesystem::path(Scripts[i].ScriptPath).filename().string());
+			swprintf_s(Line, L" %s x%u : %.3f / %llu", Name.c_str(), Scripts[i].InstanceCount, Scripts[i].Milliseconds, Scripts[i].AllocCount);
+			AppendLine(Line);
+		}
+
+		AppendLine(L"[Functions] ms / calls / allocs");
+		for (int32 i = 0; i < Functions.Num() && i < MaxRows; ++i)
+		{
+			const FWideString Name = UTF8ToWide(Functions[i].Name);
+			swprintf_s(Line, L" %s : %.3f / %u / %llu", Name.c_str(), Functions[i].Milliseconds, Functions[i].CallCount, Functions[i].AllocCount);
+			AppendLine(Line);
+		}
+
+		const float ScriptPanelHeight = 20.0f * LineCount + 8.0f;
+		D2D1_RECT_F rc = D2D1::RectF(Margin, NextY, Margin + PanelWidth + 200.0f, NextY + ScriptPanelHeight);
+		DrawTextBlock(D2DContext, TextFormat, Text.c_str(), rc, BrushBlack, BrushLightGreen);
+		NextY += ScriptPanelHeight + Space;
+	}
+
+	if (bShowMeshDraw)
+	{
+		const FMeshDrawCommandStats& MeshDrawStats = FMeshDrawCommandStatManager::GetInstance().GetStats();
+
+		wchar_t Buf[512];
+		swprintf_s(Buf, L"[Mesh Draw Commands]\n Collect : %.3f ms\n Cached Sections : %u\n Rebuilt Sections : %u\n Submit : %.3f ms\n Draw Calls : %u\n Instanced Draws : %u (%u instances)",
+			FCPUProfiler::Get().GetLastFrameProfile("MeshBatchCollect").GetTime(),
+			MeshDrawStats.CachedCommands,
+			MeshDrawStats.BuiltCommands,
+			FCPUProfiler::Get().GetLastFrameProfile("MeshBatchSubmit").GetTime(),
+			MeshDrawStats.DrawCalls,
+			MeshDrawStats.InstancedDraws,
+			MeshDrawStats.MergedInstances);
+
+		constexpr float MeshDrawPanelHeight = 150.0f;
+		D2D1_RECT_F rc = D2D1::RectF(Margin, NextY, Margin + PanelWidth, NextY + MeshDrawPanelHeight);
+		DrawTextBlock(D2DContext, TextFormat, Buf, rc, BrushBlack, BrushOrange);
+		NextY += MeshDrawPanelHeight + Space;
+	}
+
+	if (bShowAnimation)
+	{
+		const FAnimUpdateRateStats& AnimStats = FAnimUpdateRateStatManager::GetInstance().GetStats();
+
+		wchar_t Buf[512];
+		swprintf_s(Buf, L"[Animation Update Rate]\n Update : %.3f ms\n Evaluated : %u\n Shared : %u (%u poses, %u hits)\n Interpolated : %u\n Skipped : %u",
+			FCPUProfiler::Get().GetLastFrameProfile("AnimationUpdate").GetTime(),
+			AnimStats.EvaluatedInstances,
+			AnimStats.SharedInstances,
+			AnimStats.SharedPoses,
+			AnimStats.SharedPoseHits,
+			AnimStats.InterpolatedInstances,
+			AnimStats.SkippedInstances);
+
+		constexpr float AnimationPanelHeight = 130.0f;
+		D2D1_RECT_F rc = D2D1::RectF(Margin, NextY, Margin + PanelWidth + 50.0f, NextY + AnimationPanelHeight);
+		DrawTextBlock(D2DContext, TextFormat, Buf, rc, BrushBlack, BrushSkyBlue);
+		NextY += AnimationPanelHeight + Space;
+	}
+
+	if (bShowAI)
+	{
+		const FAIStats& AIStats = FAIStatManager::GetInstance().GetStats();
+
+		wchar_t Buf[512];
+		swprintf_s(Buf, L"[AI Decisions]\n Decision : %.3f ms (schedule %.3f ms)\n Agents : %u (offscreen %u)\n Decided : %u / %u due\n Deferred : %u\n Latency : %.1f ms avg / %.1f ms max",
+			AIStats.DecisionMs,
+			AIStats.ScheduleMs,
+			AIStats.NumAgents,
+			AIStats.NumOffscreen,
+			AIStats.NumDecisions,
+			AIStats.NumDue,
+			AIStats.NumDeferred,
+			AIStats.AvgLatencyMs,
+			AIStats.MaxLatencyMs);
+
+		constexpr float AIPanelHeight = 130.0f;
+		D2D1_RECT_F rc = D2D1::RectF(Margin, NextY, Margin + PanelWidth + 50.0f, NextY + AIPanelHeight);
+		DrawTextBlock(D2DContext, TextFormat, Buf, rc, BrushBlack, BrushLightGreen);
+		NextY += AIPanelHeight + Space;
+	}
+
+	if (bShowProfiler)
+	{
+		const FCPUProfiler& Profiler = FCPUProfiler::Get();
+		const int32 NumHistory = Profiler.GetNumHistoryFrames();
+		constexpr int32 MaxGraphFrames = 120;
+		constexpr float GraphHeight = 60.0f;
+		constexpr float GraphMaxMs = 33.3f;			// 그래프 상단 = 30fps
+		constexpr float TargetFrameMs = 16.7f;
+		const float GraphWidth = PanelWidth + 150.0f;
+
+		// 프레임 시간 그래프 (최근 MaxGraphFrames 프레임, 오른쪽이 최신)
+		const int32 FirstFrame = std::max(0, NumHistory - MaxGraphFrames);
+		const float BarWidth = GraphWidth / MaxGraphFrames;
+		double SumMs = 0.0;
+		double MaxMs = 0.0;
+
+		D2D1_RECT_F GraphRect = D2D1::RectF(Margin, NextY, Margin + GraphWidth, NextY + GraphHeight);
+		D2DContext->FillRectangle(GraphRect, BrushBlack);
+		for (int32 i = FirstFrame; i < NumHistory; ++i)
+		{
+			const double FrameMs = Profiler.GetHistoryFrame(i).FrameMs;
+			SumMs += FrameMs;
+			MaxMs = std::max(MaxMs, FrameMs);
+
+			const float BarHeight = GraphHeight * std::min(1.0f, static_cast<float>(FrameMs) / GraphMaxMs);
+			const float X = Margin + (i - FirstFrame + MaxGraphFrames - (NumHistory - FirstFrame)) * BarWidth;
+			ID2D1SolidColorBrush* BarBrush = FrameMs <= TargetFrameMs ? BrushLightGreen : (FrameMs <= GraphMaxMs ? BrushOrange : BrushDeepPink);
+			D2DContext->FillRectangle(D2D1::RectF(X, GraphRect.bottom - BarHeight, X + BarWidth, GraphRect.bottom), BarBrush);
+		}
+		const float TargetY = GraphRect.bottom - GraphHeight * (TargetFrameMs / GraphMaxMs);
+		D2DContext->DrawLine(D2D1::Point2F(GraphRect.left, TargetY), D2D1::Point2F(GraphRect.right, TargetY), BrushYellow, 1.0f);
+		NextY += GraphHeight;
+
+		wchar_t Line[256];
+		FWideString Text;
+		int32 LineCount = 0;
+		auto AppendLine = [&Text, &LineCount](const wchar_t* InLine)
+		{
+			Text += InLine;
+			Text += L"\n";
+			++LineCount;
+		};
+
+		const FCPUFrameRecord* LastFrame = Profiler.GetLastFrame();
+		const int32 NumGraphFrames = NumHistory - FirstFrame;
+		swprintf_s(Line, L"[CPU Profiler] %.2f ms  avg %.2f  max %.2f",
+			LastFrame ? LastFrame->FrameMs : 0.0,
+			NumGraphFrames > 0 ? SumMs / NumGraphFrames : 0.0,
+			MaxMs);
+		AppendLine(Line);
+
+		// 메인 스레드는 트리 상위 노드, 나머지 스레드는 루트 스코프 합계만
+		constexpr int32 MaxTreeRows = 14;
+		const TArray<FCPUThreadFrameTree>& Trees = Profiler.GetLastFrameTrees();
+		for (const FCPUThreadFrameTree& Tree : Trees)
+		{
+			if (Tree.Nodes.IsEmpty())
+			{
+				continue;
+			}
+
+			const FString ThreadNameUtf8 = Profiler.GetThreadName(Tree.ThreadIndex);
+			const FWideString ThreadName = UTF8ToWide(ThreadNameUtf8);
+			if (ThreadNameUtf8 == "Main")
+			{
+				swprintf_s(Line, L"[%s]", ThreadName.c_str());
+				AppendLine(Line);
+				for (int32 i = 0; i < Tree.Nodes.Num() && i < MaxTreeRows; ++i)
+				{
+					const FCPUScopeNode& Node = Tree.Nodes[i];
+					const FWideString StatName = UTF8ToWide(FCPUProfiler::GetStatName(Node.StatId));
+					swprintf_s(Line, L"%*s%s : %.3f ms x%u", 1 + Node.Depth * 2, L"", StatName.c_str(), Node.InclusiveMs, Node.CallCount);
+					AppendLine(Line);
+				}
+			}
+			else
+			{
+				double RootMs = 0.0;
+				uint32 RootCalls = 0;
+				for (const FCPUScopeNode& Node : Tree.Nodes)
+				{
+					if (Node.Parent < 0)
+					{
+						RootMs += Node.InclusiveMs;
+						RootCalls += Node.CallCount;
+					}
+				}
+				swprintf_s(Line, L"[%s #%d] %.3f ms x%u", ThreadName.c_str(), Tree.ThreadIndex, RootMs, RootCalls);
+				AppendLine(Line);
+			}
+		}
+
+		if (const uint64 Dropped = Profiler.GetNumDroppedEvents())
+		{
+			swprintf_s(Line, L" Dropped Events : %llu", Dropped);
+			AppendLine(Line);
+		}
+		if (Profiler.IsCapturingTrace())
+		{
+			AppendLine(L" Capturing trace...");
+		}
+
+		const float ProfilerPanelHeight = 20.0f * LineCount + 8.0f;
+		D2D1_RECT_F rc = D2D1::RectF(Margin, NextY, Margin + GraphWidth, NextY + ProfilerPanelHeight);
+		DrawTextBlock(D2DContext, TextFormat, Text.c_str(), rc, BrushBlack, BrushYellow);
+		NextY += ProfilerPanelHeight + Space;
+	}
 	D2DContext->EndDraw();
 	D2DContext->SetTarget(nullptr);
 
 	FParticleStatManager::GetInstance().ResetStats();
-	FScopeCycleCounter::TimeProfileInit();
+	FMeshDrawCommandStatManager::GetInstance().ResetStats();
+	FAnimUpdateRateStatManager::GetInstance().ResetStats();
 
 	SafeRelease(TargetBmp);
 	SafeRelease(Surface);
@@ -20,6 +20,11 @@ public:
     void SetShowShadow(bool b) { bShowShadow = b; }
     void SetShowSkinning(bool b) { bShowSkinning = b; }
     void SetShowParticle(bool b) { bShowParticle = b; }
+    void SetShowScript(bool b);
+    void SetShowMeshDraw(bool b) { bShowMeshDraw = b; }
+    void SetShowProfiler(bool b) { bShowProfiler = b; }
+    void SetShowAnimation(bool b) { bShowAnimation = b; }
+    void SetShowAI(bool b) { bShowAI = b; }
     void ToggleFPS() { bShowFPS = !bShowFPS; }
     void ToggleMemory() { bShowMemory = !bShowMemory; }
     void TogglePicking() { bShowPicking = !bShowPicking; }
@@ -29,6 +34,11 @@ public:
     void ToggleShadow() { bShowShadow = !bShowShadow; }
     void ToggleSkinning() { bShowSkinning = !bShowSkinning; }
     void ToggleParticle() { bShowParticle = !bShowParticle; }
+    void ToggleScript() { SetShowScript(!bShowScript); }
+    void ToggleMeshDraw() { bShowMeshDraw = !bShowMeshDraw; }
+    void ToggleProfiler() { bShowProfiler = !bShowProfiler; }
+    void ToggleAnimation() { bShowAnimation = !bShowAnimation; }
+    void ToggleAI() { bShowAI = !bShowAI; }
     bool IsFPSVisible() const { return bShowFPS; }
     bool IsMemoryVisible() const { return bShowMemory; }
     bool IsPickingVisible() const { return bShowPicking; }
@@ -38,6 +48,11 @@ public:
     bool IsShadowVisible() const { return bShowShadow; }
     bool IsSkinningVisible() const { return bShowSkinning; }
     bool IsParticleVisible() const { return bShowParticle; }
+    bool IsScriptVisible() const { return bShowScript; }
+    bool IsMeshDrawVisible() const { return bShowMeshDraw; }
+    bool IsProfilerVisible() const { return bShowProfiler; }
+    bool IsAnimationVisible() const { return bShowAnimation; }
+    bool IsAIVisible() const { return bShowAI; }
 
 private:
     UStatsOverlayD2D() = default;
@@ -59,6 +74,11 @@ private:
     bool bShowLights = false;
     bool bShowSkinning = false;
     bool bShowParticle = false;
+    bool bShowScript = false;
+    bool bShowMeshDraw = false;
+    bool bShowProfiler = false;
+    bool bShowAnimation = false;
+    bool bShowAI = false;
 
     ID3D11Device* D3DDevice = nullptr;
     ID3D11DeviceContext* D3DContext = nullptr;
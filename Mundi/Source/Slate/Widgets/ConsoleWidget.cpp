@@ -12,6 +12,20 @@
 #include <mutex>
 
 #include "Source/Runtime/Debug/CrashHandler.h"
+#include "Source/Runtime/Debug/TransformBenchmark.h"
+#include "Source/Runtime/Debug/LightCullingBenchmark.h"
+#include "Source/Runtime/Debug/OcclusionCullingBenchmark.h"
+#include "Source/Runtime/Debug/MeshBVHBenchmark.h"
+#include "Source/Runtime/Debug/ShaderCacheBenchmark.h"
+#include "Source/Runtime/Debug/AnimBlueprintVMBenchmark.h"
+#include "Source/Runtime/Debug/AnimPoseBenchmark.h"
+#include "Source/Runtime/Debug/AnimStateMachineBenchmark.h"
+#include "Source/Runtime/Debug/NavigationBenchmark.h"
+#include "Source/Runtime/Debug/CombatBenchmark.h"
+#include "Source/Runtime/Debug/DelegateBenchmark.h"
+#include "Source/Runtime/Engine/Navigation/NavigationSystem.h"
+#include "ShaderCompiler.h"
+#include "CPUProfiler.h"
 
 using std::max;
 using std::min;
@@ -66,6 +80,27 @@ void UConsoleWidget::Initialize()
 	HelpCommandList.Add("STAT NONE");
 	HelpCommandList.Add("STAT LIGHT");
 	HelpCommandList.Add("STAT SHADOW");
+	HelpCommandList.Add("STAT MESHDRAW");
+	HelpCommandList.Add("STAT SCRIPT");
+	HelpCommandList.Add("STAT PROFILER");
+	HelpCommandList.Add("STAT ANIM");
+	HelpCommandList.Add("STAT AI");
+	HelpCommandList.Add("PROFILE TRACE");
+	HelpCommandList.Add("BENCH TRANSFORM");
+	HelpCommandList.Add("BENCH LIGHTCULL");
+	HelpCommandList.Add("BENCH OCCLUSION");
+	HelpCommandList.Add("BENCH MESHBVH");
+	HelpCommandList.Add("BENCH SHADERCACHE");
+	HelpCommandList.Add("BENCH ANIMBP");
+	HelpCommandList.Add("BENCH POSE");
+	HelpCommandList.Add("BENCH ANIMSM");
+	HelpCommandList.Add("BENCH NAV");
+	HelpCommandList.Add("BENCH COMBAT");
+	HelpCommandList.Add("BENCH DELEGATE");
+	HelpCommandList.Add("NAV REBUILD");
+	HelpCommandList.Add("NAV STATS");
+	HelpCommandList.Add("SHADER PRECOMPILE");
+	HelpCommandList.Add("SHADER STATS");
 
 	// Add welcome messages
 	AddLog("=== Console Widget Initialized ===");
@@ -341,6 +376,11 @@ void UConsoleWidget::ExecCommand(const char* command_line)
 		AddLog("- STAT DECAL");
 		AddLog("- STAT ALL");
 		AddLog("- STAT LIGHT");
+		AddLog("- STAT SCRIPT");
+		AddLog("- STAT MESHDRAW");
+		AddLog("- STAT PROFILER");
+		AddLog("- STAT ANIM");
+		AddLog("- STAT AI");
 		AddLog("- STAT NONE");
 	}
 	else if (Stricmp(command_line, "STAT FPS") == 0)
@@ -368,6 +408,31 @@ void UConsoleWidget::ExecCommand(const char* command_line)
 		UStatsOverlayD2D::Get().ToggleTileCulling();
 		AddLog("STAT LIGHT TOGGLED");
 	}
+	else if (Stricmp(command_line, "STAT SCRIPT") == 0)
+	{
+		UStatsOverlayD2D::Get().ToggleScript();
+		AddLog("STAT SCRIPT TOGGLED");
+	}
+	else if (Stricmp(command_line, "STAT MESHDRAW") == 0)
+	{
+		UStatsOverlayD2D::Get().ToggleMeshDraw();
+		AddLog("STAT MESHDRAW TOGGLED");
+	}
+	else if (Stricmp(command_line, "STAT PROFILER") == 0)
+	{
+		UStatsOverlayD2D::Get().ToggleProfiler();
+		AddLog("STAT PROFILER TOGGLED");
+	}
+	else if (Stricmp(command_line, "STAT ANIM") == 0)
+	{
+		UStatsOverlayD2D::Get().ToggleAnimation();
+		AddLog("STAT ANIM TOGGLED");
+	}
+	else if (Stricmp(command_line, "STAT AI") == 0)
+	{
+		UStatsOverlayD2D::Get().ToggleAI();
+		AddLog("STAT AI TOGGLED");
+	}
 	else if (Stricmp(command_line, "STAT ALL") == 0)
 	{
 		UStatsOverlayD2D::Get().SetShowFPS(true);
@@ -384,8 +449,103 @@ void UConsoleWidget::ExecCommand(const char* command_line)
 		UStatsOverlayD2D::Get().SetShowPicking(false);
 		UStatsOverlayD2D::Get().SetShowDecal(false);
 		UStatsOverlayD2D::Get().SetShowTileCulling(false);
+		UStatsOverlayD2D::Get().SetShowScript(false);
+		UStatsOverlayD2D::Get().SetShowMeshDraw(false);
+		UStatsOverlayD2D::Get().SetShowProfiler(false);
+		UStatsOverlayD2D::Get().SetShowAnimation(false);
+		UStatsOverlayD2D::Get().SetShowAI(false);
 		AddLog("STAT: OFF");
 	}
+	else if (Stricmp(command_line, "PROFILE TRACE") == 0)
+	{
+		// 다음 120 프레임의 모든 스레드 스코프를 chrome://tracing 형식으로 저장
+		FCPUProfiler::Get().BeginTraceCapture(120, "Saved/Profiling/CPUTrace.json");
+		AddLog("PROFILE TRACE: capturing 120 frames -> Saved/Profiling/CPUTrace.json");
+	}
+	else if (Stricmp(command_line, "BENCH TRANSFORM") == 0)
+	{
+		// 10k 컴포넌트, 5단계 계층
+		FTransformBenchmark::Run(10000, 5);
+	}
+	else if (Stricmp(command_line, "BENCH LIGHTCULL") == 0)
+	{
+		// 1080p/4K x 라이트 256/1024, 기존 직렬 컬링과 비교
+		FLightCullingBenchmark::Run(5);
+	}
+	else if (Stricmp(command_line, "BENCH OCCLUSION") == 0)
+	{
+		// DemoScene/TESTSCENE 배치 1x1/4x4/8x8, 가려진 후보 수와 단계별 시간
+		FOcclusionCullingBenchmark::Run(5);
+	}
+	else if (Stricmp(command_line, "BENCH MESHBVH") == 0)
+	{
+		// 고폴리 OBJ 메시별 SAH 빌드 시간과 레이 처리량, 전수 검사와 결과 비교
+		FMeshBVHBenchmark::Run(200000);
+	}
+	else if (Stricmp(command_line, "BENCH SHADERCACHE") == 0)
+	{
+		// 스텁 컴파일러로 콜드 동기/백그라운드/웜 캐시 시간 비교와 무효화/취소 검사
+		FShaderCacheBenchmark::Run(20.0f);
+	}
+	else if (Stricmp(command_line, "BENCH ANIMBP") == 0)
+	{
+		// 500 인스턴스 x 전이 조건 6개, 재귀 평가기와 바이트코드 VM 비교
+		FAnimBlueprintVMBenchmark::Run(500, 200);
+	}
+	else if (Stricmp(command_line, "BENCH POSE") == 0)
+	{
+		// 80본 크로스페이드 + 상체 레이어 + 몽타주, 임시 배열 방식과 포즈 스택 방식 비교 및 무할당 검사
+		FAnimPoseBenchmark::Run(80, 2000);
+	}
+	else if (Stricmp(command_line, "BENCH ANIMSM") == 0)
+	{
+		// 로코모션 상태머신 2000개 (10%만 이동), 매 프레임 폴링과 입력 변수 변경 시에만 평가하는 방식 비교
+		FAnimStateMachineBenchmark::Run(2000, 300, 10);
+	}
+	else if (Stricmp(command_line, "BENCH NAV") == 0)
+	{
+		// 합성 레벨 내비메시 빌드/부분 재빌드 + 500 에이전트 재경로 탐색, 직렬 A*와 배치 병렬 + 통로 재사용 비교
+		FNavigationBenchmark::Run(500, 120);
+	}
+	else if (Stricmp(command_line, "BENCH COMBAT") == 0)
+	{
+		// 히트박스 300개 x 피해자 300개, 히트박스별 직렬 Sweep과 배치 병렬 오버랩 + 쌍 중복 제거 비교
+		FCombatBenchmark::Run(300, 300, 120);
+	}
+	else if (Stricmp(command_line, "BENCH DELEGATE") == 0)
+	{
+		// 델리게이트 2000개 x 핸들러 8개, std::function 배열과 인라인 슬롯 델리게이트의 Broadcast/재바인딩 비교
+		FDelegateBenchmark::Run(2000, 8, 200);
+	}
+	else if (Stricmp(command_line, "NAV REBUILD") == 0 || Stricmp(command_line, "NAV STATS") == 0)
+	{
+		FNavigationSystem* NavigationSystem = GWorld ? GWorld->GetNavigationSystem() : nullptr;
+		if (!NavigationSystem)
+		{
+			AddLog("Navigation is only available during PIE");
+		}
+		else if (Stricmp(command_line, "NAV REBUILD") == 0)
+		{
+			NavigationSystem->RequestRebuild();
+			AddLog("NAV REBUILD requested (next tick)");
+		}
+		else
+		{
+			NavigationSystem->LogStats();
+		}
+	}
+	else if (Stricmp(command_line, "SHADER PRECOMPILE") == 0)
+	{
+		const int32 NumQueued = UResourceManager::GetInstance().PrecompileShaderVariants();
+		AddLog("SHADER PRECOMPILE: %d variants queued", NumQueued);
+	}
+	else if (Stricmp(command_line, "SHADER STATS") == 0)
+	{
+		const FShaderCompileStats Stats = FShaderCompileManager::Get().GetStats();
+		AddLog("SHADER: cache hits %u, compiled %u, failed %u, async %u/%u, pending %d, compile %.1f ms",
+			Stats.NumCacheHits, Stats.NumCompiled, Stats.NumFailed, Stats.NumAsyncFinished, Stats.NumAsyncSubmitted,
+			FShaderCompileManager::Get().GetNumPendingJobs(), Stats.CompileMs);
+	}
 	else
 	{
 		AddLog("Unknown command: '%s'", command_line);
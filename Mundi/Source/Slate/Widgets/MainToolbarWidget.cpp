@@ -331,7 +331,7 @@ void UMainToolbarWidget::RenderActorSpawnButton()
             ImGui::SetNextItemWidth(150.0f);
             ImGui::InputInt("##SpawnCount", &RandomSpawnSettings.SpawnCount);
             if (RandomSpawnSettings.SpawnCount < 1) RandomSpawnSettings.SpawnCount = 1;
-            if (RandomSpawnSettings.SpawnCount > 1000) RandomSpawnSettings.SpawnCount = 1000;
+            if (RandomSpawnSettings.SpawnCount > 10000) RandomSpawnSettings.SpawnCount = 10000;   // 드로우 커맨드 수집 부하 측정용 (10k 메시)
 
             // 스폰 범위 타입
             const char* rangeTypes[] = { "중심점 + 반경", "박스 영역", "선택 액터 주변", "뷰포트 중심" };
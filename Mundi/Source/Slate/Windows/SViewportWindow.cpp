@@ -1522,6 +1522,46 @@ void SViewportWindow::RenderShowFlagDropdownMenu()
 				ImGui::SetTooltip("파티클 통계를 표시합니다.");
 			}
 
+			bool bScriptStats = UStatsOverlayD2D::Get().IsScriptVisible();
+			if (ImGui::Checkbox(" SCRIPT", &bScriptStats))
+			{
+				UStatsOverlayD2D::Get().ToggleScript();
+			}
+			if (ImGui::IsItemHovered())
+			{
+				ImGui::SetTooltip("Lua 스크립트/함수별 시간과 할당 통계를 표시합니다. (켜져 있는 동안 함수 Hook 활성화)");
+			}
+
+			bool bMeshDrawStats = UStatsOverlayD2D::Get().IsMeshDrawVisible();
+			if (ImGui::Checkbox(" MESH DRAW", &bMeshDrawStats))
+			{
+				UStatsOverlayD2D::Get().ToggleMeshDraw();
+			}
+			if (ImGui::IsItemHovered())
+			{
+				ImGui::SetTooltip("메시 배치 수집 시간과 드로우 커맨드 캐시 재사용/재빌드 수를 표시합니다.");
+			}
+
+			bool bAnimationStats = UStatsOverlayD2D::Get().IsAnimationVisible();
+			if (ImGui::Checkbox(" ANIMATION", &bAnimationStats))
+			{
+				UStatsOverlayD2D::Get().ToggleAnimation();
+			}
+			if (ImGui::IsItemHovered())
+			{
+				ImGui::SetTooltip("스켈레탈 메시별 포즈 평가/공유/보간/생략 수를 표시합니다. (업데이트 주기 최적화)");
+			}
+
+			bool bAIStats = UStatsOverlayD2D::Get().IsAIVisible();
+			if (ImGui::Checkbox(" AI", &bAIStats))
+			{
+				UStatsOverlayD2D::Get().ToggleAI();
+			}
+			if (ImGui::IsItemHovered())
+			{
+				ImGui::SetTooltip("AI 결정 시간, 프레임 예산으로 밀린 수, 결정 간격(지연)을 표시합니다.");
+			}
+
 			ImGui::EndMenu();
 		}
 
@@ -1769,6 +1809,32 @@ void SViewportWindow::RenderShowFlagDropdownMenu()
 
 		ImGui::Text(" 안티 에일리어싱");
 
+		// 자동 GPU 인스턴싱
+		bool bAutoInstancing = RenderSettings.IsShowFlagEnabled(EEngineShowFlags::SF_AutoInstancing);
+		if (ImGui::Checkbox("##AutoInstancing", &bAutoInstancing))
+		{
+			RenderSettings.ToggleShowFlag(EEngineShowFlags::SF_AutoInstancing);
+		}
+		ImGui::SameLine();
+		ImGui::Text(" 자동 인스턴싱");
+		if (ImGui::IsItemHovered())
+		{
+			ImGui::SetTooltip("같은 메시와 머티리얼을 쓰는 스태틱 메시를 인스턴스 드로우로 합칩니다.");
+		}
+
+		// CPU 오클루전 컬링
+		bool bOcclusionCulling = RenderSettings.IsShowFlagEnabled(EEngineShowFlags::SF_OcclusionCulling);
+		if (ImGui::Checkbox("##OcclusionCulling", &bOcclusionCulling))
+		{
+			RenderSettings.ToggleShowFlag(EEngineShowFlags::SF_OcclusionCulling);
+		}
+		ImGui::SameLine();
+		ImGui::Text(" 오클루전 컬링");
+		if (ImGui::IsItemHovered())
+		{
+			ImGui::SetTooltip("큰 스태틱 메시를 CPU에서 래스터화해 그 뒤에 가려진 스태틱 메시를 그리지 않습니다.");
+		}
+
 		// Tile-Based Light Culling
 		bool bTileCulling = RenderSettings.IsShowFlagEnabled(EEngineShowFlags::SF_TileCulling);
 		if (ImGui::Checkbox("##TileCulling", &bTileCulling))
@@ -1830,6 +1896,28 @@ void SViewportWindow::RenderShowFlagDropdownMenu()
 			// 현재 설정값 표시
 			ImGui::Text("현재 타일 크기: %d x %d", RenderSettings.GetTileSize(), RenderSettings.GetTileSize());
 
+			ImGui::Separator();
+
+			// 클러스터(froxel) 깊이 슬라이스 수 (0이면 2D 타일)
+			ImGui::Text("클러스터 깊이 슬라이스");
+			int sliceCount = static_cast<int>(RenderSettings.GetClusterSliceCount());
+			const int oldSliceCount = sliceCount;
+			ImGui::RadioButton("끔##ClusterOff", &sliceCount, 0);
+			ImGui::SameLine();
+			ImGui::RadioButton("8##Cluster8", &sliceCount, 8);
+			ImGui::SameLine();
+			ImGui::RadioButton("16##Cluster16", &sliceCount, 16);
+			ImGui::SameLine();
+			ImGui::RadioButton("32##Cluster32", &sliceCount, 32);
+			if (ImGui::IsItemHovered())
+			{
+				ImGui::SetTooltip("뷰 깊이를 로그 스케일로 나눠 타일마다 깊이 구간별 라이트 목록을 만듭니다.");
+			}
+			if (sliceCount != oldSliceCount)
+			{
+				RenderSettings.SetClusterSliceCount(static_cast<uint32>(sliceCount));
+			}
+
 			ImGui::EndMenu();
 		}
 		if (ImGui::IsItemHovered())
@@ -1,6 +1,7 @@
 ﻿#include "pch.h"
 #include "EditorEngine.h"
 #include "Source/Runtime/Debug/CrashHandler.h"
+#include "Source/Runtime/Debug/FrameBenchmark.h"
 
 #if defined(_MSC_VER) && defined(_DEBUG)
 #   define _CRTDBG_MAP_ALLOC
@@ -18,6 +19,7 @@ int WINAPI WinMain(HINSTANCE hInstance, HINSTANCE hPrevInstance, LPSTR lpCmdLine
 #endif
 
     FCrashHandler::Init();  
+    FFrameBenchmark::ParseCommandLine(lpCmdLine);
 
     if (!GEngine.Startup(hInstance))
         return -1;